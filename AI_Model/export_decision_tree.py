@@ -0,0 +1,87 @@
+"""
+Export the decision tree trained in Building_Artificial_Intelligence_Model.ipynb as a flat array of nodes in C
+(see Implementation/Project_Utilities/decision_tree.h), used by the smart transformer as fast path in front of the
+neural network.
+
+Usage: python3 export_decision_tree.py [models/decision-tree-model.pickle] [output.h]
+
+The confidence of every leaf is the Laplace-smoothed frequency of its majority class, (count+1)/(samples+classes):
+the tree is grown until the leaves are pure, so the raw frequency would always be 1 while a leaf reached by a couple
+of training samples is much less reliable than one reached by hundreds.
+"""
+import pickle
+import struct
+import sys
+
+DEFAULT_MODEL = "models/decision-tree-model.pickle"
+DEFAULT_OUTPUT = "../Implementation/Project_SmartTransformer/smart_transformer_fault_detection_tree.h"
+NAME = "smart_transformer_fault_detection_tree"
+LEAF = -1
+
+
+def float_not_above(value):
+    """Largest float32 <= value: the C code compares float features, this keeps the same split as sklearn."""
+    f = struct.unpack("f", struct.pack("f", value))[0]
+    if f > value:
+        bits = struct.unpack("I", struct.pack("f", f))[0]
+        bits = bits - 1 if f > 0 else bits + 1
+        f = struct.unpack("f", struct.pack("I", bits))[0]
+    return f
+
+
+def leaf_class_and_confidence(counts, n_samples):
+    n_classes = len(counts)
+    leaf_class = max(range(n_classes), key=lambda c: counts[c])
+    # sklearn >= 1.4 stores the class frequencies instead of the counts
+    majority = counts[leaf_class] * n_samples if sum(counts) <= 1.0 + 1e-9 else counts[leaf_class]
+    return leaf_class, (round(majority) + 1.0) / (n_samples + n_classes)
+
+
+def write_header(path, left, right, feature, threshold, n_samples, values, n_features, n_classes, source):
+    """
+    Writes the C header. All the arguments describing the nodes are sequences indexed by node, as in sklearn's
+    Tree object (children_left, children_right, feature, threshold, n_node_samples, value[:, 0, :]).
+    """
+    n_nodes = len(left)
+    lines = []
+    depth = [0] * n_nodes
+    for i in range(n_nodes):
+        if left[i] != LEAF:
+            # The C evaluator moves to the next node when going left: this is the depth-first order of sklearn
+            assert left[i] == i + 1, "unexpected node order"
+            depth[left[i]] = depth[right[i]] = depth[i] + 1
+            lines.append("{ %d, 0, %d, %.9gf }" % (feature[i], right[i], float_not_above(threshold[i])))
+        else:
+            leaf_class, confidence = leaf_class_and_confidence(values[i], n_samples[i])
+            lines.append("{ DECISION_TREE_LEAF, %d, 0, %.6ff }" % (leaf_class, confidence))
+
+    n_leaves = sum(1 for i in range(n_nodes) if left[i] == LEAF)
+    with open(path, "w") as out:
+        out.write("// Generated by AI_Model/export_decision_tree.py from %s, do not edit.\n" % source)
+        out.write("// Nodes: %d (%d leaves), max depth: %d\n" % (n_nodes, n_leaves, max(depth)))
+        out.write('#include "decision_tree.h"\n')
+        out.write("static const decision_tree_node %s_nodes[%d] = {\n" % (NAME, n_nodes))
+        out.write(",\n".join(lines))
+        out.write("\n};\n")
+        out.write("static const decision_tree %s = { %d, %d, %d, %s_nodes };\n"
+                  % (NAME, n_features, n_classes, n_nodes, NAME))
+
+
+def main():
+    model_path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_MODEL
+    output_path = sys.argv[2] if len(sys.argv) > 2 else DEFAULT_OUTPUT
+
+    with open(model_path, "rb") as fin:
+        clf = pickle.load(fin)
+
+    # The classes must be the integers 0..n-1 used as indexes by the firmware (FAULT_TYPE_0..4)
+    assert list(clf.classes_) == list(range(clf.n_classes_))
+    tree = clf.tree_
+    write_header(output_path, tree.children_left, tree.children_right, tree.feature, tree.threshold,
+                 tree.n_node_samples, tree.value[:, 0, :], clf.n_features_in_, clf.n_classes_,
+                 model_path.split("/")[-1])
+    print("Decision tree with %d nodes written to %s" % (tree.node_count, output_path))
+
+
+if __name__ == "__main__":
+    main()
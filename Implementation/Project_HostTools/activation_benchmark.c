@@ -0,0 +1,129 @@
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "smart_transformer_fault_detection.h"
+#include "eml_net_fast_activations.h"
+#include "dataset_csv.h"
+
+/*
+ * Host benchmark of the activation backends of fast_activations.
+ * 1. Max error of tanh (absolute, on [-10,10]) and exp (relative, on [-16,0]) on a dense sweep, against libm in double.
+ * 2. Cycles (time stamp counter on x86, nanoseconds elsewhere) per inference of the fault detection network and
+ *    class agreement with eml_net_predict_proba on a labelled csv.
+ * The timings are only a relative indication: on a Cortex-M without FPU every float operation is emulated and the
+ * gap between libm and the approximations is larger than on the host.
+ * Usage: activation_benchmark <dataset.csv|dataset.col>
+ */
+
+#define NR_CLASSES 5
+#define SWEEP_STEP 1e-4
+#define EXP_SWEEP_LIMIT 15.99 // The table backend returns 0 from -16, where exp is already below 1.2e-7
+#define REPETITIONS 20
+
+static const char *backend_names[] = {"libm", "table", "poly"};
+
+
+static int argmax(const float *values, int n){
+	int max_index=0;
+
+	for (int i=1; i<n; i++){
+		if (values[i]>values[max_index]){
+			max_index=i;
+		}
+	}
+	return max_index;
+}
+
+
+static unsigned long long timestamp(void){
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return now.tv_sec*1000000000ULL+now.tv_nsec;
+#endif
+}
+
+
+static float backend_tanh(fast_activations_backend backend, float x){
+	fast_activations_tanh(backend,&x,1);
+	return x;
+}
+
+
+static float backend_exp(fast_activations_backend backend, float x){
+	switch (backend){
+		case FAST_ACTIVATIONS_TABLE:
+			return fast_expf_table(x);
+		case FAST_ACTIVATIONS_POLY:
+			return fast_expf_poly(x);
+		default:
+			return expf(x);
+	}
+}
+
+
+int main(int argc, char **argv){
+
+	dataset data;
+
+	if (argc!=2){
+		fprintf(stderr,"Usage: %s <dataset.csv|dataset.col>\n",argv[0]);
+		return 1;
+	}
+	if (dataset_load(argv[1],&data)!=0){
+		return 1;
+	}
+
+	printf("Rows: %zu\n",data.nr_rows);
+#if defined(__x86_64__) || defined(__i386__)
+	printf("backend  tanh_max_abs_err  exp_max_rel_err  cycles/inference  agreement\n");
+#else
+	printf("backend  tanh_max_abs_err  exp_max_rel_err  ns/inference  agreement\n");
+#endif
+
+	for (int b=FAST_ACTIVATIONS_LIBM; b<=FAST_ACTIVATIONS_POLY; b++){
+		double tanh_error=0, exp_error=0;
+		unsigned long long start, ticks=0;
+		size_t agreement=0;
+
+		for (double x=-10; x<=10; x+=SWEEP_STEP){
+			double error=fabs(backend_tanh(b,(float)x)-tanh((float)x));
+
+			tanh_error=(error>tanh_error)?error:tanh_error;
+		}
+		for (double x=-EXP_SWEEP_LIMIT; x<=0; x+=SWEEP_STEP){
+			double reference=exp((float)x);
+			double error=fabs(backend_exp(b,(float)x)-reference)/reference;
+
+			exp_error=(error>exp_error)?error:exp_error;
+		}
+
+		for (size_t r=0; r<data.nr_rows; r++){
+			const float *features=data.features+r*DATASET_NR_FEATURES;
+			float outputs_reference[NR_CLASSES], outputs[NR_CLASSES];
+
+			eml_net_predict_proba(&smart_transformer_fault_detection,features,DATASET_NR_FEATURES,outputs_reference,NR_CLASSES);
+
+			start=timestamp();
+			for (int k=0; k<REPETITIONS; k++){
+				eml_net_fast_predict_proba(&smart_transformer_fault_detection,b,features,DATASET_NR_FEATURES,outputs,NR_CLASSES);
+			}
+			ticks+=timestamp()-start;
+
+			agreement+=(argmax(outputs,NR_CLASSES)==argmax(outputs_reference,NR_CLASSES));
+		}
+
+		printf("%-7s  %16.2e  %15.2e  %16.0f  %zu/%zu\n",backend_names[b],tanh_error,exp_error,
+			(double)ticks/(data.nr_rows*REPETITIONS),agreement,data.nr_rows);
+	}
+
+	dataset_free(&data);
+	return 0;
+}
@@ -0,0 +1,286 @@
+#include <getopt.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "smart_transformer_fault_detection.h"
+#include "dataset_csv.h"
+
+/*
+ * Offline scorer for the fault detection model: it evaluates the same weight arrays flashed on the smart transformer
+ * over whole datasets (e.g. exports of smart_transformer_sensor_measurments) processing a batch of rows at a time.
+ * Every layer becomes a matrix-matrix product whose inner loop runs over contiguous outputs, so that the compiler
+ * can vectorize it (AVX2/NEON with -O3 -march=native), and the rows are split among several threads.
+ * The features are read column by column through dataset_map(): a columnar file (dataset_convert, trace_generator)
+ * is scored in place from its mapping, only the rows of the current batch are copied next to each other.
+ *
+ * Usage: batch_scorer [-t threads] [-b batch] [-r repeat] [-o predictions.csv] [-n] <dataset.csv|dataset.col>
+ *   -t number of worker threads (default 4)
+ *   -b number of rows evaluated together by each layer (default 64)
+ *   -r number of passes over the dataset, useful to measure the throughput on small files (default 1)
+ *   -o write the predicted class and probabilities of each row
+ *   -n skip the per-row comparison against eml_net_predict_proba
+ */
+
+#define NR_CLASSES 5
+#define DEFAULT_THREADS 4
+#define DEFAULT_BATCH 64
+#define ROW_BLOCK 4
+
+typedef struct {
+	const dataset *data;
+	size_t first_row;
+	size_t last_row;
+	int batch;
+	int repeat;
+	float *probabilities;  // nr_rows x NR_CLASSES, shared: every thread writes only its rows
+} worker_args;
+
+
+/**
+ * Forward pass of one layer over a batch of rows: out[b][o] = activation(bias[o] + sum_i in[b][i]*W[i][o]).
+ * The weights are stored by emlearn input-major (weights[i*n_outputs+o]), so for every input the row of weights
+ * is accumulated on contiguous outputs.
+ * @param layer The emlearn layer
+ * @param in The input matrix (rows x n_inputs)
+ * @param out The output matrix (rows x n_outputs)
+ * @param rows The number of rows in the batch
+ */
+static void layer_forward_batch(const EmlNetLayer *layer, const float *restrict in, float *restrict out, int rows){
+
+	const int n_in=layer->n_inputs;
+	const int n_out=layer->n_outputs;
+
+	// Rows are processed ROW_BLOCK at a time, so every weight loaded from memory is used ROW_BLOCK times.
+	for (int b=0; b<rows; b+=ROW_BLOCK){
+		const int block=(rows-b<ROW_BLOCK)?rows-b:ROW_BLOCK;
+
+		for (int r=0; r<block; r++){
+			memcpy(out+(b+r)*n_out,layer->biases,n_out*sizeof(float));
+		}
+
+		if (block==ROW_BLOCK){
+			float *restrict out0=out+b*n_out;
+			float *restrict out1=out0+n_out;
+			float *restrict out2=out1+n_out;
+			float *restrict out3=out2+n_out;
+
+			for (int i=0; i<n_in; i++){
+				const float *restrict w=layer->weights+i*n_out;
+				const float a0=in[b*n_in+i];
+				const float a1=in[(b+1)*n_in+i];
+				const float a2=in[(b+2)*n_in+i];
+				const float a3=in[(b+3)*n_in+i];
+
+				for (int o=0; o<n_out; o++){
+					out0[o]+=a0*w[o];
+					out1[o]+=a1*w[o];
+					out2[o]+=a2*w[o];
+					out3[o]+=a3*w[o];
+				}
+			}
+		}
+		else {
+			for (int r=0; r<block; r++){
+				float *restrict out_row=out+(b+r)*n_out;
+
+				for (int i=0; i<n_in; i++){
+					const float *restrict w=layer->weights+i*n_out;
+					const float a=in[(b+r)*n_in+i];
+
+					for (int o=0; o<n_out; o++){
+						out_row[o]+=a*w[o];
+					}
+				}
+			}
+		}
+	}
+
+	switch (layer->activation){
+		case EmlNetActivationTanh:
+			for (int k=0; k<rows*n_out; k++){
+				out[k]=tanhf(out[k]);
+			}
+			break;
+
+		case EmlNetActivationSoftmax:
+			for (int b=0; b<rows; b++){
+				float *row=out+b*n_out;
+				float max=row[0], sum=0;
+
+				for (int o=1; o<n_out; o++){
+					max=fmaxf(max,row[o]);
+				}
+				for (int o=0; o<n_out; o++){
+					row[o]=expf(row[o]-max);
+					sum+=row[o];
+				}
+				for (int o=0; o<n_out; o++){
+					row[o]/=sum;
+				}
+			}
+			break;
+
+		case EmlNetActivationRelu:
+			for (int k=0; k<rows*n_out; k++){
+				out[k]=fmaxf(out[k],0);
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+
+/**
+ * Thread body: evaluates the rows [first_row,last_row) in batches.
+ */
+static void *score_rows(void *ptr){
+
+	worker_args *args=ptr;
+	const EmlNet *net=&smart_transformer_fault_detection;
+	float *buf1=malloc(args->batch*net->activations_length*sizeof(float));
+	float *buf2=malloc(args->batch*net->activations_length*sizeof(float));
+	float *features=malloc(args->batch*DATASET_NR_FEATURES*sizeof(float));
+
+	for (int pass=0; pass<args->repeat; pass++){
+		for (size_t row=args->first_row; row<args->last_row; row+=args->batch){
+			int rows=(args->last_row-row<(size_t)args->batch)?(int)(args->last_row-row):args->batch;
+			const float *in=features;
+			float *out=buf1;
+
+			for (int f=0; f<DATASET_NR_FEATURES; f++){
+				const float *column=args->data->columns[f]+row;
+
+				for (int r=0; r<rows; r++){
+					features[r*DATASET_NR_FEATURES+f]=column[r];
+				}
+			}
+			for (int l=0; l<net->n_layers; l++){
+				layer_forward_batch(&net->layers[l],in,out,rows);
+				in=out;
+				out=(out==buf1)?buf2:buf1;
+			}
+			memcpy(args->probabilities+row*NR_CLASSES,in,rows*NR_CLASSES*sizeof(float));
+		}
+	}
+
+	free(buf1);
+	free(buf2);
+	free(features);
+	return NULL;
+}
+
+
+static int argmax(const float *values, int n){
+	int max_index=0;
+
+	for (int i=1; i<n; i++){
+		if (values[i]>values[max_index]){
+			max_index=i;
+		}
+	}
+	return max_index;
+}
+
+
+int main(int argc, char **argv){
+
+	int nr_threads=DEFAULT_THREADS, batch=DEFAULT_BATCH, repeat=1, verify=1, opt;
+	const char *output_path=NULL;
+	dataset data;
+	float *probabilities;
+	pthread_t *threads;
+	worker_args *args;
+	struct timespec start, end;
+	double seconds;
+
+	while ((opt=getopt(argc,argv,"t:b:r:o:n"))!=-1){
+		switch (opt){
+			case 't': nr_threads=atoi(optarg); break;
+			case 'b': batch=atoi(optarg); break;
+			case 'r': repeat=atoi(optarg); break;
+			case 'o': output_path=optarg; break;
+			case 'n': verify=0; break;
+			default:
+				fprintf(stderr,"Usage: %s [-t threads] [-b batch] [-r repeat] [-o predictions.csv] [-n] <dataset.csv|dataset.col>\n",argv[0]);
+				return 1;
+		}
+	}
+	if (optind>=argc || nr_threads<1 || batch<1 || repeat<1){
+		fprintf(stderr,"Usage: %s [-t threads] [-b batch] [-r repeat] [-o predictions.csv] [-n] <dataset.csv|dataset.col>\n",argv[0]);
+		return 1;
+	}
+	if (dataset_map(argv[optind],&data)!=0){
+		return 1;
+	}
+
+	probabilities=malloc(data.nr_rows*NR_CLASSES*sizeof(float));
+	threads=malloc(nr_threads*sizeof(pthread_t));
+	args=malloc(nr_threads*sizeof(worker_args));
+
+	clock_gettime(CLOCK_MONOTONIC,&start);
+	for (int t=0; t<nr_threads; t++){
+		args[t].data=&data;
+		args[t].first_row=data.nr_rows*t/nr_threads;
+		args[t].last_row=data.nr_rows*(t+1)/nr_threads;
+		args[t].batch=batch;
+		args[t].repeat=repeat;
+		args[t].probabilities=probabilities;
+		pthread_create(&threads[t],NULL,score_rows,&args[t]);
+	}
+	for (int t=0; t<nr_threads; t++){
+		pthread_join(threads[t],NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC,&end);
+
+	seconds=(end.tv_sec-start.tv_sec)+(end.tv_nsec-start.tv_nsec)/1e9;
+	printf("Rows: %zu -- passes: %d -- threads: %d -- batch: %d\n",data.nr_rows,repeat,nr_threads,batch);
+	printf("Throughput: %.0f samples/s (%.3f s)\n",data.nr_rows*(double)repeat/seconds,seconds);
+
+	if (verify){
+		size_t agreement=0;
+		float max_diff=0;
+
+		for (size_t r=0; r<data.nr_rows; r++){
+			float features[DATASET_NR_FEATURES], reference[NR_CLASSES];
+
+			for (int f=0; f<DATASET_NR_FEATURES; f++){
+				features[f]=data.columns[f][r];
+			}
+			eml_net_predict_proba(&smart_transformer_fault_detection,features,DATASET_NR_FEATURES,reference,NR_CLASSES);
+			if (argmax(reference,NR_CLASSES)==argmax(probabilities+r*NR_CLASSES,NR_CLASSES)){
+				agreement++;
+			}
+			for (int c=0; c<NR_CLASSES; c++){
+				max_diff=fmaxf(max_diff,fabsf(reference[c]-probabilities[r*NR_CLASSES+c]));
+			}
+		}
+		printf("Agreement with eml_net_predict_proba: %zu/%zu rows (max probability difference %.2e)\n",agreement,data.nr_rows,max_diff);
+	}
+
+	if (output_path!=NULL){
+		FILE *out=fopen(output_path,"w");
+
+		if (out==NULL){
+			perror(output_path);
+			return 1;
+		}
+		fprintf(out,"FaultType,P0,P1,P2,P3,P4\n");
+		for (size_t r=0; r<data.nr_rows; r++){
+			const float *p=probabilities+r*NR_CLASSES;
+			fprintf(out,"%d,%.6f,%.6f,%.6f,%.6f,%.6f\n",argmax(p,NR_CLASSES),p[0],p[1],p[2],p[3],p[4]);
+		}
+		fclose(out);
+	}
+
+	free(probabilities);
+	free(threads);
+	free(args);
+	dataset_free(&data);
+	return 0;
+}
@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <time.h>
+
+#include "smart_transformer_fault_detection.h"
+#include "smart_transformer_fault_detection_tree.h"
+#include "dataset_csv.h"
+
+/*
+ * Host-side evaluation of the two-stage classifier of the smart transformer: the decision tree answers alone when
+ * the confidence of its leaf reaches the threshold, otherwise the neural network is called.
+ * For every threshold it reports the share of rows answered by the tree, the accuracy of the cascade and the mean
+ * time per inference, to be compared with the neural network alone (the first line of the table).
+ * Usage: cascade_accuracy <dataset.csv|dataset.col>
+ */
+
+#define NR_CLASSES 5
+
+static const float thresholds[] = {0.5f, 0.6f, 0.7f, 0.75f, 0.8f, 0.9f};
+
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end){
+	return (end->tv_sec-start->tv_sec)*1e9+(end->tv_nsec-start->tv_nsec);
+}
+
+
+static int argmax(const float *values, int n){
+	int max_index=0;
+
+	for (int i=1; i<n; i++){
+		if (values[i]>values[max_index]){
+			max_index=i;
+		}
+	}
+	return max_index;
+}
+
+
+/**
+ * Runs the cascade over the whole dataset.
+ * @param data The labelled rows
+ * @param threshold Minimum leaf confidence to skip the neural network, above 1 the tree is never trusted
+ * @param tree_answers Filled with the number of rows answered by the tree alone
+ * @param time_ns Filled with the total time spent in the inference
+ * @return The number of rows classified correctly
+ */
+static size_t run_cascade(const dataset *data, float threshold, size_t *tree_answers, double *time_ns){
+	size_t correct=0;
+	struct timespec start, end;
+
+	*tree_answers=0;
+	*time_ns=0;
+	for (size_t r=0; r<data->nr_rows; r++){
+		const float *features=data->features+r*DATASET_NR_FEATURES;
+		float outputs[NR_CLASSES];
+		float confidence;
+		int predicted_class;
+
+		clock_gettime(CLOCK_MONOTONIC,&start);
+		predicted_class=decision_tree_predict(&smart_transformer_fault_detection_tree,features,DATASET_NR_FEATURES,&confidence);
+		if (predicted_class<0 || confidence<threshold){
+			eml_net_predict_proba(&smart_transformer_fault_detection,features,DATASET_NR_FEATURES,outputs,NR_CLASSES);
+			predicted_class=argmax(outputs,NR_CLASSES);
+		}
+		else {
+			(*tree_answers)++;
+		}
+		clock_gettime(CLOCK_MONOTONIC,&end);
+		*time_ns+=elapsed_ns(&start,&end);
+
+		correct+=(predicted_class==data->labels[r]);
+	}
+	return correct;
+}
+
+
+int main(int argc, char **argv){
+
+	dataset data;
+	size_t correct, tree_answers;
+	double time_ns;
+
+	if (argc!=2){
+		fprintf(stderr,"Usage: %s <dataset.csv|dataset.col>\n",argv[0]);
+		return 1;
+	}
+	if (dataset_load(argv[1],&data)!=0){
+		return 1;
+	}
+
+	printf("Rows: %zu\n",data.nr_rows);
+	printf("threshold  tree_share  accuracy  ns/inference\n");
+
+	correct=run_cascade(&data,2.0f,&tree_answers,&time_ns);
+	printf("%-9s  %9.1f%%  %7.2f%%  %12.0f\n","nn only",100.0*tree_answers/data.nr_rows,100.0*correct/data.nr_rows,time_ns/data.nr_rows);
+
+	for (size_t t=0; t<sizeof(thresholds)/sizeof(thresholds[0]); t++){
+		correct=run_cascade(&data,thresholds[t],&tree_answers,&time_ns);
+		printf("%-9.2f  %9.1f%%  %7.2f%%  %12.0f\n",thresholds[t],100.0*tree_answers/data.nr_rows,100.0*correct/data.nr_rows,time_ns/data.nr_rows);
+	}
+
+	correct=run_cascade(&data,0.0f,&tree_answers,&time_ns);
+	printf("%-9s  %9.1f%%  %7.2f%%  %12.0f\n","tree only",100.0*tree_answers/data.nr_rows,100.0*correct/data.nr_rows,time_ns/data.nr_rows);
+
+	dataset_free(&data);
+	return 0;
+}
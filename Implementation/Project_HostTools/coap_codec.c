@@ -0,0 +1,274 @@
+#include <string.h>
+
+#include "coap_codec.h"
+
+/*
+ * Minimal CoAP encoder/decoder for the host tools that play the sensors (virtual_fleet). Only what the Contiki nodes
+ * exchange with the server is supported: no block-wise transfer, and the options other than Observe, Uri-Path,
+ * Content-Format, Uri-Query and Accept are skipped.
+ */
+
+#define COAP_VERSION 1
+#define PAYLOAD_MARKER 0xFF
+
+#define OPTION_OBSERVE 6
+#define OPTION_URI_PATH 11
+#define OPTION_CONTENT_FORMAT 12
+#define OPTION_URI_QUERY 15
+#define OPTION_ACCEPT 17
+
+
+/**
+ * Prepares an empty message, without token, options and payload.
+ * @param message The message
+ * @param type One of COAP_CODEC_CON/NON/ACK/RST
+ * @param code The method or response code
+ * @param mid The message ID
+ */
+void coap_codec_init(coap_codec_message *message, uint8_t type, uint8_t code, uint16_t mid){
+	memset(message,0,sizeof(*message));
+	message->type=type;
+	message->code=code;
+	message->mid=mid;
+}
+
+
+// Reads the extended delta or length of an option (nibble 13 or 14), -1 if the message ends
+static int read_extended(int nibble, const uint8_t *data, int length, int *position){
+
+	if (nibble<13){
+		return nibble;
+	}
+	if (nibble==13){
+		if (*position+1>length){
+			return -1;
+		}
+		return 13+data[(*position)++];
+	}
+	if (nibble==14 && *position+2<=length){
+		int value=(data[*position]<<8 | data[*position+1])+269;
+
+		*position+=2;
+		return value;
+	}
+	return -1;
+}
+
+
+static uint32_t read_uint(const uint8_t *value, int length){
+
+	uint32_t result=0;
+
+	for (int i=0; i<length; i++){
+		result=result<<8 | value[i];
+	}
+	return result;
+}
+
+
+// Appends a segment to a list separated by separator, false if it does not fit
+static bool append_segment(char *list, int size, char separator, const uint8_t *segment, int length){
+
+	int used=strlen(list);
+	int needed=length+(used>0 ? 1 : 0);
+
+	if (used+needed>=size){
+		return false;
+	}
+	if (used>0){
+		list[used++]=separator;
+	}
+	memcpy(list+used,segment,length);
+	list[used+length]='\0';
+	return true;
+}
+
+
+/**
+ * Decodes a datagram. The payload is not copied: it points into data.
+ * @param message Filled with the message
+ * @param data The datagram
+ * @param length The length of the datagram
+ * @return 0 on success, -1 if the datagram is not a valid CoAP message (or a path/query is too long)
+ */
+int coap_codec_parse(coap_codec_message *message, const uint8_t *data, int length){
+
+	int position=4;
+	int option=0;
+
+	if (length<4 || data[0]>>6!=COAP_VERSION || (data[0]&0x0F)>COAP_CODEC_MAX_TOKEN_LEN){
+		return -1;
+	}
+	coap_codec_init(message, (data[0]>>4)&0x03, data[1], data[2]<<8 | data[3]);
+	message->token_len=data[0]&0x0F;
+	if (position+message->token_len>length){
+		return -1;
+	}
+	memcpy(message->token,data+position,message->token_len);
+	position+=message->token_len;
+
+	while (position<length && data[position]!=PAYLOAD_MARKER){
+		int header=data[position++];
+		int delta=read_extended(header>>4, data, length, &position);
+		int option_length=read_extended(header&0x0F, data, length, &position);
+		const uint8_t *value=data+position;
+
+		if (delta<0 || option_length<0 || position+option_length>length){
+			return -1;
+		}
+		position+=option_length;
+		option+=delta;
+
+		switch (option){
+			case OPTION_OBSERVE:
+				message->options|=COAP_CODEC_OPTION_OBSERVE;
+				message->observe=read_uint(value,option_length);
+				break;
+			case OPTION_CONTENT_FORMAT:
+				message->options|=COAP_CODEC_OPTION_CONTENT_FORMAT;
+				message->content_format=read_uint(value,option_length);
+				break;
+			case OPTION_ACCEPT:
+				message->options|=COAP_CODEC_OPTION_ACCEPT;
+				message->accept=read_uint(value,option_length);
+				break;
+			case OPTION_URI_PATH:
+				if (!append_segment(message->uri_path, COAP_CODEC_MAX_PATH_LEN, '/', value, option_length)){
+					return -1;
+				}
+				break;
+			case OPTION_URI_QUERY:
+				if (!append_segment(message->uri_query, COAP_CODEC_MAX_QUERY_LEN, '&', value, option_length)){
+					return -1;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	if (position<length){
+		// Payload marker: an empty payload after it is a format error
+		if (++position==length){
+			return -1;
+		}
+		message->payload=data+position;
+		message->payload_len=length-position;
+	}
+	return 0;
+}
+
+
+// Writes an option header and its value, returns the new position or -1 if it does not fit
+static int write_option(uint8_t *buffer, int buffer_size, int position, int delta, const uint8_t *value, int length){
+
+	int fields[2]={delta, length};
+	int nibbles[2];
+	int extended=0;
+
+	for (int i=0; i<2; i++){
+		nibbles[i]=fields[i]<13 ? fields[i] : (fields[i]<269 ? 13 : 14);
+		extended+=nibbles[i]==13 ? 1 : (nibbles[i]==14 ? 2 : 0);
+	}
+	if (position+1+extended+length>buffer_size){
+		return -1;
+	}
+
+	buffer[position++]=nibbles[0]<<4 | nibbles[1];
+	for (int i=0; i<2; i++){
+		if (nibbles[i]==13){
+			buffer[position++]=fields[i]-13;
+		}
+		else if (nibbles[i]==14){
+			buffer[position++]=(fields[i]-269)>>8;
+			buffer[position++]=(fields[i]-269)&0xFF;
+		}
+	}
+	memcpy(buffer+position,value,length);
+	return position+length;
+}
+
+
+// Writes an unsigned integer option with the fewest bytes (none for 0)
+static int write_uint_option(uint8_t *buffer, int buffer_size, int position, int delta, uint32_t value){
+
+	uint8_t bytes[4];
+	int length=0;
+
+	for (int shift=24; shift>=0; shift-=8){
+		if (length>0 || (value>>shift)&0xFF){
+			bytes[length++]=(value>>shift)&0xFF;
+		}
+	}
+	return write_option(buffer, buffer_size, position, delta, bytes, length);
+}
+
+
+// Writes the segments of a list as repeated options
+static int write_list_option(uint8_t *buffer, int buffer_size, int position, int *last_option, int option, const char *list, char separator){
+
+	const char *segment=list;
+
+	while (*segment!='\0' && position>=0){
+		const char *end=strchr(segment,separator);
+		int length=end!=NULL ? end-segment : (int)strlen(segment);
+
+		position=write_option(buffer, buffer_size, position, option-*last_option, (const uint8_t *)segment, length);
+		*last_option=option;
+		segment+=length+(end!=NULL ? 1 : 0);
+	}
+	return position;
+}
+
+
+/**
+ * Encodes a message.
+ * @param message The message
+ * @param buffer The destination
+ * @param buffer_size The size of the destination
+ * @return The length of the datagram, -1 if it does not fit
+ */
+int coap_codec_serialize(const coap_codec_message *message, uint8_t *buffer, int buffer_size){
+
+	int position=4+message->token_len;
+	int last_option=0;
+
+	if (position>buffer_size || message->token_len>COAP_CODEC_MAX_TOKEN_LEN){
+		return -1;
+	}
+	buffer[0]=COAP_VERSION<<6 | message->type<<4 | message->token_len;
+	buffer[1]=message->code;
+	buffer[2]=message->mid>>8;
+	buffer[3]=message->mid&0xFF;
+	memcpy(buffer+4,message->token,message->token_len);
+
+	// Options in increasing number
+	if (message->options&COAP_CODEC_OPTION_OBSERVE){
+		position=write_uint_option(buffer, buffer_size, position, OPTION_OBSERVE-last_option, message->observe&0xFFFFFF);
+		last_option=OPTION_OBSERVE;
+	}
+	if (position>=0){
+		position=write_list_option(buffer, buffer_size, position, &last_option, OPTION_URI_PATH, message->uri_path, '/');
+	}
+	if (position>=0 && message->options&COAP_CODEC_OPTION_CONTENT_FORMAT){
+		position=write_uint_option(buffer, buffer_size, position, OPTION_CONTENT_FORMAT-last_option, message->content_format);
+		last_option=OPTION_CONTENT_FORMAT;
+	}
+	if (position>=0){
+		position=write_list_option(buffer, buffer_size, position, &last_option, OPTION_URI_QUERY, message->uri_query, '&');
+	}
+	if (position>=0 && message->options&COAP_CODEC_OPTION_ACCEPT){
+		position=write_uint_option(buffer, buffer_size, position, OPTION_ACCEPT-last_option, message->accept);
+		last_option=OPTION_ACCEPT;
+	}
+
+	if (position>=0 && message->payload_len>0){
+		if (position+1+message->payload_len>buffer_size){
+			return -1;
+		}
+		buffer[position++]=PAYLOAD_MARKER;
+		memcpy(buffer+position,message->payload,message->payload_len);
+		position+=message->payload_len;
+	}
+	return position;
+}
@@ -0,0 +1,56 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#define COAP_CODEC_MAX_TOKEN_LEN 8
+#define COAP_CODEC_MAX_PATH_LEN 64
+#define COAP_CODEC_MAX_QUERY_LEN 64
+
+// Message types
+#define COAP_CODEC_CON 0
+#define COAP_CODEC_NON 1
+#define COAP_CODEC_ACK 2
+#define COAP_CODEC_RST 3
+
+// Codes used by the nodes (class << 5 | detail)
+#define COAP_CODEC_EMPTY 0
+#define COAP_CODEC_GET 1
+#define COAP_CODEC_POST 2
+#define COAP_CODEC_PUT 3
+#define COAP_CODEC_CREATED 65
+#define COAP_CODEC_CHANGED 68
+#define COAP_CODEC_CONTENT 69
+#define COAP_CODEC_BAD_REQUEST 128
+#define COAP_CODEC_NOT_FOUND 132
+#define COAP_CODEC_METHOD_NOT_ALLOWED 133
+
+// Content formats
+#define COAP_CODEC_FORMAT_JSON 50
+#define COAP_CODEC_FORMAT_SENML_CBOR 112
+
+// Options present in a message
+#define COAP_CODEC_OPTION_OBSERVE 0x01
+#define COAP_CODEC_OPTION_CONTENT_FORMAT 0x02
+#define COAP_CODEC_OPTION_ACCEPT 0x04
+
+// A CoAP message (RFC 7252) reduced to the options exchanged by the sensors and the server: Observe, Uri-Path,
+// Content-Format, Uri-Query and Accept. The other options are skipped when parsing.
+typedef struct {
+	uint8_t type;
+	uint8_t code;
+	uint16_t mid;
+	uint8_t token_len;
+	uint8_t token[COAP_CODEC_MAX_TOKEN_LEN];
+	uint8_t options;                           // COAP_CODEC_OPTION_* flags
+	uint32_t observe;
+	uint16_t content_format;
+	uint16_t accept;
+	char uri_path[COAP_CODEC_MAX_PATH_LEN];    // Segments joined by '/', without the leading one
+	char uri_query[COAP_CODEC_MAX_QUERY_LEN];  // Arguments joined by '&'
+	const uint8_t *payload;
+	uint16_t payload_len;
+} coap_codec_message;
+
+
+void coap_codec_init(coap_codec_message *message, uint8_t type, uint8_t code, uint16_t mid);
+int coap_codec_parse(coap_codec_message *message, const uint8_t *data, int length);
+int coap_codec_serialize(const coap_codec_message *message, uint8_t *buffer, int buffer_size);
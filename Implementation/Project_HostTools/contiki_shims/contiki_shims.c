@@ -0,0 +1,32 @@
+#include <stdint.h>
+
+#include "random.h"
+#include "os/net/linkaddr.h"
+
+/*
+ * State behind the Contiki-NG stand-ins, for the tools that link the utilities of the sensors on the host.
+ */
+
+linkaddr_t linkaddr_node_addr;
+
+static uint32_t random_state=1;
+
+
+/**
+ * Seeds the generator, as random_init() does on the nodes.
+ * @param seed The seed
+ */
+void random_init(unsigned short seed){
+	random_state=seed ? seed : 1;
+}
+
+
+/**
+ * @return A pseudo-random number in [0, RANDOM_RAND_MAX] (xorshift32, not for cryptographic use)
+ */
+unsigned short random_rand(void){
+	random_state^=random_state<<13;
+	random_state^=random_state>>17;
+	random_state^=random_state<<5;
+	return (unsigned short)(random_state>>16);
+}
@@ -0,0 +1,17 @@
+// Host stand-in of the Contiki-NG link-layer address. The tools that play several nodes set linkaddr_node_addr
+// before calling the utilities of a node (e.g. the SenML base name is taken from it).
+#ifndef LINKADDR_H_
+#define LINKADDR_H_
+
+#include <stdint.h>
+
+#define LINKADDR_SIZE 8
+
+typedef union {
+	unsigned char u8[LINKADDR_SIZE];
+	uint16_t u16;
+} linkaddr_t;
+
+extern linkaddr_t linkaddr_node_addr;
+
+#endif
@@ -0,0 +1,5 @@
+// Host stand-in of the Contiki-NG pseudo-random generator (lib/random.h).
+#define RANDOM_RAND_MAX 65535U
+
+void random_init(unsigned short seed);
+unsigned short random_rand(void);
@@ -0,0 +1,17 @@
+// Host stand-in of the Contiki-NG log module: warnings and errors go to stderr, debug and info are discarded.
+#include <stdio.h>
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DBG 4
+
+#ifndef LOG_LEVEL_APP
+#define LOG_LEVEL_APP LOG_LEVEL_WARN
+#endif
+
+#define LOG_ERR(...) fprintf(stderr, __VA_ARGS__)
+#define LOG_WARN(...) fprintf(stderr, __VA_ARGS__)
+#define LOG_INFO(...) do {} while (0)
+#define LOG_DBG(...) do {} while (0)
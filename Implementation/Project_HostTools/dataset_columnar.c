@@ -0,0 +1,259 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "dataset_columnar.h"
+
+/*
+ * Columnar dataset files: the same samples of the csv files stored column by column as raw little-endian values,
+ * so that a tool reads only the columns it uses and no text is parsed. The number of rows is known when the file is
+ * created, therefore the position of every column is fixed from the start and several threads can fill different
+ * rows of the same file at the same time (dataset_columnar_write() uses pwrite). The host tools run on little-endian
+ * CPUs (x86, ARM), so the values are written as they are in memory.
+ * The readers map the file and use the columns where they are (every column starts on a cache line): loading a file
+ * costs only the page faults of the columns actually read, instead of the parsing of the whole csv.
+ */
+
+
+/**
+ * @param dtype The type of the values of a column
+ * @return The size in bytes of one value, 0 for an unknown type
+ */
+size_t dataset_columnar_dtype_size(dataset_columnar_dtype dtype){
+
+	switch (dtype){
+		case DATASET_COLUMNAR_F32:
+		case DATASET_COLUMNAR_U32:
+			return 4;
+		case DATASET_COLUMNAR_U8:
+			return 1;
+	}
+	return 0;
+}
+
+
+/**
+ * Creates a columnar file with room for nr_rows rows and writes its header.
+ * @param writer The writer to be initialized
+ * @param path The location of the file, overwritten if it exists
+ * @param schema The name and the type of each column
+ * @param nr_columns The number of columns
+ * @param nr_rows The number of rows of the file
+ * @return 0 on success, -1 otherwise
+ */
+int dataset_columnar_create(dataset_columnar_writer *writer, const char *path, const dataset_columnar_schema *schema, int nr_columns, uint64_t nr_rows){
+
+	dataset_columnar_header header;
+	uint64_t offset=sizeof(header)+nr_columns*sizeof(dataset_columnar_column);
+	size_t descriptors_size=nr_columns*sizeof(dataset_columnar_column);
+
+	memset(writer,0,sizeof(*writer));
+	writer->columns=calloc(nr_columns,sizeof(dataset_columnar_column));
+	writer->nr_columns=nr_columns;
+	writer->nr_rows=nr_rows;
+
+	for (int c=0; c<nr_columns; c++){
+		if (strlen(schema[c].name)>=DATASET_COLUMNAR_NAME_LEN || dataset_columnar_dtype_size(schema[c].dtype)==0){
+			fprintf(stderr,"Invalid column %s\n",schema[c].name);
+			free(writer->columns);
+			return -1;
+		}
+		offset=(offset+DATASET_COLUMNAR_ALIGNMENT-1)/DATASET_COLUMNAR_ALIGNMENT*DATASET_COLUMNAR_ALIGNMENT;
+		strcpy(writer->columns[c].name,schema[c].name);
+		writer->columns[c].dtype=schema[c].dtype;
+		writer->columns[c].offset=offset;
+		offset+=nr_rows*dataset_columnar_dtype_size(schema[c].dtype);
+	}
+
+	writer->fd=open(path,O_WRONLY|O_CREAT|O_TRUNC,0644);
+	if (writer->fd<0){
+		perror(path);
+		free(writer->columns);
+		return -1;
+	}
+
+	memset(&header,0,sizeof(header));
+	memcpy(header.magic,DATASET_COLUMNAR_MAGIC,sizeof(header.magic));
+	header.version=DATASET_COLUMNAR_VERSION;
+	header.nr_columns=nr_columns;
+	header.nr_rows=nr_rows;
+
+	// The file gets its final size now: the rows never written read back as zeros
+	if (pwrite(writer->fd,&header,sizeof(header),0)!=sizeof(header) ||
+		pwrite(writer->fd,writer->columns,descriptors_size,sizeof(header))!=(ssize_t)descriptors_size ||
+		ftruncate(writer->fd,offset)!=0){
+		perror(path);
+		dataset_columnar_close(writer);
+		return -1;
+	}
+	return 0;
+}
+
+
+/**
+ * Writes consecutive values of a column. It can be called by several threads at the same time on different rows.
+ * @param writer The writer returned by dataset_columnar_create()
+ * @param column The index of the column in the schema
+ * @param first_row The row of the first value
+ * @param values The values, in the type of the column
+ * @param nr_values The number of values
+ * @return 0 on success, -1 otherwise
+ */
+int dataset_columnar_write(dataset_columnar_writer *writer, int column, uint64_t first_row, const void *values, uint64_t nr_values){
+
+	const dataset_columnar_column *descriptor=&writer->columns[column];
+	size_t size=dataset_columnar_dtype_size(descriptor->dtype);
+	const char *data=values;
+	uint64_t length=nr_values*size;
+	uint64_t position=descriptor->offset+first_row*size;
+
+	if (first_row+nr_values>writer->nr_rows){
+		return -1;
+	}
+	while (length>0){
+		ssize_t written=pwrite(writer->fd,data,length,position);
+
+		if (written<=0){
+			perror("pwrite");
+			return -1;
+		}
+		data+=written;
+		position+=written;
+		length-=written;
+	}
+	return 0;
+}
+
+
+/**
+ * Closes the file and releases the writer.
+ * @param writer The writer returned by dataset_columnar_create()
+ * @return 0 on success, -1 if the file could not be completed
+ */
+int dataset_columnar_close(dataset_columnar_writer *writer){
+
+	int result=close(writer->fd);
+
+	free(writer->columns);
+	memset(writer,0,sizeof(*writer));
+	return result==0 ? 0 : -1;
+}
+
+
+/**
+ * @param path The location of a dataset file
+ * @return 1 if the file starts with the magic of the columnar format, 0 otherwise (e.g. a csv file)
+ */
+int dataset_columnar_is_columnar(const char *path){
+
+	char magic[sizeof(((dataset_columnar_header *)0)->magic)];
+	FILE *file=fopen(path,"rb");
+	int columnar;
+
+	if (file==NULL){
+		return 0;
+	}
+	columnar=(fread(magic,1,sizeof(magic),file)==sizeof(magic) && memcmp(magic,DATASET_COLUMNAR_MAGIC,sizeof(magic))==0);
+	fclose(file);
+	return columnar;
+}
+
+
+/**
+ * Maps a columnar file read-only and checks that its header and every column are within the file.
+ * @param file The file to be initialized
+ * @param path The location of the file
+ * @return 0 on success, -1 otherwise
+ */
+int dataset_columnar_open(dataset_columnar_file *file, const char *path){
+
+	const dataset_columnar_header *header;
+	struct stat info;
+	int fd=open(path,O_RDONLY);
+
+	memset(file,0,sizeof(*file));
+	if (fd<0 || fstat(fd,&info)!=0){
+		perror(path);
+		if (fd>=0){
+			close(fd);
+		}
+		return -1;
+	}
+	if ((size_t)info.st_size<sizeof(dataset_columnar_header)){
+		fprintf(stderr,"%s: not a columnar dataset\n",path);
+		close(fd);
+		return -1;
+	}
+
+	file->size=info.st_size;
+	file->map=mmap(NULL,file->size,PROT_READ,MAP_SHARED,fd,0);
+	// The mapping keeps its own reference to the file
+	close(fd);
+	if (file->map==MAP_FAILED){
+		perror(path);
+		file->map=NULL;
+		return -1;
+	}
+
+	header=file->map;
+	if (memcmp(header->magic,DATASET_COLUMNAR_MAGIC,sizeof(header->magic))!=0 || header->version!=DATASET_COLUMNAR_VERSION ||
+		header->nr_columns>(file->size-sizeof(*header))/sizeof(dataset_columnar_column)){
+		fprintf(stderr,"%s: not a columnar dataset of version %d\n",path,DATASET_COLUMNAR_VERSION);
+		dataset_columnar_unmap(file);
+		return -1;
+	}
+	file->nr_rows=header->nr_rows;
+	file->nr_columns=header->nr_columns;
+	file->columns=(const dataset_columnar_column *)(header+1);
+
+	for (int c=0; c<file->nr_columns; c++){
+		const dataset_columnar_column *column=&file->columns[c];
+		size_t size=dataset_columnar_dtype_size(column->dtype);
+
+		if (size==0 || memchr(column->name,'\0',sizeof(column->name))==NULL || column->offset%size!=0 ||
+			column->offset>file->size || file->nr_rows>(file->size-column->offset)/size){
+			fprintf(stderr,"%s: column %d is corrupted\n",path,c);
+			dataset_columnar_unmap(file);
+			return -1;
+		}
+	}
+
+	// The readers go through the columns from the first row to the last one
+	madvise(file->map,file->size,MADV_SEQUENTIAL);
+	return 0;
+}
+
+
+/**
+ * Looks for a column by name.
+ * @param file The file returned by dataset_columnar_open()
+ * @param name The name of the column
+ * @param dtype The type the caller expects
+ * @return The values of the column, inside the mapping, NULL if the column is missing or has another type
+ */
+const void *dataset_columnar_find(const dataset_columnar_file *file, const char *name, dataset_columnar_dtype dtype){
+
+	for (int c=0; c<file->nr_columns; c++){
+		if (strcmp(file->columns[c].name,name)==0 && file->columns[c].dtype==dtype){
+			return (const char *)file->map+file->columns[c].offset;
+		}
+	}
+	return NULL;
+}
+
+
+/**
+ * Releases the mapping: the pointers returned by dataset_columnar_find() are no longer valid.
+ * @param file The file returned by dataset_columnar_open()
+ */
+void dataset_columnar_unmap(dataset_columnar_file *file){
+
+	if (file->map!=NULL){
+		munmap(file->map,file->size);
+	}
+	memset(file,0,sizeof(*file));
+}
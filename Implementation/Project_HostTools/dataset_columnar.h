@@ -0,0 +1,65 @@
+#ifndef DATASET_COLUMNAR_H
+#define DATASET_COLUMNAR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DATASET_COLUMNAR_MAGIC "SGCOLS\0\0"
+#define DATASET_COLUMNAR_VERSION 1
+#define DATASET_COLUMNAR_NAME_LEN 16
+#define DATASET_COLUMNAR_ALIGNMENT 64 // Every column starts on a cache line, so that it can be used in place once mapped
+
+typedef enum {
+	DATASET_COLUMNAR_F32 = 1,
+	DATASET_COLUMNAR_U32 = 2,
+	DATASET_COLUMNAR_U8 = 3
+} dataset_columnar_dtype;
+
+// On disk the file is little-endian: a header, nr_columns descriptors and then the values of each column, contiguous.
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t nr_columns;
+	uint64_t nr_rows;
+	uint64_t reserved;
+} dataset_columnar_header;
+
+typedef struct {
+	char name[DATASET_COLUMNAR_NAME_LEN];
+	uint32_t dtype;
+	uint32_t reserved;
+	uint64_t offset;   // From the beginning of the file
+} dataset_columnar_column;
+
+typedef struct {
+	const char *name;
+	dataset_columnar_dtype dtype;
+} dataset_columnar_schema;
+
+typedef struct {
+	int fd;
+	uint64_t nr_rows;
+	int nr_columns;
+	dataset_columnar_column *columns;
+} dataset_columnar_writer;
+
+// A columnar file mapped read-only: the values of every column are used in place, without copies
+typedef struct {
+	void *map;
+	size_t size;
+	uint64_t nr_rows;
+	int nr_columns;
+	const dataset_columnar_column *columns;
+} dataset_columnar_file;
+
+size_t dataset_columnar_dtype_size(dataset_columnar_dtype dtype);
+int dataset_columnar_create(dataset_columnar_writer *writer, const char *path, const dataset_columnar_schema *schema, int nr_columns, uint64_t nr_rows);
+int dataset_columnar_write(dataset_columnar_writer *writer, int column, uint64_t first_row, const void *values, uint64_t nr_values);
+int dataset_columnar_close(dataset_columnar_writer *writer);
+
+int dataset_columnar_is_columnar(const char *path);
+int dataset_columnar_open(dataset_columnar_file *file, const char *path);
+const void *dataset_columnar_find(const dataset_columnar_file *file, const char *name, dataset_columnar_dtype dtype);
+void dataset_columnar_unmap(dataset_columnar_file *file);
+
+#endif
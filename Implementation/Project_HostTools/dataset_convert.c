@@ -0,0 +1,240 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "dataset_columnar.h"
+
+/*
+ * Converts a csv dataset (classData.csv, Preproccessed_dataset.csv, the training and test sets, the exports of the
+ * database) to the columnar format of dataset_columnar.h, read without parsing by dataset_load() and dataset_map().
+ * Every column keeps its name: the labels G,C,B,A and FaultType are stored as u8, all the others as f32 (a label
+ * column called STATE, as in the database, is renamed FaultType). When the csv has G,C,B,A but no FaultType, as
+ * classData.csv, the FaultType column is added with the encoding of Building_Artificial_Intelligence_Model.ipynb.
+ * The csv is read twice: first to count the rows, so that the size of each column is known when the file is created,
+ * then a block of rows at a time, so that files of any size are converted in a bounded memory.
+ * Usage: dataset_convert <input.csv> <output.col>
+ */
+
+#define MAX_LINE_LEN 1024
+#define MAX_COLUMNS 32
+#define BLOCK_ROWS 65536
+
+static const char *label_names[] = {"G", "C", "B", "A", "FaultType"};
+
+
+static int is_label(const char *name){
+
+	for (size_t i=0; i<sizeof(label_names)/sizeof(label_names[0]); i++){
+		if (strcmp(name,label_names[i])==0){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+
+// FaultType of the ground faults G,C,B,A, as assigned by the notebook (0 also for the combinations it does not name)
+static uint8_t fault_type(uint8_t G, uint8_t C, uint8_t B, uint8_t A){
+
+	static const uint8_t types[16]={
+		// Index: G<<3 | C<<2 | B<<1 | A
+		[0x9]=1,  // LG
+		[0xB]=2,  // LLG
+		[0x7]=3,  // LLL
+		[0xF]=4,  // LLLG
+		[0x3]=5   // LL, not present in classData.csv
+	};
+
+	return types[(G&1)<<3 | (C&1)<<2 | (B&1)<<1 | (A&1)];
+}
+
+
+static int is_blank(const char *line){
+
+	for (; *line!='\0'; line++){
+		if (*line!=' ' && *line!='\t' && *line!='\r' && *line!='\n'){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+
+/**
+ * Builds the schema of the columnar file from the header of the csv.
+ * @param header The first line of the csv
+ * @param names The storage of the names of the columns
+ * @param schema The schema to be populated, including the FaultType column added if needed
+ * @param nr_csv_columns The number of columns of the csv
+ * @param ground_columns The index in the csv of G,C,B,A when FaultType has to be added, otherwise all -1
+ * @return The number of columns of the schema, -1 on error
+ */
+static int build_schema(char *header, char names[][DATASET_COLUMNAR_NAME_LEN], dataset_columnar_schema *schema, int *nr_csv_columns, int *ground_columns){
+
+	int nr_columns=0, has_label=0;
+	char *token=strtok(header,",\r\n");
+
+	for (int c=0; c<4; c++){
+		ground_columns[c]=-1;
+	}
+
+	while (token!=NULL){
+		if (nr_columns==MAX_COLUMNS-1 || strlen(token)>=DATASET_COLUMNAR_NAME_LEN){
+			fprintf(stderr,"Column %s: too many columns or name too long\n",token);
+			return -1;
+		}
+		strcpy(names[nr_columns],(strcasecmp(token,"STATE")==0) ? "FaultType" : token);
+		schema[nr_columns].name=names[nr_columns];
+		schema[nr_columns].dtype=is_label(names[nr_columns]) ? DATASET_COLUMNAR_U8 : DATASET_COLUMNAR_F32;
+		has_label|=(strcmp(names[nr_columns],"FaultType")==0);
+		for (int c=0; c<4; c++){
+			if (strcmp(names[nr_columns],label_names[c])==0){
+				ground_columns[c]=nr_columns;
+			}
+		}
+		nr_columns++;
+		token=strtok(NULL,",\r\n");
+	}
+	*nr_csv_columns=nr_columns;
+
+	if (has_label || ground_columns[0]<0 || ground_columns[1]<0 || ground_columns[2]<0 || ground_columns[3]<0){
+		for (int c=0; c<4; c++){
+			ground_columns[c]=-1;
+		}
+		return nr_columns;
+	}
+	schema[nr_columns].name="FaultType";
+	schema[nr_columns].dtype=DATASET_COLUMNAR_U8;
+	return nr_columns+1;
+}
+
+
+/**
+ * Parses one row of the csv into the blocks of the columns.
+ * @return 0 on success, -1 if a value is missing or a label is not an integer in [0,255]
+ */
+static int parse_row(char *line, const dataset_columnar_schema *schema, int nr_csv_columns, void **blocks, int row){
+
+	char *cursor=line;
+
+	for (int c=0; c<nr_csv_columns; c++){
+		char *end;
+		double value;
+
+		if (cursor==NULL){
+			return -1;
+		}
+		value=strtod(cursor,&end);
+		if (end==cursor){
+			return -1;
+		}
+		if (schema[c].dtype==DATASET_COLUMNAR_U8){
+			if (value<0 || value>255 || value!=(int)value){
+				return -1;
+			}
+			((uint8_t *)blocks[c])[row]=(uint8_t)value;
+		}
+		else {
+			((float *)blocks[c])[row]=(float)value;
+		}
+		cursor=strchr(end,',');
+		if (cursor!=NULL){
+			cursor++;
+		}
+	}
+	return 0;
+}
+
+
+int main(int argc, char **argv){
+
+	char line[MAX_LINE_LEN];
+	char names[MAX_COLUMNS][DATASET_COLUMNAR_NAME_LEN];
+	dataset_columnar_schema schema[MAX_COLUMNS];
+	dataset_columnar_writer writer;
+	void *blocks[MAX_COLUMNS];
+	int ground_columns[4];
+	int nr_columns, nr_csv_columns, result=0;
+	uint64_t nr_rows=0, row=0, line_number=1;
+	FILE *file;
+
+	if (argc!=3){
+		fprintf(stderr,"Usage: %s <input.csv> <output.col>\n",argv[0]);
+		return 1;
+	}
+	file=fopen(argv[1],"r");
+	if (file==NULL){
+		perror(argv[1]);
+		return 1;
+	}
+	if (fgets(line,sizeof(line),file)==NULL || (nr_columns=build_schema(line,names,schema,&nr_csv_columns,ground_columns))<0){
+		fprintf(stderr,"%s: invalid header\n",argv[1]);
+		fclose(file);
+		return 1;
+	}
+
+	while (fgets(line,sizeof(line),file)!=NULL){
+		nr_rows+=!is_blank(line);
+	}
+
+	if (dataset_columnar_create(&writer,argv[2],schema,nr_columns,nr_rows)!=0){
+		fclose(file);
+		return 1;
+	}
+	for (int c=0; c<nr_columns; c++){
+		blocks[c]=malloc(BLOCK_ROWS*dataset_columnar_dtype_size(schema[c].dtype));
+	}
+
+	// Second pass, after the header
+	rewind(file);
+	if (fgets(line,sizeof(line),file)==NULL){
+		result=-1;
+	}
+	while (result==0 && row<nr_rows){
+		int block_rows=0;
+
+		while (block_rows<BLOCK_ROWS && row+block_rows<nr_rows && fgets(line,sizeof(line),file)!=NULL){
+			line_number++;
+			if (is_blank(line)){
+				continue;
+			}
+			if (parse_row(line,schema,nr_csv_columns,blocks,block_rows)!=0){
+				fprintf(stderr,"%s:%llu: missing value or invalid label\n",argv[1],(unsigned long long)line_number);
+				result=-1;
+				break;
+			}
+			if (ground_columns[0]>=0){
+				((uint8_t *)blocks[nr_csv_columns])[block_rows]=fault_type(((uint8_t *)blocks[ground_columns[0]])[block_rows],
+					((uint8_t *)blocks[ground_columns[1]])[block_rows],((uint8_t *)blocks[ground_columns[2]])[block_rows],
+					((uint8_t *)blocks[ground_columns[3]])[block_rows]);
+			}
+			block_rows++;
+		}
+		if (result==0 && block_rows==0){
+			fprintf(stderr,"%s: changed during the conversion\n",argv[1]);
+			result=-1;
+		}
+		for (int c=0; result==0 && c<nr_columns; c++){
+			result=dataset_columnar_write(&writer,c,row,blocks[c],block_rows);
+		}
+		row+=block_rows;
+	}
+
+	fclose(file);
+	for (int c=0; c<nr_columns; c++){
+		free(blocks[c]);
+	}
+	if (dataset_columnar_close(&writer)!=0 || result!=0){
+		remove(argv[2]);
+		return 1;
+	}
+
+	printf("%s: %llu rows,",argv[2],(unsigned long long)nr_rows);
+	for (int c=0; c<nr_columns; c++){
+		printf(" %s(%s)",schema[c].name,schema[c].dtype==DATASET_COLUMNAR_U8 ? "u8" : "f32");
+	}
+	printf("\n");
+	return 0;
+}
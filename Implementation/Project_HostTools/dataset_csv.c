@@ -0,0 +1,238 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "dataset_csv.h"
+
+#define MAX_LINE_LEN 512
+
+static const char *feature_names[DATASET_NR_FEATURES]={"Ia","Ib","Ic","Va","Vb","Vc"};
+
+
+/**
+ * Looks for the position of every feature (and of the label FaultType) inside the header of the csv.
+ * In this way the same loader works for test_dataset.csv, classData.csv and the exports of the database.
+ * @param header The first line of the csv file
+ * @param columns The index of the column of each feature
+ * @param label_column The index of the FaultType column or -1 if missing
+ * @return The number of columns, -1 if one feature is missing
+ */
+static int parse_header(char *header, int *columns, int *label_column){
+
+	int nr_columns=0;
+	char *token=strtok(header,",\r\n");
+
+	for (int f=0; f<DATASET_NR_FEATURES; f++){
+		columns[f]=-1;
+	}
+	*label_column=-1;
+
+	while (token!=NULL){
+		for (int f=0; f<DATASET_NR_FEATURES; f++){
+			if (strcasecmp(token,feature_names[f])==0){
+				columns[f]=nr_columns;
+			}
+		}
+		if (strcmp(token,"FaultType")==0 || strcasecmp(token,"STATE")==0){
+			*label_column=nr_columns;
+		}
+		nr_columns++;
+		token=strtok(NULL,",\r\n");
+	}
+
+	for (int f=0; f<DATASET_NR_FEATURES; f++){
+		if (columns[f]<0){
+			fprintf(stderr,"Column %s not found in the header\n",feature_names[f]);
+			return -1;
+		}
+	}
+	return nr_columns;
+}
+
+
+/**
+ * Loads in memory a csv containing (at least) the columns Ia,Ib,Ic,Va,Vb,Vc and optionally FaultType.
+ * @param path The location of the csv file
+ * @param data The dataset to be populated
+ * @return 0 on success, -1 otherwise
+ */
+int dataset_load_csv(const char *path, dataset *data){
+
+	char line[MAX_LINE_LEN];
+	int columns[DATASET_NR_FEATURES];
+	int label_column;
+	size_t capacity=1024;
+	FILE *file=fopen(path,"r");
+
+	memset(data,0,sizeof(*data));
+
+	if (file==NULL){
+		perror(path);
+		return -1;
+	}
+	if (fgets(line,sizeof(line),file)==NULL || parse_header(line,columns,&label_column)<0){
+		fclose(file);
+		return -1;
+	}
+
+	data->features=malloc(capacity*DATASET_NR_FEATURES*sizeof(float));
+	data->labels=malloc(capacity*sizeof(int));
+
+	while (fgets(line,sizeof(line),file)!=NULL){
+		float *row;
+		char *cursor=line;
+		int column=0;
+
+		if (data->nr_rows==capacity){
+			capacity*=2;
+			data->features=realloc(data->features,capacity*DATASET_NR_FEATURES*sizeof(float));
+			data->labels=realloc(data->labels,capacity*sizeof(int));
+		}
+		row=data->features+data->nr_rows*DATASET_NR_FEATURES;
+		data->labels[data->nr_rows]=-1;
+
+		while (*cursor!='\0' && *cursor!='\n'){
+			char *end;
+			double value=strtod(cursor,&end);
+
+			for (int f=0; f<DATASET_NR_FEATURES; f++){
+				if (columns[f]==column){
+					row[f]=(float)value;
+				}
+			}
+			if (column==label_column){
+				data->labels[data->nr_rows]=(int)value;
+			}
+			cursor=strchr(end,',');
+			if (cursor==NULL){
+				break;
+			}
+			cursor++;
+			column++;
+		}
+		data->nr_rows++;
+	}
+
+	fclose(file);
+	return 0;
+}
+
+
+// Maps a columnar file and finds the features (by name, as the csv loader) in it
+static int map_columns(const char *path, dataset *data){
+
+	if (dataset_columnar_open(&data->columnar,path)!=0){
+		return -1;
+	}
+	data->nr_rows=data->columnar.nr_rows;
+	for (int f=0; f<DATASET_NR_FEATURES; f++){
+		data->columns[f]=dataset_columnar_find(&data->columnar,feature_names[f],DATASET_COLUMNAR_F32);
+		if (data->columns[f]==NULL){
+			fprintf(stderr,"Column %s not found in %s\n",feature_names[f],path);
+			dataset_free(data);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
+/**
+ * Loads in memory a columnar file (see dataset_columnar.h) containing the float columns Ia,Ib,Ic,Va,Vb,Vc and
+ * optionally FaultType (u8 or u32). The features are gathered in the row-major layout of dataset_load_csv().
+ * @param path The location of the columnar file
+ * @param data The dataset to be populated
+ * @return 0 on success, -1 otherwise
+ */
+int dataset_load_columnar(const char *path, dataset *data){
+
+	const uint8_t *labels_u8;
+	const uint32_t *labels_u32;
+
+	memset(data,0,sizeof(*data));
+	if (map_columns(path,data)!=0){
+		return -1;
+	}
+	labels_u8=dataset_columnar_find(&data->columnar,"FaultType",DATASET_COLUMNAR_U8);
+	labels_u32=dataset_columnar_find(&data->columnar,"FaultType",DATASET_COLUMNAR_U32);
+
+	data->features=malloc(data->nr_rows*DATASET_NR_FEATURES*sizeof(float));
+	data->labels=malloc(data->nr_rows*sizeof(int));
+	if (data->features==NULL || data->labels==NULL){
+		fprintf(stderr,"%s: %zu rows do not fit in memory\n",path,data->nr_rows);
+		dataset_free(data);
+		return -1;
+	}
+	for (size_t r=0; r<data->nr_rows; r++){
+		for (int f=0; f<DATASET_NR_FEATURES; f++){
+			data->features[r*DATASET_NR_FEATURES+f]=data->columns[f][r];
+		}
+		data->labels[r]=labels_u8!=NULL ? labels_u8[r] : labels_u32!=NULL ? (int)labels_u32[r] : -1;
+	}
+
+	// Only the copy is used from now on
+	dataset_columnar_unmap(&data->columnar);
+	memset(data->columns,0,sizeof(data->columns));
+	return 0;
+}
+
+
+/**
+ * Loads in memory a csv or a columnar file, recognized by its content.
+ * @param path The location of the file
+ * @param data The dataset to be populated (features and labels)
+ * @return 0 on success, -1 otherwise
+ */
+int dataset_load(const char *path, dataset *data){
+
+	if (dataset_columnar_is_columnar(path)){
+		return dataset_load_columnar(path,data);
+	}
+	return dataset_load_csv(path,data);
+}
+
+
+/**
+ * Gives access to the features column by column (data->columns) without loading a columnar file in memory: the
+ * columns point inside the mapping of the file, whatever its size. A csv file is loaded and transposed instead,
+ * and its features and labels are also available as with dataset_load_csv().
+ * @param path The location of the csv or columnar file
+ * @param data The dataset to be populated
+ * @return 0 on success, -1 otherwise
+ */
+int dataset_map(const char *path, dataset *data){
+
+	if (dataset_columnar_is_columnar(path)){
+		memset(data,0,sizeof(*data));
+		return map_columns(path,data);
+	}
+
+	if (dataset_load_csv(path,data)!=0){
+		return -1;
+	}
+	data->column_storage=malloc(data->nr_rows*DATASET_NR_FEATURES*sizeof(float));
+	for (int f=0; f<DATASET_NR_FEATURES; f++){
+		float *column=data->column_storage+f*data->nr_rows;
+
+		for (size_t r=0; r<data->nr_rows; r++){
+			column[r]=data->features[r*DATASET_NR_FEATURES+f];
+		}
+		data->columns[f]=column;
+	}
+	return 0;
+}
+
+
+/**
+ * Releases the memory allocated, or the file mapped, by the loaders.
+ * @param data The dataset to be released
+ */
+void dataset_free(dataset *data){
+	free(data->features);
+	free(data->labels);
+	free(data->column_storage);
+	dataset_columnar_unmap(&data->columnar);
+	memset(data,0,sizeof(*data));
+}
@@ -0,0 +1,20 @@
+#include <stddef.h>
+
+#include "dataset_columnar.h"
+
+#define DATASET_NR_FEATURES 6 // Ia,Ib,Ic,Va,Vb,Vc
+
+typedef struct {
+	size_t nr_rows;
+	float *features;   // nr_rows x DATASET_NR_FEATURES, row-major
+	int *labels;       // FaultType of each row, -1 if the file has no label column
+	const float *columns[DATASET_NR_FEATURES]; // Set by dataset_map() only: feature f of row r is columns[f][r]
+	float *column_storage;                     // The columns of a csv, transposed by dataset_map()
+	dataset_columnar_file columnar;            // The file mapped by dataset_map()
+} dataset;
+
+int dataset_load_csv(const char *path, dataset *data);
+int dataset_load_columnar(const char *path, dataset *data);
+int dataset_load(const char *path, dataset *data);
+int dataset_map(const char *path, dataset *data);
+void dataset_free(dataset *data);
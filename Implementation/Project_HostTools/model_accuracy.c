@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <time.h>
+
+#include "smart_transformer_fault_detection.h"
+#include "smart_transformer_fault_detection_q8.h"
+#include "dataset_csv.h"
+
+/*
+ * Host-side check of the int8 model: it runs both the float model (emlearn) and the quantized one over a labelled dataset
+ * and reports the accuracy of each model, how many predicted classes match and the time spent per inference.
+ * Usage: model_accuracy <dataset.csv|dataset.col>
+ * The exit code is 1 if the quantized model does not predict the same class as the float one on every row.
+ */
+
+#define NR_CLASSES 5
+
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end){
+	return (end->tv_sec-start->tv_sec)*1e9+(end->tv_nsec-start->tv_nsec);
+}
+
+
+static int argmax(const float *values, int n){
+	int max_index=0;
+
+	for (int i=1; i<n; i++){
+		if (values[i]>values[max_index]){
+			max_index=i;
+		}
+	}
+	return max_index;
+}
+
+
+int main(int argc, char **argv){
+
+	dataset data;
+	size_t correct_float=0, correct_q8=0, agreement=0;
+	double time_float=0, time_q8=0;
+	struct timespec start, end;
+	int exit_code;
+
+	if (argc!=2){
+		fprintf(stderr,"Usage: %s <dataset.csv|dataset.col>\n",argv[0]);
+		return 1;
+	}
+	if (dataset_load(argv[1],&data)!=0){
+		return 1;
+	}
+
+	for (size_t r=0; r<data.nr_rows; r++){
+		const float *features=data.features+r*DATASET_NR_FEATURES;
+		float outputs_float[NR_CLASSES], outputs_q8[NR_CLASSES];
+		int class_float, class_q8;
+
+		clock_gettime(CLOCK_MONOTONIC,&start);
+		eml_net_predict_proba(&smart_transformer_fault_detection,features,DATASET_NR_FEATURES,outputs_float,NR_CLASSES);
+		clock_gettime(CLOCK_MONOTONIC,&end);
+		time_float+=elapsed_ns(&start,&end);
+
+		clock_gettime(CLOCK_MONOTONIC,&start);
+		quantized_net_predict_proba(&smart_transformer_fault_detection_q8,features,DATASET_NR_FEATURES,outputs_q8,NR_CLASSES);
+		clock_gettime(CLOCK_MONOTONIC,&end);
+		time_q8+=elapsed_ns(&start,&end);
+
+		class_float=argmax(outputs_float,NR_CLASSES);
+		class_q8=argmax(outputs_q8,NR_CLASSES);
+
+		correct_float+=(class_float==data.labels[r]);
+		correct_q8+=(class_q8==data.labels[r]);
+		if (class_float==class_q8){
+			agreement++;
+		}
+		else {
+			printf("Row %zu: float class %d, int8 class %d\n",r,class_float,class_q8);
+		}
+	}
+
+	printf("Rows: %zu\n",data.nr_rows);
+	printf("Accuracy float: %.2f%%\n",100.0*correct_float/data.nr_rows);
+	printf("Accuracy int8 : %.2f%%\n",100.0*correct_q8/data.nr_rows);
+	printf("Class agreement: %zu/%zu\n",agreement,data.nr_rows);
+	printf("Time per inference float: %.0f ns -- int8: %.0f ns\n",time_float/data.nr_rows,time_q8/data.nr_rows);
+	printf("Weights size float: %zu bytes -- int8: %zu bytes\n",
+		sizeof(smart_transformer_fault_detection_layer_0_weights)+sizeof(smart_transformer_fault_detection_layer_1_weights)+sizeof(smart_transformer_fault_detection_layer_2_weights)
+		+sizeof(smart_transformer_fault_detection_layer_0_biases)+sizeof(smart_transformer_fault_detection_layer_1_biases)+sizeof(smart_transformer_fault_detection_layer_2_biases),
+		sizeof(smart_transformer_fault_detection_q8_layer_0_weights)+sizeof(smart_transformer_fault_detection_q8_layer_1_weights)+sizeof(smart_transformer_fault_detection_q8_layer_2_weights)
+		+sizeof(smart_transformer_fault_detection_q8_layer_0_biases)+sizeof(smart_transformer_fault_detection_q8_layer_1_biases)+sizeof(smart_transformer_fault_detection_q8_layer_2_biases));
+
+	exit_code=(agreement==data.nr_rows)?0:1;
+	dataset_free(&data);
+	return exit_code;
+}
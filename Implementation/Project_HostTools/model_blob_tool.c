@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "smart_transformer_fault_detection_q8.h"
+#include "crc32.h"
+#include "model_blob.h"
+#include "dataset_csv.h"
+
+/*
+ * Packs the int8 model of smart_transformer_fault_detection_q8.h in the binary format accepted by the
+ * transformer_model resource of the smart transformer (see model_blob.h), and checks a blob with the same loader
+ * used on the sensor: the loaded network must give exactly the probabilities of the compiled-in one.
+ * Usage: model_blob_tool export <model_version> <output.blob>
+ *        model_blob_tool check <input.blob> <dataset.csv|dataset.col>
+ */
+
+#define NR_CLASSES 5
+#define ARENA_SIZE 65536
+
+// Body of the blob while it is being built
+typedef struct {
+	uint8_t *data;
+	size_t length;
+	size_t capacity;
+} byte_buffer;
+
+
+static void append(byte_buffer *buffer, const void *data, size_t length){
+	if (buffer->length+length>buffer->capacity){
+		buffer->capacity=2*(buffer->length+length);
+		buffer->data=realloc(buffer->data,buffer->capacity);
+		if (buffer->data==NULL){
+			perror("realloc");
+			exit(1);
+		}
+	}
+	memcpy(buffer->data+buffer->length,data,length);
+	buffer->length+=length;
+}
+
+
+// The host is little-endian as the sensors: the fields are appended as they are in memory
+static void append_u8(byte_buffer *buffer, uint8_t value){
+	append(buffer,&value,1);
+}
+
+
+static void append_u16(byte_buffer *buffer, uint16_t value){
+	append(buffer,&value,2);
+}
+
+
+static void append_u32(byte_buffer *buffer, uint32_t value){
+	append(buffer,&value,4);
+}
+
+
+static int export_blob(const quantized_net *net, uint32_t model_version, const char *path){
+
+	byte_buffer body={NULL, 0, 0}, header={NULL, 0, 0};
+	FILE *out;
+
+	append_u16(&body,net->n_features);
+	append_u16(&body,net->n_layers);
+	append(&body,net->input_scales,net->n_features*sizeof(float));
+	for (int l=0; l<net->n_layers; l++){
+		const quantized_net_layer *layer=&net->layers[l];
+		size_t n_weights=(size_t)layer->n_outputs*layer->n_inputs;
+
+		append_u16(&body,layer->n_outputs);
+		append_u16(&body,layer->n_inputs);
+		append_u8(&body,layer->activation);
+		append_u8(&body,(l==0)?2:1);
+		append_u8(&body,(uint8_t)layer->shift);
+		append_u8(&body,0);
+		append_u32(&body,(uint32_t)layer->multiplier);
+		if (l==0){
+			append(&body,layer->wide_weights,n_weights*sizeof(int16_t));
+		}
+		else {
+			append(&body,layer->weights,n_weights);
+		}
+		append(&body,layer->biases,layer->n_outputs*sizeof(int32_t));
+	}
+
+	append_u32(&header,MODEL_BLOB_MAGIC);
+	append_u16(&header,MODEL_BLOB_FORMAT_VERSION);
+	append_u16(&header,0);
+	append_u32(&header,model_version);
+	append_u32(&header,body.length);
+	append_u32(&header,crc32_update(0,body.data,body.length));
+
+	out=fopen(path,"wb");
+	if (out==NULL){
+		perror(path);
+		return 1;
+	}
+	fwrite(header.data,1,header.length,out);
+	fwrite(body.data,1,body.length,out);
+	fclose(out);
+
+	printf("Model version %u written to %s (%zu bytes)\n",model_version,path,header.length+body.length);
+	free(header.data);
+	free(body.data);
+	return 0;
+}
+
+
+static int file_read(void *ctx, void *buffer, int length){
+	return (int)fread(buffer,1,length,(FILE *)ctx);
+}
+
+
+static int check_blob(const char *path, const char *dataset_path){
+
+	static uint64_t arena[ARENA_SIZE/sizeof(uint64_t)];
+	const quantized_net *net=NULL;
+	model_blob_header header;
+	size_t arena_size;
+	dataset data;
+	size_t mismatches=0;
+	int ret;
+	FILE *in=fopen(path,"rb");
+
+	if (in==NULL){
+		perror(path);
+		return 1;
+	}
+	ret=model_blob_verify(file_read,in,&header,&arena_size);
+	if (ret!=MODEL_BLOB_OK){
+		fprintf(stderr,"Blob not valid (error %d)\n",ret);
+		fclose(in);
+		return 1;
+	}
+	printf("Model version %u, body %u bytes, arena required %zu bytes\n",header.model_version,header.body_length,arena_size);
+
+	rewind(in);
+	ret=model_blob_load(file_read,in,arena,sizeof(arena),&net,&header);
+	fclose(in);
+	if (ret!=MODEL_BLOB_OK){
+		fprintf(stderr,"Blob not loaded (error %d)\n",ret);
+		return 1;
+	}
+
+	if (dataset_load(dataset_path,&data)!=0){
+		return 1;
+	}
+	for (size_t r=0; r<data.nr_rows; r++){
+		const float *features=data.features+r*DATASET_NR_FEATURES;
+		uint16_t expected[NR_CLASSES], loaded[NR_CLASSES];
+
+		quantized_net_predict_proba_q15(&smart_transformer_fault_detection_q8,features,DATASET_NR_FEATURES,expected,NR_CLASSES);
+		if (quantized_net_predict_proba_q15(net,features,DATASET_NR_FEATURES,loaded,NR_CLASSES)!=0
+			|| memcmp(expected,loaded,sizeof(expected))!=0){
+			mismatches++;
+		}
+	}
+	printf("Rows with different probabilities: %zu/%zu\n",mismatches,data.nr_rows);
+	dataset_free(&data);
+	return (mismatches==0)?0:1;
+}
+
+
+int main(int argc, char **argv){
+
+	if (argc==4 && strcmp(argv[1],"export")==0){
+		return export_blob(&smart_transformer_fault_detection_q8,(uint32_t)strtoul(argv[2],NULL,10),argv[3]);
+	}
+	if (argc==4 && strcmp(argv[1],"check")==0){
+		return check_blob(argv[2],argv[3]);
+	}
+
+	fprintf(stderr,"Usage: %s export <model_version> <output.blob>\n",argv[0]);
+	fprintf(stderr,"       %s check <input.blob> <dataset.csv|dataset.col>\n",argv[0]);
+	return 1;
+}
@@ -0,0 +1,458 @@
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "smart_transformer_fault_detection.h"
+#include "dataset_csv.h"
+
+/*
+ * Generates smart_transformer_fault_detection_sparse.h, a pruned version of the model exported from best_model_nn.keras.
+ * Usage: prune_model [-d max_calibration_drop] <calibration.csv> <test.csv> <output.h>
+ *
+ * The pruning works on the exported weights and is driven by the calibration set:
+ *  1) structured pruning of the 384 neurons of the second hidden layer: the neurons whose contribution to the output
+ *     varies the least (std of the activation x norm of the outgoing weights) are removed and their mean contribution
+ *     is folded into the biases of the output layer;
+ *  2) magnitude pruning of the weights of the same layer (|w| x std of the input), again folding the mean contribution
+ *     into the bias of the neuron.
+ * For both steps the largest pruning that keeps the accuracy on the calibration set within half of the allowed drop
+ * is selected by bisection. The result is written in CSR format for sparse_net.c and evaluated on the test set.
+ * The allowed drop is a limit on the calibration set only: the drop on the test set is reported, not bounded by it.
+ */
+
+#define MODEL_NAME "smart_transformer_fault_detection_sparse"
+#define NR_CLASSES 5
+#define DEFAULT_MAX_CALIBRATION_DROP 0.5 // percentage points, on the calibration set
+
+// Working copy of a layer: output-major dense matrix where pruned weights are exactly 0.
+typedef struct {
+	int n_outputs;
+	int n_inputs;
+	float *weights;   // weights[o*n_inputs+i]
+	float *biases;
+	bool *active;     // Pruned neurons have active[o]==false
+	EmlNetActivationFunction activation;
+} work_layer;
+
+typedef struct {
+	int n_layers;
+	work_layer layers[3];
+} work_net;
+
+
+static void load_layer(const EmlNetLayer *src, work_layer *dst){
+
+	dst->n_outputs=src->n_outputs;
+	dst->n_inputs=src->n_inputs;
+	dst->activation=src->activation;
+	dst->weights=malloc(src->n_outputs*src->n_inputs*sizeof(float));
+	dst->biases=malloc(src->n_outputs*sizeof(float));
+	dst->active=malloc(src->n_outputs*sizeof(bool));
+
+	for (int o=0; o<src->n_outputs; o++){
+		for (int i=0; i<src->n_inputs; i++){
+			dst->weights[o*src->n_inputs+i]=src->weights[i*src->n_outputs+o];
+		}
+		dst->biases[o]=src->biases[o];
+		dst->active[o]=true;
+	}
+}
+
+
+static void copy_net(const work_net *src, work_net *dst){
+
+	dst->n_layers=src->n_layers;
+	for (int l=0; l<src->n_layers; l++){
+		const work_layer *s=&src->layers[l];
+		work_layer *d=&dst->layers[l];
+
+		d->n_outputs=s->n_outputs;
+		d->n_inputs=s->n_inputs;
+		d->activation=s->activation;
+		memcpy(d->weights,s->weights,s->n_outputs*s->n_inputs*sizeof(float));
+		memcpy(d->biases,s->biases,s->n_outputs*sizeof(float));
+		memcpy(d->active,s->active,s->n_outputs*sizeof(bool));
+	}
+}
+
+
+static void alloc_net_like(const work_net *src, work_net *dst){
+
+	dst->n_layers=src->n_layers;
+	for (int l=0; l<src->n_layers; l++){
+		const work_layer *s=&src->layers[l];
+		work_layer *d=&dst->layers[l];
+
+		d->weights=malloc(s->n_outputs*s->n_inputs*sizeof(float));
+		d->biases=malloc(s->n_outputs*sizeof(float));
+		d->active=malloc(s->n_outputs*sizeof(bool));
+	}
+	copy_net(src,dst);
+}
+
+
+/**
+ * Forward pass returning the activations of every layer (activations[l] has n_outputs of layer l).
+ */
+static void forward(const work_net *net, const float *features, float **activations){
+
+	const float *in=features;
+
+	for (int l=0; l<net->n_layers; l++){
+		const work_layer *layer=&net->layers[l];
+		float *out=activations[l];
+
+		for (int o=0; o<layer->n_outputs; o++){
+			float acc=layer->biases[o];
+			const float *w=layer->weights+o*layer->n_inputs;
+
+			if (layer->active[o]){
+				for (int i=0; i<layer->n_inputs; i++){
+					acc+=w[i]*in[i];
+				}
+			}
+			out[o]=acc;
+		}
+		if (layer->activation==EmlNetActivationTanh){
+			for (int o=0; o<layer->n_outputs; o++){
+				out[o]=layer->active[o]?tanhf(out[o]):0;
+			}
+		}
+		// Softmax is monotonic: the argmax of the logits is enough to measure the accuracy.
+		in=out;
+	}
+}
+
+
+static double accuracy(const work_net *net, const dataset *data){
+
+	float a0[512], a1[512], a2[NR_CLASSES];
+	float *activations[3]={a0,a1,a2};
+	size_t correct=0;
+
+	for (size_t r=0; r<data->nr_rows; r++){
+		int best=0;
+
+		forward(net,data->features+r*DATASET_NR_FEATURES,activations);
+		for (int c=1; c<NR_CLASSES; c++){
+			best=(a2[c]>a2[best])?c:best;
+		}
+		correct+=(best==data->labels[r]);
+	}
+	return 100.0*correct/data->nr_rows;
+}
+
+
+/**
+ * Computes mean and standard deviation of the activations of a layer over the calibration set.
+ */
+static void activation_statistics(const work_net *net, const dataset *data, int layer_index, double *mean, double *std){
+
+	float a0[512], a1[512], a2[NR_CLASSES];
+	float *activations[3]={a0,a1,a2};
+	int n=net->layers[layer_index].n_outputs;
+	double *sum_sq=calloc(n,sizeof(double));
+
+	memset(mean,0,n*sizeof(double));
+	for (size_t r=0; r<data->nr_rows; r++){
+		forward(net,data->features+r*DATASET_NR_FEATURES,activations);
+		for (int o=0; o<n; o++){
+			mean[o]+=activations[layer_index][o];
+			sum_sq[o]+=(double)activations[layer_index][o]*activations[layer_index][o];
+		}
+	}
+	for (int o=0; o<n; o++){
+		mean[o]/=data->nr_rows;
+		std[o]=sqrt(fmax(sum_sq[o]/data->nr_rows-mean[o]*mean[o],0));
+	}
+	free(sum_sq);
+}
+
+
+typedef struct {
+	double score;
+	int index;
+} ranked;
+
+static int compare_ranked(const void *a, const void *b){
+	double diff=((const ranked *)a)->score-((const ranked *)b)->score;
+	return (diff>0)-(diff<0);
+}
+
+
+/**
+ * Removes the first count neurons of the ranking from the hidden layer, folding their mean activation into the next layer.
+ */
+static void prune_neurons(work_net *net, int layer_index, const ranked *ranking, int count, const double *mean){
+
+	work_layer *layer=&net->layers[layer_index];
+	work_layer *next=&net->layers[layer_index+1];
+
+	for (int k=0; k<count; k++){
+		int j=ranking[k].index;
+
+		layer->active[j]=false;
+		for (int o=0; o<next->n_outputs; o++){
+			next->biases[o]+=next->weights[o*next->n_inputs+j]*mean[j];
+			next->weights[o*next->n_inputs+j]=0;
+		}
+	}
+}
+
+
+/**
+ * Removes the first count weights of the ranking (index=o*n_inputs+i), folding their mean contribution into the bias.
+ */
+static void prune_weights(work_net *net, int layer_index, const ranked *ranking, int count, const double *input_mean){
+
+	work_layer *layer=&net->layers[layer_index];
+
+	for (int k=0; k<count; k++){
+		int o=ranking[k].index/layer->n_inputs;
+		int i=ranking[k].index%layer->n_inputs;
+
+		layer->biases[o]+=layer->weights[ranking[k].index]*input_mean[i];
+		layer->weights[ranking[k].index]=0;
+	}
+}
+
+
+/**
+ * Bisection on the number of pruned elements: the largest count whose accuracy stays above the target.
+ */
+static int search_pruning(const work_net *base, work_net *candidate, const dataset *calibration, double target, int max_count,
+	void (*apply)(work_net *, int, const ranked *, int, const double *), int layer_index, const ranked *ranking, const double *mean){
+
+	int low=0, high=max_count;
+
+	while (low<high){
+		int middle=(low+high+1)/2;
+
+		copy_net(base,candidate);
+		apply(candidate,layer_index,ranking,middle,mean);
+		if (accuracy(candidate,calibration)>=target){
+			low=middle;
+		}
+		else {
+			high=middle-1;
+		}
+	}
+	copy_net(base,candidate);
+	apply(candidate,layer_index,ranking,low,mean);
+	return low;
+}
+
+
+static void write_layer(FILE *out, const work_layer *layer, int l, const int *input_map, int n_inputs, const int *output_map, int n_outputs){
+
+	int nnz=0;
+
+	fprintf(out,"static const uint16_t %s_layer_%d_row_ptr[%d] = { 0",MODEL_NAME,l,n_outputs+1);
+	for (int k=0; k<n_outputs; k++){
+		const float *w=layer->weights+output_map[k]*layer->n_inputs;
+		for (int i=0; i<n_inputs; i++){
+			nnz+=(w[input_map[i]]!=0);
+		}
+		fprintf(out,", %d",nnz);
+	}
+	fprintf(out," };\n");
+
+	fprintf(out,"static const uint16_t %s_layer_%d_col_index[%d] = { ",MODEL_NAME,l,nnz);
+	for (int k=0, written=0; k<n_outputs; k++){
+		const float *w=layer->weights+output_map[k]*layer->n_inputs;
+		for (int i=0; i<n_inputs; i++){
+			if (w[input_map[i]]!=0){
+				fprintf(out,"%d%s",i,(++written<nnz)?", ":"");
+			}
+		}
+	}
+	fprintf(out," };\n");
+
+	fprintf(out,"static const float %s_layer_%d_values[%d] = { ",MODEL_NAME,l,nnz);
+	for (int k=0, written=0; k<n_outputs; k++){
+		const float *w=layer->weights+output_map[k]*layer->n_inputs;
+		for (int i=0; i<n_inputs; i++){
+			if (w[input_map[i]]!=0){
+				fprintf(out,"%ff%s",w[input_map[i]],(++written<nnz)?", ":"");
+			}
+		}
+	}
+	fprintf(out," };\n");
+
+	fprintf(out,"static const float %s_layer_%d_biases[%d] = { ",MODEL_NAME,l,n_outputs);
+	for (int k=0; k<n_outputs; k++){
+		fprintf(out,"%ff%s",layer->biases[output_map[k]],(k<n_outputs-1)?", ":"");
+	}
+	fprintf(out," };\n");
+}
+
+
+static int count_nonzero(const work_layer *layer){
+	int nnz=0;
+
+	for (int k=0; k<layer->n_outputs*layer->n_inputs; k++){
+		nnz+=(layer->weights[k]!=0);
+	}
+	return nnz;
+}
+
+
+int main(int argc, char **argv){
+
+	double max_drop=DEFAULT_MAX_CALIBRATION_DROP, base_accuracy, target;
+	dataset calibration, test;
+	work_net original, pruned, candidate;
+	int opt, neurons_removed, weights_removed, buf_length=0, nnz_before=0, nnz_after=0;
+	int maps[4][512], map_length[4];
+	FILE *out;
+
+	while ((opt=getopt(argc,argv,"d:"))!=-1){
+		if (opt=='d'){
+			max_drop=atof(optarg);
+		}
+		else {
+			fprintf(stderr,"Usage: %s [-d max_calibration_drop] <calibration.csv> <test.csv> <output.h>\n",argv[0]);
+			return 1;
+		}
+	}
+	if (argc-optind!=3){
+		fprintf(stderr,"Usage: %s [-d max_calibration_drop] <calibration.csv> <test.csv> <output.h>\n",argv[0]);
+		return 1;
+	}
+	if (dataset_load(argv[optind],&calibration)!=0 || dataset_load(argv[optind+1],&test)!=0){
+		return 1;
+	}
+
+	original.n_layers=smart_transformer_fault_detection.n_layers;
+	if (original.n_layers!=3){
+		fprintf(stderr,"Only networks with two hidden layers are supported\n");
+		return 1;
+	}
+	for (int l=0; l<original.n_layers; l++){
+		load_layer(&smart_transformer_fault_detection.layers[l],&original.layers[l]);
+	}
+	alloc_net_like(&original,&pruned);
+	alloc_net_like(&original,&candidate);
+
+	base_accuracy=accuracy(&original,&calibration);
+
+	// Step 1: structured pruning of the neurons of the second hidden layer.
+	{
+		const work_layer *hidden=&original.layers[1];
+		const work_layer *next=&original.layers[2];
+		double *mean=malloc(hidden->n_outputs*sizeof(double));
+		double *std=malloc(hidden->n_outputs*sizeof(double));
+		ranked *ranking=malloc(hidden->n_outputs*sizeof(ranked));
+
+		activation_statistics(&original,&calibration,1,mean,std);
+		for (int j=0; j<hidden->n_outputs; j++){
+			double norm=0;
+			for (int o=0; o<next->n_outputs; o++){
+				norm+=next->weights[o*next->n_inputs+j]*next->weights[o*next->n_inputs+j];
+			}
+			ranking[j].score=std[j]*sqrt(norm);
+			ranking[j].index=j;
+		}
+		qsort(ranking,hidden->n_outputs,sizeof(ranked),compare_ranked);
+
+		target=base_accuracy-max_drop/2;
+		neurons_removed=search_pruning(&original,&pruned,&calibration,target,hidden->n_outputs-1,prune_neurons,1,ranking,mean);
+		free(mean);
+		free(std);
+		free(ranking);
+	}
+
+	// Step 2: magnitude pruning of the weights of the surviving neurons.
+	{
+		const work_layer *input=&pruned.layers[0];
+		const work_layer *hidden=&pruned.layers[1];
+		double *mean=malloc(input->n_outputs*sizeof(double));
+		double *std=malloc(input->n_outputs*sizeof(double));
+		ranked *ranking=malloc(hidden->n_outputs*hidden->n_inputs*sizeof(ranked));
+		int candidates=0;
+		work_net step1;
+
+		alloc_net_like(&pruned,&step1);
+		activation_statistics(&pruned,&calibration,0,mean,std);
+		for (int o=0; o<hidden->n_outputs; o++){
+			if (!hidden->active[o]){
+				continue;
+			}
+			for (int i=0; i<hidden->n_inputs; i++){
+				ranking[candidates].score=fabs(hidden->weights[o*hidden->n_inputs+i])*std[i];
+				ranking[candidates].index=o*hidden->n_inputs+i;
+				candidates++;
+			}
+		}
+		qsort(ranking,candidates,sizeof(ranked),compare_ranked);
+
+		target=base_accuracy-max_drop;
+		weights_removed=search_pruning(&step1,&pruned,&calibration,target,candidates,prune_weights,1,ranking,mean);
+		free(mean);
+		free(std);
+		free(ranking);
+	}
+
+	// Maps from the indexes of the sparse model to the original ones: maps[0] features, maps[l+1] outputs of layer l.
+	map_length[0]=pruned.layers[0].n_inputs;
+	for (int i=0; i<map_length[0]; i++){
+		maps[0][i]=i;
+	}
+	for (int l=0; l<pruned.n_layers; l++){
+		map_length[l+1]=0;
+		for (int o=0; o<pruned.layers[l].n_outputs; o++){
+			if (pruned.layers[l].active[o]){
+				maps[l+1][map_length[l+1]++]=o;
+			}
+		}
+		if (l<pruned.n_layers-1 && map_length[l+1]>buf_length){
+			buf_length=map_length[l+1];
+		}
+		nnz_before+=original.layers[l].n_outputs*original.layers[l].n_inputs;
+		nnz_after+=count_nonzero(&pruned.layers[l]);
+	}
+
+	out=fopen(argv[optind+2],"w");
+	if (out==NULL){
+		perror(argv[optind+2]);
+		return 1;
+	}
+	fprintf(out,"// Generated by Project_HostTools/prune_model from smart_transformer_fault_detection.h, do not edit.\n");
+	fprintf(out,"// Hidden neurons: %d -> %d, multiply-accumulate per inference: %d -> %d\n",
+		original.layers[1].n_outputs,map_length[2],nnz_before,nnz_after);
+	fprintf(out,"// Accuracy on %s (calibration, allowed drop %.2f points): %.2f%% -> %.2f%%\n",argv[optind],max_drop,
+		base_accuracy,accuracy(&pruned,&calibration));
+	fprintf(out,"// Accuracy on %s (held out, not bounded by the allowed drop): %.2f%% -> %.2f%%\n",argv[optind+1],
+		accuracy(&original,&test),accuracy(&pruned,&test));
+	fprintf(out,"#include \"sparse_net.h\"\n");
+	for (int l=0; l<pruned.n_layers; l++){
+		write_layer(out,&pruned.layers[l],l,maps[l],map_length[l],maps[l+1],map_length[l+1]);
+	}
+	fprintf(out,"static float %s_buf1[%d];\n",MODEL_NAME,buf_length);
+	fprintf(out,"static float %s_buf2[%d];\n",MODEL_NAME,buf_length);
+	fprintf(out,"static const sparse_net_layer %s_layers[%d] = { \n",MODEL_NAME,pruned.n_layers);
+	for (int l=0; l<pruned.n_layers; l++){
+		fprintf(out,"{ %d, %d, %s_layer_%d_row_ptr, %s_layer_%d_col_index, %s_layer_%d_values, %s_layer_%d_biases, %s }%s \n",
+			map_length[l+1],map_length[l],MODEL_NAME,l,MODEL_NAME,l,MODEL_NAME,l,MODEL_NAME,l,
+			(pruned.layers[l].activation==EmlNetActivationSoftmax)?"SPARSE_NET_ACTIVATION_SOFTMAX":"SPARSE_NET_ACTIVATION_TANH",
+			(l<pruned.n_layers-1)?",":" };");
+	}
+	fprintf(out,"static const sparse_net %s = { %d, %s_layers, %s_buf1, %s_buf2, %d };\n",
+		MODEL_NAME,pruned.n_layers,MODEL_NAME,MODEL_NAME,MODEL_NAME,buf_length);
+	fclose(out);
+
+	printf("Hidden neurons removed: %d/%d\n",neurons_removed,original.layers[1].n_outputs);
+	printf("Weights removed from the surviving neurons: %d\n",weights_removed);
+	printf("Multiply-accumulate per inference: %d -> %d (%.1f%%)\n",nnz_before,nnz_after,100.0*nnz_after/nnz_before);
+	printf("Scratch buffers: %d -> %d floats\n",smart_transformer_fault_detection.activations_length,buf_length);
+	printf("Accuracy on calibration set: %.2f%% -> %.2f%%\n",base_accuracy,accuracy(&pruned,&calibration));
+	printf("Accuracy on test set: %.2f%% -> %.2f%%\n",accuracy(&original,&test),accuracy(&pruned,&test));
+	printf("Wrote model to %s\n",argv[optind+2]);
+
+	dataset_free(&calibration);
+	dataset_free(&test);
+	return 0;
+}
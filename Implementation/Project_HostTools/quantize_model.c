@@ -0,0 +1,220 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "smart_transformer_fault_detection.h"
+#include "dataset_csv.h"
+
+/*
+ * Generates smart_transformer_fault_detection_q8.h starting from the float model exported by emlearn.
+ * Usage: quantize_model <calibration.csv> <output.h>
+ *
+ * Quantization scheme (see quantized_net.c):
+ *  - inputs: int16, one scale per feature computed on the calibration set and folded into the weights of the first layer;
+ *  - weights: int8 (int16 for the first layer), symmetric, one scale per layer;
+ *  - hidden activations: tanh output in Q7;
+ *  - biases: int32 in the scale of the accumulator.
+ */
+
+#define MODEL_NAME "smart_transformer_fault_detection_q8"
+#define Q7_ONE 127.0
+#define Q15_ONE 32767.0
+#define PREACT_ONE 4096.0 // Q12
+
+typedef struct {
+	int8_t *weights;
+	int16_t *wide_weights;
+	int32_t *biases;
+	int32_t multiplier;
+	int shift;
+} quantized_layer;
+
+
+/**
+ * Represents a positive real factor as multiplier*2^-shift with the multiplier normalized in [2^(bits-1),2^bits).
+ * The number of bits is chosen so that accumulator*multiplier never overflows 64 bits.
+ */
+static void decompose_factor(double factor, int bits, int32_t *multiplier, int *shift){
+
+	int s=0;
+
+	while (factor*pow(2,s)<pow(2,bits-1) && s<62){
+		s++;
+	}
+	*multiplier=(int32_t)llround(factor*pow(2,s));
+	*shift=s;
+}
+
+
+/**
+ * Quantizes one emlearn layer. The float weights are stored input-major (weights[i*n_outputs+o]),
+ * the quantized weights are transposed to output-major so that the kernel reads them sequentially.
+ * @param layer The float layer
+ * @param input_factors Optional per-input factor folded into the weights (used for the first layer)
+ * @param input_scale The real value of one unit of the quantized input
+ * @param wide If true the weights are quantized on 16 bits instead of 8
+ * @param q The quantized layer to be populated
+ */
+static void quantize_layer(const EmlNetLayer *layer, const double *input_factors, double input_scale, bool wide, quantized_layer *q){
+
+	double max_abs=0, weight_scale;
+	int n_in=layer->n_inputs, n_out=layer->n_outputs;
+
+	for (int i=0; i<n_in; i++){
+		for (int o=0; o<n_out; o++){
+			double w=layer->weights[i*n_out+o]*(input_factors?input_factors[i]:1.0);
+			max_abs=fmax(max_abs,fabs(w));
+		}
+	}
+	weight_scale=max_abs/(wide?Q15_ONE:Q7_ONE);
+
+	q->weights=wide?NULL:malloc(n_in*n_out);
+	q->wide_weights=wide?malloc(n_in*n_out*sizeof(int16_t)):NULL;
+	q->biases=malloc(n_out*sizeof(int32_t));
+
+	for (int o=0; o<n_out; o++){
+		for (int i=0; i<n_in; i++){
+			double w=layer->weights[i*n_out+o]*(input_factors?input_factors[i]:1.0);
+			if (wide){
+				q->wide_weights[o*n_in+i]=(int16_t)lround(w/weight_scale);
+			}
+			else {
+				q->weights[o*n_in+i]=(int8_t)lround(w/weight_scale);
+			}
+		}
+		q->biases[o]=(int32_t)lround(layer->biases[o]/(weight_scale*input_scale));
+	}
+	// int16xint16 accumulators need up to 34 bits, int8xint8 ones less than 24 bits.
+	decompose_factor(weight_scale*input_scale*PREACT_ONE,wide?15:31,&q->multiplier,&q->shift);
+}
+
+
+static void write_int8_array(FILE *out, const char *name, const int8_t *values, int n){
+	fprintf(out,"static const int8_t %s[%d] = { ",name,n);
+	for (int i=0; i<n; i++){
+		fprintf(out,"%d%s",values[i],(i<n-1)?", ":"");
+	}
+	fprintf(out," };\n");
+}
+
+
+static void write_int16_array(FILE *out, const char *name, const int16_t *values, int n){
+	fprintf(out,"static const int16_t %s[%d] = { ",name,n);
+	for (int i=0; i<n; i++){
+		fprintf(out,"%d%s",values[i],(i<n-1)?", ":"");
+	}
+	fprintf(out," };\n");
+}
+
+
+static void write_int32_array(FILE *out, const char *name, const int32_t *values, int n){
+	fprintf(out,"static const int32_t %s[%d] = { ",name,n);
+	for (int i=0; i<n; i++){
+		fprintf(out,"%d%s",values[i],(i<n-1)?", ":"");
+	}
+	fprintf(out," };\n");
+}
+
+
+int main(int argc, char **argv){
+
+	const EmlNet *net=&smart_transformer_fault_detection;
+	dataset calibration;
+	double max_abs[DATASET_NR_FEATURES]={0};
+	double input_factors[DATASET_NR_FEATURES];
+	quantized_layer layers[8];
+	int buf_length=0;
+	char name[128];
+	FILE *out;
+
+	if (argc!=3){
+		fprintf(stderr,"Usage: %s <calibration.csv> <output.h>\n",argv[0]);
+		return 1;
+	}
+	if (dataset_load(argv[1],&calibration)!=0){
+		return 1;
+	}
+
+	// Per-feature input scale: the largest value observed in the calibration set is mapped on 127.
+	for (size_t r=0; r<calibration.nr_rows; r++){
+		for (int f=0; f<DATASET_NR_FEATURES; f++){
+			max_abs[f]=fmax(max_abs[f],fabs(calibration.features[r*DATASET_NR_FEATURES+f]));
+		}
+	}
+	for (int f=0; f<DATASET_NR_FEATURES; f++){
+		input_factors[f]=max_abs[f]/Q15_ONE;
+	}
+
+	for (int l=0; l<net->n_layers; l++){
+		if (net->layers[l].activation!=EmlNetActivationTanh && net->layers[l].activation!=EmlNetActivationSoftmax){
+			fprintf(stderr,"Layer %d: only tanh and softmax activations are supported\n",l);
+			return 1;
+		}
+		if (l==0){
+			quantize_layer(&net->layers[l],input_factors,1.0,true,&layers[l]);
+		}
+		else {
+			quantize_layer(&net->layers[l],NULL,1.0/Q7_ONE,false,&layers[l]);
+		}
+		if (net->layers[l].n_outputs>buf_length){
+			buf_length=net->layers[l].n_outputs;
+		}
+	}
+
+	out=fopen(argv[2],"w");
+	if (out==NULL){
+		perror(argv[2]);
+		return 1;
+	}
+
+	fprintf(out,"// Generated by Project_HostTools/quantize_model from smart_transformer_fault_detection.h, do not edit.\n");
+	fprintf(out,"// Calibration set: %s (%zu rows)\n",argv[1],calibration.nr_rows);
+	fprintf(out,"#include \"quantized_net.h\"\n");
+
+	fprintf(out,"static const float %s_input_scales[%d] = { ",MODEL_NAME,DATASET_NR_FEATURES);
+	for (int f=0; f<DATASET_NR_FEATURES; f++){
+		fprintf(out,"%ef%s",Q15_ONE/max_abs[f],(f<DATASET_NR_FEATURES-1)?", ":"");
+	}
+	fprintf(out," };\n");
+
+	for (int l=0; l<net->n_layers; l++){
+		snprintf(name,sizeof(name),"%s_layer_%d_biases",MODEL_NAME,l);
+		write_int32_array(out,name,layers[l].biases,net->layers[l].n_outputs);
+		snprintf(name,sizeof(name),"%s_layer_%d_weights",MODEL_NAME,l);
+		if (layers[l].wide_weights!=NULL){
+			write_int16_array(out,name,layers[l].wide_weights,net->layers[l].n_outputs*net->layers[l].n_inputs);
+		}
+		else {
+			write_int8_array(out,name,layers[l].weights,net->layers[l].n_outputs*net->layers[l].n_inputs);
+		}
+	}
+
+	fprintf(out,"static int8_t %s_buf1[%d];\n",MODEL_NAME,buf_length);
+	fprintf(out,"static int8_t %s_buf2[%d];\n",MODEL_NAME,buf_length);
+	fprintf(out,"static int32_t %s_logits[%d];\n",MODEL_NAME,net->layers[net->n_layers-1].n_outputs);
+
+	fprintf(out,"static const quantized_net_layer %s_layers[%d] = { \n",MODEL_NAME,net->n_layers);
+	for (int l=0; l<net->n_layers; l++){
+		char weights[64], wide_weights[64];
+
+		snprintf(weights,sizeof(weights),"%s_layer_%d_weights",MODEL_NAME,l);
+		strcpy(wide_weights,"NULL");
+		if (layers[l].wide_weights!=NULL){
+			strcpy(wide_weights,weights);
+			strcpy(weights,"NULL");
+		}
+		fprintf(out,"{ %d, %d, %s, %s, %s_layer_%d_biases, %d, %d, %s }%s \n",
+			net->layers[l].n_outputs,net->layers[l].n_inputs,weights,wide_weights,MODEL_NAME,l,layers[l].multiplier,layers[l].shift,
+			(net->layers[l].activation==EmlNetActivationSoftmax)?"QUANTIZED_NET_ACTIVATION_SOFTMAX":"QUANTIZED_NET_ACTIVATION_TANH",
+			(l<net->n_layers-1)?",":" };");
+	}
+	fprintf(out,"static const quantized_net %s = { %d, %s_input_scales, %d, %s_layers, %s_buf1, %s_buf2, %s_logits, %d };\n",
+		MODEL_NAME,DATASET_NR_FEATURES,MODEL_NAME,net->n_layers,MODEL_NAME,MODEL_NAME,MODEL_NAME,MODEL_NAME,buf_length);
+
+	fclose(out);
+	dataset_free(&calibration);
+	printf("Wrote model to %s\n",argv[2]);
+	return 0;
+}
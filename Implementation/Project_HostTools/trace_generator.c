@@ -0,0 +1,676 @@
+#include <getopt.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "smart_transformer_utilities.h"
+#include "dataset_columnar.h"
+
+/*
+ * Synthetic fault traces for model retraining and for the ingest benchmarks of the backend: every virtual transformer
+ * evolves as the firmware of the smart transformer does (generate_correct_transformers_values(), the faults of
+ * generate_transformer_fault(), repairing_fault() and handling_type_4() with the same constants), labelled with the
+ * fault in progress. The firmware functions draw one random_rand() at a time, so here the same equations are
+ * rewritten over LANES transformers at once, in structure-of-arrays layout: every transformer has its own
+ * xoshiro128+ generator, every branch of the models becomes a select and the compiler vectorizes the whole step.
+ * The groups of transformers are split among the threads and the results do not depend on the number of threads.
+ *
+ * Rows are written TIME_BLOCK samples at a time for each group of LANES transformers: block by block, group by group,
+ * sample by sample and then transformer by transformer. The stream and t columns identify every sample.
+ *
+ * Usage: trace_generator [-n transformers] [-s samples] [-t threads] [-p fault_probability] [-d type4_duration]
+ *                        [-S seed] [-o traces.csv|traces.col]
+ *   -n number of virtual transformers (default 1000)
+ *   -s samples of each transformer (default 1000)
+ *   -t number of worker threads (default 4)
+ *   -p probability that a transformer working correctly gets a fault at each sample (default 0.01)
+ *   -d samples of a fault of type 4 before the grid is disconnected and the transformer restarts (default 10)
+ *   -S seed of the generators (default 1)
+ *   -o output file: csv if the name ends with .csv, columnar (dataset_columnar.h) otherwise.
+ *      Without it the traces are only generated, to measure the throughput.
+ */
+
+#define LANES 64
+#define TIME_BLOCK 256
+#define NR_DRAWS 20
+#define MAX_REPAIR_SAMPLES 200 // A repair not converging by then restarts the transformer
+#define NR_FAULT_TYPES 5
+#define DEFAULT_TRANSFORMERS 1000
+#define DEFAULT_SAMPLES 1000
+#define DEFAULT_THREADS 4
+#define DEFAULT_FAULT_PROBABILITY 0.01
+#define DEFAULT_TYPE_4_DURATION 10
+#define CSV_ROW_MAX_LEN 160
+
+enum {COL_STREAM, COL_T, COL_IA, COL_IB, COL_IC, COL_VA, COL_VB, COL_VC, COL_G, COL_C, COL_B, COL_A, COL_FAULT_TYPE, NR_COLUMNS};
+
+static const dataset_columnar_schema schema[NR_COLUMNS]={
+	{"stream", DATASET_COLUMNAR_U32}, {"t", DATASET_COLUMNAR_U32},
+	{"Ia", DATASET_COLUMNAR_F32}, {"Ib", DATASET_COLUMNAR_F32}, {"Ic", DATASET_COLUMNAR_F32},
+	{"Va", DATASET_COLUMNAR_F32}, {"Vb", DATASET_COLUMNAR_F32}, {"Vc", DATASET_COLUMNAR_F32},
+	{"G", DATASET_COLUMNAR_U8}, {"C", DATASET_COLUMNAR_U8}, {"B", DATASET_COLUMNAR_U8}, {"A", DATASET_COLUMNAR_U8},
+	{"FaultType", DATASET_COLUMNAR_U8}
+};
+
+// Values set by generate_initial_transformer_values() (type 0) and generate_transformer_fault() (types 1-4)
+static const float start_Ia[NR_FAULT_TYPES]={IA_FAULT_TYPE_0, IA_FAULT_TYPE_1, IA_FAULT_TYPE_2, IA_FAULT_TYPE_3, IA_FAULT_TYPE_4};
+static const float start_Ib[NR_FAULT_TYPES]={IB_FAULT_TYPE_0, IB_FAULT_TYPE_1, IB_FAULT_TYPE_2, IB_FAULT_TYPE_3, IB_FAULT_TYPE_4};
+static const float start_Ic[NR_FAULT_TYPES]={IC_FAULT_TYPE_0, IC_FAULT_TYPE_1, IC_FAULT_TYPE_2, IC_FAULT_TYPE_3, IC_FAULT_TYPE_4};
+static const float start_Va[NR_FAULT_TYPES]={VA_FAULT_TYPE_0, VA_FAULT_TYPE_1, VA_FAULT_TYPE_2, VA_FAULT_TYPE_3, VA_FAULT_TYPE_4};
+static const float start_Vb[NR_FAULT_TYPES]={VB_FAULT_TYPE_0, VB_FAULT_TYPE_1, VB_FAULT_TYPE_2, VB_FAULT_TYPE_3, VB_FAULT_TYPE_4};
+static const float start_Vc[NR_FAULT_TYPES]={VC_FAULT_TYPE_0, VC_FAULT_TYPE_1, VC_FAULT_TYPE_2, VC_FAULT_TYPE_3, VC_FAULT_TYPE_4};
+
+// Ground faults G,C,B,A of each FaultType, as in classData.csv: none, LG, LLG, LLL, LLLG
+static const uint8_t fault_lines[NR_FAULT_TYPES][4]={{0,0,0,0}, {1,0,0,1}, {1,0,1,1}, {0,1,1,1}, {1,1,1,1}};
+
+typedef struct {
+	float Ia[LANES], Ib[LANES], Ic[LANES], Va[LANES], Vb[LANES], Vc[LANES];
+	int32_t type[LANES];
+	int32_t samples_in_fault[LANES];
+	uint32_t s0[LANES], s1[LANES], s2[LANES], s3[LANES];  // xoshiro128+ state of each transformer
+} __attribute__((aligned(64))) stream_group;
+
+typedef struct {
+	float fault_probability;
+	int type_4_duration;
+	uint64_t seed;
+	uint32_t nr_streams;
+	uint32_t nr_samples;
+	uint32_t nr_groups;
+	int nr_threads;
+	dataset_columnar_writer *columnar;
+	FILE *csv;
+	// The csv is written in the same order as the columnar file: the group-blocks take a ticket
+	pthread_mutex_t csv_lock;
+	pthread_cond_t csv_turn;
+	uint64_t csv_next_ticket;
+} generator_config;
+
+typedef struct {
+	generator_config *config;
+	int index;
+	uint64_t label_counts[NR_FAULT_TYPES];
+	int failed;
+} worker_args;
+
+
+static uint64_t splitmix64(uint64_t *state){
+
+	uint64_t z=(*state+=0x9E3779B97F4A7C15ULL);
+
+	z=(z^(z>>30))*0xBF58476D1CE4E5B9ULL;
+	z=(z^(z>>27))*0x94D049BB133111EBULL;
+	return z^(z>>31);
+}
+
+
+/**
+ * Sets the transformers of a group to the initial values of the firmware and seeds their generators.
+ * The generator of a transformer depends only on the seed and on its index.
+ * @param group The group to be initialized
+ * @param first_stream The index of the first transformer of the group
+ * @param seed The seed of the run
+ */
+static void group_init(stream_group *group, uint32_t first_stream, uint64_t seed){
+
+	for (int l=0; l<LANES; l++){
+		uint64_t state=seed^((uint64_t)(first_stream+l)<<32);
+		uint64_t a=splitmix64(&state);
+		uint64_t b=splitmix64(&state);
+
+		group->s0[l]=(uint32_t)a;
+		group->s1[l]=(uint32_t)(a>>32);
+		group->s2[l]=(uint32_t)b;
+		group->s3[l]=(uint32_t)(b>>32)|1;  // The state must not be all zeros
+
+		group->Ia[l]=start_Ia[FAULT_TYPE_0];
+		group->Ib[l]=start_Ib[FAULT_TYPE_0];
+		group->Ic[l]=start_Ic[FAULT_TYPE_0];
+		group->Va[l]=start_Va[FAULT_TYPE_0];
+		group->Vb[l]=start_Vb[FAULT_TYPE_0];
+		group->Vc[l]=start_Vc[FAULT_TYPE_0];
+		group->type[l]=FAULT_TYPE_0;
+		group->samples_in_fault[l]=0;
+	}
+}
+
+
+/**
+ * Draws NR_DRAWS uniform numbers in [0,1) for every transformer of the group, one xoshiro128+ step each.
+ * @param group The group of transformers
+ * @param u The numbers drawn, u[k][lane]
+ */
+static void draw_uniforms(stream_group *restrict group, float u[NR_DRAWS][LANES]){
+
+	for (int k=0; k<NR_DRAWS; k++){
+		for (int l=0; l<LANES; l++){
+			uint32_t result=group->s0[l]+group->s3[l];
+			uint32_t t=group->s1[l]<<9;
+
+			group->s2[l]^=group->s0[l];
+			group->s3[l]^=group->s1[l];
+			group->s1[l]^=group->s2[l];
+			group->s0[l]^=group->s3[l];
+			group->s2[l]^=t;
+			group->s3[l]=(group->s3[l]<<11)|(group->s3[l]>>21);
+			u[k][l]=(float)(result>>8)*0x1p-24f;
+		}
+	}
+}
+
+
+// random_value_generation() with the number drawn in advance
+static inline float uniform_in(float min, float max, float u){
+	return min+(max-min)*u;
+}
+
+
+// random_value_generation_gradual_variation() with the two numbers drawn in advance
+static inline float gradual_variation(float min, float max, float max_var, float value, float u_sign, float u_var){
+
+	float variation=max_var*u_var;
+	float new_value=(u_sign<0.5f) ? value+variation : value-variation;
+
+	new_value=(new_value>max) ? value-variation : new_value;
+	new_value=(new_value<min) ? value+variation : new_value;
+	return new_value;
+}
+
+
+// The constants of the firmware as floats: comparisons in double would mix two vector widths and stop the vectorization
+static const float range_min_ia=RANGE_MIN_IA, range_max_ia=RANGE_MAX_IA, range_min_ib=RANGE_MIN_IB, range_max_ib=RANGE_MAX_IB;
+static const float range_min_va=RANGE_MIN_VA, range_max_va=RANGE_MAX_VA, range_min_vb=RANGE_MIN_VB, range_max_vb=RANGE_MAX_VB;
+static const float safety_check_ib=SAFETY_CHECK_IB, max_rand_var_volt=MAX_RAND_VAR_VOLT, range_vc=RANGE_VC;
+
+
+// The range checks use & instead of && and the models below use selects instead of ifs: a loop without branches
+static inline int currents_in_range(float Ia, float Ib){
+	return (Ia>=range_min_ia) & (Ia<=range_max_ia) & (Ib>=range_min_ib) & (Ib<=range_max_ib);
+}
+
+
+static inline int voltages_in_range(float Va, float Vb){
+	return (Va>=range_min_va) & (Va<=range_max_va) & (Vb>=range_min_vb) & (Vb<=range_max_vb);
+}
+
+
+/**
+ * Advances every transformer of the group by one sample. The three models of the firmware are evaluated for all the
+ * transformers and the one of the current fault is kept, then the faults start, get repaired or end with the
+ * disconnection of the grid. The work is split in loops passing the values through small arrays: in a single
+ * loop gcc moves the range checks inside the selects and gives up the vectorization.
+ * @param group The group of transformers
+ * @param u The numbers drawn for this sample by draw_uniforms()
+ * @param config The parameters of the scenario
+ */
+static void group_step(stream_group *restrict group, const float u[NR_DRAWS][LANES], const generator_config *config){
+
+	const float fault_probability=config->fault_probability;
+	const int type_4_duration=config->type_4_duration;
+	float r_Ia[LANES], r_Ib[LANES], r_Ic[LANES], r_Va[LANES], r_Vb[LANES];
+	float n_Ia[LANES], n_Ib[LANES], n_Ic[LANES], n_Va[LANES], n_Vb[LANES], n_Vc[LANES];
+	int restarts[LANES];
+
+	// repairing_fault(type), up to Va and Vb: the branches of the firmware use disjoint draws, so they share the numbers
+	for (int l=0; l<LANES; l++){
+		const float Ia=group->Ia[l], Ib=group->Ib[l], Ic=group->Ic[l];
+		const float Va=group->Va[l], Vb=group->Vb[l];
+		const int type=group->type[l];
+		float ia, ib, ic, va, vb, ib_step_min, ib_step_max, ib_step, ic_near, ic_far;
+		int ib_low, ib_high;
+
+		ia=(Ia<range_min_ia) ? Ia+uniform_in(MIN_VAR_IA,MAX_VAR_IA,u[0][l]) : Ia;
+		ia=(ia>range_max_ia) ? ia-uniform_in(MIN_VAR_IA,MAX_VAR_IA,u[1][l]) : ia;
+		ia=((Ia>=range_min_ia) & (Ia<=range_max_ia)) ? gradual_variation(range_min_ia,range_max_ia,VAR_IA,Ia,u[0][l],u[1][l]) : ia;
+
+		// Ib moves towards its range by a step depending on the fault, for type 3 Ic follows it
+		ib_step_min=(type==1) ? MIN_VAR_IB_TYPE_1 : MIN_VAR_IB_TYPE_3;
+		ib_step_min=(type==2) ? MIN_VAR_IB_TYPE_2 : ib_step_min;
+		ib_step_max=(type==1) ? MAX_VAR_IB_TYPE_1 : MAX_VAR_IB_TYPE_3;
+		ib_step_max=(type==2) ? MAX_VAR_IB_TYPE_2 : ib_step_max;
+
+		ib_low=(Ib<range_min_ib);
+		ib_step=uniform_in(ib_step_min,ib_step_max,u[2][l]);
+		ib=ib_low ? Ib+ib_step : Ib;
+		ic_near=uniform_in(MIN_SUM_RANGE_VOLT_TYPE_0,MAX_SUM_RANGE_VOLT_TYPE_0,u[3][l])-ia;
+		ic_far=(Ic>0) ? Ic-ib_step : Ic+ib_step;
+		ic=(ib_low & (type==3)) ? ((ib>-safety_check_ib) ? ic_near : ic_far) : Ic;
+
+		// Ib above the range, also when the step from below overshot it
+		ib_high=((Ib<range_min_ib) | (Ib>range_max_ib)) & (ib>range_max_ib);
+		ib_step=uniform_in(ib_step_min,ib_step_max,u[4][l]);
+		ib=ib_high ? ib-ib_step : ib;
+		ic_near=uniform_in(MIN_SUM_RANGE_VOLT_TYPE_0,MAX_SUM_RANGE_VOLT_TYPE_0,u[5][l])-ia;
+		ic_far=(ic>0) ? ic-ib_step : ic+ib_step;
+		ic=(ib_high & (type==3)) ? ((ib>safety_check_ib) ? ic_near : ic_far) : ic;
+
+		ib=((Ib>=range_min_ib) & (Ib<=range_max_ib)) ? gradual_variation(range_min_ib,range_max_ib,VAR_IB,Ib,u[2][l],u[3][l]) : ib;
+
+		va=(Va<range_min_va) ? Va+max_rand_var_volt : Va;
+		va=(va>range_max_va) ? va-max_rand_var_volt : va;
+		va=((Va>=range_min_va) & (Va<=range_max_va)) ? gradual_variation(range_min_va,range_max_va,VAR_VA,Va,u[8][l],u[9][l]) : va;
+		vb=(Vb<range_min_vb) ? Vb+max_rand_var_volt : Vb;
+		vb=(vb>range_max_vb) ? vb-max_rand_var_volt : vb;
+		vb=((Vb>=range_min_vb) & (Vb<=range_max_vb)) ? gradual_variation(range_min_vb,range_max_vb,VAR_VB,Vb,u[10][l],u[11][l]) : vb;
+		va=(type==3) ? gradual_variation(range_min_va,range_max_va,max_rand_var_volt,va,u[12][l],u[13][l]) : va;
+		vb=(type==3) ? gradual_variation(range_min_vb,range_max_vb,max_rand_var_volt,vb,u[14][l],u[15][l]) : vb;
+
+		r_Ia[l]=ia;
+		r_Ib[l]=ib;
+		r_Ic[l]=ic;
+		r_Va[l]=va;
+		r_Vb[l]=vb;
+	}
+
+	// The end of repairing_fault(type), generate_correct_transformers_values() and handling_type_4()
+	for (int l=0; l<LANES; l++){
+		const float Ia=group->Ia[l], Ib=group->Ib[l], Ic=group->Ic[l];
+		const float Va=group->Va[l], Vb=group->Vb[l], Vc=group->Vc[l];
+		const int type=group->type[l];
+		float c_Ia, c_Ib, c_Ic, c_Va, c_Vb, c_Vc;
+		float h_Ia, h_Ib, h_Ic, h_Va, h_Vb, h_Vc;
+		float ic, vc;
+
+		ic=currents_in_range(r_Ia[l],r_Ib[l]) ? uniform_in(MIN_SUM_RANGE_CURR_TYPE_0,MAX_SUM_RANGE_CURR_TYPE_0,u[6][l])-r_Ia[l]-r_Ib[l] :
+			gradual_variation(r_Ic[l]-1,r_Ic[l]+1,0.1f,r_Ic[l],u[6][l],u[7][l]);
+		vc=voltages_in_range(r_Va[l],r_Vb[l]) ? uniform_in(MIN_SUM_RANGE_VOLT_TYPE_0,MAX_SUM_RANGE_VOLT_TYPE_0,u[16][l])-r_Va[l]-r_Vb[l] :
+			gradual_variation(Vc-range_vc,Vc+range_vc,MIN_VAR_RANGE_VC,Vc,u[16][l],u[17][l]);
+
+		c_Ia=gradual_variation(range_min_ia,range_max_ia,VAR_IA,Ia,u[0][l],u[1][l]);
+		c_Ib=gradual_variation(range_min_ib,range_max_ib,VAR_IB,Ib,u[2][l],u[3][l]);
+		c_Ic=uniform_in(MIN_SUM_RANGE_CURR_TYPE_0,MAX_SUM_RANGE_CURR_TYPE_0,u[4][l])-c_Ia-c_Ib;
+		c_Va=gradual_variation(range_min_va,range_max_va,VAR_VA,Va,u[5][l],u[6][l]);
+		c_Vb=gradual_variation(range_min_vb,range_max_vb,VAR_VB,Vb,u[7][l],u[8][l]);
+		c_Vc=uniform_in(MIN_SUM_RANGE_VOLT_TYPE_0,MAX_SUM_RANGE_VOLT_TYPE_0,u[9][l])-c_Va-c_Vb;
+
+		h_Ia=gradual_variation(Ia-MIN_VAR_IA,Ia+MIN_VAR_IA,VAR_IA,Ia,u[0][l],u[1][l]);
+		h_Ib=gradual_variation(Ib-MIN_VAR_IA,Ib+MAX_VAR_IA,VAR_IA,Ib,u[2][l],u[3][l]);
+		h_Ic=gradual_variation(Ic-MIN_VAR_IA,Ic+MAX_VAR_IA,VAR_IA,Ic,u[4][l],u[5][l]);
+		h_Va=gradual_variation(Va-max_rand_var_volt,Va+max_rand_var_volt,max_rand_var_volt,Va,u[6][l],u[7][l]);
+		h_Vb=gradual_variation(Vb-max_rand_var_volt,Vb+max_rand_var_volt,max_rand_var_volt,Vb,u[8][l],u[9][l]);
+		h_Vc=gradual_variation(Vc-max_rand_var_volt,Vc+max_rand_var_volt,max_rand_var_volt,Vc,u[10][l],u[11][l]);
+
+		n_Ia[l]=(type==FAULT_TYPE_0) ? c_Ia : (type==FAULT_TYPE_4) ? h_Ia : r_Ia[l];
+		n_Ib[l]=(type==FAULT_TYPE_0) ? c_Ib : (type==FAULT_TYPE_4) ? h_Ib : r_Ib[l];
+		n_Ic[l]=(type==FAULT_TYPE_0) ? c_Ic : (type==FAULT_TYPE_4) ? h_Ic : ic;
+		n_Va[l]=(type==FAULT_TYPE_0) ? c_Va : (type==FAULT_TYPE_4) ? h_Va : r_Va[l];
+		n_Vb[l]=(type==FAULT_TYPE_0) ? c_Vb : (type==FAULT_TYPE_4) ? h_Vb : r_Vb[l];
+		n_Vc[l]=(type==FAULT_TYPE_0) ? c_Vc : (type==FAULT_TYPE_4) ? h_Vc : vc;
+	}
+
+	// A repaired transformer is labelled as working again, one of type 4 is restarted after the disconnection
+	for (int l=0; l<LANES; l++){
+		const int type=group->type[l];
+		int samples=group->samples_in_fault[l]+1;
+		int repairing, repaired, restart, fault, new_type;
+
+		repairing=(type!=FAULT_TYPE_0) & (type!=FAULT_TYPE_4);
+		repaired=repairing & currents_in_range(n_Ia[l],n_Ib[l]) & voltages_in_range(n_Va[l],n_Vb[l]);
+		restart=((type==FAULT_TYPE_4) & (samples>type_4_duration)) | ((repairing-repaired) & (samples>MAX_REPAIR_SAMPLES));
+
+		// Only a transformer working correctly during the whole sample can get a new fault
+		fault=((type==FAULT_TYPE_0) & (u[18][l]<fault_probability))*(1+(int)(u[19][l]*4));
+		new_type=(repaired | restart) ? FAULT_TYPE_0 : type;
+		new_type=fault+new_type;
+		restart=restart | (fault>0);
+		samples=((new_type==FAULT_TYPE_0) | (fault>0)) ? 0 : samples;
+
+		group->Ia[l]=n_Ia[l];
+		group->Ib[l]=n_Ib[l];
+		group->Ic[l]=n_Ic[l];
+		group->Va[l]=n_Va[l];
+		group->Vb[l]=n_Vb[l];
+		group->Vc[l]=n_Vc[l];
+		group->type[l]=new_type;
+		group->samples_in_fault[l]=samples;
+		restarts[l]=restart;
+	}
+
+	// Restarts are rare, a branch is cheaper than six gathers in the loop above
+	for (int l=0; l<LANES; l++){
+		if (restarts[l]){
+			const int type=group->type[l];
+
+			group->Ia[l]=start_Ia[type];
+			group->Ib[l]=start_Ib[type];
+			group->Ic[l]=start_Ic[type];
+			group->Va[l]=start_Va[type];
+			group->Vb[l]=start_Vb[type];
+			group->Vc[l]=start_Vc[type];
+		}
+	}
+}
+
+
+/**
+ * Appends a value with 5 decimals, much faster than printf for the millions of values of a trace.
+ * @param cursor Where to write the text
+ * @param value The value
+ * @return The position after the text
+ */
+static char *append_fixed(char *cursor, float value){
+
+	uint64_t scaled;
+	uint64_t integer;
+	char digits[24];
+	int nr_digits=0;
+
+	if (value<0){
+		*cursor++='-';
+		value=-value;
+	}
+	scaled=(uint64_t)((double)value*100000.0+0.5);
+	integer=scaled/100000;
+	do {
+		digits[nr_digits++]='0'+integer%10;
+		integer/=10;
+	} while (integer>0);
+	while (nr_digits>0){
+		*cursor++=digits[--nr_digits];
+	}
+	*cursor++='.';
+	scaled%=100000;
+	for (int d=10000; d>0; d/=10){
+		*cursor++='0'+(scaled/d)%10;
+	}
+	return cursor;
+}
+
+
+static char *append_uint(char *cursor, uint32_t value){
+
+	char digits[12];
+	int nr_digits=0;
+
+	do {
+		digits[nr_digits++]='0'+value%10;
+		value/=10;
+	} while (value>0);
+	while (nr_digits>0){
+		*cursor++=digits[--nr_digits];
+	}
+	return cursor;
+}
+
+
+/**
+ * Writes the csv rows of a group-block once all the previous group-blocks have been written.
+ * @param config The configuration of the run
+ * @param ticket The position of the group-block in the file
+ * @param text The rows
+ * @param length The length of the rows
+ * @return 0 on success, -1 otherwise or if another thread failed
+ */
+static int write_csv_in_turn(generator_config *config, uint64_t ticket, const char *text, size_t length){
+
+	int result;
+
+	pthread_mutex_lock(&config->csv_lock);
+	while (config->csv_next_ticket!=ticket && config->csv_next_ticket!=UINT64_MAX){
+		pthread_cond_wait(&config->csv_turn,&config->csv_lock);
+	}
+	if (config->csv_next_ticket==UINT64_MAX){
+		// Another thread failed: the file is incomplete anyway
+		pthread_mutex_unlock(&config->csv_lock);
+		return -1;
+	}
+	result=fwrite(text,1,length,config->csv)==length ? 0 : -1;
+	config->csv_next_ticket++;
+	pthread_cond_broadcast(&config->csv_turn);
+	pthread_mutex_unlock(&config->csv_lock);
+	return result;
+}
+
+
+static void *generate_traces(void *arg){
+
+	worker_args *args=arg;
+	generator_config *config=args->config;
+	const uint32_t nr_mine=(config->nr_groups-args->index+config->nr_threads-1)/config->nr_threads;
+	stream_group *groups=aligned_alloc(64,(nr_mine>0 ? nr_mine : 1)*sizeof(stream_group));
+	float (*u)[LANES]=aligned_alloc(64,NR_DRAWS*LANES*sizeof(float));
+	float *values[6];
+	uint32_t *streams=malloc(TIME_BLOCK*LANES*sizeof(uint32_t));
+	uint32_t *samples=malloc(TIME_BLOCK*LANES*sizeof(uint32_t));
+	uint8_t *lines[5];
+	char *text=config->csv!=NULL ? malloc((size_t)TIME_BLOCK*LANES*CSV_ROW_MAX_LEN) : NULL;
+
+	for (int f=0; f<6; f++){
+		values[f]=aligned_alloc(64,TIME_BLOCK*LANES*sizeof(float));
+	}
+	for (int c=0; c<5; c++){
+		lines[c]=malloc(TIME_BLOCK*LANES);
+	}
+
+	// Groups are dealt round-robin, so that the threads reach the same group-block at about the same time
+	for (uint32_t i=0; i<nr_mine; i++){
+		group_init(&groups[i],(args->index+i*config->nr_threads)*LANES,config->seed);
+	}
+
+	for (uint32_t first_sample=0; first_sample<config->nr_samples && !args->failed; first_sample+=TIME_BLOCK){
+		const uint32_t block_len=(config->nr_samples-first_sample<TIME_BLOCK) ? config->nr_samples-first_sample : TIME_BLOCK;
+
+		for (uint32_t i=0; i<nr_mine && !args->failed; i++){
+			const uint32_t g=args->index+i*config->nr_threads;
+			const uint32_t first_stream=g*LANES;
+			const int active=(config->nr_streams-first_stream<LANES) ? config->nr_streams-first_stream : LANES;
+			const uint64_t first_row=(uint64_t)first_sample*config->nr_streams+(uint64_t)first_stream*block_len;
+			const size_t nr_rows=(size_t)block_len*active;
+			stream_group *group=&groups[i];
+
+			for (uint32_t s=0; s<block_len; s++){
+				uint8_t *row_lines[5];
+				const size_t row=(size_t)s*active;
+
+				draw_uniforms(group,u);
+				group_step(group,(const float (*)[LANES])u,config);
+
+				for (int c=0; c<5; c++){
+					row_lines[c]=lines[c]+row;
+				}
+				for (int l=0; l<active; l++){
+					const int type=group->type[l];
+
+					streams[row+l]=first_stream+l;
+					samples[row+l]=first_sample+s;
+					values[0][row+l]=group->Ia[l];
+					values[1][row+l]=group->Ib[l];
+					values[2][row+l]=group->Ic[l];
+					values[3][row+l]=group->Va[l];
+					values[4][row+l]=group->Vb[l];
+					values[5][row+l]=group->Vc[l];
+					for (int c=0; c<4; c++){
+						row_lines[c][l]=fault_lines[type][c];
+					}
+					row_lines[4][l]=type;
+					args->label_counts[type]++;
+				}
+			}
+
+			if (config->columnar!=NULL){
+				int result=dataset_columnar_write(config->columnar,COL_STREAM,first_row,streams,nr_rows);
+
+				result|=dataset_columnar_write(config->columnar,COL_T,first_row,samples,nr_rows);
+				for (int f=0; f<6; f++){
+					result|=dataset_columnar_write(config->columnar,COL_IA+f,first_row,values[f],nr_rows);
+				}
+				for (int c=0; c<5; c++){
+					result|=dataset_columnar_write(config->columnar,COL_G+c,first_row,lines[c],nr_rows);
+				}
+				args->failed=(result!=0);
+			}
+			else if (config->csv!=NULL){
+				char *cursor=text;
+
+				for (size_t r=0; r<nr_rows; r++){
+					cursor=append_uint(cursor,streams[r]);
+					*cursor++=',';
+					cursor=append_uint(cursor,samples[r]);
+					for (int f=0; f<6; f++){
+						*cursor++=',';
+						cursor=append_fixed(cursor,values[f][r]);
+					}
+					for (int c=0; c<5; c++){
+						*cursor++=',';
+						*cursor++='0'+lines[c][r];
+					}
+					*cursor++='\n';
+				}
+				args->failed=write_csv_in_turn(config,(uint64_t)(first_sample/TIME_BLOCK)*config->nr_groups+g,text,cursor-text)!=0;
+			}
+		}
+	}
+
+	// A failed thread releases the others waiting for their turn
+	if (args->failed && config->csv!=NULL){
+		pthread_mutex_lock(&config->csv_lock);
+		config->csv_next_ticket=UINT64_MAX;
+		pthread_cond_broadcast(&config->csv_turn);
+		pthread_mutex_unlock(&config->csv_lock);
+	}
+
+	for (int f=0; f<6; f++){
+		free(values[f]);
+	}
+	for (int c=0; c<5; c++){
+		free(lines[c]);
+	}
+	free(groups);
+	free(u);
+	free(streams);
+	free(samples);
+	free(text);
+	return NULL;
+}
+
+
+static int ends_with(const char *text, const char *suffix){
+	size_t length=strlen(text), suffix_length=strlen(suffix);
+	return length>=suffix_length && strcmp(text+length-suffix_length,suffix)==0;
+}
+
+
+static void usage(const char *program){
+	fprintf(stderr,"Usage: %s [-n transformers] [-s samples] [-t threads] [-p fault_probability] [-d type4_duration] [-S seed] [-o traces.csv|traces.col]\n",program);
+}
+
+
+int main(int argc, char *argv[]){
+
+	generator_config config;
+	dataset_columnar_writer columnar;
+	const char *output=NULL;
+	pthread_t *threads;
+	worker_args *args;
+	struct timespec start, end;
+	uint64_t nr_rows, label_counts[NR_FAULT_TYPES]={0};
+	double seconds;
+	int opt, failed=0;
+
+	memset(&config,0,sizeof(config));
+	config.nr_streams=DEFAULT_TRANSFORMERS;
+	config.nr_samples=DEFAULT_SAMPLES;
+	config.nr_threads=DEFAULT_THREADS;
+	config.fault_probability=DEFAULT_FAULT_PROBABILITY;
+	config.type_4_duration=DEFAULT_TYPE_4_DURATION;
+	config.seed=1;
+
+	while ((opt=getopt(argc,argv,"n:s:t:p:d:S:o:"))!=-1){
+		switch (opt){
+			case 'n':
+				config.nr_streams=strtoul(optarg,NULL,10);
+				break;
+			case 's':
+				config.nr_samples=strtoul(optarg,NULL,10);
+				break;
+			case 't':
+				config.nr_threads=atoi(optarg);
+				break;
+			case 'p':
+				config.fault_probability=atof(optarg);
+				break;
+			case 'd':
+				config.type_4_duration=atoi(optarg);
+				break;
+			case 'S':
+				config.seed=strtoull(optarg,NULL,0);
+				break;
+			case 'o':
+				output=optarg;
+				break;
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+	if (optind!=argc || config.nr_streams==0 || config.nr_samples==0 || config.nr_threads<1 || config.nr_streams>UINT32_MAX-LANES){
+		usage(argv[0]);
+		return 1;
+	}
+	config.nr_groups=(config.nr_streams+LANES-1)/LANES;
+	if ((uint32_t)config.nr_threads>config.nr_groups){
+		config.nr_threads=config.nr_groups;
+	}
+	nr_rows=(uint64_t)config.nr_streams*config.nr_samples;
+
+	if (output!=NULL && ends_with(output,".csv")){
+		config.csv=fopen(output,"w");
+		if (config.csv==NULL){
+			perror(output);
+			return 1;
+		}
+		fprintf(config.csv,"stream,t,Ia,Ib,Ic,Va,Vb,Vc,G,C,B,A,FaultType\n");
+		pthread_mutex_init(&config.csv_lock,NULL);
+		pthread_cond_init(&config.csv_turn,NULL);
+	}
+	else if (output!=NULL){
+		if (dataset_columnar_create(&columnar,output,schema,NR_COLUMNS,nr_rows)!=0){
+			return 1;
+		}
+		config.columnar=&columnar;
+	}
+
+	threads=malloc(config.nr_threads*sizeof(pthread_t));
+	args=calloc(config.nr_threads,sizeof(worker_args));
+
+	clock_gettime(CLOCK_MONOTONIC,&start);
+	for (int t=0; t<config.nr_threads; t++){
+		args[t].config=&config;
+		args[t].index=t;
+		pthread_create(&threads[t],NULL,generate_traces,&args[t]);
+	}
+	for (int t=0; t<config.nr_threads; t++){
+		pthread_join(threads[t],NULL);
+		failed|=args[t].failed;
+		for (int f=0; f<NR_FAULT_TYPES; f++){
+			label_counts[f]+=args[t].label_counts[f];
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC,&end);
+	seconds=(end.tv_sec-start.tv_sec)+(end.tv_nsec-start.tv_nsec)*1e-9;
+
+	if (config.csv!=NULL){
+		failed|=(fclose(config.csv)!=0);
+	}
+	if (config.columnar!=NULL){
+		failed|=(dataset_columnar_close(config.columnar)!=0);
+	}
+	if (failed){
+		fprintf(stderr,"Cannot write %s\n",output);
+		return 1;
+	}
+
+	printf("Transformers: %u, samples each: %u, threads: %d, seed: %llu\n",config.nr_streams,config.nr_samples,config.nr_threads,
+		(unsigned long long)config.seed);
+	printf("Samples: %llu in %.3f s (%.1f M samples/s)\n",(unsigned long long)nr_rows,seconds,nr_rows/seconds/1e6);
+	for (int f=0; f<NR_FAULT_TYPES; f++){
+		printf("FaultType %d: %.2f%%\n",f,100.0*label_counts[f]/nr_rows);
+	}
+
+	free(threads);
+	free(args);
+	return 0;
+}
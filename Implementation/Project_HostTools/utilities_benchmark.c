@@ -0,0 +1,393 @@
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "os/net/linkaddr.h"
+
+#include "cJSON.h"
+#include "senml-json.h"
+#include "printing_floats.h"
+#include "smart_transformer_utilities.h"
+#include "smart_transformer_fault_detection.h"
+
+/*
+ * Host benchmark of the hot paths of Project_Utilities and of the fault detection network: time, heap allocations
+ * and bytes allocated per call, to see the regressions between two commits without a mote. Every function is called
+ * in a loop whose length is doubled until it lasts at least the minimum time, then the loop is repeated and the
+ * fastest repetition is kept (the least disturbed by the rest of the machine).
+ * The allocations are counted by wrapping malloc, calloc and realloc at link time (-Wl,--wrap, see the Makefile):
+ * they are those of the default cJSON hooks, the firmware serves the same requests from json_pool.
+ * The utilities print what they build on stdout, as on the serial line of the node: it is redirected to /dev/null
+ * during the runs (the formatting is still measured) and the results are written on the original stdout.
+ *
+ * Usage: utilities_benchmark [-f text|csv|json] [-m min_ms] [-r repetitions] [-b baseline.csv] [filter]
+ *   -f  output format: aligned table (default), csv with a header, or one json object per line
+ *   -m  minimum duration of a timed loop, in milliseconds (default 200)
+ *   -r  repetitions of the timed loop (default 5)
+ *   -b  csv written by a previous run (-f csv): the text output adds the change of ns/op against it
+ *   filter  only the benchmarks whose name contains this string
+ */
+
+#define MAX_BENCHMARKS 16
+#define NAME_LEN 48
+#define NR_CLASSES 5
+#define NR_ROWS 8
+#define NR_STATE_MEASUREMENTS 7
+
+typedef struct {
+	const char *name;
+	void (*run)(void);
+} benchmark;
+
+typedef struct {
+	char name[NAME_LEN];
+	double ns_per_op;
+} baseline_entry;
+
+// Heap usage since the start of the process, updated by the wrappers of the allocator
+static unsigned long long allocations;
+static unsigned long long allocated_bytes;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *block, size_t size);
+
+static volatile int sink;
+
+static const float rows[NR_ROWS][6] = {
+	{576.4674117, -1.539655596, 38.81403368, 0.246719176, -0.566525858, 0.319806681},
+	{166.5924338, -848.0687968, 681.5164579, -0.032150657, -0.006614064, 0.038764721},
+	{751.7726568, 26.01406691, -777.7889873, 0.036409622, -0.036874709, 0.000465087},
+	{135.8536992, 689.1504267, -822.9607992, 0.040063844, -0.00816284, -0.031901004},
+	{-616.3508296, 856.6700087, -238.2077826, 0.013109593, 0.02833796, -0.041447553},
+	{778.1274403, -751.2392885, -24.89817208, -5.86e-05, -0.04748005, 0.047538644},
+	{114.5671869, -815.2151391, 702.7273318, -0.034694592, -0.003697312, 0.038391904},
+	{-598.5588277, 868.0343479, 31.62414422, 0.013751178, 0.031360198, -0.045111376}
+};
+
+static char *state_names[NR_STATE_MEASUREMENTS] = {"state", "current_A", "current_B", "current_C", "voltage_A", "voltage_B", "voltage_C"};
+static char *state_units[NR_STATE_MEASUREMENTS] = {"type_fault", "MA", "MA", "MA", "V", "MV", "MV"};
+
+// Reply of the server to a registration, parsed by the nodes
+static const char registration_response[] =
+	"{\"full_name\":\"urn:dev:mac:0012740000000001:\",\"alias\":\"smart_transformer_1\",\"type\":2,\"max_power\":6000,\"status\":true}";
+
+static senml_measurement power_measurement;
+static senml_payload power_payload;
+static senml_measurement state_measurements[NR_STATE_MEASUREMENTS];
+static senml_payload state_payload;
+static cJSON *printed_object;
+static unsigned int call;
+
+
+void *__wrap_malloc(size_t size){
+	allocations++;
+	allocated_bytes+=size;
+	return __real_malloc(size);
+}
+
+
+void *__wrap_calloc(size_t count, size_t size){
+	allocations++;
+	allocated_bytes+=count*size;
+	return __real_calloc(count,size);
+}
+
+
+void *__wrap_realloc(void *block, size_t size){
+	allocations++;
+	allocated_bytes+=size;
+	return __real_realloc(block,size);
+}
+
+
+static unsigned long long now_ns(void){
+
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return now.tv_sec*1000000000ULL+now.tv_nsec;
+}
+
+
+// The payloads built by the two sensors at every notification
+static void setup_payloads(void){
+
+	power_measurement.name="power";
+	power_measurement.type=SENML_TYPE_V;
+	power_measurement.value.float_value=2315.42;
+	power_payload.base_unit="W";
+	power_payload.nr_measurments=1;
+	power_payload.measurements=&power_measurement;
+
+	for (int i=0; i<NR_STATE_MEASUREMENTS; i++){
+		state_measurements[i].name=state_names[i];
+		state_measurements[i].unit=state_units[i];
+		state_measurements[i].type=SENML_TYPE_V;
+		state_measurements[i].value.float_value=(i==0) ? 0 : rows[0][i-1];
+	}
+	state_payload.nr_measurments=NR_STATE_MEASUREMENTS;
+	state_payload.measurements=state_measurements;
+
+	printed_object=cJSON_Parse(registration_response);
+}
+
+
+static void run_float_to_string(void){
+
+	char buffer[32];
+
+	floatToString(rows[call++%NR_ROWS][0],buffer,2);
+	sink+=buffer[0];
+}
+
+
+static void run_senml_power(void){
+
+	char *json=NULL;
+
+	create_senml_payload(&power_payload,&json);
+	sink+=json[0];
+	cJSON_free(json);
+}
+
+
+static void run_senml_state(void){
+
+	char *json=NULL;
+
+	create_senml_payload(&state_payload,&json);
+	sink+=json[0];
+	cJSON_free(json);
+}
+
+
+// The allocation-free serializer, for comparison with create_senml_payload
+static void run_write_senml_state(void){
+
+	char buffer[SENML_TEMPLATE_MAX_LEN];
+
+	sink+=write_senml_payload(&state_payload,buffer,sizeof(buffer));
+}
+
+
+static void run_registration(void){
+
+	char *json=NULL;
+
+	create_msg_registration_st(&json);
+	sink+=json[0];
+	cJSON_free(json);
+}
+
+
+static void run_parse(void){
+
+	cJSON *root=cJSON_Parse(registration_response);
+
+	sink+=(root!=NULL);
+	cJSON_Delete(root);
+}
+
+
+static void run_print(void){
+
+	char *json=cJSON_PrintUnformatted(printed_object);
+
+	sink+=json[0];
+	cJSON_free(json);
+}
+
+
+static void run_predict_proba(void){
+
+	float outputs[NR_CLASSES];
+
+	eml_net_predict_proba(&smart_transformer_fault_detection,rows[call++%NR_ROWS],6,outputs,NR_CLASSES);
+	sink+=(outputs[0]>0.5f);
+}
+
+
+static const benchmark benchmarks[] = {
+	{"floatToString", run_float_to_string},
+	{"create_senml_payload/power", run_senml_power},
+	{"create_senml_payload/state", run_senml_state},
+	{"write_senml_payload/state", run_write_senml_state},
+	{"create_msg_registration_st", run_registration},
+	{"cJSON_Parse+cJSON_Delete", run_parse},
+	{"cJSON_PrintUnformatted", run_print},
+	{"eml_net_predict_proba", run_predict_proba}
+};
+
+
+/**
+ * Reads the results of a previous run written with -f csv.
+ * @return The number of entries read, -1 if the file cannot be opened
+ */
+static int load_baseline(const char *path, baseline_entry *entries, int max_entries){
+
+	FILE *file=fopen(path,"r");
+	char line[256];
+	int count=0;
+
+	if (file==NULL){
+		perror(path);
+		return -1;
+	}
+	while (count<max_entries && fgets(line,sizeof(line),file)!=NULL){
+		char *comma=strchr(line,',');
+
+		// Skips the header and the malformed lines
+		if (comma==NULL || (size_t)(comma-line)>=NAME_LEN || strncmp(line,"benchmark,",10)==0){
+			continue;
+		}
+		memcpy(entries[count].name,line,comma-line);
+		entries[count].name[comma-line]='\0';
+		// benchmark,iterations,ns_per_op,...
+		comma=strchr(comma+1,',');
+		if (comma!=NULL){
+			entries[count].ns_per_op=strtod(comma+1,NULL);
+			count++;
+		}
+	}
+	fclose(file);
+	return count;
+}
+
+
+static const baseline_entry *find_baseline(const baseline_entry *entries, int nr_entries, const char *name){
+
+	for (int i=0; i<nr_entries; i++){
+		if (strcmp(entries[i].name,name)==0){
+			return &entries[i];
+		}
+	}
+	return NULL;
+}
+
+
+int main(int argc, char **argv){
+
+	const char *format="text";
+	const char *baseline_path=NULL;
+	const char *filter=NULL;
+	double min_ms=200;
+	int repetitions=5;
+	baseline_entry baseline[MAX_BENCHMARKS];
+	int nr_baseline=0;
+	FILE *results;
+	int option;
+
+	while ((option=getopt(argc,argv,"f:m:r:b:"))!=-1){
+		switch (option){
+			case 'f':
+				format=optarg;
+				break;
+			case 'm':
+				min_ms=atof(optarg);
+				break;
+			case 'r':
+				repetitions=atoi(optarg);
+				break;
+			case 'b':
+				baseline_path=optarg;
+				break;
+			default:
+				fprintf(stderr,"Usage: %s [-f text|csv|json] [-m min_ms] [-r repetitions] [-b baseline.csv] [filter]\n",argv[0]);
+				return 1;
+		}
+	}
+	if (optind<argc){
+		filter=argv[optind];
+	}
+	if ((strcmp(format,"text")!=0 && strcmp(format,"csv")!=0 && strcmp(format,"json")!=0) || min_ms<=0 || repetitions<1){
+		fprintf(stderr,"Invalid options\n");
+		return 1;
+	}
+	if (baseline_path!=NULL && (nr_baseline=load_baseline(baseline_path,baseline,MAX_BENCHMARKS))<0){
+		return 1;
+	}
+
+	// The results keep the original stdout, the prints of the utilities go to /dev/null
+	fflush(stdout);
+	results=fdopen(dup(STDOUT_FILENO),"w");
+	if (results==NULL || freopen("/dev/null","w",stdout)==NULL){
+		perror("stdout");
+		return 1;
+	}
+
+	linkaddr_node_addr=(linkaddr_t){{0x00,0x12,0x74,0x00,0x00,0x00,0x00,0x01}};
+	setup_payloads();
+
+	if (strcmp(format,"csv")==0){
+		fprintf(results,"benchmark,iterations,ns_per_op,allocs_per_op,bytes_per_op\n");
+	}
+	else if (strcmp(format,"text")==0){
+		fprintf(results,"%-28s %12s %10s %10s %10s%s\n","benchmark","iterations","ns/op","allocs/op","bytes/op",
+			nr_baseline>0 ? "  vs baseline" : "");
+	}
+
+	for (size_t b=0; b<sizeof(benchmarks)/sizeof(benchmarks[0]); b++){
+		const benchmark *bench=&benchmarks[b];
+		unsigned long long iterations=1, best_ns=~0ULL;
+		unsigned long long first_allocations, first_bytes;
+		double allocs_per_op, bytes_per_op, ns_per_op;
+
+		if (filter!=NULL && strstr(bench->name,filter)==NULL){
+			continue;
+		}
+
+		// Warm-up and calibration: the caches, the branch predictors and the heap reach their steady state
+		for (;;){
+			unsigned long long start=now_ns();
+
+			for (unsigned long long i=0; i<iterations; i++){
+				bench->run();
+			}
+			if (now_ns()-start>=min_ms*1e6){
+				break;
+			}
+			iterations*=2;
+		}
+
+		first_allocations=allocations;
+		first_bytes=allocated_bytes;
+		for (int r=0; r<repetitions; r++){
+			unsigned long long start=now_ns(), elapsed;
+
+			for (unsigned long long i=0; i<iterations; i++){
+				bench->run();
+			}
+			elapsed=now_ns()-start;
+			best_ns=(elapsed<best_ns) ? elapsed : best_ns;
+		}
+		ns_per_op=(double)best_ns/iterations;
+		allocs_per_op=(double)(allocations-first_allocations)/(iterations*repetitions);
+		bytes_per_op=(double)(allocated_bytes-first_bytes)/(iterations*repetitions);
+
+		if (strcmp(format,"csv")==0){
+			fprintf(results,"%s,%llu,%.2f,%.2f,%.1f\n",bench->name,iterations,ns_per_op,allocs_per_op,bytes_per_op);
+		}
+		else if (strcmp(format,"json")==0){
+			fprintf(results,"{\"benchmark\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.2f,\"allocs_per_op\":%.2f,\"bytes_per_op\":%.1f}\n",
+				bench->name,iterations,ns_per_op,allocs_per_op,bytes_per_op);
+		}
+		else {
+			const baseline_entry *reference=find_baseline(baseline,nr_baseline,bench->name);
+
+			fprintf(results,"%-28s %12llu %10.1f %10.2f %10.1f",bench->name,iterations,ns_per_op,allocs_per_op,bytes_per_op);
+			if (reference!=NULL && reference->ns_per_op>0){
+				fprintf(results,"  %+11.1f%%",100*(ns_per_op/reference->ns_per_op-1));
+			}
+			fprintf(results,"\n");
+		}
+		fflush(results);
+	}
+
+	cJSON_Delete(printed_object);
+	fclose(results);
+	return 0;
+}
@@ -0,0 +1,290 @@
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "decision_tree.h"
+#include "adaptive_period.h"
+#include "sample_batch.h"
+#include "observe_condition.h"
+#include "fast_activations.h"
+#include "json_tokenizer.h"
+#include "energy_meter.h"
+#include "smart_power_meter_utilities.h"
+#include "smart_transformer_utilities.h"
+
+/*
+ * Host checks of the decisions taken by the utilities of the sensors, on hand-built inputs: every check prints its
+ * name and the result, the exit code is 1 if any of them fails.
+ * Usage: utilities_test
+ */
+
+#define NR_CLASSES 5
+
+static int failures;
+
+
+static void check(bool condition, const char *name){
+	printf("%-70s %s\n", name, condition ? "ok" : "FAILED");
+	failures+=!condition;
+}
+
+
+/**
+ * A leaf answering at the cascade threshold must report its own confidence, not a certainty: the adaptive period
+ * may hold on it but not stretch. A leaf above ADAPTIVE_HIGH_CONFIDENCE lets the period grow.
+ */
+static void test_tree_confidence(void){
+
+	// Ia<=0: normal state with a confidence just at the threshold, otherwise normal state almost certain
+	static const decision_tree_node nodes[] = {
+		{0, 0, 2, 0},
+		{DECISION_TREE_LEAF, 0, 0, CASCADE_CONFIDENCE_THRESHOLD},
+		{DECISION_TREE_LEAF, 0, 0, 0.95}
+	};
+	static const decision_tree tree = {6, NR_CLASSES, 3, nodes};
+	float uncertain[6]={-1, 0, 0, 0, 0, 0}, certain[6]={1, 0, 0, 0, 0, 0};
+	float outputs[NR_CLASSES];
+	int predicted_class;
+	bool others_zero=true;
+
+	predicted_class=decision_tree_predict_proba(&tree, uncertain, 6, outputs, NR_CLASSES);
+	for (int i=1; i<NR_CLASSES; i++){
+		others_zero&=(outputs[i]==0);
+	}
+	check(predicted_class==0 && outputs[0]==(float)CASCADE_CONFIDENCE_THRESHOLD && others_zero,
+		"tree: the output of the predicted class is the leaf confidence");
+	check(adaptive_period_classify(false, outputs[predicted_class], ADAPTIVE_LOW_CONFIDENCE, ADAPTIVE_HIGH_CONFIDENCE, true)!=ADAPTIVE_PERIOD_STABLE,
+		"tree: a leaf at the cascade threshold does not stretch the period");
+
+	predicted_class=decision_tree_predict_proba(&tree, certain, 6, outputs, NR_CLASSES);
+	check(adaptive_period_classify(false, outputs[predicted_class], ADAPTIVE_LOW_CONFIDENCE, ADAPTIVE_HIGH_CONFIDENCE, true)==ADAPTIVE_PERIOD_STABLE,
+		"tree: a confident leaf on settled measurements stretches the period");
+	check(decision_tree_predict_proba(&tree, certain, 5, outputs, NR_CLASSES)==-1 && outputs[0]==0,
+		"tree: a wrong number of features gives no class");
+}
+
+
+/**
+ * Two observers of power_obs notified at different times (pmax 2 and 5 seconds, the power never changes by the step) must each receive every reading
+ * exactly once, in order, with the batch dropping only the readings both have received. The sensing activity of the
+ * power meter is replayed one reading per second, each observer reading the batch from its own cursor.
+ */
+static void test_batch_observers(void){
+
+	sample_batch batch;
+	observe_condition conditions[2]={
+		{.attributes=OBSERVE_CONDITION_STEP|OBSERVE_CONDITION_PMAX, .pmax=2, .step=1000},
+		{.attributes=OBSERVE_CONDITION_STEP|OBSERVE_CONDITION_PMAX, .pmax=5, .step=1000}
+	};
+	uint32_t cursors[2]={0, 0};
+	float expected[2]={0, 0};
+	int notifications[2]={0, 0};
+	senml_measurement measurements[SAMPLE_BATCH_MAX_SIZE];
+	senml_payload payload;
+	bool in_order=true, times_relative=true, only_unread=true;
+
+	sample_batch_init(&batch, POWER_BATCH_SIZE);
+	for (int i=0; i<2; i++){
+		observe_condition_start(&conditions[i], 0, 0);
+	}
+
+	for (uint32_t now=1; now<=60; now++){
+		bool full=sample_batch_add(&batch, now, (float)(now-1));
+		uint32_t oldest=(int32_t)(cursors[0]-cursors[1])<0 ? cursors[0] : cursors[1];
+
+		for (int i=0; i<2; i++){
+			if (!observe_condition_fires(&conditions[i], (float)now, now, full && cursors[i]==oldest)){
+				continue;
+			}
+			int nr_records=sample_batch_to_senml_since(&batch, cursors[i], now, "power", measurements, &payload);
+			for (int j=0; j<nr_records; j++){
+				in_order&=(measurements[j].value.float_value==expected[i]);
+				// The reading of value v was taken at v+1 seconds
+				times_relative&=(payload.base_time+measurements[j].time==(int)(expected[i]+1)-(int)now);
+				expected[i]++;
+			}
+			cursors[i]=sample_batch_end(&batch);
+			notifications[i]++;
+		}
+
+		sample_batch_discard_before(&batch, (int32_t)(cursors[0]-cursors[1])<0 ? cursors[0] : cursors[1]);
+		only_unread&=(batch.first_sequence==((int32_t)(cursors[0]-cursors[1])<0 ? cursors[0] : cursors[1]));
+	}
+
+	check(notifications[0]==30 && notifications[1]==12, "batch: the observers are notified at their own pmax");
+	check(in_order, "batch: each observer receives every reading once, in order");
+	check(expected[0]==60 && expected[1]==60, "batch: no reading is lost for the slower observer");
+	check(times_relative, "batch: the times of the pack are relative to the notification");
+	check(only_unread && batch.nr_samples==0, "batch: the readings are dropped once both observers have them");
+}
+
+
+/**
+ * The table activations must stay inside their tables up to the limits: just below 6, x+6 rounds to 12 in float.
+ */
+static void test_activation_limits(void){
+
+	float below=nextafterf(6.0f, 0), above=nextafterf(-6.0f, 0);
+
+	check(fabsf(fast_tanhf_table(below)-tanhf(below))<4e-4 && fabsf(fast_tanhf_table(-below)-tanhf(-below))<4e-4,
+		"activations: tanh table just inside +-6");
+	check(fabsf(fast_tanhf_table(above)-tanhf(above))<4e-4, "activations: tanh table just above -6");
+	check(fabsf(fast_expf_table(nextafterf(-16.0f, 0))-expf(-16.0f))<1e-6 && fast_expf_table(-16.0f)==0,
+		"activations: exp table at the -16 limit");
+}
+
+
+// Length of a literal payload, without the terminator the CoAP payloads do not have
+#define PAYLOAD(text) text, (uint16_t)(sizeof(text)-1)
+
+/**
+ * The tokenizer parses the payloads received from the network: malformed, truncated or hostile input must be
+ * rejected without reading past the given length, the well formed members must be found whatever comes around them.
+ */
+static void test_json_tokenizer(void){
+
+	const char *string;
+	uint16_t string_length;
+	double number;
+	int integer;
+	bool flag;
+	json_token token;
+
+	check(json_tokenizer_is_object(PAYLOAD(" {\"status\": true, \"max_power\": 3000} ")) &&
+		json_tokenizer_get_bool(PAYLOAD("{\"status\":true}"), "status", &flag) && flag &&
+		json_tokenizer_get_int(PAYLOAD("{\"max_power\":3000}"), "max_power", &integer) && integer==3000,
+		"json: well formed object and its members");
+
+	// Truncated: the payload length ends inside the value, whatever follows in memory
+	check(!json_tokenizer_is_object(PAYLOAD("{\"status\":tru")) && !json_tokenizer_is_object(PAYLOAD("{\"a\":1")) &&
+		!json_tokenizer_is_object(PAYLOAD("{\"a\":\"abc")) && !json_tokenizer_is_object(PAYLOAD("{\"a\":\"ab\\")) &&
+		!json_tokenizer_get_bool(PAYLOAD("{\"status\":tru"), "status", &flag),
+		"json: truncated payloads are rejected");
+	check(json_tokenizer_is_object("{\"a\":1}}", 7) && !json_tokenizer_is_object("{\"a\":1}}", 6),
+		"json: the payload length bounds the scan");
+
+	// Nested: members after a nested value are found, the depth is bounded
+	check(json_tokenizer_is_object(PAYLOAD("{\"a\":{\"b\":[1,{\"c\":2}]},\"d\":4}")) &&
+		json_tokenizer_find(PAYLOAD("{\"a\":{\"b\":[1,{\"c\":2}]},\"d\":4}"), "a", &token) &&
+		token.type==JSON_TOKEN_OBJECT && token.length==17 &&
+		json_tokenizer_get_int(PAYLOAD("{\"a\":{\"b\":[1,{\"c\":2}]},\"d\":4}"), "d", &integer) && integer==4 &&
+		!json_tokenizer_get_int(PAYLOAD("{\"a\":{\"d\":5}}"), "d", &integer),
+		"json: nested values are skipped, only top-level keys match");
+	check(json_tokenizer_is_object(PAYLOAD("{\"a\":[[[[[[[1]]]]]]]}")) &&
+		!json_tokenizer_is_object(PAYLOAD("{\"a\":[[[[[[[[1]]]]]]]]}")),
+		"json: nesting deeper than JSON_TOKENIZER_MAX_DEPTH is rejected");
+
+	// Escaped: the strings are returned raw, the escapes are validated
+	check(json_tokenizer_get_string(PAYLOAD("{\"k\\\"ey\":1,\"name\":\"a\\\"b\\\\c\\u00e9\"}"), "name", &string, &string_length) &&
+		string_length==13 && memcmp(string, "a\\\"b\\\\c\\u00e9", 13)==0,
+		"json: escaped strings are returned as they are");
+	check(!json_tokenizer_is_object(PAYLOAD("{\"a\":\"\\x\"}")) && !json_tokenizer_is_object(PAYLOAD("{\"a\":\"\\u12g4\"}")) &&
+		!json_tokenizer_is_object(PAYLOAD("{\"a\":\"\\u12\"}")) && !json_tokenizer_is_object(PAYLOAD("{\"a\":\"\n\"}")) &&
+		!json_tokenizer_is_object("{\"a\":\"\0\"}", 8),
+		"json: invalid escapes and control characters are rejected");
+
+	// Over-long: numbers that do not fit the conversion buffer, values saturated as cJSON does
+	check(json_tokenizer_is_object(PAYLOAD("{\"max_power\":12345678901234567890123456789012345}")) &&
+		!json_tokenizer_get_number(PAYLOAD("{\"max_power\":12345678901234567890123456789012345}"), "max_power", &number),
+		"json: numbers longer than the conversion buffer are refused");
+	check(json_tokenizer_get_int(PAYLOAD("{\"max_power\":1e30}"), "max_power", &integer) && integer==INT_MAX &&
+		json_tokenizer_get_int(PAYLOAD("{\"max_power\":-1e30}"), "max_power", &integer) && integer==INT_MIN,
+		"json: integers out of range are saturated");
+	check(!json_tokenizer_is_object(PAYLOAD("{\"a\":01}")) && !json_tokenizer_is_object(PAYLOAD("{\"a\":+1}")) &&
+		!json_tokenizer_is_object(PAYLOAD("{\"a\":1.}")) && !json_tokenizer_is_object(PAYLOAD("{\"a\":1e}")) &&
+		!json_tokenizer_is_object(PAYLOAD("[1]")) && !json_tokenizer_is_object(PAYLOAD("{\"a\":1} x")) &&
+		!json_tokenizer_is_object(NULL, 0),
+		"json: malformed numbers and non-objects are rejected");
+}
+
+
+/**
+ * The energy counters restored at boot must come from the newest record that is intact and was saved with the
+ * same clock resolution.
+ */
+static void test_energy_records(void){
+
+	energy_meter meter, other_meter, restored;
+	energy_meter_record older, newer, torn, other_clock;
+	const energy_meter_record *slots[2];
+
+	energy_meter_init(&meter, 128);
+	energy_meter_add_sample(&meter, 1000, 0, 0);
+	energy_meter_add_sample(&meter, -500, 3600*128, 0);
+	energy_meter_to_record(&meter, 1, &older);
+	energy_meter_add_sample(&meter, 0, 2*3600*128, 2);
+	energy_meter_to_record(&meter, 2, &newer);
+
+	torn=newer;
+	torn.counters.imported[0]^=1;
+	energy_meter_init(&restored, 128);
+	check(!energy_meter_from_record(&restored, &torn) && restored.counters.imported[0]==0,
+		"energy: a torn record is rejected");
+
+	energy_meter_init(&other_meter, 1000);
+	energy_meter_add_sample(&other_meter, 1000, 0, 0);
+	energy_meter_add_sample(&other_meter, 0, 1000, 0);
+	energy_meter_to_record(&other_meter, 3, &other_clock);
+	energy_meter_init(&restored, 128);
+	check(!energy_meter_from_record(&restored, &other_clock) && restored.counters.imported[0]==0,
+		"energy: a record with another tick rate is rejected");
+
+	slots[0]=&newer;
+	slots[1]=&older;
+	energy_meter_init(&restored, 128);
+	check(energy_meter_restore_newest(&restored, slots, 2)==2 &&
+		energy_meter_get_wh(&restored, &restored.counters.imported[0])==1000 &&
+		energy_meter_get_wh(&restored, &restored.counters.exported[2])==500,
+		"energy: the newest record is restored, in any slot");
+
+	slots[0]=&older;
+	slots[1]=&torn;
+	energy_meter_init(&restored, 128);
+	check(energy_meter_restore_newest(&restored, slots, 2)==1 &&
+		energy_meter_get_wh(&restored, &restored.counters.imported[0])==1000 && restored.counters.exported[2]==0,
+		"energy: a torn newest record falls back to the previous one");
+
+	slots[0]=NULL;
+	slots[1]=&other_clock;
+	energy_meter_init(&restored, 128);
+	check(energy_meter_restore_newest(&restored, slots, 2)==0 && restored.counters.imported[0]==0,
+		"energy: without a valid record the counters start from zero");
+}
+
+
+/**
+ * The conditional attributes come from the query of the observers: inconsistent ones refuse the registration.
+ */
+static void test_observe_attributes(void){
+
+	observe_condition condition;
+
+	check(observe_condition_parse(&condition, PAYLOAD("pmin=10&pmax=60&st=500"))==3 && condition.pmin==10 &&
+		condition.pmax==60 && condition.step==500, "observe: valid attributes");
+	check(observe_condition_parse(&condition, PAYLOAD("pmin=60&pmax=60"))==-1 &&
+		observe_condition_parse(&condition, PAYLOAD("pmax=10&pmin=30"))==-1,
+		"observe: pmax not greater than pmin is refused");
+	check(observe_condition_parse(&condition, PAYLOAD("st=0"))==-1 && observe_condition_parse(&condition, PAYLOAD("st=-5"))==-1,
+		"observe: a step not positive is refused");
+	check(observe_condition_parse(&condition, PAYLOAD("pmin=-1"))==-1 && observe_condition_parse(&condition, PAYLOAD("pmax=abc"))==-1 &&
+		observe_condition_parse(&condition, PAYLOAD("pmin="))==-1,
+		"observe: periods not valid are refused");
+	check(observe_condition_parse(&condition, PAYLOAD("foo=1&pmax=5"))==1 && observe_condition_parse(&condition, NULL, 0)==0,
+		"observe: other parameters are ignored");
+}
+
+
+int main(void){
+
+	test_tree_confidence();
+	test_batch_observers();
+	test_activation_limits();
+	test_json_tokenizer();
+	test_energy_records();
+	test_observe_attributes();
+
+	printf("%d failure(s)\n", failures);
+	return failures>0;
+}
@@ -0,0 +1,861 @@
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "random.h"
+#include "os/net/linkaddr.h"
+
+#include "senml-json.h"
+#include "sample_batch.h"
+#include "observe_condition.h"
+#include "adaptive_period.h"
+#include "backoff.h"
+#include "json_tokenizer.h"
+#include "math_utilities.h"
+#include "smart_power_meter_utilities.h"
+#include "smart_transformer_utilities.h"
+
+#include "coap_codec.h"
+
+/*
+ * Fleet of virtual sensors for load tests of the SparkGridServer and of the database: thousands of smart power meters
+ * and smart transformers played by one Linux process. Every virtual node has its own IPv6 address (prefix + index)
+ * and UDP socket on the CoAP port, so the server sees distinct devices exactly as with the real network: the node
+ * registers (POST device_registration, with the exponential backoff of registration_client.c), answers the observe
+ * registration of power_obs or transformer_state_obs and sends the notifications. The readings, batches, SenML
+ * payloads (JSON or CBOR), conditional attributes and adaptive sensing period come from the same utilities flashed on
+ * the sensors; the classifier of the transformers is not run, they always report the normal state.
+ *
+ * Contiki keeps the process list, the timers and the network stack in globals, so the firmware itself runs one node
+ * per process (Cooja or native target): here one event loop serves all the nodes, polling their sockets with epoll
+ * and keeping their timers in a binary heap.
+ *
+ * Time is virtual: with -x 100 a sensing period of 2 seconds lasts 20 ms, and so do the registration backoff and the
+ * pmin/pmax of the observers. The timeout of a registration request is on the real clock, it depends on the server.
+ *
+ * The addresses need not be configured one by one: a local route makes the kernel accept the whole prefix
+ *   ip -6 route add local fd00:fee::/64 dev lo
+ * The server must listen on an address routed to the same host (e.g. -s ::1) and every node takes a file descriptor
+ * (ulimit -n).
+ *
+ * Usage: virtual_fleet [-m meters] [-t transformers] [-x speedup] [-s server] [-p prefix] [-r ramp] [-d duration] [-S seed]
+ *   -m number of smart power meters (default 100)
+ *   -t number of smart transformers (default 0)
+ *   -x speed of the virtual time over the real one (default 1)
+ *   -s address of the server (default fd00::1, as SERVER_REG_EP)
+ *   -p prefix of the addresses of the nodes, the index of the node (from 1) is added (default fd00:fee::)
+ *   -r virtual seconds over which the first registrations are spread (default 10)
+ *   -d virtual seconds to run, 0 until interrupted (default 0)
+ *   -S seed of the readings: every node draws them from its own generator, seeded from this value and its index,
+ *      so the same seed gives the same readings to each node (default: from the clock)
+ */
+
+#define COAP_PORT 5683
+#define DEFAULT_METERS 100
+#define DEFAULT_SERVER "fd00::1"
+#define DEFAULT_PREFIX "fd00:fee::"
+#define DEFAULT_RAMP 10
+
+#define DEVICE_TYPE_SMART_POWER_METER 1
+#define DEVICE_TYPE_SMART_TRANSFORMER 2
+
+// As in SmartPowerMeter.c
+#define METER_SENSING_PERIOD 2
+#define METER_SENSING_MAX_PERIOD 16
+#define POWER_ALERT_DELTA 1000
+#define POWER_STABLE_DELTA 100
+
+// As in SmartTransformer.c and res-transformer_state.c
+#define TRANSFORMER_SENSING_PERIOD 2
+#define TRANSFORMER_SENSING_MAX_PERIOD 16
+#define NR_STATE_MEASUREMENTS 7
+
+// As in registration_client.h, in virtual ms
+#define REGISTRATION_BASE_DELAY 2000
+#define REGISTRATION_MAX_DELAY 64000
+#define REGISTRATION_RETRY_BUDGET 8
+#define REGISTRATION_SUSPEND_TIME 600000
+
+// Real time after which a registration without answer is a failure (the CoAP exchange of the nodes lasts up to 45 s)
+#define REGISTRATION_TIMEOUT_US 45000000ULL
+
+// Every Nth notification is confirmable, as COAP_OBSERVE_REFRESH_INTERVAL of Contiki-NG
+#define OBSERVE_REFRESH_INTERVAL 20
+
+// The user of a house plugs or unplugs a load (about 1 kW) with this probability at each sensing
+#define LOAD_CHANGE_PROBABILITY 0.1
+#define MAX_LOADS 8
+
+#define MAX_DATAGRAM 512
+#define MAX_EPOLL_EVENTS 256
+#define STATS_PERIOD_US 1000000ULL
+
+typedef enum {
+	REGISTRATION_PENDING,    // Request sent, waiting for the answer
+	REGISTRATION_BACKOFF,    // Waiting for the next attempt
+	REGISTRATION_DONE
+} registration_state;
+
+typedef enum {
+	EVENT_SENSING,
+	EVENT_REGISTRATION
+} event_kind;
+
+typedef struct {
+	uint64_t time;          // Real time (us since the start)
+	uint32_t node;
+	uint32_t generation;    // Registration events are stale if the node moved on
+	uint8_t kind;
+} event;
+
+typedef struct {
+	int fd;
+	uint8_t type;
+	linkaddr_t address;
+	uint16_t next_mid;
+
+	registration_state registration;
+	backoff policy;
+	uint32_t registration_generation;
+	uint8_t registration_token[4];
+	uint16_t registration_mid;
+
+	adaptive_period sensing_period;
+	math_prng measurements;
+
+	// Smart power meter
+	bool activated;
+	int max_power;
+	float max_ampere;
+	int nr_loads;
+	float voltage, current_consumed, current_produced, power_factor, instant_power, previous_instant_power;
+	sample_batch batch;
+
+	// Smart transformer
+	float Ia, Ib, Ic, Va, Vb, Vc;
+
+	// The server, the only observer
+	bool observed;
+	struct sockaddr_in6 observer;
+	uint8_t observer_token[COAP_CODEC_MAX_TOKEN_LEN];
+	uint8_t observer_token_len;
+	uint16_t observer_accept;
+	observe_condition condition;
+	bool condition_defaults;
+	uint32_t observe_sequence;
+	uint16_t last_notification_mid;
+} virtual_node;
+
+typedef struct {
+	unsigned long registrations_sent;
+	unsigned long registrations_failed;
+	unsigned long nodes_registered;
+	unsigned long notifications;
+	unsigned long notification_bytes;
+	unsigned long requests;
+	unsigned long resets;
+	unsigned long send_errors;
+} fleet_stats;
+
+
+// Defaults of the observers without conditional attributes, as in res-power.c and res-transformer_state.c
+static const observe_condition power_obs_defaults = {
+	.attributes = OBSERVE_CONDITION_STEP | OBSERVE_CONDITION_PMAX,
+	.pmax = 60,
+	.step = 1000
+};
+static const observe_condition state_obs_defaults = {0};
+
+static char *state_names[NR_STATE_MEASUREMENTS] = {"state", "current_A", "current_B", "current_C", "voltage_A", "voltage_B", "voltage_C"};
+static char *state_units[NR_STATE_MEASUREMENTS] = {"type_fault", "MA", "MA", "MA", "V", "MV", "MV"};
+
+static virtual_node *nodes;
+static uint32_t nr_nodes;
+static struct sockaddr_in6 server;
+static double speedup=1;
+static uint64_t start_time;
+
+static event *heap;
+static size_t heap_size;
+static size_t heap_capacity;
+
+static fleet_stats stats;
+static volatile sig_atomic_t stopping=0;
+
+
+static uint64_t real_time(void){
+
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec*1000000+now.tv_nsec/1000-start_time;
+}
+
+
+// Virtual seconds since the start, the clock_seconds() of the nodes
+static uint32_t virtual_seconds(uint64_t now){
+	return (uint32_t)(now*speedup/1000000);
+}
+
+
+// Real time at which a virtual delay (ms) from now expires
+static uint64_t after_virtual_ms(uint64_t now, uint32_t delay){
+	return now+(uint64_t)(delay*1000.0/speedup);
+}
+
+
+static void heap_push(uint64_t time, uint32_t node, event_kind kind, uint32_t generation){
+
+	if (heap_size==heap_capacity){
+		heap_capacity=heap_capacity ? 2*heap_capacity : 1024;
+		heap=realloc(heap, heap_capacity*sizeof(event));
+		if (heap==NULL){
+			fprintf(stderr, "Out of memory\n");
+			exit(1);
+		}
+	}
+
+	size_t i=heap_size++;
+	event added={time, node, generation, kind};
+
+	while (i>0 && heap[(i-1)/2].time>time){
+		heap[i]=heap[(i-1)/2];
+		i=(i-1)/2;
+	}
+	heap[i]=added;
+}
+
+
+static event heap_pop(void){
+
+	event top=heap[0];
+	event last=heap[--heap_size];
+	size_t i=0;
+
+	for (;;){
+		size_t child=2*i+1;
+
+		if (child>=heap_size){
+			break;
+		}
+		if (child+1<heap_size && heap[child+1].time<heap[child].time){
+			child++;
+		}
+		if (heap[child].time>=last.time){
+			break;
+		}
+		heap[i]=heap[child];
+		i=child;
+	}
+	if (heap_size>0){
+		heap[i]=last;
+	}
+	return top;
+}
+
+
+static void send_message(virtual_node *node, const coap_codec_message *message, const struct sockaddr_in6 *destination){
+
+	uint8_t datagram[MAX_DATAGRAM];
+	int length=coap_codec_serialize(message, datagram, sizeof(datagram));
+
+	if (length<0 || sendto(node->fd, datagram, length, 0, (const struct sockaddr *)destination, sizeof(*destination))<0){
+		stats.send_errors++;
+	}
+}
+
+
+/**
+ * Writes the representation of the observed resource of a node, with the content format asked by the server.
+ * @return The length of the payload, -1 if it does not fit
+ */
+static int write_representation(virtual_node *node, uint32_t now, uint16_t accept, char *buffer, int buffer_size, uint16_t *format){
+
+	static senml_payload payload;
+	static senml_measurement measurements[SAMPLE_BATCH_MAX_SIZE>NR_STATE_MEASUREMENTS ? SAMPLE_BATCH_MAX_SIZE : NR_STATE_MEASUREMENTS];
+
+	// The base name of the pack is taken from the link-layer address
+	linkaddr_node_addr=node->address;
+	memset(&payload, 0, sizeof(payload));
+	*format=COAP_CODEC_FORMAT_JSON;
+
+	if (node->type==DEVICE_TYPE_SMART_POWER_METER){
+		if (node->batch.nr_samples==0){
+			measurements[0].name="power";
+			measurements[0].unit=NULL;
+			measurements[0].time=0;
+			measurements[0].type=SENML_TYPE_V;
+			measurements[0].value.float_value=node->instant_power;
+			payload.nr_measurments=1;
+			payload.measurements=measurements;
+		}
+		else {
+			sample_batch_to_senml(&node->batch, now, "power", measurements, &payload);
+		}
+		payload.base_unit="W";
+		return write_senml_payload(&payload, buffer, buffer_size);
+	}
+
+	float values[NR_STATE_MEASUREMENTS]={0, node->Ia, node->Ib, node->Ic, node->Va, node->Vb, node->Vc};
+
+	for (int i=0; i<NR_STATE_MEASUREMENTS; i++){
+		measurements[i].name=state_names[i];
+		measurements[i].unit=state_units[i];
+		measurements[i].time=0;
+		measurements[i].type=SENML_TYPE_V;
+		measurements[i].value.float_value=values[i];
+	}
+	payload.nr_measurments=NR_STATE_MEASUREMENTS;
+	payload.measurements=measurements;
+
+	if (accept==COAP_CODEC_FORMAT_SENML_CBOR){
+		*format=COAP_CODEC_FORMAT_SENML_CBOR;
+		return write_senml_cbor_payload(&payload, (uint8_t *)buffer, buffer_size);
+	}
+	return write_senml_payload(&payload, buffer, buffer_size);
+}
+
+
+static void send_notification(virtual_node *node, uint32_t now){
+
+	char buffer[MAX_DATAGRAM-64];
+	coap_codec_message message;
+	uint16_t format;
+	int length=write_representation(node, now, node->observer_accept, buffer, sizeof(buffer), &format);
+
+	if (length<0){
+		stats.send_errors++;
+		return;
+	}
+
+	node->observe_sequence++;
+	coap_codec_init(&message, node->observe_sequence%OBSERVE_REFRESH_INTERVAL==0 ? COAP_CODEC_CON : COAP_CODEC_NON,
+		COAP_CODEC_CONTENT, node->next_mid++);
+	message.token_len=node->observer_token_len;
+	memcpy(message.token, node->observer_token, node->observer_token_len);
+	message.options=COAP_CODEC_OPTION_OBSERVE | COAP_CODEC_OPTION_CONTENT_FORMAT;
+	message.observe=node->observe_sequence;
+	message.content_format=format;
+	message.payload=(const uint8_t *)buffer;
+	message.payload_len=length;
+
+	node->last_notification_mid=message.mid;
+	send_message(node, &message, &node->observer);
+	stats.notifications++;
+	stats.notification_bytes+=length;
+}
+
+
+static void send_registration(virtual_node *node, uint32_t index, uint64_t now){
+
+	char payload[128];
+	char base_name[BASE_NAME_MAX_LEN];
+	coap_codec_message message;
+
+	linkaddr_node_addr=node->address;
+	create_base_name_attribute(base_name);
+	int length=snprintf(payload, sizeof(payload), "{\"full_name\":\"%s\",\"alias\":\"%s_%u\",\"type\":%d}", base_name,
+		node->type==DEVICE_TYPE_SMART_POWER_METER ? "house" : "smart_transformer", index+1, node->type);
+
+	coap_codec_init(&message, COAP_CODEC_CON, COAP_CODEC_POST, node->next_mid++);
+	for (int i=0; i<4; i++){
+		node->registration_token[i]=random_rand()&0xFF;
+	}
+	message.token_len=4;
+	memcpy(message.token, node->registration_token, 4);
+	strcpy(message.uri_path, "device_registration");
+	message.options=COAP_CODEC_OPTION_CONTENT_FORMAT | COAP_CODEC_OPTION_ACCEPT;
+	message.content_format=COAP_CODEC_FORMAT_JSON;
+	message.accept=COAP_CODEC_FORMAT_JSON;
+	message.payload=(const uint8_t *)payload;
+	message.payload_len=length;
+
+	node->registration=REGISTRATION_PENDING;
+	node->registration_mid=message.mid;
+	node->registration_generation++;
+	send_message(node, &message, &server);
+	stats.registrations_sent++;
+
+	heap_push(now+REGISTRATION_TIMEOUT_US, index, EVENT_REGISTRATION, node->registration_generation);
+}
+
+
+// Schedules the next attempt after a failed one, as registration_client.c
+static void registration_failed(virtual_node *node, uint32_t index, uint64_t now){
+
+	uint32_t delay;
+
+	stats.registrations_failed++;
+	if (!backoff_next_delay(&node->policy, random_rand(), &delay)){
+		backoff_reset(&node->policy);
+		delay=REGISTRATION_SUSPEND_TIME;
+	}
+	node->registration=REGISTRATION_BACKOFF;
+	node->registration_generation++;
+	heap_push(after_virtual_ms(now, delay), index, EVENT_REGISTRATION, node->registration_generation);
+}
+
+
+static void handle_registration_response(virtual_node *node, uint32_t index, const coap_codec_message *response, uint64_t now){
+
+	if (response->code!=COAP_CODEC_CREATED){
+		registration_failed(node, index, now);
+		return;
+	}
+
+	const char *payload=(const char *)response->payload;
+	bool status;
+	int max_power;
+
+	if (node->type==DEVICE_TYPE_SMART_POWER_METER){
+		if (!json_tokenizer_is_object(payload, response->payload_len)){
+			registration_failed(node, index, now);
+			return;
+		}
+		if (json_tokenizer_get_bool(payload, response->payload_len, "status", &status)){
+			node->activated=status;
+		}
+		if (json_tokenizer_get_int(payload, response->payload_len, "max_power", &max_power)){
+			node->max_power=max_power;
+			node->max_ampere=compute_max_ampere_consumable(max_power, MIN_VOLTAGE_PROVIDED, MIN_POWER_FACTOR);
+		}
+	}
+
+	node->registration=REGISTRATION_DONE;
+	node->registration_generation++;
+	stats.nodes_registered++;
+}
+
+
+// Observe registration, deregistration or plain GET of the resource of the node
+static void handle_get(virtual_node *node, const coap_codec_message *request, const struct sockaddr_in6 *source, uint64_t now){
+
+	const char *resource=node->type==DEVICE_TYPE_SMART_POWER_METER ? "power_obs" : "transformer_state_obs";
+	uint16_t accept=(request->options&COAP_CODEC_OPTION_ACCEPT) ? request->accept : COAP_CODEC_FORMAT_JSON;
+	uint32_t seconds=virtual_seconds(now);
+	coap_codec_message response;
+	char buffer[MAX_DATAGRAM-64];
+	uint16_t format;
+
+	coap_codec_init(&response, request->type==COAP_CODEC_CON ? COAP_CODEC_ACK : COAP_CODEC_NON, COAP_CODEC_CONTENT,
+		request->type==COAP_CODEC_CON ? request->mid : node->next_mid++);
+	response.token_len=request->token_len;
+	memcpy(response.token, request->token, request->token_len);
+
+	if (strcmp(request->uri_path, resource)!=0){
+		response.code=COAP_CODEC_NOT_FOUND;
+		send_message(node, &response, source);
+		return;
+	}
+
+	if (request->options&COAP_CODEC_OPTION_OBSERVE && request->observe==0){
+		float value=node->type==DEVICE_TYPE_SMART_POWER_METER ? node->instant_power : 0;
+		const observe_condition *defaults=node->type==DEVICE_TYPE_SMART_POWER_METER ? &power_obs_defaults : &state_obs_defaults;
+		observe_condition condition;
+		int nr_attributes=observe_condition_parse(&condition, request->uri_query, strlen(request->uri_query));
+
+		if (nr_attributes<0){
+			response.code=COAP_CODEC_BAD_REQUEST;
+			send_message(node, &response, source);
+			return;
+		}
+		node->condition_defaults=(nr_attributes==0);
+		node->condition=node->condition_defaults ? *defaults : condition;
+		observe_condition_start(&node->condition, value, seconds);
+
+		node->observed=true;
+		node->observer=*source;
+		node->observer_token_len=request->token_len;
+		memcpy(node->observer_token, request->token, request->token_len);
+		node->observer_accept=accept;
+		response.options|=COAP_CODEC_OPTION_OBSERVE;
+		response.observe=++node->observe_sequence;
+	}
+	else if (request->options&COAP_CODEC_OPTION_OBSERVE && request->observe==1 && node->observed &&
+		request->token_len==node->observer_token_len && memcmp(request->token, node->observer_token, request->token_len)==0){
+		node->observed=false;
+	}
+
+	int length=write_representation(node, seconds, accept, buffer, sizeof(buffer), &format);
+	if (length<0){
+		stats.send_errors++;
+		return;
+	}
+	response.options|=COAP_CODEC_OPTION_CONTENT_FORMAT;
+	response.content_format=format;
+	response.payload=(const uint8_t *)buffer;
+	response.payload_len=length;
+	send_message(node, &response, source);
+}
+
+
+static void handle_datagram(uint32_t index, const uint8_t *datagram, int length, const struct sockaddr_in6 *source, uint64_t now){
+
+	virtual_node *node=&nodes[index];
+	coap_codec_message message;
+
+	if (coap_codec_parse(&message, datagram, length)<0){
+		return;
+	}
+
+	// Answer to the registration: piggybacked on the ACK or separate (then acknowledged)
+	if (node->registration==REGISTRATION_PENDING && message.token_len==4 && memcmp(message.token, node->registration_token, 4)==0 &&
+		(message.type!=COAP_CODEC_ACK || message.mid==node->registration_mid)){
+		if (message.code==COAP_CODEC_EMPTY){
+			return;
+		}
+		if (message.type==COAP_CODEC_CON){
+			coap_codec_message ack;
+
+			coap_codec_init(&ack, COAP_CODEC_ACK, COAP_CODEC_EMPTY, message.mid);
+			send_message(node, &ack, source);
+		}
+		handle_registration_response(node, index, &message, now);
+		return;
+	}
+
+	switch (message.type){
+		case COAP_CODEC_RST:
+			// The server does not want the notifications anymore
+			if (node->observed && message.mid==node->last_notification_mid){
+				node->observed=false;
+				stats.resets++;
+			}
+			return;
+		case COAP_CODEC_ACK:
+			return;
+		default:
+			break;
+	}
+
+	if (message.code==COAP_CODEC_EMPTY){
+		// CoAP ping
+		coap_codec_message reset;
+
+		coap_codec_init(&reset, COAP_CODEC_RST, COAP_CODEC_EMPTY, message.mid);
+		send_message(node, &reset, source);
+		return;
+	}
+
+	stats.requests++;
+	if (message.code==COAP_CODEC_GET){
+		handle_get(node, &message, source, now);
+		return;
+	}
+
+	coap_codec_message response;
+
+	coap_codec_init(&response, message.type==COAP_CODEC_CON ? COAP_CODEC_ACK : COAP_CODEC_NON, COAP_CODEC_METHOD_NOT_ALLOWED,
+		message.type==COAP_CODEC_CON ? message.mid : node->next_mid++);
+	response.token_len=message.token_len;
+	memcpy(response.token, message.token, message.token_len);
+	send_message(node, &response, source);
+}
+
+
+// A sensing of a smart power meter, as execute_sensing() of SmartPowerMeter.c
+static adaptive_period_signal meter_sensing(virtual_node *node, uint32_t now){
+
+	math_utilities_use_prng(&node->measurements);
+	if (node->activated){
+		if (math_prng_uniform(&node->measurements)<LOAD_CHANGE_PROBABILITY){
+			node->nr_loads+=(math_prng_next(&node->measurements)&1) ? 1 : -1;
+			node->nr_loads=node->nr_loads<0 ? 0 : (node->nr_loads>MAX_LOADS ? MAX_LOADS : node->nr_loads);
+		}
+		generate_correct_smart_power_meter_values(&node->voltage, &node->current_consumed, &node->current_produced,
+			&node->power_factor, &node->instant_power, node->nr_loads, node->max_ampere);
+		// Over the maximum power the breaker trips: the user unplugs the loads
+		if (node->instant_power>node->max_power){
+			node->nr_loads=0;
+		}
+	}
+	else {
+		node->instant_power=0;
+	}
+
+	bool batch_full=sample_batch_add(&node->batch, now, node->instant_power);
+
+	if (node->registration==REGISTRATION_DONE && node->observed &&
+		observe_condition_fires(&node->condition, node->instant_power, now, batch_full && node->condition_defaults)){
+		send_notification(node, now);
+		sample_batch_clear(&node->batch);
+	}
+
+	float delta=fabsf(node->instant_power-node->previous_instant_power);
+
+	node->previous_instant_power=node->instant_power;
+	return delta>=POWER_ALERT_DELTA ? ADAPTIVE_PERIOD_ALERT : (delta<=POWER_STABLE_DELTA ? ADAPTIVE_PERIOD_STABLE : ADAPTIVE_PERIOD_HOLD);
+}
+
+
+// A sensing of a smart transformer: the values of a transformer without faults
+static adaptive_period_signal transformer_sensing(virtual_node *node, uint32_t now){
+
+	math_utilities_use_prng(&node->measurements);
+	generate_correct_transformers_values(&node->Ia, &node->Ib, &node->Ic, &node->Va, &node->Vb, &node->Vc);
+
+	if (node->registration==REGISTRATION_DONE && node->observed && observe_condition_fires(&node->condition, 0, now, false)){
+		send_notification(node, now);
+	}
+	return ADAPTIVE_PERIOD_STABLE;
+}
+
+
+static void handle_event(const event *due, uint64_t now){
+
+	virtual_node *node=&nodes[due->node];
+
+	if (due->kind==EVENT_SENSING){
+		uint32_t seconds=virtual_seconds(now);
+		adaptive_period_signal signal=node->type==DEVICE_TYPE_SMART_POWER_METER ? meter_sensing(node, seconds) : transformer_sensing(node, seconds);
+		uint16_t period=adaptive_period_update(&node->sensing_period, signal);
+
+		heap_push(after_virtual_ms(now, period*1000), due->node, EVENT_SENSING, 0);
+		return;
+	}
+
+	if (due->generation!=node->registration_generation){
+		return;
+	}
+	if (node->registration==REGISTRATION_PENDING){
+		// No answer in time
+		registration_failed(node, due->node, now);
+	}
+	else if (node->registration==REGISTRATION_BACKOFF){
+		send_registration(node, due->node, now);
+	}
+}
+
+
+static int open_node_socket(const struct in6_addr *prefix, uint32_t index){
+
+	struct sockaddr_in6 address;
+	int fd=socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+	int enable=1;
+
+	if (fd<0){
+		return -1;
+	}
+	memset(&address, 0, sizeof(address));
+	address.sin6_family=AF_INET6;
+	address.sin6_port=htons(COAP_PORT);
+	address.sin6_addr=*prefix;
+	for (int i=0; i<4; i++){
+		address.sin6_addr.s6_addr[15-i]+=((index+1)>>(8*i))&0xFF;
+	}
+
+	// The address does not need to be assigned to an interface, a local route is enough
+	setsockopt(fd, SOL_IP, IP_FREEBIND, &enable, sizeof(enable));
+	if (bind(fd, (struct sockaddr *)&address, sizeof(address))<0){
+		char text[INET6_ADDRSTRLEN];
+
+		fprintf(stderr, "Cannot bind [%s]:%d: %s\n", inet_ntop(AF_INET6, &address.sin6_addr, text, sizeof(text)), COAP_PORT, strerror(errno));
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+
+static void init_node(virtual_node *node, uint8_t type, uint32_t index, int fd, uint32_t seed){
+
+	memset(node, 0, sizeof(*node));
+	node->fd=fd;
+	node->type=type;
+	node->next_mid=random_rand();
+	math_prng_seed(&node->measurements, seed^(index*0x9E3779B9));
+	math_utilities_use_prng(&node->measurements);
+
+	// Link-layer address of the node, gives the base name urn:dev:mac:...
+	node->address.u8[0]=0x02;
+	node->address.u8[1]=0xF1;
+	node->address.u8[2]=0xEE;
+	node->address.u8[3]=type;
+	for (int i=0; i<4; i++){
+		node->address.u8[7-i]=((index+1)>>(8*i))&0xFF;
+	}
+
+	backoff_init(&node->policy, REGISTRATION_BASE_DELAY, REGISTRATION_MAX_DELAY, REGISTRATION_RETRY_BUDGET);
+	node->registration=REGISTRATION_BACKOFF;
+
+	if (type==DEVICE_TYPE_SMART_POWER_METER){
+		initialize_sensor_values(&node->voltage, &node->current_consumed, &node->current_produced, &node->power_factor,
+			&node->max_ampere, node->max_power);
+		sample_batch_init(&node->batch, POWER_BATCH_SIZE);
+		adaptive_period_init(&node->sensing_period, METER_SENSING_PERIOD, METER_SENSING_MAX_PERIOD);
+	}
+	else {
+		generate_initial_transformer_values(&node->Ia, &node->Ib, &node->Ic, &node->Va, &node->Vb, &node->Vc);
+		adaptive_period_init(&node->sensing_period, TRANSFORMER_SENSING_PERIOD, TRANSFORMER_SENSING_MAX_PERIOD);
+	}
+}
+
+
+static void print_stats(uint64_t now, const fleet_stats *previous, double elapsed){
+
+	printf("t=%lus (virtual) registered %lu/%u, notifications %.0f/s (%.0f B/s), requests %lu, registration failures %lu, resets %lu, send errors %lu\n",
+		(unsigned long)virtual_seconds(now), stats.nodes_registered, nr_nodes,
+		(stats.notifications-previous->notifications)/elapsed, (stats.notification_bytes-previous->notification_bytes)/elapsed,
+		stats.requests, stats.registrations_failed, stats.resets, stats.send_errors);
+	fflush(stdout);
+}
+
+
+static void stop(int signal){
+	stopping=1;
+}
+
+
+int main(int argc, char *argv[]){
+
+	uint32_t nr_meters=DEFAULT_METERS;
+	uint32_t nr_transformers=0;
+	const char *server_address=DEFAULT_SERVER;
+	const char *prefix_text=DEFAULT_PREFIX;
+	double ramp=DEFAULT_RAMP;
+	double duration=0;
+	uint32_t seed=0;
+	bool seeded=false;
+	struct in6_addr prefix;
+	struct timespec start;
+	int option;
+
+	while ((option=getopt(argc, argv, "m:t:x:s:p:r:d:S:"))!=-1){
+		switch (option){
+			case 'm':
+				nr_meters=strtoul(optarg, NULL, 10);
+				break;
+			case 't':
+				nr_transformers=strtoul(optarg, NULL, 10);
+				break;
+			case 'x':
+				speedup=atof(optarg);
+				break;
+			case 's':
+				server_address=optarg;
+				break;
+			case 'p':
+				prefix_text=optarg;
+				break;
+			case 'r':
+				ramp=atof(optarg);
+				break;
+			case 'd':
+				duration=atof(optarg);
+				break;
+			case 'S':
+				seed=strtoul(optarg, NULL, 0);
+				seeded=true;
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-m meters] [-t transformers] [-x speedup] [-s server] [-p prefix] [-r ramp] [-d duration] [-S seed]\n", argv[0]);
+				return 1;
+		}
+	}
+
+	nr_nodes=nr_meters+nr_transformers;
+	memset(&server, 0, sizeof(server));
+	server.sin6_family=AF_INET6;
+	server.sin6_port=htons(COAP_PORT);
+	if (speedup<=0 || ramp<0 || nr_nodes==0 || inet_pton(AF_INET6, server_address, &server.sin6_addr)!=1 ||
+		inet_pton(AF_INET6, prefix_text, &prefix)!=1){
+		fprintf(stderr, "Invalid arguments\n");
+		return 1;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	start_time=(uint64_t)start.tv_sec*1000000+start.tv_nsec/1000;
+	random_init((unsigned short)(start.tv_nsec ^ getpid()));
+	if (!seeded){
+		seed=(uint32_t)start.tv_nsec^((uint32_t)getpid()<<16);
+	}
+
+	int epoll_fd=epoll_create1(0);
+
+	nodes=calloc(nr_nodes, sizeof(virtual_node));
+	if (epoll_fd<0 || nodes==NULL){
+		fprintf(stderr, "Cannot allocate %u nodes\n", nr_nodes);
+		return 1;
+	}
+
+	for (uint32_t i=0; i<nr_nodes; i++){
+		int fd=open_node_socket(&prefix, i);
+		struct epoll_event interest={.events=EPOLLIN, .data.u32=i};
+
+		if (fd<0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &interest)<0){
+			fprintf(stderr, "Cannot open the socket of node %u (ip -6 route add local <prefix>/64 dev lo, ulimit -n)\n", i+1);
+			return 1;
+		}
+		init_node(&nodes[i], i<nr_meters ? DEVICE_TYPE_SMART_POWER_METER : DEVICE_TYPE_SMART_TRANSFORMER, i, fd, seed);
+
+		// The nodes boot during the ramp: the sensing starts at once, the registration goes on in background
+		uint64_t boot=after_virtual_ms(0, (uint32_t)(ramp*1000*random_rand()/RANDOM_RAND_MAX));
+
+		heap_push(after_virtual_ms(boot, nodes[i].sensing_period.period*1000), i, EVENT_SENSING, 0);
+		heap_push(boot, i, EVENT_REGISTRATION, nodes[i].registration_generation);
+	}
+	printf("%u meters and %u transformers, speedup %.1f, server [%s]:%d, seed %lu\n", nr_meters, nr_transformers, speedup, server_address,
+		COAP_PORT, (unsigned long)seed);
+
+	signal(SIGINT, stop);
+	signal(SIGTERM, stop);
+
+	fleet_stats previous=stats;
+	uint64_t last_stats=0;
+
+	while (!stopping && (duration==0 || virtual_seconds(real_time())<duration)){
+		uint64_t now=real_time();
+		struct epoll_event events[MAX_EPOLL_EVENTS];
+
+		while (heap_size>0 && heap[0].time<=now){
+			event due=heap_pop();
+
+			handle_event(&due, now);
+		}
+
+		int timeout=heap_size>0 ? (int)((heap[0].time-now+999)/1000) : 1000;
+		int nr_events=epoll_wait(epoll_fd, events, MAX_EPOLL_EVENTS, timeout<1000 ? timeout : 1000);
+
+		now=real_time();
+		for (int e=0; e<nr_events; e++){
+			uint32_t index=events[e].data.u32;
+			uint8_t datagram[MAX_DATAGRAM];
+			struct sockaddr_in6 source;
+			socklen_t source_length=sizeof(source);
+			ssize_t length;
+
+			while ((length=recvfrom(nodes[index].fd, datagram, sizeof(datagram), 0, (struct sockaddr *)&source, &source_length))>=0){
+				handle_datagram(index, datagram, length, &source, now);
+				source_length=sizeof(source);
+			}
+		}
+
+		if (now-last_stats>=STATS_PERIOD_US){
+			print_stats(now, &previous, (now-last_stats)/1e6);
+			previous=stats;
+			last_stats=now;
+		}
+	}
+
+	print_stats(real_time(), &previous, (real_time()-last_stats)/1e6);
+	for (uint32_t i=0; i<nr_nodes; i++){
+		close(nodes[i].fd);
+	}
+	close(epoll_fd);
+	free(nodes);
+	free(heap);
+	return 0;
+}
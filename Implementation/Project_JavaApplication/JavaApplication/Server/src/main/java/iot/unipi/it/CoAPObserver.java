@@ -4,6 +4,7 @@ import org.eclipse.californium.core.CoapClient;
 import org.eclipse.californium.core.CoapHandler;
 import org.eclipse.californium.core.CoapObserveRelation;
 import org.eclipse.californium.core.CoapResponse;
+import org.eclipse.californium.core.coap.MediaTypeRegistry;
 
 import iot.unipi.it.JSON.SenMLObject;
 import iot.unipi.it.database.ObserverActions;
@@ -17,6 +18,9 @@ public class CoAPObserver {
 
 	private ObserverActions obsActions;
 
+	// Representation requested through the Accept option of the observe registration.
+	private int accept = MediaTypeRegistry.APPLICATION_JSON;
+
 	public CoAPObserver(String ipAddress, String resource) {
 
 		this.client = new CoapClient("coap://[" + ipAddress + "]/" + resource);
@@ -27,6 +31,8 @@ public class CoAPObserver {
 
 		if (resource.equals("transformer_state_obs")) {
 			obsActions = new SmartTransformerMeasurmentsDAO();
+			// The transformer sends 7 measures per notification: SenML-CBOR saves radio time.
+			accept = SenMLObject.CONTENT_FORMAT_SENML_CBOR;
 		}
 	}
 
@@ -35,11 +41,18 @@ public class CoAPObserver {
 		this.setRelation(this.client.observe(new CoapHandler() {
 			@Override
 			public void onLoad(CoapResponse response) {
-				String content = response.getResponseText();
+				SenMLObject senML;
+
+				if (response.getOptions().getContentFormat() == SenMLObject.CONTENT_FORMAT_SENML_CBOR) {
+					senML = new SenMLObject(response.getPayload());
+					System.out.println("\nArrived (" + response.getPayload().length + " bytes of CBOR):\n" + senML);
+				} else {
+					String content = response.getResponseText();
 
-				System.out.println("\nArrived:" + content);
+					System.out.println("\nArrived:" + content);
 
-				SenMLObject senML = new SenMLObject(content);
+					senML = new SenMLObject(content);
+				}
 
 				Integer idDevice = SparkGridServer.myCache.get(senML.getBaseName());
 
@@ -72,7 +85,7 @@ public class CoAPObserver {
 					client.shutdown();
 				}
 			}
-		}));
+		}, accept));
 
 	}
 
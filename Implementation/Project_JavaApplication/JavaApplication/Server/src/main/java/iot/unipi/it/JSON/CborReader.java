@@ -0,0 +1,138 @@
+package iot.unipi.it.JSON;
+
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Minimal CBOR (RFC 8949) decoder, limited to the data items produced by the sensors for SenML-CBOR: integers,
+ * text strings, arrays, maps and the simple values false, true and null. Integers fitting in 32 bits are returned
+ * as Integer, as the JSON decoder does.
+ *
+ * @author d.vigna
+ */
+public class CborReader {
+
+	private final byte[] data;
+	private int position;
+
+	public CborReader(byte[] data) {
+		this.data = data;
+		this.position = 0;
+	}
+
+	public boolean hasMore() {
+		return position < data.length;
+	}
+
+	/**
+	 * Decodes the next data item.
+	 *
+	 * @return Integer/Long, String, Boolean, List<Object>, Map<Object, Object> or null
+	 */
+	public Object readItem() {
+
+		int initialByte = nextByte();
+		int majorType = initialByte >>> 5;
+		int additionalInfo = initialByte & 0x1F;
+
+		if (majorType == 7) {
+			switch (additionalInfo) {
+			case 20:
+				return Boolean.FALSE;
+			case 21:
+				return Boolean.TRUE;
+			case 22:
+				return null;
+			default:
+				throw new IllegalArgumentException("Unsupported CBOR simple value " + additionalInfo);
+			}
+		}
+
+		long argument = readArgument(additionalInfo);
+
+		switch (majorType) {
+		case 0:
+			return toNumber(argument);
+		case 1:
+			return toNumber(-1 - argument);
+		case 3:
+			int length = toLength(argument);
+			String text = new String(data, position, length, StandardCharsets.UTF_8);
+			position += length;
+			return text;
+		case 4:
+			int nrItems = toLength(argument);
+			List<Object> array = new ArrayList<Object>(nrItems);
+			for (int i = 0; i < nrItems; i++) {
+				array.add(readItem());
+			}
+			return array;
+		case 5:
+			int nrPairs = toLength(argument);
+			Map<Object, Object> map = new HashMap<Object, Object>();
+			for (int i = 0; i < nrPairs; i++) {
+				Object key = readItem();
+				map.put(key, readItem());
+			}
+			return map;
+		default:
+			throw new IllegalArgumentException("Unsupported CBOR major type " + majorType);
+		}
+	}
+
+	private long readArgument(int additionalInfo) {
+
+		if (additionalInfo < 24) {
+			return additionalInfo;
+		}
+
+		int nrBytes;
+		switch (additionalInfo) {
+		case 24:
+			nrBytes = 1;
+			break;
+		case 25:
+			nrBytes = 2;
+			break;
+		case 26:
+			nrBytes = 4;
+			break;
+		case 27:
+			nrBytes = 8;
+			break;
+		default:
+			throw new IllegalArgumentException("Indefinite lengths are not supported");
+		}
+
+		long argument = 0;
+		for (int i = 0; i < nrBytes; i++) {
+			argument = (argument << 8) | nextByte();
+		}
+		return argument;
+	}
+
+	private int nextByte() {
+		if (position >= data.length) {
+			throw new IllegalArgumentException("Truncated CBOR item");
+		}
+		return data[position++] & 0xFF;
+	}
+
+	private int toLength(long argument) {
+		if (argument < 0 || argument > data.length - position) {
+			throw new IllegalArgumentException("Invalid CBOR length " + argument);
+		}
+		return (int) argument;
+	}
+
+	private static Object toNumber(long value) {
+		if (value >= Integer.MIN_VALUE && value <= Integer.MAX_VALUE) {
+			return (int) value;
+		}
+		return value;
+	}
+
+}
@@ -1,5 +1,7 @@
 package iot.unipi.it.JSON;
 
+import java.util.Map;
+
 import org.json.JSONException;
 import org.json.JSONObject;
 
@@ -19,6 +21,9 @@ public class SenMLMeasurment {
 
 	private int time;
 
+	// Times lower than this (2^28 s) are relative to the current time (RFC 8428, section 4.5.3)
+	private static final int RELATIVE_TIME_LIMIT = 1 << 28;
+
 	// private float sum_value; not used in this project
 	// private int updateTime; not used in this project
 
@@ -69,6 +74,31 @@ public class SenMLMeasurment {
 		}
 	}
 
+	/**
+	 * Builds the measure from a SenML-CBOR record, whose fields are identified by the integer labels of RFC 8428.
+	 */
+	public SenMLMeasurment(Map<Object, Object> record) {
+
+		this.name = (String) record.get(SenMLObject.LABEL_NAME);
+		this.unit = (String) record.get(SenMLObject.LABEL_UNIT);
+
+		if (record.containsKey(SenMLObject.LABEL_VALUE)) {
+			this.type = SenmlValueType.SENML_TYPE_V;
+			this.value = record.get(SenMLObject.LABEL_VALUE);
+		} else if (record.containsKey(SenMLObject.LABEL_STRING_VALUE)) {
+			this.type = SenmlValueType.SENML_TYPE_SV;
+			this.value = record.get(SenMLObject.LABEL_STRING_VALUE);
+		} else if (record.containsKey(SenMLObject.LABEL_BOOLEAN_VALUE)) {
+			this.type = SenmlValueType.SENML_TYPE_BV;
+			this.value = record.get(SenMLObject.LABEL_BOOLEAN_VALUE);
+		}
+
+		Object time = record.get(SenMLObject.LABEL_TIME);
+		if (time instanceof Integer) {
+			this.time = (Integer) time;
+		}
+	}
+
 	public String getName() {
 		return name;
 	}
@@ -89,6 +119,27 @@ public class SenMLMeasurment {
 		return time;
 	}
 
+	/**
+	 * Applies the base time of the pack, so that the time of the measure is the resolved one.
+	 */
+	void addBaseTime(int baseTime) {
+		this.time += baseTime;
+	}
+
+	/**
+	 * Converts the (resolved) time of the measure to a date. Accordingly to SenML, values lower than 2^28 are
+	 * seconds relative to the moment the pack was received (negative in the past), the others are UNIX times.
+	 * 
+	 * @param receptionMillis The moment the pack was received, in milliseconds
+	 * @return The time of the measure, in milliseconds since the epoch
+	 */
+	public long getTimeMillis(long receptionMillis) {
+		if (time < RELATIVE_TIME_LIMIT) {
+			return receptionMillis + time * 1000L;
+		}
+		return time * 1000L;
+	}
+
 	public int getValueInt() {
 		return (int) this.value / 100;
 	}
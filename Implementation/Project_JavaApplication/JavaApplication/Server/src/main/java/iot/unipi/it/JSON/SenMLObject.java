@@ -2,6 +2,7 @@ package iot.unipi.it.JSON;
 
 import java.util.ArrayList;
 import java.util.List;
+import java.util.Map;
 
 import org.json.JSONArray;
 import org.json.JSONException;
@@ -15,6 +16,21 @@ import org.json.JSONObject;
  */
 public class SenMLObject {
 
+	// CoAP content-format of application/senml+cbor
+	public static final int CONTENT_FORMAT_SENML_CBOR = 112;
+
+	// Labels of the SenML-CBOR representation (RFC 8428)
+	static final Integer LABEL_BASE_VERSION = -1;
+	static final Integer LABEL_BASE_NAME = -2;
+	static final Integer LABEL_BASE_TIME = -3;
+	static final Integer LABEL_BASE_UNIT = -4;
+	static final Integer LABEL_NAME = 0;
+	static final Integer LABEL_UNIT = 1;
+	static final Integer LABEL_VALUE = 2;
+	static final Integer LABEL_STRING_VALUE = 3;
+	static final Integer LABEL_BOOLEAN_VALUE = 4;
+	static final Integer LABEL_TIME = 6;
+
 	private String baseName;
 	private int baseTime;
 	private String baseUnit;
@@ -62,12 +78,68 @@ public class SenMLObject {
 
 			}
 
+			resolveTimes();
+
 		} catch (Exception e) {
 			System.out.println("Error in decoding JSON..");
 		}
 
 	}
 
+	/**
+	 * Decodes a SenML-CBOR payload: an array of records where the base fields are carried by the records (the
+	 * sensors put them in the first one). A record without any measure field only carries base fields.
+	 */
+	public SenMLObject(byte[] cbor) {
+
+		try {
+			List<?> records = (List<?>) new CborReader(cbor).readItem();
+
+			for (Object item : records) {
+
+				@SuppressWarnings("unchecked")
+				Map<Object, Object> record = (Map<Object, Object>) item;
+
+				if (record.containsKey(LABEL_BASE_NAME)) {
+					this.baseName = (String) record.get(LABEL_BASE_NAME);
+				}
+
+				if (record.containsKey(LABEL_BASE_TIME)) {
+					this.baseTime = (Integer) record.get(LABEL_BASE_TIME);
+				}
+
+				if (record.containsKey(LABEL_BASE_UNIT)) {
+					this.baseUnit = (String) record.get(LABEL_BASE_UNIT);
+				}
+
+				if (record.containsKey(LABEL_BASE_VERSION)) {
+					this.version = (Integer) record.get(LABEL_BASE_VERSION);
+				}
+
+				if (record.containsKey(LABEL_NAME) || record.containsKey(LABEL_VALUE)
+						|| record.containsKey(LABEL_STRING_VALUE) || record.containsKey(LABEL_BOOLEAN_VALUE)) {
+					this.measurments.add(new SenMLMeasurment(record));
+				}
+			}
+
+			resolveTimes();
+
+		} catch (Exception e) {
+			System.out.println("Error in decoding CBOR..");
+		}
+
+	}
+
+	/**
+	 * Adds the base time to the time of every measure: the measures of a pack sent in batch have the time of the
+	 * oldest one as base time and their offset as time.
+	 */
+	private void resolveTimes() {
+		for (SenMLMeasurment measurment : measurments) {
+			measurment.addBaseTime(baseTime);
+		}
+	}
+
 	public String getBaseName() {
 		return baseName;
 	}
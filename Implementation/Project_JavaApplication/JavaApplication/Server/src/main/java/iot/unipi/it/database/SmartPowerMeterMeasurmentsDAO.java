@@ -3,6 +3,7 @@ package iot.unipi.it.database;
 import java.sql.Connection;
 import java.sql.PreparedStatement;
 import java.sql.SQLException;
+import java.sql.Timestamp;
 import java.util.List;
 
 import iot.unipi.it.JSON.SenMLMeasurment;
@@ -16,12 +17,14 @@ import iot.unipi.it.JSON.SenMLMeasurment;
 public class SmartPowerMeterMeasurmentsDAO implements ObserverActions {
 
 	/**
-	 * This function is used to insert the single power measure on Database.
+	 * This function is used to insert the power measures on Database. A notification can carry several measures
+	 * collected by the sensor at different times: each one is stored with its own timestamp.
 	 * 
 	 * @param idDevice        This is the identificator of the smart power meter
 	 *                        device in the database.
-	 * @param listMeasurments contains power-> This is the value of the power
-	 *                        measure by the sensor to be stored.
+	 * @param listMeasurments contains power-> These are the values of the power
+	 *                        measured by the sensor to be stored, with their
+	 *                        time relative to the reception.
 	 * @throws SQLException
 	 */
 	@Override
@@ -31,27 +34,35 @@ public class SmartPowerMeterMeasurmentsDAO implements ObserverActions {
 			return;
 		}
 
-		SenMLMeasurment measurment = listMeasurments.get(0);
-
-		// This trick was introduced on Contiki side to allow float transmission without problems.
-		Integer intPower = (Integer) measurment.getValue();
-		float power = (float) intPower / 100;
+		long receptionMillis = System.currentTimeMillis();
 
 		Connection connection = null;
 		try {
 
 			connection = HikariCPDataSource.getConnection();
 
-			String stmt = "INSERT INTO smart_power_meter_measurments (ID_DEVICE,POWER) VALUES(?,?)";
+			String stmt = "INSERT INTO smart_power_meter_measurments (ID_DEVICE,POWER,TIMESTAMP) VALUES(?,?,?)";
 
-			// Preparing the SQL query to register the measurement of smart power meter
+			// Preparing the SQL query to register the measurements of smart power meter, sent as a single batch
 			PreparedStatement ps = connection.prepareStatement(stmt);
-			ps.setInt(1, idDevice);
-			ps.setFloat(2, power);
-			ps.executeUpdate();
+
+			for (SenMLMeasurment measurment : listMeasurments) {
+
+				// This trick was introduced on Contiki side to allow float transmission without problems.
+				Integer intPower = (Integer) measurment.getValue();
+				float power = (float) intPower / 100;
+
+				ps.setInt(1, idDevice);
+				ps.setFloat(2, power);
+				ps.setTimestamp(3, new Timestamp(measurment.getTimeMillis(receptionMillis)));
+				ps.addBatch();
+
+				System.out.println("Smart Power Meter measurment insert into database value: " + power);
+			}
+
+			ps.executeBatch();
 			ps.close();
 
-			System.out.println("Smart Power Meter measurment insert into database value: " + power);
 		} catch (SQLException e) {
 			System.out.println("An error occurred during insert in DB..");
 			e.printStackTrace();
@@ -1,5 +1,8 @@
 package iot.unipi.it;
 
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Paths;
 import java.sql.Connection;
 import java.sql.SQLException;
 import java.time.format.DateTimeFormatter;
@@ -24,6 +27,9 @@ import iot.unipi.it.database.SmartTransformerDAO.TransformerMeasurement;
  */
 public class SmartTransformerRemoteFunctionalities {
 
+	// Largest block accepted by the transformer_model resource of the sensor
+	private static final int MODEL_BLOCK_SIZE = 256;
+
 	/**
 	 * This functionality allows the user to see the last measurement received and
 	 * save on the DB of the smart transformer.
@@ -162,6 +168,58 @@ public class SmartTransformerRemoteFunctionalities {
 
 	}
 
+	/**
+	 * This method uploads a new fault detection model to the Smart Transformer
+	 * (blob produced by Project_HostTools/model_blob_tool). The sensor keeps
+	 * using its current model if the upload is not complete or not valid.
+	 * 
+	 * @param idDevice The id of the device associated with the smart transformer.
+	 */
+	@SuppressWarnings("resource")
+	public void updateFaultDetectionModel(int idDevice) {
+
+		Connection connection = null;
+		Scanner scanner = new Scanner(System.in);
+		try {
+			connection = HikariCPDataSource.getConnection();
+
+			System.out.print("Insert the path of the model blob : ");
+			String path = scanner.nextLine();
+
+			byte[] blob = Files.readAllBytes(Paths.get(path));
+			String ipAddress = IoTDevicesDAO.getIpAddress(connection, idDevice);
+
+			System.out.println("Uploading " + blob.length + " bytes...");
+			CoapResponse response = CoapRequest.sendBlockwiseCoapRequest(ipAddress, "transformer_model", blob,
+					MODEL_BLOCK_SIZE);
+
+			if (response != null && response.getCode().equals(ResponseCode.CHANGED)) {
+				System.out.println("Smart Transformer model updated successfully!");
+				CoapRequest.sendCoapRequest(ipAddress, "transformer_model", "GET", null);
+				System.out.println();
+			} else {
+				System.out.println("Model rejected, the Smart Transformer keeps the previous one: "
+						+ ((response != null) ? response.getCode() : "no answer"));
+			}
+
+			connection.close();
+
+			System.out.print("Press any key ");
+			new Scanner(System.in).nextLine();
+
+		} catch (IOException e) {
+			System.out.println("Cannot read the model blob: " + e.getMessage());
+		} catch (SQLException e) {
+			e.printStackTrace();
+		} finally {
+			try {
+				connection.close();
+			} catch (SQLException e) {
+				e.printStackTrace();
+			}
+		}
+	}
+
 	// Utility print function
 
 	/**
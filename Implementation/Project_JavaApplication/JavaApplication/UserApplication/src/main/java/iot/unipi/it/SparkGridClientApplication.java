@@ -32,7 +32,7 @@ public class SparkGridClientApplication {
 			System.out.println("User application for Cooja Simulation");
 		}
 		try (Scanner scanner = new Scanner(System.in)) {
-			List<String> optionAllowed = Arrays.asList("1", "2", "3", "4", "5", "6", "7");
+			List<String> optionAllowed = Arrays.asList("1", "2", "3", "4", "5", "6", "7", "8");
 			String optSelected = "";
 
 			// First get the ids of the registered smart devices
@@ -104,6 +104,11 @@ public class SparkGridClientApplication {
 					break;
 
 				case ("7"):
+					stHandler.updateFaultDetectionModel(iotSmartTransformer.getId());
+					optSelected = "";
+					break;
+
+				case ("8"):
 					System.out.println("Good bye!");
 					break;
 
@@ -127,7 +132,8 @@ public class SparkGridClientApplication {
 		System.out.println("|    4. Daily consumption house_1                 |");
 		System.out.println("|    5. Current status Smart Transformer          |");
 		System.out.println("|    6. Change settings Smart Transformer relay   |");
-		System.out.println("|    7. Exit                                      |");
+		System.out.println("|    7. Update fault model Smart Transformer      |");
+		System.out.println("|    8. Exit                                      |");
 		System.out.println("===================================================");
 		System.out.println("|  Please select an option by number              |");
 		System.out.println("===================================================");
@@ -3,6 +3,8 @@ package iot.unipi.it.coap;
 import org.eclipse.californium.core.CoapClient;
 import org.eclipse.californium.core.CoapResponse;
 import org.eclipse.californium.core.coap.MediaTypeRegistry;
+import org.eclipse.californium.core.network.CoapEndpoint;
+import org.eclipse.californium.core.network.config.NetworkConfig;
 import org.json.JSONObject;
 
 /**
@@ -50,4 +52,29 @@ public class CoapRequest {
 		return response;
 	}
 
+	/**
+	 * Sends a binary payload with a PUT using block-wise transfer (Block1), with
+	 * blocks small enough for the buffers of the IoT devices.
+	 * 
+	 * @param ipAddress The address to contact
+	 * @param resource  The resource to be considered
+	 * @param payload   The binary content to upload
+	 * @param blockSize The size of each block (16, 32, ..., 1024 bytes)
+	 * @return The response to the last block, null if the transfer failed
+	 */
+	public static CoapResponse sendBlockwiseCoapRequest(String ipAddress, String resource, byte[] payload,
+			int blockSize) {
+
+		NetworkConfig config = new NetworkConfig();
+		config.setInt(NetworkConfig.Keys.PREFERRED_BLOCK_SIZE, blockSize);
+		config.setInt(NetworkConfig.Keys.MAX_MESSAGE_SIZE, blockSize);
+
+		CoapClient client = new CoapClient("coap://[" + ipAddress + "]/" + resource);
+		client.setEndpoint(new CoapEndpoint(config));
+
+		CoapResponse response = client.put(payload, MediaTypeRegistry.APPLICATION_OCTET_STREAM);
+		client.shutdown();
+		return response;
+	}
+
 }
@@ -2,7 +2,6 @@
 #include "net/netstack.h"
 
 #include "coap-engine.h"
-#include "coap-blocking-api.h"
 
 #include "os/dev/leds.h"
 #include "os/dev/button-hal.h"
@@ -20,26 +19,39 @@
 #include "smart_power_meter_utilities.h"
 #include "printing_floats.h"
 #include "senml-json.h"
-
-#include "cJSON.h"
+#include "sample_batch.h"
+#include "adaptive_period.h"
+
+#include "json_tokenizer.h"
+#include "json_pool.h"
+#include "registration_client.h"
+#include "conditional_observe.h"
+#include "diagnostics.h"
 #include "global_constants.h"
 
 // Internal paramters of the sensor
 
+// Limits of the adaptive sensing period (seconds), changed at runtime through the sensing_period resource.
+// The period falls to the floor on a change of power of at least POWER_ALERT_DELTA and grows while the power stays
+// within POWER_STABLE_DELTA from one reading to the next.
 #define SENSING_PERIOD 2
+#define SENSING_MAX_PERIOD 16
+#define POWER_ALERT_DELTA 1000
+#define POWER_STABLE_DELTA 100
+
+// Seconds between two saves of the energy counters on flash: at most this much energy is lost on a reset.
+#ifndef ENERGY_PERSIST_PERIOD
+#define ENERGY_PERSIST_PERIOD 900
+#endif
 
 #define NR_SECONDS_DISCONNECTION_ALL_THE_LOADS 5
 #define MAX_SECONDS_COUNTDOWN 5
-#define MAX_TIME_SENDING_SENSING 60
 
 
 PROCESS(smartPowerMeter, "Smart Power Meter");
 
 AUTOSTART_PROCESSES(&smartPowerMeter);
 
-static coap_endpoint_t server_ep;
-static coap_message_t request[1];      /* This way the packet can be treated as pointer as usual. */
-
 
 // Sensor measurements
 
@@ -50,6 +62,8 @@ static float current_produced=0;
 
 //Computed and exposed by the sensor
 extern float instant_power;
+extern sample_batch power_batch;
+extern adaptive_period sensing_period;
 
 // Internal status
 extern bool activated;
@@ -66,6 +80,18 @@ extern coap_resource_t res_power;
 extern coap_resource_t res_obs;
 extern coap_resource_t res_status;
 extern coap_resource_t res_max_power;
+extern coap_resource_t res_memory_pool;
+extern coap_resource_t res_sensing_period;
+extern coap_resource_t res_energy;
+#ifdef DIAGNOSTICS
+extern coap_resource_t res_diagnostics;
+#endif
+
+// Energy counters, defined in res-energy.c
+void energy_restore(void);
+void energy_persist(void);
+void energy_add_sample(float power);
+float energy_net_wh(void);
 
 
 // Global utility variables
@@ -75,58 +101,66 @@ static int nr_loads_attacched=0;
 
 
 
-// Info used to decide if triggering the resource or not.
-static float last_instant_power_send=0;
-static int nr_seconds_passed_last_send=0;
-static bool reg_ok=false;
+// Previous reading, to adapt the sensing period
+static float previous_instant_power=0;
+
+// Uptime (seconds) of the last save of the energy counters
+static unsigned long last_energy_persist=0;
 
 
 /**
- * This function is used as callback method when a msg is received from the COAP_BLOCKING_REQUEST.
+ * This function is used as callback method by the registration client when the answer of the server is received.
  * It contains the code for handling the registration answer and initialize correctly the values of status and MAX_POWER of the smart power meter.
+ * @return true if the registration has been accepted
 */
-void client_reg_handler(coap_message_t *response)
-
+static bool client_reg_handler(coap_message_t *response)
 {
 	if(response == NULL) {
 		puts("Request timed out");
-		return;
+		return false;
 	}
 
-	const char *payload = (char*)response->payload;
-	LOG_DBG("client_reg_handler: Received the payload: %s\nResponse code %d \n", payload,response->code);
+	const uint8_t *payload = NULL;
+	int payload_length = coap_get_payload(response, &payload);
+	LOG_DBG("client_reg_handler: Received the payload: %.*s\nResponse code %d \n", payload_length, (char *)payload, response->code);
 
 	if (response->code != COAP_RESPONSE_CODE_CREATED) {
 		LOG_DBG("Registration failed. Response code: %d\n", response->code);
-		return;
+		return false;
 	}
 
-	// Parse the JSON string into a cJSON object
-	cJSON *json = cJSON_Parse(payload);
-
-
-
-	if (json == NULL) {
+	// Check the JSON in place, without building any object
+	DIAGNOSTICS_BEGIN(DIAGNOSTICS_PARSING);
+	if (!json_tokenizer_is_object((const char *)payload, payload_length)) {
+		DIAGNOSTICS_END(DIAGNOSTICS_PARSING);
 		printf("Error parsing JSON!\n");
-		coap_set_status_code(response, BAD_REQUEST_4_00);
-		return;
+		return false;
 	}
 
 	// Read the field of json and initialize the values consistensly.
-	cJSON *status = cJSON_GetObjectItem(json, "status");
-	if (status!=NULL && cJSON_IsBool(status)) {
-		activated=cJSON_IsTrue(status)?true:false;
+	bool status;
+	if (json_tokenizer_get_bool((const char *)payload, payload_length, "status", &status)) {
+		activated=status;
 		printf("Inizialized status to: %d \n",activated);
 	}
 
-	cJSON *max_power = cJSON_GetObjectItem(json, "max_power");
-	if (max_power!=NULL && (cJSON_IsNumber(max_power))) {
-		printf("Inizialized max power to: %d \n",max_power->valueint);
-		MAX_POWER_ALLOWED=max_power->valueint;
+	int max_power;
+	if (json_tokenizer_get_int((const char *)payload, payload_length, "max_power", &max_power)) {
+		printf("Inizialized max power to: %d \n",max_power);
+		MAX_POWER_ALLOWED=max_power;
 	}
+	DIAGNOSTICS_END(DIAGNOSTICS_PARSING);
+
+	return true;
+}
 
-	cJSON_Delete(json);
-	reg_ok=true;
+
+/**
+ * Called by the registration client once the server has accepted the smart power meter: the status received is
+ * applied by the next sensing.
+ */
+static void registration_completed() {
+	LOG_DBG("Registration of House 1 successfully: smart power meter connected to the server ..\n");
 }
 
 
@@ -215,27 +249,55 @@ static void execute_sensing(void *ptr) {
 		//This garantees a correct reading in case of disabled situation.
 		instant_power=0;
 	}
+	DIAGNOSTICS_BEGIN(DIAGNOSTICS_ACTUATOR);
 	change_status_of_actuator();
+	DIAGNOSTICS_END(DIAGNOSTICS_ACTUATOR);
+
+	// The power just read is held until the next reading: the energy of the interval is accounted then.
+	energy_add_sample(instant_power);
+	if (clock_seconds()-last_energy_persist>=ENERGY_PERSIST_PERIOD) {
+		energy_persist();
+		last_energy_persist=clock_seconds();
+	}
+	if (registration_client_is_registered()) {
+		conditional_observe_notify(&res_energy, energy_net_wh(), false);
+	}
 	
-	// Condition that generates triggering of the power resource:
-	// the new measure of instant power differs from the last sent one at least by 1kW
-	// or the number of seconds passes from the last sending is greater the 60 seconds (MAX_TIME_SENDING_SENSING).
-	nr_seconds_passed_last_send+=SENSING_PERIOD;
-
-	if ((abs(last_instant_power_send-instant_power))>=1000 || nr_seconds_passed_last_send>=MAX_TIME_SENDING_SENSING) {
-		res_obs.trigger();
-		last_instant_power_send=instant_power;
-		nr_seconds_passed_last_send=0;
+	// Every reading is kept until the next notification, that carries all of them.
+	bool batch_full=sample_batch_add(&power_batch,(uint32_t)clock_seconds(),instant_power);
+
+	// Each observer of the power resource is notified when its own condition fires: the attributes (pmin, pmax, st,
+	// gt, lt) of its registration or, without them, the default rule of res-power.c (the power differs from the last
+	// one sent at least by 1kW, 60 seconds passed since the last sending, or the batch of readings is full).
+	// Until the registration completes nobody observes it: the readings stay queued in the batch, that keeps the
+	// most recent ones.
+	if (registration_client_is_registered()) {
+		conditional_observe_notify(&res_obs, instant_power, batch_full);
+	}
+	// The observers are notified synchronously, each from its own cursor: the readings received by all of them
+	// can be dropped.
+	uint32_t consumed;
+	if (conditional_observe_min_cursor(&res_obs, &consumed)) {
+		sample_batch_discard_before(&power_batch, consumed);
 	}
 
 	// This is the case where a local black-out happens due to the over usage of the power provided.
 	if (max_power_consumption_achieved) {
-		reset_sensor_values(&current_consumed,&current_produced,&power_factor,&instant_power,&nr_seconds_passed_last_send,&last_instant_power_send,MAX_POWER_ALLOWED);
+		reset_sensor_values(&current_consumed,&current_produced,&power_factor,&instant_power);
+		// No energy flows until the sensing restarts
+		energy_add_sample(instant_power);
 
 	} else {
-		// If the max power is not achieved restart the timer associated to the sensing activity.
-		ctimer_set(&ctimer_sensing, SENSING_PERIOD*CLOCK_SECOND, execute_sensing, NULL);
+		// If the max power is not achieved restart the timer associated to the sensing activity,
+		// sooner when the power is changing and later when it is steady.
+		float delta=fabsf(instant_power-previous_instant_power);
+		adaptive_period_signal signal=delta>=POWER_ALERT_DELTA ? ADAPTIVE_PERIOD_ALERT :
+			(delta<=POWER_STABLE_DELTA ? ADAPTIVE_PERIOD_STABLE : ADAPTIVE_PERIOD_HOLD);
+		uint16_t period=adaptive_period_update(&sensing_period, signal);
+		LOG_DBG("Next sensing in %u s\n", period);
+		ctimer_set(&ctimer_sensing, period*CLOCK_SECOND, execute_sensing, NULL);
 	}
+	previous_instant_power=instant_power;
 }
 
 
@@ -255,7 +317,8 @@ static void count_down_restart_sensor(void *ptr) {
 		leds_on(LEDS_ALL);
 		max_power_consumption_achieved=false;
 		current_produced=random_value_generation(MIN_AMPERE_PRODUCTED,MAX_AMPERE_PRODUCTED);
-		ctimer_set(&ctimer_sensing, SENSING_PERIOD*CLOCK_SECOND, execute_sensing, NULL);
+		adaptive_period_reset(&sensing_period);
+		ctimer_set(&ctimer_sensing, sensing_period.period*CLOCK_SECOND, execute_sensing, NULL);
 	}
 }
 
@@ -265,51 +328,38 @@ PROCESS_THREAD(smartPowerMeter, ev, data) {
 
 	PROCESS_BEGIN();
 
+	// cJSON allocates only from the static pool
+	json_pool_init();
+
+	// The simulated measurements repeat run after run when built with SIMULATION_SEED
+	math_utilities_seed_node();
 	initialize_sensor_values(&voltage,&current_consumed,&current_produced,&power_factor,&MAX_AMPERE_CONSUMABLE,MAX_POWER_ALLOWED);
+	sample_batch_init(&power_batch,POWER_BATCH_SIZE);
+	adaptive_period_init(&sensing_period,SENSING_PERIOD,SENSING_MAX_PERIOD);
+	energy_restore();
+#ifdef DIAGNOSTICS
+	diagnostics_init();
+#endif
 	
 	// Activation of a resource
 	coap_activate_resource(&res_power, "power");
 	coap_activate_resource(&res_obs, "power_obs");
 	coap_activate_resource(&res_status, "status");
 	coap_activate_resource(&res_max_power, "max_power");
+	coap_activate_resource(&res_memory_pool, "memory_pool");
+	coap_activate_resource(&res_sensing_period, "sensing_period");
+	coap_activate_resource(&res_energy, "energy");
+#ifdef DIAGNOSTICS
+	coap_activate_resource(&res_diagnostics, "diagnostics");
+#endif
 
-	// BEFORE ACTUALLY STARTING
-	// register smart power meter or get the max_power/status from the application in the cloud. "Acting as client"
-	static int current_attempts=0;
-
-	while (true) {
-
-		LOG_DBG("Try to register house 1 attempt: %d \n",current_attempts+1);
-		coap_endpoint_parse(SERVER_REG_EP, strlen(SERVER_REG_EP), &server_ep);
-
-		/* prepare request, TID is set by COAP_BLOCKING_REQUEST() */
-		coap_init_message(request, COAP_TYPE_CON, COAP_POST, 0);
-		coap_set_header_uri_path(request, SERVICE_REG_URL);
-
-		// Create payload info.
-		char *json_payload=NULL;
-		create_msg_registration(&json_payload);
-
-		if (json_payload!=NULL) {
-
-			coap_set_header_accept(request, APPLICATION_JSON);
-			coap_set_payload(request, (uint8_t *)json_payload, strlen(json_payload));
-			COAP_BLOCKING_REQUEST(&server_ep, request, client_reg_handler);
-
-			current_attempts+=1;
-			LOG_DBG("Received positive registration message from Server \n");
-			
-			if (reg_ok) {
-				LOG_DBG("Registration of House 1 successfully: smart power meter starts working ..\n");
-				break;
-			}
-			//free(json_payload);
-		}
-	}
-
-	current_attempts=0;
+	// The sensing starts at once: until the registration completes the meter works in degraded mode, with the
+	// default status and MAX_POWER, and the readings are queued in the power batch.
+	ctimer_set(&ctimer_sensing, sensing_period.period*CLOCK_SECOND, execute_sensing, NULL);
 
-	ctimer_set(&ctimer_sensing, SENSING_PERIOD*CLOCK_SECOND, execute_sensing, NULL);
+	// Register smart power meter or get the max_power/status from the application in the cloud. "Acting as client"
+	// The attempts go on in background, with exponential backoff.
+	registration_client_start(create_msg_registration, client_reg_handler, registration_completed);
 
 	while(1) {
 
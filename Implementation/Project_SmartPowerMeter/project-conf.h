@@ -2,12 +2,17 @@
 
 #define LOG_LEVEL_APP LOG_LEVEL_DBG
 
+// Energest tracks the time in each power state for the diagnostics resource
+#ifdef DIAGNOSTICS
+#define ENERGEST_CONF_ON 1
+#endif
+
 
 
 // Set the max response payload before enable fragmentation:
 
 #undef REST_MAX_CHUNK_SIZE
-#define REST_MAX_CHUNK_SIZE    110 //64
+#define REST_MAX_CHUNK_SIZE    256 //110, raised to fit a batch of POWER_BATCH_SIZE readings
 
 // Set the maximum number of CoAP concurrent transactions:
 
@@ -21,4 +26,4 @@
 #define UIP_CONF_MAX_ROUTES   10
 
 #undef UIP_CONF_BUFFER_SIZE
-#define UIP_CONF_BUFFER_SIZE    240
+#define UIP_CONF_BUFFER_SIZE    380 //240
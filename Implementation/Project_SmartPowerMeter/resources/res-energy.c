@@ -0,0 +1,193 @@
+#include "contiki.h"
+#include "coap-engine.h"
+#include "cfs/cfs.h"
+
+#include <stdio.h>
+
+#include "senml-json.h"
+#include "energy_meter.h"
+#include "json_tokenizer.h"
+#include "conditional_observe.h"
+
+/* Log configuration */
+#include "sys/log.h"
+#define LOG_MODULE "App"
+#define LOG_LEVEL LOG_LEVEL_APP
+
+
+// The counters are saved alternately in two files, so that a write interrupted by a reset leaves the previous copy
+static const char *slot_files[2] = {"energy0.dat", "energy1.dat"};
+
+static const char *import_names[ENERGY_METER_NR_TARIFFS] = {"imp_F1", "imp_F2", "imp_F3"};
+static const char *export_names[ENERGY_METER_NR_TARIFFS] = {"exp_F1", "exp_F2", "exp_F3"};
+
+
+// Energy imported and exported by the house, integrated by the sensing
+energy_meter energy;
+
+// Seconds to add to the uptime to get the time of the day, set by the server (the uptime is used until then)
+static uint32_t time_of_day_offset=0;
+static uint32_t persist_sequence=0;
+
+// Without conditional attributes the observers receive the counters once per hour.
+static const observe_condition energy_obs_defaults = {
+	.attributes = OBSERVE_CONDITION_PMIN,
+	.pmin = 3600
+};
+
+
+static void res_event_handler(void);
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+/* Energy counters of the house for billing: GET (observable) returns the Wh imported and exported in each tariff window as a SenML pack. The values are whole Wh, not multiplied by 100 as in the other resources, so that counters growing for years stay exact. PUT {"time_of_day":s} gives the seconds since midnight, to select the tariff windows. */
+EVENT_RESOURCE(res_energy,
+         "title=\"energy\"; GET|PUT; rt=\"Energy\"; ct=\"senml+json\";obs",
+         res_get_handler,
+         NULL,
+         res_put_handler,
+         NULL,
+         res_event_handler);
+
+
+/**
+ * @return The tariff in force now
+ */
+static int current_tariff(void){
+	return energy_meter_tariff_of((uint32_t)clock_seconds()+time_of_day_offset);
+}
+
+
+/**
+ * Accounts for a reading of the sensing in the counters.
+ * @param power The active power (W), negative when the house exports
+ */
+void energy_add_sample(float power){
+	energy_meter_add_sample(&energy, power, (uint32_t)clock_time(), current_tariff());
+}
+
+
+/**
+ * @return Energy imported minus energy exported in all the tariffs (Wh), the value checked by the conditional attributes
+ */
+float energy_net_wh(void){
+
+	float net=0;
+
+	for (int i=0; i<ENERGY_METER_NR_TARIFFS; i++){
+		net+=(float)energy_meter_get_wh(&energy, &energy.counters.imported[i]);
+		net-=(float)energy_meter_get_wh(&energy, &energy.counters.exported[i]);
+	}
+	return net;
+}
+
+
+/**
+ * Saves the counters on flash, in the slot not holding the last copy.
+ */
+void energy_persist(void){
+
+	energy_meter_record record;
+	const char *file=slot_files[(persist_sequence+1)&1];
+	int fd;
+
+	energy_meter_to_record(&energy, persist_sequence+1, &record);
+
+	cfs_remove(file);
+	fd=cfs_open(file, CFS_WRITE);
+	if (fd<0) {
+		LOG_DBG("Cannot open %s\n", file);
+		return;
+	}
+	if (cfs_write(fd, &record, sizeof(record))==sizeof(record)) {
+		persist_sequence++;
+	}
+	cfs_close(fd);
+}
+
+
+/**
+ * Restores at boot the newest valid copy of the counters, if any: otherwise they start from zero.
+ */
+void energy_restore(void){
+
+	energy_meter_record records[2];
+	const energy_meter_record *read[2]={NULL, NULL};
+
+	energy_meter_init(&energy, CLOCK_SECOND);
+
+	for (int slot=0; slot<2; slot++){
+		int fd=cfs_open(slot_files[slot], CFS_READ);
+
+		if (fd<0) {
+			continue;
+		}
+		if (cfs_read(fd, &records[slot], sizeof(records[slot]))==sizeof(records[slot])) {
+			read[slot]=&records[slot];
+		}
+		cfs_close(fd);
+	}
+	persist_sequence=energy_meter_restore_newest(&energy, read, 2);
+	LOG_DBG("Energy counters restored from save %lu\n", (unsigned long)persist_sequence);
+}
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	char base_name[BASE_NAME_MAX_LEN];
+	int length;
+
+	if (!conditional_observe_register(&res_energy, request, &energy_obs_defaults, energy_net_wh())){
+		coap_set_status_code(response, BAD_REQUEST_4_00);
+		return;
+	}
+
+	create_base_name_attribute(base_name);
+	length=snprintf((char *)buffer, preferred_size, "{\"bn\":\"%s\",\"bu\":\"Wh\",\"ver\":1,\"e\":[", base_name);
+
+	for (int i=0; i<2*ENERGY_METER_NR_TARIFFS && length<preferred_size; i++){
+		int tariff=i%ENERGY_METER_NR_TARIFFS;
+		bool import=i<ENERGY_METER_NR_TARIFFS;
+		const uint64_t *counter=import ? &energy.counters.imported[tariff] : &energy.counters.exported[tariff];
+
+		length+=snprintf((char *)buffer+length, preferred_size-length, "%s{\"n\":\"%s\",\"v\":%lu}", i>0 ? "," : "",
+			import ? import_names[tariff] : export_names[tariff], (unsigned long)energy_meter_get_wh(&energy, counter));
+	}
+	if (length<preferred_size) {
+		length+=snprintf((char *)buffer+length, preferred_size-length, "]}");
+	}
+
+	if (length>=preferred_size){
+		LOG_DBG("The energy payload does not fit in %u bytes\n", preferred_size);
+		coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+		return;
+	}
+
+	coap_set_header_content_format(response, APPLICATION_JSON);
+	coap_set_payload(response, buffer, length);
+}
+
+
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	const uint8_t *payload = NULL;
+	int payload_length = coap_get_payload(request, &payload);
+	int time_of_day;
+
+	if (!json_tokenizer_is_object((const char *)payload, payload_length) ||
+		!json_tokenizer_get_int((const char *)payload, payload_length, "time_of_day", &time_of_day) ||
+		time_of_day<0 || time_of_day>=24*3600) {
+		coap_set_status_code(response, BAD_REQUEST_4_00);
+		return;
+	}
+
+	// The offset wraps around with the uptime: only the time modulo one day matters
+	time_of_day_offset=(uint32_t)time_of_day-(uint32_t)clock_seconds()%(24*3600)+24*3600;
+	coap_set_status_code(response, CHANGED_2_04);
+}
+
+
+static void res_event_handler(void)
+{
+	coap_notify_observers(&res_energy);
+}
@@ -1,6 +1,6 @@
 #include "coap-engine.h"
 #include "smart_power_meter_utilities.h"
-#include "cJSON.h" 
+#include "json_tokenizer.h"
 
 
 /* Log configuration */
@@ -28,34 +28,28 @@ RESOURCE(res_max_power,
         
 static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
 
-  	const char *payload = (char*)request->payload;
+  	const uint8_t *payload = NULL;
+  	int payload_length = coap_get_payload(request, &payload);
   	
-  	LOG_DBG("res_put_handler: Received the payload: %s\n", payload);
+  	LOG_DBG("res_put_handler: Received the payload: %.*s\n", payload_length, (char *)payload);
   	
-  	// Parse the JSON string into a cJSON object
-  	cJSON *json = cJSON_Parse(payload);
-    	
-	if (json == NULL) {
+  	// Check the JSON in place, without building any object
+	if (!json_tokenizer_is_object((const char *)payload, payload_length)) {
 		printf("Error parsing JSON!\n");
 		coap_set_status_code(response, BAD_REQUEST_4_00);
 		return;
 	}
 	
-	cJSON *max_power = cJSON_GetObjectItem(json, "max_power");
+	int max_power;
 
 	// Assign new value of Max_Power and recompute the value of the maximum ampere consumable.
-	if (max_power!=NULL && cJSON_IsNumber(max_power)){
-		MAX_POWER_ALLOWED=max_power->valueint;
+	if (json_tokenizer_get_int((const char *)payload, payload_length, "max_power", &max_power)){
+		MAX_POWER_ALLOWED=max_power;
 		MAX_AMPERE_CONSUMABLE=compute_max_ampere_consumable(MAX_POWER_ALLOWED,MIN_VOLTAGE_PROVIDED,MIN_POWER_FACTOR);
 		coap_set_status_code(response, CHANGED_2_04);
 	}
 	else{
 		coap_set_status_code(response, BAD_REQUEST_4_00);
 	}
-	
-	if (json != NULL) {
-		cJSON_Delete(json);
-	}
 
 }
-
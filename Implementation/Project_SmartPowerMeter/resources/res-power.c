@@ -1,5 +1,10 @@
+#include "contiki.h"
 #include "coap-engine.h"
 #include "senml-json.h"
+#include "sample_batch.h"
+#include "conditional_observe.h"
+#include "crc32.h"
+#include "diagnostics.h"
 
 /* Log configuration */
 #include "sys/log.h"
@@ -10,12 +15,24 @@
 
 float instant_power=0;
 
+// Readings not yet notified to all the observers of power_obs, filled by the sensing activity.
+sample_batch power_batch;
+
+// Notification rule of the observers of power_obs that give no conditional attribute: a change of 1kW from the last
+// power sent or 60 seconds without notifications (a full batch is notified too).
+static const observe_condition power_obs_defaults = {
+	.attributes = OBSERVE_CONDITION_STEP | OBSERVE_CONDITION_PMAX,
+	.pmax = 60,
+	.step = 1000
+};
+
 
 static senml_payload payload;
-static senml_measurement measurements[1];
+static senml_measurement measurements[SAMPLE_BATCH_MAX_SIZE];
 
 static void res_event_handler(void);
 static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+static void res_obs_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
 
 
 
@@ -30,12 +47,31 @@ RESOURCE(res_power,
          
 EVENT_RESOURCE(res_obs,
          "title=\"power_obs\" GET \";rt=\"Power\"; ct=\"senml+json\";obs",
-         res_get_handler,
+         res_obs_get_handler,
          NULL,
          NULL,
          NULL, 
 	 res_event_handler);
 
+static void send_payload(coap_message_t *response, uint8_t *buffer, uint16_t preferred_size){
+
+  DIAGNOSTICS_BEGIN(DIAGNOSTICS_ENCODING);
+  int length = write_senml_payload(&payload,(char *)buffer,preferred_size);
+  DIAGNOSTICS_END(DIAGNOSTICS_ENCODING);
+  if (length==SENML_BUFFER_OVERFLOW){
+  	LOG_DBG("The power payload does not fit in %u bytes\n", preferred_size);
+  	coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+  	return;
+  }
+  
+  // The ETag changes with the readings sent, whatever their length
+  uint32_t etag = crc32_update(0, buffer, length);
+  coap_set_header_etag(response, (uint8_t *)&etag, sizeof(etag));
+  coap_set_header_content_format(response, APPLICATION_JSON);
+  coap_set_payload(response, buffer, length);
+}
+
+
 static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
 
  
@@ -43,9 +79,6 @@ static void res_get_handler(coap_message_t *request, coap_message_t *response, u
   //counter++;
   //printf("NUMERO DI COUNTER : %d \n",counter);
   
-  char *string_payload=NULL;
-  int length =0;
-  
   measurements[0].name="power";
   measurements[0].unit=NULL;
   measurements[0].time=0;
@@ -57,22 +90,38 @@ static void res_get_handler(coap_message_t *request, coap_message_t *response, u
   payload.nr_measurments=1;
   payload.measurements=measurements;
  
- 
-  create_senml_payload(&payload,&string_payload);
-  length = strlen(string_payload);
-  
-  
-  memcpy(buffer, string_payload, length);
+  send_payload(response, buffer, preferred_size);
+}
 
-  
-  coap_set_header_etag(response, (uint8_t *)&length, 1);
-  coap_set_header_content_format(response, APPLICATION_JSON);
-  coap_set_payload(response, buffer, length);
-  
-   if (string_payload != NULL) {
-        	free(string_payload);
-        	string_payload = NULL;
-   }
+
+/**
+ * The notifications carry all the readings collected since the previous notification of the same observer, as a SenML
+ * pack with relative times: every observer has its own cursor in the batch, so the observers notified at different
+ * times (pmin, pmax, st...) each receive every reading. The sensing activity drops the readings received by all of them.
+ * The observers can ask for their own notification rule in the query of the registration, e.g. power_obs?pmin=30&st=500.
+ */
+static void res_obs_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+  if (!conditional_observe_register(&res_obs, request, &power_obs_defaults, instant_power)){
+  	coap_set_status_code(response, BAD_REQUEST_4_00);
+  	return;
+  }
+
+  // A plain GET gets all the readings held
+  uint32_t *cursor=conditional_observe_cursor(&res_obs, request);
+  uint32_t since=(cursor!=NULL) ? *cursor : power_batch.first_sequence;
+
+  if (sample_batch_to_senml_since(&power_batch, since, (uint32_t)clock_seconds(), "power", measurements, &payload)==0){
+  	res_get_handler(request, response, buffer, preferred_size, offset);
+  }
+  else {
+  	payload.base_unit="W";
+  	send_payload(response, buffer, preferred_size);
+  }
+
+  if (cursor!=NULL && response->code<BAD_REQUEST_4_00){
+  	*cursor=sample_batch_end(&power_batch);
+  }
 }
 
 
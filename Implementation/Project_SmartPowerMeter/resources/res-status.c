@@ -1,5 +1,7 @@
 #include "coap-engine.h"
-#include "cJSON.h" 
+#include "json_tokenizer.h"
+
+#include <stdio.h>
 
 
 /* Log configuration */
@@ -26,49 +28,29 @@ RESOURCE(res_status,
         
 static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
 
-  	const char *payload = (char*)request->payload;
+  	const uint8_t *payload = NULL;
+  	int payload_length = coap_get_payload(request, &payload);
   	
-  	LOG_DBG("res_put_handler: Received the payload: %s\n", payload);
+  	LOG_DBG("res_put_handler: Received the payload: %.*s\n", payload_length, (char *)payload);
   	
-  	// Parse the JSON string into a cJSON object
-  	cJSON *json = cJSON_Parse(payload);
-    	
-	if (json == NULL) {
+  	// Check the JSON in place, without building any object
+	if (!json_tokenizer_is_object((const char *)payload, payload_length)) {
 		printf("Error parsing JSON!\n");
 		coap_set_status_code(response, BAD_REQUEST_4_00);
 		return;
 	}
 	
-	// Read all the common attributes and populate the data structure
-	cJSON *status = cJSON_GetObjectItem(json, "status");
+	json_token status;
 	
 	bool previousStatus=activated;
 
-	if (status!=NULL){
-		activated=cJSON_IsTrue(status);
+	if (json_tokenizer_find((const char *)payload, payload_length, "status", &status)){
+		activated=(status.type==JSON_TOKEN_BOOL && status.start[0]=='t');
 		coap_set_status_code(response, CHANGED_2_04);
 	}
 	
-	// Create a new JSON object to include the previous state
-    	cJSON *response_json = cJSON_CreateObject();
-    	cJSON_AddBoolToObject(response_json, "previous_status", previousStatus);  // Include previous state in response
-
-    	// Convert the JSON object to a string
-    	char *json_response = cJSON_PrintUnformatted(response_json);
-
-    	// Set the response payload
-    	coap_set_payload(response, json_response, strlen(json_response));
+	// Include previous state in response
+	int length=snprintf((char *)buffer, preferred_size, "{\"previous_status\":%s}", previousStatus?"true":"false");
 
-    	// Free memory
-    	if (json!=NULL){
-    		cJSON_Delete(json);
-    	}
-    	if (response_json!=NULL){
-    		cJSON_Delete(response_json);
-    	}
-    	if (json_response!=NULL){
-    		free(json_response);
-    	}
-	
+	coap_set_payload(response, buffer, length);
 }
-
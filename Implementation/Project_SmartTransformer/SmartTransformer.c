@@ -1,10 +1,10 @@
 #include "contiki.h"
 
 #include "coap-engine.h"
-#include "coap-blocking-api.h"
 
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
 #include "sys/etimer.h"
 #include "sys/ctimer.h"
@@ -17,24 +17,75 @@
 
 #include "math_utilities.h"
 #include "smart_transformer_utilities.h"
+#if defined(FAULT_DETECTION_MODEL_Q8)
+#include "smart_transformer_fault_detection_q8.h"
+#elif defined(FAULT_DETECTION_MODEL_SPARSE)
+#include "smart_transformer_fault_detection_sparse.h"
+#else
 #include "smart_transformer_fault_detection.h"
+#ifdef FAULT_DETECTION_ACTIVATIONS
+#include "eml_net_fast_activations.h"
+#endif
+#endif
+#include "smart_transformer_fault_detection_tree.h"
+#include "quantized_net.h"
+#include "inference_cache.h"
+#include "sliding_window.h"
+#include "adaptive_period.h"
 #include "printing_floats.h"
 
-#include "cJSON.h"
+#include "json_tokenizer.h"
+#include "json_pool.h"
+#include "registration_client.h"
+#include "conditional_observe.h"
+#include "command_queue.h"
+#include "diagnostics.h"
 #include "global_constants.h"
 
 
 // Internal paramters of the sensor
 
+// Limits of the adaptive sensing period (seconds), changed at runtime through the sensing_period resource.
 #define SENSING_PERIOD 2
+#define SENSING_MAX_PERIOD 16
 #define MAX_SECONDS_TOLLERABLE_FAULT_4 10
-#define MAX_ATTEMPTS 3
 #define MAX_SECONDS_COUNTDOWN 5
 
+// Inference skipping: tolerance band of each measurement around the last classified sample, and number of ticks
+// after which the classifier runs anyway (tunable at runtime through the fault_detection_stats resource).
+#define CACHE_TOLERANCE_CURRENT 1.0
+#define CACHE_TOLERANCE_VOLTAGE 0.05
+#define CACHE_MAX_SKIPS 10
+
+// Sliding window of the last samples: the classifier is fed the mean of each measurement over the window.
+// A sample farther than the maximum step from the window mean (e.g. a fault or an external change of the values)
+// restarts the window, so an abrupt change is classified immediately instead of being averaged out.
+#define WINDOW_SIZE 5
+#define WINDOW_MAX_STEP_CURRENT 10.0
+#define WINDOW_MAX_STEP_VOLTAGE 0.1
+
+// Channels of the window: the six measurements followed by the zero-sequence current Ia+Ib+Ic
+#define WINDOW_CHANNEL_ZERO_SEQUENCE 6
+#define WINDOW_NR_CHANNELS 7
+
+// Thresholds of the classifier confidence (CASCADE_CONFIDENCE_THRESHOLD, ADAPTIVE_*): smart_transformer_utilities.h
+
 
 // Resources exposed
 extern coap_resource_t res_transformer_state_obs;
 extern coap_resource_t res_transformer_settings;
+extern coap_resource_t res_fault_detection_stats;
+extern coap_resource_t res_transformer_model;
+extern coap_resource_t res_memory_pool;
+extern coap_resource_t res_grid_commands;
+extern coap_resource_t res_sensing_period;
+#ifdef DIAGNOSTICS
+extern coap_resource_t res_diagnostics;
+#endif
+
+// Model received over the air (NULL if the compiled-in model is used)
+extern const quantized_net *ota_model;
+void transformer_model_restore(void);
 
 
 
@@ -50,6 +101,14 @@ extern coap_resource_t res_transformer_settings;
 
 #endif
 
+// Smart power meters of the houses supplied by the transformer, all disconnected when a fault of type 4 persists
+// (a comma separated list of endpoints, up to COMMAND_QUEUE_MAX_TARGETS).
+#ifndef HOUSE_EPS
+#define HOUSE_EPS SERVER_EP
+#endif
+
+static const char *const house_endpoints[]={HOUSE_EPS};
+#define NR_HOUSES ((int)(sizeof(house_endpoints)/sizeof(house_endpoints[0])))
 
 char *service_url="/status";
 
@@ -63,14 +122,14 @@ AUTOSTART_PROCESSES(&smartTransformer);
 // Timers
 
 static struct ctimer ctimer_sensing;
-static struct etimer et;
+static struct ctimer ctimer_reconfiguration;
 static int nr_of_seconds_fault_4=0;
 
 static int seconds_passed_countdown=0;
 
-static coap_endpoint_t server_ep;
-static coap_message_t request[1];      /* This way the packet can be treated as pointer as usual. */
-
+static sliding_window measurement_window;
+extern adaptive_period sensing_period;
+static int previous_class=-1;
 
 
 //Smart transformer sensor measurments used inside the resource
@@ -82,12 +141,18 @@ extern float Vb;
 extern float Vc;
 extern int type_of_fault;
 
+// Counters of the path taken by the fault classifier
+extern unsigned long nr_of_tree_predictions;
+extern unsigned long nr_of_nn_predictions;
+extern inference_cache fault_detection_cache;
 
-// Info used to decide if triggering the resource or not.
-static int coap_request_pending = 0;
-static bool previous_house_status=true;
-static bool house_status_changed=false;
-static bool reg_ok=false;
+
+// State of the disconnection of the grid: status of each house before it and houses to re-activate after it.
+static bool previous_house_status[NR_HOUSES];
+static bool houses_to_reconnect[NR_HOUSES];
+static bool reconfiguring=false;
+
+static void disconnect_houses();
 
 
 
@@ -98,56 +163,69 @@ static bool reg_ok=false;
 
 
 /**
- * This function is used as callback method when a msg is received from the COAP_BLOCKING_REQUEST.
- * It contains the code for handling the registration answer and initialize correctly the values of status and MAX_POWER of the smart power meter.
+ * This function is used as callback method by the registration client when the answer of the server is received.
+ * @return true if the registration has been accepted
 */
-void client_reg_handler(coap_message_t *response)
+static bool client_reg_handler(coap_message_t *response)
 {
 	if(response == NULL) {
 		puts("Request timed out");
-		return;
+		return false;
 	}
 	const char *payload = (char*)response->payload;
 	LOG_DBG("client_reg_handler: Received the payload: %s\nResponse code %d \n", payload,response->code);
 
 	if (response->code != COAP_RESPONSE_CODE_CREATED) {
 		LOG_DBG("Registration failed. Response code: %d\n", response->code);
-		return;
+		return false;
 	}
-	reg_ok=true;
+	return true;
 }
 
 
-/* This function is will be passed to COAP_BLOCKING_REQUEST() to handle responses. */
-void client_chunk_handler(coap_message_t *response)
+/**
+ * Called by the registration client once the server has accepted the smart transformer: the state classified in
+ * degraded mode is published at once.
+ */
+static void registration_completed() {
+	LOG_DBG("Registration of Smart Transformer 1 successfully: smart transformer connected to the server ..\n");
+	res_transformer_state_obs.trigger();
+}
+
+
+/**
+ * This function is passed to the command queue to handle the answer of a house to a change of status.
+ * @param house The index of the house in house_endpoints
+ * @return true if the house has executed the command
+ */
+static bool house_status_handler(int house, coap_message_t *response)
 {
 	const uint8_t *chunk;
 	if(response == NULL) {
-		puts("Request timed out");
-		return;
+		printf("Request to house %d timed out\n", house+1);
+		return false;
 	}
 
 	int len = coap_get_payload(response, &chunk);
-	const char *payload = (char*)request->payload;
-	LOG_DBG("client_chunk_handler: Received the payload: %s\n", payload);
+	LOG_DBG("client_chunk_handler: Received the payload: %.*s\n", len, (char *)chunk);
 
-	// Parse the JSON string into a cJSON object
-	cJSON *json = cJSON_Parse(payload);
-	if (json == NULL) {
+	// Check the JSON in place, without building any object
+	DIAGNOSTICS_BEGIN(DIAGNOSTICS_PARSING);
+	if (!json_tokenizer_is_object((const char *)chunk, len)) {
+		DIAGNOSTICS_END(DIAGNOSTICS_PARSING);
 		printf("Error parsing JSON!\n");
-		coap_set_status_code(response, BAD_REQUEST_4_00);
-		return;
+		return false;
 	}
 
 	// Read all the common attributes and populate the data structure
-	cJSON *status = cJSON_GetObjectItem(json, "previous_status");
-	if (status!=NULL && cJSON_IsBool(status)) {
-		previous_house_status=cJSON_IsTrue(status)?true:false;
+	bool status;
+	if (json_tokenizer_get_bool((const char *)chunk, len, "previous_status", &status)) {
+		previous_house_status[house]=status;
 	}
+	DIAGNOSTICS_END(DIAGNOSTICS_PARSING);
 
-	cJSON_Delete(json);
 	printf("|%.*s", len, (char *)chunk);
-	house_status_changed=true;
+	return true;
 }
 
 
@@ -226,17 +304,14 @@ static void change_status_of_actuator(int predicted_class) {
 
 		if (nr_of_seconds_fault_4>MAX_SECONDS_TOLLERABLE_FAULT_4) {
 
-			// This due to the impossibility to handle here CoAP client request in non-protothreading function.
-			if (coap_request_pending!=1) {
+			// The commands are sent in background: the classification goes on while they are in flight.
+			if (!command_queue_is_busy()) {
 				LOG_DBG("\n\nSTART AUTOMATIC PROCEDURE FOR DISCONNECTION OF THE GRID\n\n");
-				coap_request_pending=1;
-
-				// Force wake-up of the smartTransformer process
-				process_poll(&smartTransformer);
+				disconnect_houses();
 				nr_of_seconds_fault_4=0;
 			}
 		}
-		nr_of_seconds_fault_4+=SENSING_PERIOD;
+		nr_of_seconds_fault_4+=sensing_period.period;
 		break;
 	default:
 		printf("Do nothing!\n");
@@ -244,170 +319,289 @@ static void change_status_of_actuator(int predicted_class) {
 }
 
 
+/**
+ * Two-stage fault classifier: the decision tree answers alone when the confidence of the leaf reached is at least
+ * CASCADE_CONFIDENCE_THRESHOLD, otherwise the (much more expensive) neural network is evaluated: the one received
+ * over the air through the transformer_model resource if any, the compiled-in one otherwise.
+ * @param features The measurements Ia,Ib,Ic,Va,Vb,Vc
+ * @param outputs Filled with the probability of each class (when the tree answers, only the predicted class gets
+ *                its leaf confidence)
+ * @return The predicted class
+ */
+static int predict_fault(float *features, float *outputs) {
+	int predicted_class=decision_tree_predict_proba(&smart_transformer_fault_detection_tree, features, 6, outputs, 5);
+
+	if (predicted_class>=0 && outputs[predicted_class]>=CASCADE_CONFIDENCE_THRESHOLD) {
+		nr_of_tree_predictions++;
+		return predicted_class;
+	}
+
+	nr_of_nn_predictions++;
+	if (ota_model!=NULL) {
+		quantized_net_predict_proba(ota_model, features, 6, outputs, 5);
+		return find_max_index(outputs,5);
+	}
+#if defined(FAULT_DETECTION_MODEL_Q8)
+	quantized_net_predict_proba(&smart_transformer_fault_detection_q8, features, 6, outputs, 5);
+#elif defined(FAULT_DETECTION_MODEL_SPARSE)
+	sparse_net_predict_proba(&smart_transformer_fault_detection_sparse, features, 6, outputs, 5);
+#elif defined(FAULT_DETECTION_ACTIVATIONS)
+	eml_net_fast_predict_proba(&smart_transformer_fault_detection, FAULT_DETECTION_ACTIVATIONS, features, 6, outputs, 5);
+#else
+	eml_net_predict_proba(&smart_transformer_fault_detection, features, 6, outputs, 5);
+#endif
+	return find_max_index(outputs,5);
+}
+
+
+/**
+ * Tells the adaptive sensing period what the last sample says about the transformer.
+ * @param predicted_class The class predicted for the sample
+ * @param confidence The probability of the predicted class
+ * @param step true if the sample restarted the window
+ */
+static adaptive_period_signal sensing_signal(int predicted_class, float confidence, bool step) {
+	bool changed=step || predicted_class!=previous_class || predicted_class!=FAULT_TYPE_0;
+	bool settled=measurement_window.count>=measurement_window.size;
+
+	for (int i=0; settled && i<6; i++) {
+		settled=sqrtf(sliding_window_variance(&measurement_window, i))<=ADAPTIVE_MAX_VOLATILITY*fabsf(sliding_window_mean(&measurement_window, i));
+	}
+	return adaptive_period_classify(changed, confidence, ADAPTIVE_LOW_CONFIDENCE, ADAPTIVE_HIGH_CONFIDENCE, settled);
+}
+
+
 /**
  * This callback function is used to simulate a sensing activity by the sensor.
  * The values of current (Ia,Ib,Ic) and voltage (Va,Vb,Vc) are sampled from the smart transformer by the sensor.
  * Their are passed throught the ML model and then the output is used to let take a decision to the actuator.
+ * The model is fed the mean of the measurements over the sliding window of the last WINDOW_SIZE samples.
  */
 static void execute_sensing(void *ptr) {
 	// Current measurment
 	print_smart_transformer_sensing_measurement(Ia,Ib,Ic,Va,Vb,Vc);
 	
-	// ML task: features and output vector
-	float features[] = {Ia,Ib,Ic,Va,Vb,Vc};
+	// Window update: O(1) per sample, no allocation
+	static const float max_steps[WINDOW_NR_CHANNELS] = {WINDOW_MAX_STEP_CURRENT, WINDOW_MAX_STEP_CURRENT, WINDOW_MAX_STEP_CURRENT,
+		WINDOW_MAX_STEP_VOLTAGE, WINDOW_MAX_STEP_VOLTAGE, WINDOW_MAX_STEP_VOLTAGE, WINDOW_MAX_STEP_CURRENT};
+	float sample[WINDOW_NR_CHANNELS] = {Ia,Ib,Ic,Va,Vb,Vc,Ia+Ib+Ic};
+
+	bool step=sliding_window_is_step(&measurement_window, sample, max_steps);
+	if (step) {
+		LOG_DBG("Step change of the measurements: window restarted\n");
+		sliding_window_reset(&measurement_window);
+	}
+	sliding_window_push(&measurement_window, sample);
+	print_smart_transformer_window_statistics(measurement_window.count,
+		sliding_window_mean(&measurement_window, WINDOW_CHANNEL_ZERO_SEQUENCE),
+		sqrtf(sliding_window_variance(&measurement_window, 0)),
+		sqrtf(sliding_window_variance(&measurement_window, 1)),
+		sqrtf(sliding_window_variance(&measurement_window, 2)));
+
+	// ML task: features (window means of Ia..Vc) and output vector
+	float features[6];
 	float outputs[5] = {0, 0, 0, 0, 0};
 	int predicted_class=-1;
 
+	for (int i=0; i<6; i++) {
+		features[i]=sliding_window_mean(&measurement_window, i);
+	}
 
-	eml_net_predict_proba(&smart_transformer_fault_detection, features, 6, outputs, 5);
-	predicted_class=find_max_index(outputs,5);
+	if (!inference_cache_lookup(&fault_detection_cache, features, outputs, &predicted_class)) {
+		DIAGNOSTICS_BEGIN(DIAGNOSTICS_INFERENCE);
+		predicted_class=predict_fault(features,outputs);
+		DIAGNOSTICS_END(DIAGNOSTICS_INFERENCE);
+		inference_cache_store(&fault_detection_cache, features, outputs, predicted_class);
+	}
 	print_probabilities(outputs,predicted_class);
-	res_transformer_state_obs.trigger();
-
-	change_status_of_actuator(predicted_class);
+	LOG_DBG("Fault classifier paths: tree %lu, neural network %lu, skipped %lu\n", nr_of_tree_predictions, nr_of_nn_predictions, fault_detection_cache.hits);
+	// Nobody can observe the state before the registration: the last one is published when it completes.
+	// Each observer is notified when its own condition on the state fires (by default at every sample).
+	if (registration_client_is_registered()) {
+		conditional_observe_notify(&res_transformer_state_obs, type_of_fault, false);
+	}
 
-	if (coap_request_pending!=1) {
-		ctimer_set(&ctimer_sensing, SENSING_PERIOD*CLOCK_SECOND, execute_sensing, NULL);
+	// During the reconfiguration the actuator is held in safety mode, the classification goes on.
+	if (!reconfiguring) {
+		DIAGNOSTICS_BEGIN(DIAGNOSTICS_ACTUATOR);
+		change_status_of_actuator(predicted_class);
+		DIAGNOSTICS_END(DIAGNOSTICS_ACTUATOR);
 	}
+
+	// Next sample: sooner when a fault may be developing, later when the transformer is steady
+	uint16_t period=adaptive_period_update(&sensing_period, sensing_signal(predicted_class, outputs[predicted_class], step));
+	previous_class=predicted_class;
+	LOG_DBG("Next sensing in %u s\n", period);
+	ctimer_set(&ctimer_sensing, period*CLOCK_SECOND, execute_sensing, NULL);
 }
 
 /**
  * The aim of this function is to initialize in the proper range the starting values detected by the sensor.
  */
 static void initialize_sensor_values() {
+	static const float tolerances[] = {CACHE_TOLERANCE_CURRENT, CACHE_TOLERANCE_CURRENT, CACHE_TOLERANCE_CURRENT,
+		CACHE_TOLERANCE_VOLTAGE, CACHE_TOLERANCE_VOLTAGE, CACHE_TOLERANCE_VOLTAGE};
+
 	generate_initial_transformer_values(&Ia, &Ib, &Ic, &Va, &Vb, &Vc);
+	inference_cache_init(&fault_detection_cache, 6, 5, tolerances, CACHE_MAX_SKIPS);
+	sliding_window_init(&measurement_window, WINDOW_NR_CHANNELS, WINDOW_SIZE);
 }
 
 
-PROCESS_THREAD(smartTransformer, ev, data) {
+/**
+ * Sends the new status to the selected houses through the command queue.
+ * @param status The status to set
+ * @param houses The houses addressed (NR_HOUSES flags), NULL for all of them
+ * @param on_done Called when all the houses have answered or failed
+ * @return true if the command has been queued
+ */
+static bool send_house_command(bool status, const bool *houses, command_done_callback on_done) {
 
-	PROCESS_BEGIN();
+	char *json_payload=NULL;
+	create_msg_house_change_state(&json_payload,status);
+	if (json_payload==NULL) {
+		json_pool_reset();
+		return false;
+	}
 
+	// The queue keeps its own copy of the payload
+	bool queued=command_queue_send(service_url, json_payload, houses, house_status_handler, on_done);
+	json_pool_free(json_payload);
+	unsigned int leaked=json_pool_reset();
+	if (leaked>0) {
+		LOG_WARN("%u JSON blocks not freed by the house command\n", leaked);
+	}
+	return queued;
+}
+
+
+/**
+ * Called by the command queue when the houses have been re-activated.
+ */
+static void reconnection_completed(int nr_succeeded, int nr_failed) {
+	LOG_DBG("Houses re-activated: %d, not answering: %d \n", nr_succeeded, nr_failed);
+}
+
+
+/**
+ * This callback function counts down the reconfiguration of the smart transformer in a safety mode, then re-activates
+ * the houses that were active before the disconnection.
+ */
+static void count_down_reconfiguration(void *ptr) {
+
+	seconds_passed_countdown++;
+	if (seconds_passed_countdown<MAX_SECONDS_COUNTDOWN) {
+		ctimer_set(&ctimer_reconfiguration, CLOCK_SECOND, count_down_reconfiguration, NULL);
+		return;
+	}
+
+	leds_off(LEDS_ALL);
+	seconds_passed_countdown=0;
+	reconfiguring=false;
+	LOG_DBG("Reconfiguration successfully! \n");
+
+	bool any_house=false;
+	for (int i=0; i<NR_HOUSES; i++) {
+		any_house|=houses_to_reconnect[i];
+	}
+
+	if (!any_house) {
+		LOG_DBG("The Houses should stay disabled like their previous state! State become consistent!\n");
+		return;
+	}
+	if (!send_house_command(true, houses_to_reconnect, reconnection_completed)) {
+		printf("Re-activation of the houses not sent!\n");
+	}
+}
+
+
+/**
+ * Called by the command queue when all the houses have answered to the disconnection or failed: if at least one has
+ * been disconnected the smart transformer is reconfigured in a safety mode.
+ */
+static void disconnection_completed(int nr_succeeded, int nr_failed) {
+
+	LOG_DBG("Houses disconnected: %d, not answering: %d \n", nr_succeeded, nr_failed);
+	if (nr_succeeded==0) {
+		return;
+	}
+
+	// Only the houses disconnected now and active before are re-activated
+	for (int i=0; i<NR_HOUSES; i++) {
+		houses_to_reconnect[i]=command_queue_get_stats(i)->outcome==COMMAND_TARGET_SUCCEEDED && previous_house_status[i];
+	}
+
+	LOG_DBG("Reconfiguration of the smart trnasformer in a safety mode! \n");
 	initialize_sensor_values();
-	printf("%p\n",eml_net_activation_function_strs);
+	leds_on(LEDS_ALL);
+	reconfiguring=true;
+	seconds_passed_countdown=0;
+	ctimer_set(&ctimer_reconfiguration, CLOCK_SECOND, count_down_reconfiguration, NULL);
+}
 
-	coap_activate_resource(&res_transformer_state_obs, "transformer_state_obs");
-	coap_activate_resource(&res_transformer_settings,"transformer_settings");
 
-	// BEFORE ACTUALLY STARTING
-	// register smart transformer on the database in the cloud. "Acting as client"
-	static int current_attempts=0;
+/**
+ * Starts the disconnection of all the houses supplied by the smart transformer.
+ */
+static void disconnect_houses() {
 
-	while (true) {
+	if (reconfiguring) {
+		return;
+	}
+	for (int i=0; i<NR_HOUSES; i++) {
+		previous_house_status[i]=true;
+	}
+	if (!send_house_command(false, NULL, disconnection_completed)) {
+		printf("Disconnection of the houses not sent!\n");
+	}
+}
 
-		LOG_DBG("Try to register smart transformer attempt: %d \n",current_attempts+1);
-		coap_endpoint_parse(SERVER_REG_EP, strlen(SERVER_REG_EP), &server_ep);
 
-		/* prepare request, TID is set by COAP_BLOCKING_REQUEST() */
-		coap_init_message(request, COAP_TYPE_CON, COAP_POST, 0);
-		coap_set_header_uri_path(request, SERVICE_REG_URL);
+PROCESS_THREAD(smartTransformer, ev, data) {
 
-		// Create payload info.
-		char *json_payload=NULL;
-		create_msg_registration_st(&json_payload);
+	PROCESS_BEGIN();
 
-		if (json_payload!=NULL) {
-			coap_set_header_accept(request, APPLICATION_JSON);
-			coap_set_payload(request, (uint8_t *)json_payload, strlen(json_payload));
-			
-			COAP_BLOCKING_REQUEST(&server_ep, request, client_reg_handler);
+	// cJSON allocates only from the static pool
+	json_pool_init();
 
-			current_attempts+=1;
-			LOG_DBG("Received positive registration message from Server \n");
+	// The simulated measurements repeat run after run when built with SIMULATION_SEED
+	math_utilities_seed_node();
+	initialize_sensor_values();
+	adaptive_period_init(&sensing_period, SENSING_PERIOD, SENSING_MAX_PERIOD);
+	transformer_model_restore();
+#ifdef DIAGNOSTICS
+	diagnostics_init();
+#endif
+#if !defined(FAULT_DETECTION_MODEL_Q8) && !defined(FAULT_DETECTION_MODEL_SPARSE)
+	printf("%p\n",eml_net_activation_function_strs);
+#endif
 
-			if (reg_ok) {
-				LOG_DBG("Registration of Smart Transformer 1 successfully: Smart Transformer starts working ..\n");
-				break;
-			}
-			//free(json_payload);
-		}
+	coap_activate_resource(&res_transformer_state_obs, "transformer_state_obs");
+	coap_activate_resource(&res_transformer_settings,"transformer_settings");
+	coap_activate_resource(&res_fault_detection_stats,"fault_detection_stats");
+	coap_activate_resource(&res_transformer_model,"transformer_model");
+	coap_activate_resource(&res_memory_pool,"memory_pool");
+	coap_activate_resource(&res_grid_commands,"grid_commands");
+	coap_activate_resource(&res_sensing_period,"sensing_period");
+#ifdef DIAGNOSTICS
+	coap_activate_resource(&res_diagnostics,"diagnostics");
+#endif
+
+	if (command_queue_init(house_endpoints, NR_HOUSES)<0) {
+		printf("Invalid endpoints of the houses!\n");
 	}
 
-	current_attempts=0;
+	// The sensing (and the local protection) starts at once: until the registration completes the transformer works
+	// in degraded mode, its state is only kept to be published later.
+	ctimer_set(&ctimer_sensing, sensing_period.period*CLOCK_SECOND, execute_sensing, NULL);
+
+	// Register smart transformer on the database in the cloud. "Acting as client"
+	// The attempts go on in background, with exponential backoff.
+	registration_client_start(create_msg_registration_st, client_reg_handler, registration_completed);
 
-	// Starting the sensing timer
-	ctimer_set(&ctimer_sensing, SENSING_PERIOD*CLOCK_SECOND, execute_sensing, NULL);
 	while(1) {
 
 		PROCESS_YIELD();
-		// Handling the special case of disconnecting part of the grid.
-		if(coap_request_pending==1) {
-			while (current_attempts<MAX_ATTEMPTS) {
-				LOG_DBG("Try to disconnect house 1 attempt: %d \n",current_attempts+1);
-				coap_endpoint_parse(SERVER_EP, strlen(SERVER_EP), &server_ep);
-				
-				/* prepare request, TID is set by COAP_BLOCKING_REQUEST() */
-				coap_init_message(request, COAP_TYPE_CON, COAP_PUT, 0);
-				coap_set_header_uri_path(request, service_url);
-				// Create payload info.
-
-				char *json_payload=NULL;
-				create_msg_house_change_state(&json_payload,false);
-				if (json_payload!=NULL) {
-					coap_set_payload(request, (uint8_t *)json_payload, strlen(json_payload));
-					COAP_BLOCKING_REQUEST(&server_ep, request, client_chunk_handler);
-					current_attempts++;
-					if (house_status_changed) {
-						LOG_DBG("Received positive message from House 1 \n");
-						break;
-					}
-					//free(json_payload);
-				}
-			}
-			current_attempts=0;
-			if (house_status_changed) {
-				house_status_changed=false;
-				LOG_DBG("Reconfiguration of the smart trnasformer in a safety mode! \n");
-				initialize_sensor_values();
-				leds_on(LEDS_ALL);
-				
-				while (seconds_passed_countdown<MAX_SECONDS_COUNTDOWN) {
-					seconds_passed_countdown++;
-					etimer_set(&et, CLOCK_SECOND);
-					PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&et));
-					etimer_reset(&et);
-				}
-				
-				leds_off(LEDS_ALL);
-				seconds_passed_countdown=0;
-				LOG_DBG("Reconfiguration successfully! \n");
-
-				if (previous_house_status) {
-					//Re-activate the house smart meter.
-					while (current_attempts<MAX_ATTEMPTS) {
-						LOG_DBG("Try to reconnect House_1 attempt: %d \n",current_attempts+1);
-						coap_endpoint_parse(SERVER_EP, strlen(SERVER_EP), &server_ep);
-
-						/* prepare request, TID is set by COAP_BLOCKING_REQUEST() */
-						coap_init_message(request, COAP_TYPE_CON, COAP_PUT, 0);
-						coap_set_header_uri_path(request, service_url);
-
-						// Create payload info.
-						char *json_payload=NULL;
-						create_msg_house_change_state(&json_payload,true);
-						
-						if (json_payload!=NULL) {
-							coap_set_payload(request, (uint8_t *)json_payload, strlen(json_payload));
-							COAP_BLOCKING_REQUEST(&server_ep, request, client_chunk_handler);
-							current_attempts++;
-							if (house_status_changed) {
-								break;
-							}
-							free(json_payload);
-						}
-					}
-					if (house_status_changed) {
-						LOG_DBG("Received positive message from House_1: re-activated! \n");
-					}
-				}
-				else {
-					LOG_DBG("The House should stay disabled like its previous state! State become consistent!\n");
-				}
-			}
-
-			coap_request_pending=0;
-			ctimer_set(&ctimer_sensing, SENSING_PERIOD*CLOCK_SECOND, execute_sensing, NULL);
-		}
 
 		// Handling button pressing: simulation of generation of faults.
 
@@ -425,7 +619,8 @@ PROCESS_THREAD(smartTransformer, ev, data) {
 			
 			// Simulation of unexpected event
 			generate_transformer_fault(type_of_fault, &Ia, &Ib, &Ic, &Va, &Vb, &Vc);
-			ctimer_set(&ctimer_sensing, SENSING_PERIOD*CLOCK_SECOND, execute_sensing, NULL);
+			adaptive_period_reset(&sensing_period);
+			ctimer_set(&ctimer_sensing, sensing_period.period*CLOCK_SECOND, execute_sensing, NULL);
 		}
 	}
 
@@ -0,0 +1,67 @@
+#include <eml_net.h>
+
+#include "fast_activations.h"
+
+/*
+ * Forward pass of an emlearn network (same weights and buffers as eml_net_predict_proba) where tanh and softmax
+ * are evaluated by the selected backend of fast_activations instead of libm.
+ * Only the activations used by the exported models are supported (tanh, softmax, identity).
+ */
+
+
+/**
+ * Computes the class probabilities of an emlearn network.
+ * @param net The network exported by emlearn
+ * @param backend The implementation of tanh and exp
+ * @param features The input vector (n_features)
+ * @param n_features Number of features, must match the input layer
+ * @param outputs Filled with the outputs of the last layer (n_outputs)
+ * @param n_outputs Number of outputs, must match the last layer
+ * @return 0 on success, -1 if the sizes do not match or an activation is not supported
+ */
+static int eml_net_fast_predict_proba(const EmlNet *net, fast_activations_backend backend, const float *features, int n_features, float *outputs, int n_outputs){
+
+	const float *in=features;
+	float *out=net->activations1;
+
+	if (n_features!=net->layers[0].n_inputs || n_outputs!=net->layers[net->n_layers-1].n_outputs){
+		return -1;
+	}
+
+	for (int l=0; l<net->n_layers; l++){
+		const EmlNetLayer *layer=&net->layers[l];
+
+		// emlearn stores the weights input-major: weights[i*n_outputs+o]
+		for (int o=0; o<layer->n_outputs; o++){
+			out[o]=layer->biases[o];
+		}
+		for (int i=0; i<layer->n_inputs; i++){
+			const float *row=layer->weights+i*layer->n_outputs;
+
+			for (int o=0; o<layer->n_outputs; o++){
+				out[o]+=row[o]*in[i];
+			}
+		}
+
+		switch (layer->activation){
+			case EmlNetActivationTanh:
+				fast_activations_tanh(backend,out,layer->n_outputs);
+				break;
+			case EmlNetActivationSoftmax:
+				fast_activations_softmax(backend,out,layer->n_outputs);
+				break;
+			case EmlNetActivationIdentity:
+				break;
+			default:
+				return -1;
+		}
+
+		in=out;
+		out=(out==net->activations1)?net->activations2:net->activations1;
+	}
+
+	for (int o=0; o<n_outputs; o++){
+		outputs[o]=in[o];
+	}
+	return 0;
+}
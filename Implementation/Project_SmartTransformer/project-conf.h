@@ -2,6 +2,11 @@
 
 #define LOG_LEVEL_APP LOG_LEVEL_DBG
 
+// Energest tracks the time in each power state for the diagnostics resource
+#ifdef DIAGNOSTICS
+#define ENERGEST_CONF_ON 1
+#endif
+
 // Set the max response payload before enable fragmentation:
 
 #undef REST_MAX_CHUNK_SIZE
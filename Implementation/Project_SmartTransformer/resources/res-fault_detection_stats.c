@@ -0,0 +1,88 @@
+#include "contiki.h"
+#include "coap-engine.h"
+
+#include <stdio.h>
+
+#include "inference_cache.h"
+
+#include "json_tokenizer.h"
+
+/* Log configuration */
+#include "sys/log.h"
+#define LOG_MODULE "App"
+#define LOG_LEVEL LOG_LEVEL_APP
+
+
+// Number of sensing ticks classified by the decision tree alone and of the ones that needed the neural network.
+unsigned long nr_of_tree_predictions;
+unsigned long nr_of_nn_predictions;
+
+// Result of the last classification, reused while the measurements stay inside the tolerance bands.
+inference_cache fault_detection_cache;
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+/* Counters of the fault classifier, used to measure how much inference time (and energy) the decision tree fast path and the skipping of unchanged measurements save on each tick. The PUT allows to tune the tolerance band of each measurement ("ia".."vc") and the maximum number of consecutive skipped inferences ("max_skips").*/
+RESOURCE(res_fault_detection_stats,
+         "title=\"fault_detection_stats\"; GET; PUT; rt=\"Fault_detection_stats\"; ct=\"application/json\";",
+         res_get_handler,
+         NULL,
+         res_put_handler,
+         NULL);
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	int length=snprintf((char *)buffer, preferred_size,
+			"{\"tree\":%lu,\"nn\":%lu,\"cache_hits\":%lu,\"cache_misses\":%lu,\"forced_misses\":%lu,\"max_skips\":%u}",
+			nr_of_tree_predictions, nr_of_nn_predictions,
+			fault_detection_cache.hits, fault_detection_cache.misses, fault_detection_cache.forced_misses,
+			fault_detection_cache.max_skips);
+
+	if (length<0 || length>=preferred_size) {
+		coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+		return;
+	}
+
+	coap_set_header_content_format(response, APPLICATION_JSON);
+	coap_set_payload(response, buffer, length);
+}
+
+
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	// Same order of the features given to the classifier
+	static const char *tolerance_names[] = {"ia", "ib", "ic", "va", "vb", "vc"};
+
+	const uint8_t *payload = NULL;
+	int payload_length = coap_get_payload(request, &payload);
+
+	LOG_DBG("res_put_handler: Received the payload: %.*s\n", payload_length, (char *)payload);
+
+	if (!json_tokenizer_is_object((const char *)payload, payload_length)) {
+		printf("Error parsing JSON!\n");
+		coap_set_status_code(response, BAD_REQUEST_4_00);
+		return;
+	}
+
+	for (int i=0; i<fault_detection_cache.n_features; i++){
+		double tolerance;
+
+		if (json_tokenizer_get_number((const char *)payload, payload_length, tolerance_names[i], &tolerance) && tolerance>=0){
+			fault_detection_cache.tolerances[i]=tolerance;
+		}
+	}
+
+	int max_skips;
+
+	if (json_tokenizer_get_int((const char *)payload, payload_length, "max_skips", &max_skips) && max_skips>=0){
+		fault_detection_cache.max_skips=max_skips;
+	}
+
+	// The next tick is classified with the new bands
+	inference_cache_invalidate(&fault_detection_cache);
+	coap_set_status_code(response, CHANGED_2_04);
+}
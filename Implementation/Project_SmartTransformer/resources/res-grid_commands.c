@@ -0,0 +1,29 @@
+#include "contiki.h"
+#include "coap-engine.h"
+
+#include "command_queue.h"
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+/* Outcome of the last disconnect/reconnect command for each house: state (queued, in flight, succeeded or failed), attempts and latency from the first transmission to the answer. */
+RESOURCE(res_grid_commands,
+         "title=\"grid_commands\"; GET; rt=\"Grid_commands\"; ct=\"application/json\";",
+         res_get_handler,
+         NULL,
+         NULL,
+         NULL);
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	int length=command_queue_write_stats((char *)buffer, preferred_size);
+
+	if (length<0) {
+		coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+		return;
+	}
+
+	coap_set_header_content_format(response, APPLICATION_JSON);
+	coap_set_payload(response, buffer, length);
+}
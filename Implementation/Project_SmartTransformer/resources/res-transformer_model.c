@@ -0,0 +1,251 @@
+#include "contiki.h"
+#include "coap-engine.h"
+#include "cfs/cfs.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "model_blob.h"
+#include "inference_cache.h"
+
+/* Log configuration */
+#include "sys/log.h"
+#define LOG_MODULE "App"
+#define LOG_LEVEL LOG_LEVEL_APP
+
+
+// RAM where the network received over the air is built (30KB for the current 6-64-384-5 int8 model)
+#ifndef MODEL_ARENA_SIZE
+#define MODEL_ARENA_SIZE 32768
+#endif
+
+// Largest block accepted: bigger blocks would not fit in the uIP buffer, the client is asked to use this size
+#define MODEL_BLOCK_SIZE 256
+
+// The blob is written in the slot not in use, the marker file records the slot to load at boot
+#define MODEL_MARKER_FILE "model.act"
+#define MODEL_NO_SLOT 0xFF
+
+static const char *slot_files[2] = {"model0.blob", "model1.blob"};
+
+
+// Network received over the air, NULL while the compiled-in model is used
+const quantized_net *ota_model=NULL;
+uint32_t ota_model_version=0;
+
+extern inference_cache fault_detection_cache;
+
+static uint64_t model_arena[MODEL_ARENA_SIZE/sizeof(uint64_t)];
+static uint8_t active_slot=MODEL_NO_SLOT;
+
+// State of the block-wise transfer in progress
+static int transfer_fd=-1;
+static uint32_t transfer_offset;
+static uint32_t transfer_length;
+static uint8_t transfer_slot;
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+/* This resource allows to replace the fault detection model without reflashing the sensor. The PUT carries a model blob (see model_blob.h, produced by Project_HostTools/model_blob_tool) with block-wise transfer (Block1): the blob is stored on flash through CFS and the sensing switches to it only after its checksum and layers have been verified, otherwise the model in use is kept.*/
+RESOURCE(res_transformer_model,
+         "title=\"transformer_model\"; GET; PUT; rt=\"Fault_detection_model\"; ct=\"application/octet-stream\";",
+         res_get_handler,
+         NULL,
+         res_put_handler,
+         NULL);
+
+
+static int cfs_blob_read(void *ctx, void *buffer, int length){
+	return cfs_read(*(int *)ctx, buffer, length);
+}
+
+
+/**
+ * Verifies the blob stored in a slot and, only if it is valid, makes it the model used by the sensing.
+ * Contiki processes are not preemptive, so execute_sensing() sees either the old or the new model, never a model
+ * half loaded; if the load itself fails the compiled-in model is used.
+ * @param slot The slot to activate
+ * @return One of the MODEL_BLOB_* codes
+ */
+static int activate_slot(uint8_t slot){
+
+	const quantized_net *net=NULL;
+	model_blob_header header;
+	size_t arena_size;
+	int fd=cfs_open(slot_files[slot], CFS_READ);
+	int ret;
+
+	if (fd<0) {
+		return MODEL_BLOB_ERR_READ;
+	}
+
+	ret=model_blob_verify(cfs_blob_read, &fd, &header, &arena_size);
+	if (ret==MODEL_BLOB_OK && arena_size>sizeof(model_arena)) {
+		ret=MODEL_BLOB_ERR_SIZE;
+	}
+
+	if (ret==MODEL_BLOB_OK) {
+		// The arena is about to be overwritten: from now on the old network is not valid anymore
+		ota_model=NULL;
+		cfs_seek(fd, 0, CFS_SEEK_SET);
+		ret=model_blob_load(cfs_blob_read, &fd, model_arena, sizeof(model_arena), &net, &header);
+		if (ret==MODEL_BLOB_OK) {
+			ota_model=net;
+			ota_model_version=header.model_version;
+			active_slot=slot;
+			inference_cache_invalidate(&fault_detection_cache);
+		}
+		else {
+			ota_model_version=0;
+			active_slot=MODEL_NO_SLOT;
+		}
+	}
+
+	cfs_close(fd);
+	return ret;
+}
+
+
+/**
+ * Loads at boot the last model received over the air, if any. The compiled-in model is used otherwise.
+ */
+void transformer_model_restore(void){
+
+	uint8_t slot=MODEL_NO_SLOT;
+	int fd=cfs_open(MODEL_MARKER_FILE, CFS_READ);
+
+	if (fd<0) {
+		return;
+	}
+	if (cfs_read(fd, &slot, 1)==1 && slot<2) {
+		int ret=activate_slot(slot);
+
+		LOG_DBG("Model of slot %u restored: %d (version %lu)\n", slot, ret, (unsigned long)ota_model_version);
+	}
+	cfs_close(fd);
+}
+
+
+static void save_active_slot(void){
+
+	int fd=cfs_open(MODEL_MARKER_FILE, CFS_WRITE);
+
+	if (fd>=0) {
+		cfs_write(fd, &active_slot, 1);
+		cfs_close(fd);
+	}
+}
+
+
+static void abort_transfer(void){
+	if (transfer_fd>=0) {
+		cfs_close(transfer_fd);
+		transfer_fd=-1;
+	}
+}
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	int length=snprintf((char *)buffer, preferred_size, "{\"version\":%lu,\"source\":\"%s\"}",
+			(unsigned long)ota_model_version, (ota_model!=NULL)?"ota":"builtin");
+
+	coap_set_header_content_format(response, APPLICATION_JSON);
+	coap_set_payload(response, buffer, length);
+}
+
+
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	const uint8_t *payload;
+	int length=coap_get_payload(request, &payload);
+	uint32_t num=0, block_offset=0;
+	uint8_t more=0;
+	uint16_t size=0;
+	model_blob_header header;
+	int ret;
+
+	// A blob smaller than a block may arrive without Block1 option
+	if (!coap_get_header_block1(request, &num, &more, &size, &block_offset)) {
+		num=0;
+		more=0;
+		size=MODEL_BLOCK_SIZE;
+		block_offset=0;
+	}
+
+	if (block_offset==0) {
+		// A new transfer replaces any transfer left incomplete
+		abort_transfer();
+
+		if (length<MODEL_BLOB_HEADER_SIZE || model_blob_parse_header(payload, &header)!=MODEL_BLOB_OK) {
+			coap_set_status_code(response, BAD_REQUEST_4_00);
+			return;
+		}
+		transfer_length=MODEL_BLOB_HEADER_SIZE+header.body_length;
+		if (header.body_length>sizeof(model_arena)) {
+			coap_set_status_code(response, REQUEST_ENTITY_TOO_LARGE_4_13);
+			return;
+		}
+
+		transfer_slot=(active_slot==0)?1:0;
+		cfs_remove(slot_files[transfer_slot]);
+		transfer_fd=cfs_open(slot_files[transfer_slot], CFS_WRITE);
+		if (transfer_fd<0) {
+			coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+			return;
+		}
+		transfer_offset=0;
+		LOG_DBG("Receiving model version %lu (%lu bytes) in slot %u\n", (unsigned long)header.model_version, (unsigned long)transfer_length, transfer_slot);
+	}
+
+	if (transfer_fd<0 || block_offset!=transfer_offset || transfer_offset+length>transfer_length) {
+		abort_transfer();
+		coap_set_status_code(response, REQUEST_ENTITY_INCOMPLETE_4_08);
+		return;
+	}
+
+	if (cfs_write(transfer_fd, payload, length)!=length) {
+		abort_transfer();
+		coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+		return;
+	}
+	transfer_offset+=length;
+
+	// Ask the client to continue with blocks that fit in our buffers
+	if (size>MODEL_BLOCK_SIZE) {
+		num=transfer_offset/MODEL_BLOCK_SIZE-1;
+		size=MODEL_BLOCK_SIZE;
+	}
+
+	if (more) {
+		coap_set_header_block1(response, num, 1, size);
+		coap_set_status_code(response, CONTINUE_2_31);
+		return;
+	}
+
+	abort_transfer();
+	if (transfer_offset!=transfer_length) {
+		coap_set_status_code(response, REQUEST_ENTITY_INCOMPLETE_4_08);
+		return;
+	}
+
+	ret=activate_slot(transfer_slot);
+	LOG_DBG("Activation of the model in slot %u: %d\n", transfer_slot, ret);
+
+	coap_set_header_block1(response, num, 0, size);
+	switch (ret) {
+		case MODEL_BLOB_OK:
+			save_active_slot();
+			coap_set_status_code(response, CHANGED_2_04);
+			break;
+		case MODEL_BLOB_ERR_SIZE:
+			coap_set_status_code(response, REQUEST_ENTITY_TOO_LARGE_4_13);
+			break;
+		default:
+			// Rejected by the verification: the model in use did not change
+			coap_set_status_code(response, BAD_REQUEST_4_00);
+	}
+}
@@ -7,7 +7,10 @@
 #include "senml-json.h"
 #include "printing_floats.h"
 
-#include "cJSON.h" 
+#include "json_tokenizer.h"
+#include "conditional_observe.h"
+#include "diagnostics.h"
+#include "crc32.h"
 
 /* Log configuration */
 #include "sys/log.h"
@@ -26,8 +29,21 @@ float Vc;
 int type_of_fault;
 
 
+#define NR_STATE_MEASUREMENTS 7
+
+static char *measurement_names[NR_STATE_MEASUREMENTS] = {"state", "current_A", "current_B", "current_C", "voltage_A", "voltage_B", "voltage_C"};
+static char *measurement_units[NR_STATE_MEASUREMENTS] = {"type_fault", "MA", "MA", "MA", "V", "MV", "MV"};
+
 static senml_payload payload;
-static senml_measurement measurements[7];
+static senml_measurement measurements[NR_STATE_MEASUREMENTS];
+
+// JSON skeleton of the state: at each request only the 7 values are formatted
+static senml_template state_template;
+static bool state_template_ready = false;
+static bool state_payload_ready = false;
+
+// Notification rule of the observers that give no conditional attribute: every sample.
+static const observe_condition state_obs_defaults = {0};
 
 static void res_event_handler(void);
 static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
@@ -44,83 +60,91 @@ RESOURCE(res_transformer_settings,
 
         
 EVENT_RESOURCE(res_transformer_state_obs,
-         "title=\"transformer_state_obs\"; GET; rt=\"Transformer_state\"; ct=\"senml+json\"; if=\"Sensor\"; obs",
+         "title=\"transformer_state_obs\"; GET; rt=\"Transformer_state\"; ct=\"senml+json senml+cbor\"; if=\"Sensor\"; obs",
          res_get_handler,
          NULL,
          NULL,
          NULL, 
 	 res_event_handler);
 
+/**
+ * Fills the part of the payload that never changes (names, units, base name) and pre-renders its JSON.
+ * It is done at the first request, as the base name depends on the link-layer address.
+ */
+static void init_state_payload(void){
+
+	for (int i=0; i<NR_STATE_MEASUREMENTS; i++){
+		measurements[i].name=measurement_names[i];
+		measurements[i].unit=measurement_units[i];
+		measurements[i].time=0;
+		measurements[i].type=SENML_TYPE_V;
+		measurements[i].value.float_value=0;
+	}
+
+	payload.base_time=0;
+	payload.base_unit=NULL;
+	payload.nr_measurments=NR_STATE_MEASUREMENTS;
+	payload.measurements=measurements;
+
+	state_template_ready=(create_senml_template(&state_template,&payload)==0);
+	if (!state_template_ready){
+		LOG_DBG("The state template does not fit in %d bytes\n", SENML_TEMPLATE_MAX_LEN);
+	}
+	state_payload_ready=true;
+}
+
 static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
 
-	  char *string_payload=NULL;
 	  int length =0;
+	  // JSON unless asked otherwise: the notifications carry the Accept option of the registration of their observer
+	  unsigned int accept = APPLICATION_JSON;
+	  coap_get_header_accept(request, &accept);
 	  
-	  //senml_payload *payload= (senml_payload*) malloc (sizeof(senml_payload));
-	  //senml_measurement measurements[7];
-	  
-	  measurements[0].name="state";
-	  measurements[0].unit="type_fault";
-	  measurements[0].time=0;
-	  measurements[0].type=SENML_TYPE_V;
-	  measurements[0].value.float_value=type_of_fault;
-	  
-	  measurements[1].name="current_A";
-	  measurements[1].unit="MA";
-	  measurements[1].time=0;
-	  measurements[1].type=SENML_TYPE_V;
-	  measurements[1].value.float_value=Ia;
-	  
-	  measurements[2].name="current_B";
-	  measurements[2].unit="MA";
-	  measurements[2].time=0;
-	  measurements[2].type=SENML_TYPE_V;
-	  measurements[2].value.float_value=Ib;
+	  // Checked before the registration, so that an observer is only recorded with a format it can be sent
+	  if (accept!=APPLICATION_JSON && accept!=SENML_CBOR_CONTENT_FORMAT){
+	  	coap_set_status_code(response, NOT_ACCEPTABLE_4_06);
+	  	return;
+	  }
+
+	  // The conditional attributes apply to the state, e.g. transformer_state_obs?st=1 to be notified of its changes only
+	  if (!conditional_observe_register(&res_transformer_state_obs, request, &state_obs_defaults, type_of_fault)){
+	  	coap_set_status_code(response, BAD_REQUEST_4_00);
+	  	return;
+	  }
 	  
-	  measurements[3].name="current_C";
-	  measurements[3].unit="MA";
-	  measurements[3].time=0;
-	  measurements[3].type=SENML_TYPE_V;
-	  measurements[3].value.float_value=Ic;
+	  float values[NR_STATE_MEASUREMENTS]={type_of_fault, Ia, Ib, Ic, Va, Vb, Vc};
 	  
-	  measurements[4].name="voltage_A";
-	  measurements[4].unit="V";
-	  measurements[4].time=0;
-	  measurements[4].type=SENML_TYPE_V;
-	  measurements[4].value.float_value=Va;
-	  
-	  measurements[5].name="voltage_B";
-	  measurements[5].unit="MV";
-	  measurements[5].time=0;
-	  measurements[5].type=SENML_TYPE_V;
-	  measurements[5].value.float_value=Vb;
-	  
-	  measurements[6].name="voltage_C";
-	  measurements[6].unit="MV";
-	  measurements[6].time=0;
-	  measurements[6].type=SENML_TYPE_V;
-	  measurements[6].value.float_value=Vc;
-	  
-	  payload.base_time=0;
-	  payload.base_unit=NULL;
-	  payload.nr_measurments=7;
-	  payload.measurements=measurements;
-	 
-	  create_senml_payload(&payload,&string_payload);
-	  length = strlen(string_payload);
+	  if (!state_payload_ready){
+	  	init_state_payload();
+	  }
 	 
-	  memcpy(buffer, string_payload, length);
+	  DIAGNOSTICS_BEGIN(DIAGNOSTICS_ENCODING);
+	  if (accept==SENML_CBOR_CONTENT_FORMAT){
+	  	for (int i=0; i<NR_STATE_MEASUREMENTS; i++){
+	  		measurements[i].value.float_value=values[i];
+	  	}
+	  	length = write_senml_cbor_payload(&payload,buffer,preferred_size);
+	  }
+	  else if (state_template_ready){
+	  	length = write_senml_template(&state_template,values,(char *)buffer,preferred_size);
+	  }
+	  else {
+	  	length = SENML_BUFFER_OVERFLOW;
+	  }
+	  DIAGNOSTICS_END(DIAGNOSTICS_ENCODING);
+	  if (length==SENML_BUFFER_OVERFLOW){
+	  	LOG_DBG("The state does not fit in %u bytes\n", preferred_size);
+	  	coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+	  	return;
+	  }
 
   	  //LOG_DBG(" Sending the payload: %s\n", buffer);
   	   
-	  coap_set_header_etag(response, (uint8_t *)&length, 1);
-	  coap_set_header_content_format(response, APPLICATION_JSON);
+	  // The ETag changes with the representation sent, whatever its length
+	  uint32_t etag = crc32_update(0, buffer, length);
+	  coap_set_header_etag(response, (uint8_t *)&etag, sizeof(etag));
+	  coap_set_header_content_format(response, accept);
 	  coap_set_payload(response, buffer, length);
-	  
-	  if (string_payload != NULL) {
-        	free(string_payload);
-        	string_payload = NULL;
-    	  }
 }
 
 
@@ -128,65 +152,39 @@ static void res_get_handler(coap_message_t *request, coap_message_t *response, u
 
 static void res_event_handler(void)
 {
-   // Notify all the observers
+   // Notify all the observers, each in the format of its registration
    // Before sending the notification the handler
    // associated with the GET methods is called
-   coap_notify_observers(&res_transformer_state_obs);
+   conditional_observe_notify_all(&res_transformer_state_obs, type_of_fault);
 }
 
 
 static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
 
-  	const char *payload = (char*)request->payload;
+  	const uint8_t *payload = NULL;
+  	int payload_length = coap_get_payload(request, &payload);
   	
-  	LOG_DBG("res_put_handler: Received the payload: %s\n", payload);
+  	LOG_DBG("res_put_handler: Received the payload: %.*s\n", payload_length, (char *)payload);
   	
-  	// Parse the JSON string into a cJSON object
-  	cJSON *json = cJSON_Parse(payload);
-    	
-	if (json == NULL) {
+  	// Check the JSON in place, without building any object
+	if (!json_tokenizer_is_object((const char *)payload, payload_length)) {
 		printf("Error parsing JSON!\n");
 		coap_set_status_code(response, BAD_REQUEST_4_00);
 		return;
 	}
 	
-	cJSON *ia = cJSON_GetObjectItem(json, "ia");
-	cJSON *ib = cJSON_GetObjectItem(json, "ib");
-	cJSON *ic = cJSON_GetObjectItem(json, "ic");
-	
-	cJSON *va = cJSON_GetObjectItem(json, "va");
-	cJSON *vb = cJSON_GetObjectItem(json, "vb");
-	cJSON *vc = cJSON_GetObjectItem(json, "vc");
-	
-	if (ia!=NULL && cJSON_IsNumber(ia)){
-		Ia=Ia+ia->valuedouble;
-	}
-	
-	if (ib!=NULL && cJSON_IsNumber(ib)){
-		Ib=Ib+ib->valuedouble;
-	}
-	
-	if (ic!=NULL && cJSON_IsNumber(ic)){
-		Ic=Ic+ic->valuedouble;
-	}
-	
-	if (va!=NULL && cJSON_IsNumber(va)){
-		Va=Va+va->valuedouble;
-	}
-	
-	if (vb!=NULL && cJSON_IsNumber(vb)){
-		Vb=Vb+vb->valuedouble;
-	}
+	// Variations to apply, in the order of the measurements
+	static const char *variation_names[] = {"ia", "ib", "ic", "va", "vb", "vc"};
+	float *values[] = {&Ia, &Ib, &Ic, &Va, &Vb, &Vc};
 	
-	if (vc!=NULL && cJSON_IsNumber(vc)){
-		Vc=Vc+vc->valuedouble;
+	for (int i=0; i<6; i++){
+		double variation;
+		
+		if (json_tokenizer_get_number((const char *)payload, payload_length, variation_names[i], &variation)){
+			*values[i]=*values[i]+variation;
+		}
 	}
 	
 	coap_set_status_code(response, CHANGED_2_04);
-
-	if (json!=NULL){
-		cJSON_Delete(json);
-	}
-  	
- }
+}
 
@@ -0,0 +1,18 @@
+// Generated by Project_HostTools/quantize_model from smart_transformer_fault_detection.h, do not edit.
+// Calibration set: ../../AI_Model/dataset/training_dataset.csv (3996 rows)
+#include "quantized_net.h"
+static const float smart_transformer_fault_detection_q8_input_scales[6] = { 3.699399e+01f, 3.638647e+01f, 3.635630e+01f, 5.281842e+04f, 5.218716e+04f, 5.349077e+04f };
+static const int32_t smart_transformer_fault_detection_q8_layer_0_biases[64] = { 689210, -1132451, 547563, 74483, -944188, 367139, -608521, -676466, -588286, 704945, 2244118, 1026091, 1105214, 958360, -802277, -407792, -175153, -437720, -714005, 2238848, -1015549, 750186, -553197, -2350651, -828852, 629913, 2435742, -671966, 2169924, 1094353, -1151507, -271226, -533264, 53414, -40614, 655683, 589859, -193340, 408140, 259435, 1195917, 505869, 1001416, 187693, -333499, 2164266, 57503, -2085048, 1080508, -2043646, -181737, 371794, 644642, 1118440, 435943, 717633, -268038, -133382, 67062, 455059, 745091, -1855657, -725303, 2109955 };
+static const int16_t smart_transformer_fault_detection_q8_layer_0_weights[384] = { -21738, 3456, -20080, 4, -7, 2, -21038, -20346, -8617, -19, 36, -6, 26356, -3016, 15200, 23, 22, -20, 6215, -2098, 28362, 26, -6, -4, -24672, 54, 19828, 15, 2, -19, 26953, -13970, 26082, 10, -2, -15, 11928, -6637, -6798, 0, -2, 0, 12809, 12188, -27952, 12, 17, -17, -20502, 22828, -28097, 5, 21, 18, 13916, -10423, -13620, 20, -20, 12, 16583, 17191, 16740, 23, -5, -10, 24442, 25492, 8581, 24, -6, 6, 14670, 15007, 15557, 15, -4, 6, 14073, 9649, 7738, -18, 1, -1, -1766, -1499, -22507, -28, 6, 2, -26510, -26955, -26960, -13, 5, 14, 889, 21761, -26219, -2, -6, 6, -25209, -14543, 29893, -17, 22, 1, 5136, -21107, 17334, 2, -9, -8, -11774, -11454, -11265, 16, 32, -1, 17963, 3158, -17225, -1, 18, 11, 26604, 27854, -9458, 28, 3, 9, -26374, 16313, 5660, 21, -11, 14, -2743, -2440, -2085, 5, 38, 3, 6045, 14238, 8259, -10, 15, 32, -15932, -6917, 16874, -6, -26, 12, -13589, -13801, -13807, 5, 0, -14, -12306, 5340, -1226, -1, -16, 22, 259, -4536, -5156, 12, -23, -10, -6018, 7949, 22454, -11, -10, -1, 5588, -14327, -29706, 6, -9, 4, 13292, -2312, 5191, -17, 12, -12, -20214, -5601, -5973, -10, -2, 6, -8691, 24097, 12131, 18, 18, -3, 21604, -6469, -18808, 9, 10, 14, 15669, 27458, -15102, 25, -5, 11, 21041, 28207, -7898, 19, -19, 3, -4200, -14117, 28154, -1, 6, -18, -1866, -2271, 32767, -3, 1, 1, 15493, -21272, 22961, -13, -3, -9, 5882, -2558, 5406, 33, -21, -10, -1110, -3004, 31231, 15, 7, 15, -1343, -1395, 20235, 11, -14, 7, -5836, -20473, 23014, -5, 21, 6, -7990, 14886, -15774, -5, -4, 14, 1441, -23495, -22855, -5, -12, 13, 487, -16619, -13472, -18, 34, 0, 14172, 13000, 13853, -25, -15, 10, -117, 15365, -3476, 27, -11, 13, 661, -11405, -11390, -4, -20, 11, 20511, -26616, -25685, 13, 7, 6, -13788, -21686, -7759, 10, -5, 13, 21537, -2727, 1757, 16, 15, -6, -6070, 6855, -8675, 14, 0, 3, 27751, -2127, 15908, -11, 6, -22, 11321, -28537, 6284, 3, -8, -24, 6440, -18193, 25867, 7, 2, 10, -10284, 18775, 19766, 12, -9, -12, 19241, 12205, 11574, 7, 14, -4, -13235, 22419, 13891, 1, -15, -8, 5274, -1906, 23145, -1, -1, 3, -5478, -5721, -5027, -19, 38, 7, -12335, 5605, 27742, -11, 1, 3, 22000, 21879, 22151, -8, 20, 13 };
+static const int32_t smart_transformer_fault_detection_q8_layer_1_biases[384] = { 9188, -7365, 3197, -579, 287, -5735, 13113, -6673, 9171, 11775, 10038, -9398, -2619, -3374, -13052, -857, 13734, 11148, -6205, -2324, 15774, -8688, 1657, 756, -5136, -11801, 6196, 12759, 8021, 3173, -3216, 4290, 7258, -7504, 1241, -11981, 4907, 1481, 4574, 1817, -8014, -1290, 11178, 976, -10989, 5152, 2356, -137, 1869, 13630, -10597, 14668, 13208, -4781, 3863, -2500, 653, 14601, 5974, -15349, 426, -1366, -4495, 6066, 3185, 1154, -873, -1025, 6304, -2968, 4730, -979, 1000, -4097, -7218, 3921, 1012, -13356, 15248, 10801, 15927, 62, 5568, -2382, 4462, -70, -4026, 7538, 1779, -3529, 15344, -2852, 942, -2016, -1446, 7401, -4588, -12964, 4205, 11432, 1900, 327, -8407, 13214, 12005, 7867, -12340, -3521, 2468, 11034, 11303, -2893, 2061, -10186, -11078, -13543, -513, -7260, 916, -5798, -7541, -1149, -1869, 8360, 179, -3575, -2245, -997, -5867, 4112, -7054, -1894, 4803, 218, 3339, 8135, 2732, 4366, 1274, -6260, -6439, -643, -6347, -4548, -1869, -12174, 2082, -7685, 4300, 4636, -6584, 11440, 8547, 1746, -8717, 6376, -3095, -13648, -4141, -1799, 2959, -11069, 6287, 9517, -2920, 9193, 148, 8377, 2620, 316, -2887, -471, 1490, -3198, -10027, -3495, -8785, 5516, -10118, -5270, 17035, 11093, 2068, -8927, -3228, 2853, -6046, -5578, -3674, 15994, -3331, -2961, -16348, -1211, 6307, -736, 3464, -5351, -3433, 13395, 7003, 4003, -8472, -14217, 6156, -2629, -3246, 12096, 4362, 5069, 384, -3214, -2635, -2298, -15458, -2626, -138, 506, 4028, -13828, 15104, 4696, -1603, 4781, -3170, 4537, 2069, 1511, 961, 1821, -9151, 3838, 2073, -11164, -15616, 8233, -11301, 16067, -2776, 6224, 9113, 14173, 6959, -7107, -1203, 549, 1619, 2154, 4531, 4065, 5373, -434, -5680, -354, 7904, -4095, -10772, 15171, 10069, -16121, -2764, -440, 7443, -8904, 170, 7185, 3004, 7198, 2290, 9962, -6646, -2761, 5236, -5607, 4461, 3263, -2876, -5818, -13543, -1436, 1579, 3337, -200, -7962, 16627, -3231, 17350, -8143, -10752, -1066, 4354, -6688, 14328, -1086, 12958, -3887, 7394, -2200, 9250, -6696, -627, -11230, -225, 2612, 10342, -12406, 2749, -852, 3759, -3744, 4157, -12032, 7362, 5063, -9249, 15833, 6295, 1539, 12410, 1232, 1209, 5355, 344, -10466, 14385, 3494, -5547, -44, 2709, 1746, 3482, 9634, 12322, 15827, 2711, -237, -2615, 5386, -8182, -13353, -4689, 5267, 3275, 7949, 6367, -1838, 8385, 3204, 2026, -2331, -12794, -2845, -7945, -9065, 6501, 2376, 14083, -12540, -15009, -3043, 4069, -4310, -3676, -2016, -31, -720, 447, -583, 2530, -7133, -1871, -10181, 5251, -7121, -15686, 1559, -12640, 173, -12471, -3822, 2770, -2266, 4614, 9150 };
+static const int8_t smart_transformer_fault_detection_q8_layer_1_weights[24576] = { -1, -22, 13, -4, -17, 1, -15, -31, -3, 15, 46, -5, 29, -6, -22, 2, -7, -20, 12, 25, -14, 26, 9, -34, 20, -8, 37, -5, 9, -3, -26, 4, -25, -5, -8, 9, -15, 18, -9, 19, 9, -13, 2, 1, -9, -5, -45, -24, 31, -40, 16, -19, 13, -28, 0, -1, 9, 3, 5, -27, -5, -13, 5, 28, -6, -26, -7, -8, 17, -19, -14, -26, -9, -13, 20, 17, -17, -13, -28, -14, 6, 10, -2, -17, 17, 6, 18, 16, -23, 11, -8, 19, -9, 9, 12, -6, -8, 19, -16, -9, 22, -27, 27, -12, 21, -39, 21, 9, 21, -8, -7, -4, -10, -16, 13, -14, 21, 0, -22, -12, -30, -12, -14, 13, -14, -6, 10, 17, 16, 30, -6, 2, -5, 20, -28, 16, 21, 7, -28, 10, 0, 4, -14, -81, 25, -16, 6, -40, 22, 20, 25, 43, 23, -8, -42, 17, 12, 22, -4, -25, 25, -27, -5, 23, -6, 12, -6, -20, 24, 1, 22, -27, -19, -18, 19, 13, -8, 22, 10, -13, 11, -9, 5, -13, -24, -12, 1, -9, 18, 31, 20, 3, -12, 18, -16, 22, 24, 8, 29, 22, 12, 3, 39, 16, 20, -6, -23, 86, -15, -15, 25, 6, -13, -10, -23, -7, -5, -26, 7, -7, -9, 16, 3, -21, -13, 18, 26, -13, -12, -16, -24, 9, -7, 18, -18, 9, -15, -24, -5, -30, 12, 13, 6, 2, 9, 19, -15, 7, 7, 11, 31, 4, -22, -12, 7, 26, 6, -31, -23, -14, -21, -16, -18, -18, 23, 6, 10, -11, 33, 11, -2, 55, 3, -5, -11, 7, 11, -9, -9, 11, -2, -5, 24, -8, 13, 24, 1, 9, -1, 12, 7, 3, -18, -7, 18, -15, 4, 5, -22, 26, -15, 5, -11, 3, -3, -5, 2, 21, 8, -5, 14, -11, -15, -5, -21, -23, 3, -22, 12, 21, -17, -3, 10, 24, -22, 7, -22, 11, 19, 10, -19, 0, -7, -10, 24, -56, -8, 11, 1, 21, 11, 9, 18, 12, -28, 18, 46, -8, 30, 11, -10, 9, 9, 28, -3, 19, 10, 23, 18, 3, -28, -8, -7, 0, 5, 1, 34, 8, -29, 29, -10, 14, -9, 23, 9, -24, -22, 12, -11, 14, -12, -17, -7, 30, -17, 16, 20, 11, 31, 9, -22, -7, 20, -22, -19, 13, -15, 14, -44, 33, -7, -21, -4, 10, 17, 18, 18, 21, -2, 2, -32, 1, -35, -12, 18, 6, 15, 18, 17, -14, -23, 4, 14, -14, 11, 50, 4, 23, -11, -59, 9, 20, -3, 63, -15, 11, 3, 14, 3, 16, -8, 23, 0, 26, 9, -5, -6, 0, -10, -13, 10, -7, 3, -28, 12, -4, -24, 22, 11, 11, -16, -27, 33, -36, 9, -13, 5, -18, -26, -11, 1, -29, 9, 19, 35, -14, 9, -18, -5, 25, -24, 4, -2, -5, 24, 12, 20, -26, -5, -27, -23, -9, 3, -10, 16, 19, -6, 2, -18, -15, -8, -21, 25, 21, -16, -18, 4, 7, -18, 17, 11, -3, -22, 23, 19, 10, 16, 5, 2, -2, -16, 29, 30, 18, 7, -15, 25, 24, -23, 19, 2, 12, -4, 3, 2, -14, -1, -16, 31, -4, 46, -21, 35, 13, 15, 4, 0, -22, 6, -10, -4, -13, -10, 32, -34, 30, 11, 42, -1, 15, -18, 11, -4, 13, 13, -5, -21, 20, 16, -28, -11, -5, -17, 9, 13, -27, 21, -25, 0, 7, 21, -4, 23, -11, 5, -23, -11, -20, 15, -20, 10, -6, 11, 24, -8, -5, 19, 6, 12, -15, 45, -8, -23, -8, -32, -18, 6, -32, -4, -10, -15, 25, 26, -20, 25, -19, -25, -5, 10, -20, 24, 1, -45, 6, 34, -16, -4, -38, -18, 20, -13, -31, 6, 8, -5, 17, -17, -12, -11, 7, 12, 30, 24, -21, 21, -13, 10, 8, -27, -25, -52, 12, -4, 18, 16, -10, -16, -9, -15, -11, 3, -20, 3, 26, 19, 26, -45, 4, -4, 19, -27, 25, -23, -28, 18, -22, 19, -29, 7, 17, 2, 6, 18, 21, -5, 1, 23, 47, 12, 15, 17, -18, -8, 13, -13, 11, 8, -7, 21, -7, 22, 20, -15, -7, -12, 9, -18, 19, -10, -18, 17, 18, -13, 22, -14, -23, 5, 27, -16, 7, -28, -14, 30, 36, -11, 2, -3, 14, -16, -14, 44, 3, 33, 1, 14, 14, -23, 13, 7, 14, -2, 34, -6, -1, 27, -4, -13, -15, 9, 2, 3, -22, -34, 68, -5, 6, 3, -23, -10, 33, -17, -13, -23, 24, -10, 16, 10, 12, -18, 4, 26, -24, 18, -1, 10, -26, -14, 17, -5, 11, -5, 13, 7, -89, 8, 29, -18, -10, 7, 15, 2, 34, 7, -16, -29, 16, -1, 3, -12, 6, 20, 11, 7, 18, 12, -23, -13, -21, -20, 12, 18, -18, -21, 12, 18, -23, 0, -30, 2, 3, 22, -11, -17, 15, 26, 25, 22, -14, -3, 33, 13, -12, 15, -12, 21, -8, 7, 16, -23, -8, -5, 4, -9, -21, 21, -18, -12, -16, -12, 25, -8, 31, 22, -27, 5, -26, 8, 21, 6, -22, 34, -15, -9, 14, -9, 8, 1, 8, 17, -26, 18, -14, -9, 9, -14, -11, -16, -9, -16, -44, -22, 23, -4, 3, 11, -15, -22, 12, 20, -5, 17, 14, -16, -27, -19, 8, 17, -7, 23, -1, 5, 17, 10, -8, 19, 7, -9, -37, 20, 0, -35, -53, -21, 20, 15, -22, 24, -12, -6, -20, -22, 13, 21, -5, -18, -14, -33, 5, 1, 7, -17, -12, -7, 9, 28, -17, -2, 43, 11, -18, -27, -41, 18, 8, -28, 19, -25, -8, -6, 0, -16, -9, -17, -1, -14, 7, 36, 17, 23, -24, -28, 15, -22, -7, -17, 24, -23, -6, -21, -18, 18, -5, 18, 18, 2, -9, 7, 5, -16, 14, 4, -9, 9, -9, -11, 8, 51, -22, -13, -15, 24, 23, 5, 17, 9, -3, -17, 16, 8, -12, -19, -6, -11, 19, -9, 34, -2, -4, 19, -22, 7, 18, -22, 20, 22, -23, -16, -29, -21, 23, -2, -32, -13, 16, 17, 28, -8, -8, -1, 0, -23, 12, 16, 24, -23, -31, -39, -9, 42, 76, 2, -26, 19, 61, -1, -12, 26, -8, -31, 17, 115, 23, 18, 0, -1, 23, 5, 5, 3, -22, -5, 21, -14, 3, 22, 19, -11, -13, 23, 1, 34, -34, -15, 31, 22, 10, -10, 6, -7, 5, -20, -15, 4, -16, 10, -10, -8, -13, -17, -4, 31, -11, -18, 26, 29, 20, -7, 28, -40, 20, -2, -6, -8, -5, -22, 19, -25, 19, -16, 22, -4, 14, -26, -24, 23, -4, 15, -32, -20, -13, -23, 15, -14, 21, -17, -6, 1, -14, 22, 41, -36, 16, 8, 51, 51, 27, 11, 22, -1, 2, -1, -27, 8, 27, 20, 17, -6, -6, -22, 9, -28, -26, 6, 13, 24, -17, -16, 16, -1, -19, -10, 9, 39, 3, 31, -14, 13, -15, -8, -21, -4, 42, -14, 7, -18, -35, -14, 6, 61, 16, 4, -2, 6, -18, 16, 38, -14, 5, 8, 4, -10, 28, -19, -8, 14, 2, 21, -1, 14, 10, 0, 8, -7, 21, 21, -6, -18, 17, -22, -8, 5, -8, -2, -12, 23, 47, 15, 5, 1, -3, -10, -16, -26, 31, -20, 23, -3, 8, 10, 13, 15, -93, -12, -21, 9, -3, -15, 4, 10, 3, -16, -9, -37, 10, 13, 17, 6, 12, 18, -12, 20, 0, -24, 19, 7, 7, 21, 14, -12, 15, 21, 20, -9, 14, 5, 8, -15, -19, 4, -18, -15, 1, 5, -20, -16, 1, 26, -11, 0, 6, -20, -26, -10, 10, 4, 13, 22, 21, 1, 22, 35, 31, 54, 25, -17, -62, 9, -1, -1, -49, -6, 29, -14, -23, 45, 3, 21, 27, -28, 23, 11, 11, -2, 4, -23, 7, 7, -24, 33, 17, -10, 15, 16, -20, -18, -35, -27, 30, -1, -31, 10, -41, -15, -12, 25, 7, 19, 22, -4, -9, 32, -3, 25, 28, 14, 19, -4, -10, -17, -5, -11, -17, -2, -15, 5, -19, -40, 11, -1, -73, 12, -23, 17, -12, -2, -3, 4, -4, -32, -2, 11, 13, -4, 9, -15, 23, -10, 25, -24, 6, 17, 3, 15, 2, -9, 36, -18, -1, -28, 1, 43, 6, -2, 25, -10, 29, -6, 17, -20, -18, -25, 3, 14, -22, 22, 3, 9, -25, 11, 0, -9, 13, 3, 0, 13, -18, 6, 20, 43, 14, 24, 18, 3, 113, -2, -22, 25, 41, -16, 25, 17, -46, 10, 18, 0, 6, -4, 26, 5, -12, -4, 14, 17, -6, 16, -17, 11, -19, 5, 27, 9, -22, -12, 14, 21, 20, 15, 10, -23, 28, 3, -2, 24, -17, 25, 17, 5, -6, -13, -8, 4, 32, -9, 0, -14, 13, -8, -7, 17, 5, 4, 23, 5, -30, -32, 7, 36, -55, -11, -18, -20, -27, 26, 5, 14, 43, 27, 3, -24, -12, -14, 7, -6, 9, 10, 11, -13, -16, -20, -4, -10, 11, 24, 1, 13, -11, -4, 12, -20, 9, -3, -19, -2, -11, 24, -10, -2, -20, 15, 21, 3, -6, -15, 18, -10, -47, 18, -6, 9, 14, 14, -16, -13, -1, 0, 19, 2, 18, -13, -24, 27, -52, 25, 18, -6, 0, -24, -5, 5, 20, 4, 23, -15, 11, 16, 20, -28, 20, -16, -8, -3, 11, -1, -16, -5, -13, -15, 30, -26, -17, 5, 16, 2, -20, -29, 8, -26, 26, 14, 7, 10, 6, 7, -15, 2, -13, 4, -15, 15, -14, 2, -20, -24, -30, 6, -26, 13, 23, 4, -19, 35, 2, -18, -2, 45, -34, -4, -10, -2, -2, 9, 25, -4, 0, -27, -29, 15, -26, 12, -26, 9, -17, -4, 18, 4, 18, 5, -6, -15, 19, -17, -44, -39, 1, 24, 8, 19, -22, -12, -11, 21, 6, 2, 14, 24, -21, -29, -34, -3, 19, 12, -2, 2, 5, 20, -13, -1, 1, 18, -16, 23, -15, 17, -2, -24, -15, -46, 6, 44, -47, 16, 16, -10, 9, -9, -21, 13, 0, -29, 21, 35, -3, 13, -12, 22, -5, -5, -8, -8, -13, -16, -13, -31, 19, -14, -1, 14, -12, 3, 19, -9, -13, 1, -12, -15, 6, -10, -27, 18, 28, 7, -32, -5, 8, -11, 35, 17, -19, 36, 19, 15, 0, 17, 1, -20, -22, 7, 8, 47, 9, -4, -24, -31, 14, 18, -23, 2, 20, 12, 24, 18, -39, 32, -11, -33, -9, -3, -17, -13, -28, 5, -6, 9, -20, 3, 21, 8, -26, -29, 13, 2, -2, -19, 19, -35, -42, 30, -39, -5, -7, 13, -11, -12, -7, -12, -2, 5, 7, 0, -13, 6, -17, -31, 16, 4, -17, 2, 28, 21, 12, 18, 23, -21, -21, -21, -3, 9, 48, 2, 18, 17, -2, 17, 26, 19, -2, 18, 13, -27, -6, -15, 27, -6, -9, 20, 10, 15, 10, 13, 8, 16, 4, -24, 10, -27, 7, 5, -3, 3, -4, 26, -41, 2, -31, -13, 5, 0, -27, -12, -14, 20, -29, -1, -18, 7, 5, -20, 27, -20, -8, 19, 27, 22, -9, -5, -8, -7, -1, -20, 22, 13, -75, 4, -10, 7, -8, -7, -6, 11, 27, -4, -23, -9, -9, 13, 6, 4, -17, 16, 21, 3, -3, -18, 24, 0, -24, 7, -24, -24, -24, -23, -23, -16, 15, 7, 28, 19, 22, 24, 22, -11, -11, -23, -20, -3, -19, 6, -6, 16, -4, -15, 0, -24, -12, 15, 21, -22, 23, 9, 20, -21, -19, 8, -6, 10, -80, 1, -13, -15, -4, 24, -31, 10, 10, 0, -17, 39, -10, -17, 18, -14, 0, -13, -5, 12, 22, -19, 11, 17, 5, 14, 3, -18, 9, 29, 6, 12, 24, -6, 22, -26, 5, 15, -23, 1, -26, -22, 11, -14, 8, 8, 10, 9, -41, 3, 28, 14, 12, 18, 28, -9, 21, 4, 7, -51, -19, -26, 16, -4, -44, 0, -6, -24, -42, 4, -6, 11, 35, -22, 5, -46, -9, -3, -3, 19, -11, 22, -7, -5, -15, 7, -21, 14, 20, -4, 20, -27, -14, -7, -9, -4, 25, 23, 21, -1, -17, 23, 21, -26, -7, 9, 8, -10, 15, -5, 3, -12, -34, -1, 33, -21, 25, 9, -6, 9, -14, -24, -7, -25, 14, -17, 2, -23, 0, -24, -9, -20, -49, -8, -11, 10, 37, -4, 0, -49, -13, 2, -8, 6, 22, -24, 3, -21, -24, 19, 23, -10, -6, -9, -8, 17, -13, 20, 3, 1, 6, -20, -8, 20, 1, -1, -24, -12, -5, -27, -13, 5, 1, 15, 4, 8, 4, 16, 22, 15, -5, -27, 0, -26, 19, 24, -4, -10, -19, -5, -15, 5, -48, 6, 6, 4, -5, -9, 15, 5, 22, -23, -13, 15, -5, -12, 17, 13, -17, 4, 19, -26, 24, 17, 22, 12, -2, 14, 17, -31, 9, 13, -28, 40, -19, -1, 2, 20, 26, 8, 22, 5, -2, 15, -5, 7, 16, -20, -3, -5, 1, 14, -26, -22, 14, -14, -3, -15, -20, -27, -12, -4, 5, 31, 14, 5, 34, -3, -28, 5, -9, -8, 18, -4, -29, 11, 19, 43, -8, 9, 21, -6, 15, 16, 24, -16, -4, -8, 3, -14, -11, -3, 30, -28, -12, -15, 20, 7, 27, -8, -9, -15, -7, -9, -4, 0, -7, 2, -23, -12, -18, -2, -19, -7, -3, 29, 24, 19, 18, 14, 19, -1, -18, 1, 22, 5, 24, -22, 24, 19, -20, -47, 17, 33, 6, 25, -28, -5, 19, 1, -4, 4, -2, 21, -33, 44, -4, -9, 4, -9, -32, -6, 32, -32, -10, -11, -21, -18, -2, -16, 18, 10, 6, -32, 75, -16, 26, 8, -13, 18, -1, -8, 6, 3, -13, -27, -5, -11, -13, 18, 23, 21, 10, 7, 19, -7, 10, -2, -11, -33, 1, -31, -15, 32, -97, 6, 1, -20, -6, 12, -36, 27, 32, -32, 25, 25, -4, -21, -28, 1, 14, -20, 8, -2, -15, 8, -8, 19, 17, -9, -10, -21, 27, 19, -3, 30, -19, -6, 23, 15, 11, -17, 27, -1, -11, -15, 15, 14, -15, -27, 12, 20, -7, -7, 16, -20, 19, 18, -3, 1, -24, 2, 8, -19, 26, -3, -2, -25, 50, -7, 17, 8, -22, -19, 5, -13, -2, 0, -24, -7, -6, 0, -20, -6, -4, -9, 10, 18, -7, 16, 21, -21, 19, -24, -18, -12, 14, -3, -11, 3, 14, 11, -5, -24, 17, -8, 2, 2, -9, -26, 5, -3, -16, -6, -13, -8, 1, -24, -22, 18, 15, -17, -13, -12, 25, -24, 13, 25, 25, -6, 5, 17, -120, -9, 13, 23, -17, 2, -20, 11, 5, 30, -1, -13, 12, 6, -8, -30, 15, 23, -5, 14, -17, -10, 10, 4, -17, -5, 1, -22, 5, -17, -29, 4, -13, 28, 13, 23, -5, -17, -24, 19, 4, -5, 7, -10, -18, 19, 19, 5, 0, 29, 20, -8, -4, 8, -28, -2, 6, -22, 3, -5, -15, -15, -10, -2, 103, 26, 7, -20, -4, -21, -11, 23, 10, 1, -2, 69, -22, 11, -20, -19, 12, 25, -13, 24, 0, 25, -17, 25, -14, 19, -12, 17, 1, -18, -20, -12, -11, 25, -5, -18, 17, 0, -12, 2, 16, -9, -1, 7, -3, -24, -6, -12, 11, -15, 20, -5, 8, 9, -3, 23, -22, -25, -8, 12, 11, -19, 8, 13, -31, -17, 4, -11, 11, 21, -25, -9, 13, -26, -7, 5, -5, 31, -10, 35, 20, 6, 10, 1, -27, 21, 21, -23, -2, 2, -10, 3, 18, 19, -4, -7, -19, -31, 35, -6, 7, 15, -17, -12, 13, 6, -9, 12, 15, -2, 22, -19, -9, -4, -10, -16, 3, 19, 21, 11, 25, 18, 24, -7, -25, 4, 26, -4, 15, 7, -11, 1, 1, -12, -11, 17, -9, 3, 3, 28, 11, 32, 11, 3, -4, 17, 29, 8, -15, -22, 0, -24, 13, 23, 30, 13, -27, -25, 9, -2, 10, -23, -7, -24, -10, 18, -23, -4, 8, -20, -19, 18, 28, -27, -33, -11, -21, 21, 6, -3, -21, -9, 10, 9, 9, 15, 5, -19, 11, 40, -10, 23, -17, 17, 14, -14, -3, -10, 35, 8, 14, -18, -2, 68, -4, 1, 17, -7, 10, -28, -11, -8, 19, 1, 16, 40, -7, -4, -32, 47, -9, -16, 31, -15, 9, 17, -29, -16, 27, -16, -7, -25, -19, -15, 0, 28, -24, -39, -14, 4, 0, 10, 23, -27, -9, -19, 1, 8, -4, 14, -12, -10, 18, 22, 2, -29, 49, 25, -7, 12, -9, 22, 27, -6, 5, 30, 18, -18, 6, 5, -2, 2, -2, -21, 24, 17, -19, -18, -24, 1, 14, 11, 15, -11, 26, -15, -11, 18, 18, -15, 4, -13, -25, -11, -1, 6, -11, 2, 1, 4, -24, -11, -5, -17, -13, 12, -2, -6, -33, -28, -18, 16, -18, 3, 19, -41, 1, -32, -21, 6, 125, 20, -10, 2, 20, -18, -24, 1, 23, -26, 6, -7, 22, -16, 10, -16, -17, -1, -20, 23, -27, 3, 5, -12, 11, -20, -19, -29, 7, 14, 17, 25, 5, -16, 14, 23, 8, -21, 9, -19, -14, 10, -3, -9, 1, 17, 19, -31, -19, -30, -5, -24, -19, 19, -2, 26, 10, 24, -14, -15, 7, -25, -18, -22, 21, -12, -4, -11, -36, 19, 5, 12, 29, 5, 8, -41, -15, 0, -17, 23, 1, 18, 9, 4, 23, -20, 3, -5, 3, 26, 27, 18, -7, 30, 3, -23, 36, -2, 21, 1, -23, -8, -23, -5, 26, -3, 19, -1, -21, -8, 2, 10, -53, 5, 4, -26, -12, 18, -6, 27, 15, -10, -7, -12, 7, -26, -25, -22, -100, 18, 2, -5, -32, -12, 18, 22, 24, 1, -18, -34, 16, -7, 18, 20, 11, -9, -18, -20, 21, -5, 1, 2, 3, 24, 13, -27, -13, -8, -18, 3, 29, -3, -4, 14, 19, 0, -10, -7, -9, 5, -6, 3, -13, 9, 9, 4, -23, 3, 14, -19, -6, -21, 23, 8, 10, 1, 0, -8, 9, -50, -12, -8, -121, 19, 8, 2, -39, 14, 3, -26, 64, 29, -7, -12, -3, 2, 0, 9, -14, 12, -5, 0, -20, 20, -21, 19, -4, -17, 3, 9, 9, -11, -22, 4, 10, -18, 3, -2, 10, -7, -8, 1, -4, 5, 22, 7, 9, -1, -5, 8, -12, 7, 5, 17, -21, 4, 5, 26, -22, -22, -9, -19, -23, -26, -12, 4, -65, -11, -2, -23, -57, -7, 16, 3, 53, 2, -5, 15, 21, -2, -6, 14, -23, -21, -11, 24, -25, -8, -6, 1, -5, 20, -21, -14, -26, 17, 6, -28, 44, 25, -12, -17, 4, -27, -25, 16, -23, -18, 7, 23, 3, 14, 8, 10, -46, -24, 2, -6, 32, 30, -16, 3, -27, 0, -25, -5, 8, -17, -17, -29, -19, -27, 14, -5, 12, 1, -3, 15, -1, -22, -14, -24, -22, -22, -9, -32, 6, -12, 18, 10, -25, -12, -3, -6, 16, -11, 47, -15, 31, 13, -55, 21, 32, -15, 30, -30, -17, -6, -17, 14, -25, -18, -8, -18, -11, -11, 14, 21, 6, -12, -14, -14, -24, 14, 23, 13, -12, -16, 20, -35, -3, -4, 20, 5, -32, -15, 10, 6, -1, 21, -21, -1, 14, -32, 16, 5, 28, 20, -23, -23, -27, -17, 30, 23, 10, -11, 12, -2, -4, 23, -3, -38, 22, 4, -9, 11, -22, -16, 31, -33, 6, -18, 18, -12, -16, -13, 17, -21, 33, -12, 18, 17, 12, -11, -23, 3, -13, -23, 0, 8, 25, -3, 9, -42, 25, 15, 16, 0, 48, 6, -6, -6, -40, -6, -14, -27, 21, -8, -20, 5, -23, 49, 24, -22, 13, -3, -37, -26, -6, 9, 2, 11, -9, 1, -16, 6, 13, 26, 19, 48, 14, -16, 15, 20, 22, 9, 5, 9, 5, -34, 5, -12, 2, -21, 23, 18, 30, -3, 12, -10, -19, -23, 6, 0, -18, 11, 4, -30, -7, 39, 10, 27, 9, -37, -1, 24, -5, 1, 4, -16, 23, -8, -5, 7, -1, 26, -24, -8, 13, 2, 1, -8, -28, -18, -2, 2, 24, 17, -29, -4, 30, -23, 65, 20, -8, -40, 6, -2, 31, -7, -28, -3, 18, 17, -8, 10, -18, -19, -7, 21, 5, -7, -12, -17, 24, -8, 29, -4, 23, -30, -12, -4, -5, 10, -29, 13, -55, 1, -15, 15, 6, 15, -23, -6, 24, 13, -5, 7, -4, -22, -7, -16, 14, 27, -19, -13, 17, 6, -22, 12, 2, -21, 13, -11, -23, -11, -31, 3, 34, -4, 10, -8, 19, -4, 22, -14, -12, -14, 8, 6, -23, 8, 14, 13, -51, 2, 26, 12, -19, -17, 7, 0, 31, 6, 18, -36, -17, -5, -28, 13, -39, -5, -17, -13, -51, 5, -5, -12, 55, -12, 1, -71, -10, 7, -5, -26, 7, 12, 4, 21, -7, 9, -1, -14, -12, -11, -8, 17, 3, 0, 9, -29, 14, -17, 19, 15, 4, -24, -9, 2, -19, -21, -3, 11, 14, -24, 31, 19, -53, 13, 9, 21, -2, 20, -26, 26, 13, 9, -3, -47, -20, -36, -22, 15, -54, 14, 22, -26, 13, 3, -28, -15, 25, -11, -21, -28, 24, -19, 16, 28, -13, 9, -3, -11, -7, -14, -17, -28, 13, 18, -22, 13, -10, -6, 11, -8, 1, -4, 12, -4, 28, -1, 7, -13, 9, -13, 18, 6, -20, -3, 16, -5, 13, 24, -24, -8, 18, -8, 1, -15, -11, -10, -20, 32, -6, 45, 7, -6, -22, 13, -12, -13, 23, -11, 22, -15, -1, -14, 21, 54, -22, 16, -4, -30, -8, -12, 6, -7, 16, 16, -20, 26, 22, -22, -16, -13, 13, 18, 16, 1, -15, 1, -32, -21, 10, -8, -14, 2, 25, -20, 11, 22, 4, 29, -20, -23, 15, -16, 7, 13, -22, -31, -19, -3, 32, 14, -14, 7, -14, -32, 10, 6, 57, 34, -4, -16, -16, -14, 20, -21, 28, -10, -32, -61, -4, -19, -9, 35, -9, 14, -18, 26, -11, 13, -30, 1, -8, 7, -41, -34, -20, -4, 5, 26, -28, -12, 41, -3, -11, -11, 9, -16, 6, -10, 15, 13, -7, -30, 9, -15, 24, -29, -16, 20, -18, -16, -3, -22, 3, -6, -22, 14, -23, 17, 3, 0, -3, 31, -18, -24, 7, 16, -19, 4, 33, 19, -26, -34, -21, 13, -14, -18, -2, -4, 19, -7, -20, -1, -12, 24, -17, 0, 20, -4, -18, 7, 14, -19, 6, -9, -56, -19, 0, -3, -20, -25, -4, 18, 29, -5, 2, -1, 2, -13, -19, 21, -14, 25, 23, -19, -15, -15, 8, -22, 2, 48, 33, 69, -2, -47, 41, 26, -19, -20, -3, -9, 30, -30, -5, 20, 6, -74, -19, 30, 21, 14, 3, -1, -3, 1, 30, 24, -15, 6, 13, 9, -15, 19, -21, -2, -1, -46, 10, -5, -52, 14, 2, -4, -12, 8, 15, 24, -6, -5, -1, 10, 3, 22, 8, -12, 5, 25, -18, -20, -3, 16, 8, -12, -22, 3, -16, 38, 23, 8, 114, -19, -7, 16, 8, -7, 20, -16, -58, -12, -4, -10, 20, 15, 4, -16, -14, -7, 30, -1, 2, 18, -6, -19, -24, -13, 15, 28, 3, 3, 13, -18, 5, 21, -22, -20, 13, 9, -19, 7, -2, 0, 13, 18, -6, 7, -16, 29, 16, 4, 18, -6, -13, 3, 15, 3, 15, -2, -11, -12, 19, 27, 17, -9, 12, -13, -9, 23, -14, 27, -16, -11, 23, -9, 10, 8, 12, -8, 14, -21, 26, 8, 9, 6, -11, -3, -15, 13, -4, -5, -3, 1, -20, 25, 34, 4, -11, -18, 6, 14, 25, 13, -10, 23, -22, -18, -25, -1, 14, 6, 8, 7, 2, 28, -22, -3, 27, -19, -28, -28, 8, -14, 9, 4, -19, 29, -18, 22, -20, 20, 25, -19, 47, -11, 23, -9, -37, -13, -6, 15, 5, 33, 19, -8, 10, 24, -3, 0, 23, 17, -4, 12, 22, 21, 25, 17, 2, -13, 15, -17, -19, 1, -8, 25, 19, 6, -4, -1, 5, -19, -24, -19, 22, -3, -20, -21, 19, 22, -23, -20, -22, -29, 24, 28, -2, 3, -19, -25, 10, -26, 11, 22, -10, 20, -21, -28, -2, -21, -13, 3, 2, 27, -2, -16, -4, -10, -25, 10, 10, 10, 16, 7, 2, -5, 22, -15, 3, -2, -11, 7, -1, 13, 30, 14, -21, 25, 11, -20, -28, 0, -3, 6, 12, -3, -2, -10, -10, -23, 8, -7, -19, 24, 20, 10, -27, 16, 8, 2, -18, -27, 21, 4, -29, -4, 18, 8, -39, -24, -26, 2, 14, -22, 20, -21, -16, -12, -1, -16, 20, 15, -2, 4, 1, 18, 5, 0, -21, -13, 0, -29, -24, 23, 33, 1, 1, -29, 45, 32, -19, 10, -24, 7, -3, 19, 5, -17, 17, 4, -13, 11, 21, 21, 5, -24, 6, -14, 15, 26, 9, -6, -5, -13, 21, -18, 6, 20, -5, -29, 11, -17, -17, 17, 5, 27, 1, -16, 10, -23, 15, 15, -15, 8, -22, -38, -13, -2, -19, -8, 15, -2, 24, 7, -12, 20, 20, -17, -9, -19, 25, -4, -27, 23, 31, 12, 5, -19, 21, -21, 8, -19, -12, 25, -19, -5, 1, 13, -12, -8, -33, 0, 4, -3, 0, -26, -11, 28, -21, 2, -17, -9, -26, -13, -17, 5, -85, 13, 8, 19, -47, 21, -26, -26, 42, 12, 12, 13, 8, -27, -7, 21, -17, 3, 15, 3, 7, 22, 2, 17, -3, -21, -23, 0, -17, -1, -9, 24, -13, -26, -1, -14, -15, -15, 0, 16, 21, -11, -16, 16, 5, -4, -2, 12, -39, -14, 16, 15, -5, 18, 8, 16, -25, -17, 13, 32, 8, -5, -19, -3, -37, -20, 24, -6, 37, 13, 0, -12, -12, 8, -20, 34, -19, 6, 21, -4, -6, 1, -12, -10, -6, 4, 20, -5, 19, -4, -14, -3, -16, 4, 9, -17, -40, 21, -1, -24, -23, 17, -24, 23, -6, 1, 5, -6, 27, 10, -21, -23, -2, 18, 5, -20, -2, 4, 15, -3, 17, 12, 4, -31, 11, -25, -24, 18, -25, -24, -20, -21, -41, 11, -13, -12, 60, -18, 10, -63, 0, -22, 23, -12, -1, 0, -13, -11, 21, -4, -12, -15, -5, 12, 4, -11, -6, -8, 22, -24, -7, 12, 20, 21, 7, -13, 10, 16, 14, -2, 7, 1, 7, 4, 3, -10, -5, 2, 6, 12, 15, 23, -21, -5, 5, 20, 18, 2, 9, -1, -9, 16, 88, 16, -10, -13, 6, -22, 1, -20, -29, -12, -5, 33, -21, 21, 29, 4, 21, -24, 28, 2, 15, -27, 2, 30, 2, -17, -3, -14, 1, -22, 1, 0, -7, 1, -4, -10, -11, -7, -8, -20, -14, 8, -14, -11, -8, -22, 16, 11, 16, -8, 12, -6, -18, -8, -2, -28, -14, 19, 21, 26, -11, 19, 26, -12, 11, -22, 12, -5, 3, -10, 3, 23, -29, 29, 4, 0, 3, 28, 13, -21, -12, -26, 20, 23, -20, 2, -3, -23, 15, 8, -9, 5, 9, 24, 40, -30, 8, 4, -31, -20, -28, -19, -12, -22, 10, 10, 16, -30, 24, 18, 2, -7, -13, -2, -16, -16, -19, -6, 21, 20, 22, -13, -5, 14, 24, 26, 14, -1, 17, 3, -6, 22, -29, -18, -19, -17, -19, -16, 20, 58, -15, 4, -1, -4, 25, 28, -14, 11, -18, 5, 5, 5, 18, -26, -12, -12, -15, 0, -6, -17, 8, -5, -10, 4, 3, -7, 22, 3, -12, -4, -4, 1, 16, 18, 8, 15, -25, 2, -9, 0, 25, 20, -13, 21, -26, 20, -30, 20, -13, -19, 27, -23, -46, -16, -10, -5, 33, -9, 1, -9, -35, -1, -8, 30, -16, 19, 27, -2, 11, 13, 36, -21, 1, 12, -24, -11, -12, 6, 25, -19, 4, -4, 16, -6, -4, 18, -32, -8, -16, 17, -9, 22, -19, 17, -2, 1, 17, -13, -26, -19, 38, -17, 1, 6, 21, -18, 18, 17, -10, 1, -18, 34, 17, 31, 5, 13, 35, 20, -6, -21, 17, 9, -22, -8, -41, -29, 23, 22, 11, -13, -9, 12, -10, 18, 23, -27, 19, -15, 10, -12, 24, 21, -11, -11, 12, 19, -12, -16, -36, -1, 33, 18, -18, 2, -7, -15, 12, -1, 26, 24, 28, 13, 0, 23, 40, 24, -4, -16, 16, -3, -16, 14, 14, 18, 7, 14, -8, -16, -9, -8, -23, -1, 13, -25, 57, 17, 20, 1, -29, 3, 0, 13, -5, 10, 15, -30, -19, 17, 4, 7, 10, -18, -2, -26, -19, 5, 5, 21, 14, -26, 3, 15, -26, -33, 22, 5, 23, 3, -9, 0, -22, 28, 15, -17, 16, -7, -17, -4, 38, -16, 31, 18, 14, 5, 5, 2, 17, -1, -3, -5, -13, 9, 18, -21, 12, 9, -24, -22, -26, -17, 16, -2, 14, 6, 14, -43, 7, -7, -22, -5, -12, -16, -23, -8, -14, -14, 26, 10, -13, 23, -9, -13, -14, 6, 27, -24, -4, -19, -10, 20, 20, -7, 13, -17, -11, -22, -5, -18, -10, -3, 30, 11, 2, -21, 19, -18, 13, -16, 24, -21, 28, 0, 25, -7, -3, -23, 16, -1, -72, 6, 2, -2, -8, 27, -30, -14, 49, -5, -18, -24, -6, -15, 10, 4, -6, -12, -28, -10, -4, -3, -29, -12, 12, -16, -17, 21, -2, 19, -14, -7, 33, 18, -17, -7, 9, 4, 9, -10, 0, 0, 19, 1, 5, 4, 5, 15, -46, 3, 32, 19, 40, 25, 22, 6, -25, -15, -21, 36, 4, 51, -24, -16, -5, -10, 10, 10, 20, -1, -30, -11, 5, -26, 11, 1, 1, -18, 29, 11, 22, -10, 24, -20, -22, 0, 32, 37, 18, -11, -4, 22, -16, 5, 7, -14, 10, 14, -14, -9, -11, 8, -12, 0, 9, 3, -12, 19, -27, 22, 8, 0, 13, -6, -1, 15, -15, -11, 12, 8, -7, 26, 20, 16, -16, 12, -27, -16, 31, -1, 10, -2, 25, -17, -13, 2, -6, -3, -13, -56, 28, -22, -19, -13, -10, 2, 22, -31, 10, 23, 23, -32, -4, 0, 44, -5, 13, -6, -9, -28, -14, -14, -33, -18, -25, 5, -27, -17, 13, 19, 12, -9, 21, 27, 15, 11, -38, -14, 22, 8, -10, 23, 26, -26, -1, 25, -8, 19, 16, 12, 18, -31, 3, -2, -3, 9, 22, -18, -11, -11, -26, 14, 8, -37, -6, -27, 18, -5, -8, 21, 7, 22, 35, 1, -4, -24, -1, 19, -18, 15, 1, -25, -22, -14, -14, 18, -86, -30, -15, -20, -12, -23, -21, -19, -10, -8, 1, -15, -24, 9, -11, -29, -4, -20, 21, 11, 25, -19, -25, -13, 8, -26, -29, 17, -4, -51, 18, -2, 32, 16, -13, -12, -12, 29, 9, 3, -3, -26, -20, -13, 36, -12, -8, 6, 23, -26, -14, 1, 14, 47, 26, -16, 45, 46, -4, -3, -40, 14, 10, -19, 14, -18, -6, 18, -28, 0, 18, 16, 26, 19, -8, 38, 11, -5, 0, 16, 5, 8, -7, -19, -2, 24, 21, 15, 24, 26, -27, 16, -17, -14, 31, -25, -12, -22, -29, -19, 0, -28, 15, 20, -9, 40, -9, 5, 25, 25, -9, -16, 3, -6, -23, -1, -20, -23, -6, -5, 7, -17, 27, -6, -4, 9, -4, -17, -14, -24, 2, 25, -14, -15, -1, 17, 19, -1, 11, -15, -17, -19, -1, -27, -1, -19, -23, 11, 1, -3, -11, -23, -9, -21, -2, -15, 2, -11, 37, -23, -19, 2, -16, -7, 15, 11, -6, 6, 10, -29, 16, 9, 4, -4, -17, -7, 13, -22, -20, 23, 9, -13, -16, 8, -14, -13, -6, 20, -30, 6, 25, -10, 21, -23, 25, -16, -16, -15, -5, 20, -12, 21, -15, 11, -10, -27, -31, -5, 17, -8, 5, -1, 7, -30, -23, 7, -6, 6, -16, -24, 2, 3, -50, -24, -5, 7, -9, 7, 19, 20, 35, -21, -25, -6, 4, 8, 14, -23, 23, 5, -24, -16, -7, 13, -7, 27, -17, -10, -30, -23, -13, 23, 13, 12, 24, 15, 22, 4, -22, 12, -24, -26, -4, -6, -10, 12, 3, 21, 20, 2, -23, -2, 3, -16, -19, 17, 28, -8, 13, -28, 21, 15, -14, -9, -3, 4, 45, 1, -14, -1, -12, 3, -10, 5, 0, -12, -26, -42, -13, -24, -4, -15, 23, -7, 15, 16, 24, -6, 3, -12, -4, -1, 17, 7, -15, 23, 15, -3, 5, 5, -18, 28, 21, -3, -7, -25, -9, 18, -12, -17, 18, -7, 17, 18, -15, 6, 11, 7, 29, -17, -4, -2, 20, -25, 6, 21, 0, 13, 5, -12, 16, 0, 4, 4, 7, -27, 8, 10, 7, -23, -18, 33, -20, 5, 20, 3, -4, 20, -18, -20, -17, 4, 9, -6, -18, -17, 28, 0, -8, 23, 36, -6, -24, -3, -3, -21, -21, 17, -11, 18, -19, 11, -2, 4, 2, -20, -12, -27, 34, 15, -1, 9, 4, -7, 0, -24, -2, -22, -1, 24, 26, 8, -1, 15, 52, 14, -24, -8, 59, -22, -20, 11, -40, -31, 31, 45, 13, 16, -18, 1, 19, 25, -5, 17, -11, -17, -20, 29, -17, -9, -20, 14, 19, 5, -17, -21, -27, -20, 0, 17, 26, 9, 9, 19, 4, -1, -10, 8, -14, 9, -24, -16, 38, -12, 0, 12, -2, -4, 24, -21, -17, -16, -16, 16, -26, 15, 13, -29, -25, -13, -13, 7, 1, -22, 19, 4, 22, -26, 15, 22, 4, -38, 19, 7, -18, 14, -3, 16, -22, 24, -12, -14, -2, -3, -2, -14, 12, 25, -48, 5, -18, 18, 46, -11, 20, -17, -9, 24, 10, -5, 3, 0, 0, 12, -15, -17, -24, -7, 6, 19, 24, 6, -24, 29, -4, -9, -3, 0, 35, 31, 4, 5, 60, 22, 8, -21, 27, 14, -12, 9, 6, 7, 14, 18, 12, 0, -13, 7, -13, -5, -18, -19, -4, -9, -22, -17, -8, 18, 13, -3, 21, 5, -6, -10, -16, 12, 10, -18, -28, -21, -26, -5, 6, -21, 7, 4, -6, 2, -1, 16, 35, -6, -16, -21, 21, 27, -10, -4, 14, 4, 13, -9, -6, 34, 19, -15, 53, -3, -13, -21, 26, 7, -10, 15, -1, 4, 24, 69, 9, 11, 13, -9, -12, -24, -12, 15, 29, 4, -28, -16, 0, -23, -22, 21, 18, -11, 9, -22, -15, 20, -29, 10, -15, 8, 24, -24, 22, -12, -22, -19, -27, 16, 14, -4, 4, -13, -21, 17, -38, 0, -26, 5, 36, -10, 29, -21, -9, -42, 14, 30, 21, 16, 1, -11, -1, -6, 32, 1, 20, -25, -21, -13, 13, 10, 13, 40, -14, 11, -20, 12, 14, 0, -22, -7, 10, 10, -63, -54, -17, 27, 2, 3, -33, 16, 15, 1, -21, -12, 17, 19, 21, -15, -33, -4, 18, -9, -25, 0, 21, 0, 1, 23, 1, -10, -12, 4, 15, -13, 17, -10, -35, -38, -10, -20, -111, 25, 31, 2, 18, 3, 7, -4, 7, 2, 11, -4, -5, -4, -23, -2, -27, 26, 14, 14, 13, -9, -20, -21, -11, -18, -17, -12, 0, -4, 22, -9, 1, -12, -15, -5, 15, 19, 6, 21, -2, 7, -9, -1, 8, 28, 31, 6, 2, 13, 17, 16, 4, 12, 20, -10, 1, -1, 26, -30, 4, -42, 28, -6, -84, 20, 19, 4, 16, -8, -13, 7, 1, 22, -12, -15, -26, -11, 15, -2, -19, 1, -8, 14, 31, 14, -3, 18, 5, -22, -1, -6, -8, 14, -9, 8, -18, -23, 28, -3, 19, -16, 1, 20, -19, 15, 5, -1, -8, 20, 11, 20, -2, -30, 5, 22, -17, 20, 24, -25, 2, 19, 13, -29, -2, -23, 0, -22, -63, 24, -9, -4, -18, -2, -1, 1, 32, 17, -12, 35, -26, -15, -8, 19, -15, 3, -9, 3, 16, -10, 17, 15, -8, 9, -22, -1, 15, -8, 27, -26, -17, -8, -22, -22, 6, 25, 21, -5, -25, 17, -23, 4, 3, 2, 19, 2, -12, -19, -9, 3, 24, 8, 6, -21, 5, 7, -24, -25, -17, -45, -23, 3, -94, 15, 20, -9, 10, 3, -13, 24, 7, -11, -9, 6, -12, 4, 12, 1, -15, 24, -5, 30, 12, 8, 7, 10, 17, 5, -2, -2, -8, -23, 11, -4, 13, 15, 15, 21, 12, -11, 27, -26, 7, -4, 15, 13, -22, -24, 13, -16, 15, 9, 0, 23, -24, 13, -29, 6, -24, -2, 9, -24, 13, -24, -21, -5, 118, -21, 15, -26, -1, -5, 20, 18, 13, -5, -2, 71, -17, 14, 8, -19, -2, -10, -18, -3, -2, -11, 14, -15, -7, 17, -2, 4, -8, 13, 15, -2, -27, 2, 1, 11, 2, -27, -1, -24, -26, 1, 27, 17, 21, -34, 13, 10, 22, 22, -9, 5, -21, 4, 14, -10, 19, -20, 27, 7, -12, 13, 22, -2, -1, -5, 10, 14, -3, -11, 16, -26, -38, -4, -10, 38, -23, 0, 23, 31, -15, 25, 18, -7, -23, -19, -22, 4, 15, 17, 9, -26, 29, -6, -13, 19, 10, -14, 20, 7, -5, 4, 4, -6, 22, 18, 1, -16, -20, -19, 11, 20, -1, 32, 1, -15, 12, -21, -14, -5, 22, -25, -25, 37, 9, -42, -9, 6, -14, 24, -3, -7, -6, 15, -29, 10, 14, 37, -9, 25, -4, 5, 8, -15, 20, -18, 10, -1, 25, 4, 18, 12, 1, -31, 30, -5, -15, -16, -41, -15, -20, 8, 7, 23, -34, -20, 29, -21, 11, -8, -16, -3, -15, -6, 14, -24, -2, 16, 12, 25, 8, 16, -7, 2, 2, 7, -17, -50, -9, -40, 6, 6, -46, 12, -4, -13, -37, 24, -3, 11, 40, 9, 11, -59, 5, 0, 4, 24, 17, -23, 10, 12, -9, 4, -19, -24, -5, 14, 5, 18, 16, -2, -1, -11, 3, -9, -10, -22, -9, -3, 4, -6, 24, 20, 8, -4, 2, -2, 4, -24, -46, -10, 3, 11, -14, 1, 11, 1, -13, 0, -4, -26, -17, -18, -21, -10, -22, -17, -1, -11, -6, -19, -8, -7, 41, -16, -20, -47, 9, 36, -20, 5, 10, -5, -22, -21, -23, -17, 13, -8, -13, 12, -28, 30, -2, -2, 42, 10, 52, 13, -27, -26, -6, 20, -13, 11, 0, 21, -5, -11, -6, -33, 14, 26, -4, 19, -19, 23, 9, 9, -18, -6, -24, -16, -19, 22, 17, -10, -9, 18, 10, -19, -22, 23, 47, -7, 29, -8, -31, -19, 3, 41, 10, 2, -16, -21, -16, -8, 10, -13, -12, -2, -4, 17, -6, 17, 23, 22, -3, 9, 3, 13, -29, 1, 19, 25, -9, -10, 4, -20, -11, -19, 0, -21, 2, 4, -40, -1, 1, 18, 20, 2, -1, -9, 13, 19, -12, -19, 7, 25, 7, 10, 28, -2, 102, -21, -4, -4, 20, 16, 23, 5, -34, -5, -22, 39, 24, -15, 6, -29, 3, 12, -22, 14, 3, -1, -5, 25, 24, -20, -5, -10, -13, -16, -20, 22, -22, 18, -28, 13, 1, 6, 15, -15, 2, 11, 1, -4, -8, 10, 13, -8, 5, -25, 26, -19, 5, 30, -13, -21, 4, -15, 16, 6, 19, 10, 23, -26, 17, -6, -20, -32, 8, 15, -1, -4, 11, 24, 29, -7, 10, -21, 20, -30, 8, -16, 32, -19, 16, 15, -13, 22, -3, -28, -36, 20, -2, -16, -32, -34, 30, -3, -7, -18, -20, -17, 2, 0, 16, -16, 30, 1, 0, -28, -26, -6, -18, -26, 15, -5, -3, -3, 19, 13, 12, -28, -1, 13, -19, 23, -2, 13, -32, 17, -5, -6, 5, -25, 4, 6, 5, 27, 3, -2, -19, -21, -24, 27, -16, -7, -28, 5, -18, -3, -10, 38, -1, 3, -38, 5, -10, 22, -5, -34, 2, 16, -16, 22, -28, 26, 2, -17, 4, 23, -7, -12, -21, 15, 18, -20, -24, 1, 5, 21, 28, -25, -3, 24, -21, -11, 26, 31, 10, 1, -20, -16, -67, 8, -23, 5, 18, 15, 13, 1, 44, 33, -25, 22, -31, -7, -8, 9, 23, 5, 24, 8, -14, 13, -11, 3, 9, 12, 1, -19, 10, -12, 19, -32, -8, 9, -39, 9, -20, 14, -11, -2, 14, 10, -8, -3, -10, 3, 20, -22, -31, 16, 28, 6, 10, 10, -7, -20, 25, 0, 26, 10, 6, 7, -4, -3, -9, -4, 11, 10, -5, 27, -16, 5, 17, -3, 22, -16, -3, 41, 17, 34, 23, -6, -32, 21, -15, 3, -17, -6, 23, -2, 11, -13, 36, -3, 23, 37, -1, -4, 5, 2, 14, 11, 20, 1, -12, 27, -33, 19, 8, -18, 30, 10, -31, 7, 9, -20, -25, 25, 12, 15, 3, -6, 22, -22, 20, -25, 9, 19, -8, -14, 4, 34, 19, 22, -27, 22, 27, -33, 15, 0, -26, 33, -11, 39, 10, -14, -22, 6, 0, 6, 30, -11, -16, -15, 7, -12, 26, -16, 17, 26, -5, -7, 59, 8, 20, 17, -13, 19, -11, -8, -12, 4, -10, -2, 1, -16, 19, -7, -13, -11, -11, 18, 20, 20, 11, -15, 23, 32, -24, -15, 7, -16, 29, -17, 12, 15, 50, -6, -24, 5, -10, 8, -10, -55, -3, -2, -9, 11, 5, 2, -22, 11, 5, 12, 28, 23, -18, 8, -11, -10, -10, -6, 22, -15, -36, -13, 13, -4, 17, 15, -19, 21, -14, -16, -5, 15, -23, -7, -14, 10, -12, 0, 12, 8, -26, 18, 19, -30, 10, -20, 24, 2, 26, -10, -9, -34, 91, 23, -21, 3, 26, 8, 20, 2, -7, -12, 18, -46, 12, 24, 8, 8, 20, -22, 7, -23, -13, -11, -9, 5, 3, -5, 5, -3, 4, 7, 8, -21, -25, 5, 11, -18, 10, 16, -17, 21, -16, 16, -2, 8, 2, -18, 3, 7, 10, -6, 5, 21, 16, -12, 7, 25, -17, -4, 2, -40, 11, 0, -32, -7, -8, -19, -15, 10, -3, 0, -8, 3, 44, -7, 18, 5, 30, 46, -7, 27, 13, 15, 0, 3, -23, -1, 16, 13, 10, -22, -16, 20, -15, 5, 41, -16, 41, 15, -40, 4, 28, 10, 11, -6, 4, -7, -28, 8, 4, 0, 29, 20, -40, -4, 20, 15, 19, 1, 14, 22, 22, 2, 19, -24, -27, 4, 13, 33, -22, -2, -11, 29, -11, 15, 4, -4, 40, 12, 25, 1, 23, 55, -31, 19, -19, -11, 15, 4, -18, -22, 12, -19, 7, 6, 44, -25, 36, 13, 55, 42, 4, -8, 31, -2, -22, -16, -24, -28, 6, -3, -2, -15, -25, -8, -10, -17, -11, -15, -6, -8, -21, -22, -17, 8, 14, 9, -17, -53, -22, -45, 7, 7, -64, 7, 16, 9, -33, 11, -12, -8, 40, -21, 22, -30, 7, 0, -4, -20, -16, -9, -18, -12, -2, 16, 23, -26, -11, -23, 19, -10, 5, -4, -17, 5, 19, 24, 30, 9, 18, -22, 4, 6, -2, -2, 3, 4, 7, 4, 16, -10, -39, 0, 21, -11, -17, -5, 2, 14, 31, -22, 19, -1, 7, -26, -4, 15, -47, -17, -17, 17, -47, -3, -15, 1, 57, -17, 12, -69, -3, -8, -4, -8, -27, 11, 10, 9, -13, 3, 28, 1, 4, -8, 6, -14, -10, 28, -15, -13, 30, 23, -8, 23, 4, 16, -11, -10, -13, -18, -9, -7, 9, 3, 3, -25, -42, -14, 14, -6, -22, -17, -17, -6, -11, 10, -19, -9, -21, -19, 29, 6, 86, 4, 17, -17, -11, -5, 29, 24, -37, -21, 0, -25, 15, -22, 13, -23, -3, -8, -1, -36, -15, -3, 16, 41, -2, -3, -34, 8, -22, 1, 6, 18, -5, -17, -3, -33, -7, -1, 6, 29, -19, -12, 27, 31, 23, 8, 11, -8, 49, -26, 27, 16, 0, -7, 1, -19, -22, -13, -8, 6, -21, 21, -24, 2, -15, -20, -22, 15, 13, 17, 0, 27, 18, 21, 26, 17, -23, -34, 31, -25, -21, 10, -4, -33, 7, -10, 7, -29, -22, 9, 16, -3, 15, -25, -19, 32, 25, -2, 26, 1, 20, 7, -8, -14, -32, 24, 25, 5, 29, 30, -18, 13, 2, 11, 1, -17, -38, -2, -28, -14, 12, 8, 14, -3, -2, -43, 3, 13, -18, -14, -4, -21, -7, 0, 13, -1, -19, -1, -16, 63, -20, -3, -23, 19, -10, -7, -15, 12, -17, 5, -10, -41, -4, 17, -12, -21, -20, -6, -9, 9, -6, 2, -5, -19, -20, 26, 18, -27, -17, 3, -2, -2, 8, -36, -17, -24, 26, 16, -20, -8, 9, -7, 6, -17, 19, -1, 19, 34, 2, 17, 11, 7, 90, 20, -1, -11, 26, 6, 13, 26, -35, -12, 6, -6, -22, -11, 4, -15, 15, 15, -4, -8, -15, -24, -9, 31, 3, 11, 26, 4, 11, 3, -9, -7, -23, 7, 4, -7, 2, 6, 17, 19, 8, 24, 8, 0, -21, -20, 13, -19, 49, -4, -19, 16, -1, -21, 13, -25, -2, -8, -8, -15, -22, 30, -15, -30, 17, 5, 3, -11, -20, -13, -19, -10, 16, -3, 5, 16, 18, -10, 15, 12, 5, 23, 27, 1, 6, -21, 14, 6, -23, 22, 16, 14, -6, 14, -27, 31, 25, 0, -8, -12, 15, 17, -24, -13, 6, 19, -18, 4, -16, -14, 7, 29, -5, -11, 9, 10, 15, -8, -21, 23, -17, 5, -13, 2, 3, 50, 15, -15, 91, 13, 4, 8, 2, 10, 39, -5, -26, -24, -5, -4, 19, 10, 16, 16, 14, -20, 21, -24, -10, -19, -27, 20, 11, 21, -5, -22, 0, 18, 8, 11, -25, 2, -12, -7, -20, -18, 1, 13, -15, 16, -19, -13, 7, -2, -25, 20, 7, 13, -28, 15, 19, 2, -7, 28, 9, 16, 4, 25, 19, -4, 4, 2, 35, 9, -4, -2, 15, -26, -20, -1, -38, 5, -3, 28, -22, -29, -23, -22, -16, -23, 25, 26, 16, 6, -10, -3, 19, 4, -7, 19, -15, 21, -25, 18, -9, -15, 39, 15, 25, -25, 9, 10, 19, -12, 1, -16, 3, -7, -22, 1, 9, 2, 12, -11, 19, 14, 11, -21, 10, -12, -8, -41, 4, -22, -22, -1, -38, 26, -6, -22, -15, -12, -9, 6, 20, 19, 23, 8, 16, 25, -23, 21, 10, 8, 8, 17, 12, 1, -19, 2, -12, -1, -11, -21, 18, -19, 38, -32, 20, 12, -37, -18, -14, -7, 23, 24, 29, 24, -32, 13, 15, 9, -1, -13, -7, 20, -15, -3, 14, 18, -5, 18, -17, -20, 1, -11, 7, -8, 4, -12, 28, 21, 9, 11, -39, 28, 18, 20, -2, 13, -18, 30, 19, -23, -15, 21, -24, -8, 15, -2, 8, 21, 1, -5, -17, -9, 18, -2, -3, -6, -32, -30, -6, -16, -13, -4, 1, 7, 12, -10, 8, 19, 13, 21, 16, -23, -16, 18, 15, 29, -16, 13, 5, -21, -29, 0, -22, 31, 21, -19, -26, -26, -25, -5, -107, 8, 21, 20, -2, 14, 15, 10, 32, -16, 14, -15, -24, -15, 14, 25, -18, -7, -13, 19, 12, -2, 1, 17, 10, 17, -22, -23, -30, -16, -9, -11, 1, 22, -15, 3, 15, -27, 6, -15, 19, 17, -16, 16, 7, -12, 37, 21, -2, -10, -16, 6, 5, 8, -8, 19, 0, -1, -10, 24, 4, 0, -7, 12, 28, -13, 7, -2, 54, -22, 15, 11, -35, -1, 7, -42, 6, 19, -22, -10, -28, 20, 10, 10, 20, -9, -19, 20, 20, -5, -10, -7, 1, -6, 24, -28, -50, 1, -48, -8, -6, -17, 13, 14, 17, -18, 4, -7, 21, 5, -12, -5, 0, 7, 16, 0, 2, -7, 16, 22, -7, 7, 21, -5, 8, 30, -20, -17, 73, 19, 5, 10, -8, 13, 30, 20, -29, -20, 7, -7, -24, 21, 1, -26, -6, 5, 23, -5, -8, -16, 24, 7, 19, -3, -20, 22, -9, 22, 15, -1, -16, -7, 19, -9, -4, -22, 12, -4, -6, 15, -9, -14, -11, -24, -24, -10, 10, 27, -19, 22, -14, 17, -13, 9, 27, -7, -2, 40, -15, 1, 23, -11, 19, 0, 14, -1, 19, 18, -11, -20, -19, 6, -24, 38, -6, 28, -2, -21, 7, -16, -18, 12, -13, -1, -3, -14, 3, -20, -15, -1, 8, 30, 22, 6, 8, 17, -16, -19, 1, 21, -12, -12, 21, 11, -2, 21, -6, 14, -6, -12, -9, 22, -1, -14, -1, -4, 7, -17, -18, 18, 12, 18, 16, 19, -4, 17, 35, -9, -1, -20, 14, -21, 22, 17, -42, -33, 3, 24, -8, 10, -9, -11, 7, -11, -2, -21, -26, 7, -15, -17, -6, 11, -14, 12, 8, -9, 19, 24, -23, 3, -22, -11, 9, 31, 21, -8, 2, 28, 11, -17, -7, 29, -6, -13, 30, 17, 14, -23, -2, -5, -16, 6, -11, -17, 11, -46, -5, -29, -31, -6, -60, 2, 0, 6, -42, 23, 0, 19, 48, 3, 8, -35, 10, 15, 0, 17, 9, 10, -27, 8, -20, -5, -14, -23, -2, -2, -12, 0, -3, -11, 18, 8, -7, -7, 24, 11, 3, -21, 13, -20, 15, 15, 24, -9, 19, -29, 42, 11, 2, 9, -26, 19, 1, 14, 9, -27, -20, 20, 16, 21, 13, 0, -2, 24, -100, -4, -12, -2, -21, 20, -26, 10, 11, -5, -1, 69, 11, 19, 23, -15, 3, -18, 15, 21, 18, -12, 17, 2, 16, -22, 4, 5, 6, 18, -15, 19, -23, -11, -13, -12, 2, -4, 5, -25, 21, 23, -18, -6, -14, 2, 11, -8, 26, -4, -26, -24, 3, 19, -27, 18, -21, -3, 2, 13, 23, 36, 10, 8, 105, 13, -25, 2, -10, 28, 37, 17, 5, 24, 10, -7, -9, 26, 26, 26, 17, -21, 25, 20, -9, 6, -6, 3, -7, 20, 22, 23, 18, -5, -6, -2, 2, -18, -29, -15, 14, -14, -18, 22, 9, -31, 5, 0, 4, 11, -4, 24, 6, 2, 13, 6, -11, -15, -17, 6, -2, -9, -24, 15, -23, -4, 19, 0, -55, -19, 19, -7, 10, -5, -38, -17, 28, 0, 6, 3, -14, 1, 22, -23, -16, 6, -8, -8, 9, -20, -19, -10, -14, 21, 6, 12, -12, 1, -20, 0, 31, -18, 14, 12, -1, 7, -22, -9, 9, 8, 9, 12, -8, 21, -1, 18, 1, 8, 7, 0, 2, -14, -20, 0, -7, -25, 12, 17, -17, 40, -16, -16, -3, 20, 13, -10, 2, -20, -12, 21, 7, -10, -6, 15, 10, 4, -9, 22, -18, -13, 19, -20, -17, -10, -9, -8, 8, -7, 8, 23, 22, 19, 31, 6, -19, -4, 8, 17, 12, 27, 1, 23, 19, 9, -25, 24, 14, -23, 11, 22, 19, 4, 15, -2, -25, -14, 3, -7, 24, 9, 1, 26, -15, 4, -27, -7, 56, -16, -6, -19, -20, -19, -16, 12, -1, -13, -21, -35, 5, -13, -13, 10, -28, -3, 16, 22, -19, 0, 11, 21, 15, 13, -19, -16, 0, 29, -5, 16, 31, -13, 29, -26, 22, 21, -19, 22, -9, -17, 18, -7, -10, 21, -25, 15, -28, -10, 16, 22, -29, -28, -5, -3, 1, -13, 7, -38, 16, -6, 5, -13, -6, -9, 0, -9, -6, -21, 19, -19, -10, -3, -16, 3, -24, 12, 14, -5, 0, 13, -14, 23, 23, 19, 5, 18, -18, -5, 6, 10, -1, -13, 17, 3, -20, 15, 14, 10, 20, 24, -22, 20, -13, -26, -3, 6, -23, -19, 20, -21, -30, 7, 20, -15, 4, 23, -9, 15, -17, 6, 5, 2, -9, 13, -10, 5, 103, -12, -32, 20, 12, 27, -2, -6, 10, 17, 20, -12, -24, 23, -5, -3, -22, -7, 4, -5, 12, -4, -8, 11, -24, -22, -19, -2, -17, -23, 30, 23, -7, -19, -32, -3, 0, 19, 10, 8, 11, 20, -16, 16, 18, 7, -34, 18, -14, -8, 22, -26, 16, -9, 26, 6, 30, 19, 20, -37, 17, -17, 23, 13, 3, 18, 11, -2, -42, -13, -11, 1, 37, 1, 13, -77, 5, 21, 28, 10, 8, 15, 1, -13, 21, -7, 9, 5, 14, -19, -12, -22, 10, 26, 3, 9, 18, -23, -34, -6, 13, 17, -10, 14, 18, 0, 24, -9, -18, 3, 26, -6, -16, -2, -8, -20, 4, 23, -21, -8, 9, -22, -13, -4, 20, -11, -27, -4, 68, -12, 23, 24, -23, -9, 27, 1, 8, 3, 6, 8, 12, 21, -11, -21, -19, 10, 11, -1, 29, 5, 2, 24, 14, -17, 2, 8, -26, -11, 17, -12, 22, -14, 4, -20, -16, -6, -19, -23, 12, -12, -19, -20, -32, -30, 17, 8, -18, -12, -24, -4, -24, -6, -1, 24, -10, 12, -11, 31, 1, 2, 19, -3, 94, -22, 0, -15, -3, -8, 1, -4, 11, -21, -19, -16, -19, -13, -2, 20, -11, -20, 0, -26, 12, -14, 19, 21, -18, 29, -20, 17, -11, -19, 21, -27, 8, 24, -12, -6, 13, -23, 19, 17, -10, -12, -4, 16, 22, 11, 10, 20, -7, -2, 14, 0, 7, -22, 6, -17, 16, 20, 19, -48, 7, -47, 9, -17, -95, -16, 5, 16, -40, 18, -10, 1, 50, 22, 3, -27, 17, 7, 9, -22, -6, -14, -27, 14, 21, 4, 8, -16, -12, -23, 6, -21, 23, 13, 4, -20, 19, -11, 11, -18, 9, 1, 10, -22, 29, -5, -2, -21, -11, -16, 21, 9, -42, 10, 0, 7, -11, 24, 12, 3, -25, 22, -16, 36, 23, -11, 5, -16, 31, -28, -17, -20, 50, 16, 22, -8, -58, -10, 3, 14, 4, 6, -21, -32, 7, -13, 30, -16, -13, 18, 15, 24, 25, -5, 10, -4, -16, -13, -21, 23, -48, -16, 28, 14, 18, -1, -10, 2, 22, -23, 4, -17, 13, -25, 4, 7, 39, 22, -5, -8, 23, 13, 5, 3, 22, 17, 4, -19, -26, -21, 18, 29, -1, 0, -1, 1, 24, 20, -21, -10, -15, -11, 16, 39, 12, -22, 8, -7, 31, -26, -20, 16, 7, -6, 1, 13, 22, 6, 6, -22, -3, -20, -28, 26, 9, -6, 52, 30, -7, 11, -22, 12, 6, -10, 20, 26, -16, -25, 12, -18, 24, -17, 4, -13, -17, 6, 18, 20, 16, 9, -21, -31, -14, -33, 4, 18, -76, 13, 13, 12, -37, -11, -9, -13, 33, 19, -3, -23, -21, -21, -2, 12, 15, -2, -24, 5, 12, -23, 0, -24, -28, -6, 4, -12, 13, -11, -21, 20, -13, -16, 19, 19, -5, 12, -10, -7, -12, -17, 30, -28, 18, 13, 35, 6, -29, 15, -31, 22, 2, 0, -31, -24, 5, -10, -16, 15, 17, 20, -4, 0, 14, 2, 6, 15, -7, 1, -18, 21, -42, 9, -13, 12, -4, 17, 7, 18, -1, 24, -21, -9, -3, 9, 20, -3, -28, 13, -29, -15, 14, 9, 4, 26, -22, -19, 51, -24, -11, -9, 0, -13, -12, 7, 2, 28, 0, -15, -24, -12, 23, -15, -23, 8, 21, 3, -13, -5, -7, 3, 6, 12, -20, 11, 25, -2, -32, 5, 15, -20, 17, -9, 20, 21, -31, -18, 23, 31, 17, -13, -3, 16, -26, -8, -1, -15, 7, -23, -20, 24, 28, 5, -10, 14, 19, 12, -22, -28, -3, -2, 17, 14, -27, -21, -13, -13, 13, -21, -18, -12, 11, -9, 7, 7, -17, 13, -16, 11, -19, -5, -24, 16, 4, -25, 17, -3, -15, -5, -11, 1, -89, 12, -16, -7, 9, -12, -17, -10, 14, -12, -6, -43, -1, -3, -2, -23, -14, 25, 6, 19, 15, 1, 17, -15, 23, 25, 21, -18, -5, 19, -7, 25, 2, 23, 0, 4, -17, -6, -15, -25, -2, 29, -10, 0, -16, 22, 38, -17, 6, 0, 13, 32, 11, 21, -17, -15, 21, -29, -1, -36, -18, -16, 24, 4, -4, -27, -7, -16, -26, 5, -8, -10, -21, -27, -30, 60, -11, 12, 4, -17, 29, -15, 2, -2, -16, 21, -13, 1, 6, -1, -16, -2, -10, -24, -34, 4, 21, -23, 70, -2, 33, 17, 18, 2, -20, 1, -22, 31, -13, -4, 23, -7, -17, -18, 1, 21, 18, -15, 21, -15, -27, -10, 10, 16, -23, -24, 22, 8, -39, -26, 25, 17, -12, 12, -35, 0, 1, -20, 19, -10, -24, 12, -12, -19, -21, -19, -12, -3, 25, -21, -9, 16, 11, -23, -14, 13, 23, 23, 3, -14, 29, -24, -1, 14, -2, 11, -18, -6, -11, -5, -5, -28, -24, -14, -5, 5, 8, 9, -21, 7, -3, 7, -1, -4, -16, 19, 16, -8, 19, -19, 25, 15, -2, 16, -1, 16, -21, -6, 12, -16, -6, -19, 26, -1, -28, 46, -6, 4, 0, -3, -30, 21, -16, -18, -29, 22, -23, -22, -9, -1, 8, 18, 25, -23, 6, 24, -39, 19, -12, 9, 22, 21, 7, -5, 14, -1, 2, 25, 19, -17, -8, -11, -17, 6, 20, -22, 29, -11, -11, 24, 7, -7, 14, 17, -14, 8, 6, -4, -8, 14, -24, 16, -24, -5, -10, 2, 13, -12, -4, 23, -23, -3, -27, 26, 1, -26, 29, -16, 13, -2, 25, -13, 22, -21, 21, 17, 8, -31, 3, -15, -47, 1, -30, -12, 24, 19, -22, -16, 16, -28, 29, 17, -14, 5, -1, -18, -12, 21, -5, 22, -21, -4, 3, -3, 14, 3, -5, -6, 19, -23, 39, 21, -5, 4, 0, -16, 4, -2, -14, 25, 19, -46, -9, 13, 14, 9, -3, -5, -20, -22, -9, -21, -27, 15, -2, 17, 28, -6, 17, -20, 16, -16, -21, 5, -30, -4, 5, -23, -14, -12, -2, 5, -22, -3, 2, 24, 9, 16, -18, 1, 9, -4, 3, 1, -14, -17, 11, -17, -1, 7, -19, -33, -2, 31, -68, -12, -15, -9, 24, -1, -15, -4, -25, 20, -24, 31, 10, -20, 3, -23, 19, 20, -8, -10, 17, 12, 7, -22, 25, 22, -9, 21, -7, -20, 13, 25, -1, -1, 6, -1, -24, -17, -27, -22, -15, 30, 13, -18, 19, -14, -23, -3, 5, 5, -17, -23, 10, 7, 2, -11, 27, 5, -10, -39, -5, -4, -1, -36, -25, -27, -14, -10, 13, -8, -28, 21, 22, 17, -6, -15, 22, 10, -24, -16, 4, 21, 18, -18, -17, -5, 19, -38, -21, -1, 28, -4, 16, 1, -2, 38, 8, -11, 46, -28, -7, -27, -10, 12, -24, -26, -13, 11, 23, 31, 8, 26, -16, -29, 10, 25, 2, 0, 4, 1, 26, -6, 20, -20, 15, 6, -18, 17, -28, 7, -5, 6, -19, -10, 11, 19, 11, -20, 4, -14, 5, -11, -3, -23, -22, 11, 22, -14, 21, -25, 13, -7, -29, -7, 10, -15, 28, 14, -8, 37, 30, -22, 23, 9, 32, -17, 3, 18, -26, -14, 22, 6, 24, -11, 24, 16, -18, 26, 12, -7, -9, 0, -3, 24, -4, -6, 22, -27, 9, -33, -21, -11, 1, 2, -11, -9, 4, -2, 6, 2, 6, -14, 4, -47, 9, -22, 2, -19, 3, 3, 19, 15, 29, -23, -24, -8, -20, 24, -15, -14, 22, 4, 15, 3, -15, -16, 28, -10, 18, -15, 23, -24, -2, -18, -18, 12, 14, 27, 22, -28, -5, 24, 3, -8, -11, -20, 6, -19, -26, 11, 9, -12, -12, -22, -17, 43, 116, -16, 16, 10, 29, 6, 19, -23, -24, 5, 20, 17, -18, 36, 24, 19, -16, 6, -17, -13, 15, -9, -8, 8, 23, 17, -11, 23, -5, 23, -7, 3, -17, -21, 1, 13, 4, -19, 6, -22, -3, -23, -13, -13, 23, -3, 13, -12, 35, 25, -11, 20, -2, -25, -2, -14, -1, 8, -10, -17, 16, -13, 14, 24, -24, 10, 7, -8, -12, -24, 13, 8, 9, -29, -16, -42, -17, 5, -9, -1, 8, -9, 3, -15, -17, -3, -11, 14, 0, -15, -3, 16, 17, 3, 38, 25, 18, -28, 11, -24, 10, 23, -17, -17, 15, 14, -16, 15, -2, -8, 25, -19, 7, 19, -17, 19, -9, 17, -21, -10, -6, 15, -10, -8, -6, 29, -28, -20, -25, -18, -28, -26, -2, -24, 19, -29, 8, -1, 19, 10, -6, 9, -22, -22, -9, 27, 21, -5, -26, 9, 12, -23, 19, -14, -4, 19, 6, 13, 5, 18, -11, -7, 5, 8, -10, -17, 11, -19, 3, 8, -21, 0, 17, 20, -1, -16, -29, -17, 16, -1, 17, 19, -26, 14, -1, -14, 1, -20, 17, 14, -23, -3, 18, -19, 11, 12, 26, 24, 20, 16, 11, -35, -18, 38, 6, 41, -31, 19, 3, -24, -24, -6, 7, -7, 33, -27, 5, 4, 1, -22, 3, -14, -15, 48, -35, -30, 70, 8, -8, 16, 23, 9, 7, -4, -28, 10, -31, -5, 12, -11, -18, 20, -23, -24, 12, -6, 23, -17, 29, 2, -9, 24, -28, -26, 17, 2, -89, -2, -6, 20, -16, -19, 18, -12, -1, -9, 15, -33, 9, -10, 2, -23, 16, -23, -3, 9, -19, 4, -17, 20, 17, 20, -29, 7, 23, -24, 25, -23, -9, 14, 14, 7, -7, 12, 13, -12, 7, 7, 24, 12, -18, 24, 30, 1, 20, -3, 31, -4, 27, 16, -4, -25, 11, -19, 12, -40, 1, -14, 10, -1, -82, 26, 10, 10, -19, -17, -31, -24, 42, 16, -21, 6, 3, -17, -24, -23, 22, 2, 11, 16, 15, 13, -12, -24, 11, -9, -21, -2, -23, 21, 25, 7, -9, -9, -13, 12, -8, -6, 23, 1, 8, 15, -5, 1, 0, -1, 34, -8, -15, 14, -14, -12, 12, 2, 21, 26, -20, 3, 19, 10, -8, -28, 12, 23, -37, -3, 7, -10, 11, 0, 19, -16, -17, -1, 1, -1, 5, -8, 25, 25, -11, 8, 2, 11, -2, -9, 1, 5, -24, -16, -2, -24, -28, -17, 29, 13, -5, 4, -9, 7, -5, 11, 26, -26, 3, 19, 8, 14, 22, -10, 29, 26, -10, -24, 27, -6, 27, -6, -10, 1, -36, -21, 18, 11, -6, 38, 24, -37, -19, 16, -4, -2, -7, -5, 7, 18, -8, -2, 18, 28, -20, 18, -4, -5, -1, 1, 19, 13, -29, -16, 19, 10, -16, 8, -5, 44, 32, -31, 3, -20, 2, -14, -39, -1, -14, -18, 11, -16, 24, 17, -19, 1, 17, 18, 15, 20, 27, -11, -29, 24, 22, -20, 9, 16, -12, -10, 1, 15, 13, 6, 20, 19, -5, -32, 15, -14, 10, -24, 16, 24, -12, 16, -26, 14, -13, -20, 26, 6, -7, 4, 16, 21, -18, -16, 1, 17, -7, 8, -5, 8, 16, -17, -31, 24, -16, -14, 36, -8, 2, -16, 15, -11, 17, 0, 27, -20, 24, -16, 9, -21, 6, -15, 19, -22, -8, 4, -1, 17, -20, 9, -9, -24, 20, 6, 4, -22, 3, 26, 15, -21, -17, -9, 25, 0, -3, -16, 7, 21, 9, 4, 19, -37, 5, -23, 16, 2, -1, -10, -10, 8, -19, 7, 1, 33, -27, -13, -11, -47, 16, 36, -20, -2, -27, 0, 2, -6, -27, -23, -19, 26, 5, 19, -27, 26, 0, 7, -13, 24, 10, 4, -11, 12, 10, 9, -22, 10, -16, 3, -14, -6, -25, -19, 16, 7, 48, 21, -26, 15, -22, 17, 2, 40, 12, 21, 20, -3, 18, -27, -14, 24, -15, 24, -23, -25, 23, -22, 8, -5, 13, 21, -27, -7, -27, -3, -12, 20, -4, -11, -20, 5, -17, 16, 20, 28, -17, 6, -11, 22, 0, -21, 16, -18, -7, 2, 3, -16, 0, 9, -15, -12, -4, -11, -9, 31, 1, 5, 18, 16, -35, -14, -1, -20, 32, -4, -28, -4, 13, 23, -25, 38, -9, 20, -23, 31, -5, -20, 17, -35, -13, 8, 26, -15, 24, -14, 61, 5, 6, -28, -16, 11, -5, 20, -7, 14, 17, 14, -31, -27, 15, 2, -3, 9, -5, -7, -18, -11, -9, 12, 1, 22, 10, 5, 5, 0, -12, -19, 8, -16, 36, 28, -4, 21, 29, 6, 6, 10, 5, -12, 27, -27, 0, 10, 2, 13, -16, -11, -15, 4, -19, -12, -17, 4, 14, -24, -12, 20, -9, -17, -3, 30, -21, 17, -21, -15, -10, -12, -21, 25, 1, 20, 16, 18, -14, 15, 24, 15, 20, 9, -27, -20, 21, 19, 5, 3, -5, -14, -23, 18, -7, -11, -4, -9, 36, -28, 6, 3, -27, -8, -9, 20, -31, -32, -15, 14, -3, -6, 16, -5, 12, 14, 11, -7, -31, -25, -10, -9, -21, 0, 10, 7, 9, 18, -50, 9, 15, 0, 23, -1, 13, -18, 7, 6, 16, 15, 10, 13, -12, 13, -36, -25, 5, -20, -24, -12, 11, -10, -7, -12, 8, -21, 1, 38, -10, 5, 11, 16, 99, -9, -23, 0, -3, -6, -1, 5, -21, -13, -7, -7, 20, 9, 4, -18, -14, 7, -24, 4, -24, -19, 19, 8, 2, 3, 13, 15, -24, -16, -29, 23, -25, 1, -6, 15, -12, 9, 7, -14, 11, -11, -3, -12, 17, -2, -2, -16, 20, 10, -14, 12, -23, 8, 14, -8, -1, 18, -18, 31, -8, -1, -3, 17, 42, -17, -17, 8, 34, -14, 15, 14, -14, -31, 1, -19, -7, 2, 18, 9, -15, -2, -15, -6, 0, 7, -22, 4, 3, 11, 11, 14, 7, -14, 33, -20, -28, -15, 10, 24, -20, -23, -12, 11, 21, -5, 9, 4, 28, 11, -20, -5, 44, 1, -17, 14, -18, -6, 25, -26, -24, -9, 8, -4, -19, -15, -3, -29, -74, 24, -21, -12, 18, 14, 8, -16, 39, 32, -16, -35, -15, -10, 8, 12, -10, 1, 13, 20, 11, -18, -15, -9, 16, 8, 26, -4, -11, 11, -4, 21, 14, -23, -20, 4, -15, 3, -29, 12, -23, -12, 8, 10, -7, -14, 34, -19, -37, -5, -20, -4, -12, -2, -17, 21, -9, 5, 14, -1, -17, 16, 27, 17, 112, 16, 13, -13, 6, -8, 5, -22, -19, -23, 27, 44, -14, 17, 28, -2, -25, -5, 23, -22, 20, 1, -3, 26, -5, 11, 7, -5, 26, 20, -8, -25, 4, -13, -18, -13, -5, -12, -12, 20, 1, -24, -11, -3, -4, 6, -18, -17, 1, -12, 30, -15, -22, 4, -4, 4, 25, -14, 25, -22, -32, -28, -14, -11, -95, 21, 1, 23, -29, -5, -20, -5, 38, -2, -9, -8, 14, 4, 17, 0, 8, 8, -21, 24, 7, -15, -2, 1, 17, -24, 2, -22, -7, -3, 4, -22, 8, 28, 26, -29, -21, 2, -12, 13, -14, 0, 15, -2, -15, -16, 4, -3, -39, -12, 6, 18, 22, -19, -8, 5, 12, 26, -20, 26, -16, -4, 12, -29, 29, -7, -9, -1, -25, -17, 17, -10, -1, 21, 13, -46, -20, 15, -17, -14, 17, -7, 5, 19, 14, -18, -2, -17, -28, -25, 22, -11, 9, 23, 22, -1, 15, -11, -6, 15, -24, -17, -1, 15, 15, 24, -2, 6, 19, -5, 4, 3, 2, 23, -13, 15, 4, -27, -12, -22, 19, -19, -9, -16, 12, 18, 0, 18, 56, -19, 18, 24, 45, 15, -3, 18, 1, -40, -21, 15, -12, -12, 2, 12, -32, -7, -3, 5, 9, -20, -1, -30, -23, -11, 31, 11, -18, 9, 5, 45, -22, 11, 41, 7, 21, -20, 23, -30, 14, -18, 13, -15, -11, -14, 2, 20, 37, -17, -22, -10, 15, -13, -12, 15, -23, 21, 3, -36, -24, -10, -11, -9, -117, -16, 16, -14, -25, -19, -4, 11, 8, 18, 17, 36, 5, -34, -9, 17, 15, 14, -7, -3, 6, -8, 19, -30, -17, 4, 0, -4, 9, 16, -10, -20, -21, 17, 26, -17, -12, 15, 0, 20, 15, 5, -15, -11, -24, 2, -11, -17, -27, -1, -14, 17, 10, 18, -20, 14, -5, -2, -4, -6, 27, -6, -4, 17, -10, 34, -19, -3, 24, 11, 4, -11, -10, 6, -6, 22, -22, 12, 12, 23, -2, -9, -24, -12, -2, -6, 10, 1, -8, 4, -31, 28, -22, -27, 36, -10, -7, 0, -34, -19, -3, -27, -24, -1, -17, 14, -12, 8, -6, 6, -18, -7, -4, 19, -1, -24, -26, -1, -24, -4, 15, -3, -6, 5, 17, -14, -2, -8, 69, -27, 23, 26, -26, 26, 12, -24, 14, -11, 21, -4, 18, 0, 7, -15, 4, 28, 25, 18, 11, -5, 23, -11, 19, -22, 17, -8, -15, -14, -25, -6, 10, -9, 21, 1, -17, -16, -18, 15, -10, -20, -1, 24, 24, 23, 20, -16, 13, 6, -24, 21, -16, 7, 19, 23, 3, 23, 14, -14, 6, -10, -4, 27, 25, -14, -5, 4, -22, -27, -28, -13, -12, 4, -21, 2, 14, 7, -31, 37, -4, -14, -18, -8, -18, -27, 10, -6, -4, -14, 16, -31, 15, -20, -5, 40, 9, -25, 79, 23, -14, -19, 24, -1, 18, -8, -10, 4, -4, 3, -7, 17, -5, -19, -10, -24, 10, -1, -29, -16, -10, 15, 22, 1, -15, -9, -11, 4, -71, 8, -24, 14, 44, 13, 10, -21, -1, -25, -4, 19, -20, 26, -19, -21, -28, -10, -15, 11, -21, 10, -23, -11, -24, -14, -21, 0, -12, -23, -15, 33, -2, -3, -1, -26, 2, -20, -24, -1, -7, -14, -20, -28, 28, 25, -22, 26, -10, -4, -34, -25, -22, -30, 8, -14, 23, 30, 19, -13, 32, -56, 7, 45, 37, -7, -26, -6, 1, 29, 26, 14, -7, -20, -13, 3, -12, 18, -13, 19, 1, -2, 17, 3, 21, 4, -27, -36, -33, -8, -25, -44, 2, -7, 6, -9, 9, 12, 5, 22, 4, -10, -17, -18, -8, -32, -20, -32, -1, -29, -38, 12, -11, 0, -12, 14, -31, -21, -27, 25, 8, 3, -23, -38, 17, -20, -5, 8, 9, 9, 17, 0, -13, 15, -11, 1, 1, 12, -29, -42, 20, 17, -10, -9, 4, -1, 15, 27, -4, 21, -34, -37, -35, -13, -32, -17, 4, 6, 22, -5, 6, 18, 14, -7, -10, -25, -10, -18, 19, 6, -11, -9, -15, -16, 32, -34, 13, -3, 21, -10, -5, -1, 9, 26, -13, -21, 10, -22, 32, -2, 7, -31, 57, 22, 0, -28, 48, -9, -14, -21, -12, 7, 3, -41, 7, 30, 15, 11, 4, -12, 16, -14, 12, 13, -1, -14, 5, 17, -14, 24, 18, -13, -23, -4, -8, -11, 15, -21, 9, 8, 23, 24, -6, 12, -2, 8, -11, -1, 21, -11, -6, 21, 20, 3, -29, -5, 19, -12, 10, 20, 21, 4, 0, 19, -3, 12, -32, 3, 0, 0, 11, 5, 15, 23, 3, -3, -16, 22, 2, 40, -25, 17, 15, 11, -3, 14, 9, -8, -27, 16, 11, -1, -21, -1, -2, -20, 12, 4, -8, 37, -21, -4, -1, 23, -11, -7, 18, -18, -21, 20, 1, -15, -5, 11, 4, -22, 37, -6, -20, -16, 6, 24, -10, -6, -9, -21, -36, -44, 3, 35, -30, -1, 28, -13, -14, -14, 13, -20, 28, -14, -10, -45, 0, -20, -25, 18, -9, 24, 0, -6, -8, 5, -11, 24, -8, -28, -2, 4, -20, 4, -16, 25, -5, -24, 1, 25, 13, -10, 2, -18, -6, 20, 5, 10, 16, -5, -4, 7, -33, 24, -20, 21, -16, 4, -12, 21, -20, 25, -13, 27, 6, 48, -3, -24, 116, -10, -17, 14, -22, 3, 35, 10, 11, -9, 15, 27, -12, 18, -21, -23, 1, -14, -11, -7, 20, 15, 24, 12, 26, 18, -3, -17, -22, -10, 24, -2, 0, 3, 6, -18, -10, -23, -6, -10, -19, 9, 24, 22, -3, 2, 2, 14, -22, 1, 4, 18, -12, 13, -20, 18, -4, 3, 18, -12, 2, 34, 1, -30, 84, 26, 18, -15, -12, -12, 6, 26, -20, 19, -10, -20, -7, 4, -14, -9, -24, -23, 12, 20, -2, -26, 11, 39, -1, 7, -40, 5, 23, -7, 12, -3, 10, 26, -15, -8, -3, 0, 19, 26, -3, -20, 33, -3, 34, -24, -11, 0, 4, -14, 0, 22, -14, 16, -18, -4, -20, -11, -12, -7, 12, -3, -15, -9, -50, 8, 2, 17, -15, 9, -10, 6, -42, -9, 15, 36, -11, 1, -8, 18, -16, 20, -19, 23, 23, 16, 18, 29, -17, -1, -10, 9, 17, 2, -31, 14, -16, -20, 17, 15, -10, -16, 22, 17, 23, -9, 21, 7, -11, 7, 16, -11, -10, -22, -6, -20, 12, -14, 13, 12, -15, -4, 15, -2, -25, 9, -3, 6, -71, 7, -12, -22, -23, -8, -17, 33, 37, 18, 13, 54, -20, -26, -5, 6, -18, 14, 25, 14, -17, -14, -29, -17, 16, 10, -34, -13, -21, 9, -17, 16, -15, -16, 27, -14, 22, 4, 2, 20, 14, -10, -7, 25, -11, -1, -1, 18, -26, 4, -30, 23, 39, 21, 34, -12, 4, 1, -24, 55, 21, 60, 10, -27, -100, -3, 21, -12, -1, 8, 35, 2, -21, 39, 11, 27, 22, 7, 21, -15, 20, 1, 7, 13, -1, 31, 13, 30, 5, 1, 1, 33, -31, 9, 3, -36, 28, -5, -48, 9, -34, 17, -6, 22, -18, 25, -7, 38, -4, 0, -47, -13, 36, 12, 4, -16, 14, -12, -26, -2, -3, -18, 23, 18, -8, -6, 31, -26, -37, 21, 18, 19, -2, 25, -18, 6, -19, -15, -22, 22, 0, -23, -12, -28, 31, 11, 12, -24, -8, -15, -5, -18, 11, 1, 4, -13, -26, -8, -15, 1, -11, 22, 29, 1, -6, 2, 16, -1, -15, -22, 30, 18, 16, 10, -4, 12, 14, -29, -8, 3, 6, 4, -7, -2, -21, 16, 6, 4, 7, -9, -10, 12, -72, 15, 20, -13, -17, -24, 18, 21, 34, -1, 7, -30, 14, -6, -4, -15, -7, 21, -3, -20, -1, 23, -27, 5, 16, -23, -1, -3, -29, 11, -29, 5, 21, -18, 22, 28, 12, 23, 8, 12, -19, 6, 24, -20, -25, 17, 0, -17, -26, 13, -11, -5, -35, 16, -18, -21, -8, 9, -19, -38, -31, -58, 20, 51, 116, -20, 24, -24, -7, 9, -5, -19, 0, -44, -22, -11, -17, 29, -8, -11, -24, 1, 17, -14, 3, -37, -4, -10, 7, -13, -7, 16, 21, 1, -7, 45, -22, 12, 41, -21, 23, 19, -13, -21, 2, 5, -4, -12, 19, 4, 23, -6, -26, -18, -24, -11, 2, 5, 13, 12, -23, 27, 20, 6, -9, 8, 6, 21, -23, -10, -17, -4, 7, -20, -22, -20, -26, 19, 25, -11, -8, -10, 9, 5, -22, -11, -7, 9, -23, -11, 2, 16, -7, -2, -10, -1, -8, 24, 13, -16, -19, -1, 5, 13, 7, 2, 23, 3, -11, 10, 20, 11, 17, 19, 10, -23, 23, -24, -18, -14, 9, 13, -15, -19, -7, -6, -18, -17, 17, 8, 1, 30, 45, -2, -19, -11, -2, -24, 14, 1, 3, 22, -14, -5, -7, -15, 17, -20, 20, 16, 15, -11, -12, 5, -4, -14, 5, -23, 19, -17, 1, 6, 5, 14, 30, -24, -3, -5, -13, 17, 2, -7, 17, 5, 7, 4, -3, 8, -7, 25, -31, -9, -23, 12, -24, -8, -14, -6, -24, 2, 18, 11, -15, 33, 30, -28, 69, 12, -7, -4, 25, -16, -11, 23, -21, 3, 3, 4, -27, -2, -5, -20, -2, 0, 28, -17, 8, -7, 19, -18, -18, -6, -16, 10, -11, -13, 16, -18, 17, 5, 7, -14, 16, -2, -4, 3, 7, -14, 3, -8, -22, -2, -33, 0, 26, 4, 31, 7, 22, 11, 24, -3, 10, -11, -13, 4, 6, -32, -22, 25, -37, 3, -8, 5, -31, -11, -18, 15, 1, -6, -11, -45, 19, 3, -23, 14, 21, 25, 14, 6, -3, 8, 12, 18, -1, 18, -4, 15, -11, -22, 19, 22, -10, 24, -11, -18, -25, -5, -12, 10, -22, -18, -13, -20, -15, -15, 24, 3, -22, 6, 6, -20, 2, -3, 16, -2, -3, 23, -4, 43, -4, 1, 28, 5, 19, 23, 16, -12, 41, -12, 17, -23, -39, -3, 9, 20, -26, -19, -10, 20, 5, -30, 29, 21, -1, 5, 19, 24, 1, 17, 8, -6, 5, -20, -36, -22, -38, -2, -6, 1, 13, 14, 12, 7, -10, -19, 21, 20, 26, 8, -1, 16, 40, -16, 11, -24, -16, 17, 16, 9, 16, -5, -3, 27, -9, 43, 10, 22, 52, -12, -15, 26, 17, 6, 29, -16, -13, 15, -11, 36, 23, -27, -14, -10, 4, 0, -13, 4, -21, -16, -24, 22, -22, 3, -10, 29, -23, -18, -27, 3, 11, -8, 14, -25, -8, 10, 0, -5, -5, 22, 18, -4, 11, -16, -5, -9, 42, -10, 8, 7, 12, -2, -10, 10, -33, -2, -23, -12, -30, 32, -1, -59, 13, -48, 20, 0, 24, 4, -2, 2, 8, 0, 11, -15, -9, -25, 2, -11, 10, 9, 20, 7, -19, 11, 32, 42, -14, 4, 51, 30, -1, -9, -24, 15, 27, -10, -12, 10, -3, 29, -1, 1, 0, 17, 22, 14, 1, -10, -10, 8, -17, 2, 25, 22, 22, 1, -19, 9, 6, 24, -10, 3, -10, -22, -23, 3, 76, 16, -3, -2, -5, 0, 8, -20, -22, 19, 12, -16, 21, 21, 7, -14, 9, 23, -20, 4, 17, 24, 15, 19, 16, -13, 25, -11, -10, -16, -9, -4, 13, 6, -26, 10, -19, 7, -10, 17, 1, -10, 11, -18, 13, 24, -30, 9, -5, 14, -19, -23, -3, 12, 10, 24, 19, 9, 17, -8, -8, 33, -14, -22, 69, 17, 10, 3, -14, -24, 19, -29, 14, -8, -3, -39, -17, -23, -22, 11, -19, -12, -29, 21, 4, -26, 6, 24, 16, -17, 5, 11, 12, 15, 11, -10, 15, 0, 12, 17, -2, -23, 17, -9, -23, 18, 9, 6, 16, -11, 20, -16, 14, -1, 5, -4, 16, -11, 4, -4, -27, -5, 3, 26, -12, 19, -20, -3, 93, 11, 24, 17, 7, -15, 27, -9, -41, 16, 22, -29, 15, 35, -12, -11, -1, -17, -16, -7, 23, 5, 22, -3, 12, -2, -17, -3, 3, -20, 38, -31, 19, 31, -48, -11, 19, -8, -14, -1, 14, -16, -4, -19, -16, 1, -34, 1, -15, -2, 27, 7, 12, -9, -1, 27, 10, -12, 28, -2, 3, -15, -4, 22, 23, -27, -3, 8, -3, 5, 18, 2, -16, -24, -25, -21, -3, -21, -35, 31, -6, -14, -10, -16, -24, -30, 8, -33, 24, -10, 48, -46, 16, -11, -52, 22, -16, 12, 69, 31, 3, -7, -16, 11, 0, 4, 17, 8, -9, -17, 14, -17, 5, 21, 17, 9, 17, 17, 21, -12, 21, 19, -21, -6, 13, 11, 2, -8, 15, 22, -7, -12, 26, -1, 15, -9, -42, 20, -22, -13, 3, -12, 19, 6, 9, 16, 15, -18, 13, 29, -14, -13, -15, -1, 31, -10, 0, -17, 8, 10, -17, -8, -16, -25, 18, 2, 22, -13, -2, -5, 16, 26, -16, 17, -32, -12, 37, 23, 11, 24, 23, -25, 20, -15, -1, 14, -8, 27, -15, -22, 3, 8, -34, 17, 22, 10, -30, -2, -8, 15, -9, -14, 2, 16, -1, 11, -4, 25, -3, -15, 17, -21, -27, 17, -5, -1, -6, 1, -30, -2, 9, 23, 8, -26, 26, -25, 24, -27, 17, -27, -11, 7, 2, -4, 9, 20, -21, 11, 26, 14, 9, 15, 10, 6, 2, -2, -20, 28, -11, -22, -1, 22, 0, 37, 17, 14, 33, 15, 6, 23, -15, 7, -16, -15, -15, 9, 19, 28, 18, 9, 21, 7, 19, -28, -4, -21, -22, -4, -20, 6, 23, -6, 0, -7, 12, 6, -4, -11, -5, -17, -27, 2, 9, -20, 20, -2, 16, -6, 13, -9, 7, -1, -11, -12, 11, -16, 2, -4, 16, 7, -21, -11, -5, 1, 9, 13, -29, 21, 11, 13, 7, 14, 5, 28, -33, 18, 16, -26, 27, 34, 14, -14, 6, -28, -20, 14, 23, 18, -38, 10, -22, 23, -6, 33, 0, -23, -31, 16, -13, -15, -15, -18, 3, 12, -43, 6, 16, 17, -22, 13, 26, -2, -24, 21, 11, -15, -3, -20, -17, -16, -1, -4, 15, -22, 6, 8, -8, 10, 18, 20, -23, -24, -23, 19, -48, -10, -4, 12, 9, -14, -9, 0, -15, -20, -17, 34, 22, 4, -21, 9, 18, 30, -8, 14, -21, 20, 26, -5, -13, -19, -9, 5, -25, -23, 35, 18, -28, -15, -21, -2, -25, -13, -25, -4, -12, 15, -14, -20, -19, 0, 19, 25, -24, 3, 22, -21, -14, 22, 9, -22, -9, 25, -14, -18, -10, -5, 8, -3, -15, 17, -5, -17, -28, 13, 3, -19, 29, 0, 5, -49, 26, -14, -20, -5, -19, -18, -28, -19, 7, 22, -16, -21, 5, 27, -5, 17, 16, -14, 29, 12, 44, 8, 21, 19, 20, 5, 10, -28, -18, -1, 6, -24, -28, 27, 28, -6, -22, -13, 23, -11, 3, 24, -11, -24, 2, -2, 0, 18, -3, 9, 16, 14, 34, -7, 26, -17, 11, -11, -11, -23, -36, 5, 7, 6, -7, 15, 19, -19, -1, 21, -4, 1, 26, 24, 24, 24, 8, -21, -17, 3, -8, 22, 13, 6, -25, 22, 9, 20, 22, -2, 10, 9, 9, 5, -8, 24, -7, 5, -14, -22, 13, -15, 22, 21, -17, 26, 10, 16, -18, -19, 14, -20, -4, 0, 3, 2, -63, -12, -13, 7, -28, -2, 17, -8, -7, 3, -16, 9, 2, -8, 19, -13, -18, 23, 6, -10, 10, 22, 18, 3, -12, -16, 0, -10, -7, 9, -40, 26, -27, 16, 31, 4, -25, 21, -19, 17, -19, 12, 18, -16, -4, -1, 17, -11, 7, -3, 12, -6, -23, -14, -18, 14, 9, -22, -2, -49, -27, 2, -25, 8, 39, 15, 18, -12, 1, 4, 1, -30, -4, -20, -24, -36, -27, -20, -24, -8, 16, 5, -28, 19, -16, 15, 12, 20, -30, -2, -5, 12, 3, 25, -1, -13, 21, -18, 29, -20, 3, -22, -14, -4, -16, -22, 19, -22, 14, 1, 15, -11, -40, -25, -8, 23, 5, 20, -20, 17, -19, 18, 3, 25, -3, -2, 16, 26, 16, 21, 2, -6, -24, 6, 20, -2, 10, -17, 9, 10, 26, -7, -10, 2, 12, 14, 20, 9, -14, 17, -10, -16, 0, 19, -8, -23, 4, 8, -18, 21, 3, -24, 8, -9, -25, 0, 6, 11, -27, -5, 10, 10, -7, 12, -16, -2, -4, -2, -11, 18, 3, 0, 24, -17, -37, 8, 12, 42, 9, 3, 12, 15, 40, 20, -6, -1, 8, -4, -7, 18, -19, 10, 27, -35, -2, 28, 29, 24, 2, -16, -29, -27, 22, 12, 22, 22, -4, -3, -18, 2, -3, 19, 32, -46, -10, -6, -81, 17, 15, 14, 13, 6, 29, 23, -34, -26, -13, 5, 7, -1, 13, 18, -27, -14, 17, -25, 19, -12, 25, -15, 19, -13, -4, 11, -18, -19, -106, 6, 16, -9, -13, -20, -24, -7, 2, 1, -5, -49, -16, -17, -18, 20, 9, 28, -14, -20, 2, 5, 16, -15, -15, -13, -1, -2, 23, -1, 2, 13, 10, 17, 13, 21, 2, -6, 16, 11, -15, 5, 2, 4, -8, -5, 24, -4, 8, -4, -24, -17, 17, 3, 24, 4, -10, 3, -10, 28, -9, 18, 25, -27, 48, 24, 10, -4, 12, 4, -12, -9, -19, 18, 1, 48, -20, -29, 29, 1, 11, 9, 3, 11, 21, -20, 4, -17, 5, -8, -24, -10, -21, -19, -31, 19, -28, -11, 22, -6, -1, 2, 16, -16, -1, 17, -16, -25, -19, -10, 4, 8, 22, 8, 33, -10, 7, -18, -10, -11, 11, 7, -16, -24, 6, -45, 11, 27, -100, 8, 4, -17, -12, -9, -14, -18, 13, -23, 25, 25, -9, -10, -12, -1, 19, 5, -22, -20, 5, -7, 1, -10, 3, 11, -2, -2, 26, 6, 21, 11, -18, 12, -23, -8, 2, -14, -3, -12, -2, 22, -15, 11, -16, -22, 9, 5, -27, 17, 11, 14, 10, -5, -14, -8, -2, -6, 10, 29, 32, 7, -14, 6, 118, 17, 18, 24, -2, 17, 3, 9, -2, 1, -26, -23, -25, -6, 17, 8, -9, -28, 13, -22, -2, 30, 21, 3, 10, 12, 15, 20, -24, 9, -14, -9, -16, -10, -21, 8, -6, 1, -13, -16, 22, -5, -8, 13, -9, 11, 3, -2, 29, 6, -24, 6, -1, -18, -3, -16, -8, -4, 23, 11, -22, 7, 2, -18, 37, 6, -6, 7, 20, -6, 7, 27, -29, 23, -13, -97, -12, 16, 12, 8, 12, -25, 6, -12, 1, 27, 1, -22, 16, 14, 11, 28, 9, 6, 8, -56, 7, 41, -68, -11, -22, 27, -7, 16, 2, 21, -17, -25, -2, -12, 20, -6, 37, -11, -18, 22, -22, -12, 12, 21, 7, 15, 24, 13, -7, 3, -12, 1, -10, -1, -15, 19, -21, 8, 14, -5, 14, 8, 4, 10, -4, 32, 17, 19, 9, -14, -9, 2, 1, -11, -12, 38, 27, -20, -34, 49, -20, 8, 22, -30, -1, 8, -42, 20, -20, 4, -1, -10, 33, -13, -23, -2, -13, -14, 30, -14, -6, -20, -5, 25, -19, 23, -20, -14, -15, 19, -2, 22, 0, -6, -5, -1, 106, -12, -21, -10, -24, 5, -9, -30, -10, 24, 16, -31, 8, 8, -13, 0, -13, -9, -23, 24, -17, 6, 6, 0, -18, -3, -6, 12, -18, -13, -10, 1, 21, 19, 21, 5, 15, -11, -13, -8, -6, 22, 13, -1, 14, 27, -16, 10, -32, 3, 1, 22, -19, 16, 4, 2, -3, -8, 20, 12, 19, 31, 26, 22, 54, 14, 6, 8, 2, -20, 12, 21, -16, 25, -13, 38, -25, 9, 26, -16, -1, -5, -17, -23, -33, -25, 27, -3, -19, -10, -24, 23, 0, 11, -10, -18, 14, 9, -2, -2, 2, 22, 18, 3, 4, 17, -18, -1, 10, -23, -29, 1, -9, -20, -24, 18, -16, -25, -27, -7, 19, 1, -7, 17, 10, -2, 21, -5, 63, 9, 21, -19, 2, -22, -9, -22, -19, 18, 18, -41, -21, 9, 17, 13, -30, 3, -2, 7, 3, -10, 26, -5, 1, 16, -4, 0, 15, -9, 38, 9, -30, -24, -22, 3, 18, 24, 17, -27, -10, -18, 18, -10, 9, 3, -13, -27, 31, -9, -28, 13, -1, 24, -3, -24, -14, -10, -18, 25, 3, 6, 4, -34, 64, 20, -2, -12, -5, -24, 9, 15, -9, 12, -22, -35, -21, -26, -19, -19, -7, -18, 4, -1, 2, 25, -15, -8, 7, 24, 18, 5, -11, 25, 1, 20, -16, -19, 18, 22, -23, -6, 8, -21, 13, 10, 1, 25, 3, 28, 0, 6, 37, 18, -6, -19, -22, 3, 2, 5, 5, -10, 26, 16, -23, 17, -8, -7, -68, -18, -14, 25, 26, -8, 20, -26, -8, 4, 21, -26, -2, 2, 26, 31, 20, -15, -23, -10, 22, 11, 11, 22, -17, 28, -24, -11, 11, -17, 12, -23, 8, 26, -24, 1, 26, -8, 15, 25, 15, -9, -29, 20, 0, -6, 18, 8, -18, 24, 24, 20, -11, 5, 20, -12, 21, 1, 2, -5, 22, 10, 1, -17, 0, 7, 3, 13, -20, -1, -29, -13, 10, 21, -4, -30, 27, -10, 0, 2, -21, -4, -14, -3, -24, 5, 16, -16, 8, -8, 8, 26, -24, -14, -1, 26, -20, -23, 4, -18, -8, -24, 24, 20, -14, -21, 17, -25, -13, 14, 32, -9, -17, -15, -16, -23, -26, -1, 6, 22, 1, -20, -22, 25, -2, -3, 11, 0, 120, 8, 22, 18, 34, 5, -16, 4, -41, 5, 18, 61, -24, -12, -17, 7, 18, 9, -20, 1, -3, 6, 10, 26, -23, 11, 20, -13, 7, 22, -22, 22, -30, -14, -15, -3, 10, -4, 11, -14, 7, -13, 2, 4, 7, -5, -16, 10, 42, 9, 23, -23, -24, -3, -12, 22, -3, 1, -8, -9, -13, -20, -8, 26, -58, 4, -20, -5, -38, -18, -8, 1, 55, -11, -20, -44, -28, -3, 1, -22, 1, 6, 6, -5, -8, 1, -12, 2, 27, -17, -1, 25, 7, -16, -24, 13, 26, 20, 29, -15, -14, -19, 14, 4, 7, -18, 0, 1, -11, -26, 1, 8, -23, -21, 18, -25, -8, 21, 12, 3, -7, -26, -26, 10, -6, -15, -29, -18, 5, 5, 19, -18, -19, 16, -11, -13, 41, -22, -19, -18, 20, -3, 15, 7, -2, -19, 16, 25, -19, 4, -15, 1, 20, -19, -27, -2, -9, 29, 12, 19, 24, 13, 13, -8, -16, 7, 5, -8, -11, 11, -10, 23, 11, -9, -7, 14, -44, -19, 28, -25, 31, 22, -20, -6, 30, -17, -6, -27, -19, -8, -9, -6, 21, 13, -16, -19, 19, 4, 22, -5, 4, -17, 13, -15, 23, -18, -12, -1, 13, 19, 28, -7, -3, 28, -15, -25, 21, 9, 54, 13, -3, 21, 4, 39, 3, 19, -10, -29, 20, 12, -12, -19, -18, 4, -16, 3, 8, 30, 6, 19, -21, 8, 15, -17, -20, -17, 27, 22, -20, 16, -3, 1, 14, 21, 17, -7, -52, -9, 17, -15, -1, -13, -2, 23, 8, 21, -11, 26, 19, 10, 27, -20, 21, 14, 8, 11, 19, 12, 3, -19, -8, 14, 8, 5, -13, 26, -9, 13, -3, 20, -32, 20, -24, 24, -27, 12, -28, -9, 20, 18, -10, 21, 17, 25, 26, -21, -2, -25, 16, 20, -12, 5, 24, 18, 21, 34, 17, 23, 1, -22, -7, 22, -11, 22, -6, -17, -17, 23, -17, 18, -4, 18, 13, -15, -2, -14, 24, -21, 18, 23, -8, 13, -3, 16, 26, -9, 20, -18, -19, 11, 2, 9, 18, -2, 5, -23, 8, -15, 13, 17, 25, 24, -17, 20, -6, 11, -14, 17, 19, 1, 4, -16, -2, -20, 9, -20, 25, -10, 17, 9, 10, -7, -12, -15, 13, 39, -21, -22, 20, -18, 17, 21, -39, 8, -9, -10, -15, -53, 11, -33, -4, 12, 13, 1, 18, 31, -12, 19, 5, 4, 2, -5, -13, 9, -23, -40, -23, 28, -17, -26, 3, -25, -7, -4, -21, -19, 4, 12, 23, 6, -17, -8, -5, -1, 2, 9, -25, -28, 2, 5, 11, 23, 23, -24, 37, -20, -12, 51, -3, 14, -30, -22, -17, 14, -7, 22, 10, 5, -16, 18, 1, 22, -7, 12, -8, 27, 13, 12, -7, 14, -9, -49, 4, -5, -59, -52, -10, 25, 40, -3, 13, 5, -18, 31, -11, -20, -4, -20, -11, -9, -4, 15, 4, -34, -30, -34, 21, 15, 23, 17, -16, -2, -25, -7, -7, 4, 19, -1, -11, 22, 8, 14, 58, -31, -14, 0, 8, 14, 0, 18, -24, 13, 4, 23, -15, 23, -4, 21, 11, -12, -12, -6, -13, -8, 7, -13, 24, 14, 24, -17, 21, -20, 57, 31, -2, 6, 15, 6, -5, 17, 14, -5, -23, 15, 17, -4, -24, -10, 12, -17, 27, -10, -7, -16, 8, -12, 26, -22, -37, -4, 18, 11, -41, 32, -5, -36, -32, -11, 3, 13, -25, 2, -30, 0, 0, 20, 28, 3, -28, -2, 23, 24, 27, -9, 26, -1, -4, -31, 25, 10, 3, -10, -20, -11, 27, 16, 7, -23, 36, 14, -3, -11, -22, -17, 2, -2, 6, -1, -10, -19, 23, 27, 34, 27, 0, -26, -12, -21, -18, 1, -10, -17, 26, 1, 18, -12, 4, -34, -1, 22, 32, 42, -21, 1, 26, 14, 2, -25, 3, -31, -13, -27, -18, 3, 14, 37, -24, 21, 15, 4, 7, 24, -25, -35, -11, -22, -61, -34, -26, 12, 34, 10, -29, -1, 16, 26, -14, -1, 17, -9, 26, -30, -22, -4, -5, -2, -37, -21, 24, 19, 30, -9, -13, 13, -20, 4, -14, -23, -7, -38, 4, -42, -25, 9, -77, 14, 26, -20, 14, -1, -14, 0, 24, -27, -17, -52, -20, 10, 16, 22, -2, -17, -10, 23, -13, 27, 15, -9, -20, -30, -22, -20, 0, 12, 9, -8, 7, -22, -3, -14, 20, -24, 23, 3, 19, -20, 8, 16, -14, 13, 37, 18, 1, -21, -17, -8, 5, -13, -18, 23, 13, -28, -2, -13, -1, -6, -13, 27, -91, -5, 25, 8, 11, -18, 17, 20, 20, 2, 2, -45, 12, -17, 13, 11, 24, 22, -6, 27, 9, -1, 12, 11, 6, -9, -6, 12, -25, 21, 19, 1, 5, 13, -1, 26, -28, -17, -25, -6, 24, 13, 6, 20, -9, 21, 17, -5, -4, 10, -17, 3, 9, -13, 4, -26, 15, 9, 13, 38, 34, 38, 0, -35, -7, 18, 19, -14, -27, -2, -10, -18, -42, 28, -1, 30, -20, 0, 13, -27, 21, 14, 31, 11, -8, 14, -16, 22, 14, 26, -22, 30, -16, 4, 0, -4, 4, -13, -1, -9, -19, -30, -19, 21, 17, 23, 18, -6, -22, 29, -41, 5, 21, 21, 23, 27, -30, 9, -16, -8, 31, -11, -15, -22, -11, -14, 7, 9, 10, -12, 3, 19, -19, 4, -10, -28, -10, -15, 3, 29, -2, 78, -18, 34, 22, 23, -29, 12, -2, -14, 25, -35, 4, -18, 17, -16, 17, -7, 47, 47, 14, -45, 28, 21, 23, -6, 20, 11, -3, 0, -20, 16, 7, 15, -11, -18, 5, -10, -1, -22, -17, 6, 31, -7, 5, 17, -24, 2, -18, -43, -11, 11, 28, 11, -11, -20, -35, -15, -9, 15, 29, 7, -10, -78, -21, 13, -11, -28, 2, -10, -25, 3, -4, -3, 7, -17, -22, -15, 29, 11, -5, 15, 16, -11, 27, 12, -9, 20, 1, 28, -10, 14, 21, 15, 12, 1, -11, -20, 15, 23, -32, 19, -16, 3, -19, 1, -17, 1, 10, 15, 21, 29, -12, 20, -1, 1, -14, -22, 11, -26, 4, 26, 16, 5, -23, 16, 10, 13, 28, 12, -23, -5, 8, 17, 22, -2, 7, -25, 9, -18, -16, 2, 9, -28, 15, 18, -3, 15, 3, 7, -17, -7, 17, 23, 17, -29, -13, 12, -10, 1, 4, -12, -30, -23, -25, 19, 26, 24, -7, -14, 11, -18, 23, -7, 0, -15, 1, -23, 11, 0, -101, -4, 3, 5, 17, 0, 0, -13, 5, 4, 17, 4, -18, -1, -1, -8, -13, 21, -17, -24, -20, -15, -12, 10, -24, -5, -22, -7, 2, 15, -8, 19, 22, 24, -1, -26, 12, -2, -6, 22, -6, 5, -25, -9, 8, 18, -2, -15, -9, -7, 28, -5, 16, -30, -13, 8, -18, 22, -4, -27, -25, -18, -21, 8, -54, -5, -11, -5, -11, 17, -28, -21, 8, 21, 18, 27, -1, -6, 16, -22, 0, 26, -5, -11, 11, -14, 7, -27, -1, 1, -28, -6, 17, 15, 23, 20, 30, 5, -4, -1, -26, 26, -22, -22, 12, -11, -23, -5, 15, -13, -1, 17, -7, -7, -17, -19, -5, 7, -8, 16, -10, -4, -14, -5, 15, 41, -12, -12, 95, -26, 0, -17, -24, 25, 31, -11, -7, 9, 21, 15, -3, -22, 22, 3, 11, -11, -2, -10, 15, 11, -14, 18, 12, 17, 14, -19, -17, 29, -4, 2, -12, -14, -6, -10, -2, -3, -14, 12, 6, 18, 24, 10, 7, -8, -23, -3, 27, 28, 20, -4, 0, 10, -23, 10, 4, -16, 24, -9, 17, -20, -25, 17, -44, 9, -2, -10, 13, 11, -29, -18, -5, -20, -16, 3, -1, 18, -18, 23, -9, 3, 27, -5, 27, 20, 12, 2, -15, -4, -10, -6, -22, -27, -26, 4, -5, -2, -18, 23, -19, -11, 27, 6, -24, -10, -12, 22, 27, 17, 1, 21, -18, 13, -6, -19, 5, -25, 0, 13, 2, 17, 16, -11, -3, -3, -23, -7, 25, 19, 13, -24, -56, 19, -23, 2, 46, 1, 22, -50, -16, 15, -20, 21, 7, 19, -33, 11, -23, 9, -15, -4, 19, 0, -20, -4, 7, -16, -19, 9, 20, 22, 5, -26, -4, -14, -7, 1, -17, 20, -24, -7, 17, 23, 4, 26, -12, -20, 16, 21, 3, -16, -15, -12, 9, 12, 5, -38, -4, -10, 3, 20, -19, 6, 18, 25, -26, 15, -3, 21, 43, -19, 5, -45, 4, -35, -21, 15, -7, -1, 17, -14, 23, -26, -14, 16, -26, 14, -18, -4, 21, -16, -17, -18, 6, -22, -2, 1, -27, 7, -2, 20, -9, 21, 25, 16, -32, -18, -2, -13, -11, 9, 4, -6, 1, -10, -20, 10, 0, -27, 25, 17, -24, 24, -2, 0, 66, -9, -28, 2, 44, -17, -9, -18, -39, 7, -23, 15, -14, 1, -19, 30, 1, -5, -13, 15, -15, -15, 10, -17, -12, 2, 21, 4, 12, -25, 20, 38, 1, 8, -9, -14, -11, -12, -27, -8, -2, 4, 10, -16, 8, 12, -1, -18, 0, 22, 18, -3, 15, -5, 2, 15, -17, -20, -22, -21, -11, -8, -6, 34, -96, 11, -16, -18, -22, 5, -31, -4, 17, 23, 20, 6, 12, -12, -26, 3, 2, 16, -28, -10, -18, -18, 17, -14, -27, 3, -30, -23, 12, 14, -10, 23, -16, -16, 15, -2, -26, -13, -9, 22, 1, 9, -13, 12, 5, -10, -3, 24, -23, 9, 3, 12, -14, -26, -16, -24, 22, -2, -24, 8, -2, -3, 24, -12, -62, -7, 5, -3, 31, -29, 8, -23, 0, -1, 13, 33, 19, 4, 19, 8, -1, -26, 15, 3, 5, -21, -24, 16, 16, -1, 9, -12, -13, 17, -9, 33, -26, -19, 29, -4, 17, -8, -8, -4, 9, -23, 12, -12, -2, -4, 11, -15, -6, 8, 23, -9, -9, -26, 5, -18, -18, 4, -3, -16, -21, -4, 15, 1, -34, 17, 20, -13, -15, 28, -4, 16, 16, 3, -24, 17, 5, 3, -3, 29, -14, 17, 4, 13, -14, -2, -12, 16, -14, -13, 17, -28, 23, 23, -23, -25, 5, 20, -13, -13, -15, 13, -21, -5, 8, 18, -24, 3, -7, 19, -9, -12, -32, -11, -12, 16, 7, -19, -12, -8, 5, -5, -22, -42, -1, -48, -2, 3, -70, 1, -8, 7, -12, -7, -14, 15, 16, -11, -7, -13, 14, -39, 13, -23, 16, -22, 11, 3, -6, 4, 16, 12, -24, 7, -8, -13, -12, -24, -28, 40, 17, 16, 48, 4, -13, -14, 3, 6, -15, 19, 1, -7, -16, -10, 29, -31, -36, 29, 4, 27, -16, 22, -16, -23, -12, -15, 18, -1, 28, 11, -8, 3, -4, -20, -25, -4, -1, 25, -20, 18, -57, -34, -8, 42, 0, 28, 5, -20, 18, 19, 5, 8, 4, -15, -15, 12, -7, -10, 6, 4, 25, -24, -14, 14, -29, 5, -12, 26, 10, 13, -5, -20, 2, -18, 10, 14, 15, -11, -32, -5, 29, -4, -15, -12, 28, -5, -2, 14, -8, -20, -19, 30, 13, 11, -14, -10, -89, 26, -11, 6, 3, -5, -4, -25, 5, 11, -2, -65, 6, 11, 6, 15, 17, 20, -18, 2, -23, -19, -10, -10, -5, 5, -13, 10, -24, -26, -12, -20, -18, -4, -26, 28, -23, -17, -18, -18, 23, 25, -24, 23, -27, -8, -5, 4, 15, 10, -10, 10, -12, -8, -2, -25, 26, -22, -11, 16, 0, 3, 12, -41, 10, -19, 3, 17, -12, 16, 0, 23, 27, 21, -3, 8, 12, -41, -9, -23, -5, 26, 18, 3, -8, 0, -4, -32, 0, 0, 48, -40, 11, 21, -61, 44, -26, -27, 22, 5, 9, -23, -3, -23, -2, -14, 39, 1, -2, -1, 24, -21, -36, -12, 20, -8, -16, -16, 17, 30, -19, 15, 36, -32, -19, -40, 13, 3, 19, -17, 9, 27, -23, 26, -21, 3, 18, 12, -21, 7, -13, 28, -19, -5, 9, -18, -19, 31, 8, -11, -10, 14, -10, -11, 5, -31, 22, 20, 32, 43, -1, -15, 36, 15, -4, 3, -5, -19, -1, -18, -4, -11, 12, 19, 17, -14, 13, 19, 12, -10, -14, 6, -12, -9, -16, 16, 20, -44, 11, -65, -17, 16, 88, -4, 5, -22, 24, -6, -22, 1, 18, -50, -28, -32, 9, 29, -12, -15, 3, 5, 11, 7, -26, -18, -13, -8, 12, 3, 15, -20, 10, 12, -13, 33, -10, -40, 45, -21, 15, -15, -13, -11, -10, -31, -20, -15, 18, 14, 9, -23, -11, -15, 6, 13, 26, -16, -7, -19, 17, 14, 15, -22, 17, -24, 12, -10, -2, 14, -19, -5, 39, -15, 6, 21, -15, 4, -14, 12, 31, 7, -18, -29, 11, 24, 4, 18, -4, -13, -21, 19, -21, 22, 24, -4, -8, -24, 20, 22, -10, 16, -25, 6, 21, 13, -10, -11, -27, 3, -8, -2, 0, -10, -7, -4, 11, 24, -18, -28, -5, -10, 6, 3, 9, -13, -9, -23, -30, -38, 1, 0, -127, -6, -25, -5, -5, -12, -22, -9, 21, -13, -2, -40, 5, -10, -21, 7, 1, 23, -4, 11, 26, -16, 26, -4, -25, 18, -15, -5, -3, -14, -18, 1, 18, 5, 25, 9, 12, -15, 13, 20, 14, -2, -20, -26, -4, -10, 27, 20, -27, 9, -13, -3, 0, -25, 5, 16, 17, 5, 11, -2, 4, -4, 16, 0, 46, 3, -12, -12, 24, -23, -5, 28, 17, 23, 25, -45, -15, 9, -7, -1, -10, -2, 19, 14, 12, 12, 7, 17, 7, -7, -3, 17, -18, 20, 31, 12, -19, 2, -45, -18, -14, -22, -4, 23, -30, 2, 12, 8, 15, -18, -23, 1, 5, 20, -8, 24, -3, -29, -19, -13, 24, 0, -14, 30, 11, 7, 5, 23, -20, 2, -13, 6, 17, 2, 31, -25, -22, 19, 6, 42, 8, 30, -24, 1, -4, 15, 20, 6, -10, -21, -13, -6, 7, 1, -27, -4, 8, -24, -5, -15, -36, 25, 21, -10, -4, -5, -12, -16, -11, -4, -6, -15, -23, -6, 0, -11, 14, 12, -24, -17, 19, 7, 1, 20, 22, -5, 3, 1, 3, 1, -9, 17, 59, 21, 8, 8, 5, 26, 29, -21, -4, -5, -29, 25, -20, -29, 4, 21, 9, 1, 11, -8, -5, -24, 7, 28, -13, -15, 17, -18, 26, 21, 18, -20, 13, 13, 17, -6, 6, 20, -19, 20, -3, 26, 2, -7, 23, 1, -7, 12, -19, -23, -2, -25, -17, 15, 23, 7, -2, -14, 17, 14, -24, 18, 13, -21, 13, 21, 29, 11, -20, -9, -15, -22, -5, -18, 14, -23, 22, 12, -14, 17, -11, 25, -21, 3, -10, 23, 26, 2, 19, -21, 4, 22, 17, -23, -10, -3, 21, -11, 19, 7, 4, 4, -26, -22, -21, 11, -16, -13, 18, -11, -15, -15, 1, -1, -19, 1, 8, 17, 21, 5, 13, 17, 10, -2, 20, 37, -7, -12, 103, -9, -22, 2, 24, 24, 9, -14, 9, 13, 12, -30, 14, -11, -10, 11, 24, 11, 8, 0, -12, 7, 2, 5, -22, -18, -20, 2, 9, -3, 18, -4, 21, -15, 9, 11, -10, -21, 6, -1, -20, 16, -12, -12, -7, -12, 10, 15, 15, 2, -9, 8, 11, 1, -25, 16, 24, -10, -31, 27, 22, 7, -12, 5, 39, -5, 22, 20, 13, 16, -2, 14, -31, -23, 8, 71, 14, 14, -32, -12, -23, -2, -14, -18, -7, 7, -4, -29, 30, 13, 11, -35, 15, -21, 23, 19, -49, -35, -3, 17, 17, -6, 22, 7, 23, 29, -23, 1, -6, 34, -33, 2, 24, -9, 22, 0, -2, -18, -23, -5, -22, 6, -17, 28, -12, -17, 6, -26, 18, -15, 24, -6, 44, 19, 26, -7, -34, -24, 6, -1, 16, 16, -10, -19, 9, -27, 25, 8, -3, -1, -19, -16, -24, 22, -2, -8, -14, -20, 6, -10, -22, -1, -17, 16, -17, -11, 15, -10, -13, -6, -7, -16, -8, 4, -31, 3, 35, 14, -22, -7, 26, -4, 31, 31, 23, 8, 4, 26, -22, 31, -3, -7, 69, -12, -2, -22, 51, 11, 28, 16, -45, -5, -3, -56, -17, -2, 20, -13, -23, 22, 14, 23, 11, -8, -7, -26, 14, 11, 26, -6, -7, 15, -8, -14, -35, -17, 7, -16, -24, 21, 22, -22, 18, 0, 19, -21, -17, 9, 0, 20, 8, 14, -12, 24, -6, 12, -21, 19, 17, 12, 3, 17, 10, -22, -21, -8, -33, -1, -3, -14, 3, 10, 3, -2, -3, -30, 12, 44, -24, 26, 12, 1, 15, 3, -8, -13, 20, -28, -5, 18, 2, -25, -4, 7, -28, -25, -5, 1, -16, 1, 17, -13, -18, -15, -3, -14, -11, 1, -22, 17, -16, 23, -3, -20, 26, 19, -28, -14, -19, -6, -5, 7, 2, 13, 12, -9, -1, 35, -5, 8, 9, -32, 5, -6, 4, -6, -20, -23, 16, 4, -9, 50, -23, 0, 10, 21, 7, -12, -24, -2, -27, 5, 30, -24, 23, -21, 14, -20, -3, -26, 4, -2, -5, -3, 18, 9, -10, -6, -5, 8, 20, -13, -20, -3, -9, 21, 20, -16, -24, -22, -10, -6, -10, 4, 24, -5, -26, 4, -5, -32, -5, -7, -5, -39, -20, -9, -1, -13, -19, -26, -5, -20, -3, -24, 10, 14, 5, -24, -9, 13, 6, 7, 13, 21, -9, 1, -4, 22, -11, -8, 4, 30, -5, 14, 16, -12, 9, -25, -23, -12, 20, -20, -27, 27, 6, 20, 30, 20, -8, 20, 29, -18, -10, -18, -12, -23, 7, -4, -14, 18, -17, 10, -13, 1, 6, 3, 20, -19, -74, 16, 4, -18, -2, -8, -20, -10, 14, -21, 21, 13, 5, 23, 24, 17, 24, -13, -11, 7, -6, 23, 13, -13, -14, 0, -10, -14, -28, -28, -2, 2, -28, 8, -36, 1, -1, 13, -8, -14, 16, 2, -9, -28, -7, -20, 29, -5, 8, -7, 19, -21, 23, -27, 6, 17, 23, -23, 18, 13, -1, -12, -21, 12, -18, 7, -5, 13, -1, -9, 17, 7, 22, -10, -31, 67, 10, -1, -9, 6, -9, 25, -12, -10, -24, -10, -10, 13, 5, 10, 10, -14, 16, -6, 34, 21, -25, -5, 21, 22, 0, 20, -8, -15, 5, -2, 21, -27, 10, 14, -21, 4, -34, 17, 15, 3, 14, -15, -4, -6, 15, -14, 14, 22, 32, 36, 10, -1, 71, -9, 1, -3, -5, -20, -13, -23, -51, 14, 17, 15, -18, 1, 14, -1, 12, -15, 14, -13, 7, -2, 17, 11, 30, 9, -23, 16, 16, -7, 7, -20, -13, 0, -23, 16, -21, -20, 2, 2, -7, -21, -7, -7, -15, 15, -20, -8, 29, -22, -5, -2, 5, 17, -17, -7, 7, 17, -20, 8, -26, -38, 6, -22, -99, 15, -7, 12, 1, -1, -31, 16, 14, -14, -17, -15, -4, -10, 4, 12, -17, 26, -13, 11, 4, -22, 17, 6, -16, 23, -8, 0, 19, 22, -15, -3, 20, 20, 29, 16, -2, -9, -23, -20, 17, 17, -13, -15, -24, -22, -7, -24, 17, 4, -3, 22, -14, -19, 16, 2, -4, 9, 15, 18, -13, 2, 3, 3, -7, -26, -16, -18, -1, -8, 12, -6, -9, 1, 5, 41, 25, 25, 21, 12, -12, -2, 30, -4, -22, 18, -22, 9, 1, 7, 16, -17, -16, 2, -14, 21, 16, -12, 20, -11, 16, 10, -25, -25, 30, -13, 15, -5, -10, -17, -29, 6, 35, 25, -24, -10, -13, 3, -8, 9, 31, -7, 16, 28, 0, -22, -22, 58, -52, 32, -20, 25, 3, -3, 6, -9, 4, 23, -21, 21, -15, 16, -7, 18, 18, 15, 15, 22, -10, 7, 6, -16, -10, -16, -24, -5, 15, 2, -15, 30, -33, 14, 22, -24, 8, -11, 7, 14, -18, -9, -18, -2, 11, -25, -35, -24, 2, -5, 14, -6, -4, 1, 20, 1, 4, -23, -6, -6, -10, -28, -13, 20, -90, -23, -13, -13, 21, 20, -2, 13, -9, -11, 5, -2, 14, -8, 22, -4, -4, 3, -11, 21, -1, 20, 14, 13, -25, -26, -3, 17, -6, 17, 31, -12, 15, -14, 18, -25, 4, -9, -21, 11, 20, -12, 15, 0, 15, -19, -5, -8, 1, -15, 13, -10, -30, -4, -17, -3, -15, -5, 11, -11, -21, -21, 4, 4, -82, 26, 17, 14, -66, -7, 3, 22, 44, 7, -29, -64, 6, -19, 13, -7, -8, 19, 0, -14, -11, -13, -27, 6, -6, 11, -15, 26, -23, 5, 13, -13, 43, 14, 1, 2, -24, -3, 4, -12, 9, 19, 14, -19, -31, -26, 15, -25, -27, 17, 5, 13, -11, -9, -19, 1, -23, -6, -13, -24, 10, -48, -30, 11, -54, 17, -1, 26, -47, 4, 10, 14, 45, 25, -21, -16, 11, 17, -25, 0, 11, -17, -16, 2, -6, -8, 6, 17, 16, 3, 4, -9, 7, 10, 31, -21, -3, -25, 8, -11, 1, -6, -13, -26, 23, -22, 16, -21, -25, -4, 43, 20, -53, 22, -6, 2, -19, -6, 5, 2, -25, -17, -4, 22, 14, 9, 34, 0, 115, -20, 4, 16, 32, 19, 0, 12, -23, -1, 4, 19, 2, -20, 22, -19, 10, -26, 23, -19, -22, 6, 13, -5, -18, 26, -18, 8, -20, 16, 18, 21, 10, 13, -3, -20, -21, 29, 4, 7, -3, 24, 16, 14, 11, -19, 18, -4, 1, -8, 11, -10, 4, -7, 8, 0, -4, 14, -27, -19, -13, -15, 23, 36, 75, 10, 25, -6, 53, -18, -25, 13, -43, 5, 27, 35, 0, 12, 0, 13, -11, -18, 17, 17, -19, 6, 17, 28, 16, 26, -9, -25, -6, 16, 21, -19, -46, 14, -4, 9, -8, -26, -3, 10, 3, 10, -22, 10, -13, 1, -14, -20, 15, 23, 9, -1, 6, -13, 4, 7, -22, 12, -21, -25, -29, -36, -22, 29, 68, -29, -30, -17, 36, 10, 21, 22, 17, -48, -9, 96, -12, -5, -6, 19, -5, 6, 16, 3, 16, -17, 31, -20, -9, -24, -20, 3, 22, 6, 19, 21, -20, -23, 48, 10, 29, 2, -15, -10, -1, -8, 9, 12, -4, -13, 19, -14, -33, 25, -8, -9, 2, 13, 16, 14, -2, -9, -1, -11, 14, -20, 21, 6, -15, -4, -8, -12, 32, -28, -4, -1, -40, 8, 16, 22, -13, 31, -15, 13, 13, -5, 16, -14, 25, -19, -3, 24, 25, -17, 22, -2, -20, -21, -17, -11, -23, -2, -26, -11, 12, 7, 22, 21, 11, -8, -23, 6, -12, -13, 5, -4, 28, -26, 5, 15, 6, 12, -4, -21, 14, -5, 9, 1, 20, 40, 8, -28, 0, 22, 10, 1, 4, -25, 8, 15, 8, 18, 19, -18, 17, -29, 26, -54, 13, -1, 1, -12, 5, 26, 5, 18, -3, -11, -3, -8, -15, -18, -49, -61, -5, 32, -97, -36, -8, -16, 3, -13, -28, 1, 10, 12, 21, 5, -27, -10, -7, 32, 23, -29, -10, 9, 9, 20, 0, 11, -4, -24, -16, 14, -11, 23, -18, 25, -7, 3, 10, 0, 5, -3, -4, 12, 33, 25, 7, 14, -17, -13, 19, -15, -28, 19, 10, -24, 19, 26, -10, -27, -41, 26, 10, 18, 15, -25, -14, 16, -9, -13, 13, 11, 21, 7, 12, 26, -5, -26, -18, -20, 19, -24, 19, -28, -25, -10, 30, -27, 5, -15, 29, -4, 10, 21, 10, 17, 5, -2, 40, -12, -4, -21, 24, 20, -4, -14, -9, 5, 20, -16, -27, -3, 3, -25, 31, -19, 24, 3, 1, -5, 4, -41, -16, -10, 33, -43, 20, -3, -46, 9, -42, -18, 39, -23, 17, 14, -7, 10, 7, -19, 3, -5, 25, 36, -16, -19, 29, 22, 12, 4, 5, -24, 0, 8, 3, -16, 27, 20, 29, 26, -21, 3, 112, 8, 7, 5, 4, 6, 26, 15, -15, 7, -6, 33, 0, -2, 19, 8, -5, -15, 12, 6, 2, -3, 26, -7, -20, 17, 13, -23, 18, -7, -22, 5, -25, -24, 0, -7, -21, 28, 0, 5, 17, 7, 9, -18, 1, 10, 0, -14, 12, -16, 14, -2, -4, -5, -12, -5, -14, -14, -15, -7, -2, 35, 25, 2, 35, 0, -26, 18, 44, 16, -10, -25, -2, 9, -17, 40, 14, 49, -14, 6, -16, 11, -17, -2, -26, -28, -5, -4, 10, -2, 39, -22, 28, -13, 29, 8, -24, 6, -34, 17, -3, 26, -13, 23, -3, -2, 14, -19, 4, -8, -32, -22, 23, 8, 0, -13, 21, -29, 17, -17, -14, -6, 10, 16, 27, 30, -4, -17, -31, 20, -21, -1, -15, -26, 29, 27, -38, 8, 28, -50, -24, -7, 9, -19, 19, -9, -22, -19, 19, 5, -3, -25, 11, 2, -28, 27, 15, -27, 22, -13, -15, -6, -6, 19, 18, -2, 14, -12, 9, -2, 5, 27, 24, 26, -26, 9, 8, -12, -20, 9, -25, -23, 4, 22, 24, -7, 4, -19, 7, -12, 4, 40, -1, 15, -17, -2, 31, -16, 30, -20, -15, -10, 3, 13, -19, 20, 3, 46, -8, 22, -7, -15, -9, -7, -36, -34, 9, -28, -64, -35, 3, 0, 29, -37, -5, 24, 0, -10, -18, -29, -9, -6, -24, 14, -17, -16, 17, -1, -10, 3, 10, -24, 30, -18, -3, 10, -27, -23, -9, 12, -6, -33, -11, -30, -11, -2, -44, -13, 11, -15, 10, -7, 7, -11, 39, -16, -5, -42, 7, 22, 21, 17, 17, -12, -18, 21, -13, 29, -7, 10, -1, -10, -10, 11, -3, 2, 5, 8, -3, 27, 15, -9, 5, -8, -14, 21, -18, 15, 19, -21, -19, -16, 2, -23, -23, -11, 4, -11, -12, -21, -18, 3, -12, 7, -22, -52, -17, -43, -6, 23, -15, -6, 26, 12, -10, 2, -10, -14, 33, -45, -23, 81, 8, 21, -2, 0, -11, 4, 12, -13, -38, 3, 10, -18, -22, -24, 24, -25, 7, -6, 6, 37, -31, -8, 16, -4, 27, -25, 13, -14, 1, -24, 17, 4, -33, 0, -2, -12, -39, -17, 12, -1, 18, 22, -3, 0, 13, -29, -4, -13, -10, -9, 5, 10, -121, 2, -5, 13, 9, 14, -3, -14, 38, -2, -19, 44, -9, 6, -17, -4, 24, 12, 9, -13, -4, -7, -23, -9, -17, -21, -7, 19, 12, 20, -2, -24, -1, -10, 18, -12, -17, 23, 16, -10, -22, -7, 12, 4, -26, 1, 26, -15, -21, -12, -2, -23, -29, 25, -5, -13, -8, -10, 2, -31, -28, -49, 17, 13, -90, -20, -12, -3, 5, -8, 2, -1, 43, -31, 12, 51, -12, -21, -5, -1, -11, 31, -4, 14, 18, -25, -4, 17, -5, -3, 2, -4, 0, 16, 20, -7, -1, -16, 54, 19, -4, -13, 27, 9, 2, -8, 2, -2, -8, -17, 34, -20, -30, -7, -3, 0, 11, 19, -15, -3, -6, 4, -11, -27, 16, -14, -3, -13, -75, 24, 25, 13, -23, -17, 18, -7, -15, 17, -2, 12, -17, -13, -5, -1, 7, 23, -3, -1, 23, -18, -6, 9, 5, 19, 4, -24, -11, 20, 27, 0, 17, 0, -13, 19, 21, -11, 8, -25, 5, -6, 19, 24, -4, -8, 27, 17, 2, 19, -23, 18, -13, -16, -20, 22, -27, 7, -23, 17, 15, -32, -8, -8, -93, -3, 23, 30, -17, -17, -5, 19, 11, 15, -2, -13, 6, -9, -22, 3, 15, 17, 7, 17, 18, -18, -17, 17, -2, 13, -35, 23, -9, -21, -2, -29, -8, 0, -26, 17, 19, -1, -19, 24, 25, -4, -11, -1, -31, 10, -3, -16, -16, -21, -23, 23, 13, -4, 6, -13, 23, 2, -17, -14, 4, -10, -22, 25, -26, 3, 4, 29, -3, -12, -20, -10, 35, -28, 8, -10, 0, -37, -32, -7, 8, 19, 13, -19, -1, 24, 25, -32, 7, -21, 13, -33, 1, -24, -47, 32, 12, -13, 17, 27, -9, -29, -25, -7, 27, 1, -25, 17, -22, -17, -11, -19, -10, 13, -3, 0, -18, -19, 20, -23, -26, 4, 11, -20, 2, -24, 26, -11, -31, -24, -4, -21, 30, -23, -2, -26, -3, 17, -4, 18, 28, -14, 9, 15, 16, 22, 25, -27, 25, 12, -3, -25, 2, 0, -2, -19, -9, -6, 24, -20, -20, -21, 21, 18, -25, 12, -20, 28, 8, 23, 23, 14, 23, 28, 24, -3, -3, -35, 23, 3, 6, -13, 5, 16, -24, 10, 23, 41, -20, 34, 22, -18, 9, 22, 5, 31, -3, -13, 20, -22, -29, 35, -14, -63, -4, 18, 22, -16, 28, 11, 10, 21, 15, 32, 7, -18, 26, 13, 17, -12, 3, -5, 4, -27, -11, 26, -29, -10, -9, 13, -7, 35, -2, -14, 1, -20, 19, 13, -19, -5, 1, 0, -5, -21, 19, -16, -20, -23, 14, 11, -14, 6, 5, -8, -13, -24, -8, 16, -20, 2, 34, -7, -19, 8, -11, 14, 2, -4, -6, 6, 14, -27, -3, -22, -17, 19, 0, 11, -12, -7, 23, -24, -6, 16, -8, -4, 18, -20, -6, 6, 14, -17, 22, -7, 20, 18, -8, 15, -20, 8, -9, 14, -11, 24, -12, -3, -6, -16, 17, -11, -12, 8, -12, 14, -18, 11, 20, 6, -1, 19, 51, 20, 1, -12, -2, -7, 3, -4, -26, 8, 25, -9, 3, -11, 21, 9, -17, -20, -9, 2, 5, -9, -12, 12, 14, -3, 6, -21, -5, -18, -15, 21, 12, 20, 13, -8, -22, 17, -14, 24, -22, 11, 15, -7, -17, 11, 8, -14, -14, -6, -13, -23, -25, 10, -27, 25, -7, 27, -11, -14, 11, -8, -2, 19, 27, -4, -18, -14, 12, 33, -5, 7, 25, -18, -25, -31, 6, 15, -11, 29, -5, 13, 12, 21, 1, 14, -39, -27, 6, -7, -7, -9, -17, -12, 19, -34, 0, 6, 27, 4, -9, 7, 26, 9, 10, -11, 15, 14, -8, -18, -4, -29, 21, 10, -35, 24, 30, 21, 0, 5, 22, 24, 1, 35, 13, 58, 15, -59, 57, 14, 2, -4, 27, -24, 41, -22, -44, 30, -15, -65, 3, -10, -14, -5, -6, -7, 22, -7, -2, 0, -4, -4, 21, 34, -13, 39, -20, -29, 20, -24, 22, 20, -45, 11, -25, 13, -21, 11, -21, -14, -15, 5, -4, 8, -22, 8, 24, 20, 26, 26, -14, 5, 29, -19, -24, 25, -1, -28, -17, -13, 22, -22, 55, 4, -3, -25, 15, 7, 17, -10, -17, 10, 13, -46, 0, 24, -20, -1, -27, -18, -9, -18, -11, -3, -20, 9, 24, -9, 21, -28, -9, 24, 1, 23, 14, -8, -18, -22, -5, -19, 4, 28, 24, -21, -11, -12, 6, 22, -14, 3, 34, 6, -2, 19, 19, -18, 19, -22, -7, 13, 27, -3, -29, -16, 10, -15, -38, 11, -23, 23, -41, 8, -12, 10, 14, -10, -6, -23, -25, -5, -2, 29, 13, 13, 17, -5, -8, -8, -17, -25, -14, -9, 22, 1, 24, 4, -21, -10, 7, 7, 13, -15, -9, 4, -2, -11, 23, 9, 25, -22, -5, -25, 22, -19, 1, -25, 11, -6, 3, 21, -14, 24, 3, 7, 28, -32, -5, -46, -20, 15, -58, -14, 16, 5, -17, 2, 3, 17, 48, 26, -28, -63, -18, -8, -19, -7, 2, -5, -31, -1, -6, 11, 2, 15, 5, -21, 12, 3, -25, -15, -16, 6, 41, 17, 15, 3, -9, -11, -4, -16, -20, -22, -15, -24, 22, 0, 15, 11, -22, -22, -10, 27, 5, -5, 0, 15, -14, 22, -4, 9, -17, -11, -19, -3, -71, 8, -1, 17, 8, 22, 2, -19, 24, -8, -22, 22, 11, -10, 19, -3, -6, -2, -3, 21, -4, -16, -2, 13, -13, 12, -4, 4, -15, -4, -25, 9, -16, 11, -2, -10, -24, -15, 3, -24, 18, -12, -7, -18, -11, -19, 32, -15, 16, 7, -16, -1, -3, 20, -11, 17, 7, -10, 2, 18, 8, 6, -22, -9, -122, -21, 30, 25, -11, -1, 14, 25, -11, 15, 10, 3, -23, -28, 15, -8, 10, -22, -24, 12, -15, 8, 6, -20, -10, -11, -28, 7, -18, 10, 15, -20, 0, 4, 5, 7, 15, -17, -23, 15, 26, 20, 4, -2, -19, -12, 12, 3, 3, -19, 14, 2, -8, 24, 5, -2, 26, 8, -1, 7, 30, 32, 34, -60, -32, 4, 13, -16, -19, 1, 1, 5, -7, 24, 23, -95, 7, -23, 21, -27, 25, 11, -2, 17, -1, 24, -20, -8, 12, -15, -7, -16, -20, -10, 13, -22, 41, 2, -8, 10, -29, -2, -17, 0, -20, 27, 13, 22, 19, 34, -15, -1, 9, -21, -14, -11, -17, 12, -6, 2, 10, 19, 2, -42, 1, -11, -9, -4, -46, -11, -1, -6, -34, 27, -27, -20, 36, 0, 3, 70, -26, -14, 18, -6, -20, -11, -2, -19, -21, 14, -10, 17, -14, -27, -35, 0, 5, 29, 13, -13, 32, -16, 5, -16, 10, -9, 15, 11, -6, 14, 10, 7, 12, -27, -5, 23, -14, -29, 11, -12, 9, 26, -12, -8, 24, -21, -21, -16, 5, -9, -12, 16, -28, -8, 18, -24, -43, -6, 26, 11, 18, 33, 9, -31, 14, -9, 19, -33, 4, -2, -6, 26, 12, -12, -20, 2, -1, 12, 12, -2, -15, -11, 21, 4, 43, 18, 4, 12, -23, -1, 14, -7, -23, -12, -20, 21, 18, -7, 17, 7, -27, -20, 11, -27, -12, 8, 19, 13, -16, 4, 27, 16, -14, -21, -34, -6, 39, -45, 22, 9, -8, 8, 15, -1, 13, 11, -24, -49, -21, 12, 17, 40, 2, 34, -27, -21, 8, 17, -12, -34, 14, 6, -3, 0, 26, -5, 14, 40, -35, -14, 44, 1, 15, 22, 2, 14, -20, -5, -10, -28, -2, 21, -19, -17, -39, -28, 19, 14, 30, 13, 23, 11, -22, -28, -13, 13, 2, 37, -6, -50, 0, -19, 7, 20, -24, 14, -22, 10, 14, 22, 16, 26, 9, -51, 38, -34, 19, -2, 30, -7, -22, 24, 28, 17, -17, -17, 56, 3, 21, 18, -27, 24, 5, -27, 31, -8, -1, -10, -15, -11, -5, 11, 4, -10, 5, -8, 27, 10, -4, 7, 12, 5, 9, 13, -11, 10, 15, -1, 16, -9, 12, 4, 17, -16, 22, -20, 14, 13, 16, -13, 5, -7, -3, 1, 11, -49, -12, 15, -19, 11, -24, 22, -6, 19, 10, -23, -19, -18, 2, -12, 21, -1, 1, -8, 7, 0, -17, 6, -35, -12, -22, 0, 2, 3, -8, -13, 2, -16, 17, 17, -6, 11, -17, -9, -13, -7, -14, 15, -19, -23, -1, 11, 0, -8, -17, -18, -17, -5, 95, -18, -1, -11, -18, 9, -14, 2, 32, -10, -16, 6, 0, -9, 13, -8, 15, 17, 11, -3, 17, -9, 12, 1, -27, 7, -22, 9, -19, 5, 24, 1, 26, 23, -17, -12, 7, 14, 12, 8, 6, -11, 2, 5, -22, 13, 21, -17, 8, 11, -3, -4, 0, 0, 19, 3, 1, 15, -6, 19, 21, -11, 3, -6, -39, -7, -19, -28, -32, 5, 18, -5, 43, -18, 16, 4, -9, -36, 7, -5, -9, -26, -5, 16, -19, -22, 9, -4, -3, -23, 1, -31, 9, 3, -70, 34, 12, -28, 60, 5, -2, -10, -8, 4, 20, -11, 32, -21, -18, -11, 15, 24, 7, -10, 7, -21, -1, 24, -21, 3, 3, 22, 6, -50, 7, -15, -2, 5, -92, 0, -8, 23, -46, 17, 1, 4, 65, 7, 20, -33, -1, 5, -22, 15, -15, 5, -13, -20, 24, 1, 16, 1, -23, -17, 2, -14, -9, -9, -8, 21, 29, -25, -18, 16, -15, -20, -19, -9, 5, -3, 25, 17, -25, -3, 14, 3, -25, -20, 5, -23, 13, -3, -32, 28, -9, 21, -10, 21, 35, 47, -20, -1, 117, -21, 17, -3, 35, 2, 35, -21, -10, -8, -3, 7, -18, 5, 22, 16, -6, 19, 1, 10, 18, -17, 3, -24, 2, 1, 8, -19, -15, -3, -14, 14, -15, -13, 20, -7, 6, -3, -9, 1, 6, 3, -2, -13, -5, 14, 2, -15, 24, -17, 1, 22, 16, 12, 13, -14, 17, 14, 23, 1, -19, 33, -21, 4, 68, -20, 10, -19, -24, 26, -5, 17, 14, 15, -25, -40, 20, 9, -19, 21, -1, -3, -34, 14, 25, 19, -15, -26, -20, 23, 26, 2, 21, -24, -16, -2, -4, -3, 25, -19, -10, -24, 25, -16, 4, -26, 21, -10, 19, 20, -1, 14, -22, -26, 9, 24, 5, 3, 12, 0, 7, 21, 12, -11, 7, 12, 11, -8, -75, 18, 5, 8, -23, 13, -26, 15, -2, 16, 16, 68, -5, -7, 15, 23, 3, -10, 1, -19, -8, 15, -25, -23, 5, 17, -20, 4, -16, -17, -5, -27, -12, 7, -8, 24, 23, -20, -7, 21, -12, -11, -19, -26, 1, -11, 17, -17, -37, -28, 10, -16, 0, 4, -5, -7, -14, -13, -23, 8, -15, -23, 9, -14, -57, 23, 19, -22, -32, -19, 17, -23, 6, 15, 27, 9, 17, -57, 11, -23, 13, 0, 16, -15, 8, 17, -22, 33, 11, -5, -35, -4, -22, 17, -23, -14, 1, 1, -17, -10, -5, 13, 13, 12, -23, -4, -5, 18, 28, 10, -19, 11, 3, -24, 15, -17, 5, 2, 0, 9, 5, -17, -2, 27, -32, 5, -4, 2, -89, 27, 19, 23, -4, 7, -4, 3, 8, 47, 0, 18, -26, -8, 6, -6, 8, -7, -16, -17, 4, 17, -9, 11, -14, 9, -32, 28, 12, -25, 25, -22, -1, 11, -33, 13, -8, 4, -3, 27, 7, 12, -34, -14, -9, -22, -14, -7, 3, 13, -7, -13, -18, -19, -13, -14, 0, -22, -7, -14, 15, 43, 22, -8, 82, 3, 0, -20, 18, 12, 1, 5, 4, 13, 17, 52, 14, 7, 11, 9, 18, -18, -4, -22, 15, -9, 1, 25, -16, -10, 14, 35, -31, 10, -13, 21, -18, 24, -40, -13, -14, 16, 14, 13, 10, 28, -7, 26, 10, -17, -24, 7, 39, -23, 4, -1, 18, -1, -5, 20, -26, 11, 9, 4, 4, -8, -15, -13, -54, -17, -20, 4, -16, -9, -30, -4, -8, -15, 17, -4, -23, 15, -24, 25, -7, 1, 26, -23, 12, -1, 18, 14, 14, 15, -28, 4, 2, 0, 18, -11, -12, -19, 16, -2, 23, 9, 25, 6, -26, -26, 9, 25, -5, -13, 24, 18, 7, 27, -1, -7, 22, 17, -14, -1, -3, 15, -13, -4, 11, 25, 28, -7, 36, 19, -3, 21, -10, 15, -12, 11, -9, -2, 9, -5, 24, -6, -13, -7, 3, -7, -14, 0, 1, 5, 10, -19, 21, -15, 24, 13, 19, 9, -35, -8, -19, 21, 6, 23, -2, 24, 7, -1, 23, -14, 20, -19, -18, 7, -25, -15, 15, 13, 8, 8, 3, -17, 21, 6, -19, -4, -19, 18, 13, 29, 7, -26, 101, 24, -24, 10, 29, 0, 23, -23, -4, 8, -9, 7, 9, 1, 21, 21, -10, -17, 16, -12, 10, 24, 13, 29, 22, -17, -27, 9, -1, 22, 10, -2, -27, 18, 22, 13, 10, -24, 11, 9, 19, 24, 11, -9, -13, 23, -8, 4, 37, 5, 8, -15, -11, -3, 2, 5, -30, 3, -19, 17, -17, 46, 23, -20, 104, 24, 2, -18, 27, -25, -5, 10, -23, 12, -11, 47, -14, 22, 24, -20, 3, 6, 28, -9, -13, 19, -2, -8, -16, 18, -11, -19, -18, -23, 8, 1, 11, 17, -32, -14, 23, 25, -10, -22, 5, 8, -4, 15, -26, -12, -41, -21, 26, -24, -12, -1, 10, 3, 18, -26, 26, 4, -11, 3, -30, -18, 19, 4, -94, -7, 3, 8, -37, -19, -32, -7, 32, -11, 18, -44, 21, -2, 17, 14, 21, 6, 14, 23, -20, -25, -25, 22, -25, -17, -26, -14, -4, 4, 16, 22, 18, 12, -4, -17, -6, -1, -2, 3, 12, -14, 24, -10, -8, -21, -8, 18, 4, -8, 5, -26, -20, -28, -5, 13, -16, 29, 18, -10, 3, -26, 16, 10, -10, 15, -25, 9, -10, 20, -17, 6, -21, 8, 5, -5, 13, 19, -15, 38, 14, 2, 9, 22, 12, 28, 8, -17, -6, -19, -50, -1, -20, -4, 11, -4, -21, 8, 4, 11, 16, -8, -3, -7, 2, 2, 20, -1, -10, 12, -7, 6, 17, -27, -18, 12, -9, -8, -14, -3, 17, 14, -7, 5, -10, -22, -9, 20, 66, 9, 2, 13, 6, -7, 33, -18, 19, -27, -24, -27, -10, 11, -20, -17, 12, 17, -4, -28, 7, 6, -17, -5, -24, -9, -20, -9, -23, 3, 13, 31, 17, 11, 8, 14, -24, 23, -8, -1, -12, -28, -7, 7, -28, -17, 1, 14, 17, -26, 26, 10, 22, 11, 1, -27, 5, -9, 14, 6, -14, 20, 1, -52, -26, 0, 21, 13, -27, -23, -49, 19, 40, -4, 27, -44, 6, 8, -4, -8, -11, -26, -16, 2, -10, 6, 31, 42, 5, 18, 24, 35, -13, -8, -20, 7, 17, 16, -11, 10, -8, -3, -8, 14, -6, -1, 11, 6, 24, 14, 54, -11, -32, 13, -25, 22, 15, -11, -22, -6, -13, 1, 16, -4, 4, -11, -20, -29, 59, -11, 13, 17, -5, 24, -8, 23, -6, -9, 15, -26, -13, 35, -6, -14, -13, 7, 26, -15, 24, -18, 18, -10, -16, 23, -11, -17, -2, 20, -4, -1, 13, -1, -29, -14, -8, -8, -16, 22, 5, -10, -17, 13, -13, -24, -24, 7, 2, 7, 31, 7, 8, 7, 17, -21, -24, 10, -12, -23, 14, -52, 3, -21, -79, -18, -2, -9, -45, 18, -2, -10, 41, 22, -21, -22, -15, -6, -15, -2, -9, 11, 11, -7, 3, -21, -24, -19, -24, 15, 16, -21, -22, 13, 23, 20, 36, 7, 14, -9, -11, -16, -10, -11, 12, -2, 2, 0, 12, 18, 27, -5, -39, 30, -2, 8, 4, 4, -22, -16, 13, 9, 23, -16, 4, 13, 4, 20, -62, -13, 2, -26, 37, 4, 2, 19, 4, -14, 11, -27, -23, 17, -1, -25, 6, -11, -4, 15, -17, 3, -5, 22, -16, -2, 17, 24, -16, -11, 21, 7, -17, -13, -23, -24, -8, -7, 15, 11, -9, 15, -1, 22, 17, -2, 0, -6, 33, -27, 5, 13, -35, -2, -3, -10, 5, 7, -13, -45, -6, -20, -17, 5, -95, 9, -6, -21, -21, -13, -12, -2, 43, 6, -17, 41, 11, 11, 15, 11, -12, -28, -22, 9, 22, -17, 10, 8, 4, -15, 0, -4, 12, 18, -20, -1, 21, -24, 44, -10, 23, -21, -6, 8, -22, -24, 13, 1, 16, 2, -1, -13, -8, -11, -16, 25, 40, 18, 25, 15, 25, -10, 18, -6, 14, 38, 12, -49, 75, 17, 15, -14, 6, 20, 32, -2, 17, 37, 11, -74, 3, -11, -7, 25, -9, -11, -7, -6, -1, 4, -13, -6, -18, 18, 25, 4, -27, -26, 8, -39, 2, 13, -16, 13, -37, 13, 10, 3, -2, 32, 17, 24, 2, 2, -29, 18, -18, 13, 25, 14, -2, -12, 18, 5, 8, -9, 6, 4, -32, 16, -11, 25, -9, -2, 30, 15, -36, 23, -21, -3, 8, 18, -1, -14, -17, -2, 22, -3, 9, -1, 3, 12, -1, 18, 6, 7, -3, 12, -46, 10, -2, -8, 66, -46, -4, 32, -39, -11, -5, -23, -20, 7, 16, -22, -33, -9, -21, -2, 11, -14, 4, 1, -16, -15, -3, -24, 19, 19, -23, 25, -23, -11, -24, 40, 9, -17, 15, 11, 24, -13, 19, 11, 18, -8, -19, -3, -16, 38, -5, 38, -23, 3, -17, -5, -7, -2, -11, -14, 0, 16, 6, 3, 10, 26, 9, 9, 15, -23, -9, 13, -39, 15, -6, -28, -12, 2, 2, 20, 20, -1, -9, -8, -35, -21, 15, -7, -3, 16, -28, 17, -19, 3, -5, -22, -20, -26, -14, 24, 14, -13, 87, 12, -6, 7, 23, -1, 11, 12, -25, 2, 22, 91, -20, 1, -6, -21, 6, -24, 22, -20, 8, 6, 4, -10, -29, -8, -26, 24, 4, 28, -26, -25, 14, -14, 25, -12, -9, -20, 22, -2, -25, -19, -14, 13, 0, -31, 15, 4, -6, -32, 24, -1, -10, -16, -14, 22, 15, 21, -2, -16, -28, 20, 12, -16, -2, 11, 14, -9, -50, -10, 12, -18, 27, 16, -11, -32, 2, 17, -12, 6, 4, 16, 18, -5, -12, 4, -19, -1, 9, 26, -11, -13, -12, -18, 15, 18, -10, -26, 23, -12, 2, -14, -4, 14, -9, -13, 6, -24, 19, -4, 24, 20, -33, 18, -19, -12, -26, -15, -8, 5, -1, 21, 20, -43, 23, -20, -16, 23, -2, 35, -5, -20, -2, -17, 10, 18, 20, 2, 15, -8, 6, 13, 30, 11, 10, -12, -22, 22, -12, 28, -20, -7, 13, -1, 2, 5, -22, 7, 24, 7, 10, 7, 11, 3, 6, 14, 1, 21, -2, -3, -5, 29, -11, 8, 22, -16, -2, -12, 28, -16, 23, 21, 6, -2, 19, 0, 11, 16, 9, -20, -29, -14, -83, -5, 3, -12, 15, -6, 13, -15, 19, -2, -21, 0, -17, -21, -18, 1, -15, -10, -25, 24, 15, 18, -7, -10, 1, 4, -37, 28, -4, -1, -12, 2, 2, -4, -1, 25, -25, -11, -6, 10, -18, 30, -20, -3, -1, 19, 32, 23, -17, 18, -26, -17, 17, -21, -13, -19, 18, 19, 8, 5, 14, 40, -12, -8, 21, 21, 22, 12, 43, -17, -4, 15, -36, -13, 5, 14, 13, 33, 25, -20, 4, -5, 23, 15, -25, 17, 12, -10, -5, -5, -12, -26, -13, 16, -11, 22, 8, -9, 18, -3, 25, 18, 4, 8, 14, 11, -16, 10, 29, 23, 2, 14, 43, 13, -16, 15, 11, -11, -3, 10, 14, 16, 28, 7, 8, -27, -35, 3, -36, -17, -10, -3, -12, -10, -20, -15, 41, 27, -5, 21, 19, -3, -37, 8, 23, 25, 0, 1, 23, 14, 19, 8, 13, 10, 49, -36, 18, -21, -15, 1, 17, -8, 12, 32, 6, -10, 11, 4, 6, 32, -12, -8, -21, -19, 4, -7, -29, -29, 19, 19, -5, 24, 10, 15, 9, 9, -15, -3, -1, -30, 4, -22, 26, -23, -5, -12, -32, 26, -17, 12, 22, 16, -22, -38, 10, 4, -3, 5, 1, -23, 19, 21, -6, 9, 25, 30, -8, -9, -1, -27, -10, 12, 18, -12, 21, 22, 9, -17, -25, -27, 21, -5, 30, -24, -21, -11, -14, 18, 23, -2, 7, -17, -16, 5, 17, -29, 9, -23, 8, -7, 0, -4, 7, 11, -11, -12, -75, 2, -4, -24, -2, 22, -11, 18, -19, 18, -13, 31, -16, 34, 23, -3, 26, -1, -9, -17, -15, -10, 23, -27, -18, -19, 8, -18, 15, -11, 24, -12, -10, -23, -1, -17, 21, 3, 21, -14, -23, 6, 23, 22, 21, 4, -10, 12, 12, 8, 26, -6, -11, 17, -15, 19, -19, 5, -1, -46, 11, -22, -17, -5, 43, 14, 29, -19, -13, 28, -1, 13, 55, -8, 17, -61, 8, -13, -4, 5, 1, -10, -24, 23, 6, 4, 29, -18, -18, 13, -16, 20, -13, -10, 35, 19, 30, -15, 23, -12, 9, -1, 18, 21, 9, -16, 5, -28, 7, 5, -11, 10, -33, -28, 11, -9, 30, -22, 24, 23, 6, -2, 21, 13, -22, 9, -4, -4, 48, -15, 21, 15, 7, 11, -12, 7, 2, 24, 2, -98, 7, 8, 0, 3, 27, -2, -27, -2, 28, 34, -25, -35, 24, -8, 43, -48, 14, -8, 20, -17, -1, 19, -59, 23, -23, 8, 3, -5, -3, 3, -23, -11, 18, 40, -1, -4, -17, 14, -25, -15, 0, -20, 8, 2, 13, -7, 13, 18, 27, 15, -4, -8, 34, -25, 18, 0, 28, 2, 22, -11, -42, 14, 23, 53, 3, 31, 23, 12, -9, -17, 30, -27, 14, -11, -8, 22, 24, 9, 18, 5, 7, 22, 15, 14, -20, 9, 5, -21, 18, -15, -3, 24, -11, 7, -15, -15, 8, 3, 5, -16, 36, 0, 16, 8, -13, -19, 20, -19, 17, 16, 24, -4, 8, 2, 19, -9, -52, 18, 1, -16, 23, -9, 5, 3, -20, 15, 13, 20, 21, 32, -7, -17, 23, 2, 19, 10, -4, -8, -5, 18, 28, 13, -11, 23, 21, -21, 21, 4, -37, -2, -9, -19, 9, -2, -28, 23, -5, -15, 16, 13, -1, -4, 6, 12, 34, 12, -3, -25, 3, -4, -13, -3, 21, 7, -28, 18, 13, 24, 25, 9, -6, 23, 12, -15, 23, -22, 16, 21, -19, 12, 3, 42, 16, -41, -1, -17, -2, -21, 11, 22, 6, 22, -14, 21, -14, 16, -6, 21, -14, -20, -36, -35, -7, 32, 16, 0, 11, -12, -21, 5, 2, -20, 6, 19, 14, 13, -5, 28, 0, 11, 25, 4, -6, 11, -22, 10, 17, 3, 25, 2, -13, 17, 15, 3, 53, -2, 22, -4, -37, -11, 26, -5, 31, 9, -14, -17, 2, -33, -6, 29, 16, 19, -8, -9, 20, -18, -10, 3, -8, 19, 16, 26, 25, 5, -22, 25, -6, 10, 12, 15, 7, 11, 18, 16, -18, -12, 23, 24, -4, 17, 21, -10, -6, 21, -10, 7, -1, 18, -5, 16, -21, -9, 9, 19, 15, 43, 6, 0, 75, -18, -18, 8, 13, 1, 14, 26, -35, 11, 25, -25, -1, 19, -16, -8, 11, 16, -19, 21, -8, 13, 0, 16, 15, 8, -10, 6, -14, -14, -7, 16, -33, 26, 0, -2, 21, 1, 13, 10, -5, 11, 17, 0, -18, -8, -18, 29, 32, 10, 21, -10, 1, -20, 1, -13, -26, -14, 19, -44, -28, -71, -14, 22, -69, 8, 18, -4, -37, -3, 15, -14, 39, -37, 15, 56, -11, -22, 0, 5, -15, 37, -7, 12, -1, -34, -10, 9, -10, -13, -16, 2, 5, -14, 2, 50, -26, -14, 56, 12, 7, -9, 9, -26, -7, -12, 0, -35, 1, -25, 15, 14, -48, 16, -20, -16, -32, 12, -20, -20, 14, -17, -5, -24, -26, 3, 29, -3, 64, -16, 2, 12, 16, -18, 5, 11, 20, -57, -27, -18, -20, 22, -19, -15, 8, -3, 17, -23, -18, 17, 0, -32, -19, -12, 4, 0, 32, 22, -4, 31, -20, -32, 20, 5, 24, -16, 1, -20, -17, -25, 15, 23, -21, -30, 31, -20, -12, -9, 22, -7, -5, -26, 2, 22, 19, 26, -9, 14, -5, -28, 3, 14, 21, -48, -16, 32, -12, 2, -8, -4, 11, -30, -6, 30, 23, 30, -9, 17, -1, 18, -21, 2, 5, -21, -8, -29, -5, 3, -8, -25, 30, -15, 20, 45, -28, -25, 87, 16, 10, 18, -14, 0, 5, -29, -35, 18, -16, 6, -16, -8, -9, -12, 0, 18, -3, 16, -32, 13, -15, 23, -5, -22, -21, 7, 19, -1, 10, 30, -4, -21, -9, 12, 12, -2, -25, 6, -15, -2, -10, -18, -1, 7, -8, -1, 18, 2, 19, -5, 19, 26, 21, -24, 8, 10, 19, -4, -45, 8, 16, 27, 32, -26, -11, 12, 5, -11, 22, 7, 31, 5, -17, 14, -16, 9, 23, -36, -3, -13, -9, 15, -7, 17, -6, -4, -15, -39, 19, -13, -8, -16, 5, -8, 1, 6, -47, 22, -14, -24, 21, 1, 5, -12, 22, -16, 15, 14, -27, 16, -15, 1, 4, -24, -22, 4, 9, -5, -13, -22, -22, -19, 8, 11, 20, -5, 12, 13, -2, -25, 23, -23, -5, 20, -7, 19, -27, 13, -14, 2, -31, -17, -8, 1, -14, -18, 11, -15, 7, -11, 1, 33, -21, 37, -1, -7, 14, 17, 14, 5, -12, -14, -19, 5, -14, -26, -22, 32, 7, 32, -9, 11, 5, -12, 19, 6, 7, 13, -28, 4, 8, -9, 12, 13, 2, 22, 14, -16, -4, 10, -12, 22, -23, -15, 14, -20, 23, 6, 1, -17, 21, 14, 13, -24, -17, 1, 11, -16, 21, -24, -8, -15, -9, -20, 7, -13, 18, 12, -22, 1, 52, -5, -9, -8, 27, 15, -16, -25, -18, 22, -4, -33, 13, 28, -23, 2, -24, 5, 14, -13, 19, 12, 8, -27, 25, 21, -10, -21, -17, -25, 29, 22, -12, 33, 1, -17, -18, -18, -16, 3, 23, -26, 11, -17, 7, 17, 25, -20, -13, -12, 13, 13, -10, 5, 15, 15, -4, 18, -6, 16, -28, 5, 21, 34, -56, 2, -6, 8, -25, -13, 8, 17, 16, -10, 8, 22, 22, 27, 7, -12, 9, 4, 0, -18, -18, -1, 23, 18, -20, 15, -9, -7, 19, 15, -2, -4, -6, 19, 7, -2, -1, 10, -11, -5, -13, -4, -5, -6, 17, 20, -20, -8, -23, 3, 10, -24, 8, -15, 2, -1, 0, 15, 11, 8, 25, 23, 6, -15, 101, 19, -9, 21, -13, -6, 28, 6, 10, 14, -12, 0, 6, -3, 1, -21, -20, -2, -14, 15, -17, 11, -15, -8, 8, 20, 30, -9, 22, 20, 20, -15, -3, 17, -23, 26, -8, -9, 18, 5, 5, 18, 2, 2, -19, 18, 2, 23, 11, -5, 9, -9, 3, -10, -4, 24, 12, 8, 18, 14, 16, 39, -4, 12, 100, -10, 5, 2, 42, -25, -19, 5, -18, -8, -21, 0, -7, -16, 11, 12, 18, 7, -19, -3, 19, 20, 19, -11, -6, -19, -5, -24, 11, -19, -18, 21, -13, -17, 15, -11, 24, 10, 5, 10, 5, 15, 12, -16, 8, 5, -32, -9, 19, 15, 10, -2, -9, 17, -11, -18, -4, -25, -2, 13, 4, -22, -14, -22, -67, 9, -1, 7, -36, 1, 17, -16, 26, -12, -2, 34, -25, -25, -27, -15, -20, -20, -24, -2, 10, 13, 26, 10, -16, -1, -24, 9, -11, 15, -17, 12, 0, 11, 6, 2, -13, -10, -27, -5, -3, 15, 5, 2, -5, -7, 22, 7, -12, -13, 4, 16, 19, -26, -15, 1, 21, 17, 4, 9, 19, -34, -17, -17, -89, -7, -12, 19, 16, -14, -21, -10, 1, -17, -2, 11, 22, -21, -28, 6, -19, 11, -21, 4, 15, -11, 12, -14, -16, -3, 16, 3, -13, 1, 4, 7, 27, -16, 0, -6, -20, -9, 7, -14, 3, 22, -14, -7, 6, -12, 29, -5, -26, 22, 9, -24, 0, -23, 14, -13, -5, 17, -18, -16, -3, -7, 11, -2, -44, -4, 17, -2, -24, -1, 4, 1, -8, 21, 20, 53, -12, -13, 18, 22, -14, 28, 4, -23, -7, -19, 1, 25, 15, 22, -27, -20, 2, 9, 10, 6, 15, 6, 15, -14, 0, 1, -18, -25, -9, 3, 15, 9, -13, -5, -10, -8, -2, 12, -30, -23, -36, 15, -19, -29, -12, 29, -30, -46, 0, 12, 29, -14, 47, 8, 21, -30, -14, -19, -14, 24, 13, -18, -21, -59, -17, 0, 2, 21, -17, -13, 18, -19, 27, -10, -17, 25, 8, 1, -28, 18, 5, -13, 20, 27, 4, -3, 15, 12, 12, -15, -16, -26, -7, -19, -15, -17, 30, 4, 21, -20, 35, -17, -15, -13, -27, -5, -16, -19, -18, -3, -23, 2, 4, -1, -22, 5, -110, -20, 6, -25, -3, 14, -30, 3, -16, -5, 12, 39, 23, -15, 1, -24, -12, -17, -26, 8, -5, -14, -27, 5, -19, -22, -21, -3, 13, 15, -4, 17, 6, -19, 23, 25, 2, -16, 1, -5, 15, 0, 11, -1, -20, 13, 23, -5, 19, -10, 8, -9, 20, 28, -29, -15, -27, -10, -14, 36, 18, -14, 6, 2, -26, -3, -24, 3, 26, -19, 20, -13, -23, 24, -8, -8, 26, -15, 14, 17, -17, -12, 14, 5, 11, -2, -24, 13, 28, -16, 23, 7, 8, -2, -29, -45, 0, 10, -27, -12, 15, -9, -12, -14, -24, 20, 10, 1, 32, -12, 15, -20, 1, -10, -22, -7, 29, -20, -4, -18, -3, -12, -4, 46, 9, 29, -16, -30, 78, -18, -15, 1, 3, 2, -2, 16, -47, 17, -28, 28, -11, -18, -13, -5, 23, -19, 22, -21, 28, -5, 19, 1, -10, 0, -4, 8, -10, -5, -12, 2, 14, -12, -20, 0, 12, -17, 2, -8, 1, -12, -20, 30, -1, 26, -45, 18, 31, 21, 26, 18, -11, 21, -15, 19, 10, 17, 25, -13, -6, -7, -25, 14, 76, -1, -8, -19, 24, -25, 14, 14, 6, -24, 15, 4, -6, 21, -16, 32, -5, 11, 8, 3, -2, -19, 23, -1, -21, -12, 15, -25, 8, 4, 14, -25, -20, -4, -21, -1, 26, -27, -9, 14, 20, 10, 6, -1, -17, -20, -4, -26, 12, 22, 10, 24, 7, -6, -17, 0, -4, -2, 24, 14, -4, -4, -10, 17, 17, -8, -24, -27, -9, 8, 2, -22, -24, 6, 16, 17, -14, 44, 6, 32, -11, 6, -13, 24, 18, 13, 12, 25, -6, -31, -40, -7, -27, 12, 64, -49, -5, 31, -31, 2, -21, -6, -19, 11, 6, -3, -32, -12, -21, -26, -21, 4, -1, 3, -3, 12, 2, 17, 14, -8, -6, 21, 26, -15, -27, -2, -26, -12, 7, -6, -3, -11, -23, 10, -13, -16, 43, 21, -8, 7, -5, 28, -5, -10, -16, -16, -9, -3, -10, -11, -9, 11, -26, 27, -21, -8, -6, 6, 3, 12, 10, 23, -29, 16, 13, -21, -7, 20, 1, 16, -27, -4, 19, 4, -4, 17, 7, 6, 8, -16, 4, 0, -9, -27, 23, 13, -4, 4, -13, 4, 22, -3, 37, -12, -9, -4, 38, -2, -8, 33, -3, -9, 22, 15, 27, 11, 6, -8, 11, -18, 20, -27, -1, 16, 7, -48, -13, 21, 38, -18, 6, -19, -15, 33, 6, -22, 38, -2, -6, -17, 23, -26, 6, -14, 3, 4, -8, -25, 4, -6, 39, -28, 6, -10, 24, 0, -8, 4, -10, 25, 18, -33, -1, -31, -3, 24, -98, 8, 19, -2, -10, 26, 2, 8, 29, 21, -10, 7, -21, -15, -29, -24, 11, -4, -13, -21, 20, -4, -20, 4, 17, -17, -10, 20, 21, 20, 29, -11, 25, -25, -22, -23, 9, -5, 17, 25, -22, 9, 10, -3, 25, 10, -5, -15, -14, -11, 23, 6, -13, -4, 5, 18, -19, -9, -5, -23, -14, 14, 7, 17, -81, 16, -14, 16, 21, 0, -2, -20, -13, 43, -14, -67, 9, 12, -6, 0, 5, -13, -18, -26, 6, 1, 9, 2, 9, -9, -2, -7, 5, 0, 27, -44, -3, 4, -26, -1, -37, -3, -3, -19, 21, 16, -9, 16, 18, 14, 29, -20, -8, -17, 12, 3, -12, -10, -12, 19, -17, 20, 6, -30, 13, -27, 5, -11, -48, 21, 16, -13, 22, 19, 19, 23, 23, -16, 0, 11, 17, 22, 10, -19, 13, -15, -6, -7, 20, -26, 12, 17, -16, -7, 22, -18, 5, 14, -6, 33, 8, 13, 12, -25, -18, 22, -13, -7, -22, -1, -23, -20, 5, 11, 18, -17, -1, -4, 8, -1, 20, 18, -23, 16, 20, -19, 3, 10, -23, -7, 0, -11, -72, 0, -17, 21, -54, 17, -2, 24, 17, 34, -18, -20, -12, 1, -5, 10, 17, -14, -14, 5, -14, -16, 14, -6, -21, -6, 9, -16, -18, -19, -9, -21, 19, 2, 14, -18, 17, 4, 6, 10, 1, -2, 22, -4, 19, -9, 1, -5, -26, 18, 2, -10, 25, 23, -14, 8, 17, -4, -20, 17, 13, -7, -13, -13, 10, -22, 18, -12, 4, 21, -7, 18, -32, -29, 21, 10, -21, 5, -30, -8, -7, 12, 6, 18, -3, 5, -1, -10, 12, 0, -1, -3, 21, -8, 18, -23, 15, -12, -33, 27, -1, 8, 18, -22, -12, 2, -1, -1, 22, 28, -7, 12, 26, -7, 13, 17, 26, 0, -9, 19, 19, -15, -16, -37, -16, -27, -33, 12, -12, 10, -22, 11, -61, 0, -25, -10, 52, 13, 4, -30, -20, 17, 16, -8, -11, 1, 2, -14, 6, 20, 0, -1, -18, 0, 6, -24, 22, 0, 31, 9, 27, 12, 5, -25, -30, 13, 0, -14, -27, -6, -1, 21, -10, 25, 22, 14, -34, -23, 0, 21, 0, -9, -9, 17, 2, -7, -26, 46, -2, 54, 26, -40, -56, -16, 3, -13, -21, -18, -7, 6, -21, 7, -16, 15, 1, -6, -4, 10, 2, 7, -27, -2, -2, 12, 8, 12, 2, 0, -12, -10, -11, -5, -6, -31, 0, -7, -31, 0, -3, 5, -18, 14, -6, 15, 21, 10, -5, -14, -38, 9, -16 };
+static const int32_t smart_transformer_fault_detection_q8_layer_2_biases[5] = { -3693, 1576, 3068, -3005, 466 };
+static const int8_t smart_transformer_fault_detection_q8_layer_2_weights[1920] = { 62, 25, -101, 61, 43, 18, -24, 10, -1, -37, -53, 48, -22, 45, 10, 21, 29, 9, 96, -9, -14, -3, 86, -95, -11, -6, -15, 9, -33, -55, -27, -92, -30, -9, 34, 3, -28, 5, -35, 21, 30, 26, 5, -29, 22, -99, -54, -79, -108, -10, -15, -3, -1, -41, -85, -39, 48, -19, -45, -2, 60, -4, 77, -4, -1, -46, -57, 38, -76, 29, 2, -10, 59, 90, 55, -58, -72, 49, -23, -11, -16, -15, -36, -35, -50, 47, 111, -14, 38, 19, -37, -48, -28, -54, -18, 20, 44, 5, -70, -56, 62, 57, -6, -40, -27, -34, 25, 31, 13, -43, -30, -67, -86, 44, -16, 38, 79, -10, 62, 22, -56, -7, -41, 19, 38, 33, 52, -56, 17, 36, -32, 17, -40, -35, 21, -59, -21, 6, -106, 89, 21, -68, 29, 26, -18, 15, -32, 8, -21, 14, 5, -31, -34, -5, 44, -3, 5, 36, -19, -70, -11, 32, 16, -13, 67, -40, 32, 6, 30, 60, -37, 61, -98, -36, 51, -57, 11, -25, 21, 35, -28, -39, 29, 27, -33, 15, 18, 12, -35, 22, 39, -49, 22, 33, -31, 50, -49, 73, 78, 1, -11, -30, 24, 2, 13, -12, 42, -24, -12, -76, 37, -26, -7, -20, -6, -2, 49, -41, 36, 34, -17, -23, 16, 38, 47, 17, -27, 75, -49, -45, -35, 23, -4, 13, 14, 37, 12, 7, -49, -43, 15, -9, -48, 17, -40, -48, 23, 4, -71, -77, 54, -68, 49, -49, -45, 88, -3, -26, -35, -26, 42, -52, 1, 40, -25, -38, 19, 42, 35, 39, 38, 1, -8, 25, -19, 70, -10, 55, 11, -15, -73, -98, 45, 60, 20, 54, -35, 40, 41, 62, 63, 40, -22, -47, -10, -17, -59, -30, -17, -8, 11, 17, 22, 0, -38, 57, -10, -44, -99, -19, -30, -5, -24, -62, 1, 18, -30, -12, -41, -93, 41, -32, -26, -19, -8, 26, -15, 30, 64, 62, -55, -19, -22, -33, 6, -95, 39, -32, -15, -21, 50, 23, -65, -27, -11, 76, -36, -44, 15, -63, -16, 111, 42, 41, -29, 70, -38, 4, -5, 36, -40, 34, 21, -9, 19, 52, -37, -30, -9, 35, -3, 41, 60, 31, 10, -47, 34, -72, -24, 8, -49, 39, -94, -10, -36, -40, 32, -4, -13, -12, -58, -9, 57, 52, 2, -58, 11, -11, 25, 8, -46, 72, -45, -10, -47, 27, 31, 18, 14, -34, 8, 67, 43, -22, 5, 0, 30, -3, 35, -86, -45, 7, -30, -28, -56, 41, 1, -20, 32, 15, 10, -22, -7, -29, 38, 66, 69, -33, 24, 21, 5, 24, 63, 59, 15, 31, 12, 20, 41, -28, -37, 2, -1, -19, 26, -29, -8, -40, 7, 20, 4, -33, 44, 60, 14, -2, -2, -32, 19, 35, -22, -43, 20, -20, -16, -7, -28, -1, 14, -28, -52, -56, 33, 55, -18, 1, -66, -56, -31, 55, -55, 11, 19, 64, 78, 24, 2, 29, 34, -18, -5, 11, 23, -42, 27, -11, -39, 33, -2, 31, 22, 8, -37, 34, -36, 7, -26, 10, 45, 46, 9, 45, 15, 3, -58, -8, -34, -50, 3, -72, -2, 39, 54, 29, -36, -43, -27, 6, 21, 33, 5, -68, 17, 15, 28, 6, -34, 51, -5, 67, 18, -33, -2, 23, 10, 29, -22, 34, 38, -62, 34, -21, -47, -9, 40, 19, 16, 37, 17, 27, -16, -27, -49, -54, -36, -31, 51, -22, 14, 1, 37, -40, -28, -14, 46, 30, 52, -72, 39, -30, 13, -51, 2, 35, 22, -52, 33, -33, 26, 2, -49, 17, 16, 62, -51, 24, -27, 55, -15, -31, -16, 11, -22, -13, 43, 32, -22, -62, 14, 64, -30, -4, 16, -41, -31, 76, 61, -8, -20, 6, -4, -7, 13, -10, 40, -25, -8, -25, -34, 7, 33, -54, 71, 48, 36, -16, 60, -18, -26, 36, 4, 0, 18, 60, -6, -41, -2, 23, -8, -26, -22, -34, -43, 2, -1, 22, -5, -12, -20, 17, 79, -30, -36, 2, 45, 28, -52, -1, -29, -18, -40, 3, -34, -34, 2, 48, -18, -19, -3, 53, 20, -25, 7, -36, -38, 25, -3, 30, -7, -40, 36, 33, -65, 10, 3, 29, -34, -61, -37, 2, -33, -26, -23, 33, 19, -22, 37, 47, 38, -1, 13, -28, 38, 48, 21, -4, 18, 25, -19, 4, 45, 2, 30, 17, 47, 2, -16, -66, 3, -19, -45, 45, -106, -17, 15, 24, 30, -2, 38, -23, -28, 9, 2, 29, -21, -51, -2, -24, 53, 3, 40, 25, 46, 26, -19, 39, 53, -36, 19, 30, -10, 18, 14, -47, 60, -36, -50, -5, 5, 29, 0, -16, -76, -43, -56, -4, -66, -9, -51, -31, 26, -14, -32, -72, -37, 20, 13, 27, -12, 44, 40, -31, -13, 51, -26, 30, 1, -7, 9, -32, -47, 30, 31, 49, 11, -6, -12, 66, -9, 42, 0, -14, 43, 7, -30, 85, -8, 15, -14, -14, -62, 27, -40, 4, 13, -19, 37, -7, -8, -40, -34, -21, -32, 23, 2, -51, 61, -16, 102, -30, 47, 11, 36, -42, -5, 4, 19, -34, 96, -37, 31, -38, -3, 1, 15, -34, 59, 11, 6, -1, 48, 18, -17, -10, 53, 12, 33, 4, -33, 17, 25, 38, -52, -67, 7, -36, 22, -17, -46, 10, -9, -2, 18, -11, -36, 34, -61, 24, -55, -31, 40, -21, 3, 41, 8, 23, 25, -30, 19, 6, -3, -1, 17, -14, -11, -33, -12, 38, -52, 27, 12, 24, 25, 21, -21, 56, -17, -21, -4, -62, 28, -34, -11, -36, 22, -1, 23, -16, 26, 5, 9, 18, -4, -36, -47, 33, 41, -45, 109, 70, 38, -42, 31, 9, 18, -15, -36, -55, 10, 0, 39, -1, 41, 5, 17, -8, 13, 69, 34, 29, -5, 43, -30, -21, -24, 27, -46, 42, -25, -13, 37, -24, -43, 1, 5, -5, 44, 31, 50, 48, -9, 33, 36, 33, 27, 13, -5, 31, -34, -38, 2, 12, -88, -15, -35, 98, 30, 10, -35, -45, 61, -35, -19, -27, -4, 0, 58, 52, -29, -10, -49, 17, 24, -39, -18, 53, -19, 4, -41, 22, 6, -52, -19, 30, 49, -51, 4, 42, -34, -11, 24, -9, -38, 18, -3, -22, -68, -19, 10, 5, 13, 23, 2, -22, -59, 20, 41, 17, -41, 8, 37, -9, -10, -25, -22, -14, 25, 21, -9, -5, 5, 34, 46, 46, 19, 13, 66, -29, -12, 31, -13, -15, 57, 79, 19, 26, 40, 16, 12, 46, -41, 22, 32, -36, -30, 28, 34, -19, 11, 43, 66, 102, 12, 3, -10, 4, 28, -19, -42, 1, 21, 50, 22, -20, -21, 62, -44, 35, 36, -48, -55, 18, 62, 31, -22, 8, 49, 29, 36, -48, 6, -29, 10, 13, -10, -8, 1, 37, -40, -29, -26, 34, -72, -21, -34, -21, -17, -6, 29, -40, 38, -28, -9, 30, 80, -67, -61, 42, -29, 34, -22, -4, -24, 21, 75, 2, 49, 1, -16, 10, 20, 39, 12, 70, -101, 61, 50, 0, 54, -27, -36, 49, 65, 42, 5, 17, -24, 16, 74, -23, 80, -63, 40, 4, 4, -55, -68, -22, 79, 85, 77, 12, 33, -19, -36, 34, 60, 72, 8, -31, -21, -60, -123, 3, 11, 18, 26, 14, 77, 30, -1, -54, -26, -28, 32, -25, 14, -20, 62, 28, -33, -30, -35, -28, -29, 69, -50, -22, -47, -1, -34, -42, -41, 104, 73, 71, 109, -51, -4, 22, 67, -20, -14, -100, -17, -3, 43, 10, 20, -25, -65, -20, 13, 85, 45, -11, 26, 26, -83, -10, -73, -28, 24, -9, 90, -31, -64, -7, -36, 79, 71, -83, 37, -11, -61, 20, -81, -2, -17, -76, 113, -30, 12, 87, -13, 26, 81, 17, 9, 25, -24, -34, 48, 16, 11, 9, -48, 24, 16, 11, 55, 98, 21, 3, 5, -20, 31, -4, 5, -14, -100, -53, 61, -79, 92, -30, -42, 81, -2, -68, 17, 61, -40, -9, -24, 32, 39, -100, -50, 21, 62, 51, 30, 52, -17, 14, -30, -73, 42, -16, -25, -20, -27, -73, -57, -9, -41, 33, -4, -22, 35, 18, -38, 29, 4, -27, -45, 52, -57, 86, -96, 3, 15, -77, -43, -22, -58, 61, 16, -61, 23, 7, -20, 53, -14, -11, 30, -43, 38, -42, 92, 48, -26, -30, 5, 8, 90, 51, -83, 15, -5, 8, -51, 110, 63, 21, 57, 5, 30, -11, 7, -46, 17, 115, -27, 7, -53, -33, -117, -17, -19, -36, 39, -24, 20, 57, 9, -83, 87, 16, 31, 68, 51, 72, -89, -41, 28, 22, -33, 34, -41, -91, -19, 4, -15, 28, 56, 127, 70, 70, 69, 31, 39, -33, -5, -54, -35, -80, -47, 13, 69, 38, 65, -14, 38, 16, -4, 21, -36, -32, 17, 90, -70, -50, 51, 15, 50, -62, 26, -35, -108, -90, 79, -1, -37, 7, -37, 102, 38, 67, -55, 15, -9, -22, 6, 24, 61, -27, 38, -11, 63, -25, -37, -38, 22, 3, -41, -93, 63, -38, -11, 15, -2, -11, -22, 37, -69, -91, 37, 77, 36, 0, 94, 35, -76, -60, -16, -18, -16, 108, 30, 57, 48, -1, 40, -4, 48, -1, -28, 3, 9, -22, -5, 31, 32, -21, -41, 1, -43, -26, 10, 18, 54, -2, 12, -43, 93, -44, 30, 7, -12, 45, 6, -38, -7, -31, 27, -24, 3, -29, 41, -10, -11, 27, 14, 45, -9, 15, 42, 17, -56, 5, 16, -19, 31, 8, -23, -23, -8, 18, -1, -57, 26, -11, 0, -68, -8, 33, -26, -32, -6, 35, 9, 14, -17, -15, -26, 48, -14, 17, -28, 13, 15, 44, -13, -31, -50, 40, 30, 22, 6, 4, -24, -19, 26, 5, -24, -62, -45, -2, -39, 61, 6, 35, 1, -30, 1, 34, 5, 33, 55, -7, 23, -32, -22, 9, 24, -24, -12, -6, 34, 16, -19, 33, 32, 13, -14, 29, -42, -42, -10, 29, 4, -25, 11, 24, -11, 7, 20, -27, 36, -15, 32, 41, -14, -34, 35, -14, 16, 5, -31, 30, -20, -17, -24, -18, -19, -21, 18, -16, -17, -40, 21, 20, -40, -25, -40, 41, 27, 11, -22, 11, -13, 7, 33, -28, -36, 35, 3, 8, -44, -28, -26, 1, 35, -26, -46, -2, -31, 7, -14, 56, -16, 2, 16, 61, -15, -17, -41, -27, 22, -10, -6, -8, 33, -24, 26, 32, 6, -16, -20, 23, 23, 47, 10, 18, -17, -28, 9, 26, -40, -35, 43, 9, 27, -25, 14, 47, 29, -16, -22, -27, 7, 47, -13, 22, 3, 25, 20, -22, 48, -25, 42, -18, -60, -22, 62, -6, 4, 29, -38, 9, 42, -29, 25, 2, 5, 11, -27, 33, 4, 0, -65, -17, -38, -63, -24, -29, -25, 38, 22, 17, 23, 8, -28, 1, 16, 35, -31, -11, 38, 24, -27, 9, 8, -30, -4, 18, 6, -19, 89, -34, -24, -16, -26, 21, 8, -46, -23, -37, 73, 24, 29, -34, 14, 23, 0, -48, -32, 6, -29, -48, -45, -21, 6, -14, -6, -71, 38, 18, 4, -30, -24, 32, 25, -19, 21, 33, 29, -28, 54, 17, -22, -20, 23, 46, 6, -37, 16, -41, -6, -1, -44, 25, -15, -4, 20, 50, 26, -31, 23, -13, 39, 5, 7, -16, -62, 11, -29, 4, 18, -13, 58, -40, 10, 11, 24, 19, -26, 14, 40, 1, 20, -12, 33, -38, -12, 28, 63, -33, 7, -3, -35, -7, -62, -42, 20, 23, 23, 38 };
+static int8_t smart_transformer_fault_detection_q8_buf1[384];
+static int8_t smart_transformer_fault_detection_q8_buf2[384];
+static int32_t smart_transformer_fault_detection_q8_logits[5];
+static const quantized_net_layer smart_transformer_fault_detection_q8_layers[3] = { 
+{ 64, 6, NULL, smart_transformer_fault_detection_q8_layer_0_weights, smart_transformer_fault_detection_q8_layer_0_biases, 19531, 24, QUANTIZED_NET_ACTIVATION_TANH }, 
+{ 384, 64, smart_transformer_fault_detection_q8_layer_1_weights, NULL, smart_transformer_fault_detection_q8_layer_1_biases, 1186936413, 33, QUANTIZED_NET_ACTIVATION_TANH }, 
+{ 5, 384, smart_transformer_fault_detection_q8_layer_2_weights, NULL, smart_transformer_fault_detection_q8_layer_2_biases, 1075582894, 33, QUANTIZED_NET_ACTIVATION_SOFTMAX } }; 
+static const quantized_net smart_transformer_fault_detection_q8 = { 6, smart_transformer_fault_detection_q8_input_scales, 3, smart_transformer_fault_detection_q8_layers, smart_transformer_fault_detection_q8_buf1, smart_transformer_fault_detection_q8_buf2, smart_transformer_fault_detection_q8_logits, 384 };
@@ -0,0 +1,24 @@
+// Generated by Project_HostTools/prune_model from smart_transformer_fault_detection.h, do not edit.
+// Hidden neurons: 384 -> 361, multiply-accumulate per inference: 26880 -> 16481
+// Accuracy on ../../AI_Model/dataset/training_dataset.csv (calibration, allowed drop 0.50 points): 99.37% -> 98.95%
+// Accuracy on ../../AI_Model/dataset/test_dataset.csv (held out, not bounded by the allowed drop): 99.00% -> 98.20%
+#include "sparse_net.h"
+static const uint16_t smart_transformer_fault_detection_sparse_layer_0_row_ptr[65] = { 0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90, 96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252, 258, 264, 270, 276, 282, 288, 294, 300, 306, 312, 318, 324, 330, 336, 342, 348, 354, 360, 366, 372, 378, 384 };
+static const uint16_t smart_transformer_fault_detection_sparse_layer_0_col_index[384] = { 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5 };
+static const float smart_transformer_fault_detection_sparse_layer_0_values[384] = { -0.228561f, 0.035742f, -0.207485f, 0.065659f, -0.107622f, 0.036909f, -0.221197f, -0.210405f, -0.089043f, -0.288656f, 0.532333f, -0.093086f, 0.277108f, -0.031191f, 0.157060f, 0.338944f, 0.327745f, -0.296981f, 0.065347f, -0.021692f, 0.293068f, 0.396160f, -0.082814f, -0.067828f, -0.259405f, 0.000563f, 0.204887f, 0.223345f, 0.027782f, -0.293935f, 0.283384f, -0.144474f, 0.269500f, 0.150997f, -0.026303f, -0.234695f, 0.125416f, -0.068640f, -0.070241f, -0.001867f, -0.033822f, 0.004561f, 0.134673f, 0.126040f, -0.288829f, 0.186693f, 0.252571f, -0.262370f, -0.215565f, 0.236073f, -0.290325f, 0.078810f, 0.306338f, 0.266894f, 0.146313f, -0.107794f, -0.140734f, 0.293033f, -0.303807f, 0.177563f, 0.174359f, 0.177783f, 0.172969f, 0.350768f, -0.072312f, -0.159027f, 0.256991f, 0.263623f, 0.088671f, 0.362182f, -0.092319f, 0.096525f, 0.154247f, 0.155199f, 0.160751f, 0.226522f, -0.064945f, 0.092562f, 0.147966f, 0.099785f, 0.079956f, -0.275248f, 0.019511f, -0.009629f, -0.018572f, -0.015506f, -0.232569f, -0.418386f, 0.093851f, 0.025260f, -0.278727f, -0.278754f, -0.278575f, -0.192643f, 0.077673f, 0.218890f, 0.009351f, 0.225044f, -0.270918f, -0.028318f, -0.089888f, 0.086084f, -0.265052f, -0.150400f, 0.308879f, -0.259939f, 0.323789f, 0.019399f, 0.054002f, -0.218280f, 0.179112f, 0.032084f, -0.130805f, -0.116604f, -0.123795f, -0.118456f, -0.116404f, 0.236667f, 0.479994f, -0.018767f, 0.188866f, 0.032654f, -0.177985f, -0.021729f, 0.274350f, 0.169553f, 0.279720f, 0.288054f, -0.097728f, 0.413863f, 0.037861f, 0.139659f, -0.277297f, 0.168704f, 0.058482f, 0.310991f, -0.158540f, 0.211828f, -0.028840f, -0.025235f, -0.021549f, 0.081444f, 0.566932f, 0.050456f, 0.063559f, 0.147242f, 0.085345f, -0.151233f, 0.222143f, 0.486904f, -0.167510f, -0.071531f, 0.174363f, -0.084206f, -0.383020f, 0.176352f, -0.142875f, -0.142721f, -0.142665f, 0.076983f, -0.000272f, -0.206489f, -0.129384f, 0.055219f, -0.012664f, -0.014714f, -0.238186f, 0.336345f, 0.002725f, -0.046906f, -0.053280f, 0.182619f, -0.342756f, -0.153802f, -0.063276f, 0.082208f, 0.232016f, -0.171361f, -0.141975f, -0.015121f, 0.058752f, -0.148159f, -0.306956f, 0.093230f, -0.130856f, 0.058730f, 0.139759f, -0.023913f, 0.053635f, -0.260685f, 0.175584f, -0.185880f, -0.212529f, -0.057919f, -0.061714f, -0.153697f, -0.023520f, 0.092496f, -0.091383f, 0.249205f, 0.125349f, 0.265386f, 0.261115f, -0.048169f, 0.227145f, -0.066899f, -0.194345f, 0.136755f, 0.150127f, 0.216681f, 0.164745f, 0.283959f, -0.156053f, 0.376730f, -0.079612f, 0.160365f, 0.221231f, 0.291704f, -0.081614f, 0.279400f, -0.284675f, 0.038823f, -0.044155f, -0.145994f, 0.290918f, -0.016444f, 0.082504f, -0.271336f, -0.019621f, -0.023481f, 0.338580f, -0.046270f, 0.019634f, 0.021677f, 0.162900f, -0.219987f, 0.237256f, -0.190006f, -0.041507f, -0.138744f, 0.061846f, -0.026453f, 0.055856f, 0.493467f, -0.304486f, -0.146741f, -0.011676f, -0.031070f, 0.322707f, 0.219894f, 0.102676f, 0.230566f, -0.014118f, -0.014422f, 0.209088f, 0.160754f, -0.202512f, 0.113436f, -0.061364f, -0.211719f, 0.237800f, -0.081815f, 0.314696f, 0.098531f, -0.084005f, 0.153949f, -0.162990f, -0.079655f, -0.055820f, 0.206119f, 0.015152f, -0.242972f, -0.236157f, -0.072762f, -0.181969f, 0.193077f, 0.005119f, -0.171869f, -0.139207f, -0.267100f, 0.504056f, -0.007002f, 0.149003f, 0.134442f, 0.143138f, -0.376661f, -0.229898f, 0.148558f, -0.001226f, 0.158894f, -0.035915f, 0.406839f, -0.161388f, 0.195502f, 0.006945f, -0.117948f, -0.117697f, -0.066397f, -0.302819f, 0.163640f, 0.215660f, -0.275246f, -0.265399f, 0.197894f, 0.101419f, 0.088761f, -0.144969f, -0.224269f, -0.080174f, 0.143451f, -0.069006f, 0.201407f, 0.226445f, -0.028205f, 0.018154f, 0.246410f, 0.220330f, -0.096381f, -0.063825f, 0.070894f, -0.089642f, 0.205205f, -0.005155f, 0.052611f, 0.291780f, -0.021996f, 0.164380f, -0.164415f, 0.094519f, -0.328448f, 0.119034f, -0.295117f, 0.064933f, 0.052345f, -0.115143f, -0.369592f, 0.067708f, -0.188148f, 0.267279f, 0.109814f, 0.025405f, 0.149211f, -0.108126f, 0.194163f, 0.204241f, 0.180210f, -0.130338f, -0.186307f, 0.202303f, 0.126219f, 0.119596f, 0.112377f, 0.206371f, -0.061205f, -0.139154f, 0.231849f, 0.143532f, 0.009568f, -0.228504f, -0.127870f, 0.055451f, -0.019709f, 0.239155f, -0.021501f, -0.011998f, 0.041530f, -0.057594f, -0.059168f, -0.051947f, -0.279967f, 0.556328f, 0.109385f, -0.129688f, 0.057963f, 0.286660f, -0.167078f, 0.018635f, 0.040842f, 0.231309f, 0.226265f, 0.228884f, -0.127129f, 0.296158f, 0.192483f };
+static const float smart_transformer_fault_detection_sparse_layer_0_biases[64] = { 0.195883f, -0.321858f, 0.155625f, 0.021169f, -0.268351f, 0.104346f, -0.172950f, -0.192261f, -0.167199f, 0.200355f, 0.637809f, 0.291629f, 0.314117f, 0.272379f, -0.228018f, -0.115900f, -0.049781f, -0.124406f, -0.202930f, 0.636311f, -0.288633f, 0.213213f, -0.157226f, -0.668087f, -0.235571f, 0.179030f, 0.692271f, -0.190982f, 0.616722f, 0.311030f, -0.327274f, -0.077086f, -0.151561f, 0.015181f, -0.011543f, 0.186354f, 0.167646f, -0.054950f, 0.115999f, 0.073735f, 0.339896f, 0.143775f, 0.284616f, 0.053345f, -0.094785f, 0.615114f, 0.016343f, -0.592599f, 0.307095f, -0.580832f, -0.051652f, 0.105669f, 0.183216f, 0.317876f, 0.123901f, 0.203961f, -0.076180f, -0.037909f, 0.019060f, 0.129334f, 0.211765f, -0.527403f, -0.206141f, 0.599678f };
+static const uint16_t smart_transformer_fault_detection_sparse_layer_1_row_ptr[362] = { 0, 32, 68, 108, 143, 168, 199, 237, 272, 310, 345, 385, 423, 462, 501, 537, 581, 615, 647, 688, 720, 757, 788, 824, 858, 894, 927, 964, 998, 1033, 1066, 1096, 1131, 1168, 1206, 1242, 1274, 1304, 1337, 1372, 1404, 1443, 1479, 1510, 1531, 1567, 1607, 1649, 1685, 1716, 1751, 1786, 1824, 1866, 1905, 1943, 1980, 2018, 2059, 2089, 2127, 2167, 2201, 2236, 2266, 2297, 2331, 2371, 2410, 2447, 2484, 2517, 2549, 2588, 2626, 2666, 2702, 2735, 2764, 2804, 2845, 2875, 2914, 2954, 2982, 3015, 3052, 3082, 3116, 3150, 3186, 3211, 3245, 3279, 3313, 3356, 3392, 3426, 3457, 3495, 3528, 3557, 3589, 3628, 3660, 3692, 3728, 3769, 3802, 3831, 3869, 3905, 3942, 3981, 4017, 4061, 4090, 4122, 4159, 4193, 4224, 4260, 4295, 4324, 4357, 4399, 4436, 4467, 4505, 4539, 4571, 4608, 4648, 4684, 4725, 4759, 4797, 4834, 4873, 4912, 4948, 4988, 5023, 5059, 5094, 5131, 5169, 5204, 5239, 5277, 5317, 5348, 5377, 5416, 5456, 5491, 5530, 5568, 5596, 5630, 5670, 5706, 5741, 5778, 5817, 5855, 5881, 5921, 5957, 5997, 6034, 6068, 6099, 6128, 6163, 6200, 6232, 6275, 6313, 6349, 6385, 6423, 6457, 6489, 6524, 6559, 6595, 6620, 6654, 6692, 6728, 6762, 6801, 6843, 6886, 6926, 6956, 6997, 7027, 7062, 7096, 7129, 7156, 7187, 7218, 7252, 7287, 7322, 7359, 7394, 7432, 7469, 7503, 7535, 7571, 7611, 7653, 7697, 7731, 7766, 7804, 7838, 7880, 7924, 7958, 8001, 8040, 8073, 8107, 8137, 8173, 8203, 8242, 8283, 8313, 8351, 8382, 8421, 8453, 8490, 8525, 8556, 8597, 8636, 8673, 8707, 8739, 8772, 8806, 8847, 8875, 8914, 8950, 8990, 9026, 9056, 9087, 9121, 9152, 9189, 9228, 9263, 9302, 9334, 9371, 9406, 9444, 9481, 9520, 9555, 9589, 9629, 9666, 9695, 9733, 9774, 9808, 9841, 9875, 9905, 9938, 9969, 10010, 10049, 10090, 10118, 10151, 10193, 10233, 10267, 10304, 10335, 10372, 10405, 10441, 10482, 10521, 10552, 10582, 10611, 10647, 10681, 10727, 10759, 10799, 10828, 10869, 10904, 10938, 10975, 11014, 11051, 11080, 11115, 11149, 11185, 11219, 11251, 11290, 11318, 11353, 11391, 11427, 11457, 11492, 11532, 11567, 11604, 11639, 11676, 11710, 11749, 11786, 11827, 11860, 11895, 11932, 11980, 12017, 12050, 12087, 12122, 12164, 12195, 12227, 12257, 12292, 12324, 12370, 12408, 12447, 12480, 12517, 12550, 12581, 12617, 12648, 12689, 12725, 12757, 12795, 12820 };
+static const uint16_t smart_transformer_fault_detection_sparse_layer_1_col_index[12820] = { 1, 2, 4, 6, 7, 9, 10, 12, 14, 17, 19, 20, 21, 23, 24, 26, 30, 32, 36, 37, 39, 41, 46, 47, 48, 49, 50, 51, 52, 53, 59, 63, 1, 4, 5, 6, 7, 9, 10, 11, 12, 13, 14, 19, 20, 22, 23, 24, 27, 33, 34, 36, 37, 38, 40, 41, 42, 44, 49, 50, 51, 52, 54, 56, 58, 59, 60, 63, 0, 1, 5, 6, 7, 8, 10, 14, 15, 16, 17, 19, 20, 21, 22, 23, 24, 26, 27, 29, 31, 32, 33, 35, 37, 39, 40, 42, 43, 44, 45, 46, 47, 49, 51, 55, 56, 60, 61, 62, 1, 2, 3, 4, 6, 7, 10, 11, 12, 14, 15, 16, 17, 18, 20, 22, 25, 29, 31, 32, 33, 34, 35, 37, 38, 41, 42, 44, 45, 47, 53, 54, 58, 60, 63, 1, 2, 3, 4, 5, 6, 7, 8, 12, 15, 26, 29, 36, 38, 39, 42, 43, 44, 51, 54, 56, 58, 59, 61, 63, 0, 3, 4, 6, 8, 10, 14, 15, 19, 22, 24, 25, 26, 28, 33, 35, 37, 38, 40, 46, 48, 49, 51, 53, 55, 56, 57, 59, 60, 61, 63, 0, 1, 2, 4, 6, 8, 9, 10, 11, 12, 13, 14, 15, 17, 20, 21, 22, 23, 26, 28, 30, 32, 33, 34, 35, 36, 38, 39, 41, 43, 45, 47, 49, 50, 53, 55, 57, 59, 1, 5, 6, 8, 9, 12, 13, 14, 15, 17, 19, 20, 23, 25, 26, 27, 29, 31, 32, 36, 38, 39, 41, 42, 46, 47, 50, 51, 53, 54, 55, 56, 57, 60, 61, 0, 1, 2, 4, 8, 9, 10, 11, 13, 14, 15, 16, 17, 23, 25, 26, 28, 29, 30, 31, 32, 35, 39, 41, 42, 43, 45, 47, 48, 51, 52, 54, 55, 56, 57, 60, 62, 63, 0, 1, 4, 6, 9, 11, 12, 13, 17, 20, 23, 24, 26, 28, 29, 31, 34, 35, 36, 37, 38, 39, 40, 43, 44, 46, 48, 49, 51, 52, 53, 54, 55, 59, 60, 1, 2, 3, 4, 5, 8, 9, 10, 13, 14, 16, 18, 21, 23, 24, 25, 26, 29, 30, 31, 32, 33, 34, 35, 36, 37, 39, 42, 43, 46, 47, 49, 50, 51, 53, 54, 58, 60, 61, 62, 2, 3, 5, 6, 7, 8, 9, 11, 13, 14, 16, 17, 18, 19, 23, 24, 25, 26, 28, 30, 31, 32, 33, 35, 37, 40, 42, 43, 47, 48, 49, 53, 55, 56, 57, 58, 59, 61, 0, 2, 3, 4, 7, 8, 9, 13, 15, 17, 18, 21, 23, 25, 26, 27, 32, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 46, 47, 49, 52, 54, 55, 56, 57, 58, 59, 61, 62, 0, 2, 5, 8, 11, 12, 14, 15, 16, 17, 18, 19, 20, 23, 24, 25, 26, 28, 29, 30, 34, 35, 38, 39, 41, 43, 44, 45, 46, 48, 49, 50, 54, 56, 58, 60, 61, 62, 63, 0, 1, 6, 7, 8, 9, 10, 11, 12, 14, 15, 17, 18, 19, 22, 24, 25, 26, 27, 28, 31, 35, 37, 38, 40, 41, 43, 44, 46, 47, 48, 49, 50, 56, 57, 59, 0, 2, 4, 5, 6, 7, 9, 10, 11, 16, 17, 18, 19, 20, 21, 23, 24, 25, 26, 28, 29, 30, 31, 32, 33, 34, 35, 36, 39, 40, 41, 42, 43, 45, 46, 47, 49, 53, 55, 56, 57, 60, 62, 63, 1, 2, 3, 4, 5, 7, 10, 12, 13, 14, 17, 19, 20, 22, 23, 24, 26, 27, 31, 32, 33, 34, 39, 40, 42, 44, 46, 51, 52, 54, 55, 56, 62, 63, 0, 5, 6, 7, 8, 9, 13, 14, 15, 17, 20, 24, 26, 29, 32, 33, 34, 36, 37, 40, 41, 43, 44, 45, 47, 50, 51, 53, 54, 57, 58, 60, 0, 1, 5, 6, 7, 9, 10, 11, 12, 13, 14, 15, 19, 21, 22, 23, 24, 26, 27, 28, 29, 34, 37, 38, 39, 41, 42, 43, 44, 45, 46, 47, 49, 51, 52, 54, 56, 57, 60, 62, 63, 0, 1, 4, 7, 9, 11, 12, 15, 17, 18, 24, 27, 30, 31, 33, 34, 36, 38, 41, 42, 44, 46, 49, 51, 53, 54, 55, 56, 58, 59, 60, 63, 3, 6, 7, 9, 10, 11, 12, 13, 15, 17, 18, 19, 20, 21, 22, 23, 25, 29, 33, 34, 36, 37, 39, 41, 43, 45, 46, 47, 48, 50, 51, 54, 55, 56, 57, 60, 63, 2, 3, 6, 9, 11, 12, 14, 15, 17, 18, 19, 20, 22, 23, 24, 26, 28, 34, 35, 36, 40, 42, 46, 49, 52, 55, 56, 57, 60, 61, 63, 0, 3, 4, 5, 6, 9, 11, 13, 14, 15, 16, 17, 20, 23, 25, 28, 29, 30, 31, 32, 37, 39, 40, 41, 42, 43, 45, 47, 48, 50, 51, 52, 57, 59, 61, 62, 1, 2, 3, 5, 6, 7, 9, 10, 12, 14, 15, 21, 24, 25, 27, 29, 31, 33, 35, 38, 39, 40, 41, 42, 44, 46, 47, 50, 53, 54, 55, 56, 57, 59, 0, 1, 4, 5, 6, 7, 8, 10, 11, 12, 14, 15, 16, 17, 21, 22, 24, 25, 26, 30, 35, 36, 37, 38, 39, 40, 42, 45, 50, 53, 54, 55, 57, 61, 62, 63, 0, 1, 2, 4, 6, 7, 10, 13, 14, 16, 17, 19, 21, 22, 23, 24, 26, 29, 30, 31, 35, 37, 39, 40, 41, 44, 45, 46, 47, 48, 49, 52, 63, 0, 1, 3, 5, 6, 8, 9, 10, 11, 12, 15, 17, 18, 20, 21, 22, 24, 25, 26, 28, 29, 32, 34, 36, 38, 40, 42, 48, 49, 51, 52, 55, 56, 57, 58, 59, 61, 0, 1, 2, 4, 5, 6, 12, 13, 14, 15, 23, 25, 31, 32, 33, 36, 37, 39, 41, 42, 43, 44, 45, 46, 47, 49, 50, 51, 52, 53, 56, 57, 59, 62, 0, 2, 4, 5, 6, 7, 9, 10, 11, 15, 17, 18, 20, 21, 25, 26, 28, 29, 30, 32, 35, 36, 38, 40, 42, 44, 47, 49, 50, 52, 53, 55, 56, 58, 63, 1, 2, 4, 5, 7, 10, 11, 12, 13, 15, 18, 19, 23, 24, 26, 30, 32, 35, 37, 38, 39, 41, 42, 43, 47, 48, 49, 51, 52, 53, 54, 59, 63, 1, 2, 3, 7, 8, 10, 11, 12, 14, 16, 18, 19, 23, 26, 27, 31, 32, 34, 35, 36, 37, 42, 43, 44, 48, 50, 53, 56, 57, 60, 0, 1, 2, 4, 6, 7, 8, 11, 13, 15, 21, 23, 24, 25, 29, 30, 31, 33, 34, 35, 36, 37, 40, 41, 42, 44, 45, 46, 47, 50, 51, 53, 56, 59, 60, 0, 1, 2, 3, 4, 5, 7, 9, 11, 12, 13, 14, 15, 16, 17, 18, 20, 21, 23, 28, 29, 30, 35, 37, 38, 41, 42, 44, 45, 48, 49, 50, 51, 53, 54, 59, 60, 0, 1, 2, 5, 10, 12, 13, 14, 15, 18, 21, 22, 23, 24, 25, 26, 28, 29, 31, 32, 35, 38, 39, 42, 43, 44, 46, 47, 49, 50, 52, 53, 56, 57, 58, 59, 60, 62, 0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 14, 15, 17, 18, 19, 21, 24, 30, 31, 32, 34, 35, 39, 42, 44, 45, 47, 48, 50, 52, 53, 54, 59, 60, 61, 0, 1, 5, 8, 11, 12, 15, 16, 18, 20, 22, 26, 27, 29, 30, 32, 33, 34, 36, 37, 38, 39, 40, 42, 44, 45, 48, 50, 51, 55, 60, 62, 0, 1, 6, 7, 8, 12, 14, 15, 16, 20, 21, 24, 28, 30, 31, 35, 36, 37, 38, 43, 44, 47, 48, 49, 52, 53, 55, 59, 61, 62, 2, 4, 5, 7, 8, 9, 11, 13, 22, 26, 28, 32, 33, 35, 36, 38, 39, 40, 41, 42, 43, 44, 48, 50, 52, 53, 56, 57, 58, 59, 60, 61, 63, 0, 3, 8, 10, 12, 14, 15, 16, 17, 18, 21, 24, 26, 29, 32, 35, 37, 38, 41, 42, 44, 45, 46, 48, 49, 50, 51, 52, 54, 55, 56, 58, 59, 60, 61, 1, 2, 4, 8, 9, 11, 12, 14, 15, 16, 20, 21, 24, 25, 26, 32, 33, 34, 35, 36, 37, 39, 41, 43, 44, 46, 47, 48, 50, 51, 59, 62, 3, 4, 5, 6, 7, 9, 10, 12, 13, 15, 16, 19, 20, 21, 23, 24, 27, 28, 30, 31, 33, 34, 35, 40, 41, 42, 44, 45, 46, 48, 49, 50, 52, 54, 55, 60, 61, 62, 63, 0, 2, 3, 4, 6, 8, 9, 10, 12, 13, 14, 15, 16, 19, 20, 23, 26, 27, 29, 30, 32, 35, 36, 40, 41, 42, 44, 46, 47, 49, 51, 53, 55, 57, 59, 63, 2, 4, 6, 7, 12, 13, 14, 15, 16, 19, 21, 22, 23, 25, 26, 27, 29, 30, 33, 34, 35, 40, 41, 42, 43, 45, 47, 50, 51, 59, 63, 1, 2, 4, 5, 12, 15, 16, 19, 20, 22, 23, 24, 31, 35, 36, 37, 38, 40, 45, 48, 57, 2, 3, 6, 7, 8, 10, 11, 12, 15, 18, 19, 21, 23, 27, 30, 31, 32, 34, 35, 40, 41, 42, 43, 44, 46, 47, 48, 50, 52, 53, 54, 55, 56, 58, 60, 63, 0, 3, 4, 5, 7, 9, 12, 13, 14, 15, 16, 17, 22, 24, 25, 26, 27, 28, 30, 33, 35, 39, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 53, 54, 55, 56, 58, 61, 62, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 13, 15, 16, 20, 21, 23, 24, 25, 27, 28, 29, 30, 31, 32, 33, 34, 40, 42, 43, 47, 48, 49, 50, 52, 53, 55, 56, 57, 58, 59, 61, 62, 1, 3, 4, 7, 10, 11, 12, 13, 15, 19, 21, 22, 23, 25, 27, 28, 29, 30, 31, 33, 34, 41, 43, 44, 45, 46, 47, 48, 49, 50, 51, 56, 60, 61, 62, 63, 1, 3, 4, 7, 10, 12, 14, 16, 18, 22, 23, 28, 29, 31, 35, 36, 39, 40, 41, 43, 44, 45, 46, 48, 51, 53, 55, 56, 59, 60, 62, 2, 3, 5, 7, 8, 13, 14, 15, 17, 18, 20, 21, 23, 24, 28, 30, 31, 32, 33, 34, 35, 37, 40, 41, 43, 45, 47, 51, 53, 54, 56, 59, 61, 62, 63, 1, 3, 4, 7, 9, 10, 11, 13, 14, 15, 17, 18, 19, 22, 23, 26, 30, 32, 34, 38, 39, 42, 46, 47, 48, 49, 50, 52, 55, 56, 59, 60, 61, 62, 63, 0, 2, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 16, 17, 18, 21, 22, 23, 25, 26, 27, 28, 29, 30, 31, 36, 37, 38, 39, 40, 41, 42, 51, 54, 56, 57, 59, 61, 0, 1, 3, 6, 9, 10, 12, 15, 16, 17, 18, 19, 21, 22, 24, 25, 26, 27, 28, 30, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 47, 49, 50, 53, 55, 56, 58, 60, 61, 62, 63, 0, 2, 3, 4, 5, 7, 8, 9, 11, 12, 15, 16, 18, 19, 20, 21, 22, 23, 25, 26, 28, 30, 32, 33, 34, 36, 37, 41, 42, 43, 46, 47, 49, 54, 57, 58, 60, 62, 63, 0, 1, 2, 3, 4, 6, 9, 11, 12, 16, 17, 18, 20, 21, 23, 24, 25, 26, 27, 29, 30, 33, 35, 37, 38, 39, 41, 43, 45, 46, 49, 50, 53, 54, 56, 57, 62, 63, 0, 1, 2, 3, 4, 5, 6, 8, 10, 11, 12, 14, 15, 16, 17, 18, 21, 22, 24, 26, 27, 28, 29, 30, 35, 36, 37, 39, 41, 42, 43, 46, 49, 50, 55, 56, 62, 2, 3, 4, 6, 8, 9, 11, 12, 13, 15, 16, 18, 21, 22, 23, 24, 27, 28, 30, 31, 33, 36, 38, 39, 40, 41, 42, 46, 48, 49, 50, 51, 53, 57, 58, 61, 62, 63, 0, 1, 3, 4, 5, 6, 8, 11, 12, 13, 14, 15, 16, 17, 18, 19, 21, 23, 24, 28, 29, 32, 35, 36, 39, 40, 41, 42, 44, 45, 46, 47, 50, 51, 56, 57, 58, 59, 61, 62, 63, 0, 1, 2, 3, 4, 5, 6, 9, 10, 12, 14, 16, 17, 18, 20, 21, 24, 29, 33, 37, 38, 44, 45, 46, 47, 48, 50, 51, 60, 63, 0, 1, 3, 4, 7, 8, 9, 11, 13, 15, 16, 17, 19, 20, 21, 22, 23, 27, 28, 32, 35, 36, 38, 39, 40, 41, 44, 45, 46, 47, 49, 52, 54, 55, 57, 59, 60, 62, 0, 1, 2, 6, 7, 8, 10, 12, 14, 15, 16, 18, 20, 22, 23, 24, 25, 27, 28, 29, 31, 33, 35, 38, 39, 40, 42, 43, 45, 46, 47, 48, 50, 51, 52, 54, 56, 57, 60, 63, 4, 6, 7, 9, 11, 13, 15, 16, 18, 19, 20, 21, 22, 23, 28, 30, 31, 33, 36, 38, 40, 41, 43, 46, 48, 50, 51, 52, 54, 55, 57, 58, 62, 63, 0, 1, 2, 4, 6, 7, 8, 9, 10, 13, 15, 16, 17, 19, 20, 25, 26, 27, 29, 33, 37, 39, 41, 43, 46, 47, 48, 50, 51, 52, 53, 54, 59, 61, 62, 0, 2, 5, 7, 10, 12, 13, 14, 15, 16, 17, 18, 19, 21, 22, 23, 24, 26, 28, 29, 33, 35, 38, 45, 46, 49, 50, 52, 54, 55, 3, 4, 5, 8, 9, 14, 15, 16, 18, 20, 22, 23, 26, 27, 28, 29, 31, 32, 33, 35, 36, 38, 40, 42, 44, 54, 55, 57, 60, 61, 63, 3, 6, 7, 8, 9, 10, 12, 13, 14, 16, 22, 23, 24, 28, 29, 30, 32, 33, 34, 35, 38, 39, 44, 45, 46, 49, 50, 51, 52, 54, 57, 58, 59, 60, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 19, 23, 26, 27, 28, 29, 32, 33, 34, 36, 37, 41, 42, 45, 48, 49, 51, 52, 54, 55, 56, 59, 60, 61, 62, 63, 0, 3, 4, 5, 6, 9, 10, 11, 12, 14, 15, 16, 18, 19, 21, 23, 24, 25, 26, 32, 33, 34, 35, 36, 39, 40, 44, 46, 47, 49, 50, 51, 54, 57, 58, 59, 60, 62, 63, 0, 2, 3, 5, 6, 7, 8, 12, 15, 17, 18, 19, 20, 21, 23, 29, 30, 31, 32, 36, 38, 39, 42, 43, 44, 46, 47, 48, 49, 51, 55, 56, 57, 58, 59, 61, 63, 0, 1, 2, 3, 7, 11, 13, 14, 17, 18, 19, 20, 21, 23, 25, 26, 29, 31, 32, 33, 35, 36, 37, 39, 40, 42, 43, 45, 46, 48, 50, 51, 53, 54, 56, 58, 61, 0, 1, 2, 3, 4, 5, 6, 7, 9, 12, 13, 15, 20, 21, 22, 23, 25, 26, 28, 32, 33, 37, 40, 41, 42, 44, 45, 47, 48, 49, 57, 62, 63, 1, 2, 3, 4, 5, 7, 8, 9, 10, 12, 13, 14, 19, 21, 24, 28, 29, 31, 33, 34, 35, 37, 38, 39, 42, 43, 46, 48, 49, 58, 59, 60, 2, 3, 8, 9, 10, 11, 13, 14, 15, 19, 20, 21, 25, 26, 27, 28, 29, 30, 33, 34, 36, 37, 38, 41, 43, 46, 47, 48, 49, 50, 51, 53, 54, 55, 56, 59, 60, 61, 63, 0, 1, 4, 5, 6, 8, 10, 11, 13, 14, 19, 20, 23, 24, 26, 28, 29, 32, 34, 35, 38, 40, 41, 42, 44, 45, 46, 47, 48, 49, 50, 51, 52, 54, 55, 56, 60, 61, 0, 2, 3, 5, 6, 7, 8, 10, 11, 12, 14, 15, 17, 18, 21, 22, 26, 27, 29, 33, 34, 35, 37, 38, 39, 40, 41, 42, 45, 46, 48, 49, 50, 52, 53, 55, 56, 57, 58, 60, 0, 2, 3, 8, 10, 12, 15, 16, 17, 19, 21, 26, 27, 31, 33, 34, 35, 36, 38, 39, 41, 42, 44, 45, 47, 49, 50, 51, 52, 53, 54, 56, 58, 59, 62, 63, 1, 6, 7, 11, 12, 15, 16, 21, 22, 23, 24, 25, 29, 30, 31, 33, 34, 36, 38, 39, 41, 42, 43, 44, 47, 48, 49, 51, 53, 54, 60, 61, 63, 3, 4, 7, 8, 10, 20, 24, 25, 26, 27, 29, 32, 33, 34, 35, 39, 40, 41, 44, 45, 47, 50, 51, 52, 54, 55, 60, 62, 63, 0, 6, 8, 10, 11, 14, 15, 16, 17, 19, 20, 21, 23, 24, 25, 26, 27, 28, 29, 31, 32, 34, 36, 37, 38, 39, 41, 42, 43, 45, 46, 47, 48, 50, 51, 54, 59, 61, 62, 63, 2, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 20, 21, 23, 24, 25, 26, 28, 29, 31, 32, 34, 35, 36, 37, 38, 42, 44, 45, 47, 48, 49, 51, 52, 54, 61, 62, 63, 2, 3, 5, 6, 11, 12, 15, 16, 18, 19, 20, 25, 26, 29, 31, 33, 34, 37, 38, 40, 41, 43, 47, 50, 51, 52, 53, 56, 62, 63, 1, 2, 3, 4, 7, 9, 12, 13, 14, 15, 17, 18, 19, 22, 25, 26, 29, 32, 34, 35, 37, 38, 40, 41, 42, 43, 46, 47, 48, 49, 51, 53, 54, 55, 57, 58, 59, 60, 61, 0, 1, 2, 3, 5, 7, 9, 10, 12, 13, 14, 15, 16, 21, 23, 24, 25, 27, 29, 30, 31, 33, 35, 37, 41, 42, 43, 44, 47, 48, 49, 51, 53, 54, 55, 56, 57, 59, 61, 63, 2, 7, 8, 9, 11, 12, 14, 15, 16, 17, 19, 29, 31, 32, 33, 34, 35, 37, 38, 40, 41, 45, 49, 51, 52, 54, 60, 61, 0, 1, 2, 5, 9, 10, 12, 13, 15, 16, 17, 19, 21, 24, 27, 29, 31, 34, 35, 36, 38, 40, 44, 47, 48, 49, 51, 52, 54, 55, 56, 60, 62, 0, 2, 3, 4, 5, 6, 8, 9, 10, 12, 14, 15, 16, 19, 23, 24, 26, 27, 28, 30, 31, 35, 37, 38, 41, 43, 45, 46, 47, 49, 50, 52, 53, 55, 56, 57, 61, 0, 3, 6, 9, 10, 11, 12, 13, 15, 16, 17, 21, 22, 31, 32, 34, 39, 44, 47, 48, 49, 50, 53, 54, 57, 58, 59, 60, 62, 63, 2, 3, 4, 5, 7, 10, 11, 12, 13, 15, 16, 17, 18, 21, 22, 26, 27, 28, 30, 33, 37, 38, 40, 44, 45, 47, 52, 54, 55, 57, 58, 59, 60, 63, 0, 3, 5, 7, 8, 9, 13, 18, 21, 22, 23, 26, 27, 29, 30, 31, 32, 33, 35, 36, 37, 39, 40, 42, 43, 46, 48, 49, 55, 56, 58, 59, 60, 62, 0, 2, 4, 5, 7, 8, 9, 10, 12, 16, 20, 21, 23, 24, 26, 30, 31, 32, 35, 37, 40, 41, 43, 44, 45, 46, 47, 50, 51, 52, 53, 54, 57, 59, 61, 62, 0, 2, 4, 9, 10, 12, 15, 18, 19, 20, 23, 26, 30, 31, 32, 37, 38, 40, 42, 43, 50, 55, 56, 62, 63, 3, 7, 10, 11, 12, 13, 15, 16, 20, 23, 24, 25, 26, 28, 29, 33, 34, 35, 36, 37, 39, 41, 42, 45, 47, 48, 49, 50, 52, 53, 56, 60, 61, 62, 0, 1, 2, 5, 7, 8, 9, 10, 11, 14, 16, 17, 18, 19, 21, 23, 24, 26, 29, 30, 31, 34, 38, 40, 41, 42, 46, 47, 49, 50, 54, 56, 58, 61, 0, 1, 5, 6, 8, 10, 13, 15, 16, 19, 20, 21, 23, 25, 26, 27, 28, 30, 32, 33, 34, 38, 39, 40, 43, 44, 45, 46, 47, 48, 49, 50, 53, 54, 0, 1, 2, 4, 5, 6, 8, 9, 11, 13, 14, 15, 17, 18, 20, 24, 25, 28, 29, 30, 32, 33, 34, 35, 36, 37, 38, 40, 41, 42, 44, 45, 46, 47, 50, 51, 52, 55, 56, 57, 60, 61, 63, 0, 1, 5, 6, 7, 8, 11, 12, 14, 15, 16, 20, 24, 27, 28, 29, 30, 31, 33, 35, 38, 41, 44, 46, 48, 49, 50, 51, 52, 54, 56, 59, 60, 61, 62, 63, 2, 3, 4, 6, 7, 9, 10, 13, 14, 15, 17, 19, 20, 21, 23, 24, 25, 26, 27, 31, 33, 35, 36, 42, 44, 45, 46, 49, 51, 52, 55, 61, 62, 63, 0, 1, 6, 7, 9, 20, 21, 23, 25, 28, 29, 30, 31, 33, 34, 35, 37, 39, 42, 43, 45, 46, 51, 53, 55, 56, 57, 58, 60, 61, 63, 2, 3, 4, 5, 6, 9, 10, 11, 12, 14, 16, 18, 19, 20, 21, 22, 23, 24, 25, 27, 28, 30, 32, 33, 37, 39, 40, 43, 44, 45, 46, 49, 51, 52, 53, 54, 62, 63, 1, 4, 5, 6, 8, 9, 10, 11, 12, 14, 15, 16, 18, 19, 21, 26, 33, 37, 38, 39, 45, 46, 47, 48, 51, 52, 53, 54, 55, 56, 58, 59, 61, 3, 4, 5, 6, 8, 9, 11, 14, 15, 16, 17, 19, 21, 25, 26, 28, 31, 32, 34, 35, 46, 47, 50, 52, 53, 54, 55, 56, 60, 2, 3, 6, 7, 10, 13, 16, 17, 23, 25, 27, 28, 30, 31, 32, 35, 37, 38, 40, 41, 42, 43, 45, 46, 47, 48, 49, 51, 57, 61, 62, 63, 1, 2, 3, 5, 6, 7, 9, 10, 11, 13, 14, 15, 18, 20, 23, 25, 27, 28, 29, 30, 31, 33, 35, 36, 38, 41, 42, 43, 44, 45, 46, 49, 51, 52, 53, 54, 58, 59, 62, 0, 3, 4, 5, 7, 9, 10, 11, 12, 15, 17, 19, 23, 24, 25, 26, 30, 31, 33, 36, 37, 38, 40, 41, 45, 47, 48, 49, 51, 52, 61, 63, 1, 3, 6, 7, 8, 9, 12, 14, 15, 16, 17, 18, 19, 21, 23, 24, 26, 31, 35, 37, 42, 44, 45, 46, 47, 48, 50, 52, 55, 56, 62, 63, 0, 1, 3, 4, 5, 9, 11, 12, 13, 15, 17, 18, 21, 22, 23, 24, 26, 27, 28, 29, 30, 34, 35, 37, 38, 41, 43, 46, 48, 50, 54, 55, 57, 58, 59, 63, 0, 1, 2, 6, 7, 8, 11, 12, 13, 16, 17, 18, 20, 22, 23, 24, 25, 27, 28, 29, 30, 31, 34, 38, 39, 41, 43, 44, 45, 46, 47, 49, 51, 54, 55, 56, 57, 59, 60, 61, 62, 2, 3, 5, 6, 9, 12, 14, 15, 16, 18, 21, 23, 25, 26, 27, 29, 30, 33, 35, 38, 40, 42, 43, 50, 51, 52, 53, 54, 55, 60, 61, 62, 63, 0, 1, 6, 7, 9, 10, 12, 15, 16, 19, 21, 22, 23, 27, 30, 31, 32, 35, 36, 38, 41, 47, 53, 54, 56, 59, 60, 62, 63, 1, 2, 4, 5, 6, 10, 11, 12, 13, 14, 15, 19, 20, 21, 23, 27, 29, 32, 33, 36, 37, 39, 40, 41, 42, 44, 45, 46, 47, 51, 52, 53, 54, 56, 57, 59, 60, 62, 3, 5, 6, 7, 9, 12, 13, 14, 15, 16, 21, 23, 24, 27, 29, 30, 31, 32, 33, 34, 36, 37, 38, 40, 42, 44, 47, 51, 52, 54, 55, 56, 57, 58, 61, 62, 0, 1, 2, 3, 6, 8, 10, 11, 15, 19, 20, 21, 23, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 39, 42, 43, 44, 45, 46, 48, 49, 50, 51, 52, 55, 58, 61, 1, 3, 4, 6, 10, 12, 13, 15, 16, 18, 19, 23, 24, 25, 27, 28, 29, 30, 34, 35, 37, 39, 42, 43, 44, 45, 46, 47, 49, 50, 51, 53, 54, 55, 56, 57, 58, 59, 62, 0, 1, 3, 4, 6, 7, 8, 15, 16, 19, 20, 21, 22, 24, 25, 26, 27, 28, 29, 30, 31, 33, 36, 39, 41, 45, 46, 48, 56, 57, 58, 59, 60, 61, 62, 63, 0, 1, 2, 4, 5, 7, 8, 9, 10, 11, 12, 13, 15, 17, 18, 20, 21, 23, 24, 25, 27, 28, 29, 30, 31, 33, 34, 38, 40, 41, 42, 43, 44, 48, 49, 51, 52, 54, 55, 56, 57, 58, 61, 62, 1, 6, 10, 14, 15, 16, 19, 20, 21, 23, 26, 28, 29, 31, 32, 35, 37, 38, 39, 45, 46, 47, 49, 52, 53, 54, 55, 56, 59, 1, 5, 6, 9, 12, 13, 14, 15, 16, 20, 21, 22, 23, 24, 27, 28, 30, 33, 36, 37, 39, 41, 42, 44, 45, 47, 49, 52, 56, 58, 60, 61, 0, 1, 2, 3, 4, 5, 7, 10, 11, 13, 15, 17, 19, 20, 22, 23, 25, 26, 28, 30, 32, 33, 35, 38, 40, 41, 44, 45, 48, 49, 50, 52, 53, 55, 58, 60, 62, 0, 2, 6, 7, 8, 10, 11, 12, 14, 15, 18, 19, 20, 21, 22, 23, 24, 26, 34, 35, 37, 38, 41, 45, 46, 47, 49, 52, 53, 56, 58, 60, 62, 63, 0, 1, 2, 5, 8, 10, 12, 13, 15, 19, 20, 22, 23, 26, 28, 30, 33, 35, 37, 38, 45, 49, 52, 53, 54, 55, 56, 57, 59, 60, 61, 1, 2, 4, 6, 7, 8, 9, 10, 11, 14, 15, 19, 20, 21, 26, 28, 29, 30, 32, 33, 34, 35, 37, 39, 40, 44, 45, 46, 47, 50, 54, 55, 56, 57, 59, 63, 1, 2, 4, 5, 6, 7, 11, 12, 15, 16, 17, 20, 21, 22, 24, 28, 29, 30, 31, 32, 33, 34, 40, 41, 42, 43, 48, 49, 50, 51, 52, 53, 54, 56, 62, 1, 4, 5, 9, 10, 11, 13, 15, 16, 17, 21, 22, 23, 27, 29, 30, 31, 36, 37, 39, 40, 43, 45, 47, 48, 49, 53, 60, 62, 4, 5, 8, 10, 11, 12, 13, 14, 16, 17, 20, 22, 30, 31, 32, 33, 34, 35, 42, 43, 44, 45, 47, 50, 52, 54, 55, 57, 58, 59, 60, 62, 63, 1, 3, 4, 7, 10, 11, 13, 15, 16, 18, 19, 20, 21, 24, 25, 26, 29, 31, 33, 34, 35, 38, 39, 40, 41, 42, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 56, 57, 60, 61, 62, 63, 1, 2, 3, 4, 8, 10, 11, 14, 20, 21, 22, 25, 27, 29, 32, 33, 34, 35, 36, 38, 39, 44, 45, 47, 48, 49, 51, 52, 53, 54, 55, 56, 59, 60, 61, 62, 63, 1, 2, 4, 6, 7, 15, 17, 18, 20, 24, 25, 27, 28, 31, 39, 40, 41, 43, 44, 45, 46, 48, 49, 52, 56, 57, 58, 59, 61, 62, 63, 1, 2, 3, 5, 7, 8, 9, 10, 11, 12, 13, 14, 16, 19, 20, 23, 25, 26, 28, 29, 32, 34, 35, 39, 40, 42, 44, 47, 48, 49, 51, 52, 54, 55, 57, 59, 61, 63, 2, 4, 5, 8, 9, 11, 13, 15, 16, 17, 18, 19, 21, 28, 30, 31, 35, 38, 39, 40, 43, 45, 47, 48, 50, 51, 53, 54, 57, 58, 59, 60, 61, 63, 1, 3, 6, 10, 13, 15, 16, 18, 24, 25, 27, 30, 32, 34, 36, 37, 38, 39, 40, 41, 42, 44, 45, 46, 48, 51, 52, 53, 54, 58, 59, 62, 1, 4, 6, 7, 8, 9, 10, 12, 14, 15, 16, 18, 19, 20, 23, 24, 26, 27, 30, 32, 33, 34, 35, 38, 40, 42, 43, 44, 46, 47, 50, 54, 55, 58, 60, 61, 63, 4, 7, 8, 9, 10, 11, 14, 15, 16, 17, 18, 19, 20, 21, 23, 29, 30, 32, 33, 34, 35, 36, 37, 38, 39, 43, 44, 45, 46, 47, 48, 49, 50, 51, 55, 56, 58, 59, 60, 63, 0, 3, 4, 7, 8, 10, 11, 12, 13, 14, 19, 20, 21, 23, 25, 26, 28, 31, 32, 33, 34, 38, 39, 42, 44, 45, 46, 49, 50, 53, 57, 58, 59, 60, 62, 63, 0, 2, 3, 5, 6, 7, 9, 10, 11, 12, 14, 15, 16, 17, 19, 22, 23, 24, 26, 27, 28, 30, 31, 33, 36, 38, 39, 43, 45, 46, 47, 48, 49, 50, 56, 57, 58, 59, 60, 61, 63, 0, 1, 2, 5, 6, 9, 10, 11, 12, 18, 21, 22, 23, 25, 28, 30, 32, 33, 37, 39, 40, 41, 42, 43, 46, 47, 48, 49, 50, 54, 58, 60, 61, 63, 0, 1, 3, 5, 11, 13, 15, 17, 18, 19, 21, 22, 23, 24, 25, 26, 27, 30, 31, 34, 36, 37, 38, 39, 42, 43, 45, 46, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 0, 1, 3, 5, 6, 8, 9, 11, 15, 17, 20, 21, 23, 24, 26, 30, 31, 32, 34, 35, 37, 38, 39, 40, 41, 42, 44, 46, 48, 51, 53, 54, 56, 59, 60, 61, 62, 1, 2, 4, 5, 6, 7, 8, 10, 11, 12, 13, 16, 18, 19, 23, 24, 25, 26, 30, 31, 32, 35, 36, 37, 41, 44, 45, 47, 48, 49, 51, 52, 53, 55, 57, 58, 59, 61, 63, 0, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 15, 16, 17, 18, 21, 24, 25, 27, 29, 30, 31, 32, 35, 36, 38, 40, 41, 42, 43, 44, 46, 47, 48, 50, 53, 58, 59, 60, 1, 7, 8, 9, 11, 12, 13, 14, 16, 18, 19, 22, 24, 25, 27, 28, 33, 34, 35, 36, 37, 38, 39, 40, 44, 45, 46, 48, 49, 50, 53, 54, 57, 60, 61, 62, 1, 3, 4, 5, 8, 11, 12, 13, 18, 19, 20, 21, 25, 28, 29, 31, 32, 34, 35, 36, 37, 39, 40, 41, 42, 43, 44, 46, 48, 49, 51, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 1, 2, 4, 5, 9, 13, 14, 15, 16, 20, 23, 24, 25, 26, 29, 33, 34, 36, 37, 38, 40, 41, 43, 44, 45, 46, 47, 49, 52, 53, 57, 60, 62, 63, 5, 6, 8, 11, 12, 14, 15, 17, 19, 21, 23, 24, 25, 26, 28, 30, 31, 32, 35, 38, 39, 40, 42, 44, 46, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 1, 2, 7, 10, 14, 15, 16, 17, 21, 22, 23, 24, 27, 29, 30, 32, 33, 34, 35, 37, 38, 39, 41, 43, 46, 49, 50, 52, 55, 56, 57, 59, 60, 62, 63, 0, 2, 7, 9, 10, 11, 13, 14, 15, 19, 22, 24, 30, 31, 33, 34, 35, 36, 37, 39, 42, 43, 44, 46, 47, 48, 49, 51, 52, 54, 55, 56, 57, 59, 61, 62, 63, 0, 4, 6, 7, 12, 13, 14, 15, 16, 17, 19, 21, 22, 23, 25, 26, 27, 28, 29, 30, 31, 33, 34, 35, 39, 40, 42, 44, 47, 48, 50, 52, 54, 56, 57, 58, 59, 63, 0, 2, 4, 6, 10, 11, 13, 14, 15, 20, 21, 24, 25, 26, 27, 34, 35, 38, 40, 42, 43, 45, 46, 47, 48, 50, 52, 53, 54, 55, 56, 57, 58, 61, 62, 0, 1, 2, 4, 5, 8, 12, 13, 14, 15, 16, 17, 18, 20, 21, 22, 25, 29, 30, 32, 33, 35, 38, 39, 40, 42, 44, 46, 52, 54, 57, 59, 60, 62, 63, 0, 1, 3, 4, 5, 6, 8, 10, 11, 13, 15, 16, 19, 20, 21, 22, 24, 25, 26, 28, 29, 30, 32, 33, 37, 38, 42, 44, 45, 46, 47, 48, 49, 52, 53, 57, 59, 63, 0, 1, 2, 5, 6, 7, 10, 11, 12, 13, 15, 18, 19, 20, 21, 25, 26, 30, 31, 32, 35, 37, 38, 39, 40, 41, 43, 44, 45, 46, 48, 49, 52, 53, 57, 58, 59, 60, 61, 63, 1, 3, 4, 6, 8, 10, 15, 16, 19, 20, 21, 22, 23, 24, 25, 28, 29, 30, 31, 34, 35, 36, 38, 41, 43, 44, 45, 53, 56, 61, 63, 0, 1, 3, 5, 6, 7, 9, 12, 14, 15, 21, 22, 23, 29, 30, 39, 40, 42, 43, 44, 45, 46, 53, 54, 56, 58, 59, 61, 62, 0, 1, 3, 7, 8, 9, 12, 13, 14, 15, 16, 22, 25, 26, 27, 28, 33, 34, 35, 36, 37, 39, 42, 43, 44, 46, 48, 49, 51, 52, 54, 55, 56, 57, 59, 60, 61, 62, 63, 1, 2, 3, 4, 6, 10, 11, 13, 14, 16, 17, 18, 20, 21, 22, 24, 25, 27, 28, 29, 33, 34, 35, 36, 38, 43, 44, 45, 46, 47, 48, 49, 52, 53, 55, 57, 58, 59, 60, 62, 0, 1, 2, 6, 7, 10, 11, 14, 16, 17, 18, 19, 21, 24, 26, 29, 30, 32, 33, 39, 42, 43, 44, 46, 47, 48, 49, 51, 55, 56, 57, 58, 60, 61, 62, 1, 2, 9, 11, 13, 15, 16, 17, 19, 20, 21, 22, 23, 24, 26, 28, 29, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 43, 44, 45, 47, 50, 53, 55, 56, 57, 58, 59, 62, 0, 1, 2, 6, 9, 14, 17, 18, 19, 20, 22, 23, 25, 27, 28, 29, 30, 32, 33, 34, 36, 37, 38, 39, 41, 42, 43, 44, 45, 48, 49, 52, 54, 55, 56, 57, 58, 59, 0, 1, 8, 10, 14, 15, 17, 23, 24, 27, 30, 31, 33, 35, 36, 37, 41, 42, 43, 44, 45, 46, 47, 50, 54, 59, 62, 63, 1, 3, 5, 8, 9, 10, 14, 15, 16, 17, 19, 20, 21, 22, 23, 24, 26, 29, 31, 33, 37, 42, 44, 45, 46, 47, 48, 50, 51, 52, 55, 59, 61, 63, 1, 2, 3, 5, 6, 7, 11, 12, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 27, 30, 33, 34, 36, 37, 39, 41, 46, 47, 48, 49, 51, 53, 55, 56, 60, 61, 62, 63, 1, 5, 6, 9, 11, 12, 13, 14, 15, 16, 17, 18, 22, 23, 24, 25, 26, 27, 28, 29, 31, 33, 34, 35, 38, 43, 44, 46, 48, 49, 50, 53, 54, 56, 61, 62, 1, 2, 3, 7, 8, 9, 10, 11, 12, 13, 15, 16, 18, 19, 21, 23, 27, 29, 33, 34, 36, 39, 40, 42, 46, 48, 49, 50, 51, 54, 55, 57, 59, 60, 63, 2, 3, 4, 8, 9, 10, 11, 14, 15, 19, 20, 21, 24, 25, 26, 27, 28, 29, 30, 31, 34, 35, 36, 38, 39, 40, 41, 44, 45, 47, 50, 51, 52, 54, 55, 56, 59, 0, 1, 2, 4, 6, 7, 8, 10, 12, 14, 15, 16, 17, 18, 19, 20, 22, 24, 25, 31, 36, 38, 39, 41, 43, 46, 47, 49, 51, 52, 53, 54, 55, 56, 57, 58, 60, 62, 63, 0, 1, 3, 4, 6, 7, 8, 10, 11, 15, 16, 17, 18, 19, 20, 24, 25, 26, 28, 30, 31, 32, 37, 38, 39, 44, 46, 47, 48, 49, 50, 52, 54, 55, 57, 59, 62, 63, 1, 2, 4, 5, 6, 11, 14, 16, 17, 19, 26, 27, 30, 33, 41, 42, 43, 44, 45, 49, 50, 52, 53, 55, 56, 61, 0, 2, 3, 5, 7, 11, 12, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 27, 30, 32, 33, 34, 37, 39, 40, 41, 43, 44, 45, 49, 51, 52, 53, 54, 56, 58, 59, 60, 61, 62, 1, 2, 3, 5, 6, 8, 9, 14, 15, 16, 19, 20, 21, 22, 25, 27, 29, 30, 32, 33, 35, 36, 40, 41, 42, 43, 44, 46, 48, 49, 50, 51, 52, 53, 55, 62, 0, 2, 5, 6, 8, 9, 11, 15, 17, 18, 19, 20, 22, 24, 26, 27, 28, 29, 30, 31, 33, 35, 37, 39, 40, 41, 43, 44, 45, 46, 50, 52, 53, 56, 57, 58, 59, 60, 61, 62, 1, 2, 3, 4, 6, 7, 8, 9, 11, 12, 14, 15, 17, 20, 21, 22, 24, 25, 28, 29, 30, 33, 35, 37, 38, 39, 41, 42, 50, 53, 54, 56, 57, 58, 60, 61, 62, 2, 3, 4, 5, 6, 9, 10, 11, 12, 17, 20, 25, 26, 27, 28, 33, 34, 36, 37, 38, 39, 40, 41, 42, 45, 48, 49, 52, 54, 55, 59, 60, 61, 62, 1, 6, 7, 8, 10, 11, 14, 15, 16, 18, 19, 21, 22, 26, 28, 29, 33, 34, 36, 38, 40, 41, 42, 43, 44, 45, 49, 50, 53, 54, 61, 0, 1, 3, 5, 8, 9, 12, 15, 21, 22, 25, 26, 28, 29, 30, 31, 34, 37, 38, 41, 44, 48, 49, 52, 55, 56, 57, 58, 60, 0, 1, 3, 4, 6, 10, 11, 12, 14, 15, 17, 18, 19, 20, 21, 22, 23, 24, 26, 28, 29, 30, 32, 38, 40, 43, 45, 46, 48, 50, 51, 54, 56, 59, 63, 0, 1, 2, 3, 6, 7, 8, 9, 10, 12, 14, 15, 17, 18, 19, 21, 25, 26, 28, 29, 30, 32, 35, 36, 37, 39, 40, 42, 43, 45, 50, 52, 55, 57, 58, 62, 63, 2, 4, 5, 6, 9, 12, 14, 15, 16, 17, 18, 22, 23, 24, 26, 29, 31, 32, 33, 34, 36, 38, 41, 43, 48, 49, 53, 54, 56, 57, 59, 60, 0, 2, 4, 5, 7, 9, 11, 15, 17, 18, 19, 21, 22, 23, 24, 25, 26, 27, 28, 31, 32, 33, 34, 35, 36, 37, 38, 39, 41, 42, 43, 45, 46, 47, 48, 49, 50, 51, 54, 55, 58, 62, 63, 1, 2, 3, 4, 5, 9, 10, 11, 12, 14, 15, 17, 21, 23, 24, 26, 27, 29, 30, 31, 34, 36, 37, 38, 42, 43, 46, 47, 49, 51, 52, 54, 55, 56, 58, 61, 62, 63, 2, 3, 5, 8, 9, 10, 13, 14, 15, 16, 17, 18, 20, 21, 23, 24, 25, 26, 28, 30, 31, 34, 36, 38, 42, 43, 45, 48, 49, 53, 55, 56, 57, 58, 59, 63, 0, 7, 8, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 26, 27, 30, 32, 34, 36, 37, 39, 40, 43, 45, 47, 48, 49, 50, 52, 55, 57, 58, 59, 60, 62, 63, 0, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 22, 24, 25, 27, 28, 31, 33, 34, 36, 40, 42, 43, 46, 47, 49, 50, 51, 52, 53, 54, 59, 61, 63, 0, 1, 2, 4, 5, 6, 9, 10, 11, 14, 15, 17, 20, 21, 24, 25, 28, 29, 30, 31, 32, 33, 38, 40, 41, 42, 46, 47, 48, 51, 52, 55, 62, 63, 1, 3, 5, 7, 9, 11, 12, 13, 14, 15, 19, 20, 22, 23, 27, 30, 33, 34, 37, 38, 39, 41, 44, 45, 46, 47, 50, 51, 56, 59, 61, 63, 1, 3, 5, 9, 12, 13, 14, 15, 19, 21, 22, 26, 27, 29, 30, 31, 32, 33, 38, 40, 42, 44, 45, 46, 48, 50, 51, 55, 56, 57, 58, 59, 60, 61, 63, 2, 5, 8, 10, 13, 15, 16, 17, 19, 20, 21, 22, 23, 26, 27, 28, 30, 32, 33, 34, 37, 38, 40, 44, 45, 46, 47, 51, 52, 56, 57, 58, 59, 62, 63, 0, 2, 3, 4, 5, 7, 10, 12, 14, 15, 17, 18, 19, 21, 22, 24, 26, 27, 28, 29, 33, 35, 36, 37, 38, 39, 42, 43, 44, 45, 49, 50, 56, 57, 60, 63, 3, 7, 9, 11, 12, 14, 16, 17, 19, 28, 33, 35, 37, 38, 39, 41, 42, 45, 46, 47, 52, 56, 57, 58, 63, 1, 2, 3, 5, 8, 12, 13, 15, 16, 22, 23, 24, 25, 27, 28, 30, 32, 33, 35, 36, 37, 38, 39, 40, 41, 44, 47, 49, 51, 54, 58, 59, 60, 61, 0, 1, 2, 6, 7, 9, 12, 13, 14, 15, 16, 19, 20, 21, 22, 23, 26, 27, 28, 29, 31, 33, 34, 36, 38, 39, 40, 44, 47, 50, 52, 53, 55, 56, 59, 61, 62, 63, 3, 7, 10, 12, 13, 15, 17, 18, 20, 21, 23, 24, 25, 26, 27, 28, 32, 33, 35, 37, 39, 41, 44, 45, 46, 47, 48, 49, 51, 53, 55, 56, 58, 59, 61, 63, 1, 6, 9, 12, 14, 15, 16, 21, 23, 24, 25, 26, 28, 29, 30, 32, 34, 35, 36, 38, 39, 41, 42, 43, 45, 46, 47, 49, 50, 53, 57, 60, 61, 62, 0, 1, 3, 4, 5, 6, 7, 8, 9, 11, 16, 19, 21, 23, 24, 25, 29, 32, 33, 34, 35, 36, 37, 39, 41, 44, 47, 49, 50, 51, 53, 54, 57, 58, 59, 60, 61, 62, 63, 0, 3, 5, 11, 12, 14, 16, 18, 19, 20, 21, 22, 23, 24, 25, 28, 29, 30, 31, 32, 33, 35, 36, 38, 40, 41, 42, 43, 44, 45, 46, 49, 51, 52, 53, 54, 55, 57, 58, 60, 62, 63, 0, 3, 4, 9, 10, 11, 12, 13, 14, 15, 20, 23, 24, 25, 26, 27, 29, 31, 32, 34, 35, 36, 37, 39, 40, 43, 44, 45, 46, 47, 48, 49, 51, 52, 53, 55, 56, 57, 58, 59, 61, 62, 63, 1, 2, 3, 4, 6, 8, 9, 10, 16, 18, 19, 20, 22, 23, 26, 27, 29, 31, 32, 33, 34, 36, 37, 38, 40, 42, 43, 44, 45, 47, 49, 50, 51, 54, 55, 58, 59, 60, 61, 63, 0, 1, 4, 6, 10, 13, 14, 15, 17, 18, 22, 23, 28, 29, 30, 32, 35, 36, 37, 38, 40, 41, 44, 47, 48, 50, 51, 58, 61, 62, 3, 4, 5, 6, 8, 10, 11, 13, 15, 16, 17, 18, 22, 24, 25, 26, 27, 28, 29, 31, 33, 34, 35, 36, 38, 39, 44, 46, 47, 48, 49, 50, 52, 53, 55, 56, 57, 58, 59, 61, 63, 0, 2, 4, 5, 6, 7, 8, 10, 13, 14, 15, 16, 19, 21, 24, 27, 31, 32, 33, 35, 36, 38, 40, 42, 45, 46, 48, 51, 55, 61, 2, 5, 6, 7, 10, 14, 15, 16, 22, 23, 25, 26, 28, 29, 30, 32, 33, 34, 35, 37, 38, 41, 44, 45, 46, 49, 50, 51, 52, 53, 55, 56, 57, 58, 59, 0, 1, 2, 3, 4, 5, 7, 8, 9, 13, 14, 15, 17, 20, 21, 26, 27, 28, 29, 30, 32, 33, 34, 37, 38, 39, 40, 43, 46, 48, 50, 53, 55, 61, 1, 2, 3, 5, 10, 12, 13, 14, 15, 16, 23, 24, 26, 27, 28, 29, 35, 36, 38, 41, 43, 44, 45, 46, 47, 49, 53, 54, 56, 57, 58, 59, 63, 1, 4, 9, 10, 12, 14, 15, 18, 21, 22, 24, 25, 26, 29, 31, 33, 34, 43, 45, 47, 49, 52, 56, 57, 59, 60, 63, 0, 2, 5, 10, 11, 13, 15, 16, 17, 18, 20, 25, 26, 27, 29, 32, 33, 34, 36, 37, 41, 42, 43, 45, 47, 49, 53, 54, 55, 58, 63, 1, 4, 6, 9, 11, 14, 15, 19, 22, 23, 24, 25, 26, 28, 32, 36, 38, 39, 40, 42, 46, 48, 49, 51, 52, 54, 56, 57, 58, 61, 63, 1, 2, 3, 6, 8, 9, 17, 18, 19, 21, 23, 28, 29, 30, 32, 37, 38, 39, 40, 41, 42, 43, 45, 46, 49, 50, 51, 55, 56, 57, 59, 60, 61, 62, 0, 2, 3, 4, 5, 6, 7, 8, 10, 15, 17, 19, 22, 24, 25, 26, 29, 31, 33, 34, 35, 39, 43, 44, 47, 48, 49, 51, 53, 56, 57, 59, 60, 61, 63, 2, 3, 4, 9, 11, 12, 13, 14, 15, 16, 20, 22, 23, 24, 25, 26, 27, 29, 30, 33, 34, 35, 36, 37, 39, 41, 42, 46, 47, 52, 53, 56, 57, 60, 61, 0, 1, 2, 3, 4, 5, 7, 10, 13, 15, 17, 18, 20, 22, 23, 24, 25, 26, 27, 29, 30, 31, 37, 40, 43, 45, 47, 48, 49, 51, 52, 53, 54, 56, 57, 62, 63, 1, 2, 4, 6, 7, 9, 10, 14, 15, 16, 20, 22, 25, 26, 27, 28, 29, 30, 32, 36, 37, 40, 41, 44, 46, 47, 48, 49, 50, 51, 54, 55, 58, 60, 63, 0, 2, 3, 9, 10, 11, 12, 15, 16, 17, 18, 19, 21, 22, 25, 26, 29, 30, 31, 32, 33, 35, 38, 39, 40, 41, 44, 46, 48, 49, 51, 53, 54, 55, 57, 58, 61, 63, 0, 1, 2, 5, 7, 11, 14, 18, 19, 21, 22, 24, 26, 27, 31, 33, 35, 37, 38, 42, 43, 44, 46, 47, 48, 50, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 63, 0, 1, 2, 3, 6, 8, 9, 10, 15, 17, 18, 19, 21, 23, 25, 26, 27, 29, 31, 33, 38, 39, 41, 42, 44, 45, 46, 47, 48, 49, 54, 56, 61, 63, 1, 2, 3, 6, 11, 12, 14, 15, 17, 19, 20, 23, 25, 26, 27, 30, 39, 40, 42, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 56, 60, 63, 0, 1, 2, 4, 8, 9, 12, 13, 14, 17, 18, 19, 20, 22, 23, 24, 25, 26, 27, 29, 32, 33, 34, 35, 37, 39, 40, 41, 44, 46, 47, 48, 51, 58, 62, 63, 0, 1, 2, 3, 4, 5, 7, 8, 10, 11, 15, 16, 17, 18, 19, 21, 24, 25, 27, 28, 31, 32, 33, 36, 37, 38, 39, 41, 42, 44, 46, 48, 50, 51, 54, 55, 57, 60, 62, 63, 1, 2, 3, 4, 5, 6, 7, 8, 11, 12, 13, 15, 17, 18, 20, 22, 24, 26, 27, 29, 30, 31, 32, 35, 38, 40, 43, 44, 46, 48, 49, 50, 51, 52, 53, 55, 57, 58, 60, 61, 62, 63, 0, 2, 3, 4, 7, 8, 9, 10, 11, 12, 14, 16, 18, 20, 21, 22, 23, 24, 26, 27, 28, 30, 31, 32, 33, 34, 36, 38, 39, 41, 42, 43, 47, 50, 52, 53, 54, 55, 56, 57, 58, 61, 62, 63, 2, 4, 6, 7, 9, 14, 16, 17, 18, 19, 20, 21, 22, 23, 27, 28, 30, 33, 35, 36, 37, 38, 43, 45, 46, 47, 48, 49, 50, 52, 55, 56, 59, 61, 3, 4, 8, 9, 10, 11, 12, 14, 16, 17, 18, 19, 20, 22, 25, 26, 28, 30, 32, 33, 36, 38, 41, 42, 44, 45, 49, 50, 52, 54, 58, 60, 61, 62, 63, 0, 1, 2, 3, 5, 9, 12, 14, 15, 16, 17, 20, 22, 23, 24, 26, 27, 28, 30, 32, 35, 39, 40, 41, 42, 43, 44, 45, 46, 49, 52, 53, 55, 56, 57, 59, 62, 63, 2, 5, 6, 7, 9, 11, 12, 14, 15, 18, 19, 21, 24, 25, 27, 29, 30, 31, 33, 36, 37, 41, 43, 44, 46, 47, 48, 51, 52, 58, 59, 60, 61, 62, 0, 2, 3, 6, 7, 9, 12, 14, 15, 16, 17, 19, 20, 22, 24, 25, 26, 27, 29, 30, 31, 32, 33, 36, 37, 38, 40, 41, 42, 43, 45, 47, 49, 50, 51, 53, 55, 56, 57, 61, 62, 63, 0, 1, 3, 4, 5, 7, 8, 10, 12, 13, 15, 16, 17, 18, 19, 21, 23, 24, 25, 26, 27, 29, 30, 32, 34, 35, 36, 37, 39, 40, 41, 42, 48, 50, 51, 52, 53, 55, 56, 58, 59, 60, 61, 62, 0, 1, 4, 5, 6, 7, 8, 13, 14, 15, 17, 20, 21, 22, 23, 26, 28, 29, 31, 32, 34, 43, 44, 45, 48, 50, 51, 52, 53, 55, 56, 58, 60, 61, 1, 4, 6, 7, 9, 10, 11, 12, 14, 16, 17, 18, 19, 22, 23, 24, 26, 27, 29, 30, 31, 32, 33, 36, 37, 38, 39, 40, 41, 42, 43, 48, 51, 52, 53, 54, 55, 56, 57, 59, 60, 61, 63, 0, 1, 2, 3, 5, 7, 9, 10, 12, 18, 19, 22, 24, 26, 28, 29, 30, 31, 32, 33, 36, 37, 38, 40, 41, 42, 43, 45, 46, 47, 48, 49, 50, 51, 53, 57, 58, 60, 62, 2, 3, 5, 8, 9, 11, 12, 15, 18, 19, 20, 22, 23, 26, 27, 30, 33, 38, 39, 40, 41, 44, 45, 47, 50, 52, 54, 55, 56, 60, 61, 62, 63, 0, 1, 3, 5, 8, 9, 10, 12, 16, 18, 20, 21, 23, 24, 27, 29, 32, 33, 36, 38, 39, 42, 43, 44, 46, 49, 51, 52, 53, 54, 55, 61, 62, 63, 0, 1, 2, 4, 6, 7, 10, 12, 15, 19, 22, 25, 27, 31, 32, 33, 34, 35, 36, 39, 41, 44, 46, 47, 48, 50, 54, 57, 60, 62, 1, 3, 4, 5, 7, 8, 10, 11, 12, 13, 15, 20, 21, 22, 24, 25, 26, 29, 30, 32, 36, 38, 41, 43, 44, 45, 46, 47, 51, 52, 53, 54, 57, 59, 60, 62, 1, 2, 6, 9, 11, 12, 15, 16, 18, 19, 20, 21, 25, 28, 29, 35, 37, 38, 40, 41, 42, 43, 44, 48, 53, 54, 56, 57, 61, 63, 0, 2, 4, 6, 8, 9, 13, 15, 16, 17, 18, 19, 20, 21, 23, 25, 26, 27, 28, 29, 30, 32, 33, 35, 37, 39, 41, 44, 45, 47, 48, 50, 52, 55, 56, 57, 59, 60, 62, 0, 1, 2, 4, 5, 10, 14, 15, 17, 18, 19, 20, 22, 23, 24, 26, 28, 29, 30, 33, 34, 35, 36, 37, 38, 39, 40, 41, 43, 44, 45, 46, 48, 51, 54, 56, 57, 58, 59, 60, 62, 5, 8, 9, 10, 11, 12, 15, 17, 19, 20, 22, 23, 25, 27, 29, 30, 33, 34, 35, 36, 38, 41, 44, 45, 46, 50, 53, 58, 60, 62, 0, 1, 3, 6, 7, 8, 9, 10, 14, 15, 17, 18, 19, 21, 23, 24, 25, 29, 32, 33, 35, 36, 37, 38, 39, 41, 42, 44, 46, 47, 48, 49, 51, 52, 54, 57, 62, 63, 3, 4, 5, 6, 7, 9, 13, 15, 19, 20, 22, 25, 26, 27, 29, 32, 33, 36, 37, 38, 39, 43, 44, 46, 47, 48, 49, 51, 56, 57, 62, 1, 4, 6, 7, 10, 11, 13, 15, 16, 17, 18, 19, 20, 22, 23, 25, 30, 31, 32, 34, 35, 38, 39, 40, 41, 42, 43, 44, 45, 46, 48, 50, 51, 52, 53, 56, 57, 60, 63, 2, 4, 9, 10, 12, 15, 21, 22, 23, 27, 28, 29, 30, 31, 32, 37, 39, 42, 44, 45, 46, 47, 48, 49, 51, 52, 55, 56, 59, 61, 62, 63, 0, 2, 3, 4, 5, 6, 7, 8, 9, 11, 16, 17, 20, 21, 22, 23, 24, 26, 28, 30, 31, 32, 36, 37, 43, 44, 45, 46, 47, 50, 52, 54, 56, 58, 59, 61, 63, 1, 3, 6, 8, 9, 10, 11, 13, 15, 16, 22, 26, 30, 31, 32, 33, 35, 36, 41, 43, 44, 46, 47, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 63, 6, 7, 8, 10, 14, 16, 18, 20, 22, 23, 24, 28, 30, 32, 33, 38, 41, 42, 44, 45, 46, 47, 48, 49, 52, 54, 56, 57, 61, 62, 63, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 18, 19, 20, 21, 23, 25, 27, 28, 29, 32, 33, 34, 38, 42, 43, 44, 45, 46, 48, 49, 50, 54, 56, 59, 60, 61, 62, 0, 3, 7, 8, 9, 10, 12, 13, 14, 15, 18, 19, 21, 23, 24, 25, 26, 28, 30, 35, 36, 37, 39, 41, 42, 44, 46, 48, 49, 50, 51, 52, 53, 56, 57, 58, 59, 60, 62, 0, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 16, 17, 19, 20, 22, 23, 25, 27, 29, 30, 32, 34, 36, 37, 38, 39, 40, 41, 44, 45, 46, 48, 49, 51, 52, 55, 0, 1, 2, 8, 10, 11, 12, 15, 17, 21, 23, 24, 26, 29, 32, 35, 36, 37, 39, 40, 41, 44, 45, 47, 49, 52, 53, 54, 55, 57, 58, 61, 62, 63, 1, 4, 6, 7, 13, 15, 17, 19, 20, 22, 23, 24, 25, 26, 27, 33, 34, 38, 42, 43, 44, 45, 47, 49, 50, 51, 52, 54, 55, 59, 60, 61, 0, 2, 4, 5, 6, 7, 9, 10, 14, 15, 17, 19, 21, 22, 23, 24, 26, 28, 29, 32, 33, 36, 37, 41, 44, 46, 47, 48, 49, 54, 58, 59, 63, 1, 2, 3, 6, 7, 14, 15, 16, 20, 21, 22, 25, 26, 27, 28, 30, 36, 38, 39, 40, 41, 42, 43, 44, 45, 46, 48, 49, 52, 53, 54, 56, 59, 63, 0, 2, 3, 4, 5, 8, 9, 11, 12, 13, 14, 16, 17, 19, 21, 22, 24, 25, 26, 27, 29, 30, 32, 33, 36, 37, 39, 40, 42, 43, 44, 47, 49, 53, 54, 55, 57, 58, 59, 61, 62, 1, 4, 5, 7, 8, 11, 12, 15, 17, 19, 20, 22, 24, 26, 27, 31, 35, 39, 40, 41, 45, 47, 48, 52, 55, 56, 62, 63, 5, 6, 7, 9, 10, 11, 15, 17, 18, 20, 22, 23, 24, 26, 27, 29, 30, 31, 33, 34, 38, 39, 40, 42, 43, 44, 45, 46, 47, 48, 50, 51, 53, 55, 56, 57, 60, 61, 63, 1, 4, 5, 7, 9, 10, 12, 14, 15, 16, 17, 19, 20, 21, 23, 24, 27, 28, 30, 32, 33, 37, 38, 39, 40, 43, 44, 47, 49, 50, 51, 53, 55, 58, 61, 63, 0, 1, 3, 5, 6, 7, 10, 11, 12, 15, 18, 19, 21, 22, 23, 26, 27, 29, 30, 31, 32, 33, 34, 38, 39, 41, 44, 46, 47, 48, 50, 51, 52, 53, 54, 55, 57, 58, 59, 62, 0, 2, 4, 5, 6, 7, 8, 10, 12, 13, 15, 18, 24, 26, 27, 28, 31, 34, 35, 36, 38, 40, 43, 44, 47, 49, 50, 51, 52, 54, 57, 58, 59, 60, 62, 63, 0, 1, 2, 3, 8, 12, 16, 21, 22, 23, 26, 27, 30, 33, 35, 37, 38, 39, 40, 41, 42, 44, 49, 55, 56, 57, 60, 61, 62, 63, 0, 5, 7, 10, 14, 15, 18, 19, 20, 22, 24, 28, 30, 33, 34, 38, 42, 44, 45, 48, 49, 51, 52, 53, 54, 56, 57, 58, 60, 61, 62, 0, 2, 5, 6, 7, 9, 13, 14, 15, 16, 18, 21, 24, 25, 28, 29, 30, 31, 32, 36, 37, 38, 39, 42, 43, 44, 47, 49, 52, 54, 55, 58, 60, 61, 1, 2, 3, 4, 6, 7, 8, 9, 13, 15, 18, 21, 23, 25, 26, 32, 35, 42, 43, 45, 46, 47, 49, 50, 52, 54, 57, 58, 60, 61, 63, 0, 1, 3, 4, 7, 8, 9, 10, 11, 12, 15, 20, 21, 22, 23, 24, 25, 27, 29, 32, 33, 34, 37, 39, 41, 42, 43, 46, 49, 50, 51, 52, 56, 59, 60, 61, 63, 0, 4, 5, 8, 9, 11, 12, 14, 15, 16, 21, 22, 23, 24, 25, 31, 32, 33, 36, 37, 39, 40, 43, 44, 45, 47, 48, 49, 50, 53, 54, 55, 56, 57, 58, 59, 60, 62, 63, 2, 3, 4, 5, 9, 10, 11, 16, 17, 18, 21, 26, 27, 28, 29, 33, 35, 36, 37, 41, 42, 43, 45, 46, 47, 49, 51, 53, 54, 55, 56, 57, 60, 61, 63, 0, 1, 3, 7, 9, 10, 12, 13, 14, 15, 16, 17, 18, 24, 25, 26, 27, 28, 30, 31, 32, 33, 34, 38, 40, 41, 43, 45, 46, 47, 48, 49, 50, 54, 55, 57, 60, 61, 62, 1, 5, 8, 12, 13, 14, 15, 16, 17, 18, 19, 20, 22, 27, 29, 34, 36, 37, 39, 40, 42, 44, 45, 47, 48, 49, 50, 53, 55, 57, 59, 60, 0, 1, 3, 5, 7, 11, 12, 15, 16, 17, 18, 19, 22, 23, 25, 26, 28, 29, 32, 34, 36, 37, 41, 42, 43, 46, 47, 48, 51, 56, 57, 58, 59, 60, 61, 62, 63, 0, 2, 5, 7, 9, 10, 12, 13, 15, 16, 18, 19, 22, 23, 24, 25, 28, 29, 32, 33, 38, 39, 45, 46, 48, 53, 54, 55, 56, 57, 58, 59, 61, 62, 63, 0, 3, 7, 8, 10, 11, 13, 15, 16, 18, 19, 20, 23, 26, 28, 29, 30, 32, 33, 34, 35, 37, 39, 40, 41, 43, 44, 45, 46, 48, 50, 51, 52, 56, 57, 58, 60, 61, 8, 9, 10, 11, 12, 13, 14, 15, 17, 19, 20, 21, 22, 23, 25, 26, 30, 32, 33, 34, 35, 37, 38, 39, 40, 42, 44, 45, 46, 47, 48, 52, 57, 59, 61, 62, 63, 0, 4, 7, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 21, 22, 23, 24, 26, 30, 33, 35, 36, 37, 38, 40, 41, 43, 45, 46, 47, 48, 49, 51, 53, 60, 61, 62, 63, 0, 4, 5, 6, 11, 12, 13, 19, 20, 23, 25, 26, 27, 28, 29, 30, 31, 33, 34, 35, 36, 38, 39, 40, 41, 43, 44, 45, 47, 49, 53, 54, 57, 60, 63, 0, 2, 4, 6, 7, 11, 12, 14, 16, 20, 22, 24, 25, 26, 27, 28, 29, 30, 31, 34, 36, 38, 43, 44, 45, 46, 48, 49, 50, 52, 54, 55, 59, 61, 0, 1, 2, 6, 10, 11, 12, 14, 15, 16, 25, 26, 28, 29, 30, 31, 32, 33, 34, 36, 37, 38, 40, 41, 42, 44, 45, 46, 47, 48, 50, 51, 53, 56, 58, 59, 60, 61, 62, 63, 0, 1, 3, 4, 6, 7, 10, 12, 15, 18, 19, 20, 22, 25, 27, 30, 31, 32, 33, 38, 39, 41, 42, 43, 45, 47, 48, 49, 50, 51, 52, 56, 59, 60, 61, 62, 63, 0, 4, 8, 9, 10, 11, 12, 13, 15, 21, 22, 23, 26, 29, 32, 37, 39, 40, 41, 42, 43, 45, 47, 48, 51, 52, 55, 58, 62, 0, 1, 7, 8, 9, 12, 13, 15, 17, 18, 19, 20, 22, 25, 26, 27, 28, 29, 31, 33, 35, 36, 41, 42, 43, 44, 45, 47, 49, 50, 52, 53, 54, 57, 58, 61, 62, 63, 2, 3, 4, 5, 6, 7, 10, 11, 12, 14, 15, 16, 17, 19, 20, 21, 22, 23, 25, 26, 27, 30, 31, 33, 34, 35, 38, 41, 42, 43, 44, 45, 46, 47, 50, 51, 53, 58, 59, 60, 61, 1, 3, 4, 6, 7, 10, 14, 16, 17, 19, 20, 21, 22, 23, 27, 28, 30, 32, 34, 37, 38, 40, 41, 42, 45, 46, 48, 51, 52, 55, 56, 57, 58, 59, 0, 1, 2, 5, 6, 10, 12, 15, 16, 18, 23, 24, 26, 28, 29, 30, 31, 33, 34, 35, 36, 48, 49, 53, 54, 55, 56, 57, 58, 59, 60, 62, 63, 4, 5, 9, 10, 11, 12, 14, 17, 18, 22, 23, 24, 25, 26, 28, 34, 35, 38, 39, 40, 41, 42, 46, 47, 49, 51, 52, 53, 54, 56, 57, 59, 62, 63, 0, 3, 4, 7, 8, 15, 18, 20, 22, 23, 25, 26, 29, 31, 34, 37, 39, 40, 42, 44, 46, 49, 51, 52, 53, 55, 59, 61, 62, 63, 0, 2, 3, 4, 6, 10, 11, 12, 13, 14, 15, 16, 23, 24, 25, 26, 28, 32, 34, 35, 36, 38, 44, 45, 48, 49, 50, 52, 53, 60, 61, 62, 63, 4, 5, 10, 11, 12, 14, 15, 16, 17, 18, 19, 20, 21, 23, 24, 27, 32, 35, 36, 40, 42, 44, 45, 47, 50, 51, 54, 57, 58, 61, 62, 0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 15, 17, 18, 19, 20, 22, 24, 29, 31, 32, 34, 35, 36, 37, 38, 40, 41, 42, 44, 46, 49, 50, 51, 53, 54, 55, 59, 62, 63, 0, 1, 2, 3, 6, 7, 9, 13, 14, 15, 18, 21, 23, 24, 28, 29, 32, 33, 34, 36, 37, 38, 40, 41, 42, 44, 45, 46, 48, 49, 50, 52, 53, 55, 57, 58, 59, 60, 62, 0, 1, 4, 6, 7, 9, 10, 11, 12, 13, 14, 16, 18, 20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 34, 35, 36, 38, 39, 40, 41, 46, 48, 49, 52, 54, 56, 58, 59, 60, 61, 2, 3, 8, 9, 11, 14, 15, 16, 23, 25, 29, 31, 32, 39, 42, 44, 45, 46, 48, 51, 52, 53, 54, 55, 57, 59, 62, 63, 1, 2, 3, 5, 6, 8, 10, 14, 15, 17, 18, 20, 23, 24, 25, 26, 28, 30, 32, 34, 36, 37, 38, 43, 45, 46, 49, 53, 57, 58, 60, 62, 63, 1, 2, 3, 4, 7, 8, 10, 11, 12, 13, 14, 15, 16, 19, 20, 21, 22, 23, 24, 25, 26, 29, 33, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 51, 52, 53, 55, 56, 57, 61, 63, 0, 1, 2, 3, 5, 6, 7, 8, 10, 11, 13, 14, 15, 18, 19, 21, 23, 25, 26, 28, 29, 31, 32, 34, 37, 39, 41, 42, 44, 46, 47, 49, 50, 52, 54, 55, 56, 60, 61, 63, 2, 3, 4, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18, 19, 23, 26, 27, 30, 31, 32, 33, 37, 38, 39, 41, 43, 45, 50, 55, 57, 58, 60, 61, 62, 0, 4, 5, 6, 9, 10, 12, 13, 14, 15, 16, 17, 19, 22, 23, 24, 25, 26, 27, 29, 33, 38, 40, 43, 44, 45, 47, 48, 49, 54, 55, 56, 57, 58, 59, 61, 63, 1, 4, 6, 10, 13, 15, 16, 17, 18, 21, 22, 24, 27, 28, 29, 32, 33, 34, 35, 38, 41, 43, 45, 46, 51, 52, 53, 54, 55, 56, 59, 0, 1, 4, 7, 11, 12, 13, 14, 15, 17, 18, 19, 24, 25, 26, 28, 29, 30, 31, 34, 36, 37, 39, 40, 42, 43, 46, 47, 51, 53, 55, 56, 57, 58, 59, 60, 61, 0, 1, 3, 8, 10, 15, 19, 20, 21, 22, 23, 26, 27, 29, 31, 34, 35, 36, 38, 39, 40, 41, 44, 45, 46, 47, 48, 50, 53, 56, 59, 60, 62, 0, 2, 4, 5, 7, 8, 9, 10, 14, 15, 17, 18, 19, 21, 23, 24, 26, 27, 29, 30, 34, 36, 37, 43, 45, 47, 48, 50, 51, 53, 55, 57, 58, 59, 61, 63, 0, 2, 5, 6, 7, 9, 10, 11, 12, 13, 15, 16, 17, 21, 25, 26, 27, 29, 30, 32, 33, 34, 36, 37, 38, 39, 43, 45, 46, 47, 48, 49, 51, 52, 54, 55, 58, 60, 61, 62, 63, 0, 1, 2, 3, 4, 5, 7, 8, 9, 12, 14, 16, 18, 19, 20, 21, 24, 25, 26, 28, 29, 30, 31, 33, 35, 36, 37, 38, 39, 40, 41, 43, 44, 45, 46, 48, 49, 53, 61, 4, 7, 9, 13, 14, 15, 16, 17, 18, 19, 20, 26, 27, 28, 29, 31, 32, 34, 36, 37, 38, 41, 47, 49, 50, 51, 56, 58, 59, 60, 63, 1, 3, 4, 5, 6, 11, 12, 13, 15, 16, 19, 21, 23, 25, 29, 31, 32, 35, 39, 41, 43, 45, 47, 48, 49, 52, 59, 60, 61, 62, 5, 8, 10, 11, 15, 17, 18, 19, 21, 23, 24, 25, 28, 32, 34, 35, 36, 40, 42, 45, 46, 48, 49, 55, 57, 58, 59, 61, 62, 2, 4, 5, 8, 10, 12, 15, 18, 19, 20, 23, 25, 26, 29, 30, 31, 33, 34, 35, 37, 39, 40, 42, 46, 47, 48, 49, 50, 51, 52, 53, 57, 58, 59, 61, 63, 0, 2, 3, 5, 6, 8, 10, 11, 12, 13, 15, 16, 17, 19, 21, 22, 27, 29, 30, 32, 35, 36, 38, 42, 43, 45, 46, 47, 48, 49, 58, 60, 62, 63, 0, 2, 3, 5, 6, 7, 8, 9, 11, 12, 13, 15, 16, 18, 19, 20, 22, 24, 25, 26, 27, 29, 30, 33, 34, 35, 36, 37, 38, 39, 40, 41, 43, 44, 45, 49, 50, 52, 53, 54, 56, 57, 59, 60, 62, 63, 0, 2, 8, 15, 16, 19, 20, 21, 22, 24, 25, 26, 29, 30, 34, 36, 37, 38, 40, 41, 43, 44, 46, 50, 51, 52, 54, 57, 58, 61, 62, 63, 0, 2, 7, 8, 9, 11, 12, 14, 15, 16, 17, 18, 19, 20, 21, 22, 24, 25, 27, 28, 30, 31, 33, 34, 36, 37, 38, 41, 43, 44, 45, 46, 49, 52, 53, 54, 55, 58, 59, 61, 0, 1, 2, 8, 10, 11, 15, 16, 17, 18, 24, 26, 27, 33, 34, 36, 39, 41, 42, 44, 45, 46, 49, 50, 54, 57, 58, 60, 61, 0, 2, 3, 4, 5, 6, 8, 10, 11, 12, 13, 15, 18, 19, 24, 25, 26, 27, 31, 32, 34, 35, 38, 39, 41, 42, 43, 46, 47, 48, 49, 50, 51, 52, 53, 54, 56, 58, 60, 61, 63, 0, 3, 6, 7, 13, 14, 15, 16, 17, 19, 21, 24, 25, 27, 28, 29, 30, 33, 34, 37, 38, 39, 40, 41, 45, 48, 49, 51, 53, 55, 56, 58, 60, 61, 62, 0, 3, 4, 5, 8, 9, 12, 13, 15, 16, 18, 20, 27, 29, 33, 38, 39, 40, 41, 42, 43, 45, 47, 48, 50, 52, 55, 56, 57, 58, 59, 61, 62, 63, 0, 4, 5, 7, 9, 10, 11, 12, 14, 15, 16, 17, 19, 21, 22, 29, 30, 32, 33, 34, 36, 37, 38, 39, 40, 41, 44, 47, 48, 49, 50, 52, 55, 56, 59, 60, 63, 2, 7, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 23, 26, 27, 28, 29, 30, 33, 35, 36, 39, 40, 42, 43, 44, 48, 49, 50, 51, 52, 54, 58, 59, 60, 61, 62, 63, 0, 1, 5, 6, 7, 11, 12, 13, 15, 19, 20, 21, 23, 25, 26, 27, 29, 30, 31, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 45, 46, 47, 50, 56, 57, 60, 62, 2, 3, 4, 6, 7, 8, 9, 12, 13, 16, 17, 20, 21, 23, 27, 28, 29, 30, 31, 34, 36, 38, 40, 41, 43, 47, 51, 57, 63, 0, 1, 5, 7, 8, 12, 14, 15, 18, 21, 22, 23, 24, 25, 26, 29, 30, 31, 32, 34, 37, 39, 41, 43, 45, 46, 47, 50, 51, 52, 56, 59, 60, 62, 63, 0, 1, 3, 6, 9, 11, 12, 14, 15, 17, 18, 19, 20, 21, 22, 23, 25, 26, 32, 33, 37, 38, 40, 41, 42, 43, 45, 47, 48, 54, 59, 60, 61, 63, 1, 5, 6, 7, 9, 10, 11, 12, 14, 15, 16, 19, 20, 23, 24, 25, 26, 27, 29, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 49, 52, 60, 61, 63, 0, 5, 6, 7, 9, 10, 14, 15, 16, 18, 19, 22, 24, 26, 27, 28, 30, 34, 35, 38, 39, 41, 42, 43, 45, 47, 48, 49, 50, 53, 56, 58, 59, 63, 0, 2, 3, 9, 10, 12, 13, 15, 18, 19, 20, 23, 25, 26, 29, 32, 33, 35, 36, 40, 44, 45, 47, 48, 49, 51, 52, 55, 56, 57, 59, 62, 1, 2, 3, 4, 5, 6, 7, 9, 11, 12, 14, 15, 16, 17, 18, 20, 21, 23, 24, 26, 30, 37, 39, 40, 41, 43, 44, 46, 48, 49, 50, 51, 52, 56, 57, 58, 61, 62, 63, 0, 1, 2, 5, 11, 12, 14, 17, 18, 19, 20, 21, 24, 27, 29, 36, 41, 45, 46, 48, 49, 52, 53, 55, 56, 57, 59, 62, 1, 2, 4, 5, 6, 7, 8, 9, 11, 12, 14, 17, 18, 19, 21, 23, 25, 26, 28, 29, 31, 36, 38, 42, 45, 46, 48, 49, 50, 52, 56, 57, 61, 62, 63, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, 14, 15, 19, 23, 25, 26, 27, 30, 32, 33, 34, 39, 41, 42, 44, 45, 46, 47, 48, 49, 52, 53, 55, 56, 57, 58, 60, 61, 0, 1, 4, 5, 6, 7, 8, 10, 11, 12, 14, 17, 19, 22, 23, 24, 26, 28, 32, 33, 37, 40, 42, 44, 45, 46, 48, 49, 52, 54, 56, 58, 59, 61, 62, 63, 0, 1, 3, 4, 8, 9, 10, 11, 12, 13, 14, 16, 18, 20, 22, 23, 25, 29, 33, 34, 36, 37, 39, 43, 45, 52, 54, 58, 61, 62, 1, 2, 3, 4, 7, 10, 12, 13, 14, 15, 18, 19, 21, 22, 23, 25, 27, 28, 29, 31, 33, 34, 35, 36, 41, 42, 50, 51, 55, 56, 57, 60, 61, 62, 63, 0, 1, 2, 3, 4, 5, 6, 7, 8, 11, 12, 15, 16, 17, 19, 20, 22, 23, 24, 27, 28, 29, 30, 33, 34, 35, 36, 42, 43, 44, 46, 49, 51, 52, 55, 57, 59, 60, 62, 63, 0, 1, 2, 7, 8, 9, 12, 13, 15, 16, 21, 22, 23, 24, 26, 27, 29, 31, 32, 35, 36, 37, 39, 41, 42, 43, 44, 45, 47, 50, 56, 57, 59, 60, 63, 0, 1, 2, 4, 6, 9, 12, 14, 15, 16, 18, 19, 20, 21, 23, 24, 25, 26, 32, 33, 34, 37, 38, 42, 45, 47, 48, 50, 51, 52, 53, 55, 56, 57, 59, 60, 61, 0, 1, 3, 4, 6, 15, 18, 20, 22, 23, 24, 25, 26, 27, 28, 29, 31, 34, 35, 37, 38, 39, 40, 42, 43, 45, 48, 50, 51, 53, 54, 55, 57, 58, 59, 1, 4, 5, 6, 7, 10, 12, 13, 15, 16, 17, 18, 20, 22, 23, 25, 26, 33, 34, 37, 38, 39, 40, 41, 42, 43, 45, 46, 47, 48, 49, 50, 53, 54, 56, 58, 63, 0, 3, 4, 5, 6, 9, 11, 15, 16, 17, 18, 21, 24, 26, 31, 33, 35, 36, 37, 38, 39, 41, 42, 43, 45, 46, 48, 49, 50, 51, 57, 59, 60, 63, 0, 1, 2, 4, 7, 9, 10, 11, 12, 15, 16, 17, 19, 21, 23, 24, 25, 26, 28, 29, 32, 33, 34, 35, 38, 39, 41, 44, 45, 46, 47, 50, 51, 52, 54, 57, 58, 62, 63, 1, 3, 4, 5, 6, 7, 8, 9, 13, 15, 16, 18, 19, 23, 24, 25, 26, 27, 28, 30, 31, 33, 38, 39, 40, 42, 43, 44, 45, 47, 50, 53, 54, 56, 57, 58, 63, 2, 5, 7, 9, 10, 11, 12, 13, 16, 18, 19, 20, 21, 22, 23, 24, 26, 27, 28, 30, 32, 34, 36, 37, 38, 39, 40, 42, 43, 44, 45, 46, 48, 49, 52, 53, 56, 58, 59, 60, 62, 1, 5, 7, 9, 11, 12, 13, 15, 17, 19, 21, 23, 25, 28, 30, 31, 32, 35, 36, 40, 41, 42, 43, 45, 46, 50, 53, 54, 55, 57, 58, 60, 61, 0, 4, 6, 7, 10, 11, 12, 15, 16, 17, 21, 22, 23, 25, 26, 28, 29, 32, 33, 34, 36, 38, 39, 43, 44, 46, 47, 48, 51, 53, 57, 59, 61, 62, 63, 1, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 17, 19, 21, 22, 23, 24, 25, 26, 28, 31, 32, 36, 40, 41, 44, 46, 47, 48, 49, 54, 58, 60, 61, 62, 63, 0, 1, 2, 3, 5, 6, 7, 8, 10, 11, 13, 15, 16, 18, 19, 20, 23, 24, 25, 26, 27, 28, 29, 30, 33, 34, 35, 36, 38, 39, 40, 43, 44, 46, 47, 48, 49, 51, 52, 54, 55, 56, 57, 58, 59, 60, 61, 62, 1, 4, 6, 7, 8, 10, 12, 14, 15, 16, 17, 18, 24, 26, 27, 28, 30, 32, 33, 36, 38, 42, 43, 44, 45, 46, 47, 48, 49, 50, 52, 53, 56, 57, 58, 59, 61, 2, 4, 5, 6, 7, 8, 10, 11, 13, 16, 18, 21, 23, 25, 28, 33, 35, 37, 38, 39, 40, 43, 45, 47, 48, 49, 50, 55, 57, 59, 60, 61, 63, 0, 2, 4, 6, 9, 10, 11, 14, 19, 20, 21, 22, 23, 27, 28, 29, 30, 31, 32, 33, 36, 37, 41, 42, 43, 44, 47, 50, 52, 53, 54, 56, 58, 59, 60, 61, 63, 0, 3, 4, 6, 10, 11, 12, 16, 17, 20, 21, 23, 24, 25, 26, 28, 32, 33, 36, 37, 42, 44, 45, 46, 50, 51, 52, 53, 54, 55, 58, 59, 60, 62, 63, 2, 3, 4, 6, 8, 11, 13, 15, 19, 20, 21, 22, 23, 24, 26, 27, 28, 29, 31, 33, 34, 35, 36, 38, 39, 40, 42, 43, 44, 45, 46, 48, 50, 51, 52, 53, 55, 56, 58, 60, 61, 62, 1, 2, 5, 6, 8, 10, 11, 13, 14, 15, 19, 20, 22, 23, 26, 27, 28, 34, 35, 37, 38, 39, 40, 43, 44, 48, 55, 59, 60, 61, 63, 2, 4, 8, 11, 12, 14, 15, 16, 18, 19, 21, 24, 30, 31, 33, 34, 35, 37, 40, 41, 43, 44, 45, 46, 48, 49, 50, 53, 56, 59, 60, 62, 6, 7, 9, 11, 12, 14, 15, 19, 20, 21, 23, 25, 28, 31, 33, 35, 36, 37, 40, 42, 44, 45, 46, 48, 49, 51, 56, 58, 61, 63, 0, 2, 3, 4, 5, 7, 8, 11, 12, 13, 14, 15, 18, 19, 20, 21, 24, 27, 28, 29, 31, 33, 35, 38, 39, 41, 43, 47, 48, 51, 54, 56, 57, 61, 63, 0, 2, 4, 5, 6, 8, 9, 10, 15, 17, 19, 24, 25, 26, 29, 30, 31, 32, 34, 36, 38, 39, 40, 41, 42, 47, 49, 50, 53, 54, 57, 59, 1, 2, 3, 4, 5, 6, 8, 9, 10, 13, 14, 15, 17, 18, 19, 20, 21, 22, 24, 25, 26, 27, 30, 31, 32, 33, 34, 35, 37, 38, 41, 42, 44, 45, 46, 49, 52, 53, 54, 56, 57, 58, 59, 61, 62, 63, 0, 1, 2, 3, 5, 6, 7, 9, 13, 15, 16, 18, 20, 21, 23, 26, 27, 28, 30, 32, 33, 36, 37, 39, 40, 41, 43, 44, 46, 48, 49, 50, 52, 55, 59, 60, 61, 63, 3, 4, 5, 6, 7, 9, 10, 11, 12, 15, 17, 19, 20, 21, 22, 23, 24, 27, 28, 29, 30, 31, 32, 33, 37, 38, 39, 40, 41, 45, 46, 49, 51, 54, 55, 56, 59, 61, 62, 1, 3, 4, 6, 10, 12, 13, 14, 15, 16, 17, 22, 23, 24, 25, 26, 28, 29, 31, 32, 33, 34, 35, 37, 47, 49, 52, 57, 58, 60, 61, 62, 63, 0, 1, 2, 4, 5, 6, 8, 9, 13, 14, 15, 18, 19, 20, 21, 22, 24, 25, 28, 29, 30, 36, 37, 39, 41, 42, 45, 46, 47, 49, 51, 52, 54, 55, 59, 60, 62, 0, 2, 5, 9, 10, 14, 15, 17, 18, 22, 23, 25, 27, 28, 30, 33, 34, 35, 36, 38, 40, 41, 43, 45, 46, 48, 49, 51, 53, 57, 59, 60, 61, 2, 6, 7, 8, 11, 13, 15, 19, 22, 25, 27, 32, 33, 34, 36, 38, 39, 40, 41, 42, 44, 45, 46, 48, 49, 52, 53, 54, 56, 60, 63, 0, 3, 8, 9, 10, 12, 14, 15, 17, 20, 23, 24, 27, 28, 29, 30, 33, 34, 35, 37, 39, 40, 42, 43, 44, 45, 47, 48, 49, 50, 53, 54, 55, 59, 62, 63, 1, 3, 6, 7, 10, 11, 14, 15, 16, 17, 18, 19, 22, 24, 25, 26, 32, 33, 34, 45, 46, 49, 51, 54, 55, 56, 58, 59, 60, 61, 62, 0, 5, 6, 7, 8, 10, 11, 12, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 27, 28, 30, 31, 32, 35, 36, 38, 39, 41, 42, 44, 46, 48, 50, 51, 52, 53, 55, 57, 58, 61, 62, 3, 4, 5, 6, 7, 8, 11, 15, 17, 18, 19, 20, 22, 23, 24, 25, 26, 27, 31, 32, 33, 35, 36, 37, 39, 42, 43, 44, 46, 47, 49, 50, 51, 57, 59, 63, 0, 3, 4, 5, 7, 9, 10, 11, 13, 14, 16, 17, 20, 22, 23, 24, 25, 27, 29, 34, 43, 45, 46, 47, 49, 50, 53, 54, 59, 60, 62, 63, 1, 2, 3, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 19, 21, 23, 24, 26, 27, 28, 29, 34, 36, 39, 42, 43, 45, 47, 50, 51, 52, 54, 55, 58, 60, 61, 62, 63, 0, 2, 6, 9, 10, 12, 13, 14, 15, 16, 18, 19, 20, 23, 25, 33, 46, 49, 53, 54, 56, 57, 60, 61, 63 };
+static const float smart_transformer_fault_detection_sparse_layer_1_values[12820] = { -0.095772f, 0.054201f, -0.074301f, -0.065011f, -0.132592f, 0.064667f, 0.196231f, 0.125187f, -0.094948f, -0.086033f, 0.106945f, -0.061172f, 0.112026f, -0.146958f, 0.084027f, 0.159367f, -0.112106f, -0.106841f, -0.063553f, 0.078751f, 0.079764f, -0.055166f, -0.192850f, -0.103380f, 0.134741f, -0.172416f, 0.068453f, -0.081950f, 0.057697f, -0.120161f, -0.114396f, 0.121138f, -0.109328f, 0.071916f, -0.082454f, -0.058421f, -0.111532f, -0.057153f, 0.085956f, 0.071710f, -0.072492f, -0.055982f, -0.119204f, -0.071331f, 0.071781f, 0.079079f, 0.066478f, -0.096554f, 0.081591f, 0.079328f, -0.069895f, 0.093935f, -0.116210f, 0.115342f, 0.088121f, -0.166611f, 0.088702f, 0.088704f, -0.067789f, 0.054549f, -0.061097f, 0.089828f, -0.095593f, -0.127399f, -0.057922f, 0.056747f, -0.060132f, 0.071170f, 0.069648f, 0.129561f, 0.084503f, -0.118851f, 0.067563f, 0.090667f, -0.121457f, -0.060364f, -0.345374f, 0.106981f, -0.067256f, -0.169867f, 0.093138f, 0.084683f, 0.106795f, 0.184697f, 0.097035f, -0.180865f, 0.072878f, 0.094003f, -0.107590f, 0.106618f, -0.115264f, 0.099528f, 0.052948f, -0.086138f, 0.102550f, 0.092331f, -0.113573f, -0.082447f, -0.077254f, 0.083412f, 0.056185f, 0.095849f, -0.054135f, -0.056355f, -0.103964f, 0.077458f, 0.132293f, 0.085505f, 0.078336f, -0.068069f, 0.092149f, 0.104331f, 0.125296f, 0.095231f, 0.166505f, 0.067720f, 0.086948f, -0.098180f, 0.370309f, -0.065817f, -0.064576f, 0.107790f, -0.053576f, -0.096884f, -0.111887f, 0.066876f, -0.087930f, -0.056008f, 0.075094f, 0.110936f, -0.056528f, -0.068230f, -0.101906f, 0.078826f, -0.077210f, -0.062576f, -0.103604f, -0.126905f, 0.082486f, -0.065565f, 0.134397f, -0.094854f, 0.112038f, -0.132462f, -0.100289f, -0.058598f, -0.089844f, -0.068248f, -0.077251f, -0.078011f, 0.097451f, 0.140039f, 0.235368f, 0.101537f, 0.104789f, -0.077243f, 0.079068f, -0.064593f, -0.093532f, 0.109857f, -0.064049f, 0.089310f, 0.061824f, -0.062129f, -0.088694f, -0.099058f, -0.095535f, 0.088888f, -0.073179f, 0.101420f, -0.095731f, -0.096120f, 0.080834f, -0.081820f, 0.104733f, -0.240761f, 0.090500f, 0.076092f, -0.119645f, 0.076690f, 0.195645f, 0.130048f, 0.121540f, 0.081610f, 0.098789f, 0.075140f, -0.118695f, 0.147704f, -0.124314f, 0.123509f, 0.058482f, 0.097405f, -0.103072f, -0.095126f, 0.053057f, 0.058976f, -0.052887f, -0.072169f, 0.128510f, -0.073095f, 0.066835f, 0.087360f, 0.133634f, -0.095551f, 0.085375f, -0.092220f, -0.082029f, 0.056081f, -0.065359f, 0.058011f, -0.189001f, 0.143211f, -0.090919f, 0.071029f, 0.075723f, 0.077347f, 0.088106f, -0.135432f, -0.151757f, 0.077255f, 0.064206f, 0.075542f, 0.071427f, -0.057991f, -0.100425f, 0.061660f, -0.061121f, 0.212220f, 0.098580f, -0.252832f, 0.085729f, 0.268393f, -0.064288f, 0.059424f, 0.067043f, 0.099457f, 0.112195f, -0.054270f, -0.121550f, 0.052808f, -0.102832f, 0.092464f, -0.070592f, -0.116345f, 0.142828f, -0.155056f, -0.055767f, -0.077945f, -0.111332f, -0.126249f, 0.081264f, 0.151931f, -0.059479f, -0.075449f, 0.107644f, -0.101942f, 0.101286f, 0.085951f, -0.109336f, -0.116911f, -0.098233f, 0.070556f, 0.079312f, -0.076925f, -0.063022f, -0.088739f, 0.108834f, 0.091615f, -0.067579f, -0.078777f, -0.079178f, 0.071915f, -0.092794f, 0.096985f, 0.082597f, 0.070568f, -0.067361f, 0.125924f, 0.129082f, 0.078575f, -0.063077f, 0.108416f, 0.101235f, -0.097571f, 0.079487f, -0.059181f, -0.070633f, 0.131608f, 0.198250f, -0.088402f, 0.148045f, 0.055544f, 0.064774f, -0.093146f, -0.055402f, 0.138837f, -0.145230f, 0.129813f, 0.179112f, 0.065603f, -0.078074f, 0.053994f, 0.056318f, -0.090431f, 0.085496f, 0.066682f, -0.117980f, -0.071199f, 0.056170f, -0.116118f, 0.089726f, -0.106965f, 0.091006f, 0.097608f, -0.100341f, -0.085792f, 0.063272f, -0.084688f, 0.104544f, 0.079640f, -0.062199f, 0.193293f, -0.096934f, -0.137992f, -0.075061f, -0.139168f, -0.065686f, 0.105154f, 0.113456f, -0.084378f, 0.107719f, -0.083358f, -0.107029f, -0.086854f, 0.104525f, -0.191388f, 0.146792f, -0.068919f, -0.162928f, -0.077889f, 0.085070f, -0.053938f, -0.133034f, 0.073103f, -0.071456f, 0.126779f, 0.102204f, -0.089643f, 0.089172f, -0.054827f, -0.113636f, -0.106089f, -0.224401f, 0.079187f, 0.067562f, -0.069455f, -0.063367f, -0.086867f, 0.113486f, 0.082027f, 0.111889f, -0.191607f, 0.080320f, -0.117614f, 0.106967f, -0.098527f, -0.118694f, 0.075181f, -0.096144f, 0.080822f, -0.122631f, 0.074753f, 0.077679f, 0.091520f, 0.100088f, 0.200586f, 0.064826f, 0.073379f, -0.077613f, 0.057031f, -0.056506f, 0.091473f, 0.094111f, 0.086233f, -0.066269f, -0.075966f, 0.081216f, -0.075959f, 0.072552f, 0.077361f, -0.054625f, 0.094488f, -0.098950f, 0.114837f, -0.068191f, -0.117875f, -0.061474f, 0.126966f, 0.152343f, 0.060124f, -0.068771f, -0.059368f, 0.188740f, 0.141450f, 0.059616f, 0.057912f, -0.100157f, 0.054549f, 0.058379f, 0.146516f, 0.113892f, -0.054645f, -0.063530f, -0.094674f, -0.146242f, 0.290148f, -0.099520f, 0.141808f, -0.070917f, -0.056654f, -0.097455f, 0.100729f, 0.068571f, -0.079028f, 0.109922f, -0.104233f, 0.077669f, -0.109272f, -0.060236f, 0.073621f, 0.054303f, -0.381260f, 0.126196f, -0.075100f, 0.066137f, 0.144883f, -0.066459f, -0.123204f, 0.067805f, 0.086202f, 0.078673f, 0.053436f, -0.097066f, -0.054459f, -0.089834f, -0.085110f, 0.053266f, 0.077670f, -0.076090f, -0.088100f, 0.076880f, -0.099754f, -0.130230f, 0.095171f, -0.074782f, 0.062841f, 0.110749f, 0.105112f, 0.093822f, -0.060773f, 0.139528f, 0.055727f, 0.071842f, 0.100584f, 0.071893f, 0.082250f, -0.156503f, 0.084303f, -0.150708f, -0.226613f, -0.090176f, 0.083633f, 0.063590f, -0.094163f, 0.101206f, -0.083981f, -0.094217f, 0.056127f, 0.090441f, -0.076938f, -0.061135f, -0.140897f, -0.073201f, -0.053498f, 0.119149f, -0.070726f, 0.183038f, -0.078733f, -0.117619f, -0.174783f, 0.078155f, -0.119128f, 0.080747f, -0.108448f, -0.070200f, -0.073303f, -0.061238f, 0.153954f, 0.073408f, 0.099197f, -0.101353f, 0.073031f, 0.121164f, -0.098024f, 0.053118f, 0.068072f, 0.104007f, -0.097433f, -0.132299f, -0.166392f, 0.179070f, 0.326793f, -0.112065f, 0.082820f, 0.261274f, 0.110231f, -0.131372f, 0.070780f, 0.491001f, 0.096992f, 0.077078f, 0.096442f, -0.094704f, 0.088456f, -0.059387f, 0.096201f, 0.083290f, -0.056417f, 0.098946f, 0.147121f, -0.146790f, -0.064759f, 0.131089f, 0.093095f, -0.086882f, -0.062769f, -0.069881f, -0.072444f, 0.133663f, -0.078596f, 0.110421f, 0.123384f, 0.083830f, 0.121748f, -0.171275f, 0.085303f, -0.096240f, 0.083052f, -0.106314f, 0.083169f, -0.067764f, 0.093884f, 0.061085f, -0.111077f, -0.100909f, 0.099357f, 0.062976f, -0.137507f, -0.084181f, -0.054711f, -0.100456f, 0.065118f, -0.057876f, 0.089103f, -0.073634f, -0.061478f, 0.096372f, 0.176974f, -0.156126f, 0.069470f, 0.217755f, 0.218061f, 0.116467f, 0.095929f, -0.117643f, 0.115773f, 0.086063f, 0.072269f, -0.095218f, -0.120486f, -0.110782f, 0.055721f, 0.101718f, -0.070778f, -0.069716f, 0.068094f, -0.082784f, 0.169077f, 0.134018f, -0.059118f, 0.054912f, -0.089742f, 0.181377f, -0.058122f, -0.075334f, -0.150614f, -0.059669f, 0.261968f, 0.069655f, -0.076707f, 0.069169f, 0.161922f, -0.058734f, 0.121816f, -0.083540f, 0.061113f, 0.090207f, 0.060112f, 0.091303f, 0.090213f, -0.075638f, 0.072525f, -0.092535f, 0.100569f, 0.203181f, 0.063233f, -0.070523f, -0.110953f, 0.132673f, -0.086077f, 0.099928f, 0.055146f, 0.063744f, -0.398588f, -0.087969f, -0.063979f, -0.070004f, -0.156715f, 0.071774f, 0.077146f, -0.052939f, 0.083958f, -0.101406f, 0.079559f, 0.090983f, 0.061036f, 0.062574f, 0.087833f, 0.087475f, 0.058673f, -0.065715f, -0.079790f, -0.075218f, -0.062443f, -0.086414f, -0.068998f, 0.110104f, -0.086844f, -0.109635f, 0.053729f, 0.092983f, 0.091627f, 0.094169f, 0.150952f, 0.131795f, 0.231139f, 0.105299f, -0.071969f, -0.267612f, -0.211544f, 0.123536f, -0.060797f, -0.096719f, 0.194279f, 0.088674f, 0.114643f, -0.121021f, 0.100444f, -0.099655f, -0.103984f, 0.140403f, 0.070901f, 0.064461f, 0.069673f, -0.086195f, -0.076584f, -0.148069f, -0.114868f, 0.130136f, -0.133625f, -0.173854f, -0.066329f, 0.106212f, 0.079932f, 0.095286f, 0.138267f, 0.105961f, 0.121592f, 0.059761f, 0.081450f, -0.073305f, -0.071186f, -0.065981f, -0.079489f, -0.173100f, -0.313975f, -0.099029f, 0.071233f, -0.137155f, 0.057249f, -0.065266f, 0.097962f, 0.105644f, -0.102844f, 0.074950f, 0.064393f, 0.153208f, -0.075786f, -0.118010f, 0.183260f, 0.107735f, 0.122479f, 0.072870f, -0.085139f, -0.075694f, -0.106546f, 0.058578f, -0.092318f, 0.095373f, -0.106635f, 0.056881f, 0.054796f, -0.077682f, 0.087328f, 0.185641f, 0.061771f, 0.101395f, 0.077728f, 0.483715f, -0.095191f, 0.107854f, 0.174598f, -0.069851f, 0.109225f, 0.074338f, -0.196564f, 0.077224f, 0.111577f, 0.058167f, 0.072134f, 0.069003f, -0.072362f, -0.081017f, 0.117481f, -0.093124f, 0.061904f, 0.088739f, 0.086916f, 0.064895f, -0.098115f, 0.121119f, 0.104219f, -0.074183f, 0.107706f, 0.073029f, -0.054132f, 0.139009f, -0.058296f, 0.054434f, 0.074045f, 0.099898f, -0.129713f, -0.137958f, 0.155143f, -0.234158f, -0.078156f, -0.085933f, -0.117753f, 0.110731f, 0.061449f, 0.184781f, 0.116273f, -0.103074f, -0.060429f, -0.054778f, -0.066844f, -0.084684f, 0.102496f, 0.057647f, -0.087541f, -0.081943f, 0.102743f, -0.083765f, 0.063603f, 0.089371f, -0.063647f, 0.076232f, -0.200817f, 0.075028f, 0.059912f, 0.058965f, -0.070682f, -0.056029f, 0.079729f, 0.076029f, -0.104361f, 0.115155f, -0.222597f, 0.106090f, 0.078556f, -0.103733f, 0.084192f, 0.099722f, 0.067465f, 0.084632f, -0.121224f, 0.087376f, -0.070681f, -0.067182f, -0.054568f, -0.065630f, 0.130105f, -0.112174f, -0.071405f, 0.069554f, -0.084045f, -0.126169f, -0.110489f, 0.113520f, 0.059189f, -0.062854f, -0.055542f, -0.065722f, 0.065004f, -0.087506f, -0.104039f, -0.127746f, -0.109443f, 0.054232f, 0.097916f, -0.082167f, 0.148266f, -0.077651f, 0.193123f, -0.144751f, 0.106567f, -0.113591f, -0.122485f, -0.110681f, -0.112606f, -0.073624f, 0.076339f, 0.077003f, -0.066077f, 0.079665f, -0.071328f, -0.187471f, -0.167950f, 0.102628f, 0.081477f, -0.095715f, 0.090124f, 0.059708f, 0.102925f, -0.090114f, -0.125901f, -0.143958f, 0.083171f, 0.086639f, -0.054600f, 0.076285f, -0.066590f, 0.100099f, -0.065588f, 0.071453f, -0.101604f, -0.062713f, -0.196195f, 0.188859f, -0.203274f, 0.069922f, 0.067403f, -0.088366f, 0.055695f, -0.123345f, 0.089571f, 0.148081f, 0.096114f, -0.054941f, -0.068801f, -0.054793f, -0.134146f, 0.083395f, -0.060718f, 0.058358f, 0.080109f, -0.065619f, -0.116455f, 0.075106f, 0.119968f, -0.136797f, 0.149545f, 0.074762f, -0.080554f, 0.156356f, 0.081673f, 0.063608f, 0.073855f, -0.086774f, -0.096008f, 0.203457f, -0.102551f, -0.133323f, 0.078700f, -0.100390f, 0.087004f, 0.104048f, 0.076842f, -0.168935f, 0.137396f, -0.141064f, -0.071171f, -0.056109f, -0.120471f, -0.085407f, 0.091369f, -0.110546f, -0.126234f, 0.057159f, -0.083273f, 0.079645f, -0.148020f, -0.178625f, 0.127645f, -0.167028f, 0.056042f, -0.074203f, -0.131044f, 0.067772f, -0.074880f, 0.120692f, 0.091994f, 0.076747f, 0.096891f, -0.089922f, -0.089603f, -0.091863f, 0.203611f, 0.075318f, 0.071366f, 0.073652f, 0.110656f, 0.082762f, 0.078824f, 0.057117f, -0.114545f, -0.064943f, 0.116975f, 0.087244f, 0.066167f, 0.053908f, 0.069674f, -0.100803f, -0.117586f, 0.113019f, -0.177532f, -0.134092f, -0.056705f, -0.114938f, -0.052994f, -0.061423f, 0.085330f, -0.124379f, -0.078257f, -0.083674f, 0.114634f, -0.084329f, 0.081676f, 0.114204f, 0.094936f, -0.083586f, 0.094085f, 0.055220f, -0.323063f, 0.114736f, -0.100367f, -0.071108f, 0.068279f, 0.090417f, -0.077217f, 0.103155f, -0.101022f, -0.104835f, -0.103060f, -0.103343f, -0.099162f, -0.099669f, -0.068983f, 0.063798f, 0.120837f, 0.079271f, 0.092590f, 0.102437f, 0.095161f, -0.097823f, -0.086905f, -0.083489f, 0.070542f, -0.064049f, -0.104186f, 0.063164f, 0.088506f, -0.093232f, 0.099313f, 0.084080f, -0.091095f, -0.079918f, -0.341851f, -0.057217f, -0.065355f, 0.103727f, -0.132270f, -0.071403f, 0.167592f, -0.071912f, 0.077042f, -0.059428f, -0.057219f, 0.096127f, -0.080657f, 0.071483f, 0.059274f, -0.075720f, 0.122747f, 0.104776f, 0.096129f, -0.112997f, 0.063637f, -0.097097f, -0.112074f, -0.096281f, -0.058086f, -0.173587f, 0.121990f, 0.060688f, 0.075351f, 0.118167f, 0.090517f, -0.217837f, -0.082304f, -0.112566f, 0.066644f, -0.189212f, -0.103331f, -0.179018f, 0.149441f, -0.094386f, -0.196185f, 0.080164f, 0.092462f, -0.065874f, -0.090932f, 0.061223f, 0.087393f, 0.085114f, -0.114308f, -0.058710f, 0.109234f, 0.098178f, 0.089772f, -0.071960f, 0.099025f, 0.088579f, -0.109832f, 0.064608f, -0.143809f, 0.142657f, -0.087959f, 0.108490f, -0.058632f, -0.101401f, -0.106033f, 0.060356f, -0.072862f, -0.097749f, -0.104326f, -0.084221f, -0.210333f, 0.160643f, -0.212042f, -0.056433f, 0.093275f, -0.103833f, -0.090777f, -0.103309f, 0.083447f, 0.098784f, 0.073310f, -0.057704f, 0.086545f, -0.086961f, 0.083592f, -0.101229f, -0.116570f, -0.054458f, 0.062646f, 0.066702f, 0.093381f, 0.062140f, -0.116278f, -0.110386f, 0.082379f, 0.103969f, -0.083046f, -0.065759f, -0.204074f, 0.063747f, 0.094641f, -0.096779f, -0.054238f, 0.074280f, 0.054383f, -0.071498f, 0.080028f, -0.109911f, 0.101167f, 0.073127f, 0.093695f, 0.058346f, 0.073540f, -0.132803f, 0.055217f, -0.120757f, 0.169972f, -0.082393f, 0.086665f, 0.111168f, 0.092995f, 0.065451f, 0.066490f, -0.086865f, 0.123766f, 0.104228f, 0.080078f, 0.077921f, 0.061517f, 0.082673f, -0.075498f, 0.095486f, 0.103709f, -0.093896f, 0.100796f, 0.083223f, -0.086334f, -0.203391f, 0.072128f, 0.142546f, 0.107058f, -0.118100f, 0.082177f, 0.088408f, -0.139835f, 0.187241f, -0.137532f, 0.138135f, -0.137182f, -0.091237f, -0.076221f, -0.067990f, 0.078712f, -0.136790f, 0.323094f, -0.069929f, 0.109948f, -0.055552f, 0.076611f, -0.053761f, -0.116332f, 0.079210f, 0.099831f, 0.090463f, 0.082173f, -0.142320f, -0.133191f, -0.063135f, 0.136218f, -0.417123f, -0.085980f, -0.156109f, 0.115114f, 0.137791f, -0.137703f, 0.106390f, 0.105485f, -0.088830f, -0.121653f, 0.058748f, -0.085454f, -0.065504f, 0.080899f, 0.073996f, -0.091758f, 0.117567f, 0.082752f, 0.126697f, -0.082951f, 0.097122f, 0.063296f, -0.072285f, 0.115234f, -0.063679f, 0.062598f, 0.057882f, -0.062909f, -0.116721f, 0.085534f, -0.104109f, -0.093499f, 0.077673f, 0.062654f, -0.074408f, -0.054655f, 0.109053f, -0.101175f, 0.055312f, 0.108849f, 0.109039f, 0.072575f, -0.512054f, 0.057536f, 0.096457f, -0.073007f, -0.087697f, 0.129980f, -0.129283f, 0.065133f, 0.097246f, 0.060509f, -0.071367f, -0.072159f, -0.096092f, -0.071156f, -0.124672f, -0.055611f, 0.118453f, 0.099277f, -0.073680f, -0.104380f, 0.080037f, -0.076367f, 0.082728f, 0.081716f, 0.126168f, 0.086184f, -0.120515f, -0.095791f, -0.065902f, -0.064516f, 0.440800f, 0.112654f, -0.086289f, -0.088316f, 0.099402f, 0.294250f, -0.094497f, -0.085855f, -0.082637f, 0.107148f, -0.056401f, 0.101473f, 0.105121f, -0.074434f, 0.107200f, -0.057945f, 0.080342f, 0.072215f, -0.079023f, -0.084955f, 0.107858f, -0.075128f, 0.074025f, 0.067585f, -0.104923f, -0.052765f, -0.062833f, 0.085999f, 0.097930f, -0.095475f, -0.109250f, -0.080005f, 0.053812f, -0.133039f, -0.071697f, 0.089554f, -0.108473f, -0.112633f, 0.132590f, 0.149165f, 0.087089f, -0.115158f, 0.091134f, 0.088602f, -0.098300f, 0.077398f, 0.082092f, -0.080928f, -0.132270f, 0.151792f, 0.066059f, -0.071625f, 0.056481f, 0.065083f, 0.094202f, -0.080619f, -0.069885f, 0.080098f, 0.088009f, 0.106276f, 0.078995f, 0.102349f, -0.108599f, 0.113074f, 0.071536f, 0.118114f, 0.137046f, 0.073387f, 0.122770f, -0.065070f, -0.092866f, -0.103291f, 0.053848f, 0.100378f, 0.126880f, 0.057307f, -0.114425f, -0.107715f, -0.096721f, -0.101583f, 0.076455f, -0.100570f, -0.087712f, -0.079637f, 0.076419f, 0.119622f, -0.117151f, -0.140765f, -0.088128f, 0.091796f, -0.089408f, 0.064111f, -0.080600f, 0.169423f, 0.099396f, -0.074851f, 0.072530f, 0.061470f, -0.058644f, 0.150732f, -0.078847f, 0.293442f, 0.072157f, -0.118902f, 0.079475f, 0.070241f, 0.172048f, -0.135501f, 0.199551f, -0.068526f, 0.134536f, -0.065457f, 0.071722f, -0.122383f, -0.069440f, 0.116230f, -0.067208f, -0.105757f, -0.080992f, -0.062546f, 0.120724f, -0.103245f, -0.167011f, -0.058438f, 0.099424f, -0.117206f, -0.080242f, 0.058263f, -0.053286f, 0.075161f, 0.093772f, -0.122783f, 0.209798f, 0.108004f, 0.095815f, 0.117654f, 0.128207f, 0.078907f, -0.075407f, -0.090579f, 0.101670f, 0.073294f, -0.083115f, -0.075370f, -0.100902f, 0.061787f, 0.064384f, 0.110839f, -0.064620f, 0.078481f, 0.076937f, -0.064200f, -0.056358f, -0.107221f, -0.104381f, -0.071463f, -0.143413f, -0.120431f, -0.078191f, 0.067065f, -0.077552f, 0.082776f, -0.174607f, -0.135014f, -0.091383f, 0.537556f, 0.085984f, 0.084480f, -0.078609f, -0.103745f, 0.100566f, -0.111823f, 0.092689f, -0.069282f, -0.066921f, -0.073543f, -0.083811f, 0.097999f, -0.114005f, -0.084141f, -0.079929f, -0.123586f, 0.060174f, 0.073920f, 0.107599f, -0.066441f, 0.058677f, 0.097576f, -0.089203f, -0.083283f, -0.059519f, 0.072561f, 0.082528f, -0.134567f, -0.081260f, -0.126888f, -0.100724f, -0.081045f, 0.079730f, 0.111674f, 0.102259f, -0.058044f, -0.063439f, -0.108538f, -0.075654f, -0.092403f, 0.091867f, -0.053200f, -0.153399f, 0.080469f, 0.122949f, -0.177055f, -0.065676f, -0.071593f, 0.096832f, 0.075958f, 0.099421f, -0.086128f, 0.112488f, 0.114213f, 0.078276f, 0.128059f, -0.099797f, 0.154240f, 0.089692f, -0.100562f, -0.099686f, 0.111849f, 0.080379f, -0.088997f, -0.228550f, -0.112451f, 0.076813f, 0.116534f, 0.062611f, -0.113299f, -0.107209f, -0.093883f, -0.427527f, 0.076418f, -0.137740f, 0.078476f, 0.092394f, 0.100962f, -0.077172f, -0.146912f, 0.069826f, 0.076154f, 0.084495f, -0.075268f, -0.084203f, 0.089795f, 0.104416f, 0.057278f, -0.114511f, -0.056225f, -0.076744f, 0.123543f, 0.059886f, 0.082499f, -0.055722f, -0.099970f, 0.061343f, -0.080799f, -0.091888f, 0.098298f, -0.212579f, -0.517381f, 0.080983f, -0.165610f, 0.061113f, -0.112573f, 0.274241f, 0.124245f, -0.059843f, -0.086854f, 0.086919f, -0.091136f, 0.080013f, -0.072427f, -0.092930f, -0.078590f, 0.095532f, 0.074108f, -0.092100f, 0.109384f, -0.095464f, -0.096311f, -0.080109f, -0.098504f, -0.111292f, -0.280543f, -0.098481f, -0.242170f, 0.067001f, 0.227893f, 0.089846f, 0.058827f, -0.100439f, -0.088407f, 0.102451f, -0.105450f, 0.086631f, -0.091599f, -0.058189f, -0.110590f, 0.074111f, -0.121436f, 0.187719f, 0.107529f, -0.071973f, -0.113541f, -0.106846f, 0.066502f, -0.097722f, -0.077205f, 0.098941f, 0.060043f, -0.195608f, -0.102212f, 0.137214f, 0.128932f, -0.069463f, -0.116757f, -0.107658f, -0.072939f, -0.071128f, -0.125752f, -0.080552f, -0.117531f, 0.061707f, 0.066294f, -0.096240f, -0.058803f, -0.104907f, -0.092525f, -0.095091f, -0.136647f, 0.077514f, -0.107589f, 0.067437f, 0.202376f, -0.063666f, 0.133213f, 0.055594f, -0.234583f, 0.088771f, 0.137882f, -0.064301f, 0.127555f, -0.126632f, -0.073125f, -0.072978f, 0.059133f, -0.106082f, -0.077284f, -0.078701f, 0.060140f, 0.089364f, -0.060663f, -0.061035f, -0.101151f, 0.059668f, 0.098024f, 0.054671f, -0.053458f, -0.066800f, 0.084898f, -0.151475f, 0.087265f, -0.135834f, -0.064690f, 0.088224f, -0.091930f, 0.059233f, -0.136145f, 0.068819f, 0.117946f, 0.086088f, -0.099021f, -0.099280f, -0.115422f, -0.074659f, 0.130304f, 0.097378f, 0.100375f, -0.163905f, 0.096057f, -0.093584f, -0.067648f, 0.133173f, -0.143298f, -0.077768f, 0.075901f, -0.067794f, -0.054467f, 0.074071f, -0.092093f, 0.140360f, 0.075261f, 0.073418f, -0.099561f, -0.053664f, -0.096756f, 0.108260f, -0.181109f, 0.107461f, 0.065804f, 0.067716f, 0.204397f, -0.172474f, -0.058006f, -0.113823f, 0.091833f, -0.085149f, -0.098929f, 0.208063f, 0.101260f, -0.093565f, 0.053992f, -0.158596f, -0.109370f, -0.067155f, 0.057717f, 0.110384f, 0.080044f, 0.206845f, 0.059243f, -0.068853f, 0.062470f, 0.087470f, 0.092326f, -0.143901f, -0.090180f, 0.096660f, 0.078641f, 0.127066f, 0.053346f, -0.082974f, -0.100000f, -0.075941f, -0.126446f, 0.165754f, 0.117411f, -0.160634f, 0.101633f, -0.069208f, 0.100670f, 0.110655f, -0.101344f, 0.054233f, -0.118730f, -0.077370f, 0.103041f, 0.072437f, -0.126159f, 0.128073f, -0.099397f, 0.278564f, 0.087598f, -0.171704f, 0.134727f, -0.120011f, 0.077195f, 0.071961f, -0.075252f, -0.082947f, 0.090985f, -0.073912f, 0.104525f, 0.125669f, 0.096501f, -0.130072f, -0.124237f, 0.054532f, -0.237010f, -0.064841f, 0.065533f, 0.063472f, -0.099658f, 0.104896f, 0.055459f, -0.092611f, -0.070432f, 0.059892f, 0.117795f, -0.079753f, -0.054059f, 0.073062f, -0.094993f, -0.090718f, 0.053749f, -0.099505f, -0.131184f, 0.144113f, 0.080827f, 0.095098f, -0.060891f, -0.058459f, -0.099091f, 0.062086f, 0.053887f, -0.216390f, 0.113229f, -0.082147f, -0.071525f, 0.133084f, 0.079124f, -0.153191f, -0.073870f, -0.120435f, 0.054249f, -0.168190f, -0.072365f, -0.055134f, -0.220410f, -0.052912f, 0.235404f, -0.305763f, -0.111274f, 0.053277f, 0.089212f, -0.058397f, -0.053258f, 0.072327f, -0.122821f, 0.058371f, -0.073780f, 0.082492f, 0.062565f, -0.104327f, -0.080733f, -0.089745f, 0.061662f, -0.101989f, 0.133665f, 0.080159f, -0.225327f, 0.057217f, 0.090724f, 0.085714f, -0.109495f, 0.111219f, 0.054222f, -0.200046f, -0.086269f, -0.153926f, -0.093903f, 0.065569f, -0.230798f, 0.062065f, 0.092611f, -0.110252f, -0.121283f, -0.066314f, 0.105106f, -0.091626f, -0.119737f, 0.104681f, -0.081275f, 0.066948f, 0.120961f, -0.056044f, -0.057911f, -0.072651f, -0.118339f, 0.056854f, 0.075006f, -0.094979f, 0.055107f, 0.119694f, -0.057510f, -0.054152f, 0.077476f, -0.087070f, 0.066480f, 0.104872f, -0.103952f, 0.075125f, -0.064072f, -0.086048f, 0.135961f, 0.192133f, -0.094188f, 0.055399f, -0.052562f, -0.055559f, 0.097167f, 0.094581f, -0.062335f, -0.061988f, 0.091436f, 0.233473f, -0.093334f, 0.070206f, -0.128138f, 0.066476f, 0.070160f, -0.086596f, 0.111831f, 0.093911f, -0.093487f, -0.067230f, -0.056104f, 0.055670f, 0.077609f, 0.070114f, -0.064669f, -0.136836f, -0.090211f, -0.058601f, 0.107494f, -0.085909f, 0.094154f, 0.126027f, -0.086503f, -0.097625f, 0.064942f, -0.066723f, 0.056035f, -0.094744f, -0.131499f, -0.081463f, 0.135427f, 0.058731f, -0.057909f, -0.061869f, -0.135187f, 0.245755f, 0.147271f, -0.069339f, -0.068426f, -0.059610f, 0.087799f, -0.090111f, 0.119131f, -0.138340f, -0.259383f, -0.079419f, 0.151721f, 0.059464f, -0.076872f, 0.111091f, 0.053747f, -0.127187f, -0.177425f, -0.147680f, -0.084865f, 0.113083f, -0.118431f, 0.173876f, -0.069708f, 0.062692f, 0.053759f, -0.129638f, -0.062282f, 0.104585f, -0.124109f, -0.068988f, 0.087661f, -0.078579f, -0.068616f, -0.094072f, -0.095998f, -0.100450f, 0.074161f, 0.134242f, -0.075251f, -0.102933f, 0.066917f, -0.079917f, 0.142097f, 0.079404f, -0.112990f, -0.147586f, -0.090126f, -0.058113f, -0.075622f, 0.080723f, -0.086032f, -0.053298f, 0.101751f, -0.071551f, 0.085522f, -0.078823f, 0.060108f, -0.080502f, -0.240826f, -0.082885f, -0.087188f, -0.106394f, 0.076216f, 0.122942f, -0.055436f, -0.081568f, 0.088923f, -0.058402f, 0.107347f, 0.100311f, -0.080948f, -0.063544f, -0.065173f, -0.092419f, 0.205946f, 0.139244f, 0.294084f, -0.200547f, 0.174444f, 0.112207f, -0.079814f, -0.087600f, 0.127824f, -0.129442f, 0.086197f, -0.315752f, -0.083007f, 0.129858f, 0.089154f, 0.059909f, 0.130558f, 0.102400f, -0.065688f, 0.054368f, -0.063094f, 0.082079f, -0.089520f, -0.196894f, -0.221723f, 0.060277f, 0.065910f, 0.101146f, 0.092402f, 0.106210f, -0.075787f, -0.087449f, 0.068118f, -0.052685f, -0.093593f, -0.067538f, 0.162464f, 0.097528f, 0.490410f, -0.081568f, 0.070252f, 0.084893f, -0.067470f, -0.250477f, -0.053411f, 0.085841f, 0.066332f, -0.067417f, -0.058387f, 0.128951f, 0.077357f, -0.081873f, -0.101343f, -0.055231f, 0.064879f, 0.120962f, -0.078687f, 0.089089f, -0.093840f, -0.084193f, 0.054718f, -0.081131f, 0.054797f, 0.075052f, -0.068053f, 0.125919f, 0.067265f, 0.121889f, -0.093600f, 0.115653f, -0.080216f, -0.117998f, -0.118927f, -0.060312f, -0.082727f, 0.123916f, -0.078535f, 0.094045f, -0.086589f, 0.086086f, 0.107789f, -0.082915f, 0.200854f, 0.098223f, -0.158782f, -0.057015f, 0.141261f, 0.080368f, 0.103165f, 0.097871f, 0.070816f, 0.095160f, 0.089322f, 0.107117f, 0.072382f, -0.053845f, 0.064177f, -0.074186f, -0.080626f, 0.108776f, 0.082036f, -0.079753f, -0.103870f, -0.079887f, 0.092907f, -0.085015f, -0.090220f, 0.080501f, 0.095437f, -0.097622f, -0.084484f, -0.093257f, -0.124770f, 0.104034f, 0.119803f, -0.083285f, -0.108373f, -0.110212f, 0.092224f, 0.087039f, -0.089377f, -0.120514f, -0.091879f, -0.056928f, 0.115957f, -0.107901f, 0.067311f, 0.095759f, -0.064906f, 0.056898f, 0.128583f, 0.061290f, -0.091321f, 0.105504f, -0.087758f, -0.121949f, -0.100397f, -0.082437f, 0.103940f, 0.085794f, -0.114390f, 0.068772f, -0.077159f, -0.115736f, 0.088431f, -0.123130f, 0.075785f, -0.166857f, -0.104293f, -0.112355f, 0.060621f, -0.092116f, 0.085848f, -0.089938f, -0.069476f, 0.086242f, 0.065409f, 0.077030f, -0.088422f, -0.054262f, -0.123968f, -0.100880f, 0.098233f, 0.139320f, -0.124725f, 0.192926f, 0.139151f, -0.080397f, -0.103170f, 0.081261f, -0.071914f, 0.072596f, -0.055834f, 0.088974f, 0.091542f, -0.102929f, -0.061286f, 0.064297f, 0.109274f, -0.057837f, 0.089135f, -0.078557f, 0.087756f, -0.125537f, -0.073196f, -0.074368f, 0.074967f, 0.115547f, -0.068734f, -0.096554f, 0.066353f, 0.063026f, -0.065770f, -0.095975f, -0.162457f, -0.054189f, -0.080868f, 0.066110f, 0.103683f, 0.085167f, 0.087595f, -0.070765f, -0.080475f, 0.105591f, -0.116270f, 0.097568f, 0.131591f, 0.053111f, -0.080964f, 0.090948f, -0.089102f, -0.081485f, 0.106394f, -0.082797f, 0.055132f, -0.142396f, -0.112171f, 0.118462f, -0.089817f, -0.074437f, -0.110602f, -0.070755f, -0.364064f, 0.054333f, 0.080309f, -0.202424f, 0.091771f, -0.111607f, -0.112809f, 0.179137f, -0.114465f, 0.088542f, -0.071812f, 0.063401f, 0.094632f, 0.074254f, -0.090805f, -0.099551f, -0.071013f, 0.101890f, -0.112454f, -0.061469f, -0.066300f, -0.065512f, 0.069531f, 0.091312f, -0.066478f, 0.068385f, 0.053112f, -0.168135f, -0.059206f, 0.067432f, 0.063841f, 0.077387f, 0.068896f, -0.106284f, -0.071055f, 0.056739f, 0.136416f, -0.083069f, -0.159144f, -0.086654f, 0.104499f, 0.157095f, 0.057480f, -0.086755f, 0.144760f, -0.081884f, 0.090906f, -0.053114f, 0.085956f, 0.080607f, -0.059935f, -0.070435f, -0.074668f, -0.170364f, 0.089235f, -0.102180f, -0.096487f, 0.071490f, -0.100981f, 0.098290f, 0.115202f, -0.089440f, -0.098812f, 0.076294f, -0.084590f, 0.062264f, 0.072316f, -0.131597f, -0.106725f, -0.101275f, 0.076477f, -0.105163f, -0.103632f, -0.084532f, -0.088503f, -0.176050f, -0.056532f, -0.052969f, 0.258530f, -0.075990f, -0.270388f, -0.094794f, 0.097813f, -0.054592f, 0.090770f, -0.064909f, 0.094474f, -0.103619f, 0.086202f, 0.091118f, -0.057249f, 0.067956f, 0.060063f, 0.065188f, 0.100189f, -0.088991f, 0.086055f, 0.078785f, 0.067761f, 0.379026f, 0.067526f, -0.056484f, -0.096082f, -0.084352f, -0.124469f, 0.140471f, -0.089825f, 0.091650f, 0.126156f, 0.090999f, -0.101826f, 0.120193f, 0.064568f, -0.117714f, 0.128538f, -0.071199f, -0.061429f, -0.093891f, -0.085022f, -0.060137f, -0.061488f, -0.094553f, 0.068399f, 0.070050f, -0.077515f, -0.119535f, -0.058900f, 0.082470f, 0.090709f, 0.109706f, 0.081544f, 0.110227f, -0.053313f, -0.094415f, 0.096888f, -0.122334f, 0.122322f, 0.121628f, 0.053578f, -0.089716f, -0.109374f, 0.085642f, 0.097748f, -0.086169f, -0.099397f, 0.064507f, 0.103546f, 0.172272f, -0.128749f, -0.132601f, -0.084232f, -0.118434f, -0.081109f, -0.092985f, 0.066601f, -0.127675f, 0.102656f, 0.076527f, 0.107384f, 0.086468f, -0.056377f, 0.088278f, -0.112976f, 0.086435f, -0.128090f, 0.085945f, -0.056447f, -0.082455f, 0.115251f, -0.098188f, -0.199143f, -0.070611f, 0.143324f, -0.148170f, 0.129694f, -0.067323f, 0.080201f, 0.115548f, 0.054645f, 0.154047f, -0.090064f, 0.052954f, -0.104060f, 0.106382f, -0.082284f, 0.069786f, 0.079024f, -0.138878f, -0.070513f, 0.074234f, 0.094131f, -0.082896f, 0.071316f, 0.071707f, -0.057146f, -0.109358f, -0.083129f, 0.164318f, -0.072572f, 0.088115f, -0.078372f, 0.076356f, 0.072768f, -0.078795f, 0.147090f, 0.070803f, 0.132119f, 0.056034f, 0.149167f, 0.084649f, -0.091973f, 0.073835f, -0.092358f, -0.177365f, -0.123382f, 0.097452f, 0.095818f, 0.079191f, 0.100471f, -0.114062f, 0.082683f, -0.062745f, 0.104247f, 0.088208f, 0.079430f, -0.067325f, -0.152396f, 0.143422f, 0.075834f, -0.077770f, -0.062438f, 0.110544f, 0.104922f, 0.119444f, 0.053590f, 0.098976f, 0.171095f, 0.102104f, -0.068808f, 0.070491f, -0.068250f, 0.057843f, 0.061124f, 0.078116f, -0.070317f, -0.098034f, 0.055650f, -0.106979f, 0.242625f, 0.074210f, 0.087653f, -0.124126f, 0.062803f, -0.130264f, -0.082401f, 0.072336f, -0.077114f, -0.112514f, -0.081959f, 0.088630f, 0.059030f, -0.110275f, 0.062822f, -0.112835f, -0.140183f, 0.095703f, 0.096575f, -0.093174f, 0.121133f, 0.064186f, -0.073558f, 0.067400f, -0.074302f, 0.162343f, -0.068123f, 0.133364f, 0.078660f, 0.058864f, 0.072117f, -0.054972f, 0.075798f, -0.090228f, -0.101134f, -0.095456f, -0.113038f, -0.074840f, 0.066462f, 0.060097f, 0.058083f, -0.183294f, -0.095109f, -0.053278f, -0.069608f, -0.100188f, -0.059777f, -0.059633f, 0.109520f, -0.056962f, 0.098552f, -0.055478f, -0.058122f, 0.116418f, -0.103601f, -0.082284f, 0.084504f, 0.087124f, 0.056902f, -0.072767f, -0.096192f, -0.076989f, 0.126418f, -0.088412f, 0.081079f, -0.076251f, 0.054266f, -0.068376f, 0.103625f, -0.087978f, 0.119803f, 0.107696f, -0.100404f, 0.067193f, -0.307205f, 0.116370f, -0.129770f, -0.060545f, 0.210854f, -0.078336f, -0.103227f, -0.063535f, -0.052866f, -0.121999f, -0.122201f, -0.070248f, -0.072840f, 0.089233f, 0.081492f, -0.059172f, 0.142322f, 0.075520f, -0.074710f, 0.081273f, 0.064345f, -0.196376f, 0.139062f, 0.079736f, 0.172509f, 0.108691f, 0.096103f, -0.106578f, -0.062185f, -0.088616f, 0.154522f, 0.220092f, -0.101423f, -0.068501f, 0.085405f, -0.128986f, -0.111223f, -0.075662f, 0.124037f, 0.094913f, 0.103905f, -0.086922f, -0.092498f, 0.139235f, 0.159710f, 0.079199f, 0.096247f, -0.069049f, -0.061884f, 0.061102f, -0.059077f, 0.080589f, -0.117569f, 0.094339f, 0.063854f, -0.065479f, 0.112396f, 0.085713f, 0.066486f, -0.068320f, -0.115790f, -0.067420f, 0.132732f, 0.105813f, -0.071741f, -0.057153f, -0.054794f, -0.241817f, 0.121751f, -0.093426f, -0.081324f, -0.057313f, 0.093253f, -0.131238f, 0.097554f, 0.100445f, -0.136292f, 0.190326f, 0.055217f, -0.118164f, -0.059339f, -0.061648f, -0.139458f, -0.075852f, -0.105209f, -0.115067f, -0.071213f, 0.056054f, 0.082457f, 0.087882f, 0.114942f, 0.064736f, -0.160839f, -0.059916f, 0.096091f, 0.096714f, 0.112043f, -0.113361f, 0.107547f, 0.082228f, 0.067401f, 0.078576f, -0.131875f, 0.096032f, -0.078440f, -0.112149f, 0.059691f, -0.156960f, -0.116020f, 0.079013f, 0.091351f, 0.093192f, 0.147918f, -0.102804f, 0.080462f, -0.077843f, 0.063890f, -0.107720f, -0.094058f, -0.060750f, -0.059067f, 0.076151f, -0.370440f, -0.128284f, -0.063731f, -0.087066f, -0.100317f, -0.091526f, -0.083343f, -0.063631f, -0.104457f, -0.126252f, -0.085778f, 0.089270f, 0.105648f, -0.082329f, -0.109189f, -0.056607f, -0.109873f, -0.124958f, 0.074229f, -0.219133f, 0.079212f, 0.137092f, 0.069665f, -0.052798f, 0.124244f, -0.111394f, -0.086719f, 0.152811f, 0.098169f, -0.109299f, -0.061230f, 0.059130f, 0.202652f, 0.111044f, -0.067440f, 0.190969f, 0.197794f, -0.171257f, 0.058241f, -0.082828f, 0.060540f, -0.079008f, 0.078118f, -0.121010f, 0.077753f, 0.068608f, 0.111625f, 0.079463f, 0.160701f, -0.116287f, -0.080583f, -0.096411f, -0.098622f, -0.092106f, -0.065806f, 0.158336f, -0.096653f, -0.080283f, -0.067615f, 0.062488f, -0.123311f, 0.069068f, -0.070699f, 0.055250f, -0.093166f, -0.087715f, 0.098800f, -0.054537f, -0.068658f, -0.061214f, -0.057560f, 0.084996f, -0.127170f, 0.107088f, 0.088974f, -0.097823f, 0.107218f, -0.069683f, -0.069212f, -0.063575f, 0.085506f, 0.091451f, -0.062889f, -0.113963f, -0.131712f, 0.074925f, -0.126533f, -0.098865f, -0.069430f, -0.103312f, -0.213948f, -0.102526f, 0.082054f, 0.086936f, 0.148657f, -0.091663f, -0.106095f, 0.058769f, -0.099523f, 0.097909f, -0.103496f, -0.066629f, 0.053920f, 0.114828f, -0.072150f, -0.128807f, -0.096714f, -0.057039f, 0.096533f, 0.101791f, 0.064033f, 0.093785f, -0.094302f, -0.101179f, -0.111985f, 0.089708f, 0.087584f, -0.096612f, 0.124803f, -0.070749f, 0.086671f, -0.108267f, 0.091278f, -0.115346f, -0.100621f, -0.076796f, 0.140728f, -0.084873f, 0.085530f, 0.087562f, -0.076865f, -0.086815f, -0.074108f, -0.075360f, -0.071858f, 0.121060f, 0.100429f, 0.154150f, -0.104865f, -0.088754f, -0.090606f, 0.071498f, 0.076634f, -0.079348f, -0.085485f, -0.116004f, 0.144863f, 0.064478f, -0.104637f, -0.092857f, 0.102861f, 0.110520f, 0.066307f, 0.221956f, 0.058057f, -0.102701f, 0.254300f, -0.093292f, -0.085513f, -0.171723f, -0.130674f, 0.134617f, 0.192881f, 0.053611f, 0.069563f, -0.079163f, 0.081303f, 0.107461f, 0.070885f, -0.073387f, -0.086828f, 0.123097f, -0.073645f, -0.083894f, 0.060165f, 0.080926f, -0.072131f, -0.091740f, -0.114314f, -0.086096f, 0.073122f, 0.111752f, 0.081800f, -0.059824f, -0.103699f, -0.070384f, 0.160966f, 0.052937f, 0.103784f, -0.090596f, -0.072268f, -0.067824f, -0.069909f, 0.068035f, -0.112951f, 0.063444f, 0.056686f, -0.123367f, -0.105168f, -0.056476f, -0.056103f, -0.093363f, 0.082118f, 0.093689f, -0.112505f, 0.062721f, 0.094968f, -0.164610f, 0.081971f, -0.075005f, 0.060079f, 0.068227f, -0.094761f, 0.104238f, -0.052764f, -0.061201f, -0.058855f, 0.105896f, -0.205322f, -0.078777f, 0.078418f, 0.198745f, 0.085763f, -0.071545f, 0.101798f, -0.066178f, -0.072701f, -0.102282f, 0.080437f, 0.101195f, -0.104751f, 0.123739f, 0.149848f, 0.132815f, 0.259190f, 0.095759f, -0.091505f, 0.117431f, 0.058645f, 0.058920f, 0.075317f, -0.054442f, -0.056202f, -0.077261f, -0.081762f, -0.092430f, -0.072361f, 0.077923f, 0.054359f, 0.088068f, -0.069391f, -0.077094f, -0.120173f, -0.091458f, -0.110365f, -0.088720f, 0.070213f, 0.148135f, -0.069931f, -0.091141f, 0.088811f, 0.115693f, 0.061255f, 0.054662f, 0.145751f, 0.079775f, -0.066138f, 0.228290f, -0.057113f, -0.089672f, 0.112401f, 0.062793f, 0.102877f, 0.295646f, 0.057737f, -0.104818f, 0.063158f, 0.124539f, -0.118378f, -0.067067f, -0.098886f, -0.094857f, 0.091235f, 0.078852f, -0.096139f, -0.063252f, 0.085580f, -0.122183f, -0.065692f, 0.101927f, -0.104259f, 0.094755f, -0.094823f, -0.080239f, -0.115015f, 0.067438f, 0.061860f, -0.057820f, -0.088797f, 0.071399f, -0.163769f, -0.109737f, 0.154801f, 0.124037f, -0.090726f, -0.179200f, 0.061870f, 0.127303f, 0.090242f, 0.069433f, 0.138125f, 0.084111f, -0.105774f, -0.091776f, 0.056219f, 0.054661f, 0.169382f, -0.058176f, -0.086304f, 0.058468f, -0.092579f, -0.269531f, -0.233304f, -0.072538f, 0.113670f, -0.140599f, 0.068809f, 0.066116f, -0.087982f, 0.073659f, 0.079667f, 0.089936f, -0.066252f, -0.140546f, 0.076055f, -0.107913f, 0.092055f, 0.096811f, 0.062845f, -0.054105f, 0.073110f, -0.149731f, -0.162159f, -0.086676f, -0.477472f, 0.105672f, 0.130867f, 0.077895f, -0.098406f, -0.115810f, 0.109852f, 0.060409f, 0.061540f, 0.056268f, -0.083809f, -0.089447f, -0.078874f, -0.074607f, 0.093488f, -0.062901f, 0.063160f, 0.081723f, 0.088996f, 0.121761f, 0.132995f, 0.055880f, 0.070855f, 0.067849f, 0.085081f, 0.111065f, -0.130206f, -0.178849f, 0.119104f, -0.357868f, 0.087066f, 0.082460f, 0.068781f, -0.055610f, 0.094033f, -0.110094f, 0.065967f, -0.080911f, 0.059706f, 0.131269f, 0.060171f, 0.076645f, -0.095794f, 0.058347f, -0.075402f, -0.098000f, 0.118628f, 0.082405f, -0.067329f, 0.084459f, -0.080644f, 0.065902f, 0.084560f, 0.086755f, -0.126460f, 0.092388f, -0.071705f, 0.084325f, 0.103634f, -0.105965f, 0.081637f, 0.057156f, -0.122939f, -0.098144f, -0.094472f, -0.269706f, 0.100898f, -0.075204f, 0.138328f, 0.072132f, 0.148643f, -0.112446f, -0.066356f, 0.081665f, -0.062206f, 0.067435f, 0.071138f, 0.062405f, -0.092330f, 0.066137f, 0.114934f, -0.110226f, -0.072238f, -0.095655f, -0.093424f, 0.109123f, 0.090891f, -0.106146f, 0.070855f, -0.097873f, 0.080186f, -0.082066f, 0.104660f, -0.090123f, -0.101827f, -0.108783f, -0.070951f, -0.193074f, -0.096566f, -0.403288f, 0.064004f, 0.086121f, -0.057470f, 0.102669f, -0.063911f, 0.104520f, 0.127633f, 0.071983f, -0.097141f, 0.057549f, 0.065991f, 0.064744f, 0.088484f, 0.116914f, -0.110649f, 0.064958f, 0.053978f, -0.093020f, -0.100720f, -0.068890f, 0.062987f, 0.099571f, -0.102019f, 0.054073f, -0.124075f, -0.104550f, -0.104123f, 0.054053f, -0.100684f, -0.090511f, 0.505503f, -0.088840f, 0.064033f, -0.111522f, 0.086344f, 0.078744f, 0.305120f, -0.071528f, 0.060970f, -0.079352f, -0.077242f, 0.060434f, -0.064908f, 0.073856f, 0.056696f, 0.062139f, -0.117479f, -0.114176f, -0.100883f, -0.112413f, 0.114767f, 0.074058f, 0.091785f, -0.144851f, 0.092567f, 0.093906f, -0.089175f, 0.058544f, 0.081922f, -0.084258f, 0.114434f, 0.093651f, 0.061899f, 0.067132f, -0.111250f, -0.161266f, 0.164702f, -0.097733f, 0.100204f, 0.134289f, -0.066192f, 0.105808f, 0.078132f, -0.097170f, -0.081485f, -0.094505f, 0.065644f, 0.071756f, -0.112910f, 0.124895f, 0.081617f, -0.059656f, 0.085165f, 0.092461f, 0.078971f, -0.068850f, -0.086733f, -0.082279f, 0.085225f, 0.137302f, -0.063609f, -0.091099f, -0.060173f, 0.093085f, -0.106437f, -0.107690f, 0.160176f, -0.181153f, 0.101050f, 0.065381f, -0.122177f, 0.059430f, 0.157017f, 0.106029f, -0.063276f, 0.087695f, -0.079092f, 0.108296f, 0.075133f, -0.132101f, 0.130311f, -0.066072f, -0.069951f, -0.173775f, -0.062703f, -0.084158f, 0.100152f, -0.147670f, -0.087104f, 0.123331f, -0.088645f, -0.067431f, -0.064587f, 0.061304f, -0.101844f, 0.067973f, 0.108092f, 0.067252f, -0.072747f, -0.215817f, -0.169598f, -0.199088f, -0.055596f, -0.159092f, 0.103032f, 0.172331f, -0.250888f, 0.102837f, 0.073242f, -0.097280f, -0.081314f, -0.104205f, 0.061725f, 0.077020f, 0.069676f, -0.093123f, 0.103946f, 0.084463f, -0.102673f, -0.197584f, -0.057930f, -0.056357f, -0.112380f, -0.074164f, -0.078134f, -0.089763f, -0.094200f, -0.073454f, -0.082576f, 0.175965f, -0.070313f, -0.087532f, -0.202490f, 0.154245f, -0.085481f, -0.092548f, -0.091012f, -0.100516f, -0.074153f, 0.055871f, -0.053997f, -0.118176f, 0.130565f, 0.178026f, 0.222397f, 0.055895f, -0.115066f, -0.109846f, 0.085503f, -0.054870f, 0.090531f, -0.139965f, 0.061755f, 0.111274f, 0.082186f, -0.081345f, 0.099018f, -0.076612f, -0.104624f, -0.069232f, -0.082937f, 0.093079f, 0.072245f, 0.077815f, -0.079529f, -0.093006f, 0.097616f, 0.202312f, 0.126355f, -0.131303f, -0.081581f, 0.174211f, -0.069719f, -0.088415f, -0.066738f, -0.054295f, 0.074532f, 0.072865f, 0.099439f, 0.093221f, 0.055748f, -0.122465f, 0.081550f, 0.105073f, -0.086726f, -0.082537f, -0.091840f, -0.172296f, 0.078698f, 0.084655f, 0.056426f, 0.081711f, -0.081987f, 0.108582f, 0.121666f, 0.437647f, -0.088580f, 0.085901f, 0.067952f, 0.097072f, -0.147658f, -0.096173f, 0.166974f, 0.101660f, -0.062813f, -0.126051f, 0.053479f, -0.095614f, 0.058848f, 0.105297f, 0.103889f, -0.087034f, -0.057084f, -0.068002f, -0.086171f, 0.095212f, -0.093761f, 0.076969f, -0.121901f, 0.054323f, 0.063265f, -0.066370f, -0.107496f, 0.109552f, -0.079627f, 0.130632f, -0.053587f, -0.091790f, -0.065613f, 0.070329f, 0.081431f, 0.098650f, -0.110149f, 0.073798f, -0.087109f, -0.138392f, 0.065769f, 0.101361f, 0.125772f, -0.089150f, 0.087187f, -0.127438f, -0.068159f, 0.138869f, -0.082500f, 0.070029f, 0.063831f, -0.056090f, 0.094550f, -0.121812f, -0.154551f, 0.083595f, -0.067100f, -0.137808f, -0.146304f, 0.130261f, -0.076575f, -0.083865f, -0.071159f, 0.068317f, -0.069214f, 0.127772f, -0.118326f, -0.110785f, -0.075911f, -0.109557f, 0.065743f, 0.082398f, 0.054422f, 0.053204f, -0.121110f, -0.082976f, 0.097615f, 0.053651f, -0.138489f, 0.071340f, -0.107089f, 0.115995f, -0.082204f, -0.089920f, -0.103080f, 0.114925f, -0.068418f, -0.121521f, -0.075025f, 0.160733f, -0.163708f, 0.095637f, -0.146610f, 0.070494f, -0.069180f, 0.093711f, -0.119450f, 0.111680f, -0.073581f, 0.097726f, -0.090328f, 0.062915f, 0.078194f, -0.085733f, -0.101647f, 0.091907f, 0.119876f, -0.106726f, 0.101625f, -0.089373f, 0.110062f, 0.132545f, -0.084897f, -0.068032f, -0.286206f, -0.097889f, 0.075991f, 0.066218f, 0.053805f, 0.186977f, 0.140322f, -0.107504f, 0.095137f, -0.132089f, 0.098862f, 0.101368f, -0.060076f, 0.055073f, -0.080469f, -0.053330f, 0.080698f, -0.138700f, -0.166814f, -0.087577f, 0.061601f, 0.059015f, 0.084874f, -0.094256f, -0.134538f, 0.068239f, 0.121367f, -0.087695f, 0.108625f, 0.110018f, 0.115856f, -0.067371f, 0.071980f, 0.093551f, 0.174853f, 0.073059f, 0.146290f, 0.097344f, -0.136286f, 0.090735f, -0.063468f, -0.073498f, 0.096743f, -0.055417f, 0.154001f, 0.098255f, 0.158481f, 0.059988f, 0.083622f, -0.052809f, 0.115779f, -0.141830f, 0.082487f, -0.076350f, 0.127954f, -0.134141f, -0.085680f, -0.107389f, 0.107212f, 0.053449f, 0.063748f, 0.094420f, -0.092262f, 0.086083f, -0.105930f, 0.082658f, -0.060957f, 0.146752f, 0.082157f, 0.093629f, -0.117265f, 0.095952f, 0.115600f, -0.141034f, 0.063131f, -0.111819f, 0.143390f, 0.167580f, -0.058254f, -0.093410f, 0.129585f, -0.068051f, -0.065371f, 0.110290f, -0.068298f, 0.071208f, 0.110921f, 0.253229f, 0.084395f, 0.070983f, -0.055163f, 0.081312f, -0.068653f, 0.079477f, -0.057371f, 0.079204f, 0.087553f, 0.086410f, -0.063415f, 0.098544f, 0.136035f, -0.103739f, -0.063739f, -0.068398f, 0.124176f, -0.074049f, 0.065647f, 0.215137f, -0.103059f, -0.235222f, -0.092749f, 0.119084f, 0.096558f, -0.077348f, 0.094467f, -0.062332f, -0.155614f, -0.056975f, 0.072205f, 0.063028f, -0.081637f, 0.091403f, -0.060642f, -0.066885f, 0.065312f, -0.097744f, -0.059646f, -0.112812f, 0.075625f, 0.080750f, -0.127729f, -0.087031f, 0.101898f, 0.110990f, -0.143560f, 0.390553f, 0.099131f, -0.091971f, 0.111641f, 0.087103f, 0.079092f, -0.199052f, 0.101498f, 0.084877f, -0.094664f, -0.096835f, -0.055111f, -0.089233f, -0.105001f, -0.079181f, 0.069169f, -0.073396f, 0.090665f, -0.068315f, 0.069476f, -0.078074f, 0.089579f, 0.066730f, 0.105666f, -0.071917f, -0.171289f, -0.136169f, -0.083072f, -0.066231f, 0.188119f, 0.077061f, 0.129204f, 0.199109f, 0.115823f, 0.055875f, 0.062589f, -0.096795f, 0.068856f, 0.056267f, -0.092877f, -0.069409f, 0.084305f, -0.063715f, 0.175564f, -0.067953f, 0.175165f, 0.064143f, -0.171715f, 0.121239f, -0.118519f, 0.122367f, 0.084781f, -0.172616f, 0.087482f, 0.064896f, 0.079945f, 0.060662f, 0.092747f, 0.092530f, 0.081002f, -0.101060f, -0.114084f, 0.054526f, 0.140108f, -0.093096f, 0.123826f, 0.062178f, 0.169569f, 0.107595f, 0.098731f, 0.237245f, -0.133620f, 0.080456f, -0.082770f, 0.064120f, -0.076678f, -0.095333f, -0.082862f, 0.188833f, -0.108293f, 0.152226f, 0.054455f, 0.235167f, 0.179701f, 0.133302f, -0.093743f, -0.070007f, -0.103200f, -0.121412f, -0.063964f, -0.107899f, -0.073165f, -0.064958f, -0.091000f, -0.094205f, -0.073389f, 0.057953f, -0.071829f, -0.229074f, -0.095844f, -0.194662f, -0.273451f, 0.068002f, -0.140193f, 0.171483f, -0.087863f, 0.096096f, -0.128162f, -0.086441f, -0.069699f, -0.077607f, 0.068701f, 0.099720f, -0.111974f, -0.097111f, 0.083416f, -0.071223f, 0.080462f, 0.103996f, 0.128116f, 0.078366f, -0.092370f, 0.067610f, -0.165670f, 0.088652f, -0.071421f, 0.060231f, 0.133553f, -0.096333f, 0.079537f, -0.111510f, 0.063706f, -0.201790f, -0.070991f, -0.072944f, 0.072297f, -0.200711f, -0.063296f, 0.244099f, -0.071957f, -0.293849f, -0.115917f, -0.053959f, 0.119533f, -0.060047f, 0.118995f, -0.062643f, -0.054859f, 0.129951f, 0.099513f, 0.096957f, 0.069384f, -0.057819f, -0.076784f, -0.107311f, -0.180157f, -0.060827f, 0.061313f, -0.092574f, -0.072448f, -0.073950f, -0.082713f, -0.089933f, -0.082434f, 0.125675f, 0.367685f, 0.072509f, -0.073837f, 0.125964f, 0.101553f, -0.158391f, -0.091437f, -0.106640f, 0.062411f, -0.095162f, 0.054689f, -0.098144f, -0.153959f, -0.064414f, 0.067485f, 0.177006f, -0.147216f, -0.092563f, 0.075781f, -0.071749f, -0.140547f, 0.125400f, -0.080863f, 0.114034f, 0.131310f, 0.097316f, 0.212010f, -0.112722f, 0.116583f, 0.070647f, -0.082152f, -0.096164f, -0.054268f, -0.089097f, 0.091831f, -0.102668f, -0.086959f, -0.092743f, 0.063999f, 0.071928f, 0.116319f, 0.077209f, 0.089437f, 0.113494f, -0.100415f, -0.146021f, 0.131725f, -0.106845f, -0.090936f, -0.140742f, -0.124377f, -0.093121f, 0.070486f, 0.062367f, -0.105655f, -0.081363f, 0.137916f, 0.109153f, 0.109954f, 0.087137f, -0.060705f, -0.136011f, 0.102588f, 0.109111f, 0.123125f, 0.126431f, -0.076204f, 0.053701f, -0.071730f, -0.161471f, -0.119237f, -0.060718f, 0.061696f, -0.183382f, 0.055673f, -0.076619f, -0.058290f, -0.091997f, 0.056257f, -0.083537f, -0.070469f, 0.267927f, -0.085355f, -0.098884f, 0.083408f, -0.062692f, -0.071537f, -0.174386f, 0.071389f, -0.091447f, -0.087109f, -0.079268f, -0.084832f, 0.109899f, 0.078703f, -0.117147f, -0.073024f, -0.153072f, -0.074900f, -0.104917f, 0.109409f, 0.069117f, -0.084958f, -0.072097f, 0.079510f, 0.079420f, 0.144931f, 0.071950f, 0.386986f, 0.087272f, 0.112212f, 0.055982f, 0.109806f, -0.152055f, -0.094124f, -0.063572f, 0.062475f, 0.066344f, -0.062954f, -0.103329f, 0.131717f, 0.113365f, -0.100432f, 0.074258f, 0.081971f, 0.101085f, -0.089473f, -0.087081f, -0.083248f, 0.209927f, -0.079383f, 0.068814f, -0.090911f, 0.055709f, -0.108502f, -0.062481f, -0.093932f, 0.130524f, -0.064200f, -0.128532f, 0.070852f, -0.083597f, -0.055408f, -0.083516f, 0.068646f, 0.076034f, 0.066286f, 0.096524f, 0.116601f, -0.088111f, 0.061251f, -0.097637f, 0.095032f, 0.068503f, 0.058189f, 0.060002f, -0.116159f, 0.131431f, 0.108416f, 0.063421f, 0.072319f, -0.103641f, -0.056017f, 0.080931f, -0.075224f, -0.067776f, -0.059688f, 0.122377f, 0.064357f, -0.091833f, 0.100021f, -0.073863f, -0.057770f, 0.212291f, 0.065083f, -0.066212f, 0.388605f, 0.055072f, 0.166311f, -0.109297f, -0.103741f, 0.080536f, 0.067719f, 0.068479f, 0.059065f, -0.086126f, 0.091218f, -0.100740f, -0.080193f, -0.117018f, 0.087426f, 0.089544f, -0.093870f, 0.076066f, -0.105119f, -0.085669f, -0.076183f, 0.056624f, -0.062995f, 0.068452f, -0.083490f, -0.056552f, -0.109189f, 0.086996f, 0.056490f, -0.120295f, 0.063338f, 0.081279f, 0.121480f, 0.068357f, 0.106368f, 0.079466f, 0.149563f, 0.062638f, -0.109388f, -0.083919f, -0.163299f, 0.118077f, -0.093480f, -0.125002f, -0.100439f, -0.095389f, -0.068109f, -0.098732f, 0.105070f, 0.112565f, 0.068315f, 0.083540f, 0.079775f, -0.062268f, 0.088713f, -0.106157f, 0.075254f, -0.063528f, 0.168647f, 0.065653f, 0.108462f, -0.107178f, 0.079395f, -0.070451f, -0.094397f, 0.053449f, 0.079549f, 0.059659f, -0.089478f, -0.175166f, -0.093833f, -0.093723f, -0.163132f, 0.111161f, -0.092533f, -0.063005f, 0.085594f, 0.081387f, 0.098057f, 0.070237f, 0.107132f, -0.099481f, 0.089539f, 0.073597f, 0.053323f, -0.080267f, -0.053301f, -0.090845f, 0.076776f, -0.080388f, 0.164701f, -0.136240f, 0.084049f, -0.160287f, -0.079032f, -0.059069f, 0.098555f, 0.102328f, 0.122222f, 0.101022f, -0.138049f, 0.053632f, 0.062595f, -0.053585f, 0.086718f, -0.062690f, 0.058263f, 0.078651f, 0.076881f, -0.072327f, -0.086385f, 0.119286f, 0.088690f, -0.168469f, 0.118632f, 0.075062f, 0.085491f, 0.054686f, -0.077481f, 0.129632f, 0.081439f, -0.096880f, -0.064590f, 0.090017f, -0.102885f, 0.064485f, 0.091827f, -0.074528f, 0.075633f, -0.135129f, -0.126512f, -0.069250f, 0.080820f, 0.056898f, 0.089059f, 0.069316f, -0.099729f, -0.069790f, 0.077564f, 0.062268f, 0.122941f, -0.068213f, 0.057327f, -0.088656f, -0.124512f, -0.092753f, 0.130831f, 0.088324f, -0.081792f, -0.111381f, -0.112898f, -0.106986f, -0.457137f, 0.090105f, 0.086621f, 0.061502f, 0.064762f, 0.137412f, -0.067054f, 0.057909f, -0.103742f, -0.065877f, 0.059863f, 0.105304f, -0.075049f, -0.056308f, 0.081253f, 0.073727f, 0.071022f, -0.095981f, -0.097860f, -0.127538f, -0.069267f, 0.093084f, -0.064153f, 0.066334f, -0.114056f, -0.064078f, 0.080968f, 0.073504f, -0.066516f, 0.066803f, 0.158419f, 0.089979f, -0.069042f, 0.080891f, 0.104569f, 0.053067f, 0.118368f, -0.056727f, 0.232836f, -0.094728f, 0.062616f, -0.150674f, -0.180311f, 0.082322f, -0.093072f, -0.121381f, 0.084531f, 0.083737f, -0.080278f, 0.086297f, 0.086449f, 0.101249f, -0.121970f, -0.212305f, -0.204725f, -0.072791f, 0.055200f, 0.062063f, 0.073867f, -0.079233f, 0.087959f, 0.069144f, 0.067846f, 0.095155f, 0.088234f, 0.127904f, -0.086959f, -0.073534f, 0.312626f, 0.079317f, 0.055298f, 0.128124f, 0.087304f, -0.125216f, -0.084764f, -0.103150f, 0.090121f, -0.111430f, 0.098835f, -0.069441f, 0.103751f, 0.082315f, -0.087732f, 0.095216f, 0.094578f, 0.062195f, -0.066852f, 0.079748f, -0.095069f, 0.065155f, -0.061090f, -0.103025f, -0.102876f, 0.113666f, -0.079453f, 0.095204f, -0.059822f, 0.070899f, -0.053684f, 0.115114f, 0.170530f, -0.064822f, 0.099744f, 0.082419f, 0.058482f, 0.079709f, 0.076468f, -0.085019f, -0.081925f, -0.104207f, 0.162820f, 0.120939f, -0.088047f, -0.069223f, -0.078834f, -0.054807f, -0.059376f, -0.087082f, -0.065023f, 0.128304f, 0.093773f, 0.071127f, -0.066532f, -0.082489f, 0.088291f, -0.053193f, 0.091543f, 0.090941f, 0.058814f, -0.053030f, 0.092441f, -0.058868f, -0.073061f, -0.078723f, 0.077680f, 0.077777f, 0.066429f, 0.082713f, 0.072719f, 0.150082f, -0.087220f, 0.060607f, -0.091821f, 0.095495f, 0.071117f, -0.181479f, -0.141131f, 0.103294f, -0.089222f, -0.110482f, -0.063166f, -0.072552f, -0.059640f, 0.082411f, 0.103437f, -0.097226f, -0.095588f, 0.133801f, 0.091830f, 0.120345f, -0.072817f, 0.124131f, -0.056212f, 0.127326f, 0.071203f, 0.060846f, -0.100237f, -0.067520f, -0.070740f, -0.198358f, -0.123493f, -0.132595f, -0.257183f, -0.179049f, 0.100125f, 0.081201f, 0.206137f, -0.150778f, 0.065889f, 0.072526f, -0.116540f, -0.085539f, -0.060609f, -0.098532f, 0.077059f, 0.103953f, -0.090847f, 0.055674f, -0.085211f, 0.064831f, 0.063433f, 0.101385f, 0.081257f, -0.122791f, 0.181273f, -0.110850f, 0.080376f, 0.059953f, -0.115421f, -0.086226f, 0.084775f, 0.067357f, 0.089745f, 0.054027f, 0.103292f, -0.428894f, -0.089828f, 0.084400f, -0.109514f, 0.296664f, 0.082177f, 0.096531f, -0.063189f, -0.077840f, 0.063881f, 0.088783f, 0.076928f, 0.073742f, 0.066413f, -0.095689f, 0.076019f, -0.064088f, 0.082057f, -0.100362f, -0.053525f, -0.107171f, 0.090689f, 0.097450f, -0.075663f, -0.059966f, 0.111260f, -0.112618f, -0.101683f, 0.080589f, -0.116121f, 0.078135f, -0.087940f, 0.098308f, 0.156345f, 0.447779f, 0.055658f, -0.106145f, 0.118971f, 0.156729f, 0.073934f, 0.101608f, 0.110347f, 0.112136f, 0.111032f, 0.073514f, -0.088790f, 0.107344f, 0.086196f, 0.086261f, 0.096378f, 0.097948f, 0.076829f, -0.078462f, -0.124541f, -0.065067f, 0.061680f, -0.061160f, -0.078495f, 0.094189f, -0.133795f, 0.104573f, 0.054278f, -0.063014f, -0.071135f, -0.104843f, 0.064509f, -0.097620f, 0.079428f, -0.237070f, -0.080587f, 0.081996f, -0.163121f, -0.071384f, 0.119643f, -0.061459f, 0.094307f, -0.097641f, -0.067689f, -0.085756f, -0.082645f, -0.059794f, 0.087887f, -0.052861f, -0.086648f, 0.131392f, -0.078262f, 0.059809f, -0.094531f, 0.089036f, 0.078368f, -0.061816f, -0.083929f, -0.107359f, 0.071541f, -0.074154f, 0.172998f, -0.070107f, -0.066775f, 0.084075f, 0.055150f, -0.086160f, 0.091007f, 0.095940f, -0.077134f, -0.054232f, 0.080475f, -0.085828f, -0.072147f, 0.099460f, 0.093576f, 0.081341f, 0.130768f, -0.079305f, 0.072965f, 0.115636f, 0.099635f, 0.083368f, -0.107196f, 0.103661f, 0.060105f, -0.097058f, 0.093705f, 0.081836f, 0.063847f, -0.108334f, -0.060766f, 0.103530f, 0.109498f, -0.062959f, -0.116429f, 0.239391f, -0.068104f, -0.081072f, -0.086758f, -0.081182f, -0.069204f, -0.054014f, -0.088117f, -0.150478f, -0.053738f, -0.117957f, 0.070393f, 0.094453f, -0.082782f, 0.088295f, 0.062849f, 0.053567f, -0.082653f, -0.070337f, 0.125937f, 0.069226f, 0.133104f, -0.057292f, 0.122667f, -0.110811f, 0.094886f, 0.090676f, -0.080673f, 0.093126f, -0.071093f, 0.076608f, 0.089740f, -0.107310f, 0.064386f, -0.118485f, 0.069995f, 0.094168f, -0.122147f, -0.121780f, -0.055662f, -0.163112f, 0.067677f, -0.056093f, -0.089091f, 0.080524f, -0.081549f, -0.066562f, -0.101457f, 0.060838f, 0.055319f, -0.060186f, 0.100493f, 0.099938f, 0.081502f, 0.079214f, -0.078904f, -0.057448f, 0.073185f, -0.086167f, 0.066281f, 0.059579f, 0.086826f, 0.103908f, -0.095230f, 0.086296f, -0.057025f, -0.112904f, -0.099019f, -0.081974f, 0.084679f, -0.089479f, -0.126823f, 0.084172f, -0.063556f, 0.098671f, 0.064324f, -0.071370f, 0.441777f, -0.136727f, 0.086564f, 0.117052f, 0.072860f, 0.084150f, -0.103207f, 0.097765f, -0.094000f, -0.103656f, -0.092225f, -0.082527f, -0.074479f, -0.099773f, 0.127977f, 0.098807f, -0.080674f, -0.137187f, 0.080132f, 0.085081f, -0.067361f, 0.070243f, 0.078174f, -0.147260f, 0.078416f, -0.060986f, 0.092767f, -0.111030f, 0.066656f, 0.109975f, 0.129234f, 0.080234f, 0.083962f, -0.158487f, 0.074791f, -0.071562f, 0.100071f, 0.057115f, 0.076122f, -0.179713f, -0.056545f, 0.159686f, 0.054472f, -0.328095f, 0.089549f, 0.118004f, 0.062756f, -0.057747f, 0.090616f, 0.058043f, -0.081808f, -0.093893f, 0.109352f, 0.075715f, -0.099659f, -0.146411f, 0.057229f, 0.070949f, 0.061290f, 0.075611f, 0.102830f, -0.075602f, 0.111236f, -0.070121f, -0.086734f, 0.098500f, -0.087923f, -0.095073f, -0.054595f, 0.086910f, -0.117410f, 0.293365f, -0.052796f, 0.098212f, 0.102434f, -0.098369f, 0.116928f, 0.092040f, -0.091091f, -0.080261f, 0.123473f, 0.101334f, 0.057931f, -0.073043f, -0.109986f, 0.074561f, 0.093132f, -0.059382f, -0.085520f, -0.069474f, -0.083326f, -0.099438f, -0.082185f, -0.085443f, -0.135639f, -0.126555f, 0.074007f, -0.077386f, -0.103793f, -0.101666f, 0.103872f, 0.133627f, 0.081593f, 0.401580f, -0.095504f, -0.064881f, -0.091710f, -0.082746f, -0.079947f, 0.084118f, -0.087712f, -0.110625f, -0.059540f, 0.083174f, 0.089278f, -0.077565f, 0.122271f, -0.084822f, 0.071354f, -0.079871f, 0.090941f, -0.114266f, 0.102966f, 0.057244f, -0.096862f, 0.082168f, 0.074147f, 0.068503f, 0.094291f, 0.085666f, 0.058555f, -0.095250f, -0.073817f, 0.069061f, 0.087606f, 0.079843f, -0.205475f, -0.202629f, -0.073585f, -0.408580f, -0.070520f, 0.068570f, -0.170709f, 0.077444f, 0.216071f, 0.093781f, -0.114945f, 0.071865f, -0.096089f, -0.059664f, -0.115271f, 0.060484f, 0.091754f, -0.068839f, -0.096954f, -0.088965f, 0.098790f, 0.053701f, -0.087608f, 0.079933f, -0.078989f, -0.095419f, 0.124317f, -0.090482f, -0.069041f, 0.088556f, -0.180754f, 0.103843f, -0.107581f, 0.095660f, -0.068400f, 0.153537f, 0.097429f, -0.068151f, 0.131361f, -0.119889f, -0.072038f, -0.084899f, 0.215285f, 0.068047f, 0.096302f, -0.247161f, -0.091974f, -0.137764f, -0.054737f, 0.127091f, -0.069054f, -0.056833f, 0.077328f, 0.064496f, 0.103985f, 0.108257f, -0.067713f, -0.057591f, -0.089566f, 0.099792f, -0.205829f, -0.069559f, 0.120537f, 0.061918f, 0.076495f, 0.092358f, -0.097387f, -0.071070f, 0.055521f, -0.106554f, 0.166986f, 0.092155f, 0.099543f, 0.057126f, 0.095717f, 0.074505f, -0.081580f, -0.112581f, -0.089682f, 0.076732f, 0.124623f, 0.104835f, 0.085364f, -0.090197f, -0.062296f, 0.069219f, 0.166711f, -0.094242f, 0.134306f, -0.109621f, -0.085926f, 0.068667f, 0.056791f, 0.093959f, -0.095143f, -0.085901f, -0.118474f, 0.112257f, 0.223489f, 0.127228f, -0.092734f, 0.085201f, 0.112178f, -0.069713f, -0.107865f, -0.075669f, 0.104550f, -0.074913f, -0.054744f, -0.071600f, 0.077377f, 0.086139f, 0.068910f, -0.088465f, -0.134425f, -0.061443f, -0.140854f, 0.078779f, -0.327097f, 0.053871f, 0.055337f, -0.156492f, -0.055628f, 0.142726f, 0.079355f, -0.098109f, -0.091421f, -0.088665f, 0.053041f, 0.065070f, -0.100685f, -0.098144f, -0.104831f, -0.120977f, 0.056393f, -0.090600f, 0.084365f, -0.057260f, -0.066810f, 0.079521f, 0.080697f, -0.073978f, 0.127049f, -0.121616f, 0.076403f, 0.057716f, 0.151006f, -0.124336f, 0.062249f, -0.131974f, 0.092208f, -0.134793f, -0.104297f, -0.069191f, 0.063597f, 0.073147f, 0.085689f, 0.064077f, -0.075701f, 0.089308f, -0.177935f, -0.055688f, 0.071810f, 0.075230f, 0.101688f, -0.088807f, 0.085055f, -0.118030f, 0.055680f, -0.123852f, -0.062668f, 0.060452f, 0.111075f, -0.092564f, -0.082398f, 0.219979f, -0.102527f, -0.056690f, 0.121136f, -0.064613f, -0.102429f, 0.099577f, -0.062883f, -0.098810f, 0.091712f, -0.055466f, -0.085676f, 0.106399f, -0.135872f, 0.064707f, -0.084142f, 0.074513f, 0.084067f, 0.089354f, -0.132718f, -0.077410f, 0.098703f, 0.133898f, 0.071068f, 0.067447f, -0.110434f, -0.063780f, -0.099673f, -0.085960f, 0.102668f, 0.118438f, 0.061241f, 0.079579f, -0.094268f, -0.120873f, 0.071037f, 0.059593f, -0.115726f, -0.091809f, -0.056146f, -0.057692f, 0.053698f, -0.089925f, -0.078816f, -0.073703f, 0.055070f, -0.070058f, -0.080664f, -0.103196f, 0.069935f, -0.106344f, 0.074204f, -0.063802f, -0.381378f, -0.069765f, -0.053213f, -0.072524f, 0.059120f, -0.053494f, -0.185623f, -0.097428f, -0.059309f, 0.105960f, 0.083507f, 0.065712f, 0.073145f, -0.063009f, 0.099869f, 0.106017f, 0.088289f, -0.078113f, 0.079753f, 0.106921f, 0.098880f, -0.072964f, -0.064393f, -0.108260f, 0.126069f, -0.066798f, 0.096124f, 0.163184f, -0.073894f, 0.057345f, 0.137033f, 0.088760f, -0.072633f, -0.065103f, 0.088094f, -0.124576f, -0.155932f, -0.076594f, -0.066458f, 0.103494f, -0.115046f, -0.070468f, -0.109623f, -0.089681f, -0.115950f, -0.127070f, 0.257095f, -0.073677f, 0.125395f, -0.066077f, -0.067478f, 0.088482f, -0.057733f, -0.068902f, -0.102449f, -0.144573f, 0.091843f, -0.097034f, 0.301060f, 0.139922f, 0.072129f, 0.078659f, -0.086522f, -0.092485f, 0.132828f, -0.055094f, 0.097840f, -0.073827f, -0.078784f, 0.088773f, 0.076781f, -0.064986f, 0.091022f, -0.064298f, -0.114480f, 0.068655f, -0.097101f, -0.101068f, 0.094856f, -0.165952f, -0.109577f, 0.108499f, 0.071479f, -0.152093f, -0.087442f, 0.083215f, -0.102607f, -0.053454f, -0.081203f, -0.090115f, -0.081622f, 0.107525f, -0.089802f, 0.067317f, -0.097131f, -0.060404f, 0.056970f, 0.098628f, 0.097563f, -0.061233f, 0.125509f, -0.102159f, 0.061827f, -0.076584f, -0.118644f, -0.102520f, -0.059695f, -0.092066f, -0.070445f, 0.081263f, 0.067680f, 0.080164f, -0.081623f, 0.107568f, 0.064148f, 0.070488f, 0.067676f, -0.092101f, -0.066502f, -0.082203f, 0.111903f, -0.117897f, 0.195300f, -0.128523f, 0.090593f, -0.070115f, -0.076335f, -0.122312f, 0.092962f, -0.098937f, -0.093631f, 0.079243f, 0.106123f, -0.098724f, 0.101142f, -0.165931f, 0.080066f, 0.093130f, 0.091062f, 0.058853f, 0.106488f, 0.079758f, -0.072278f, -0.073308f, 0.083810f, -0.092460f, 0.125924f, 0.101729f, 0.060173f, 0.071972f, -0.061626f, 0.061402f, -0.103617f, 0.069379f, -0.102371f, 0.055914f, 0.098617f, -0.099351f, -0.114463f, 0.110121f, -0.110817f, 0.122227f, -0.067944f, 0.055968f, 0.105087f, -0.057474f, 0.093147f, -0.088024f, 0.091952f, 0.074137f, -0.132386f, -0.065365f, -0.200119f, -0.127855f, 0.102414f, 0.081383f, -0.094555f, -0.068094f, 0.067666f, -0.118909f, 0.122178f, 0.071248f, -0.059953f, -0.076475f, -0.053438f, 0.091244f, 0.093621f, -0.088305f, 0.059730f, 0.080389f, -0.099869f, 0.168590f, 0.092063f, -0.070198f, -0.060140f, 0.108083f, 0.081437f, -0.197754f, 0.061207f, -0.084688f, -0.094419f, -0.091823f, -0.113909f, 0.066301f, 0.071423f, 0.119438f, 0.074584f, -0.087568f, 0.066984f, -0.067614f, -0.091549f, -0.127015f, -0.099570f, -0.058359f, -0.095129f, 0.102637f, 0.067530f, -0.078643f, -0.060461f, -0.072566f, -0.073516f, -0.082598f, -0.140347f, 0.130926f, -0.290563f, -0.062985f, 0.102990f, -0.063101f, -0.108005f, 0.085763f, -0.102235f, 0.131115f, -0.086139f, -0.097361f, 0.082771f, 0.083871f, 0.072959f, -0.095209f, 0.107724f, 0.094333f, 0.091671f, -0.086076f, 0.108116f, -0.100733f, -0.072822f, -0.114418f, -0.093057f, -0.065690f, 0.127894f, 0.055574f, -0.076986f, 0.083230f, -0.061216f, -0.097182f, -0.072635f, -0.099825f, 0.115250f, -0.165003f, -0.153461f, -0.106800f, -0.117602f, -0.058719f, -0.118535f, 0.088808f, 0.093293f, 0.072231f, 0.092741f, -0.101600f, -0.066772f, 0.089583f, 0.078050f, -0.078620f, -0.074191f, 0.079869f, -0.163810f, -0.091829f, 0.118562f, 0.070635f, 0.163024f, 0.195293f, -0.119808f, -0.115939f, -0.103457f, -0.112139f, -0.055496f, 0.098869f, 0.131389f, 0.110407f, -0.070500f, -0.125417f, 0.106626f, 0.110181f, 0.083662f, -0.085244f, 0.063501f, -0.075025f, 0.073489f, -0.120062f, -0.079300f, 0.081236f, -0.087325f, -0.097982f, -0.095744f, 0.092996f, -0.058416f, 0.090505f, -0.107383f, 0.055586f, -0.124423f, -0.062374f, 0.120041f, 0.061799f, 0.158316f, 0.128876f, -0.096233f, 0.097132f, 0.135841f, -0.072588f, 0.076620f, -0.109324f, -0.059551f, 0.092634f, 0.104159f, 0.102795f, 0.068972f, -0.078155f, 0.102405f, -0.084914f, -0.082810f, -0.112221f, -0.095126f, -0.071206f, 0.182192f, 0.495389f, -0.069901f, 0.066947f, 0.123287f, 0.081031f, -0.097793f, -0.103917f, 0.086705f, 0.074584f, -0.078491f, 0.153050f, 0.104637f, 0.083092f, -0.069336f, -0.070846f, -0.057268f, 0.064598f, 0.096920f, 0.071717f, 0.099767f, 0.097004f, -0.073429f, -0.091381f, 0.053741f, -0.080190f, -0.093713f, -0.097592f, -0.055788f, -0.057213f, 0.100479f, 0.148049f, 0.107724f, 0.087154f, -0.107247f, -0.062018f, -0.073203f, 0.068263f, 0.058356f, 0.104046f, -0.103333f, -0.103830f, 0.053832f, -0.123675f, -0.067786f, -0.182016f, -0.072711f, -0.064276f, -0.072941f, 0.061313f, -0.065192f, 0.070402f, 0.071397f, 0.163871f, 0.107161f, 0.076766f, -0.118874f, -0.101837f, 0.099907f, -0.071151f, -0.071477f, 0.064970f, 0.060064f, -0.067828f, 0.063777f, 0.105781f, -0.082518f, 0.080758f, -0.071553f, 0.082351f, 0.074322f, -0.089226f, 0.062732f, 0.125703f, -0.121109f, -0.084776f, -0.109014f, -0.078653f, -0.118983f, -0.113215f, -0.103208f, 0.082947f, -0.124626f, 0.083062f, -0.095389f, -0.092598f, 0.114781f, 0.090797f, -0.109295f, -0.096693f, 0.081415f, -0.059188f, 0.079355f, 0.057211f, 0.076893f, -0.072265f, -0.082090f, -0.089846f, 0.074152f, 0.084353f, -0.066701f, -0.125011f, -0.070849f, 0.066420f, 0.074144f, 0.081608f, -0.111240f, 0.059284f, -0.060129f, -0.087293f, 0.073032f, -0.097241f, 0.078643f, -0.080054f, 0.111119f, 0.102854f, 0.084527f, 0.067698f, -0.149811f, -0.075890f, 0.162050f, 0.176137f, -0.133943f, 0.079471f, -0.101958f, -0.104364f, 0.140392f, -0.115620f, -0.094573f, -0.061507f, -0.064065f, 0.203848f, -0.150214f, -0.127877f, 0.299416f, 0.070467f, 0.098354f, -0.121910f, -0.134188f, -0.076812f, 0.086798f, -0.096763f, -0.100882f, 0.098873f, -0.071754f, 0.124388f, 0.103438f, -0.117886f, -0.111807f, 0.070861f, -0.382230f, 0.084228f, -0.070138f, -0.079925f, 0.075941f, 0.065632f, -0.139331f, -0.097195f, 0.067862f, -0.097062f, -0.081149f, -0.072380f, 0.084954f, 0.072019f, 0.084715f, -0.123611f, 0.097019f, -0.101744f, 0.106871f, -0.097839f, 0.061500f, 0.059298f, 0.053281f, 0.055834f, 0.103645f, 0.053293f, -0.076611f, 0.103721f, 0.126831f, 0.087048f, 0.134556f, 0.116418f, 0.069387f, -0.108425f, -0.082983f, -0.169535f, -0.350717f, 0.110856f, -0.079265f, -0.071365f, -0.131789f, -0.101443f, 0.180544f, 0.070665f, -0.091928f, -0.074159f, -0.102141f, -0.098059f, 0.094157f, 0.067019f, 0.066281f, 0.054984f, -0.101896f, -0.091442f, -0.097134f, 0.090299f, 0.107412f, 0.099716f, 0.062876f, 0.146164f, -0.063951f, 0.059319f, -0.059382f, 0.052831f, 0.088927f, 0.112622f, -0.084684f, 0.081789f, -0.120433f, 0.097323f, -0.156544f, 0.080301f, -0.067492f, -0.072262f, 0.106235f, 0.105055f, -0.101925f, -0.070518f, -0.102107f, -0.120863f, -0.073911f, 0.124768f, 0.055617f, 0.111917f, -0.113354f, 0.082498f, 0.059705f, 0.095272f, 0.124333f, 0.110582f, -0.101827f, 0.114754f, 0.114631f, -0.155830f, -0.091889f, 0.077584f, 0.161908f, 0.104826f, -0.156836f, -0.079847f, 0.069398f, 0.078508f, 0.077957f, 0.118738f, -0.084932f, 0.077213f, 0.080950f, 0.057530f, -0.122278f, -0.067771f, 0.079862f, -0.068379f, 0.187942f, 0.135958f, -0.133838f, -0.083831f, -0.060682f, -0.165494f, -0.058091f, -0.077407f, -0.069522f, 0.104479f, 0.073932f, -0.080895f, 0.072001f, 0.076651f, 0.066157f, 0.084523f, 0.115477f, -0.124879f, 0.102966f, 0.094769f, -0.085849f, 0.068596f, 0.063639f, 0.054113f, 0.087610f, 0.079810f, -0.136874f, 0.065584f, -0.060038f, -0.103464f, 0.069189f, 0.101148f, 0.067494f, -0.110306f, -0.056368f, -0.084565f, 0.113389f, 0.069523f, 0.089035f, -0.076717f, -0.070220f, 0.072475f, 0.069527f, -0.071529f, -0.131993f, 0.102294f, -0.069209f, -0.060711f, 0.155134f, -0.067025f, 0.062945f, 0.071013f, 0.114674f, -0.086050f, 0.104704f, -0.068494f, -0.088618f, -0.065696f, 0.081313f, -0.095560f, 0.074014f, -0.085533f, -0.103202f, 0.083864f, -0.094419f, 0.112724f, 0.063549f, -0.091947f, -0.074174f, 0.106984f, -0.068714f, 0.088169f, 0.080376f, -0.159321f, -0.098029f, 0.070368f, -0.081609f, 0.140099f, -0.117220f, -0.055416f, -0.201578f, 0.067586f, 0.154364f, -0.085179f, -0.117064f, -0.116624f, -0.097035f, -0.080105f, 0.111797f, 0.081182f, -0.114883f, 0.112740f, -0.054399f, 0.102612f, -0.093414f, -0.069550f, -0.060419f, -0.107140f, -0.081507f, 0.069677f, 0.206751f, 0.091780f, -0.113146f, 0.063500f, -0.093530f, 0.072388f, 0.170445f, 0.090470f, 0.083719f, 0.075128f, -0.114812f, -0.060998f, 0.102716f, -0.064362f, 0.102722f, -0.097427f, -0.105337f, 0.099416f, -0.093315f, 0.054178f, 0.091498f, -0.114035f, -0.116646f, 0.084888f, -0.087046f, -0.073796f, 0.069758f, 0.084125f, 0.118005f, -0.074620f, 0.093214f, -0.091375f, 0.067315f, -0.078070f, -0.069960f, -0.063970f, 0.131206f, 0.076450f, 0.069098f, -0.151162f, -0.060449f, -0.087246f, 0.137934f, -0.120172f, 0.057503f, 0.100012f, -0.107620f, 0.164588f, 0.084836f, -0.097338f, 0.132148f, -0.086902f, 0.072475f, -0.151094f, -0.055315f, 0.112880f, -0.064573f, 0.101346f, -0.059128f, 0.260409f, -0.121726f, -0.066549f, 0.087245f, 0.058389f, 0.074214f, 0.060643f, -0.133409f, -0.115582f, 0.063378f, -0.085358f, -0.104750f, -0.089892f, 0.161307f, 0.066995f, 0.423868f, -0.100486f, -0.089101f, -0.054305f, 0.086037f, -0.076380f, -0.060620f, -0.102572f, -0.103457f, -0.082099f, 0.082758f, 0.055260f, 0.066184f, -0.104730f, -0.068426f, -0.125851f, 0.097218f, -0.106657f, 0.063002f, -0.060253f, 0.073222f, -0.069381f, 0.087520f, -0.062109f, -0.097988f, 0.058806f, 0.075050f, -0.075882f, 0.130869f, 0.073139f, 0.181933f, -0.073321f, -0.072164f, 0.147752f, -0.060477f, 0.065863f, 0.058455f, -0.058846f, -0.132348f, -0.079900f, 0.075006f, -0.065142f, -0.062817f, -0.093187f, 0.058941f, -0.058191f, 0.142542f, -0.086356f, -0.120531f, -0.064954f, 0.104095f, -0.083719f, -0.097075f, 0.088905f, 0.121978f, -0.087354f, 0.189991f, -0.072322f, 0.059942f, -0.075229f, 0.107442f, -0.112962f, -0.102637f, -0.079426f, -0.064474f, -0.122851f, -0.315412f, 0.101126f, -0.092030f, -0.053090f, 0.076675f, 0.060740f, -0.069265f, 0.167911f, 0.137651f, -0.067344f, -0.149468f, -0.065324f, 0.052740f, 0.056721f, 0.086877f, -0.076331f, -0.066167f, 0.069152f, 0.111143f, 0.091099f, 0.058966f, -0.098746f, -0.083585f, -0.063886f, -0.123051f, -0.096759f, -0.052909f, -0.061389f, 0.146804f, -0.081981f, -0.160328f, -0.087309f, -0.072674f, 0.090748f, 0.058555f, -0.074151f, 0.069672f, 0.113644f, 0.074871f, 0.479790f, 0.067154f, 0.054758f, -0.056913f, -0.094350f, -0.080311f, -0.096884f, 0.116273f, 0.187656f, -0.059508f, 0.073077f, 0.118701f, -0.107125f, 0.100569f, -0.093344f, 0.087018f, 0.112030f, 0.111335f, 0.085960f, -0.108069f, -0.054211f, -0.079215f, -0.056650f, -0.053411f, 0.084874f, -0.103180f, -0.079047f, -0.070891f, 0.129980f, -0.063320f, -0.094247f, 0.107561f, -0.059314f, 0.105752f, -0.092699f, -0.138475f, -0.119302f, -0.058166f, -0.408455f, 0.090636f, 0.096783f, -0.123786f, -0.084863f, 0.160834f, 0.060198f, 0.071580f, -0.088384f, 0.101250f, -0.062491f, 0.071755f, -0.101186f, -0.093679f, -0.092178f, 0.119612f, 0.109266f, -0.123975f, -0.089652f, 0.056356f, -0.061456f, 0.065424f, -0.065538f, -0.066649f, -0.167669f, 0.076809f, 0.095532f, -0.082648f, 0.110178f, -0.086928f, 0.113284f, -0.067062f, -0.123089f, 0.122814f, -0.107188f, -0.073193f, 0.070997f, 0.090294f, 0.055879f, -0.198213f, -0.084070f, 0.065430f, -0.074852f, -0.058081f, 0.073184f, 0.081810f, 0.060567f, -0.075334f, -0.073087f, -0.118099f, -0.105666f, 0.092882f, 0.098460f, 0.092336f, 0.063275f, 0.062477f, -0.100735f, -0.072980f, 0.063111f, 0.064255f, 0.102100f, 0.082487f, 0.098128f, -0.053734f, 0.063496f, -0.113820f, -0.092138f, 0.082688f, -0.082018f, -0.070217f, 0.076642f, 0.079168f, 0.238287f, -0.081084f, 0.078584f, 0.101535f, 0.194408f, 0.063130f, 0.077156f, -0.170735f, -0.091422f, -0.137292f, -0.083626f, -0.128162f, -0.099408f, 0.131359f, -0.076893f, 0.191593f, -0.095408f, 0.176352f, 0.090946f, -0.087259f, 0.099894f, -0.127793f, 0.061217f, -0.078523f, 0.056128f, -0.064854f, -0.059639f, 0.085180f, 0.156396f, -0.071341f, -0.096283f, 0.064422f, -0.053584f, 0.065132f, -0.097784f, 0.091087f, -0.155488f, -0.102848f, -0.500045f, -0.069811f, 0.068914f, -0.061395f, -0.104973f, -0.081794f, 0.079229f, 0.071203f, 0.154804f, -0.147058f, 0.072904f, 0.062685f, 0.061137f, 0.080751f, -0.129213f, -0.071597f, 0.069703f, -0.084543f, -0.087898f, 0.073802f, 0.111328f, -0.072886f, 0.064873f, 0.086065f, 0.064531f, -0.063013f, -0.102714f, -0.071496f, -0.116776f, -0.059805f, 0.074095f, 0.078135f, -0.083663f, 0.061908f, 0.113964f, 0.071350f, 0.145878f, -0.081369f, 0.104468f, 0.094544f, -0.094861f, 0.096995f, -0.103091f, -0.133281f, 0.121951f, -0.096078f, -0.116016f, 0.156369f, -0.145412f, -0.081902f, -0.115976f, -0.102515f, -0.070959f, 0.058991f, -0.076022f, 0.082312f, -0.103071f, -0.113443f, -0.102155f, 0.064508f, 0.073208f, -0.058907f, 0.296813f, -0.114108f, 0.100126f, 0.111152f, -0.112048f, 0.111556f, 0.052590f, -0.103888f, 0.059478f, 0.089353f, 0.078971f, -0.066264f, 0.120291f, 0.106331f, 0.078495f, 0.099885f, 0.079727f, -0.094285f, 0.073222f, -0.063548f, -0.059366f, -0.105158f, 0.088316f, -0.073712f, -0.068250f, -0.075207f, 0.062237f, -0.085832f, 0.104365f, 0.100854f, 0.100100f, 0.085207f, -0.068973f, -0.101588f, 0.090423f, -0.069974f, 0.081554f, 0.097811f, 0.100391f, 0.057937f, 0.116981f, 0.105538f, -0.060727f, -0.095988f, -0.114366f, -0.119453f, -0.056909f, -0.089360f, 0.061990f, -0.132977f, 0.158425f, -0.058448f, -0.075337f, -0.079093f, -0.116290f, -0.058406f, 0.069058f, -0.130854f, 0.064000f, -0.085243f, 0.170296f, -0.108368f, 0.339208f, 0.098046f, -0.060430f, -0.083543f, 0.104271f, 0.076080f, 0.071354f, -0.082668f, -0.104175f, -0.123776f, -0.068590f, 0.064118f, 0.094292f, -0.064010f, -0.302244f, -0.102436f, 0.057915f, 0.186690f, 0.056815f, -0.089959f, -0.105835f, 0.082518f, -0.085264f, 0.111977f, -0.083039f, -0.090586f, -0.120907f, -0.063830f, -0.089090f, -0.096676f, -0.103319f, -0.059738f, -0.091202f, -0.053367f, -0.098486f, -0.062208f, 0.140348f, -0.111126f, -0.085508f, -0.104376f, -0.059619f, -0.087476f, -0.118647f, 0.119096f, 0.109150f, -0.096189f, 0.112948f, -0.146910f, -0.107128f, -0.092381f, -0.129386f, -0.059162f, 0.096653f, 0.127275f, 0.082893f, 0.137134f, -0.241338f, 0.191233f, 0.159486f, -0.112526f, 0.124554f, 0.112255f, 0.058697f, -0.085624f, -0.056735f, 0.076548f, -0.057111f, 0.082186f, 0.072614f, 0.089877f, -0.117324f, -0.154025f, -0.139700f, -0.108271f, -0.189429f, 0.095869f, -0.073028f, -0.077654f, -0.138012f, -0.087721f, -0.137414f, -0.124908f, -0.164232f, 0.053279f, 0.059330f, -0.131407f, -0.089238f, -0.114282f, 0.105670f, -0.097134f, -0.162807f, 0.070942f, -0.086595f, 0.071449f, 0.065115f, -0.124652f, -0.181933f, 0.086927f, 0.073891f, 0.064848f, 0.114600f, 0.088856f, -0.144406f, -0.158495f, -0.149786f, -0.057043f, -0.138600f, -0.074604f, 0.095643f, 0.076544f, 0.061134f, -0.108571f, -0.078185f, 0.081677f, -0.062730f, -0.069389f, 0.138353f, -0.144154f, 0.088860f, 0.112754f, -0.054693f, -0.091745f, -0.093763f, 0.137085f, -0.131265f, 0.243102f, 0.096304f, -0.117906f, 0.207277f, -0.061633f, -0.090519f, -0.177577f, 0.130391f, 0.066211f, 0.068742f, -0.058205f, 0.054875f, -0.058541f, 0.074566f, -0.061631f, 0.104277f, 0.075969f, -0.054012f, -0.096771f, 0.064809f, -0.088376f, 0.096960f, 0.102694f, 0.089570f, 0.088782f, 0.085431f, -0.122800f, 0.079855f, 0.084422f, 0.090268f, 0.083414f, -0.136446f, 0.062910f, 0.099039f, -0.066539f, 0.092443f, 0.170572f, -0.108708f, 0.073261f, 0.065983f, 0.060962f, -0.114109f, 0.068365f, -0.092100f, -0.086539f, 0.158442f, -0.089942f, 0.097156f, 0.077726f, -0.077935f, -0.090578f, 0.083712f, -0.062203f, -0.094796f, 0.157916f, -0.087604f, -0.069743f, 0.100979f, -0.091926f, -0.154697f, -0.189909f, 0.151597f, -0.127958f, 0.120218f, -0.055771f, -0.061785f, -0.060125f, 0.054430f, -0.087434f, 0.120538f, -0.061713f, -0.194291f, -0.085519f, -0.107201f, 0.077522f, 0.102578f, 0.103109f, -0.120014f, -0.084451f, -0.067800f, 0.109240f, -0.103774f, 0.106547f, 0.053578f, -0.078750f, 0.087683f, 0.069310f, -0.140312f, 0.101061f, -0.086147f, 0.088197f, -0.067358f, 0.089958f, -0.086319f, 0.106492f, -0.056269f, 0.116181f, 0.203608f, -0.104289f, 0.498860f, -0.071705f, 0.059474f, -0.095051f, 0.147976f, 0.062690f, 0.116337f, 0.075637f, -0.088004f, -0.099534f, -0.058033f, 0.086254f, 0.065576f, 0.103387f, 0.110024f, 0.076698f, -0.074780f, -0.094971f, 0.102652f, -0.078363f, -0.096781f, -0.080054f, 0.102185f, 0.095607f, 0.061757f, -0.096150f, 0.078282f, 0.057103f, -0.084001f, 0.075913f, 0.078135f, 0.145074f, -0.130339f, 0.361665f, 0.113075f, 0.078966f, -0.065580f, 0.111838f, -0.086138f, 0.082396f, -0.085513f, -0.061418f, -0.102444f, -0.097061f, 0.053271f, 0.085156f, -0.109788f, 0.167244f, -0.172781f, 0.098240f, 0.110885f, -0.062804f, 0.079589f, 0.111000f, -0.085821f, 0.141194f, 0.146303f, -0.104860f, -0.092800f, -0.085494f, -0.059750f, 0.055801f, -0.064353f, 0.066123f, -0.106553f, -0.302907f, -0.052544f, -0.095746f, -0.097343f, -0.073847f, 0.141177f, 0.156782f, 0.078669f, 0.056048f, 0.230596f, -0.083915f, -0.111848f, -0.075719f, 0.061331f, 0.106853f, 0.059445f, -0.072601f, -0.060661f, -0.122724f, -0.074920f, 0.068011f, -0.145644f, -0.055803f, -0.091983f, -0.074570f, 0.067401f, -0.065969f, -0.069955f, 0.117228f, -0.059958f, 0.095769f, 0.087467f, 0.058668f, 0.107401f, 0.078580f, -0.111808f, -0.129262f, 0.099591f, 0.167405f, 0.090643f, 0.146334f, -0.102531f, 0.235211f, 0.089949f, 0.256303f, -0.113578f, -0.430223f, 0.088337f, 0.148454f, -0.091583f, 0.165206f, 0.117090f, 0.094832f, 0.091764f, -0.063357f, 0.084301f, 0.054802f, 0.130801f, 0.055144f, 0.130238f, 0.142793f, -0.131418f, -0.152195f, 0.121531f, -0.204638f, -0.146868f, 0.071142f, 0.092525f, -0.078052f, 0.106210f, 0.162686f, -0.199770f, -0.057334f, 0.154162f, -0.070522f, 0.060026f, -0.111960f, -0.078081f, 0.096505f, 0.076429f, 0.131038f, -0.110636f, -0.156738f, 0.087916f, 0.079174f, 0.082454f, 0.106237f, -0.077217f, -0.082421f, -0.063420f, -0.093775f, 0.094558f, -0.100639f, -0.118443f, 0.131002f, -0.104001f, -0.063931f, -0.076730f, -0.057735f, -0.110773f, -0.066031f, 0.095405f, 0.122332f, 0.068347f, -0.063231f, -0.094860f, 0.129667f, 0.076019f, 0.066731f, 0.060574f, -0.124146f, -0.091558f, 0.070562f, 0.053173f, -0.307757f, 0.065945f, 0.084727f, -0.053843f, -0.074144f, -0.104396f, 0.076379f, 0.088000f, 0.144500f, -0.127275f, 0.058349f, -0.063818f, 0.088593f, -0.086746f, 0.100031f, -0.115253f, 0.069579f, -0.097320f, -0.125905f, -0.125603f, 0.088533f, -0.076146f, 0.096208f, 0.120472f, 0.099710f, -0.080391f, 0.103017f, -0.086728f, -0.107819f, 0.072911f, -0.072059f, -0.111474f, 0.054613f, -0.150079f, 0.068396f, -0.078631f, -0.089886f, -0.080716f, -0.161034f, -0.134610f, -0.248157f, 0.085724f, 0.217659f, 0.496087f, -0.086696f, 0.104115f, -0.100870f, -0.079745f, -0.188886f, -0.093024f, -0.071674f, 0.123455f, -0.104743f, 0.074106f, -0.059783f, -0.160576f, -0.056762f, 0.068049f, 0.089125f, 0.192798f, -0.092304f, 0.177576f, -0.088741f, 0.100031f, 0.080081f, -0.057296f, -0.088940f, 0.082158f, 0.098590f, -0.109748f, -0.103541f, -0.076692f, -0.060350f, 0.055835f, -0.062613f, -0.083523f, -0.076514f, -0.073099f, 0.073499f, 0.127485f, 0.194613f, -0.082352f, -0.100911f, 0.058788f, 0.092879f, -0.059640f, -0.063788f, 0.073904f, -0.087595f, 0.086040f, 0.066449f, 0.065482f, -0.060299f, -0.099753f, 0.083480f, -0.072585f, 0.059066f, 0.129737f, -0.104249f, -0.054695f, 0.073391f, 0.074933f, 0.105333f, -0.133980f, -0.098192f, -0.104901f, -0.058622f, -0.104254f, 0.076729f, -0.062610f, 0.141910f, 0.130002f, -0.120128f, 0.296105f, 0.106144f, -0.069400f, 0.098937f, -0.089165f, -0.113771f, -0.085117f, 0.118406f, -0.073508f, 0.083532f, -0.075826f, -0.078625f, -0.067418f, -0.053811f, 0.070457f, -0.077903f, 0.074154f, -0.059970f, 0.066819f, -0.061952f, -0.092482f, -0.143291f, 0.113284f, 0.131515f, 0.092691f, 0.104751f, -0.056144f, -0.136086f, -0.093083f, 0.107925f, -0.156624f, -0.130820f, -0.077955f, 0.064020f, -0.192769f, 0.080950f, -0.099762f, 0.061252f, 0.090192f, 0.106591f, 0.061425f, 0.076968f, 0.075404f, 0.063450f, -0.096337f, 0.079642f, 0.095398f, 0.103225f, -0.077403f, -0.107065f, -0.093667f, -0.077289f, -0.056821f, -0.084484f, -0.065999f, -0.065267f, 0.100777f, -0.093958f, -0.086456f, 0.070198f, 0.096558f, 0.184998f, 0.120107f, 0.083232f, 0.100457f, 0.069520f, 0.177453f, -0.053095f, 0.071643f, -0.097804f, -0.165863f, 0.087435f, -0.110036f, -0.082538f, 0.087526f, -0.128395f, 0.125105f, 0.089208f, 0.080043f, 0.103332f, 0.073817f, -0.086589f, -0.152121f, -0.093666f, -0.161475f, 0.054982f, 0.060766f, -0.083160f, 0.089844f, 0.085981f, 0.111719f, 0.070555f, 0.169950f, -0.069969f, -0.100782f, -0.068855f, 0.073917f, 0.069872f, 0.069333f, 0.114349f, 0.185731f, 0.093694f, 0.222036f, -0.066184f, 0.111306f, 0.074123f, 0.124677f, -0.068095f, 0.062726f, 0.152365f, 0.100308f, -0.115992f, -0.060337f, -0.057488f, -0.089026f, -0.067521f, -0.102736f, 0.092954f, -0.096149f, 0.123434f, -0.096932f, -0.075275f, -0.114797f, 0.059015f, -0.106677f, 0.095213f, 0.076338f, -0.068698f, 0.179972f, 0.053338f, -0.143196f, -0.098736f, -0.127854f, 0.135294f, -0.254647f, -0.206418f, 0.087624f, 0.104821f, -0.109158f, 0.083691f, -0.079477f, 0.139000f, 0.179773f, -0.061337f, 0.218809f, 0.127099f, -0.101702f, 0.065284f, 0.116223f, 0.122482f, 0.073640f, 0.092538f, 0.061603f, -0.072354f, 0.109094f, 0.094162f, 0.093005f, -0.082133f, 0.100736f, -0.092600f, -0.100118f, 0.323739f, 0.067867f, -0.085284f, -0.096233f, 0.082037f, 0.053200f, 0.091220f, 0.091974f, -0.059565f, 0.100496f, -0.083697f, 0.073206f, 0.103479f, 0.064524f, 0.079789f, 0.068222f, -0.056455f, 0.106712f, -0.067717f, 0.057004f, -0.111131f, -0.081665f, 0.072304f, -0.076613f, 0.056142f, 0.104912f, -0.130648f, 0.061742f, -0.082395f, -0.100434f, 0.101714f, 0.081292f, 0.073377f, 0.140154f, -0.059191f, -0.092954f, 0.296956f, 0.072277f, -0.061666f, -0.102590f, 0.082722f, -0.123910f, 0.059141f, -0.165576f, -0.073286f, -0.097893f, -0.093216f, -0.079452f, -0.125499f, 0.090113f, -0.110187f, 0.104105f, 0.067296f, -0.072493f, 0.063425f, 0.063246f, 0.071584f, -0.099966f, 0.074644f, -0.100385f, 0.078374f, 0.068569f, 0.084236f, -0.067215f, 0.061195f, 0.068402f, -0.115255f, 0.112655f, 0.082052f, -0.084201f, 0.399722f, 0.103509f, 0.070735f, -0.064721f, 0.117404f, -0.176901f, 0.066867f, 0.095808f, -0.125532f, 0.062195f, 0.149099f, -0.073088f, -0.066497f, 0.099829f, 0.092637f, 0.053220f, -0.071228f, -0.086916f, 0.161691f, -0.132967f, 0.081060f, 0.132876f, -0.207313f, 0.081872f, -0.059899f, 0.061501f, -0.067807f, -0.081699f, -0.068679f, -0.144257f, -0.065589f, 0.114816f, 0.117062f, 0.120762f, -0.063328f, 0.095637f, 0.098814f, -0.114255f, 0.076991f, -0.068660f, -0.101889f, -0.105203f, -0.091452f, -0.088400f, -0.151714f, 0.132350f, -0.059865f, -0.067986f, -0.103995f, -0.128128f, -0.141221f, 0.104739f, 0.205106f, -0.194950f, 0.070650f, -0.224395f, 0.092768f, -0.069362f, 0.293680f, 0.131420f, -0.069943f, 0.072521f, -0.073661f, 0.060134f, -0.074212f, 0.091814f, 0.073275f, 0.072710f, 0.073452f, 0.088283f, -0.052901f, 0.089527f, 0.081341f, -0.088915f, 0.055016f, 0.094689f, 0.110685f, 0.064101f, -0.181084f, 0.084067f, -0.094775f, 0.082914f, 0.067330f, 0.064043f, -0.078000f, 0.055478f, 0.125368f, -0.061255f, -0.063224f, 0.132954f, -0.071604f, -0.073394f, -0.070309f, -0.108993f, 0.078730f, 0.094374f, -0.055066f, 0.066791f, 0.112451f, -0.068804f, 0.073475f, -0.137411f, -0.052782f, 0.156731f, -0.068610f, 0.066660f, -0.088508f, -0.125693f, 0.091389f, 0.053629f, 0.061469f, 0.119582f, -0.142076f, 0.078542f, 0.067070f, -0.113031f, 0.114082f, 0.147530f, 0.059514f, -0.120090f, -0.086236f, 0.057932f, 0.098929f, 0.078224f, -0.163740f, -0.092505f, 0.097676f, 0.141030f, -0.097073f, -0.133111f, 0.067336f, -0.054247f, -0.063756f, -0.065514f, -0.075834f, -0.185873f, 0.070498f, 0.073287f, -0.093714f, 0.055895f, 0.113266f, -0.103222f, 0.089230f, -0.065920f, -0.084457f, -0.073267f, -0.066604f, 0.064620f, -0.093913f, 0.077874f, 0.084759f, -0.097037f, -0.104723f, -0.100098f, 0.079299f, -0.206265f, -0.060624f, -0.066375f, -0.083672f, -0.073442f, 0.146887f, 0.094965f, -0.088305f, 0.076788f, 0.127455f, 0.058544f, -0.089542f, 0.086965f, 0.111982f, -0.055155f, -0.081047f, -0.108920f, -0.099490f, 0.151932f, 0.076011f, -0.121820f, -0.065654f, -0.088015f, -0.105256f, -0.057132f, -0.108217f, -0.053530f, 0.065627f, -0.059242f, -0.085623f, -0.079825f, 0.079872f, 0.105015f, -0.101839f, 0.095524f, -0.091032f, -0.059736f, 0.095255f, -0.094230f, 0.107605f, -0.059147f, -0.077610f, 0.074464f, -0.073478f, -0.119011f, 0.056519f, -0.081236f, 0.124727f, -0.208713f, 0.113051f, -0.086606f, -0.080077f, -0.075614f, -0.120714f, -0.082687f, 0.096093f, -0.069254f, -0.091533f, 0.116576f, 0.074735f, 0.067847f, -0.062021f, 0.122775f, 0.187101f, 0.088894f, 0.080733f, 0.087719f, -0.119892f, -0.075330f, -0.101881f, -0.121004f, 0.114340f, 0.120934f, -0.092124f, -0.056157f, 0.099369f, 0.101886f, -0.104210f, 0.075795f, 0.066859f, 0.062111f, 0.144494f, 0.110678f, -0.071031f, -0.099969f, -0.155391f, 0.063569f, 0.081487f, -0.082577f, 0.089762f, 0.110330f, 0.103342f, 0.103444f, 0.100985f, -0.091343f, -0.070923f, 0.095310f, -0.107668f, 0.095936f, 0.087241f, 0.092885f, 0.104410f, -0.060135f, -0.095446f, -0.099973f, -0.058499f, -0.076123f, 0.061113f, -0.092479f, -0.208681f, -0.117646f, -0.106058f, 0.165633f, 0.062398f, 0.077895f, -0.053523f, -0.127277f, -0.083562f, -0.100986f, -0.152202f, -0.114620f, -0.087215f, -0.100893f, 0.066518f, -0.120338f, 0.080314f, -0.069517f, 0.063243f, 0.087537f, -0.126422f, 0.107091f, -0.057448f, 0.088960f, -0.078342f, 0.125597f, -0.087262f, -0.095404f, -0.059737f, -0.068527f, -0.094191f, 0.080507f, -0.094698f, 0.058115f, 0.063710f, -0.171072f, -0.105316f, 0.099356f, 0.083548f, -0.085372f, 0.073711f, -0.083504f, 0.076901f, 0.105676f, 0.066861f, 0.112667f, 0.070385f, 0.090192f, -0.102360f, 0.084800f, -0.073626f, 0.111306f, 0.053527f, 0.061297f, 0.087547f, -0.060871f, 0.073442f, -0.068456f, 0.079683f, -0.098398f, -0.075496f, 0.089792f, -0.102580f, -0.108854f, -0.114459f, -0.068335f, 0.076411f, 0.104962f, -0.073377f, -0.158796f, 0.179386f, 0.064780f, 0.169584f, 0.086262f, 0.077928f, -0.081274f, 0.114110f, -0.149015f, 0.121778f, 0.122272f, 0.101675f, -0.067589f, -0.125470f, -0.114533f, 0.094047f, 0.096243f, 0.094505f, -0.075278f, 0.079576f, 0.137978f, -0.196028f, -0.348481f, 0.071889f, 0.063156f, 0.058675f, 0.054123f, 0.122827f, 0.100254f, -0.145574f, -0.109646f, -0.053922f, 0.077970f, -0.115849f, -0.060580f, 0.072030f, -0.107188f, 0.083216f, 0.107505f, -0.065597f, 0.079492f, -0.075023f, -0.083226f, -0.455752f, 0.067783f, -0.086322f, -0.102281f, -0.209408f, -0.069890f, -0.074767f, -0.078634f, 0.087720f, 0.118416f, -0.058620f, -0.085480f, 0.068042f, -0.063946f, -0.064914f, -0.056666f, 0.097094f, 0.054895f, 0.072977f, 0.089935f, 0.069544f, -0.063152f, 0.103691f, -0.103279f, -0.074516f, 0.071018f, 0.103533f, 0.117918f, 0.079037f, 0.108567f, -0.115216f, 0.205542f, 0.102235f, -0.081742f, 0.078900f, 0.206606f, -0.087819f, -0.125003f, 0.123374f, 0.089692f, -0.086675f, -0.073947f, -0.102597f, -0.090117f, -0.079369f, -0.130823f, 0.079720f, -0.117930f, 0.094079f, 0.066407f, -0.067446f, 0.071811f, -0.069731f, -0.108100f, -0.082436f, 0.093213f, 0.142849f, -0.077629f, -0.066407f, -0.101038f, -0.191953f, 0.116838f, -0.427811f, -0.074004f, -0.058133f, -0.075624f, -0.097659f, 0.105493f, 0.107856f, -0.053432f, 0.079674f, -0.096269f, -0.087097f, 0.110287f, 0.089902f, -0.078828f, -0.096990f, -0.061926f, 0.095240f, -0.064415f, -0.070479f, -0.093225f, -0.114032f, 0.073639f, 0.058320f, -0.059398f, 0.122227f, 0.137800f, -0.061155f, 0.503989f, 0.074670f, 0.075187f, 0.101116f, 0.072267f, -0.112404f, -0.100532f, -0.105790f, 0.074586f, -0.120427f, 0.056456f, -0.094704f, 0.130527f, 0.091545f, 0.063357f, 0.086540f, -0.101873f, -0.060598f, -0.068653f, -0.091456f, -0.054262f, -0.070472f, 0.095329f, 0.056922f, 0.123693f, -0.101598f, -0.077348f, -0.068123f, 0.099456f, -0.093245f, -0.078161f, 0.159544f, 0.084699f, 0.116331f, -0.126007f, 0.100367f, -0.053839f, -0.415962f, 0.066410f, -0.108525f, 0.115102f, -0.092804f, 0.066877f, 0.059720f, 0.118222f, -0.237783f, 0.173957f, -0.289461f, -0.093125f, 0.116998f, 0.066802f, 0.088111f, -0.074174f, -0.106144f, 0.084525f, 0.159349f, -0.077582f, 0.095456f, -0.094041f, 0.089778f, 0.066403f, 0.102178f, -0.064615f, 0.080361f, -0.089063f, 0.061439f, 0.059620f, 0.138575f, 0.071826f, 0.082664f, -0.060765f, -0.053295f, 0.160711f, 0.117522f, -0.086856f, -0.144449f, 0.209181f, -0.085745f, 0.095616f, -0.126899f, -0.178538f, 0.086305f, -0.085523f, 0.141596f, -0.057329f, -0.097010f, -0.055180f, -0.061455f, 0.128943f, -0.061395f, -0.084607f, 0.105185f, -0.082641f, 0.099340f, -0.085297f, -0.060992f, -0.062757f, 0.083306f, 0.093651f, 0.455638f, -0.088687f, -0.103266f, -0.127821f, 0.100764f, 0.067283f, -0.133616f, -0.054978f, -0.053971f, -0.096881f, 0.104902f, -0.074902f, -0.078720f, -0.075961f, -0.055716f, 0.088472f, 0.083397f, 0.088743f, 0.065534f, -0.057530f, 0.093912f, 0.055740f, 0.061230f, 0.113633f, -0.068803f, -0.136056f, 0.093937f, -0.082873f, 0.069157f, 0.085157f, 0.083536f, 0.132692f, 0.109569f, 0.093450f, 0.230839f, 0.059219f, -0.085315f, 0.091399f, -0.069478f, 0.106841f, -0.055328f, 0.161002f, -0.105024f, 0.109753f, -0.067753f, -0.074525f, -0.098517f, -0.139726f, -0.106263f, 0.117048f, -0.081953f, -0.101907f, 0.096976f, -0.077016f, 0.060069f, 0.094325f, 0.077469f, 0.071230f, -0.078105f, -0.096892f, -0.126072f, -0.087408f, -0.102942f, 0.075157f, -0.067288f, -0.107223f, -0.115913f, 0.081907f, 0.072599f, 0.090325f, 0.269772f, 0.088512f, -0.082722f, -0.096168f, -0.094935f, -0.079275f, 0.077685f, 0.076028f, -0.175041f, -0.088144f, 0.072930f, 0.054495f, -0.126907f, 0.110072f, 0.070569f, 0.063491f, 0.164397f, -0.128542f, -0.103225f, -0.092275f, 0.075733f, 0.101565f, 0.071617f, -0.113623f, -0.077468f, 0.076688f, -0.115508f, 0.134185f, -0.120068f, 0.054215f, 0.103116f, -0.100783f, -0.058565f, -0.075010f, 0.107789f, -0.144779f, 0.272329f, 0.086431f, -0.104679f, 0.063631f, -0.095749f, -0.151215f, -0.091153f, -0.112789f, -0.081611f, -0.080173f, -0.076382f, 0.106107f, -0.065066f, 0.103130f, 0.076826f, 0.105886f, 0.086997f, -0.069638f, -0.082175f, 0.075978f, 0.093195f, -0.099040f, -0.088689f, 0.057207f, 0.107997f, 0.120199f, 0.160480f, 0.079086f, -0.082797f, -0.094122f, 0.112998f, 0.068339f, -0.097759f, 0.073688f, -0.293399f, -0.075365f, -0.059825f, 0.107626f, 0.110419f, 0.084942f, -0.111973f, 0.091824f, -0.112731f, 0.109387f, 0.131449f, 0.084620f, -0.063352f, -0.099324f, 0.092340f, 0.092201f, -0.072944f, 0.119496f, -0.103345f, -0.070934f, -0.097118f, 0.110944f, -0.102405f, 0.110446f, 0.063185f, 0.109002f, 0.065527f, -0.123742f, 0.087775f, 0.077148f, -0.076956f, 0.104493f, 0.102399f, 0.085149f, 0.084928f, 0.091164f, 0.092369f, -0.073377f, 0.054120f, -0.084749f, -0.125747f, -0.055567f, 0.087932f, -0.127335f, 0.115234f, -0.088912f, -0.059352f, -0.104004f, 0.069724f, -0.067608f, 0.112047f, -0.103492f, -0.059966f, 0.109541f, -0.087165f, -0.096588f, -0.077583f, -0.103442f, 0.100811f, 0.084081f, -0.059560f, -0.088386f, 0.073007f, -0.107624f, -0.055140f, 0.058921f, 0.139052f, -0.070889f, -0.062371f, -0.069370f, -0.096587f, -0.109914f, 0.095344f, -0.084043f, -0.092551f, 0.107278f, 0.512935f, 0.094411f, 0.078858f, 0.143673f, -0.070621f, -0.176517f, 0.075075f, 0.260267f, -0.103890f, -0.072307f, 0.076387f, -0.084920f, 0.110463f, -0.099221f, 0.086310f, -0.055144f, 0.093245f, -0.095406f, 0.092566f, -0.127098f, -0.060690f, -0.063475f, -0.059399f, -0.056201f, -0.068301f, 0.179220f, 0.098039f, -0.099892f, -0.104061f, 0.093665f, -0.057500f, -0.084361f, 0.109505f, -0.249823f, -0.083610f, -0.161588f, -0.075513f, 0.234462f, -0.085062f, -0.190196f, -0.120498f, -0.092257f, 0.113646f, -0.073795f, 0.105579f, -0.069689f, -0.104618f, 0.055891f, 0.112358f, 0.087320f, 0.122486f, -0.063853f, -0.061807f, -0.079840f, 0.060537f, -0.079102f, -0.110207f, -0.097289f, -0.090153f, 0.077907f, -0.108126f, 0.089923f, -0.111294f, -0.111712f, -0.065304f, -0.125448f, -0.076830f, 0.079624f, -0.075204f, -0.081556f, 0.070344f, -0.055135f, 0.177353f, -0.092463f, -0.079500f, -0.079204f, 0.085914f, 0.064557f, -0.079984f, 0.070669f, 0.105929f, -0.082526f, -0.062486f, 0.086660f, -0.081725f, -0.117192f, 0.122844f, 0.081758f, 0.101090f, 0.053753f, -0.069142f, 0.098328f, 0.058767f, -0.187919f, -0.082170f, 0.119819f, -0.107620f, 0.131306f, 0.093938f, -0.085245f, 0.129948f, -0.071312f, -0.116049f, -0.081874f, 0.088728f, 0.055552f, -0.066458f, -0.079967f, 0.080692f, 0.093298f, -0.072377f, 0.057551f, 0.098238f, -0.075693f, 0.055832f, 0.080212f, 0.121444f, 0.120865f, -0.062686f, -0.108102f, 0.089281f, 0.231037f, 0.055840f, 0.091597f, 0.165615f, 0.079845f, -0.123641f, 0.086404f, -0.083260f, -0.075023f, -0.068510f, 0.126401f, 0.083001f, -0.091420f, 0.066064f, -0.072473f, -0.087187f, -0.074600f, 0.115284f, 0.093785f, -0.087608f, 0.067043f, 0.061903f, 0.091892f, 0.072684f, -0.222057f, 0.073967f, -0.063163f, -0.057663f, 0.096817f, 0.087983f, 0.111770f, 0.081066f, 0.114667f, -0.086122f, 0.088218f, 0.058859f, 0.079454f, -0.082147f, 0.062003f, -0.053935f, 0.110137f, 0.056471f, 0.086374f, -0.135034f, 0.084224f, -0.102407f, 0.101589f, -0.114289f, -0.120548f, 0.085037f, 0.076558f, 0.088885f, 0.074672f, 0.107169f, 0.112718f, -0.088185f, -0.107581f, 0.069687f, 0.085824f, 0.103135f, 0.075946f, 0.089994f, 0.147401f, 0.073958f, 0.097320f, -0.093512f, 0.094914f, 0.096032f, -0.074071f, -0.074562f, 0.097352f, -0.072687f, 0.077881f, 0.078136f, 0.054934f, -0.065236f, -0.060721f, 0.103246f, -0.088542f, 0.079208f, 0.096790f, 0.054497f, 0.066795f, 0.110494f, 0.084610f, -0.075981f, -0.080033f, 0.076106f, -0.097487f, -0.063767f, 0.055872f, 0.071573f, 0.105474f, 0.102689f, -0.074219f, 0.087793f, -0.061161f, 0.071578f, 0.082000f, -0.069763f, -0.087709f, -0.084761f, 0.108189f, 0.072894f, -0.066074f, 0.167017f, -0.090207f, -0.094845f, 0.085994f, -0.075525f, 0.072942f, 0.088960f, -0.167009f, -0.062431f, -0.228527f, -0.143067f, 0.056354f, 0.075453f, 0.132519f, -0.053422f, 0.082427f, -0.057802f, -0.097496f, -0.172588f, -0.099831f, 0.120885f, -0.074364f, -0.111053f, -0.106766f, -0.089293f, -0.080225f, 0.097804f, -0.071170f, -0.109236f, -0.121066f, 0.098292f, 0.099429f, -0.100721f, 0.158798f, -0.087663f, 0.216418f, 0.060077f, -0.128383f, -0.093823f, -0.074473f, 0.061946f, 0.095975f, -0.069935f, 0.078727f, 0.095750f, 0.052890f, 0.116752f, 0.055891f, 0.057992f, -0.211774f, -0.253340f, -0.222336f, 0.106301f, 0.171802f, -0.077808f, 0.134206f, -0.087449f, -0.085708f, 0.064818f, -0.145515f, -0.129791f, -0.147054f, 0.090669f, 0.064184f, 0.096522f, 0.072611f, -0.070066f, -0.107612f, 0.083154f, 0.092857f, 0.059648f, 0.247684f, -0.133096f, -0.061869f, 0.061421f, 0.076700f, -0.104516f, 0.057050f, 0.097586f, -0.065480f, 0.100195f, 0.090126f, -0.052887f, -0.054073f, 0.101877f, 0.059187f, 0.102828f, -0.071095f, 0.089892f, -0.084999f, 0.242215f, 0.130966f, 0.063073f, 0.074526f, 0.061843f, -0.097263f, 0.062494f, 0.072899f, -0.100735f, -0.073048f, 0.116339f, -0.067511f, 0.111596f, -0.095365f, -0.157678f, 0.075789f, -0.176170f, 0.136735f, -0.152706f, -0.137866f, 0.057803f, -0.108343f, -0.128853f, 0.085546f, 0.120341f, -0.118890f, 0.096421f, 0.101357f, 0.114927f, 0.111000f, -0.133536f, 0.108855f, -0.086808f, 0.114925f, 0.070400f, -0.098575f, 0.155755f, 0.060708f, -0.093636f, -0.072929f, -0.081859f, 0.097058f, 0.116828f, 0.147439f, 0.115126f, -0.112014f, -0.088495f, -0.078340f, -0.071066f, 0.112768f, 0.075656f, -0.145973f, 0.095504f, 0.136777f, 0.178777f, -0.089986f, 0.109923f, 0.059497f, -0.105459f, -0.132261f, -0.057012f, -0.114974f, -0.075888f, 0.060467f, 0.158111f, -0.101419f, 0.091515f, 0.064812f, 0.102637f, -0.106538f, -0.151333f, -0.092540f, -0.261488f, -0.144861f, -0.111289f, 0.143546f, -0.126202f, 0.067349f, 0.112847f, -0.059859f, 0.072651f, 0.111801f, -0.128415f, -0.096281f, -0.157855f, -0.088764f, 0.100878f, 0.080940f, 0.129195f, -0.054388f, 0.053649f, -0.085428f, -0.060069f, -0.098578f, -0.162104f, -0.180507f, -0.109111f, -0.329059f, 0.061508f, 0.110864f, -0.083753f, 0.059012f, -0.058115f, 0.102109f, -0.114386f, -0.072577f, -0.220941f, -0.087116f, 0.069663f, 0.094013f, -0.071128f, 0.097789f, -0.055461f, 0.115944f, 0.065909f, -0.087396f, -0.127491f, -0.093027f, -0.085228f, -0.092546f, -0.061096f, 0.087323f, -0.102469f, 0.096743f, 0.080135f, -0.083669f, 0.070444f, -0.060313f, 0.057653f, 0.156726f, 0.075368f, -0.090314f, -0.071984f, -0.057029f, -0.077499f, 0.097539f, 0.055470f, -0.121564f, -0.054229f, 0.115639f, -0.391201f, 0.108182f, -0.076600f, 0.071939f, 0.085592f, 0.084944f, -0.191041f, -0.072788f, 0.057347f, 0.102846f, 0.096260f, 0.116224f, -0.108483f, 0.089720f, 0.082414f, 0.057333f, 0.112497f, -0.118152f, -0.071221f, -0.107782f, 0.101126f, 0.054829f, 0.084472f, 0.091262f, 0.074410f, -0.073949f, -0.054539f, -0.112820f, 0.066124f, 0.054899f, 0.163969f, 0.146043f, 0.161241f, -0.151810f, 0.076492f, 0.082306f, -0.059906f, -0.117140f, -0.076818f, -0.180155f, 0.119425f, 0.128908f, -0.087174f, 0.055863f, -0.114632f, 0.087843f, 0.060662f, 0.133491f, 0.062032f, -0.067370f, 0.093031f, 0.060889f, 0.110696f, -0.092657f, 0.127269f, -0.070018f, -0.055720f, -0.080449f, -0.127096f, -0.082103f, 0.091679f, 0.072983f, 0.098673f, 0.075701f, -0.094400f, 0.123079f, -0.175220f, 0.088378f, 0.091444f, 0.100309f, 0.115788f, -0.130006f, -0.067935f, 0.133352f, -0.065288f, -0.094161f, -0.061536f, 0.083242f, -0.080596f, -0.117953f, -0.062896f, 0.122579f, 0.334836f, -0.075157f, 0.145956f, 0.096033f, 0.099893f, -0.122269f, -0.060129f, 0.105790f, -0.149153f, -0.076099f, 0.073866f, -0.069507f, 0.072907f, 0.199542f, 0.203071f, 0.059536f, -0.191068f, 0.120148f, 0.090656f, 0.099489f, 0.086862f, -0.086001f, 0.069524f, 0.063096f, -0.075296f, -0.094962f, -0.071513f, 0.134319f, 0.073064f, -0.102305f, -0.077074f, -0.182409f, 0.121045f, -0.085137f, -0.151259f, -0.065169f, 0.063244f, 0.125044f, -0.334601f, -0.091261f, -0.118267f, -0.107796f, -0.070921f, -0.094708f, -0.065721f, 0.124792f, 0.066008f, 0.070415f, 0.115640f, 0.087428f, 0.119799f, 0.058508f, 0.090444f, 0.064509f, -0.084168f, 0.064672f, 0.096778f, -0.137485f, 0.079546f, -0.066894f, -0.081395f, -0.072749f, 0.062180f, 0.091619f, 0.126381f, 0.087288f, -0.093807f, -0.109724f, 0.110698f, 0.066491f, -0.098332f, 0.070334f, 0.121340f, -0.099680f, 0.070839f, 0.094491f, -0.107671f, -0.075478f, -0.066838f, -0.119589f, 0.065304f, 0.077141f, 0.064629f, -0.073315f, 0.071839f, 0.099365f, 0.070986f, -0.125698f, -0.057436f, -0.130033f, -0.098629f, -0.106187f, 0.080094f, 0.112091f, 0.101985f, -0.061038f, -0.077951f, 0.096975f, -0.064412f, -0.096610f, -0.433274f, 0.072983f, -0.056998f, 0.072682f, -0.075574f, -0.054236f, 0.092046f, -0.074312f, -0.102839f, -0.084088f, -0.065555f, -0.101321f, -0.094500f, 0.064760f, 0.082860f, 0.092125f, 0.102348f, -0.109677f, 0.096288f, -0.105382f, 0.075561f, -0.064850f, 0.119179f, 0.069332f, -0.127494f, -0.056654f, -0.078703f, 0.093719f, -0.116215f, -0.105658f, -0.077890f, -0.091513f, -0.232690f, 0.071233f, -0.120624f, -0.088946f, 0.092084f, 0.078363f, 0.114252f, 0.069319f, -0.093797f, 0.110670f, -0.062004f, -0.115981f, -0.118694f, 0.071681f, 0.065281f, 0.098035f, 0.086682f, 0.129090f, -0.113226f, 0.112698f, -0.093901f, -0.096096f, -0.100078f, 0.065813f, -0.053731f, 0.072524f, -0.073351f, -0.081490f, 0.066938f, -0.062060f, 0.064551f, 0.175887f, 0.407101f, -0.111032f, -0.072357f, -0.102554f, 0.106491f, 0.131646f, 0.087981f, -0.095234f, 0.096337f, 0.062763f, -0.059704f, 0.077599f, 0.071766f, 0.059550f, -0.082420f, -0.071851f, 0.124257f, -0.059030f, -0.060639f, 0.053239f, 0.075645f, 0.101162f, -0.097054f, 0.117757f, 0.057702f, -0.083268f, -0.108029f, 0.055544f, 0.074215f, 0.068456f, -0.097628f, 0.107953f, 0.080120f, 0.054192f, -0.101628f, -0.240749f, 0.083289f, -0.100648f, 0.196706f, 0.093540f, -0.215825f, -0.067412f, 0.062704f, -0.084895f, 0.090597f, 0.079444f, -0.139619f, -0.099881f, -0.065800f, 0.083161f, -0.084341f, -0.069815f, -0.082664f, 0.084236f, 0.093980f, -0.111788f, -0.059765f, -0.074041f, 0.085279f, -0.102842f, 0.071216f, 0.097137f, 0.113403f, -0.085224f, 0.067058f, 0.088256f, -0.069255f, -0.064667f, -0.162336f, 0.083762f, -0.082590f, 0.075849f, 0.105363f, -0.112639f, 0.062476f, 0.088517f, 0.185524f, -0.083053f, -0.193167f, -0.151268f, -0.088277f, 0.064543f, 0.071325f, -0.060638f, 0.098118f, -0.109349f, -0.061018f, 0.066766f, -0.110214f, 0.060758f, -0.078296f, 0.091257f, -0.068126f, -0.074138f, -0.075805f, -0.095800f, -0.115001f, 0.086848f, 0.089822f, 0.106349f, 0.068662f, -0.138140f, -0.076795f, -0.053793f, -0.087296f, -0.115798f, 0.109247f, 0.073599f, -0.101990f, 0.103824f, 0.284346f, -0.121191f, 0.190034f, -0.074813f, -0.077079f, -0.164988f, -0.097165f, -0.060426f, -0.081619f, 0.130461f, -0.054498f, 0.062840f, -0.062740f, -0.064611f, -0.071119f, 0.091233f, -0.106988f, 0.084178f, 0.160861f, -0.061619f, -0.116298f, -0.069775f, 0.053145f, -0.075060f, 0.092275f, 0.075683f, 0.064432f, 0.064249f, -0.073108f, -0.084053f, -0.094629f, -0.091405f, 0.144076f, -0.411389f, -0.068028f, -0.076289f, -0.093449f, -0.134506f, 0.071002f, 0.098412f, 0.087154f, -0.112107f, 0.066956f, -0.122035f, -0.077805f, -0.078188f, 0.072920f, -0.058752f, -0.115781f, -0.126786f, -0.098586f, 0.060222f, 0.096879f, -0.070594f, -0.069403f, 0.065588f, -0.111507f, -0.054388f, 0.094724f, -0.054741f, 0.104858f, -0.096947f, -0.061008f, -0.111570f, -0.069025f, -0.103785f, 0.093171f, -0.104954f, 0.102097f, -0.265285f, 0.131972f, -0.123966f, -0.098442f, 0.055314f, 0.140323f, 0.083516f, 0.081511f, -0.110274f, 0.066102f, -0.088640f, -0.103087f, 0.067824f, 0.070205f, -0.055676f, 0.074535f, 0.141192f, -0.112371f, -0.083514f, 0.123564f, 0.071180f, -0.100227f, 0.053249f, -0.065903f, 0.098852f, -0.111506f, -0.076796f, -0.078313f, -0.068379f, -0.091682f, 0.065034f, -0.143842f, 0.072049f, 0.086582f, -0.053609f, -0.062500f, 0.118473f, 0.067322f, 0.069535f, -0.101665f, 0.126352f, -0.060581f, 0.072325f, 0.055201f, -0.061133f, 0.068044f, -0.061610f, -0.055905f, 0.074664f, -0.120769f, 0.097266f, 0.097862f, -0.100211f, -0.105264f, 0.086204f, -0.054618f, -0.066027f, 0.057027f, -0.088728f, 0.077707f, -0.102246f, 0.080425f, -0.136274f, 0.068054f, -0.081509f, -0.092378f, -0.178192f, -0.204606f, -0.301211f, -0.059201f, 0.066008f, 0.067291f, 0.059077f, -0.168641f, 0.054051f, -0.098965f, 0.066435f, -0.095304f, 0.068002f, -0.100855f, -0.056529f, -0.102533f, -0.120566f, 0.173047f, 0.072981f, 0.067465f, 0.205088f, -0.054917f, -0.059836f, -0.063810f, 0.080171f, -0.068591f, 0.125512f, -0.131198f, -0.156005f, 0.125569f, 0.114195f, -0.066994f, 0.092365f, -0.070451f, -0.100407f, -0.053360f, -0.065485f, 0.077787f, 0.119471f, -0.083565f, -0.105006f, 0.106087f, -0.084415f, 0.077150f, -0.243675f, -0.147714f, 0.178239f, 0.120697f, -0.087784f, 0.076976f, 0.081272f, -0.065560f, -0.063086f, 0.105486f, -0.101457f, -0.061856f, 0.058819f, -0.123281f, 0.112076f, 0.056189f, -0.083581f, -0.078774f, 0.061346f, 0.066325f, -0.138619f, 0.122294f, -0.065241f, 0.119105f, 0.060145f, -0.087196f, -0.080661f, 0.126436f, 0.055587f, -0.060412f, -0.381451f, 0.112327f, -0.107160f, -0.276463f, 0.065535f, 0.072343f, 0.086984f, -0.076986f, -0.098580f, -0.080131f, -0.056964f, -0.101429f, -0.109354f, -0.085195f, -0.076041f, -0.109797f, 0.121302f, -0.100393f, -0.070796f, -0.077327f, -0.077111f, 0.099319f, 0.106929f, -0.100773f, 0.100061f, -0.117481f, 0.065090f, -0.108916f, 0.111482f, -0.092217f, 0.066577f, -0.177645f, -0.081697f, 0.074455f, 0.067935f, 0.097218f, 0.117096f, 0.091922f, -0.176032f, -0.097151f, 0.111110f, 0.075270f, -0.135988f, 0.207044f, -0.169904f, 0.090244f, -0.260015f, 0.187272f, -0.112911f, -0.114023f, 0.093341f, -0.100452f, -0.098763f, -0.060076f, 0.168602f, 0.101612f, -0.089470f, -0.154190f, 0.086460f, -0.068180f, -0.068368f, 0.073096f, 0.129673f, -0.082658f, 0.064626f, 0.155117f, -0.138873f, -0.081071f, -0.172855f, 0.057591f, 0.080417f, -0.071699f, 0.117761f, -0.099194f, 0.110209f, -0.089435f, 0.077290f, -0.091887f, -0.057011f, 0.120274f, -0.083029f, -0.075551f, -0.082696f, 0.134598f, 0.060107f, -0.132177f, 0.096324f, 0.084456f, 0.136403f, 0.185561f, -0.065629f, 0.156118f, 0.065176f, -0.079495f, -0.075625f, 0.053061f, 0.080111f, 0.072286f, -0.058829f, 0.079729f, -0.059385f, -0.069949f, 0.069842f, 0.087107f, -0.189469f, -0.278437f, -0.071255f, 0.067854f, 0.375957f, -0.095644f, 0.101901f, -0.095782f, 0.076888f, -0.213275f, -0.120608f, -0.136429f, 0.123418f, -0.062361f, -0.113128f, -0.076056f, -0.055477f, 0.053348f, 0.065092f, -0.086328f, 0.052683f, 0.141377f, -0.170436f, 0.193091f, -0.091257f, 0.063060f, -0.063785f, -0.055418f, -0.132006f, -0.083612f, -0.062536f, 0.077104f, 0.060016f, -0.098559f, -0.062870f, 0.055886f, 0.111742f, -0.068799f, -0.081311f, 0.072448f, 0.058460f, 0.064975f, -0.093187f, 0.074688f, -0.102726f, 0.057942f, -0.081789f, 0.168460f, -0.062274f, 0.088462f, -0.063078f, -0.059248f, 0.133464f, -0.076445f, -0.122664f, 0.101245f, 0.075701f, -0.056804f, -0.090966f, 0.080345f, -0.090768f, 0.095867f, 0.104047f, -0.101417f, 0.084395f, 0.095812f, 0.067878f, -0.105970f, 0.088507f, 0.054624f, -0.116111f, 0.103278f, -0.077612f, -0.118483f, -0.054997f, -0.097319f, -0.127118f, -0.164165f, -0.544108f, -0.107740f, -0.092996f, 0.091672f, -0.054385f, -0.169953f, -0.089967f, 0.100330f, 0.112266f, -0.068628f, 0.112082f, -0.106933f, 0.075405f, -0.065735f, -0.057987f, -0.075209f, 0.077556f, 0.105184f, -0.065937f, 0.053703f, 0.086471f, 0.061743f, -0.087225f, -0.111169f, 0.117690f, 0.084071f, -0.114875f, -0.057677f, -0.107685f, 0.067724f, 0.074175f, 0.066767f, 0.197979f, -0.053159f, 0.102123f, -0.100547f, 0.119960f, 0.071932f, 0.100617f, 0.108083f, -0.194194f, -0.063840f, 0.081200f, 0.059910f, 0.073832f, 0.072480f, -0.075002f, 0.085863f, 0.131101f, -0.079779f, -0.192213f, -0.077123f, -0.060603f, -0.095175f, 0.098944f, -0.127445f, 0.064354f, -0.075539f, -0.100006f, 0.084548f, 0.102499f, -0.124509f, -0.080202f, -0.054070f, 0.103256f, -0.060207f, 0.126456f, 0.098523f, -0.085243f, -0.055532f, 0.072448f, 0.133497f, -0.107725f, -0.094513f, 0.082256f, 0.181085f, 0.129379f, -0.102255f, 0.062654f, 0.087488f, -0.090580f, -0.055722f, -0.115203f, -0.103015f, -0.062520f, -0.155202f, 0.108749f, 0.088183f, -0.066744f, -0.063293f, -0.098596f, 0.061955f, -0.102834f, -0.071281f, 0.079508f, 0.086641f, 0.094221f, 0.074112f, 0.253158f, 0.089756f, 0.112486f, 0.124962f, -0.090202f, -0.122109f, 0.106066f, -0.086177f, -0.124814f, 0.091198f, -0.102379f, 0.120825f, -0.055518f, -0.062716f, 0.074861f, -0.077008f, 0.109910f, 0.090875f, 0.075181f, -0.084588f, 0.055215f, 0.073129f, 0.084758f, -0.083154f, 0.087737f, 0.112978f, 0.098294f, -0.083055f, -0.096517f, -0.108940f, -0.074639f, 0.062226f, 0.097429f, -0.061705f, 0.071823f, -0.103608f, 0.075482f, 0.054303f, -0.092072f, 0.088245f, 0.123458f, -0.087137f, -0.064542f, -0.094317f, -0.076362f, 0.060506f, -0.097702f, 0.094357f, -0.060064f, 0.073021f, 0.108215f, -0.091530f, 0.097519f, 0.113068f, 0.081256f, -0.091354f, 0.096105f, 0.072525f, -0.097593f, 0.089357f, 0.080966f, -0.111008f, -0.094727f, -0.088234f, -0.068827f, -0.053570f, 0.077928f, -0.065119f, -0.062267f, -0.080932f, 0.072371f, 0.089033f, 0.055924f, 0.073319f, 0.086492f, 0.159688f, 0.441366f, -0.096161f, 0.100835f, 0.101284f, -0.059007f, 0.057370f, -0.129842f, 0.060454f, 0.101067f, -0.052880f, -0.092350f, -0.077795f, -0.086021f, 0.075732f, 0.088592f, -0.063534f, -0.088674f, -0.083918f, 0.067043f, 0.064215f, 0.065471f, -0.107387f, 0.067337f, 0.101101f, -0.132061f, 0.116589f, 0.094259f, 0.167352f, 0.094294f, 0.083843f, 0.067616f, 0.059028f, -0.131607f, -0.099250f, 0.306123f, 0.058341f, -0.138114f, -0.053434f, -0.099444f, -0.058343f, -0.074997f, -0.125246f, 0.129889f, 0.053988f, -0.150260f, 0.065174f, -0.088899f, 0.099535f, 0.081156f, -0.209425f, -0.152022f, 0.074916f, 0.073264f, 0.092191f, 0.097684f, 0.124113f, -0.099357f, 0.145566f, -0.141987f, 0.104663f, 0.092512f, -0.076872f, -0.097844f, -0.096197f, -0.070882f, 0.120534f, -0.070989f, -0.110979f, 0.075481f, -0.063943f, 0.103275f, 0.188919f, 0.083098f, 0.110011f, -0.147183f, -0.100971f, 0.068514f, 0.068909f, -0.081034f, -0.115952f, 0.108713f, -0.082702f, -0.070469f, -0.102943f, 0.092657f, -0.061953f, -0.083580f, -0.092943f, -0.073524f, 0.066416f, -0.071339f, 0.064302f, -0.054411f, -0.066867f, -0.131321f, 0.148324f, 0.061416f, -0.092170f, 0.111008f, 0.133108f, 0.133789f, 0.098546f, 0.112857f, -0.095302f, 0.132460f, 0.297396f, -0.094404f, 0.217654f, 0.119274f, 0.067295f, -0.191921f, -0.238448f, -0.073348f, 0.087061f, -0.056363f, -0.100674f, 0.093843f, 0.060155f, 0.100255f, -0.112938f, 0.058361f, 0.113481f, 0.065246f, -0.062086f, -0.149895f, -0.072545f, -0.068052f, -0.102209f, 0.091377f, 0.093271f, -0.092589f, 0.075369f, 0.082509f, -0.091611f, -0.073441f, 0.084388f, 0.058371f, 0.104676f, 0.052885f, -0.088369f, 0.081876f, 0.071034f, 0.052909f, 0.072696f, -0.094343f, -0.090642f, -0.142887f, -0.061324f, -0.127290f, 0.187863f, -0.103493f, 0.113524f, 0.065883f, -0.053867f, 0.084068f, -0.119308f, 0.077750f, -0.108662f, -0.119828f, -0.106196f, -0.069056f, 0.071711f, -0.057270f, -0.079123f, -0.065545f, -0.059416f, -0.095314f, 0.071268f, -0.069222f, 0.097211f, -0.086848f, 0.112991f, 0.082898f, -0.118118f, -0.061630f, -0.079624f, 0.056013f, 0.148132f, -0.136031f, -0.085597f, -0.098193f, 0.066756f, 0.214185f, -0.099617f, 0.088054f, -0.103585f, -0.116571f, 0.130111f, -0.102005f, 0.097114f, -0.089121f, 0.058050f, -0.087328f, -0.111134f, 0.075270f, 0.085368f, -0.053756f, -0.086692f, 0.090253f, 0.085684f, -0.067016f, -0.104257f, -0.095671f, 0.101707f, -0.113334f, -0.136134f, -0.169066f, -0.087510f, -0.054298f, -0.079615f, -0.111475f, -0.087357f, -0.103492f, -0.103705f, 0.055234f, 0.055586f, 0.088004f, 0.095641f, 0.129181f, 0.060073f, 0.068771f, -0.106993f, -0.098239f, 0.084559f, -0.085991f, -0.114242f, 0.116852f, 0.083762f, 0.130557f, 0.087009f, 0.086623f, 0.124466f, -0.077528f, -0.075075f, -0.100599f, -0.057855f, 0.077801f, -0.072996f, -0.057477f, 0.085463f, -0.080860f, -0.314912f, 0.067473f, -0.078446f, -0.084157f, -0.091264f, 0.089749f, 0.098085f, 0.102215f, 0.073200f, 0.102161f, -0.057623f, 0.097287f, 0.055570f, -0.054840f, -0.061334f, -0.059553f, -0.118121f, -0.119112f, -0.118911f, -0.155364f, 0.055649f, -0.061895f, 0.069482f, -0.121111f, -0.084967f, 0.123742f, 0.080672f, -0.089068f, 0.098244f, -0.113996f, 0.071479f, 0.098464f, -0.097943f, 0.075756f, -0.089047f, -0.077237f, 0.057115f, 0.072776f, 0.093451f, -0.132346f, 0.285717f, 0.108535f, -0.104509f, -0.059032f, 0.067998f, 0.147603f, 0.092101f, -0.106277f, 0.089124f, 0.092990f, 0.085183f, -0.064445f, 0.089374f, -0.117460f, 0.061018f, -0.091356f, -0.147251f, 0.071322f, 0.062880f, 0.058919f, -0.063426f, 0.066327f, -0.058773f, 0.058404f, 0.092248f, 0.139005f, 0.153494f, 0.304625f, -0.086813f, -0.054150f, -0.099148f, -0.219813f, 0.059623f, 0.072754f, -0.075300f, 0.061015f, -0.063476f, 0.060003f, -0.054331f, 0.074289f, 0.128722f, -0.097430f, 0.067770f, 0.069752f, -0.084014f, -0.099251f, 0.066995f, -0.089045f, -0.084776f, -0.090345f, -0.062984f, 0.062530f, -0.087263f, 0.122188f, -0.092824f, 0.073183f, -0.071851f, 0.074927f, -0.085586f, -0.112053f, -0.161001f, -0.092147f, -0.425554f, 0.064267f, -0.133688f, 0.067235f, 0.059921f, -0.059068f, -0.073115f, -0.073531f, 0.113053f, -0.054730f, -0.093372f, 0.073039f, -0.067243f, 0.098851f, 0.081520f, 0.093484f, -0.063865f, 0.084381f, 0.087516f, 0.125362f, 0.070549f, -0.100127f, -0.084819f, 0.071539f, 0.071392f, -0.056922f, -0.062149f, -0.104058f, -0.093734f, -0.103991f, 0.073068f, 0.094587f, -0.060275f, -0.083478f, 0.068640f, 0.064789f, 0.076111f, -0.054664f, -0.109573f, -0.069424f, -0.078798f, 0.053263f, 0.175390f, 0.105148f, 0.106347f, 0.087907f, 0.129484f, -0.095085f, 0.078689f, -0.092862f, 0.067965f, -0.072146f, -0.067427f, -0.060122f, 0.089946f, 0.067584f, 0.085202f, 0.068464f, -0.105162f, -0.105478f, 0.127839f, -0.053791f, 0.062209f, -0.073696f, -0.125543f, 0.148713f, 0.108015f, -0.102712f, -0.056815f, 0.133492f, 0.068934f, 0.120207f, -0.092383f, -0.092860f, 0.248444f, -0.221754f, 0.139048f, -0.086705f, 0.105192f, 0.099596f, -0.091596f, 0.090613f, -0.063082f, 0.068153f, 0.075672f, 0.075565f, 0.066262f, 0.063767f, 0.096073f, -0.067611f, -0.068397f, -0.103112f, 0.063336f, -0.065298f, 0.129709f, -0.143031f, 0.060051f, 0.093182f, -0.100812f, 0.057886f, -0.076982f, -0.078393f, -0.107956f, -0.150450f, -0.102836f, 0.058521f, 0.085172f, -0.100066f, -0.119763f, -0.056016f, 0.087467f, -0.384107f, -0.100285f, -0.056423f, -0.057293f, 0.089948f, 0.084177f, 0.055528f, 0.059433f, 0.094368f, 0.088196f, 0.085858f, 0.062112f, -0.106008f, -0.110555f, 0.074335f, 0.070938f, 0.134157f, 0.063362f, -0.058558f, 0.077489f, -0.108677f, -0.089470f, 0.084029f, 0.066285f, 0.063258f, -0.080724f, -0.065636f, 0.056665f, -0.129899f, -0.071945f, -0.062620f, -0.089154f, -0.090897f, -0.351005f, 0.111647f, 0.072459f, 0.061377f, -0.283915f, 0.094184f, 0.188496f, -0.125812f, -0.276124f, -0.080859f, 0.057263f, 0.080610f, -0.060031f, -0.057100f, -0.115329f, -0.062427f, 0.111447f, -0.098520f, -0.057389f, 0.183333f, 0.061242f, -0.103299f, 0.079336f, 0.059802f, -0.079322f, -0.131639f, -0.112800f, 0.064643f, -0.106136f, -0.117712f, 0.074090f, 0.057479f, -0.081614f, -0.100166f, -0.053870f, -0.102000f, -0.203708f, -0.127752f, -0.231827f, 0.074693f, 0.111371f, -0.199251f, 0.061081f, 0.191303f, 0.108517f, -0.088756f, 0.074677f, -0.107650f, -0.071514f, -0.070680f, 0.074644f, 0.069528f, 0.134416f, -0.092079f, -0.108988f, -0.057319f, -0.109977f, 0.098286f, -0.095556f, 0.066718f, -0.088428f, -0.107302f, 0.184988f, 0.084284f, -0.225631f, 0.094483f, -0.080331f, -0.106207f, -0.072626f, 0.092572f, 0.058600f, 0.145200f, 0.493629f, -0.086377f, 0.070329f, 0.138933f, 0.080797f, -0.098510f, 0.080462f, -0.084775f, 0.093193f, -0.081967f, -0.113473f, 0.099941f, -0.081429f, -0.094951f, 0.057110f, -0.079008f, 0.110083f, -0.077534f, -0.086385f, 0.066722f, 0.076246f, 0.090347f, 0.056485f, -0.087251f, -0.088989f, 0.126146f, 0.104559f, 0.070581f, 0.061507f, -0.079449f, 0.075431f, 0.060336f, -0.116080f, -0.079419f, -0.057270f, -0.064569f, 0.100192f, 0.154651f, 0.320905f, 0.107973f, 0.227896f, -0.077395f, -0.106145f, 0.056015f, -0.183414f, 0.117802f, 0.151010f, 0.053660f, -0.077061f, 0.073367f, 0.071598f, -0.082825f, 0.074662f, 0.121025f, 0.066439f, 0.112968f, -0.108215f, 0.068116f, 0.089816f, -0.083319f, -0.197828f, 0.060684f, -0.110308f, -0.095694f, -0.055745f, -0.061766f, -0.087711f, 0.064663f, 0.099555f, -0.053717f, -0.094728f, -0.090706f, -0.109185f, -0.123193f, -0.155823f, -0.092692f, 0.124466f, 0.291159f, -0.123071f, -0.130654f, -0.071582f, 0.154737f, 0.089774f, 0.095111f, 0.074637f, -0.203595f, 0.412697f, 0.081189f, 0.066794f, 0.066858f, -0.074531f, 0.134417f, -0.086848f, -0.103804f, -0.084454f, 0.093151f, 0.079998f, 0.090072f, -0.083816f, -0.097907f, 0.204699f, 0.126106f, -0.062781f, -0.055374f, 0.080927f, -0.061349f, -0.140683f, 0.106077f, 0.054691f, 0.066443f, 0.061074f, 0.060113f, -0.086272f, 0.090693f, 0.137931f, -0.119489f, -0.173110f, 0.068890f, 0.094843f, -0.053752f, 0.131568f, -0.064383f, 0.053591f, 0.055648f, 0.067990f, -0.060196f, 0.105765f, -0.083477f, 0.102439f, 0.107427f, -0.073048f, 0.093347f, -0.084564f, -0.091027f, -0.072341f, -0.099165f, -0.112409f, 0.095084f, 0.088771f, -0.100659f, -0.054050f, 0.121137f, -0.110111f, 0.063709f, 0.053451f, -0.089647f, 0.058786f, 0.087305f, 0.170599f, -0.119090f, 0.093248f, -0.105974f, 0.062687f, 0.075595f, 0.080705f, -0.077673f, 0.070945f, -0.122131f, 0.111524f, -0.231137f, 0.054227f, -0.052743f, 0.110920f, 0.078590f, -0.063147f, -0.078755f, -0.211361f, -0.262342f, 0.138092f, -0.414858f, -0.153269f, -0.067896f, -0.056651f, -0.119710f, 0.091169f, -0.115025f, 0.136939f, 0.100611f, -0.125885f, 0.086047f, -0.102564f, -0.070233f, 0.058862f, 0.099741f, -0.078878f, 0.109011f, 0.143089f, 0.107935f, 0.061282f, -0.071091f, -0.055211f, 0.079295f, -0.064961f, -0.119015f, 0.082994f, -0.104304f, 0.081625f, 0.113468f, -0.115863f, -0.177471f, 0.110443f, 0.077118f, 0.062915f, -0.108974f, -0.059411f, 0.069836f, -0.055281f, 0.054683f, 0.090423f, 0.112993f, -0.110606f, -0.077701f, -0.087305f, 0.081571f, -0.100855f, 0.082126f, -0.120259f, -0.108412f, 0.129805f, -0.117234f, -0.062671f, 0.122326f, 0.089130f, 0.070856f, 0.170351f, -0.092053f, 0.104899f, 0.087579f, -0.058511f, 0.087706f, -0.115287f, -0.105315f, 0.131318f, -0.080569f, 0.103690f, -0.174290f, -0.069768f, 0.140502f, -0.182401f, 0.087712f, -0.196058f, -0.177869f, -0.079231f, 0.168421f, -0.097623f, 0.071422f, 0.061779f, -0.081473f, 0.107763f, 0.152774f, -0.068455f, -0.080049f, 0.125879f, 0.096078f, -0.102801f, -0.066926f, 0.116873f, 0.087257f, 0.123158f, 0.110502f, -0.091317f, 0.481019f, 0.110866f, 0.062878f, -0.063582f, 0.139318f, 0.081180f, -0.065490f, 0.113272f, -0.086452f, 0.073997f, 0.054778f, -0.099644f, 0.076941f, -0.095863f, -0.108808f, -0.104904f, -0.090578f, 0.119990f, 0.071034f, -0.076793f, -0.060515f, -0.069143f, 0.060533f, -0.060750f, -0.059576f, -0.063102f, 0.150729f, 0.108906f, 0.151267f, -0.109983f, 0.077001f, 0.189453f, 0.069925f, -0.105802f, -0.072033f, 0.171955f, 0.059544f, 0.208247f, -0.060569f, -0.070574f, -0.073069f, -0.112608f, -0.121361f, 0.168114f, -0.092206f, 0.121951f, -0.054438f, 0.123082f, -0.101836f, -0.145835f, 0.073639f, 0.110893f, -0.057251f, 0.100372f, 0.060197f, -0.083266f, -0.136931f, -0.094894f, 0.098133f, -0.056554f, 0.087875f, -0.122936f, 0.072075f, -0.073263f, -0.060871f, 0.068435f, 0.117446f, 0.127541f, -0.072781f, -0.132343f, 0.083841f, -0.089497f, -0.063136f, -0.113418f, 0.124778f, 0.113646f, -0.161183f, 0.122020f, -0.214388f, -0.100743f, -0.082602f, 0.082505f, -0.094503f, -0.079940f, 0.079541f, -0.107123f, -0.118417f, 0.117695f, 0.065580f, -0.117285f, 0.092454f, -0.054061f, -0.064954f, 0.080255f, 0.077746f, 0.061017f, 0.116131f, 0.104810f, 0.110427f, -0.112579f, -0.084265f, -0.105211f, -0.096711f, 0.093268f, 0.103593f, -0.081422f, 0.170867f, 0.065569f, -0.074699f, 0.133152f, -0.069097f, 0.130260f, -0.086931f, -0.062274f, -0.079268f, 0.083654f, 0.196931f, 0.092630f, -0.063879f, -0.154558f, -0.144183f, -0.119021f, -0.273817f, -0.149730f, 0.123921f, -0.156906f, 0.103146f, -0.079152f, -0.122235f, -0.101547f, 0.061842f, -0.073149f, -0.068852f, 0.072071f, -0.102242f, 0.127005f, -0.076989f, -0.114855f, -0.097798f, -0.139816f, -0.129355f, -0.188365f, -0.057817f, -0.065951f, 0.168317f, -0.066894f, -0.180442f, 0.095300f, 0.090022f, 0.071335f, 0.071258f, -0.076773f, 0.091481f, -0.053831f, 0.124181f, 0.116155f, 0.065988f, -0.061122f, 0.090540f, -0.077647f, 0.063888f, 0.081314f, -0.090986f, -0.082092f, -0.068238f, -0.097547f, -0.099547f, -0.089481f, -0.077383f, -0.094656f, -0.224721f, -0.072941f, -0.182518f, 0.100225f, 0.111283f, 0.052961f, -0.060863f, 0.139879f, -0.194841f, -0.097694f, 0.349015f, 0.091088f, -0.057831f, -0.160920f, -0.078481f, -0.096145f, -0.103782f, 0.101221f, -0.106947f, 0.159148f, -0.132546f, 0.068476f, 0.116985f, -0.105167f, 0.054058f, -0.060585f, -0.104003f, 0.072088f, -0.142470f, -0.052986f, -0.166784f, -0.074454f, 0.075594f, 0.095086f, 0.057043f, -0.124864f, -0.520202f, 0.055517f, 0.061396f, -0.058481f, 0.161185f, -0.082041f, 0.189833f, -0.072709f, 0.101050f, -0.054131f, -0.100446f, -0.071528f, -0.088995f, 0.080474f, 0.084320f, -0.101716f, 0.078152f, -0.074868f, 0.098865f, 0.069341f, -0.096156f, -0.110788f, 0.113057f, -0.064216f, -0.089266f, -0.053073f, -0.099895f, -0.124151f, 0.108074f, -0.054756f, -0.131042f, -0.119957f, -0.211406f, 0.071606f, 0.054808f, -0.384528f, -0.086467f, 0.183157f, -0.132940f, 0.053068f, 0.219483f, -0.090618f, 0.131123f, 0.059182f, 0.078722f, -0.104994f, 0.073972f, 0.066579f, 0.084812f, -0.067933f, 0.233097f, 0.081665f, -0.054434f, 0.115764f, -0.071335f, 0.147727f, -0.086992f, -0.128394f, 0.081790f, -0.066020f, -0.114701f, 0.070170f, -0.061718f, -0.055128f, -0.320977f, 0.102922f, 0.105648f, 0.055623f, -0.097896f, -0.074061f, 0.077758f, -0.066358f, 0.074647f, -0.074784f, 0.099750f, 0.097481f, -0.077356f, 0.080116f, -0.104490f, 0.087416f, 0.116121f, 0.073692f, 0.080982f, 0.090415f, -0.107108f, 0.082450f, 0.101123f, 0.115781f, 0.074032f, 0.082900f, -0.100238f, 0.076209f, -0.054901f, -0.067985f, -0.086970f, 0.095291f, -0.117603f, -0.099138f, 0.071763f, 0.063219f, -0.138127f, -0.399849f, 0.096591f, 0.128631f, -0.074726f, -0.073322f, 0.079753f, 0.066240f, -0.095121f, 0.063985f, 0.074528f, 0.070719f, 0.077175f, -0.077327f, -0.071473f, 0.071483f, 0.057365f, -0.148332f, 0.098518f, -0.089703f, -0.125909f, -0.110482f, 0.072387f, 0.081924f, -0.083055f, 0.101533f, 0.108135f, -0.131543f, -0.067386f, -0.066840f, -0.088359f, -0.100378f, 0.099889f, 0.053644f, -0.055676f, 0.098680f, -0.074964f, -0.095745f, 0.108997f, -0.112000f, 0.123204f, -0.087790f, 0.151473f, -0.119111f, -0.158377f, -0.138724f, 0.083206f, 0.055245f, -0.082468f, 0.101984f, 0.105798f, -0.138367f, -0.087996f, 0.053986f, -0.140083f, -0.103528f, -0.200589f, 0.138050f, -0.056528f, 0.073745f, 0.115270f, -0.122231f, -0.105455f, 0.116868f, -0.106919f, 0.070948f, -0.096358f, -0.074014f, -0.081942f, -0.151435f, 0.100136f, -0.057455f, 0.066931f, -0.101979f, 0.097092f, 0.177403f, -0.086493f, 0.147120f, 0.095093f, -0.079150f, 0.095685f, 0.131445f, -0.057762f, 0.085427f, -0.095586f, -0.124553f, 0.149758f, -0.061612f, -0.271228f, 0.074985f, 0.092471f, -0.067951f, 0.121073f, 0.090201f, 0.063477f, 0.135380f, -0.078757f, 0.113055f, 0.056089f, 0.074714f, -0.116209f, 0.113255f, -0.123081f, 0.054744f, 0.148529f, -0.059699f, -0.083942f, 0.079969f, 0.054661f, -0.083417f, -0.066887f, 0.072850f, 0.058751f, -0.078719f, 0.087695f, 0.081003f, 0.216439f, 0.087015f, -0.109382f, 0.105213f, 0.091743f, -0.073548f, -0.087123f, 0.061931f, -0.087917f, -0.077482f, -0.063324f, 0.089660f, 0.087034f, -0.095855f, 0.074291f, -0.059113f, 0.104050f, -0.093059f, 0.066333f, -0.072554f, -0.061559f, -0.061357f, -0.056760f, -0.097230f, -0.108701f, -0.117423f, 0.105280f, 0.116637f, -0.061364f, 0.082687f, 0.114381f, -0.076694f, -0.061059f, 0.141003f, 0.107163f, -0.078513f, -0.105956f, -0.132247f, 0.064583f, 0.125567f, 0.056947f, 0.091871f, 0.059503f, -0.165946f, -0.117094f, -0.072435f, 0.082417f, -0.144915f, 0.113618f, 0.112475f, 0.066047f, 0.060376f, -0.078146f, -0.125038f, 0.089039f, -0.148647f, 0.102470f, 0.129313f, 0.089860f, 0.094416f, 0.104252f, 0.151051f, 0.056358f, 0.247110f, 0.064303f, -0.254380f, 0.242375f, 0.058585f, 0.116200f, -0.104648f, 0.173544f, -0.093824f, -0.187138f, 0.128532f, -0.064081f, -0.276489f, -0.059460f, 0.092313f, 0.091854f, 0.144008f, -0.056881f, 0.165225f, -0.084181f, -0.124962f, 0.084192f, -0.104821f, 0.095453f, 0.084119f, -0.191121f, -0.108731f, 0.055306f, -0.090241f, -0.088416f, -0.058103f, -0.064539f, -0.094343f, 0.100811f, 0.086586f, 0.111757f, 0.109680f, -0.059628f, 0.123520f, -0.079976f, -0.100834f, 0.105330f, -0.118754f, -0.073616f, 0.096359f, -0.095632f, 0.234781f, -0.106542f, 0.064942f, 0.074649f, -0.071539f, 0.056297f, -0.195891f, 0.103104f, -0.085331f, -0.114926f, -0.075953f, -0.077173f, -0.085825f, 0.101073f, 0.088914f, -0.118338f, 0.102425f, 0.098207f, 0.061854f, -0.076753f, -0.093970f, -0.080077f, 0.119823f, 0.103327f, -0.089928f, 0.094492f, -0.060862f, 0.145005f, 0.082068f, 0.081602f, -0.075073f, 0.082852f, -0.094936f, 0.055182f, 0.113920f, -0.124597f, -0.069047f, -0.064510f, -0.163599f, -0.100163f, 0.096972f, -0.177372f, 0.060607f, -0.098905f, -0.106074f, 0.122509f, 0.054995f, 0.054613f, 0.074577f, -0.070924f, -0.108042f, -0.061122f, 0.093690f, 0.104646f, -0.092004f, -0.065360f, 0.100625f, 0.107938f, -0.092318f, -0.107213f, 0.092897f, -0.081546f, -0.108932f, 0.088752f, -0.058857f, 0.104164f, 0.119562f, -0.137253f, -0.194963f, -0.086561f, 0.062224f, -0.248274f, -0.059848f, 0.068443f, -0.072555f, 0.072590f, 0.205994f, 0.113350f, -0.122086f, -0.269258f, -0.076421f, -0.080298f, -0.132712f, 0.064944f, -0.090853f, -0.105744f, -0.065766f, -0.068752f, 0.177510f, 0.072436f, 0.064374f, -0.069353f, -0.085622f, -0.094686f, -0.065464f, -0.104716f, 0.094262f, 0.063639f, -0.094143f, -0.066900f, 0.084775f, 0.071693f, 0.079008f, -0.093047f, -0.522331f, -0.091343f, 0.127588f, 0.105209f, 0.060992f, 0.106337f, 0.066234f, -0.100207f, -0.121536f, 0.063180f, -0.093262f, -0.101742f, 0.053427f, -0.063718f, -0.087402f, -0.120236f, -0.077107f, 0.065841f, -0.084660f, 0.065878f, -0.071686f, -0.097665f, 0.065823f, 0.111999f, 0.087292f, -0.079966f, -0.081163f, 0.060665f, 0.101820f, 0.110239f, 0.127569f, 0.138203f, 0.147004f, -0.255098f, -0.138317f, 0.056886f, -0.066815f, -0.081702f, 0.104306f, 0.099498f, -0.405141f, -0.097063f, 0.088793f, -0.116312f, 0.107878f, 0.071206f, 0.102053f, -0.085589f, 0.053128f, -0.065211f, -0.070667f, -0.086745f, -0.094907f, 0.177132f, -0.122218f, -0.072978f, -0.084113f, 0.115183f, 0.055950f, 0.093930f, 0.079580f, 0.145126f, -0.065133f, -0.090974f, -0.061295f, -0.074156f, 0.083374f, -0.181534f, -0.196470f, -0.144125f, 0.116333f, -0.113779f, -0.085661f, 0.153825f, 0.299776f, -0.109785f, 0.075891f, -0.085266f, -0.080262f, -0.091496f, 0.059323f, 0.073391f, -0.058103f, -0.115977f, -0.148014f, 0.122544f, 0.056967f, -0.055434f, 0.138932f, -0.070390f, -0.066866f, 0.063394f, 0.059281f, 0.053259f, -0.116434f, 0.098825f, -0.124039f, -0.053293f, 0.112317f, -0.053224f, 0.101220f, -0.091389f, -0.090452f, -0.067907f, 0.066666f, -0.121964f, 0.075176f, -0.102533f, -0.185873f, 0.111609f, 0.078831f, 0.142886f, -0.130814f, 0.058761f, 0.079813f, -0.141158f, 0.111244f, -0.052726f, -0.083663f, -0.065804f, 0.090250f, 0.182688f, 0.078423f, 0.052931f, -0.100372f, 0.058986f, -0.097734f, -0.085035f, 0.091595f, 0.079223f, 0.074774f, -0.115616f, -0.086694f, -0.116136f, 0.080686f, 0.055238f, -0.067371f, 0.115904f, 0.067497f, -0.059498f, -0.088768f, -0.146571f, 0.165482f, -0.193579f, 0.092405f, 0.066404f, -0.103597f, -0.208761f, -0.090628f, 0.071680f, 0.171996f, 0.145926f, -0.114297f, -0.091731f, 0.073537f, -0.052993f, -0.145962f, 0.060167f, 0.109930f, 0.059333f, 0.171887f, -0.151586f, -0.059647f, 0.186853f, 0.062200f, 0.092487f, 0.060710f, -0.087341f, -0.120616f, 0.091008f, -0.079638f, -0.071038f, -0.168128f, -0.118383f, 0.080081f, 0.061733f, 0.127162f, 0.056455f, 0.096817f, -0.094080f, -0.119212f, -0.053955f, 0.159543f, -0.215141f, -0.081268f, 0.085576f, -0.104049f, 0.059059f, -0.096293f, 0.094980f, 0.068703f, 0.113348f, -0.218609f, 0.163332f, -0.146124f, 0.083289f, 0.129521f, -0.092989f, 0.101138f, 0.121288f, 0.074028f, -0.074243f, -0.073097f, 0.238222f, 0.088535f, 0.075393f, -0.114630f, 0.104627f, -0.116678f, 0.134052f, -0.064328f, 0.113886f, 0.055074f, 0.064291f, 0.069796f, 0.070776f, -0.069867f, 0.092785f, -0.087749f, 0.060596f, 0.056331f, 0.069574f, -0.057542f, -0.209276f, -0.053098f, 0.066155f, -0.081464f, -0.103358f, 0.092341f, 0.081664f, -0.099710f, -0.081199f, -0.079055f, 0.091622f, -0.071801f, -0.149892f, -0.052637f, -0.095446f, -0.054045f, -0.069401f, 0.074166f, 0.074469f, -0.070860f, -0.056657f, -0.059492f, 0.063507f, -0.082266f, -0.099260f, -0.074628f, -0.077137f, -0.073266f, 0.405178f, -0.076425f, -0.077802f, -0.061380f, 0.137282f, -0.066579f, 0.056025f, 0.063004f, 0.072907f, 0.072793f, -0.114833f, -0.092440f, -0.082869f, 0.102712f, 0.113372f, 0.099085f, -0.071771f, 0.061074f, -0.093224f, 0.055882f, 0.089863f, -0.072185f, 0.079566f, 0.065677f, 0.079737f, 0.088079f, -0.167592f, -0.079290f, -0.120718f, -0.136186f, 0.077524f, 0.182952f, -0.074988f, 0.067289f, -0.154884f, -0.110672f, 0.068071f, -0.083179f, -0.093688f, -0.099798f, -0.131105f, -0.298449f, 0.145053f, -0.119311f, 0.259012f, 0.084188f, 0.137668f, -0.089764f, -0.076641f, 0.062837f, 0.102659f, -0.091105f, 0.103790f, -0.089272f, 0.094980f, -0.215541f, -0.063732f, -0.392706f, 0.099839f, -0.196705f, 0.074013f, 0.277262f, 0.085413f, -0.140667f, -0.093989f, 0.064903f, -0.064887f, -0.056082f, -0.085254f, 0.101298f, 0.066424f, -0.099401f, -0.073188f, -0.059426f, 0.088255f, 0.124394f, -0.108268f, -0.075817f, 0.066700f, -0.062924f, -0.086299f, -0.083099f, 0.107375f, 0.074722f, -0.105309f, 0.060203f, -0.108553f, -0.086096f, -0.100083f, 0.055134f, -0.135085f, 0.119294f, 0.090917f, 0.088233f, 0.149983f, 0.202054f, -0.086007f, 0.499996f, -0.090784f, 0.074530f, 0.151554f, 0.148919f, -0.090049f, -0.078082f, 0.095493f, 0.070437f, 0.081217f, 0.078340f, -0.071532f, -0.101207f, -0.080930f, -0.066344f, -0.060468f, 0.061927f, -0.065003f, -0.055611f, 0.084945f, -0.054302f, 0.058264f, -0.064706f, 0.101811f, -0.074369f, 0.092462f, 0.067332f, 0.054354f, -0.061126f, 0.074115f, 0.060447f, 0.096533f, -0.079260f, 0.139642f, -0.089515f, 0.290821f, -0.084421f, -0.081461f, -0.104796f, 0.109668f, 0.074450f, 0.064466f, -0.106211f, -0.169270f, 0.085475f, -0.082692f, 0.088103f, -0.144394f, 0.060973f, 0.105579f, 0.080315f, -0.065569f, -0.110238f, -0.086019f, 0.096471f, 0.111154f, 0.088008f, -0.103074f, -0.068605f, 0.107035f, -0.082508f, -0.101127f, 0.108161f, -0.069108f, -0.111251f, 0.089715f, 0.079267f, 0.086339f, 0.060541f, -0.092800f, -0.112057f, 0.102775f, 0.090150f, -0.321981f, 0.078284f, -0.098080f, 0.053661f, -0.111042f, 0.064781f, 0.067515f, 0.066620f, 0.289234f, 0.066280f, 0.096768f, -0.081181f, 0.064779f, -0.106218f, -0.096730f, 0.074557f, -0.087799f, -0.067702f, -0.071891f, -0.115939f, 0.104697f, 0.097111f, -0.085754f, 0.089052f, -0.082220f, -0.109531f, 0.072530f, -0.074029f, -0.159599f, -0.121744f, -0.066455f, -0.059894f, -0.054903f, -0.096642f, -0.063770f, -0.099840f, -0.058841f, -0.244501f, 0.100410f, 0.081809f, -0.093973f, -0.135750f, -0.082235f, 0.073254f, -0.099035f, 0.063784f, 0.117111f, 0.074738f, -0.243236f, -0.097943f, 0.057566f, 0.066588f, -0.065410f, 0.072569f, -0.095774f, 0.142642f, -0.151934f, -0.096147f, 0.070986f, -0.099693f, -0.059379f, -0.073331f, 0.054452f, 0.056151f, 0.053188f, -0.098702f, 0.079070f, 0.121457f, -0.080156f, -0.101328f, 0.065144f, -0.073719f, -0.072943f, 0.117398f, -0.138551f, -0.382694f, 0.116806f, 0.080899f, 0.099619f, 0.200417f, 0.079081f, -0.110553f, -0.067092f, -0.072234f, 0.074423f, -0.061553f, -0.135441f, 0.120800f, -0.105299f, 0.108812f, -0.094402f, -0.141390f, 0.056693f, 0.116121f, -0.145587f, -0.058522f, -0.095539f, -0.061177f, 0.055244f, -0.056662f, -0.076562f, -0.083103f, -0.055868f, -0.058443f, -0.095915f, -0.061332f, 0.066150f, 0.183603f, 0.096333f, 0.353085f, -0.084748f, 0.079003f, 0.056895f, 0.072927f, 0.222741f, 0.059173f, 0.078762f, -0.077607f, -0.095435f, 0.062244f, 0.105245f, -0.068952f, 0.058343f, 0.148152f, -0.131596f, 0.089354f, -0.075099f, 0.100911f, -0.172358f, -0.054538f, -0.059641f, 0.069746f, 0.061856f, 0.053982f, 0.120738f, 0.112798f, -0.073839f, -0.103896f, 0.165197f, -0.096431f, 0.078890f, 0.086351f, -0.109848f, -0.064943f, -0.054500f, -0.229687f, -0.071905f, -0.086578f, -0.067317f, -0.126832f, -0.062389f, 0.070711f, -0.099037f, 0.062333f, -0.103931f, 0.108492f, 0.109994f, -0.096523f, 0.078588f, 0.058328f, 0.059095f, 0.063174f, -0.118740f, 0.075062f, -0.082647f, 0.070030f, 0.097649f, 0.106192f, -0.112481f, -0.109933f, 0.106210f, -0.057523f, 0.102789f, 0.075940f, 0.117310f, 0.095507f, 0.074857f, -0.059558f, 0.062727f, -0.054025f, 0.107292f, 0.121583f, 0.156158f, 0.082744f, 0.088914f, 0.063515f, 0.101157f, -0.056359f, -0.058861f, -0.083463f, 0.091695f, -0.064105f, 0.102049f, 0.054832f, 0.080989f, -0.148062f, -0.079725f, 0.091677f, 0.097125f, 0.103114f, 0.100023f, -0.060299f, 0.083854f, -0.082214f, -0.077069f, -0.107426f, -0.064734f, 0.066281f, 0.054903f, -0.074960f, 0.091683f, -0.081683f, -0.079506f, 0.077671f, 0.054370f, 0.125670f, -0.110627f, 0.430684f, 0.101866f, -0.101481f, 0.123328f, 0.099329f, -0.096640f, 0.088678f, 0.091219f, -0.074300f, 0.070136f, -0.053037f, 0.100801f, 0.055356f, 0.123955f, 0.094238f, -0.071213f, -0.115932f, 0.095583f, -0.114242f, 0.078258f, 0.093650f, 0.057390f, -0.101293f, 0.081584f, 0.102446f, -0.054962f, 0.097626f, 0.159094f, -0.065890f, -0.126419f, -0.081394f, 0.073483f, -0.072620f, 0.196124f, 0.098837f, -0.085562f, 0.446769f, 0.104227f, -0.076531f, 0.115732f, -0.108693f, -0.100159f, 0.202669f, -0.060808f, 0.092681f, 0.104095f, -0.084245f, 0.119621f, -0.055190f, 0.079798f, -0.068818f, 0.079216f, -0.083525f, -0.077389f, -0.098839f, 0.074426f, -0.136130f, -0.060254f, 0.098452f, 0.105132f, -0.093689f, 0.063997f, -0.112799f, -0.053382f, -0.174622f, -0.088308f, 0.111566f, -0.103507f, -0.053021f, 0.078357f, -0.110509f, 0.112955f, -0.128793f, -0.075808f, 0.081184f, -0.402932f, -0.160138f, -0.079718f, -0.135591f, 0.136998f, 0.076460f, -0.188655f, 0.090321f, 0.071838f, 0.059181f, 0.090335f, 0.059504f, 0.096778f, -0.084083f, -0.105089f, -0.108746f, 0.095813f, -0.108751f, -0.073986f, -0.111983f, -0.060717f, 0.067152f, 0.092538f, 0.076623f, -0.074913f, -0.058099f, 0.103144f, -0.091661f, 0.079221f, -0.113037f, -0.086269f, -0.121097f, 0.055168f, -0.068292f, 0.126034f, 0.076428f, -0.111533f, 0.067209f, 0.062225f, -0.107995f, 0.087340f, -0.071883f, -0.088913f, 0.053626f, 0.080958f, -0.064940f, 0.163447f, 0.060019f, 0.092535f, 0.119339f, -0.073013f, -0.081692f, -0.212348f, -0.084611f, -0.090722f, 0.069568f, 0.083574f, 0.072340f, -0.115315f, -0.078738f, -0.059367f, 0.072076f, 0.058227f, -0.094451f, 0.085632f, 0.284300f, 0.057476f, 0.140000f, -0.075654f, 0.083251f, -0.113626f, -0.104949f, -0.116789f, -0.083967f, -0.074970f, 0.053490f, 0.074276f, -0.120447f, -0.074811f, -0.102388f, -0.085118f, -0.097272f, 0.056821f, 0.132770f, 0.072962f, 0.059376f, -0.101059f, 0.098600f, -0.118233f, -0.118557f, -0.073404f, 0.058019f, 0.072841f, -0.111895f, 0.111257f, 0.092248f, -0.116494f, 0.061835f, -0.061304f, 0.084847f, -0.222951f, -0.112730f, 0.088306f, 0.056908f, -0.116514f, -0.099452f, -0.208349f, 0.079560f, 0.171635f, 0.117299f, -0.189850f, -0.109781f, -0.066875f, 0.134072f, 0.178845f, 0.079177f, 0.101945f, 0.150561f, -0.057410f, -0.086033f, 0.072670f, 0.066470f, 0.059725f, 0.101519f, 0.060769f, 0.229570f, -0.135158f, 0.132442f, 0.074719f, -0.088245f, -0.104681f, -0.053486f, -0.100593f, 0.059709f, -0.222447f, -0.088600f, -0.337998f, -0.075118f, -0.193279f, 0.077930f, 0.176676f, 0.093032f, -0.088407f, -0.092728f, -0.062881f, -0.065152f, -0.089285f, -0.103076f, -0.080831f, -0.101307f, 0.063027f, 0.068196f, -0.089762f, -0.092914f, 0.056748f, 0.099586f, 0.083998f, 0.153513f, 0.059629f, -0.069379f, 0.076287f, 0.114481f, -0.168954f, 0.127732f, -0.096006f, -0.070283f, 0.054350f, 0.098566f, -0.066779f, 0.086945f, -0.263820f, -0.055772f, -0.109473f, 0.159469f, 0.081142f, -0.061242f, -0.116157f, -0.100264f, 0.070750f, -0.107122f, 0.064336f, -0.073509f, 0.093643f, -0.066884f, 0.074256f, 0.102965f, -0.068669f, 0.089958f, -0.074450f, -0.055086f, -0.099328f, -0.104383f, 0.063544f, 0.063911f, 0.095926f, 0.073630f, 0.141583f, -0.113611f, 0.056929f, -0.152027f, -0.056376f, -0.191637f, -0.083908f, -0.073610f, -0.407270f, -0.091588f, -0.089338f, -0.053790f, 0.182438f, -0.073412f, 0.174035f, 0.063242f, -0.120176f, -0.095124f, 0.092765f, -0.070794f, -0.062369f, 0.075103f, -0.085910f, 0.088356f, -0.103770f, 0.186641f, 0.099108f, -0.090525f, -0.093064f, -0.100765f, 0.053764f, 0.068825f, -0.057780f, -0.066569f, 0.106038f, 0.170386f, 0.076609f, 0.105318f, 0.065788f, 0.105308f, 0.076879f, 0.060890f, 0.161015f, -0.210497f, 0.322062f, 0.073842f, 0.064144f, -0.062033f, 0.087062f, 0.137263f, 0.073549f, 0.157288f, -0.318774f, 0.108834f, -0.054458f, -0.078202f, 0.078975f, 0.106785f, -0.114752f, -0.113503f, -0.168598f, 0.056208f, -0.069866f, 0.053741f, -0.157938f, 0.055637f, 0.135494f, 0.074209f, 0.102110f, -0.122458f, 0.077502f, -0.076938f, 0.054016f, 0.107962f, 0.058042f, 0.077452f, -0.135463f, 0.069506f, 0.106377f, 0.127466f, 0.063781f, -0.155046f, 0.096543f, -0.091579f, 0.078760f, -0.072270f, 0.096337f, 0.077416f, -0.195445f, 0.281309f, -0.198240f, 0.138324f, -0.165764f, -0.097864f, -0.085653f, 0.066748f, -0.093323f, -0.142464f, -0.090600f, -0.061884f, -0.070279f, -0.065222f, -0.101707f, 0.081012f, 0.081368f, -0.098864f, 0.109025f, -0.097761f, -0.104347f, 0.172943f, -0.072890f, 0.102821f, -0.057338f, 0.079697f, 0.078016f, -0.082800f, -0.069917f, 0.160967f, 0.163333f, -0.100222f, -0.071425f, -0.058219f, 0.066899f, 0.112367f, 0.063415f, -0.098890f, 0.057666f, -0.168867f, 0.065623f, -0.119010f, 0.085288f, 0.086540f, -0.149991f, -0.092109f, 0.062454f, 0.068607f, -0.121204f, 0.073569f, -0.080271f, -0.094460f, -0.085865f, -0.111187f, -0.060549f, 0.102091f, 0.059110f, -0.056685f, 0.371225f, 0.098097f, -0.108326f, 0.094628f, 0.388460f, -0.085017f, -0.089126f, -0.102771f, 0.094471f, -0.085595f, -0.125275f, -0.111885f, 0.102351f, 0.120071f, -0.110556f, -0.105270f, 0.058909f, -0.061781f, 0.107140f, -0.087263f, 0.094942f, -0.106071f, -0.081889f, -0.059773f, 0.054071f, -0.134676f, 0.065047f, -0.134974f, 0.102803f, -0.068450f, -0.060788f, 0.095626f, 0.063366f, 0.088052f, -0.067953f, -0.121914f, 0.084878f, -0.068046f, 0.061985f, -0.214587f, -0.075890f, 0.115041f, 0.069898f, -0.135589f, 0.073026f, 0.069701f, 0.077855f, -0.081783f, 0.110498f, -0.057004f, -0.078023f, 0.064585f, 0.079037f, -0.109655f, 0.097359f, -0.061369f, 0.060524f, -0.056985f, -0.104545f, 0.079939f, 0.102384f, 0.085987f, -0.143304f, 0.078943f, -0.082909f, -0.110078f, -0.063370f, 0.088369f, 0.083739f, -0.184558f, 0.099847f, -0.085702f, -0.069258f, 0.096537f, 0.151649f, -0.084999f, -0.072154f, 0.075501f, 0.086334f, 0.064218f, 0.129429f, -0.095873f, 0.093189f, 0.117926f, -0.086289f, 0.053772f, -0.094684f, 0.102726f, 0.058489f, 0.089350f, 0.125528f, 0.094959f, -0.067689f, 0.117960f, -0.069984f, 0.098083f, 0.091194f, 0.082747f, 0.068808f, -0.085001f, -0.125779f, -0.058917f, -0.357459f, -0.053112f, 0.065005f, 0.054059f, -0.065010f, 0.080687f, -0.088786f, -0.074893f, -0.088132f, -0.076151f, -0.066191f, -0.108787f, 0.101080f, 0.064625f, 0.076603f, -0.159063f, 0.117946f, 0.108565f, -0.106625f, -0.078738f, 0.130106f, -0.086350f, 0.079795f, 0.138646f, 0.099269f, -0.073811f, 0.078355f, -0.112162f, -0.070954f, 0.073304f, -0.091705f, -0.057360f, -0.081232f, 0.076123f, 0.083493f, 0.060901f, 0.171876f, 0.090755f, 0.090541f, 0.096070f, 0.182323f, -0.074201f, 0.062143f, -0.155451f, -0.055780f, 0.057221f, 0.143073f, 0.105030f, -0.083996f, 0.097942f, 0.065183f, -0.105916f, 0.073304f, -0.112496f, -0.056216f, 0.069791f, 0.094782f, 0.078375f, 0.105038f, 0.076575f, 0.061318f, -0.067870f, 0.122389f, 0.096429f, 0.060567f, 0.186011f, 0.056110f, -0.068775f, 0.064450f, 0.058684f, 0.069950f, 0.119237f, -0.116413f, -0.149678f, -0.155415f, -0.072417f, -0.084102f, -0.065418f, 0.173734f, 0.117023f, 0.089770f, 0.079631f, -0.158682f, 0.098625f, 0.105441f, 0.097458f, 0.061320f, 0.082071f, 0.057588f, 0.209814f, -0.155560f, 0.077675f, -0.088189f, -0.063083f, 0.072267f, 0.139145f, 0.136766f, -0.053314f, -0.091207f, -0.080535f, -0.123607f, -0.124190f, 0.082433f, 0.080467f, 0.103064f, 0.065330f, -0.062580f, -0.130303f, -0.094758f, 0.111644f, -0.098472f, -0.053514f, -0.138798f, 0.111997f, -0.074244f, 0.095819f, 0.068345f, -0.094028f, -0.161378f, -0.097357f, 0.082075f, 0.091359f, 0.108045f, 0.127796f, -0.115333f, 0.077566f, 0.088273f, 0.095949f, -0.073584f, -0.107661f, -0.113917f, 0.089762f, 0.127179f, -0.101019f, -0.091345f, -0.059640f, 0.076623f, 0.097826f, -0.070700f, -0.070428f, 0.074092f, -0.125367f, -0.100231f, -0.320671f, -0.104665f, 0.093307f, 0.075230f, -0.083484f, 0.077329f, -0.056820f, 0.133337f, -0.069429f, 0.147179f, 0.099967f, 0.110026f, -0.071444f, -0.062957f, 0.099933f, -0.115175f, -0.075195f, -0.080666f, -0.075356f, 0.063587f, 0.102237f, -0.098819f, -0.073869f, 0.089483f, 0.088132f, -0.061090f, -0.098253f, 0.099316f, 0.092360f, 0.091225f, 0.110368f, 0.074767f, -0.064190f, 0.079457f, -0.079768f, -0.199063f, -0.092605f, -0.074899f, 0.184194f, 0.061913f, 0.123347f, -0.082852f, 0.120730f, 0.056660f, 0.233773f, 0.073590f, -0.261898f, -0.102724f, 0.098510f, 0.122875f, -0.076910f, -0.078383f, 0.054252f, -0.067737f, 0.083779f, -0.054686f, 0.150833f, 0.080304f, 0.126691f, -0.063646f, 0.096894f, -0.053288f, 0.078163f, 0.089451f, -0.068756f, -0.121960f, -0.142805f, -0.119098f, 0.128046f, -0.094535f, 0.100919f, 0.099073f, 0.091890f, -0.096052f, 0.204914f, -0.065509f, 0.090584f, 0.064601f, -0.052914f, 0.104444f, -0.421369f, 0.116076f, -0.116131f, 0.119248f, 0.144385f, -0.109130f, -0.149834f, 0.104292f, 0.184992f, -0.207242f, 0.058314f, 0.085674f, -0.073805f, 0.082518f, -0.252972f, 0.099000f, -0.097804f, -0.097748f, 0.077195f, 0.169514f, -0.071118f, 0.059554f, -0.108540f, -0.062544f, -0.083870f, 0.057453f, 0.055898f, 0.077386f, 0.113856f, 0.063409f, 0.147154f, -0.106812f, 0.077434f, 0.117887f, 0.096147f, -0.180393f, 0.059543f, 0.098990f, 0.225194f, 0.133278f, 0.099808f, -0.074406f, 0.128889f, -0.116752f, 0.061878f, 0.092820f, 0.102745f, 0.077033f, 0.093123f, 0.064344f, 0.060391f, -0.086349f, -0.089789f, 0.075253f, -0.065783f, 0.104381f, -0.064717f, -0.066199f, -0.070296f, 0.153497f, 0.069364f, -0.054694f, -0.081646f, 0.085146f, -0.080066f, 0.074370f, 0.067728f, 0.104624f, 0.080412f, -0.221402f, 0.076807f, -0.068069f, 0.096521f, -0.086489f, 0.064732f, 0.056578f, 0.085166f, 0.090104f, 0.138656f, -0.070777f, 0.100328f, 0.081373f, 0.075526f, 0.121492f, 0.054598f, 0.097092f, 0.089539f, -0.091179f, 0.092098f, -0.157023f, -0.081444f, -0.121787f, 0.096752f, -0.065251f, 0.067380f, 0.054093f, 0.145380f, -0.107234f, -0.053749f, 0.088228f, -0.120350f, 0.075033f, 0.054955f, 0.101524f, 0.108153f, 0.098827f, -0.065573f, 0.097421f, -0.096303f, 0.070578f, 0.090048f, -0.080778f, 0.053291f, 0.178241f, 0.067526f, -0.175152f, -0.074391f, -0.087913f, 0.094846f, 0.096083f, -0.058414f, 0.091380f, -0.060761f, 0.069683f, 0.090133f, -0.061880f, -0.083770f, -0.156294f, -0.150914f, 0.136715f, 0.070539f, -0.053197f, -0.088342f, -0.084067f, 0.082376f, 0.059132f, 0.057659f, 0.120609f, 0.107085f, -0.095139f, 0.073702f, 0.107572f, -0.053940f, 0.074748f, 0.063914f, 0.225741f, 0.092863f, -0.159116f, 0.110058f, 0.131957f, -0.060935f, -0.140627f, 0.125536f, 0.069114f, 0.081062f, 0.085813f, -0.075769f, 0.082273f, 0.069665f, 0.111097f, 0.106067f, -0.092867f, 0.106032f, 0.065917f, 0.076333f, 0.069920f, -0.076859f, 0.098277f, 0.103895f, 0.073941f, 0.088244f, 0.088513f, 0.077474f, 0.069648f, -0.087879f, 0.080776f, 0.064498f, 0.183439f, 0.321670f, -0.075815f, -0.078412f, 0.058551f, 0.110432f, -0.148686f, 0.108990f, -0.108976f, 0.080945f, -0.068742f, 0.070486f, -0.080929f, 0.091722f, 0.054132f, 0.068887f, 0.064618f, -0.060121f, -0.060223f, 0.070532f, -0.140309f, 0.112373f, 0.088266f, 0.053944f, 0.071151f, -0.076848f, -0.077315f, 0.124461f, 0.138320f, 0.090334f, -0.085651f, -0.054453f, -0.113046f, -0.061035f, 0.082776f, -0.189712f, -0.117968f, -0.303630f, -0.060400f, 0.092327f, -0.293776f, 0.077240f, -0.157582f, 0.065466f, -0.059878f, 0.165318f, -0.157143f, 0.062177f, 0.240215f, -0.094695f, -0.062285f, 0.160464f, -0.145461f, -0.055917f, -0.066493f, -0.059644f, 0.216282f, -0.110992f, -0.060828f, 0.240333f, -0.112895f, -0.148375f, -0.107541f, 0.065329f, 0.061743f, -0.203562f, 0.068785f, -0.084064f, -0.070573f, -0.137996f, -0.084283f, -0.084528f, 0.060153f, -0.071084f, -0.100702f, -0.112410f, 0.122883f, 0.273521f, -0.069158f, 0.052741f, 0.068104f, -0.075676f, 0.083850f, -0.243647f, -0.114839f, -0.076584f, -0.083686f, 0.095778f, -0.079771f, -0.063590f, 0.070977f, -0.098962f, -0.076333f, 0.073745f, -0.136283f, -0.081079f, -0.053311f, 0.139058f, 0.092475f, 0.134535f, -0.087206f, -0.135407f, 0.085544f, 0.104500f, -0.066617f, -0.083599f, -0.070739f, -0.108462f, 0.064307f, 0.099584f, -0.089113f, -0.127966f, 0.134452f, -0.085413f, 0.094225f, -0.109682f, 0.095924f, 0.081497f, 0.110106f, 0.061510f, -0.118136f, 0.059539f, 0.089534f, -0.204743f, -0.069324f, 0.136538f, -0.127477f, 0.128791f, 0.100241f, 0.129863f, 0.073495f, 0.078668f, -0.090055f, -0.088571f, -0.123404f, -0.105215f, 0.129183f, -0.066112f, 0.084737f, 0.190661f, -0.119565f, -0.105601f, 0.372791f, 0.069867f, 0.078593f, -0.058288f, -0.125787f, -0.150663f, 0.076264f, -0.069255f, -0.066918f, 0.079068f, 0.069122f, -0.137718f, 0.056724f, -0.064946f, 0.100503f, -0.095346f, -0.088200f, 0.082202f, 0.128850f, -0.091522f, 0.053119f, -0.105105f, -0.065365f, -0.077560f, 0.076507f, 0.082116f, 0.080563f, 0.110145f, 0.089444f, -0.101668f, 0.079952f, -0.190967f, 0.066492f, 0.114585f, 0.138968f, -0.110361f, 0.094782f, 0.133148f, -0.074821f, 0.061246f, -0.067111f, 0.098343f, -0.152528f, -0.057043f, 0.062132f, 0.071300f, -0.066096f, -0.166836f, 0.079704f, -0.069645f, -0.202303f, 0.094698f, -0.059964f, -0.104915f, 0.089301f, 0.093055f, -0.066781f, 0.063903f, 0.061909f, -0.115516f, 0.069088f, -0.063146f, -0.104378f, -0.095865f, -0.056355f, -0.094075f, -0.093985f, -0.079681f, 0.085496f, 0.056740f, -0.106161f, 0.097905f, -0.097671f, 0.086063f, 0.081696f, -0.115983f, 0.054778f, -0.061513f, -0.131786f, -0.074048f, -0.059307f, -0.078507f, -0.066056f, 0.141618f, -0.091341f, 0.156616f, 0.073631f, 0.060306f, -0.059909f, -0.079743f, -0.058627f, -0.110235f, -0.095677f, 0.137461f, 0.138676f, -0.052984f, 0.081410f, 0.055588f, -0.117837f, 0.055908f, 0.092754f, 0.057922f, -0.068380f, 0.094217f, -0.097494f, -0.066286f, 0.060210f, -0.085940f, 0.100427f, -0.074738f, 0.089729f, 0.061195f, -0.101693f, -0.071534f, -0.069682f, 0.091535f, -0.103074f, -0.062353f, -0.086785f, 0.079089f, -0.092235f, 0.224546f, 0.117505f, 0.064737f, -0.069397f, -0.105826f, -0.076290f, 0.095309f, -0.142207f, 0.055849f, 0.120625f, -0.097211f, -0.102640f, 0.060200f, -0.055399f, 0.081847f, 0.053141f, -0.115139f, 0.105755f, 0.089493f, -0.091990f, -0.071842f, -0.108915f, 0.124997f, 0.095765f, 0.141720f, -0.071660f, -0.076529f, -0.077643f, -0.069844f, 0.098740f, -0.111048f, -0.072432f, 0.071967f, 0.108154f, -0.083737f, 0.054450f, 0.053991f, 0.063802f, 0.064857f, 0.075676f, 0.070643f, -0.119624f, 0.088466f, 0.147747f, -0.237870f, -0.105732f, -0.056379f, 0.070818f, 0.067076f, 0.095698f, 0.095252f, 0.116080f, -0.077755f, -0.078395f, 0.097508f, 0.076776f, -0.083775f, 0.065864f, 0.079827f, 0.063242f, 0.082370f, -0.055180f, 0.072297f, 0.086980f, -0.086352f, -0.098132f, -0.101631f, -0.066321f, 0.065091f, 0.107743f, 0.100412f, -0.066066f, 0.434015f, 0.079312f, 0.090912f, -0.057825f, 0.118610f, 0.057990f, -0.088746f, -0.084458f, -0.060684f, 0.063572f, -0.071986f, -0.064738f, 0.083619f, 0.130290f, 0.095223f, 0.085437f, 0.086794f, -0.063047f, 0.070751f, -0.099396f, 0.110852f, 0.078883f, 0.079187f, -0.079414f, 0.077379f, 0.096668f, 0.104135f, 0.053412f, 0.075083f, 0.070327f, 0.165216f, 0.053097f, 0.429061f, 0.178421f, -0.108455f, -0.082962f, -0.075473f, -0.088652f, -0.066872f, 0.077307f, -0.082012f, 0.083157f, 0.085768f, 0.083443f, -0.081769f, -0.104645f, -0.080914f, -0.077579f, 0.089668f, -0.073523f, 0.063991f, 0.103504f, 0.065740f, -0.067594f, -0.137218f, 0.079517f, -0.053988f, 0.066474f, 0.079770f, -0.109999f, -0.064579f, 0.091680f, 0.073135f, 0.080483f, -0.146674f, -0.072383f, -0.074140f, -0.381073f, 0.082589f, 0.067797f, -0.061265f, -0.089645f, -0.074897f, 0.093008f, -0.091623f, -0.118359f, -0.083119f, -0.091167f, 0.064869f, -0.059626f, -0.066924f, 0.066929f, -0.054158f, 0.115118f, -0.068412f, -0.085334f, -0.058249f, 0.094661f, -0.057928f, 0.123559f, -0.113534f, 0.095395f, -0.101691f, -0.098922f, 0.059971f, -0.056017f, 0.073927f, -0.075117f, -0.070330f, -0.188404f, 0.073962f, -0.101786f, 0.089274f, 0.087660f, 0.227743f, 0.077488f, 0.095014f, -0.059631f, 0.121604f, -0.100200f, -0.083433f, 0.106718f, 0.065007f, 0.094811f, -0.116039f, -0.086148f, 0.064200f, 0.063629f, -0.061980f, -0.076485f, -0.108413f, 0.062469f, -0.053818f, -0.128979f, -0.096582f, -0.152624f, 0.065526f, -0.082191f, -0.122593f, 0.124993f, -0.128290f, -0.197650f, 0.122333f, -0.060366f, 0.202882f, 0.088416f, -0.126803f, -0.061557f, -0.079983f, -0.058660f, 0.103504f, -0.075617f, -0.088858f, -0.252829f, -0.074642f, 0.088899f, -0.072223f, -0.056361f, 0.077156f, -0.080210f, 0.114706f, -0.071018f, 0.105127f, -0.120218f, 0.077344f, -0.053878f, 0.086495f, 0.116313f, 0.064448f, -0.062610f, -0.067847f, -0.112641f, -0.079479f, -0.063325f, -0.070753f, 0.128840f, 0.091638f, -0.086864f, 0.149006f, -0.074044f, -0.062743f, -0.055477f, -0.115794f, -0.067631f, -0.082295f, -0.076599f, -0.099931f, -0.092122f, -0.471690f, -0.086948f, -0.108109f, 0.061587f, -0.128186f, -0.067302f, 0.168677f, 0.098605f, -0.064599f, -0.103251f, -0.071621f, -0.110273f, -0.060412f, -0.115094f, -0.081459f, -0.095904f, -0.090540f, 0.056991f, 0.065293f, 0.073109f, -0.080704f, 0.098687f, 0.106691f, -0.068385f, 0.065504f, -0.084411f, 0.055321f, 0.099217f, 0.080997f, 0.084305f, 0.121288f, -0.123025f, -0.064514f, -0.115034f, -0.061907f, 0.152601f, 0.078002f, -0.059813f, -0.111105f, -0.101245f, 0.111381f, -0.082950f, 0.084379f, -0.055498f, -0.100341f, 0.103609f, 0.113404f, -0.062819f, 0.058826f, 0.074025f, -0.072279f, -0.053238f, 0.058079f, -0.101197f, 0.055410f, 0.121827f, -0.070070f, 0.099639f, -0.123494f, -0.194852f, -0.113861f, 0.065441f, -0.061665f, -0.103080f, 0.084958f, 0.136278f, 0.065239f, -0.087682f, -0.095401f, 0.123341f, -0.084816f, -0.076672f, 0.196111f, 0.124694f, -0.066422f, -0.129060f, 0.336223f, -0.076171f, -0.064617f, 0.070223f, -0.201192f, 0.071947f, -0.120522f, 0.119531f, -0.076596f, -0.057638f, 0.097587f, -0.079395f, 0.095418f, -0.091876f, 0.121432f, 0.083228f, 0.060240f, -0.087413f, -0.072729f, -0.084709f, 0.129466f, 0.112714f, -0.190852f, 0.078119f, 0.133868f, 0.090492f, 0.111232f, 0.075922f, 0.092044f, -0.065671f, 0.081689f, 0.071693f, 0.105774f, -0.105013f, 0.059728f, 0.324123f, -0.079750f, 0.104205f, -0.105464f, 0.058845f, 0.058746f, -0.104193f, 0.063335f, 0.091341f, -0.066620f, 0.138257f, -0.079375f, 0.100155f, -0.091871f, 0.062939f, -0.109052f, 0.060668f, -0.108103f, -0.084179f, -0.088063f, 0.110145f, -0.114259f, 0.060701f, 0.087397f, -0.072744f, -0.086391f, -0.110863f, 0.093142f, 0.102726f, -0.071066f, 0.102117f, 0.060881f, 0.072317f, 0.074648f, -0.102758f, -0.117675f, -0.092797f, -0.104083f, 0.069390f, -0.058900f, 0.188584f, 0.136279f, -0.055611f, 0.104072f, 0.076322f, 0.057231f, 0.106641f, -0.132608f, -0.173305f, -0.115115f, 0.273793f, -0.209970f, 0.133849f, -0.134251f, -0.088648f, -0.082883f, -0.136335f, -0.092005f, -0.109681f, -0.089341f, -0.067778f, -0.116922f, 0.097223f, 0.056716f, -0.057247f, 0.092344f, 0.160243f, 0.163179f, 0.142455f, 0.092124f, 0.114589f, -0.075370f, 0.083672f, -0.113740f, 0.066512f, -0.206596f, -0.057657f, 0.090034f, 0.162059f, -0.076531f, -0.081342f, -0.062472f, 0.141183f, -0.093186f, 0.163312f, -0.071619f, 0.097369f, -0.111314f, -0.059444f, -0.105618f, 0.164947f, -0.118523f, 0.102135f, 0.108678f, 0.075885f, -0.139764f, -0.134155f, 0.100762f, -0.419332f, 0.082401f, 0.111258f, 0.126308f, 0.088933f, -0.089384f, -0.065887f, -0.123637f, -0.103841f, -0.056012f, -0.091060f, 0.087303f, -0.085463f, 0.072857f, -0.072391f, 0.085927f, 0.088838f, 0.087180f, 0.122134f, 0.105667f, -0.105361f, -0.093400f, -0.098984f, 0.072200f, 0.107180f, -0.096254f, 0.106752f, -0.063001f, -0.062082f, 0.099256f, -0.055623f, 0.077951f, -0.082406f, -0.098686f, -0.059187f, 0.071081f, -0.349078f, 0.066410f, -0.060246f, 0.066808f, 0.091560f, -0.085393f, 0.183885f, -0.061751f, -0.286776f, -0.055606f, -0.075796f, -0.110338f, 0.117096f, -0.188492f, -0.113394f, -0.159410f, -0.083051f, 0.088800f, 0.067413f, 0.069924f, 0.078799f, 0.058942f, 0.126280f, -0.085145f, -0.071811f, -0.053133f, 0.081530f, -0.073752f, 0.084354f, -0.126665f, 0.057673f, -0.116663f, -0.206089f, 0.088604f, 0.068913f, -0.056815f, 0.093770f, 0.081570f, 0.080470f, 0.099195f, 0.099915f, -0.068122f, 0.072254f, 0.094032f, -0.081834f, 0.056119f, -0.064769f, 0.085374f, -0.111755f, 0.071906f, -0.070212f, 0.093546f, -0.078610f, 0.060348f, 0.142498f, 0.056561f, -0.105168f, -0.078448f, 0.093404f, -0.056152f, -0.095997f, -0.096963f, -0.084119f, 0.075435f, -0.074930f, 0.085234f, 0.075033f, -0.097048f, 0.070006f, 0.084622f, -0.079805f, -0.100005f, -0.307054f, -0.071510f, 0.089960f, -0.233358f, 0.074393f, 0.103242f, 0.071744f, 0.144736f, -0.078796f, -0.084506f, -0.053289f, 0.072428f, -0.060879f, -0.060065f, -0.059092f, -0.067308f, 0.058117f, -0.089693f, -0.067332f, -0.075933f, -0.081281f, -0.088880f, 0.079963f, 0.059848f, -0.077609f, 0.071573f, 0.094093f, 0.079767f, -0.112003f, 0.076784f, 0.108407f, 0.097362f, -0.059086f, 0.074601f, -0.086967f, 0.071156f, 0.057568f, -0.054683f, -0.053758f, -0.093249f, 0.076621f, 0.091141f, 0.076074f, -0.138627f, -0.124095f, 0.090138f, -0.089036f, -0.127312f, 0.075826f, 0.090804f, 0.078925f, -0.096807f, 0.065970f, -0.141086f, 0.116195f, 0.075670f, -0.095235f, 0.093793f, 0.118033f, 0.053542f, 0.109963f, 0.055007f, 0.073722f, 0.109445f, 0.079891f, 0.079887f, -0.064858f, -0.068455f, -0.158594f, -0.067170f, -0.115098f, -0.139290f, 0.053243f, -0.093612f, -0.261627f, -0.108891f, 0.222600f, 0.053919f, -0.129768f, -0.087054f, 0.072661f, 0.070153f, -0.058701f, 0.084627f, -0.076593f, -0.104696f, 0.094363f, 0.133087f, 0.113873f, -0.105221f, -0.129220f, 0.056500f, -0.059523f, -0.114181f, 0.088517f, 0.109046f, 0.095644f, 0.058836f, -0.144569f, -0.096996f, 0.091371f, 0.072351f, -0.111748f, 0.197189f, 0.230785f, 0.110601f, -0.169553f, -0.239262f, -0.068710f, -0.055466f, -0.089037f, -0.076485f, -0.090558f, -0.069343f, -0.113643f, -0.133332f, -0.134870f, -0.078731f, 0.058234f, 0.062501f, 0.090757f, -0.059376f, -0.161736f, -0.066721f };
+static const float smart_transformer_fault_detection_sparse_layer_1_biases[361] = { 0.316082f, -0.262754f, 0.111589f, -0.005428f, 0.020452f, -0.207043f, 0.455264f, -0.225887f, 0.314368f, 0.391790f, 0.328651f, -0.318739f, -0.099719f, -0.445660f, 0.472864f, 0.373622f, -0.217528f, -0.073245f, 0.531649f, -0.294819f, 0.052615f, 0.020305f, -0.205202f, -0.360689f, 0.240479f, 0.423777f, 0.271403f, 0.096422f, -0.113085f, 0.143935f, 0.247968f, -0.245413f, -0.400355f, 0.152670f, 0.134182f, 0.071191f, -0.259684f, -0.041431f, 0.360258f, 0.013650f, -0.379208f, 0.171529f, 0.073447f, -0.029795f, 0.096714f, 0.467702f, -0.354663f, 0.499806f, 0.452689f, -0.152121f, 0.132960f, -0.070639f, 0.026036f, 0.494596f, 0.214133f, -0.523266f, 0.005042f, -0.126838f, 0.164278f, 0.081512f, 0.048055f, -0.006861f, -0.023079f, 0.216059f, -0.086537f, 0.157147f, 0.033509f, -0.149667f, -0.214207f, 0.132961f, 0.028283f, -0.454399f, 0.515352f, 0.365467f, 0.506553f, 0.199613f, -0.090788f, 0.009450f, -0.135435f, 0.256865f, 0.056108f, -0.108974f, 0.505980f, -0.107679f, -0.005419f, -0.068659f, -0.032838f, 0.240237f, -0.165053f, -0.441607f, 0.148545f, 0.376213f, 0.067124f, 0.010830f, -0.284774f, 0.443160f, 0.409566f, 0.240567f, -0.416773f, -0.131860f, 0.086750f, 0.377254f, 0.367970f, -0.100140f, 0.072572f, -0.348421f, -0.332453f, -0.466854f, -0.039930f, -0.227641f, 0.042827f, -0.196930f, -0.239756f, -0.032046f, -0.094583f, 0.287645f, -0.007995f, -0.124975f, -0.067830f, -0.026277f, -0.191175f, 0.117660f, -0.226129f, -0.039406f, 0.156966f, 0.014838f, 0.110966f, 0.279159f, 0.100746f, 0.105193f, 0.043139f, -0.190608f, -0.229404f, -0.022548f, -0.201653f, -0.157456f, -0.064543f, -0.405224f, 0.052044f, -0.267656f, 0.129182f, 0.164330f, -0.217430f, 0.369861f, 0.254255f, -0.302253f, 0.192512f, -0.082043f, -0.466702f, -0.136919f, -0.045317f, 0.113985f, -0.374265f, 0.251155f, 0.321602f, -0.084668f, 0.295101f, 0.086487f, 0.009534f, -0.112491f, -0.016468f, 0.032940f, -0.112074f, -0.323442f, -0.118200f, -0.281468f, 0.174948f, -0.342668f, -0.180872f, 0.572926f, 0.359578f, 0.074446f, -0.278513f, -0.106781f, 0.091376f, -0.213287f, -0.124248f, 0.542383f, -0.100363f, -0.102856f, -0.574148f, 0.211258f, -0.021435f, 0.128155f, -0.174616f, -0.119139f, 0.424459f, 0.198743f, 0.134380f, -0.278720f, -0.481820f, 0.177295f, 0.387705f, 0.159847f, 0.162470f, 0.039794f, -0.083010f, -0.082572f, -0.512400f, -0.117575f, 0.005009f, -0.007360f, 0.135948f, -0.464846f, 0.530059f, 0.163581f, -0.049386f, 0.171909f, -0.109014f, 0.157169f, 0.057123f, 0.045394f, 0.031070f, 0.062128f, -0.329584f, 0.127813f, 0.062633f, -0.392942f, -0.541034f, 0.285472f, -0.370341f, 0.536444f, -0.087371f, 0.216804f, 0.310381f, 0.487301f, 0.248452f, -0.208804f, -0.041167f, 0.002130f, 0.083944f, 0.142704f, 0.130654f, 0.215516f, -0.016916f, -0.192174f, 0.019685f, 0.234422f, -0.129551f, -0.359743f, 0.512077f, 0.353244f, -0.540099f, -0.063297f, -0.027714f, 0.251205f, -0.302007f, 0.010542f, 0.251001f, 0.089347f, 0.267314f, 0.078421f, 0.328825f, -0.226694f, -0.092608f, 0.194013f, -0.177443f, 0.153374f, 0.141395f, -0.121907f, -0.191595f, -0.453638f, -0.051243f, 0.059793f, 0.086006f, -0.011829f, -0.264339f, 0.555249f, -0.111649f, 0.584164f, -0.261319f, -0.385814f, -0.028794f, 0.147023f, -0.225267f, 0.508450f, -0.024090f, 0.438384f, -0.120514f, 0.253520f, -0.057473f, 0.290107f, -0.257885f, -0.371311f, 0.055004f, 0.358173f, -0.425751f, 0.091566f, -0.039867f, 0.123395f, 0.133062f, -0.389859f, 0.234005f, 0.166009f, -0.319521f, 0.533170f, 0.216430f, 0.055312f, 0.415232f, 0.039448f, 0.060895f, 0.185712f, 0.014011f, -0.340363f, 0.475809f, 0.113842f, -0.181715f, -0.018634f, 0.112662f, 0.054813f, 0.124936f, 0.315971f, 0.419851f, 0.543879f, -0.009045f, -0.093768f, 0.191986f, -0.277651f, -0.471086f, -0.158981f, 0.173849f, 0.111091f, 0.247653f, 0.203049f, -0.051377f, 0.267284f, 0.106042f, 0.082689f, -0.096616f, -0.410873f, -0.094880f, -0.267229f, -0.297889f, 0.189369f, 0.085083f, 0.475327f, -0.426305f, -0.523376f, -0.115869f, 0.114062f, -0.148503f, -0.117076f, -0.070157f, -0.003154f, -0.008408f, 0.004422f, 0.083586f, -0.242123f, -0.067924f, -0.355580f, 0.172569f, -0.237119f, -0.501784f, -0.398051f, 0.013217f, -0.406354f, -0.125160f, 0.091110f, -0.055862f, 0.153019f, 0.321282f };
+static const uint16_t smart_transformer_fault_detection_sparse_layer_2_row_ptr[6] = { 0, 361, 722, 1083, 1444, 1805 };
+static const uint16_t smart_transformer_fault_detection_sparse_layer_2_col_index[1805] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360 };
+static const float smart_transformer_fault_detection_sparse_layer_2_values[1805] = { 0.240654f, 0.096995f, -0.391139f, 0.235464f, 0.165044f, 0.071401f, -0.094973f, 0.038622f, -0.001949f, -0.142750f, -0.205415f, 0.185974f, -0.086014f, 0.039910f, 0.113523f, 0.034746f, 0.373402f, -0.035149f, -0.054557f, -0.010987f, 0.334125f, -0.368840f, -0.043829f, -0.023103f, -0.056989f, 0.034870f, -0.128963f, -0.214862f, -0.103384f, -0.358586f, -0.118341f, -0.033568f, 0.012533f, -0.107995f, -0.136993f, 0.081517f, 0.118272f, 0.102166f, 0.018405f, -0.113331f, 0.083534f, -0.382602f, -0.209238f, -0.308056f, -0.419313f, -0.039751f, -0.057030f, -0.011506f, -0.004994f, -0.157387f, -0.328586f, -0.152211f, 0.186941f, -0.074515f, -0.173481f, -0.006110f, 0.231635f, 0.297389f, -0.017294f, -0.005389f, -0.177322f, -0.220152f, 0.148581f, -0.296298f, 0.113844f, 0.007537f, 0.228104f, 0.351055f, 0.212231f, -0.226146f, -0.279592f, 0.190016f, -0.089383f, -0.042004f, -0.063855f, -0.139929f, -0.136634f, 0.182587f, 0.429752f, -0.055453f, 0.148036f, 0.072125f, -0.142411f, -0.186604f, -0.110260f, -0.207966f, -0.068630f, 0.078916f, 0.171825f, 0.020948f, -0.272672f, -0.218637f, 0.239340f, 0.221679f, -0.021577f, -0.156279f, -0.106016f, -0.132866f, 0.095652f, 0.120951f, 0.050891f, -0.167596f, -0.117827f, -0.261894f, -0.333160f, 0.171675f, -0.060884f, 0.147179f, 0.305902f, -0.038304f, 0.240674f, 0.084787f, -0.217772f, -0.029098f, -0.160239f, 0.072372f, 0.148033f, 0.129397f, 0.200093f, -0.218849f, 0.066181f, 0.140149f, -0.124319f, 0.064333f, -0.154186f, -0.137226f, 0.080322f, -0.229601f, -0.082338f, 0.023921f, -0.411084f, 0.347171f, 0.081132f, -0.265864f, 0.113287f, 0.101202f, -0.071318f, 0.056796f, -0.125435f, 0.032195f, -0.082235f, 0.053249f, 0.017720f, -0.121973f, -0.132815f, 0.171634f, -0.010901f, 0.019279f, 0.138665f, -0.074585f, -0.272641f, -0.042404f, 0.123850f, 0.062601f, -0.050317f, 0.258410f, -0.154728f, 0.118037f, 0.233283f, -0.144688f, 0.237514f, -0.380506f, -0.137893f, 0.198683f, -0.222066f, 0.044546f, -0.096786f, 0.083134f, 0.136723f, -0.110004f, -0.152498f, 0.114244f, 0.106483f, -0.126203f, 0.058206f, 0.070816f, -0.134126f, 0.084109f, 0.152583f, -0.190578f, 0.087127f, -0.119587f, 0.195973f, -0.192148f, 0.284901f, 0.304104f, 0.005768f, -0.042382f, -0.116599f, 0.094300f, 0.006770f, 0.050264f, -0.094379f, -0.047668f, -0.296222f, 0.143626f, -0.025262f, -0.077987f, -0.022820f, -0.006150f, 0.188824f, -0.158279f, 0.140604f, 0.132978f, -0.065629f, -0.090298f, 0.062549f, 0.146949f, 0.184085f, 0.066728f, -0.106250f, 0.289251f, -0.188497f, -0.173112f, -0.137059f, 0.088396f, -0.013960f, 0.050504f, 0.054478f, 0.142285f, 0.048321f, 0.027931f, -0.190734f, -0.167593f, 0.058275f, -0.033739f, -0.185529f, 0.064325f, -0.155633f, -0.187884f, 0.089008f, -0.275888f, -0.297313f, 0.209464f, -0.264630f, 0.191463f, -0.190774f, -0.175042f, 0.339722f, -0.012289f, -0.100432f, -0.135182f, -0.100063f, 0.163264f, -0.203371f, 0.002825f, 0.156979f, -0.098144f, -0.145667f, 0.072559f, 0.161907f, 0.134127f, 0.152262f, 0.148474f, 0.003346f, -0.031118f, 0.097800f, -0.072582f, 0.270542f, -0.040692f, 0.212952f, 0.042600f, -0.059818f, -0.281599f, -0.380483f, 0.173998f, 0.232177f, 0.077593f, 0.207717f, -0.136662f, 0.155133f, 0.160181f, 0.240879f, 0.245973f, 0.154491f, -0.083645f, -0.182491f, -0.038509f, -0.066941f, -0.230910f, -0.118038f, -0.066567f, -0.030105f, 0.065549f, 0.000930f, -0.147183f, 0.220813f, -0.037489f, -0.171825f, -0.384459f, -0.117111f, -0.020561f, -0.092578f, -0.241246f, 0.003929f, 0.070776f, -0.115535f, -0.045771f, -0.161067f, -0.359497f, 0.158945f, -0.123972f, -0.102680f, -0.075360f, -0.032744f, 0.099185f, -0.058033f, 0.115836f, 0.247882f, 0.242151f, -0.212885f, -0.073866f, -0.084073f, -0.126756f, -0.368394f, 0.152367f, -0.123551f, -0.059540f, -0.082132f, 0.194974f, 0.088042f, -0.254257f, -0.104385f, -0.041544f, 0.295008f, -0.138899f, -0.168983f, 0.059993f, -0.243342f, -0.063949f, 0.432663f, 0.161767f, 0.160813f, -0.112124f, 0.270245f, -0.149462f, 0.017380f, -0.019481f, 0.140707f, -0.156503f, 0.130266f, 0.081788f, -0.035541f, 0.074541f, 0.202331f, -0.116675f, -0.035380f, 0.134065f, -0.010908f, 0.158209f, 0.232782f, 0.120162f, 0.039524f, 0.132725f, -0.277680f, -0.091432f, 0.031353f, -0.188474f, 0.153054f, -0.364528f, -0.037712f, -0.138990f, -0.154136f, 0.123652f, -0.017338f, -0.050781f, -0.046352f, -0.224958f, -0.034795f, 0.222588f, 0.202559f, 0.009150f, -0.224599f, 0.041329f, 0.097575f, -0.179331f, 0.279860f, -0.174441f, -0.037889f, -0.183591f, 0.106236f, 0.119562f, 0.071079f, 0.054796f, -0.132244f, 0.032151f, 0.261171f, 0.167895f, -0.086386f, 0.020267f, -0.000196f, 0.117618f, -0.013363f, -0.332035f, -0.173265f, -0.117516f, -0.108705f, -0.218842f, 0.159856f, 0.003208f, -0.078686f, 0.125092f, 0.056321f, 0.038403f, -0.084563f, -0.028241f, -0.113118f, 0.146390f, 0.257322f, 0.269137f, -0.127036f, 0.092232f, 0.083364f, 0.021251f, 0.094980f, 0.244024f, 0.229720f, 0.058324f, 0.046665f, 0.078166f, 0.160802f, -0.108034f, -0.142008f, 0.007232f, -0.003354f, -0.072112f, 0.102706f, -0.029721f, -0.153460f, 0.027701f, 0.077248f, 0.013758f, -0.130042f, 0.172291f, 0.234470f, 0.054069f, -0.008042f, -0.124086f, 0.134273f, -0.085360f, -0.166667f, 0.078040f, -0.078452f, -0.060695f, -0.025455f, -0.110433f, -0.002994f, 0.055650f, -0.109356f, -0.202883f, -0.218368f, 0.128061f, 0.212957f, -0.071578f, 0.004626f, -0.257781f, -0.218585f, -0.119959f, 0.211863f, -0.213062f, 0.042515f, 0.071880f, 0.249785f, 0.302574f, 0.094125f, 0.008560f, 0.111750f, 0.130659f, -0.069072f, -0.017690f, 0.042441f, 0.089591f, -0.162173f, 0.106141f, -0.044492f, -0.152933f, 0.128534f, -0.009404f, 0.119000f, 0.083646f, 0.030405f, -0.145419f, 0.132566f, -0.137829f, 0.027679f, -0.099016f, 0.037582f, 0.172844f, 0.180505f, 0.034529f, 0.172889f, 0.059872f, 0.012089f, -0.224223f, -0.031256f, -0.130491f, -0.194034f, 0.012361f, -0.280827f, -0.007600f, 0.152202f, 0.208728f, 0.114011f, -0.140186f, -0.166645f, -0.106523f, 0.080804f, 0.126374f, 0.018562f, -0.262582f, 0.067701f, 0.056629f, 0.109412f, 0.021410f, -0.132979f, 0.198877f, -0.018701f, 0.260909f, -0.007265f, 0.089393f, 0.038663f, 0.113329f, -0.086428f, 0.133513f, 0.145693f, -0.242170f, 0.130592f, -0.082197f, -0.181189f, -0.034896f, 0.154595f, 0.071906f, 0.061162f, 0.141825f, 0.067162f, 0.106665f, -0.062582f, -0.189970f, -0.211244f, -0.140472f, -0.120531f, 0.197086f, 0.054748f, 0.004227f, 0.141949f, -0.155213f, -0.107937f, -0.054144f, 0.178716f, 0.116734f, 0.200727f, -0.280928f, 0.152078f, -0.199766f, 0.008127f, 0.137269f, 0.084915f, 0.126839f, -0.129682f, 0.102644f, 0.009086f, -0.189091f, 0.066519f, 0.060487f, 0.241595f, -0.197861f, 0.092551f, -0.105470f, 0.213595f, -0.057139f, -0.120463f, -0.062957f, 0.042798f, -0.083953f, -0.049902f, 0.166351f, 0.125784f, -0.086549f, -0.242171f, 0.054284f, 0.249330f, -0.114918f, -0.014082f, 0.062761f, -0.158419f, -0.118945f, 0.294570f, 0.235267f, -0.029443f, -0.077929f, 0.022388f, -0.016804f, 0.048778f, -0.040393f, 0.155324f, -0.096361f, -0.030835f, -0.098129f, -0.130537f, 0.026886f, 0.129421f, -0.208660f, 0.275099f, 0.186976f, 0.140985f, -0.060550f, 0.234108f, -0.071281f, -0.100149f, 0.139037f, 0.015083f, -0.001514f, 0.070977f, 0.233273f, -0.025003f, -0.160418f, -0.008107f, 0.088011f, -0.029687f, -0.102282f, -0.086806f, -0.132521f, -0.168333f, 0.009282f, -0.003895f, 0.084516f, -0.018943f, -0.045705f, -0.075758f, 0.065138f, 0.306398f, -0.117591f, -0.138048f, 0.008492f, 0.175481f, 0.107367f, -0.203644f, -0.004401f, -0.113372f, -0.070403f, -0.157216f, 0.011131f, -0.131596f, -0.132819f, 0.184499f, -0.074952f, -0.013263f, 0.207590f, 0.078519f, -0.098812f, 0.027313f, -0.148941f, 0.098053f, -0.011343f, 0.115113f, -0.025816f, -0.154092f, 0.140187f, 0.128906f, -0.253847f, 0.038813f, 0.010251f, 0.111852f, -0.131076f, -0.238213f, -0.144316f, 0.007995f, -0.126773f, -0.099687f, -0.090131f, 0.126405f, 0.074743f, -0.085460f, 0.143582f, 0.184093f, -0.004416f, 0.051697f, -0.109769f, 0.145872f, 0.187784f, 0.080460f, -0.013679f, 0.069519f, 0.098120f, -0.074829f, 0.016576f, 0.173576f, 0.006587f, 0.117964f, 0.066643f, 0.182906f, 0.009498f, -0.063031f, -0.255403f, 0.011315f, -0.074163f, -0.175770f, 0.175629f, -0.410485f, -0.067354f, 0.056831f, 0.091700f, 0.116050f, -0.009194f, 0.147592f, -0.089990f, 0.033349f, 0.008450f, 0.111944f, -0.082261f, -0.199791f, -0.006888f, -0.091516f, 0.207463f, 0.156778f, 0.098014f, 0.178632f, 0.099311f, -0.074082f, 0.151127f, 0.206822f, -0.137986f, 0.074436f, 0.116480f, -0.037645f, 0.071316f, 0.054630f, -0.184397f, 0.233465f, -0.138326f, -0.194781f, -0.019536f, 0.020176f, 0.112233f, -0.001794f, -0.293266f, -0.215548f, -0.017143f, -0.254458f, -0.034221f, -0.198112f, -0.121084f, 0.100748f, -0.054600f, -0.123429f, -0.278232f, -0.142599f, 0.077179f, 0.048732f, 0.105344f, -0.046239f, 0.168990f, 0.157218f, -0.122145f, 0.196344f, -0.099714f, 0.005026f, -0.026117f, 0.036474f, -0.123652f, -0.184257f, 0.117293f, 0.118526f, 0.189231f, 0.044149f, -0.023322f, -0.046647f, 0.254679f, -0.033720f, 0.163364f, 0.001585f, -0.054573f, 0.167848f, 0.027998f, -0.116009f, 0.331223f, -0.032401f, 0.059189f, -0.055052f, -0.241747f, 0.105210f, -0.155431f, 0.014069f, 0.051240f, -0.072303f, 0.142715f, -0.026857f, -0.030103f, -0.131337f, -0.080126f, -0.122626f, 0.090930f, 0.009098f, -0.196115f, 0.238583f, -0.060281f, 0.396405f, 0.183940f, 0.041836f, -0.161261f, -0.019811f, 0.016343f, 0.073475f, -0.131124f, 0.371304f, -0.142635f, 0.118645f, -0.148015f, -0.012024f, 0.004454f, 0.057037f, -0.131420f, 0.229270f, 0.042689f, 0.022205f, -0.003213f, 0.186455f, 0.068801f, -0.067924f, -0.037494f, 0.206824f, 0.045361f, 0.129726f, 0.016120f, -0.128095f, 0.066032f, 0.098280f, 0.147708f, -0.201382f, -0.261019f, 0.028525f, -0.139790f, 0.084521f, -0.065905f, -0.177276f, 0.040219f, -0.035869f, -0.006938f, 0.071087f, -0.042961f, -0.139560f, 0.132927f, -0.238161f, 0.091527f, -0.213643f, -0.119900f, 0.154911f, -0.081663f, 0.012503f, 0.159580f, 0.032065f, 0.088885f, 0.098454f, -0.116653f, 0.072662f, 0.024470f, -0.012211f, -0.003563f, 0.067106f, -0.053448f, -0.041752f, -0.127690f, -0.044878f, 0.148386f, -0.202006f, 0.102971f, 0.047143f, 0.098676f, 0.083317f, -0.080928f, 0.215601f, -0.065771f, -0.082869f, -0.013896f, -0.242579f, 0.107004f, -0.131766f, -0.041905f, -0.139125f, 0.089997f, -0.061994f, 0.100541f, 0.018496f, 0.035699f, 0.068955f, -0.017375f, -0.139240f, -0.182526f, 0.129889f, 0.157854f, -0.175917f, 0.423018f, 0.273067f, 0.147700f, -0.164400f, 0.120937f, 0.033566f, 0.068912f, -0.140699f, -0.212242f, 0.038688f, 0.000534f, 0.152489f, 0.158137f, 0.020854f, 0.067736f, -0.030621f, 0.050309f, 0.266630f, 0.131869f, 0.113952f, -0.019609f, 0.166815f, -0.116637f, 0.106212f, -0.176724f, 0.163955f, -0.095968f, 0.142423f, -0.094430f, -0.166018f, 0.004924f, 0.017845f, -0.020025f, 0.171260f, 0.119908f, 0.194485f, 0.187895f, -0.036251f, 0.127520f, 0.140779f, 0.126517f, 0.104305f, 0.048652f, -0.019780f, 0.119095f, -0.130885f, -0.148294f, 0.008227f, 0.044816f, -0.341843f, -0.056512f, -0.134919f, 0.379806f, 0.114615f, 0.038232f, -0.134223f, -0.173498f, 0.237541f, -0.137442f, -0.074074f, -0.106076f, -0.017395f, 0.225202f, 0.202349f, -0.112414f, -0.040537f, -0.191790f, 0.065399f, 0.093795f, -0.149561f, -0.069271f, 0.205883f, -0.073638f, 0.014922f, -0.161001f, 0.085926f, 0.023693f, -0.202070f, -0.074640f, 0.115322f, 0.189478f, -0.196335f, 0.014302f, 0.163744f, -0.131820f, -0.043071f, 0.094472f, -0.035681f, -0.148411f, 0.071330f, -0.010500f, -0.087112f, -0.264462f, -0.072527f, 0.037363f, 0.020365f, 0.048721f, 0.087668f, 0.006712f, -0.084963f, -0.227919f, 0.077315f, 0.157833f, 0.066286f, -0.157380f, 0.032747f, 0.141897f, -0.035391f, -0.040625f, -0.097011f, -0.085794f, -0.054525f, 0.096255f, 0.080630f, -0.019273f, 0.130212f, 0.176803f, 0.176999f, 0.075462f, 0.049253f, 0.257414f, -0.045855f, 0.121069f, -0.049746f, -0.056410f, 0.222939f, 0.308261f, 0.073786f, 0.099040f, 0.154732f, 0.061398f, 0.045148f, 0.178784f, -0.157493f, 0.086711f, 0.122965f, -0.139445f, -0.115829f, 0.110641f, 0.132479f, -0.074498f, 0.044041f, 0.165431f, 0.256563f, 0.395878f, 0.010861f, -0.039899f, 0.016812f, 0.109409f, -0.073829f, -0.163226f, 0.003534f, 0.079737f, 0.195152f, 0.086149f, -0.078002f, -0.079644f, 0.241328f, -0.172364f, 0.135728f, 0.141114f, -0.184624f, -0.212755f, 0.068787f, 0.239588f, 0.121272f, -0.084508f, 0.029999f, 0.191269f, 0.113819f, 0.138128f, -0.187328f, 0.025233f, -0.113582f, 0.039027f, 0.049580f, -0.032545f, 0.003619f, 0.142678f, -0.155399f, -0.113139f, -0.102426f, 0.131065f, -0.279826f, -0.131304f, -0.081192f, -0.065363f, -0.025047f, 0.113491f, -0.156110f, 0.147960f, -0.109048f, -0.036405f, 0.116203f, 0.312285f, -0.261296f, -0.236001f, 0.161588f, -0.113199f, 0.130220f, -0.085800f, -0.013978f, -0.094425f, 0.080932f, 0.290070f, 0.189751f, -0.063466f, 0.037650f, 0.075946f, 0.153100f, 0.047389f, 0.271095f, -0.390590f, 0.237040f, 0.194022f, -0.000163f, 0.211308f, -0.103718f, -0.141107f, 0.191277f, 0.252770f, 0.164618f, 0.019627f, 0.067057f, 0.060348f, 0.288447f, 0.309414f, -0.244691f, 0.153918f, 0.014011f, 0.014658f, -0.214980f, -0.264191f, -0.085338f, 0.308266f, 0.329586f, 0.298333f, 0.046535f, 0.129559f, -0.074826f, -0.139831f, 0.131012f, 0.232874f, 0.278928f, 0.031828f, -0.119862f, -0.083042f, -0.231082f, -0.477623f, 0.043345f, 0.070995f, 0.102060f, 0.053746f, 0.300721f, 0.117592f, -0.004189f, -0.210101f, -0.099300f, 0.125566f, -0.096139f, 0.054464f, -0.077490f, 0.240659f, 0.108173f, -0.128933f, -0.117116f, -0.137128f, -0.113609f, 0.268682f, -0.086200f, -0.181843f, -0.004509f, -0.130443f, -0.163919f, -0.158540f, 0.404929f, 0.284641f, 0.275673f, 0.422308f, -0.197385f, -0.013831f, 0.086398f, 0.258983f, -0.077082f, -0.054926f, -0.388563f, -0.064533f, -0.013404f, 0.167296f, 0.037447f, 0.076827f, -0.096262f, -0.251537f, -0.078973f, 0.052267f, 0.331176f, 0.174661f, -0.041229f, 0.100551f, 0.100104f, -0.322449f, -0.038381f, -0.281736f, -0.107587f, 0.091988f, -0.033130f, 0.347574f, -0.122003f, -0.248559f, -0.025461f, -0.141339f, 0.304828f, 0.274258f, -0.322977f, 0.143218f, -0.043676f, -0.235712f, 0.078836f, -0.312763f, -0.008656f, -0.065147f, -0.296517f, 0.439780f, -0.114708f, 0.046263f, 0.336265f, -0.051681f, 0.100859f, 0.315212f, 0.066964f, 0.036553f, 0.098031f, -0.094418f, -0.131526f, 0.187378f, 0.061561f, 0.043748f, -0.186801f, 0.095074f, 0.060934f, 0.042894f, 0.212459f, 0.379683f, 0.080842f, 0.013261f, 0.019940f, -0.075724f, 0.120525f, -0.016389f, -0.389998f, -0.205392f, 0.236947f, -0.306467f, 0.358187f, -0.114964f, -0.161684f, 0.315393f, -0.006166f, -0.262454f, 0.065159f, 0.235960f, -0.156107f, -0.033221f, -0.093591f, 0.124938f, 0.151282f, -0.389669f, -0.192828f, 0.241596f, 0.197062f, 0.116911f, 0.202780f, -0.066705f, -0.118383f, -0.283464f, 0.162669f, -0.063554f, -0.098128f, -0.076165f, -0.106074f, -0.282010f, -0.220225f, -0.035998f, -0.159414f, -0.083504f, 0.136360f, 0.069835f, -0.145947f, 0.014527f, -0.104509f, -0.175873f, 0.200222f, -0.223178f, 0.333584f, -0.374638f, 0.010186f, 0.058359f, -0.297790f, -0.168587f, -0.086838f, -0.226368f, 0.236004f, 0.062384f, -0.235844f, 0.090580f, 0.028966f, -0.077345f, 0.204178f, -0.053159f, -0.043558f, 0.116731f, -0.165740f, 0.149301f, -0.164936f, 0.358221f, 0.186286f, -0.101000f, -0.114698f, 0.019378f, 0.032736f, 0.349209f, 0.199544f, -0.321964f, -0.017818f, 0.032442f, -0.196363f, 0.427325f, 0.244355f, 0.081445f, 0.219825f, 0.020332f, 0.117120f, -0.044025f, 0.027917f, -0.179187f, 0.065799f, 0.447325f, -0.104240f, 0.026620f, -0.205620f, -0.126524f, -0.452402f, -0.064513f, -0.073096f, -0.138103f, 0.152252f, -0.092600f, 0.077685f, 0.220954f, 0.035052f, -0.321831f, 0.338068f, 0.061707f, 0.119803f, 0.262150f, 0.196123f, 0.281175f, -0.344550f, -0.158547f, 0.109588f, 0.083600f, -0.127102f, 0.131574f, -0.159164f, -0.354699f, -0.072418f, 0.017048f, -0.059525f, 0.109543f, 0.216771f, 0.493062f, 0.271807f, 0.272992f, 0.269807f, 0.119685f, -0.126376f, -0.208392f, -0.137031f, -0.310254f, -0.182999f, 0.051809f, 0.266424f, 0.252549f, -0.053523f, 0.145890f, 0.063676f, -0.016283f, 0.080298f, -0.138773f, -0.126127f, 0.067363f, 0.350416f, -0.271378f, -0.193612f, 0.196105f, 0.059311f, 0.193360f, -0.239993f, 0.102712f, -0.137489f, -0.419562f, -0.348960f, 0.305675f, -0.002670f, -0.141868f, 0.027052f, 0.395571f, 0.147305f, 0.260244f, -0.213945f, 0.057364f, -0.034786f, -0.083732f, 0.021414f, 0.091293f, 0.236146f, -0.105167f, 0.148935f, -0.041233f, 0.243736f, -0.098554f, -0.142586f, -0.148484f, 0.085726f, 0.010871f, -0.159509f, -0.361859f, 0.245735f, -0.148802f, -0.040824f, 0.057097f, -0.006135f, -0.042311f, -0.085195f, 0.143501f, -0.266857f, -0.354343f, 0.298764f, 0.139102f, -0.000432f, 0.365678f, 0.137311f, -0.294894f, -0.234081f, -0.062261f, -0.062028f, 0.420251f, 0.116391f, 0.220179f, 0.186742f, -0.001984f, 0.153859f, -0.014199f, 0.185032f, -0.005521f, -0.108138f, 0.011710f, 0.033919f, -0.086329f, -0.020891f, 0.119288f, 0.123926f, -0.082213f, -0.159129f, 0.002572f, -0.167130f, 0.038441f, 0.211387f, -0.006301f, 0.046222f, -0.165505f, 0.359581f, -0.171759f, 0.115213f, 0.027594f, -0.046025f, 0.173662f, 0.023269f, -0.148490f, -0.025659f, -0.119906f, 0.106094f, -0.091454f, 0.011752f, -0.111375f, -0.037544f, -0.043707f, 0.055088f, 0.172912f, -0.034432f, 0.057986f, 0.162179f, 0.065864f, -0.218697f, 0.019795f, 0.060493f, -0.072499f, 0.120649f, 0.029623f, -0.089470f, -0.089564f, -0.029427f, 0.071247f, -0.002369f, -0.219526f, 0.099023f, -0.041773f, 0.001094f, -0.262665f, -0.031423f, -0.100815f, -0.126007f, -0.022655f, 0.134900f, 0.036068f, 0.055997f, -0.066398f, -0.058932f, -0.099626f, -0.054873f, 0.065079f, -0.109104f, 0.048959f, 0.059767f, 0.172371f, -0.051480f, -0.119105f, -0.194948f, 0.115220f, 0.087060f, 0.016182f, -0.092935f, -0.073887f, 0.099638f, 0.017512f, -0.091754f, -0.241594f, -0.176551f, -0.008461f, -0.151788f, 0.238242f, 0.023569f, 0.134149f, 0.005165f, -0.116974f, 0.002456f, 0.130515f, 0.017563f, 0.129269f, 0.214724f, -0.027955f, 0.087871f, -0.123704f, -0.084872f, 0.033462f, 0.093546f, -0.091624f, -0.047778f, -0.023172f, 0.132399f, 0.063083f, -0.072802f, 0.129800f, 0.123918f, 0.051559f, -0.054442f, 0.113165f, -0.164987f, -0.164774f, -0.037791f, 0.110741f, 0.016158f, -0.096316f, 0.042426f, 0.094557f, -0.040962f, 0.027505f, 0.079007f, -0.106210f, 0.140847f, -0.057676f, 0.124900f, 0.158450f, -0.053180f, -0.133393f, 0.136511f, -0.053900f, 0.063715f, 0.019197f, -0.121835f, 0.117117f, -0.079150f, -0.066471f, -0.094011f, -0.070228f, -0.073898f, -0.080587f, 0.069099f, -0.064835f, -0.154115f, 0.080261f, 0.078636f, -0.155213f, -0.098809f, -0.156781f, 0.160508f, 0.103102f, 0.040810f, -0.086970f, 0.043576f, 0.126716f, -0.109265f, -0.138369f, 0.135677f, 0.012914f, 0.031539f, -0.172529f, -0.107276f, -0.100591f, 0.003993f, 0.137112f, -0.100217f, -0.179600f, -0.008575f, -0.118698f, 0.027693f, -0.055765f, 0.218927f, -0.063539f, 0.062595f, 0.237809f, -0.057134f, -0.065050f, -0.158661f, 0.083768f, -0.038327f, -0.022412f, -0.029931f, 0.126247f, -0.092511f, 0.099023f, 0.123481f, 0.022745f, -0.063800f, -0.075937f, 0.181285f, 0.037176f, 0.071095f, -0.067250f, 0.035041f, 0.102783f, -0.154759f, -0.137323f, 0.166757f, 0.036473f, 0.105923f, -0.096920f, 0.053015f, 0.180550f, 0.111832f, -0.062217f, -0.085840f, -0.103992f, 0.026507f, 0.180555f, -0.050773f, 0.087028f, 0.011075f, 0.095738f, 0.077825f, -0.087184f, 0.187982f, -0.095465f, 0.162556f, -0.071725f, -0.231133f, -0.084930f, 0.240239f, -0.022462f, 0.015719f, 0.113938f, -0.147871f, 0.034815f, 0.163804f, 0.096377f, 0.006921f, 0.019033f, 0.044072f, -0.105321f, 0.127182f, 0.014937f, -0.000985f, -0.254262f, -0.064721f, -0.145621f, -0.244199f, -0.094730f, -0.112421f, -0.096158f, 0.146544f, 0.084082f, 0.065264f, 0.090804f, 0.030630f, -0.108613f, 0.004466f, 0.061480f, 0.136996f, -0.119067f, -0.041509f, 0.148312f, 0.092658f, -0.104260f, 0.035733f, 0.031074f, -0.116316f, -0.015654f, 0.068345f, 0.023856f, -0.072436f, 0.345653f, -0.131244f, -0.091794f, -0.060337f, -0.099691f, 0.080824f, 0.032609f, -0.179783f, -0.090197f, -0.144607f, 0.282082f, 0.092871f, 0.113287f, -0.132175f, 0.054534f, 0.089776f, -0.184591f, 0.021355f, -0.113959f, -0.184570f, -0.175645f, -0.079958f, 0.023936f, -0.025017f, -0.274588f, 0.147102f, 0.069472f, 0.017337f, -0.117222f, -0.091821f, 0.125104f, 0.098134f, -0.072470f, 0.082134f, 0.129099f, 0.110664f, -0.109066f, 0.207900f, 0.065321f, -0.084472f, -0.077437f, 0.088022f, 0.178614f, 0.023693f, -0.144879f, 0.063881f, -0.157587f, -0.005726f, -0.172026f, 0.097230f, -0.057031f, -0.017406f, 0.078352f, 0.192886f, 0.100577f, -0.120644f, 0.087592f, -0.051989f, 0.151123f, 0.019528f, 0.028980f, -0.060552f, -0.240821f, 0.042546f, -0.111991f, 0.014943f, 0.070857f, -0.051713f, 0.224532f, -0.157209f, 0.038625f, 0.043736f, 0.094689f, 0.072118f, -0.101913f, 0.055771f, 0.155655f, 0.003100f, -0.047511f, 0.126692f, -0.148464f, -0.047480f, 0.110554f, 0.242862f, -0.127652f, 0.025331f, -0.137026f, -0.028456f, -0.239169f, -0.163758f, 0.078290f, 0.089381f, 0.088247f, 0.146547f };
+static const float smart_transformer_fault_detection_sparse_layer_2_biases[5] = { -0.093927f, 0.107712f, 0.105205f, -0.194396f, 0.053540f };
+static float smart_transformer_fault_detection_sparse_buf1[361];
+static float smart_transformer_fault_detection_sparse_buf2[361];
+static const sparse_net_layer smart_transformer_fault_detection_sparse_layers[3] = { 
+{ 64, 6, smart_transformer_fault_detection_sparse_layer_0_row_ptr, smart_transformer_fault_detection_sparse_layer_0_col_index, smart_transformer_fault_detection_sparse_layer_0_values, smart_transformer_fault_detection_sparse_layer_0_biases, SPARSE_NET_ACTIVATION_TANH }, 
+{ 361, 64, smart_transformer_fault_detection_sparse_layer_1_row_ptr, smart_transformer_fault_detection_sparse_layer_1_col_index, smart_transformer_fault_detection_sparse_layer_1_values, smart_transformer_fault_detection_sparse_layer_1_biases, SPARSE_NET_ACTIVATION_TANH }, 
+{ 5, 361, smart_transformer_fault_detection_sparse_layer_2_row_ptr, smart_transformer_fault_detection_sparse_layer_2_col_index, smart_transformer_fault_detection_sparse_layer_2_values, smart_transformer_fault_detection_sparse_layer_2_biases, SPARSE_NET_ACTIVATION_SOFTMAX } }; 
+static const sparse_net smart_transformer_fault_detection_sparse = { 3, smart_transformer_fault_detection_sparse_layers, smart_transformer_fault_detection_sparse_buf1, smart_transformer_fault_detection_sparse_buf2, 361 };
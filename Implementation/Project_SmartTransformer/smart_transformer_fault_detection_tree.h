@@ -0,0 +1,1173 @@
+// Generated by AI_Model/export_decision_tree.py from decision-tree-model.pickle, do not edit.
+// Nodes: 1167 (584 leaves), max depth: 178
+#include "decision_tree.h"
+static const decision_tree_node smart_transformer_fault_detection_tree_nodes[1167] = {
+{ 2, 0, 532, 62.1965065f },
+{ 2, 0, 419, -98.4131165f },
+{ 4, 0, 418, 0.0368670039f },
+{ 3, 0, 5, -0.204635218f },
+{ DECISION_TREE_LEAF, 0, 0, 0.428571f },
+{ 1, 0, 417, 883.440857f },
+{ 0, 0, 416, 885.011841f },
+{ 2, 0, 9, -882.860962f },
+{ DECISION_TREE_LEAF, 4, 0, 0.636364f },
+{ 1, 0, 415, 883.197815f },
+{ 0, 0, 414, 884.302002f },
+{ 0, 0, 413, 883.88269f },
+{ 3, 0, 412, 0.0423565134f },
+{ 5, 0, 15, -0.0423670858f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 17, -882.732727f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 2, 0, 19, -882.571594f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 21, -882.535522f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 2, 0, 411, -102.664696f },
+{ 0, 0, 24, -699.684875f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 3, 0, 26, 0.00392387994f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 410, -116.635803f },
+{ 4, 0, 409, 0.0320710316f },
+{ 1, 0, 404, 881.936584f },
+{ 5, 0, 31, -0.042341575f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 5, 0, 33, -0.0423265174f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 1, 0, 403, 881.327576f },
+{ 1, 0, 402, 880.837097f },
+{ 1, 0, 401, 880.355164f },
+{ 1, 0, 400, 879.756348f },
+{ 5, 0, 39, -0.0422731228f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 41, -0.0422482081f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 5, 0, 43, -0.0422232598f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 45, -0.0421931297f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 5, 0, 47, -0.0421629772f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 1, 0, 399, 878.883118f },
+{ 1, 0, 390, 872.794128f },
+{ 1, 0, 389, 871.629456f },
+{ 1, 0, 384, 868.019043f },
+{ 1, 0, 383, 866.641418f },
+{ 1, 0, 382, 865.309875f },
+{ 5, 0, 55, -0.0417055041f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 4, 0, 381, 0.031852901f },
+{ 4, 0, 380, 0.0316333361f },
+{ 4, 0, 379, 0.0314113386f },
+{ 5, 0, 60, -0.0416447818f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 5, 0, 62, -0.0415835865f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 64, -0.0415168405f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 5, 0, 66, -0.0413076952f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 3, 0, 68, 0.00403689919f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 1, 0, 70, -690.367554f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 378, -144.144302f },
+{ 1, 0, 73, -681.623291f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 377, -157.446381f },
+{ 0, 0, 76, -664.452271f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 0, 0, 78, -659.827393f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 1, 0, 80, -672.710876f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 376, 0.0302695315f },
+{ 2, 0, 371, -198.425125f },
+{ 2, 0, 370, -199.254013f },
+{ 2, 0, 363, -226.725311f },
+{ 4, 0, 362, 0.010958218f },
+{ 1, 0, 361, 858.900574f },
+{ 0, 0, 88, -235.683777f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 360, 851.948608f },
+{ 4, 0, 359, 0.00837065466f },
+{ 1, 0, 358, 844.217041f },
+{ 5, 0, 93, -0.0396981537f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 1, 0, 357, 830.907166f },
+{ 3, 0, 96, 0.00992118195f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 356, -252.420105f },
+{ 1, 0, 99, -605.803345f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 355, -266.695526f },
+{ 1, 0, 102, -588.175293f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 354, -279.891449f },
+{ 3, 0, 105, 0.0124953277f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 353, 0.0283563398f },
+{ 1, 0, 108, -556.147827f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 352, -319.051147f },
+{ 1, 0, 111, -545.19635f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 351, -331.950989f },
+{ 3, 0, 114, 0.0149116078f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 350, 0.0268186312f },
+{ 1, 0, 117, -522.908264f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 349, -357.501343f },
+{ 3, 0, 120, 0.0161491781f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 348, 0.0252707433f },
+{ 1, 0, 123, -486.218018f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 347, -407.517303f },
+{ 1, 0, 126, -414.638275f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 5, 0, 346, 0.0208125375f },
+{ 3, 0, 129, 0.0220737681f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 345, -501.889587f },
+{ 1, 0, 132, -377.426727f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 344, 880.980591f },
+{ 3, 0, 135, 0.0237513613f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 343, 0.018430287f },
+{ 3, 0, 138, 0.0242990088f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 342, 873.720276f },
+{ 3, 0, 141, 0.0259054136f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 341, -578.94043f },
+{ 3, 0, 144, 0.0270538703f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 340, -599.612122f },
+{ 1, 0, 147, -249.29509f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 339, -609.96991f },
+{ 1, 0, 150, -234.459946f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 338, -629.500183f },
+{ 1, 0, 153, -208.965027f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 4, 0, 155, -0.0410512947f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 3, 0, 157, 0.029942546f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 159, -0.0407080948f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 3, 0, 161, 0.0309140906f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 0, 0, 337, 830.657288f },
+{ 1, 0, 164, -140.793289f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 166, -0.0401180126f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 1, 0, 168, -127.042427f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 170, -0.0399014391f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 3, 0, 172, 0.0326648988f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 336, 0.0064315768f },
+{ 1, 0, 175, -85.6213608f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 335, 0.00509984186f },
+{ 1, 0, 178, -57.9033737f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 334, 0.00379034947f },
+{ 5, 0, 197, -0.036564f },
+{ 1, 0, 190, 810.452271f },
+{ 4, 0, 189, 0.00176211947f },
+{ 2, 0, 188, -733.685669f },
+{ 1, 0, 185, 786.732788f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 4, 0, 187, 0.000769368955f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.636364f },
+{ 0, 0, 196, -113.465103f },
+{ 2, 0, 193, -692.816895f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 3, 0, 195, 0.0336685441f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 1, 0, 333, 773.602844f },
+{ 4, 0, 332, -0.00155927951f },
+{ 1, 0, 331, 759.816528f },
+{ 4, 0, 330, -0.00289396802f },
+{ 1, 0, 329, 745.268127f },
+{ 4, 0, 328, -0.00421424396f },
+{ 1, 0, 327, 729.984009f },
+{ 0, 0, 206, 80.4968567f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 1, 0, 326, 713.859009f },
+{ 5, 0, 209, -0.0327662975f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 3, 0, 211, 0.0346787721f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 325, 0.00311157433f },
+{ 3, 0, 214, 0.0354244858f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 4, 0, 216, -0.0375684015f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 3, 0, 218, 0.0360696018f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 324, -770.651855f },
+{ 1, 0, 221, 25.4705296f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 323, 752.116028f },
+{ 3, 0, 224, 0.0368073434f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 4, 0, 226, -0.0362594314f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 1, 0, 228, 67.1074219f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 318, -813.31665f },
+{ 1, 0, 235, 163.871689f },
+{ 0, 0, 232, 688.252686f },
+{ DECISION_TREE_LEAF, 4, 0, 0.636364f },
+{ 1, 0, 234, 123.150986f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 0, 0, 317, 661.33313f },
+{ 3, 0, 238, 0.0398512632f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 0, 0, 316, 642.569031f },
+{ 1, 0, 241, 217.75975f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 0, 0, 315, 623.171143f },
+{ 1, 0, 244, 258.209198f },
+{ DECISION_TREE_LEAF, 4, 0, 0.636364f },
+{ 0, 0, 314, 592.929199f },
+{ 1, 0, 247, 284.636932f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 313, 571.837219f },
+{ 1, 0, 258, 349.41745f },
+{ 4, 0, 257, -0.027190581f },
+{ 3, 0, 252, 0.0414821692f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 0, 0, 254, 545.119385f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 4, 0, 256, -0.0279333014f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 5, 0, 312, -0.0157785546f },
+{ 1, 0, 261, 374.747437f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 311, -0.0170053691f },
+{ 1, 0, 264, 399.938385f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 5, 0, 310, -0.0211599879f },
+{ 2, 0, 267, -881.694946f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 309, -0.0222994909f },
+{ 1, 0, 270, 506.788483f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 308, 361.262451f },
+{ 2, 0, 273, -876.793457f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 307, 335.743317f },
+{ 2, 0, 276, -873.07605f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 306, 309.893402f },
+{ 1, 0, 279, 572.677246f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 305, 283.738464f },
+{ 2, 0, 282, -862.990295f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 300, 230.617142f },
+{ 1, 0, 285, 633.467712f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 299, -0.0296216886f },
+{ 2, 0, 288, -841.657654f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 4, 0, 290, -0.010111074f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ 2, 0, 296, -828.138916f },
+{ 2, 0, 293, -832.851196f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 295, 675.385681f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 298, -0.00815534033f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 1, 0, 304, 603.737488f },
+{ 1, 0, 303, 598.482178f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.636364f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 1, 0, 322, 80.9564285f },
+{ 0, 0, 321, 729.408508f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.666667f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 0, 0, 369, 849.73999f },
+{ 3, 0, 368, 0.0118322624f },
+{ 2, 0, 367, -199.792679f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 3, 0, 375, 0.00722036371f },
+{ 0, 0, 374, 836.221252f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.666667f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 386, 869.265564f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ 2, 0, 388, -567.367798f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 3, 0, 398, 0.0275130682f },
+{ 2, 0, 397, -523.781006f },
+{ 3, 0, 394, 0.0270041823f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 396, 875.58374f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 408, -418.291687f },
+{ 3, 0, 407, 0.0240921192f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.636364f },
+{ DECISION_TREE_LEAF, 3, 0, 0.666667f },
+{ DECISION_TREE_LEAF, 0, 0, 0.714286f },
+{ 1, 0, 471, -120.95433f },
+{ 3, 0, 422, -0.00482886471f },
+{ DECISION_TREE_LEAF, 2, 0, 0.985455f },
+{ 5, 0, 470, 0.113866121f },
+{ 3, 0, 469, 0.0774288252f },
+{ 1, 0, 468, -717.323425f },
+{ 3, 0, 467, 0.00285229902f },
+{ 1, 0, 428, -787.824829f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 466, 36.0343513f },
+{ 1, 0, 461, -735.247803f },
+{ 1, 0, 432, -781.447998f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 460, 22.1299953f },
+{ 4, 0, 435, -0.0501730777f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 4, 0, 437, -0.0393348448f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 439, -774.878235f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 459, 14.3355169f },
+{ 1, 0, 442, -768.274902f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 458, -5.69889164f },
+{ 1, 0, 445, -761.391235f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 447, 777.665283f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 1, 0, 449, -751.06781f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 457, -34.9882355f },
+{ 4, 0, 456, -0.0369527861f },
+{ 5, 0, 455, 0.0362664461f },
+{ 1, 0, 454, -735.673218f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 0, 0, 463, 803.947876f },
+{ DECISION_TREE_LEAF, 4, 0, 0.636364f },
+{ 2, 0, 465, -82.0958633f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.692308f },
+{ DECISION_TREE_LEAF, 1, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 2, 0, 0.972973f },
+{ 1, 0, 503, 104.941017f },
+{ 0, 0, 496, 58.4012108f },
+{ 0, 0, 487, -73.6739273f },
+{ 5, 0, 478, -0.33131817f },
+{ 4, 0, 477, 0.402209848f },
+{ DECISION_TREE_LEAF, 2, 0, 0.894737f },
+{ DECISION_TREE_LEAF, 1, 0, 0.692308f },
+{ 1, 0, 486, 46.9381142f },
+{ 5, 0, 485, -0.323522955f },
+{ 4, 0, 484, 0.395544291f },
+{ 0, 0, 483, -726.033508f },
+{ DECISION_TREE_LEAF, 2, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 1, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 1, 0, 0.929825f },
+{ DECISION_TREE_LEAF, 1, 0, 0.987055f },
+{ DECISION_TREE_LEAF, 2, 0, 0.600000f },
+{ 4, 0, 493, 0.556257844f },
+{ 2, 0, 490, 43.7239952f },
+{ DECISION_TREE_LEAF, 0, 0, 0.994039f },
+{ 1, 0, 492, -74.8509064f },
+{ DECISION_TREE_LEAF, 0, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 1, 0, 0.714286f },
+{ 2, 0, 495, -61.0366249f },
+{ DECISION_TREE_LEAF, 0, 0, 0.962617f },
+{ DECISION_TREE_LEAF, 1, 0, 0.857143f },
+{ 5, 0, 502, 0.329651535f },
+{ 5, 0, 499, 0.324648052f },
+{ DECISION_TREE_LEAF, 1, 0, 0.988981f },
+{ 1, 0, 501, 39.4791832f },
+{ DECISION_TREE_LEAF, 1, 0, 0.911111f },
+{ DECISION_TREE_LEAF, 2, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 2, 0, 0.891892f },
+{ 1, 0, 507, 738.039307f },
+{ 3, 0, 506, -0.286196381f },
+{ DECISION_TREE_LEAF, 0, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 2, 0, 0.980392f },
+{ 0, 0, 531, -715.197083f },
+{ 4, 0, 530, 0.074745506f },
+{ 4, 0, 511, 0.0337476656f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 2, 0, 513, -61.0875397f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 529, -739.811584f },
+{ 5, 0, 516, -0.0382593386f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 518, 0.0352912322f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 2, 0, 520, -5.62133694f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 3, 0, 528, 0.00134548894f },
+{ 2, 0, 523, 22.1345539f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 527, 746.968262f },
+{ 5, 0, 526, -0.0363768227f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 2, 0, 0.826087f },
+{ DECISION_TREE_LEAF, 2, 0, 0.959596f },
+{ 2, 0, 574, 153.472672f },
+{ 4, 0, 535, -0.0379559062f },
+{ DECISION_TREE_LEAF, 0, 0, 0.692308f },
+{ 3, 0, 573, 0.261431009f },
+{ 5, 0, 538, -0.0360309295f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 572, 723.89801f },
+{ 5, 0, 541, -0.0353131182f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 571, 146.371918f },
+{ 1, 0, 570, 707.621704f },
+{ 5, 0, 545, -0.0345604792f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 569, 690.629883f },
+{ 4, 0, 568, -0.0315611288f },
+{ 5, 0, 567, 0.0399982855f },
+{ 1, 0, 566, -799.164368f },
+{ 4, 0, 565, -0.0322922431f },
+{ 2, 0, 552, 75.9445267f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 564, -805.524231f },
+{ 2, 0, 555, 91.5636444f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 563, -811.373535f },
+{ 5, 0, 562, 0.0397751369f },
+{ 2, 0, 561, 119.231728f },
+{ 0, 0, 560, 712.53717f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 0, 0, 0.666667f },
+{ 0, 0, 576, -882.930969f },
+{ DECISION_TREE_LEAF, 4, 0, 0.666667f },
+{ 0, 0, 578, -882.451172f },
+{ DECISION_TREE_LEAF, 3, 0, 0.692308f },
+{ 1, 0, 580, -893.38446f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 1166, 900.095459f },
+{ 1, 0, 585, -892.403625f },
+{ 2, 0, 584, 422.565216f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.636364f },
+{ 1, 0, 607, -883.185486f },
+{ 1, 0, 606, -884.236694f },
+{ 4, 0, 589, -0.0237077288f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 1, 0, 591, -892.072083f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 605, -0.0140484907f },
+{ 0, 0, 604, 505.654694f },
+{ 2, 0, 595, 397.784943f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 5, 0, 603, 0.0416076221f },
+{ 2, 0, 602, 551.091248f },
+{ 4, 0, 601, -0.0153613118f },
+{ 2, 0, 600, 523.080688f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.733333f },
+{ 1, 0, 609, -882.924255f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ 1, 0, 611, -882.727295f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 613, -882.366821f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ 0, 0, 623, -878.581299f },
+{ 4, 0, 622, 0.0423834845f },
+{ 1, 0, 617, 365.114563f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 621, 396.169708f },
+{ 4, 0, 620, 0.0421058796f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.777778f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 1163, 0.0423330106f },
+{ 1, 0, 632, -880.738831f },
+{ 1, 0, 631, -881.21106f },
+{ 1, 0, 628, -882.082153f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 630, 391.902618f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ 1, 0, 634, -880.122131f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ 1, 0, 636, -879.524048f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 5, 0, 1162, 0.04224604f },
+{ 1, 0, 641, -878.281067f },
+{ 1, 0, 640, -878.929932f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ 1, 0, 643, -877.292969f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 1, 0, 645, -876.327393f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ 5, 0, 1161, 0.0421359129f },
+{ 5, 0, 648, -0.0951497629f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 650, -878.202881f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 1160, 899.759705f },
+{ 5, 0, 1159, 0.0421005748f },
+{ 2, 0, 1158, 899.40509f },
+{ 2, 0, 1157, 898.659058f },
+{ 5, 0, 1156, 0.0420652404f },
+{ 3, 0, 1155, 0.075151898f },
+{ 5, 0, 658, -0.0821528807f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 3, 0, 1154, 0.0679131895f },
+{ 1, 0, 1153, 672.99115f },
+{ 2, 0, 1128, 884.031921f },
+{ 2, 0, 1127, 883.757812f },
+{ 2, 0, 1122, 883.046509f },
+{ 2, 0, 1121, 882.499023f },
+{ 2, 0, 1120, 882.314758f },
+{ 2, 0, 1119, 881.65094f },
+{ 2, 0, 1118, 881.311646f },
+{ 2, 0, 1117, 880.784241f },
+{ 2, 0, 1116, 880.080994f },
+{ 2, 0, 1115, 879.477234f },
+{ 2, 0, 1114, 878.556824f },
+{ 2, 0, 1113, 877.96875f },
+{ 2, 0, 1112, 877.105286f },
+{ 2, 0, 1111, 876.394836f },
+{ 2, 0, 1110, 875.144226f },
+{ 2, 0, 1109, 874.149414f },
+{ 2, 0, 1108, 873.454041f },
+{ 2, 0, 1107, 872.153015f },
+{ 2, 0, 1106, 871.43103f },
+{ 2, 0, 1105, 869.77948f },
+{ 2, 0, 1104, 869.418457f },
+{ 2, 0, 1099, 867.230347f },
+{ 2, 0, 1098, 866.455811f },
+{ 2, 0, 1097, 864.39563f },
+{ 2, 0, 1096, 863.541382f },
+{ 2, 0, 1093, 861.258667f },
+{ 2, 0, 1092, 859.993469f },
+{ 2, 0, 1091, 857.933228f },
+{ 2, 0, 1090, 855.786194f },
+{ 2, 0, 1089, 854.567017f },
+{ 2, 0, 1088, 854.041809f },
+{ 2, 0, 1087, 852.924011f },
+{ 2, 0, 1086, 851.687805f },
+{ 2, 0, 1085, 850.905701f },
+{ 2, 0, 1084, 849.684509f },
+{ 2, 0, 1083, 847.033569f },
+{ 2, 0, 1082, 845.402161f },
+{ 2, 0, 1081, 843.436584f },
+{ 2, 0, 730, 239.557617f },
+{ 3, 0, 707, -0.0112371407f },
+{ 1, 0, 706, 315.549866f },
+{ 5, 0, 703, 0.041224055f },
+{ DECISION_TREE_LEAF, 4, 0, 0.666667f },
+{ 4, 0, 705, -0.0287666135f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 5, 0, 709, -0.032953456f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 729, 0.0408322662f },
+{ 3, 0, 712, -0.010594219f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 728, 0.0406492464f },
+{ 1, 0, 715, -837.769104f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 0, 0, 727, 674.268616f },
+{ 2, 0, 718, 172.081192f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 726, -840.912537f },
+{ 5, 0, 721, -0.032101322f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 4, 0, 723, 0.040236596f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ 5, 0, 725, -0.0312168747f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 2, 0, 732, 240.353668f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 1, 0, 1080, 616.09729f },
+{ 2, 0, 735, 241.916763f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 1, 0, 1079, 606.085754f },
+{ 1, 0, 1078, 600.984863f },
+{ 0, 0, 1077, 612.245361f },
+{ 1, 0, 1076, 595.9104f },
+{ 1, 0, 1075, 590.735962f },
+{ 1, 0, 1074, 585.588013f },
+{ 1, 0, 765, -865.087341f },
+{ 1, 0, 764, -866.96582f },
+{ 1, 0, 763, -867.794983f },
+{ 1, 0, 762, -868.931763f },
+{ 1, 0, 761, -869.876465f },
+{ 5, 0, 754, 0.0416252017f },
+{ 2, 0, 749, 557.734253f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ 1, 0, 753, -871.202087f },
+{ 4, 0, 752, -0.0111060552f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 760, 427.227509f },
+{ 1, 0, 759, -870.547119f },
+{ 0, 0, 758, 592.100403f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ 5, 0, 1073, 0.0416789502f },
+{ 5, 0, 1072, 0.0416177697f },
+{ 0, 0, 1069, 249.874451f },
+{ 1, 0, 774, -855.545349f },
+{ 3, 0, 773, -0.0313492604f },
+{ 4, 0, 772, -0.00806127675f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 776, 282.914673f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 786, -0.0069885077f },
+{ 2, 0, 785, 648.781311f },
+{ 5, 0, 780, 0.0401168801f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 3, 0, 784, -0.0313764624f },
+{ 0, 0, 783, 216.411652f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.636364f },
+{ 0, 0, 1068, 175.813721f },
+{ 1, 0, 1067, 575.121155f },
+{ 2, 0, 792, 307.086578f },
+{ 2, 0, 791, 289.478027f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ 1, 0, 1066, 553.751343f },
+{ 2, 0, 795, 332.960754f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 1, 0, 1065, 531.860168f },
+{ 1, 0, 1064, 526.274658f },
+{ 1, 0, 1063, 352.430176f },
+{ 0, 0, 800, -873.944519f },
+{ DECISION_TREE_LEAF, 4, 0, 0.636364f },
+{ 1, 0, 1060, 313.868103f },
+{ 0, 0, 803, -869.505798f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 3, 0, 1059, 0.0396635234f },
+{ 5, 0, 806, -0.0569646545f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 808, -868.221741f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 0, 0, 810, -866.945923f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 3, 0, 1058, 0.0324274562f },
+{ 5, 0, 813, -0.0466942266f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 1057, 168.999268f },
+{ 3, 0, 998, -0.0294705853f },
+{ 0, 0, 817, -843.222534f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 819, -841.089294f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 3, 0, 821, -0.0936704427f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 5, 0, 997, 0.0393106826f },
+{ 5, 0, 996, 0.0391871333f },
+{ 4, 0, 995, 0.0480715483f },
+{ 5, 0, 994, 0.0390587486f },
+{ 5, 0, 993, 0.0389303677f },
+{ 4, 0, 828, -0.00663069542f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 5, 0, 992, 0.0387162827f },
+{ 5, 0, 979, 0.0378078707f },
+{ 4, 0, 832, -0.00217009499f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 0, 0, 978, 72.8043365f },
+{ 5, 0, 977, 0.0373718254f },
+{ 0, 0, 974, 58.9261322f },
+{ 4, 0, 837, -0.000658241042f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 4, 0, 839, -0.000368010515f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 4, 0, 841, -5.07670047e-05f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 843, 0.000293773483f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 0, 0, 973, 18.0340214f },
+{ 4, 0, 846, 0.000962477003f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 5, 0, 972, 0.0360206217f },
+{ 4, 0, 849, 0.00162748294f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 4, 0, 851, 0.00206272537f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 971, 0.0354873426f },
+{ 5, 0, 970, 0.0353037305f },
+{ 5, 0, 969, 0.035067156f },
+{ 1, 0, 856, -761.120239f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 968, -38.1356812f },
+{ 1, 0, 893, -150.294159f },
+{ 5, 0, 860, 0.00613577291f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 862, 790.538757f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 892, 0.0339667983f },
+{ 2, 0, 865, 802.590576f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 1, 0, 891, -177.568726f },
+{ 5, 0, 868, 0.0300652478f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 1, 0, 890, -661.653442f },
+{ 5, 0, 871, 0.0309870634f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 889, -679.715088f },
+{ 4, 0, 888, 0.00822895952f },
+{ 1, 0, 887, -697.107117f },
+{ 3, 0, 876, -0.0396576822f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 1, 0, 886, -713.811035f },
+{ 4, 0, 885, 0.00590451481f },
+{ 1, 0, 884, -732.584778f },
+{ 1, 0, 881, -750.735107f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ 3, 0, 883, -0.0369925424f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ 2, 0, 967, 824.853943f },
+{ 5, 0, 966, 0.013021348f },
+{ 0, 0, 965, -687.995178f },
+{ 2, 0, 964, 819.755371f },
+{ 1, 0, 899, -115.883965f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 949, 0.0028288546f },
+{ 1, 0, 908, -53.8419304f },
+{ 1, 0, 903, -112.269211f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 5, 0, 905, 0.001500107f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ 1, 0, 907, -81.5174484f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 4, 0, 910, 0.03662505f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ 1, 0, 912, -26.113142f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 948, 771.815247f },
+{ 1, 0, 915, 1.64155293f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 947, 757.895691f },
+{ 1, 0, 918, 29.394762f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 946, 743.230347f },
+{ 1, 0, 921, 57.1190948f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 945, 727.828735f },
+{ 1, 0, 930, 98.5916214f },
+{ 4, 0, 929, 0.0392662138f },
+{ 5, 0, 926, -0.00546992058f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 0, 0, 928, -761.329956f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 944, 703.389709f },
+{ 1, 0, 933, 126.13166f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 943, 686.225464f },
+{ 3, 0, 938, -0.0313240439f },
+{ 3, 0, 937, -0.0386184491f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 0, 0, 942, -834.552124f },
+{ 1, 0, 941, 180.783096f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 2, 0, 961, 703.830994f },
+{ 3, 0, 956, -0.0538433343f },
+{ 2, 0, 955, 529.59845f },
+{ 5, 0, 954, 0.0121680461f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ 2, 0, 958, 695.651917f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 960, 69.3379669f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 1, 0, 963, -109.106873f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.666667f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 1, 0, 976, -812.40686f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 2, 0, 991, 716.990845f },
+{ 1, 0, 990, -810.177368f },
+{ 0, 0, 983, 114.205475f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 2, 0, 989, 699.707825f },
+{ 4, 0, 986, -0.0060622273f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 5, 0, 988, 0.0386639982f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 3, 0, 1000, -0.0294561349f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 1, 0, 1056, 274.726685f },
+{ 1, 0, 1055, 272.798279f },
+{ 3, 0, 1054, 0.0207110997f },
+{ 5, 0, 1005, -0.0416525938f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 1007, 0.0269193854f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ 1, 0, 1053, 261.376373f },
+{ 4, 0, 1052, 0.0415629037f },
+{ 1, 0, 1051, 234.741455f },
+{ 0, 0, 1012, -851.064941f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 4, 0, 1050, 0.0394522995f },
+{ 3, 0, 1015, -0.0294267554f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ 5, 0, 1049, -0.00423727836f },
+{ 3, 0, 1018, -0.0290283654f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ 5, 0, 1040, -0.0151814753f },
+{ 0, 0, 1021, -748.075134f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 1023, 509.952942f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ 1, 0, 1039, 172.673615f },
+{ 3, 0, 1038, 0.00707184849f },
+{ 1, 0, 1037, 75.7701035f },
+{ 4, 0, 1032, 0.0290684011f },
+{ 5, 0, 1029, -0.0169541799f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 3, 0, 1031, -0.0120203886f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 2, 0, 1036, 713.187805f },
+{ 5, 0, 1035, -0.0184589531f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 3, 0, 1048, -0.0228503104f },
+{ 2, 0, 1047, 788.627258f },
+{ 5, 0, 1044, -0.00812999252f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 3, 0, 1046, -0.0264129322f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 1, 0, 1062, 327.20105f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 2, 0, 1071, 252.889206f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.692308f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 0, 0, 1095, -622.829224f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.636364f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.636364f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ 2, 0, 1101, 867.929626f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ 3, 0, 1103, -0.0384068005f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 3, 0, 1126, -0.0422444418f },
+{ 0, 0, 1125, -410.322449f },
+{ DECISION_TREE_LEAF, 4, 0, 0.714286f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ 2, 0, 1130, 885.651123f },
+{ DECISION_TREE_LEAF, 3, 0, 0.714286f },
+{ 3, 0, 1152, -0.0330330208f },
+{ 5, 0, 1133, 0.0127018355f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ 5, 0, 1135, 0.0150481593f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ 2, 0, 1137, 887.002808f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 4, 0, 1139, 0.0149773993f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 3, 0, 1141, -0.0422575362f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ 5, 0, 1151, 0.0237071477f },
+{ 4, 0, 1150, 0.0175224785f },
+{ 1, 0, 1145, -570.569214f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ 1, 0, 1147, -565.058533f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ 2, 0, 1149, 894.010559f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 4, 0, 0.555556f },
+{ DECISION_TREE_LEAF, 3, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 4, 0, 0.428571f },
+{ DECISION_TREE_LEAF, 3, 0, 0.500000f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f },
+{ 1, 0, 1165, 360.027283f },
+{ DECISION_TREE_LEAF, 3, 0, 0.600000f },
+{ DECISION_TREE_LEAF, 4, 0, 0.333333f },
+{ DECISION_TREE_LEAF, 3, 0, 0.555556f }
+};
+static const decision_tree smart_transformer_fault_detection_tree = { 6, 5, 1167, smart_transformer_fault_detection_tree_nodes };
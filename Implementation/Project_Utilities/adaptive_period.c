@@ -0,0 +1,141 @@
+#include <stdio.h>
+
+#include "adaptive_period.h"
+
+/*
+ * The period falls to the floor as soon as a sample raises an alert (in the sensors: low confidence of the
+ * classifier, change of class, step of the measurements or large change of power) and doubles, up to the ceiling,
+ * after every ADAPTIVE_PERIOD_STABLE_TICKS consecutive stable samples. The reaction to a change is immediate while
+ * the stretch is gradual: in a quiet signal the node wakes up less and less often, a developing fault is followed at
+ * the fastest rate. The totals give the mean period, to be compared with the consumption of the node.
+ */
+
+
+/**
+ * Initializes the schedule at the floor.
+ * @param schedule The schedule to initialize
+ * @param min_period Floor of the period (seconds)
+ * @param max_period Ceiling of the period (seconds)
+ * @return 0 on success, -1 if the limits are not valid
+ */
+int adaptive_period_init(adaptive_period *schedule, uint16_t min_period, uint16_t max_period){
+
+	if (min_period==0 || min_period>max_period){
+		return -1;
+	}
+
+	schedule->min_period=min_period;
+	schedule->max_period=max_period;
+	schedule->period=min_period;
+	schedule->stable_ticks=0;
+	schedule->samples=0;
+	schedule->seconds=0;
+	return 0;
+}
+
+
+/**
+ * Changes the limits of the period; the effective period is brought inside them.
+ * @param schedule The schedule
+ * @param min_period Floor of the period (seconds)
+ * @param max_period Ceiling of the period (seconds)
+ * @return 0 on success, -1 if the limits are not valid (nothing is changed)
+ */
+int adaptive_period_set_limits(adaptive_period *schedule, uint16_t min_period, uint16_t max_period){
+
+	if (min_period==0 || min_period>max_period){
+		return -1;
+	}
+
+	schedule->min_period=min_period;
+	schedule->max_period=max_period;
+	if (schedule->period<min_period){
+		schedule->period=min_period;
+	}
+	if (schedule->period>max_period){
+		schedule->period=max_period;
+	}
+	return 0;
+}
+
+
+/**
+ * Brings the period back to the floor without accounting for a sample, e.g. when the sensing restarts.
+ * @param schedule The schedule
+ */
+void adaptive_period_reset(adaptive_period *schedule){
+	schedule->period=schedule->min_period;
+	schedule->stable_ticks=0;
+}
+
+
+/**
+ * Accounts for a sample and computes the period until the next one.
+ * @param schedule The schedule
+ * @param signal What the sample says about the signal
+ * @return The period until the next sample (seconds)
+ */
+uint16_t adaptive_period_update(adaptive_period *schedule, adaptive_period_signal signal){
+
+	switch (signal) {
+	case ADAPTIVE_PERIOD_ALERT:
+		schedule->period=schedule->min_period;
+		schedule->stable_ticks=0;
+		break;
+	case ADAPTIVE_PERIOD_STABLE:
+		schedule->stable_ticks++;
+		if (schedule->stable_ticks>=ADAPTIVE_PERIOD_STABLE_TICKS){
+			schedule->period=schedule->period>schedule->max_period/2 ? schedule->max_period : schedule->period*2;
+			schedule->stable_ticks=0;
+		}
+		break;
+	default:
+		schedule->stable_ticks=0;
+		break;
+	}
+
+	schedule->samples++;
+	schedule->seconds+=schedule->period;
+	return schedule->period;
+}
+
+
+/**
+ * Turns what a classifier says about a sample into the signal of the schedule: an alert when something changed or the
+ * classifier is unsure, a stretch only when it is confident and the measurements have settled.
+ * @param changed true if the sample changed the picture (step of the measurements, new class, fault)
+ * @param confidence The probability of the class predicted for the sample
+ * @param low_confidence Below this confidence the sample raises an alert
+ * @param high_confidence From this confidence the period can grow
+ * @param settled true if the measurements are steady enough to sample less often
+ * @return The signal for adaptive_period_update()
+ */
+adaptive_period_signal adaptive_period_classify(bool changed, float confidence, float low_confidence, float high_confidence, bool settled){
+
+	if (changed || confidence<low_confidence){
+		return ADAPTIVE_PERIOD_ALERT;
+	}
+	if (confidence<high_confidence || !settled){
+		return ADAPTIVE_PERIOD_HOLD;
+	}
+	return ADAPTIVE_PERIOD_STABLE;
+}
+
+
+/**
+ * Writes the period, its limits and the totals as a JSON object.
+ * @param schedule The schedule
+ * @param buffer The destination
+ * @param buffer_size The size of the destination
+ * @return The length written, -1 if it does not fit
+ */
+int adaptive_period_write(const adaptive_period *schedule, char *buffer, int buffer_size){
+
+	int length=snprintf(buffer, buffer_size, "{\"period\":%u,\"min_period\":%u,\"max_period\":%u,\"samples\":%lu,\"seconds\":%lu}",
+			schedule->period, schedule->min_period, schedule->max_period, schedule->samples, schedule->seconds);
+
+	if (length<0 || length>=buffer_size){
+		return -1;
+	}
+	return length;
+}
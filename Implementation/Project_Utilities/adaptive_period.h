@@ -0,0 +1,32 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+// Consecutive stable samples needed before each stretch of the period
+#ifndef ADAPTIVE_PERIOD_STABLE_TICKS
+#define ADAPTIVE_PERIOD_STABLE_TICKS 3
+#endif
+
+// What the last sample says about the signal
+typedef enum {
+	ADAPTIVE_PERIOD_ALERT,   // Something is changing: sample as fast as allowed
+	ADAPTIVE_PERIOD_HOLD,    // Keep the current period
+	ADAPTIVE_PERIOD_STABLE   // Nothing is happening: the period can grow
+} adaptive_period_signal;
+
+// Sampling period (in seconds) between a floor and a ceiling, with the totals needed to compute the mean period.
+typedef struct {
+	uint16_t min_period;
+	uint16_t max_period;
+	uint16_t period;          // Effective period
+	uint8_t stable_ticks;     // Consecutive stable samples since the last change of period
+	unsigned long samples;    // Samples taken
+	unsigned long seconds;    // Sum of the periods of the samples taken
+} adaptive_period;
+
+
+int adaptive_period_init(adaptive_period *schedule, uint16_t min_period, uint16_t max_period);
+int adaptive_period_set_limits(adaptive_period *schedule, uint16_t min_period, uint16_t max_period);
+void adaptive_period_reset(adaptive_period *schedule);
+uint16_t adaptive_period_update(adaptive_period *schedule, adaptive_period_signal signal);
+adaptive_period_signal adaptive_period_classify(bool changed, float confidence, float low_confidence, float high_confidence, bool settled);
+int adaptive_period_write(const adaptive_period *schedule, char *buffer, int buffer_size);
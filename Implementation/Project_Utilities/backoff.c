@@ -0,0 +1,72 @@
+#include "backoff.h"
+
+/*
+ * The delay doubles at every retry, from base_delay up to max_delay, and only its upper half is fixed: the lower half
+ * is drawn at random ("equal jitter"). Nodes that failed together, e.g. because the border router or the server came
+ * up late, spread their retries over the interval instead of hitting the server again all at the same time, and each
+ * of them still waits at least half of the nominal delay. The budget bounds the retries of a single burst: once it
+ * is spent the caller decides what to do (typically suspend for a long time and then start over with a reset).
+ */
+
+
+/**
+ * Initializes the policy, with no retry done.
+ * @param policy The policy to initialize
+ * @param base_delay Nominal delay of the first retry
+ * @param max_delay Maximum nominal delay
+ * @param budget Number of retries allowed
+ */
+void backoff_init(backoff *policy, uint32_t base_delay, uint32_t max_delay, uint16_t budget){
+
+	policy->base_delay=base_delay;
+	policy->max_delay=max_delay<base_delay ? base_delay : max_delay;
+	policy->budget=budget;
+	backoff_reset(policy);
+}
+
+
+/**
+ * Restores the whole budget and the base delay, typically after a success.
+ * @param policy The policy
+ */
+void backoff_reset(backoff *policy){
+	policy->attempts=0;
+}
+
+
+/**
+ * @param policy The policy
+ * @return true if no retry is left
+ */
+bool backoff_is_exhausted(const backoff *policy){
+	return policy->attempts>=policy->budget;
+}
+
+
+/**
+ * Computes the delay before the next retry and consumes one unit of the budget.
+ * @param policy The policy
+ * @param random A uniformly distributed 16-bit number (random_rand() on the nodes)
+ * @param delay Filled with the delay to wait
+ * @return false if the budget is exhausted (delay is not changed)
+ */
+bool backoff_next_delay(backoff *policy, uint16_t random, uint32_t *delay){
+
+	if (backoff_is_exhausted(policy)){
+		return false;
+	}
+
+	// base_delay * 2^attempts, saturated to max_delay without overflowing
+	uint32_t nominal=policy->base_delay;
+	for (uint16_t i=0; i<policy->attempts && nominal<policy->max_delay; i++){
+		nominal=nominal>policy->max_delay/2 ? policy->max_delay : nominal*2;
+	}
+	if (nominal>policy->max_delay){
+		nominal=policy->max_delay;
+	}
+
+	uint32_t half=nominal/2;
+	*delay=nominal-half+(uint32_t)(((uint64_t)half*random)>>16);
+	policy->attempts++;
+	return true;
+}
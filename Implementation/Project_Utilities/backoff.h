@@ -0,0 +1,16 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+// Exponential backoff with jitter and a retry budget. The delays are in any unit (clock ticks on the nodes).
+typedef struct {
+	uint32_t base_delay;  // Delay before the first retry, without jitter
+	uint32_t max_delay;   // Upper bound of the exponential growth
+	uint16_t budget;      // Retries allowed before giving up
+	uint16_t attempts;    // Retries scheduled so far
+} backoff;
+
+
+void backoff_init(backoff *policy, uint32_t base_delay, uint32_t max_delay, uint16_t budget);
+void backoff_reset(backoff *policy);
+bool backoff_is_exhausted(const backoff *policy);
+bool backoff_next_delay(backoff *policy, uint16_t random, uint32_t *delay);
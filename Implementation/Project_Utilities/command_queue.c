@@ -0,0 +1,281 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "contiki.h"
+#include "coap-engine.h"
+#include "coap-callback-api.h"
+#include "sys/ctimer.h"
+#include "sys/log.h"
+
+#include "command_queue.h"
+#include "global_constants.h"
+
+/*
+ * Fan-out of a command (a PUT with the same payload) to many nodes, without blocking the caller: the requests are
+ * sent with the callback API of CoAP, at most COMMAND_QUEUE_MAX_IN_FLIGHT at a time, and the targets wait in the
+ * queue for a free slot. A target whose request times out (or is refused) goes back to the queue until it has used
+ * COMMAND_QUEUE_MAX_ATTEMPTS. Each slot owns the message and the state of its request, the payload is shared.
+ *
+ * For every target the outcome of the last command is kept, with the attempts and the latency. A single command is
+ * handled at a time: a node needs one for each grid action, and the next one depends on the answers of this one.
+ */
+
+typedef struct {
+	coap_callback_request_state_t request_state;  // First member: the CoAP callback gives back its address
+	coap_message_t request[1];
+	int target;                                   // -1 if the slot is free
+} command_slot;
+
+static coap_endpoint_t endpoints[COMMAND_QUEUE_MAX_TARGETS];
+static int nr_targets=0;
+
+static command_target_stats stats[COMMAND_QUEUE_MAX_TARGETS];
+static command_slot slots[COMMAND_QUEUE_MAX_IN_FLIGHT];
+
+static char payload[COMMAND_QUEUE_MAX_PAYLOAD_LEN];
+static int payload_length=0;
+static char uri_path[COMMAND_QUEUE_MAX_PATH_LEN];
+
+static command_response_handler response_handler;
+static command_done_callback done_callback;
+static bool busy=false;
+
+static struct ctimer dispatch_timer;
+
+static void dispatch(void *ptr);
+
+
+/**
+ * Sets the nodes the commands can be sent to.
+ * @param endpoint_strings The endpoints ("coap://[address]:port") indexed by target
+ * @param nr_endpoints Number of targets
+ * @return 0 on success, -1 if there are too many targets or an endpoint is not valid
+ */
+int command_queue_init(const char *const *endpoint_strings, int nr_endpoints){
+
+	if (nr_endpoints<0 || nr_endpoints>COMMAND_QUEUE_MAX_TARGETS){
+		return -1;
+	}
+
+	for (int i=0; i<nr_endpoints; i++){
+		if (!coap_endpoint_parse(endpoint_strings[i], strlen(endpoint_strings[i]), &endpoints[i])){
+			return -1;
+		}
+		stats[i].outcome=COMMAND_TARGET_NONE;
+		stats[i].attempts=0;
+		stats[i].latency=0;
+	}
+	for (int i=0; i<COMMAND_QUEUE_MAX_IN_FLIGHT; i++){
+		slots[i].target=-1;
+	}
+	nr_targets=nr_endpoints;
+	busy=false;
+	return 0;
+}
+
+
+/**
+ * Calls the done callback when no target is waiting or in flight any more.
+ */
+static void check_completion(void){
+
+	int nr_succeeded=0;
+	int nr_failed=0;
+
+	for (int i=0; i<nr_targets; i++){
+		if (stats[i].outcome==COMMAND_TARGET_QUEUED || stats[i].outcome==COMMAND_TARGET_IN_FLIGHT){
+			return;
+		}
+		nr_succeeded+=stats[i].outcome==COMMAND_TARGET_SUCCEEDED;
+		nr_failed+=stats[i].outcome==COMMAND_TARGET_FAILED;
+	}
+
+	busy=false;
+	LOG_DBG("Command completed: %d succeeded, %d failed\n", nr_succeeded, nr_failed);
+	if (done_callback!=NULL){
+		done_callback(nr_succeeded, nr_failed);
+	}
+}
+
+
+/**
+ * Callback of the CoAP requests: the slot is released when the exchange is over and the queue moves on.
+ */
+static void command_callback(coap_callback_request_state_t *callback_state){
+
+	command_slot *slot=(command_slot *)callback_state;
+	int target=slot->target;
+	bool executed;
+
+	if (target<0){
+		return;
+	}
+
+	switch (callback_state->state.status) {
+	case COAP_REQUEST_STATUS_RESPONSE:
+		if (response_handler(target, callback_state->state.response)){
+			stats[target].outcome=COMMAND_TARGET_SUCCEEDED;
+			stats[target].latency=clock_time()-stats[target].started;
+		}
+		return;
+	case COAP_REQUEST_STATUS_MORE:
+		return;
+	case COAP_REQUEST_STATUS_FINISHED:
+		executed=stats[target].outcome==COMMAND_TARGET_SUCCEEDED;
+		break;
+	default:
+		// Timeout or block error
+		response_handler(target, NULL);
+		executed=false;
+		break;
+	}
+
+	slot->target=-1;
+	if (!executed){
+		stats[target].outcome=stats[target].attempts<COMMAND_QUEUE_MAX_ATTEMPTS ? COMMAND_TARGET_QUEUED : COMMAND_TARGET_FAILED;
+		LOG_DBG("Command to target %d failed, attempt %u\n", target, stats[target].attempts);
+	}
+	else {
+		LOG_DBG("Command to target %d executed in %lu ms\n", target, (unsigned long)(stats[target].latency*1000/CLOCK_SECOND));
+	}
+
+	dispatch(NULL);
+	check_completion();
+}
+
+
+/**
+ * Assigns the free slots to the queued targets, in order of target. When the CoAP transactions are all taken the
+ * dispatch is tried again after COMMAND_QUEUE_RETRY_DELAY, without consuming attempts.
+ */
+static void dispatch(void *ptr){
+
+	int next_target=0;
+
+	for (int s=0; s<COMMAND_QUEUE_MAX_IN_FLIGHT; s++){
+		if (slots[s].target>=0){
+			continue;
+		}
+		while (next_target<nr_targets && stats[next_target].outcome!=COMMAND_TARGET_QUEUED){
+			next_target++;
+		}
+		if (next_target==nr_targets){
+			return;
+		}
+
+		command_slot *slot=&slots[s];
+		coap_init_message(slot->request, COAP_TYPE_CON, COAP_PUT, 0);
+		coap_set_header_uri_path(slot->request, uri_path);
+		coap_set_payload(slot->request, (uint8_t *)payload, payload_length);
+
+		slot->target=next_target;
+		if (!coap_send_request(&slot->request_state, &endpoints[next_target], slot->request, command_callback)){
+			slot->target=-1;
+			ctimer_set(&dispatch_timer, COMMAND_QUEUE_RETRY_DELAY, dispatch, NULL);
+			return;
+		}
+
+		if (stats[next_target].attempts==0){
+			stats[next_target].started=clock_time();
+		}
+		stats[next_target].attempts++;
+		stats[next_target].outcome=COMMAND_TARGET_IN_FLIGHT;
+		next_target++;
+	}
+}
+
+
+/**
+ * Sends a command (PUT) to the selected targets and returns immediately; the answers are handed to handle_response
+ * as they arrive. The payload is copied, the caller can release it.
+ * @param path The URI path of the resource on the targets
+ * @param command_payload The payload
+ * @param targets Targets addressed by the command (nr_targets flags), NULL for all of them
+ * @param handle_response Handles the answer of each target and tells if the command has been executed
+ * @param on_done Called when the command is over for all the targets (it can be NULL)
+ * @return false if another command is in progress, no target is selected, or the command is too long
+ */
+bool command_queue_send(const char *path, const char *command_payload, const bool *targets,
+	command_response_handler handle_response, command_done_callback on_done){
+
+	if (busy){
+		return false;
+	}
+
+	int length=snprintf(payload, sizeof(payload), "%s", command_payload);
+	if (length>=(int)sizeof(payload) || strlen(path)>=sizeof(uri_path)){
+		return false;
+	}
+	payload_length=length;
+	strcpy(uri_path, path);
+
+	int nr_selected=0;
+	for (int i=0; i<nr_targets; i++){
+		bool selected=targets==NULL || targets[i];
+		stats[i].outcome=selected ? COMMAND_TARGET_QUEUED : COMMAND_TARGET_NONE;
+		stats[i].attempts=0;
+		stats[i].latency=0;
+		nr_selected+=selected;
+	}
+	if (nr_selected==0){
+		return false;
+	}
+
+	response_handler=handle_response;
+	done_callback=on_done;
+	busy=true;
+
+	// Executed in the context of the calling process, that owns the dispatch timer
+	dispatch(NULL);
+	return true;
+}
+
+
+/**
+ * @return true while a command is in progress
+ */
+bool command_queue_is_busy(void){
+	return busy;
+}
+
+
+int command_queue_get_nr_targets(void){
+	return nr_targets;
+}
+
+
+/**
+ * @param target The index of the target
+ * @return The outcome of the last command sent to the target
+ */
+const command_target_stats *command_queue_get_stats(int target){
+	return &stats[target];
+}
+
+
+/**
+ * Writes the outcome of the last command for each target as a JSON object.
+ * @param buffer The destination
+ * @param buffer_size The size of the destination
+ * @return The length written, -1 if it does not fit
+ */
+int command_queue_write_stats(char *buffer, int buffer_size){
+
+	static const char *outcome_names[]={"none", "queued", "in_flight", "succeeded", "failed"};
+
+	int length=snprintf(buffer, buffer_size, "{\"busy\":%s,\"targets\":[", busy ? "true" : "false");
+
+	for (int i=0; i<nr_targets && length>=0 && length<buffer_size; i++){
+		length+=snprintf(buffer+length, buffer_size-length, "%s{\"outcome\":\"%s\",\"attempts\":%u,\"latency_ms\":%lu}",
+				i>0 ? "," : "", outcome_names[stats[i].outcome], stats[i].attempts,
+				(unsigned long)(stats[i].latency*1000/CLOCK_SECOND));
+	}
+	if (length>=0 && length<buffer_size){
+		length+=snprintf(buffer+length, buffer_size-length, "]}");
+	}
+
+	if (length<0 || length>=buffer_size){
+		return -1;
+	}
+	return length;
+}
@@ -0,0 +1,53 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "coap-engine.h"
+
+// Sizes of the queue (they can be overridden in project-conf.h)
+#ifndef COMMAND_QUEUE_MAX_TARGETS
+#define COMMAND_QUEUE_MAX_TARGETS 8
+#endif
+// Requests in flight at the same time: one transaction is left to the notifications and the registration
+#ifndef COMMAND_QUEUE_MAX_IN_FLIGHT
+#define COMMAND_QUEUE_MAX_IN_FLIGHT (COAP_MAX_OPEN_TRANSACTIONS-1)
+#endif
+#ifndef COMMAND_QUEUE_MAX_ATTEMPTS
+#define COMMAND_QUEUE_MAX_ATTEMPTS 3
+#endif
+// Wait before dispatching again when all the CoAP transactions are taken
+#ifndef COMMAND_QUEUE_RETRY_DELAY
+#define COMMAND_QUEUE_RETRY_DELAY (CLOCK_SECOND/4)
+#endif
+
+#define COMMAND_QUEUE_MAX_PAYLOAD_LEN 64
+#define COMMAND_QUEUE_MAX_PATH_LEN 32
+
+typedef enum {
+	COMMAND_TARGET_NONE,       // Not addressed by the last command
+	COMMAND_TARGET_QUEUED,     // Waiting for a free slot
+	COMMAND_TARGET_IN_FLIGHT,
+	COMMAND_TARGET_SUCCEEDED,
+	COMMAND_TARGET_FAILED      // All the attempts timed out or were refused
+} command_target_outcome;
+
+// Outcome of the last command sent to a target
+typedef struct {
+	uint8_t outcome;
+	uint8_t attempts;
+	clock_time_t started;      // First transmission
+	clock_time_t latency;      // From the first transmission to the accepted answer, retries included
+} command_target_stats;
+
+// Handles the answer of a target (NULL on timeout): true if the command has been executed
+typedef bool (*command_response_handler)(int target, coap_message_t *response);
+// Called when every target of the command has succeeded or failed
+typedef void (*command_done_callback)(int nr_succeeded, int nr_failed);
+
+
+int command_queue_init(const char *const *endpoints, int nr_targets);
+bool command_queue_send(const char *uri_path, const char *payload, const bool *targets,
+	command_response_handler handle_response, command_done_callback on_done);
+bool command_queue_is_busy(void);
+int command_queue_get_nr_targets(void);
+const command_target_stats *command_queue_get_stats(int target);
+int command_queue_write_stats(char *buffer, int buffer_size);
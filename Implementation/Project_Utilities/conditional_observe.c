@@ -0,0 +1,294 @@
+#include <string.h>
+
+#include "contiki.h"
+#include "coap-engine.h"
+#include "coap-observe.h"
+#include "coap-transactions.h"
+#include "lib/list.h"
+#include "sys/log.h"
+
+#include "conditional_observe.h"
+#include "global_constants.h"
+
+/*
+ * Notifications filtered per observer with the conditional attributes of the CoRE dynlink draft (observe_condition.c).
+ * The attributes are read from the query of the observe registration and kept with the token of the observer; an
+ * observer that gives none follows the default rule of the resource. At each sample the condition of every observer
+ * of the resource is evaluated once and only the observers whose condition fires are notified: the notifications
+ * are built as coap_notify_observers() does, one observer at a time, so that the others are not disturbed.
+ *
+ * An observer that registered with an Accept option receives its notifications in that format: the option is copied
+ * in the request handed to the GET handler, with the token of the observer.
+ *
+ * Every observer also has a cursor, left to the resource: the representation of a resource that sends the readings
+ * collected since the previous notification (e.g. a sample_batch) keeps there the first reading the observer has not
+ * received, so that observers notified at different times each get all the readings exactly once. The readings can
+ * be dropped up to the smallest cursor (conditional_observe_min_cursor()).
+ */
+
+typedef struct {
+	coap_resource_t *resource;   // NULL if the record is free
+	uint8_t token[COAP_TOKEN_LEN];
+	uint8_t token_len;
+	bool has_accept;
+	unsigned int accept;
+	bool uses_defaults;          // No attribute given: the default rule of the resource applies
+	observe_condition condition;
+	uint32_t cursor;             // Managed by the resource, 0 at the registration
+} observer_record;
+
+static observer_record records[CONDITIONAL_OBSERVE_MAX_OBSERVERS];
+
+
+/**
+ * @return The observer of the resource with the token, NULL if there is none (any more)
+ */
+static coap_observer_t *find_observer(const coap_resource_t *resource, const uint8_t *token, uint8_t token_len){
+
+	for (coap_observer_t *obs=(coap_observer_t *)list_head(coap_get_observers()); obs!=NULL; obs=obs->next){
+		if (obs->token_len==token_len && memcmp(obs->token,token,token_len)==0 && strcmp(obs->url,resource->url)==0){
+			return obs;
+		}
+	}
+	return NULL;
+}
+
+
+/**
+ * @return The record of the observer, NULL if it has none
+ */
+static observer_record *find_record(const coap_resource_t *resource, const uint8_t *token, uint8_t token_len){
+
+	for (int i=0; i<CONDITIONAL_OBSERVE_MAX_OBSERVERS; i++){
+		if (records[i].resource==resource && records[i].token_len==token_len && memcmp(records[i].token,token,token_len)==0){
+			return &records[i];
+		}
+	}
+	return NULL;
+}
+
+
+/**
+ * @return A record not used, or whose observer has gone (deregistered, reset or timed out); NULL if all are in use
+ */
+static observer_record *free_record(void){
+
+	for (int i=0; i<CONDITIONAL_OBSERVE_MAX_OBSERVERS; i++){
+		if (records[i].resource==NULL || find_observer(records[i].resource, records[i].token, records[i].token_len)==NULL){
+			return &records[i];
+		}
+	}
+	return NULL;
+}
+
+
+/**
+ * To be called by the GET handler of an observable resource: on an observe registration the attributes in the
+ * query are stored for the observer.
+ * @param resource The resource
+ * @param request The request received
+ * @param defaults The rule applied to the observers that give no attribute
+ * @param value The value sent in the answer
+ * @return false if the attributes are not valid (the registration has to be refused)
+ */
+bool conditional_observe_register(coap_resource_t *resource, coap_message_t *request, const observe_condition *defaults, float value){
+
+	uint32_t observe;
+	const char *query=NULL;
+
+	if (!coap_get_header_observe(request, &observe) || observe!=0){
+		return true;
+	}
+
+	observe_condition condition;
+	int query_length=coap_get_header_uri_query(request, &query);
+	int nr_attributes=observe_condition_parse(&condition, query, query_length);
+	if (nr_attributes<0){
+		LOG_DBG("Observe registration with invalid attributes: %.*s\n", query_length, query);
+		return false;
+	}
+	if (nr_attributes==0){
+		condition=*defaults;
+	}
+	observe_condition_start(&condition, value, (uint32_t)clock_seconds());
+
+	// A new registration with the same token replaces the previous one
+	observer_record *record=find_record(resource, request->token, request->token_len);
+	if (record==NULL){
+		record=free_record();
+	}
+	if (record==NULL){
+		LOG_DBG("No room for the attributes of the observer: notified at every sample\n");
+		return true;
+	}
+
+	record->resource=resource;
+	memcpy(record->token, request->token, request->token_len);
+	record->token_len=request->token_len;
+	record->has_accept=coap_get_header_accept(request, &record->accept);
+	record->uses_defaults=nr_attributes==0;
+	record->condition=condition;
+	record->cursor=0;
+	return true;
+}
+
+
+/**
+ * To be called by the GET handler of an observable resource, after conditional_observe_register(): gives the cursor
+ * of the observer the representation is built for (observe registration or notification).
+ * @param resource The resource
+ * @param request The request received, or the one built for a notification
+ * @return The cursor of the observer, NULL for a request that does not come from a known observer
+ */
+uint32_t *conditional_observe_cursor(const coap_resource_t *resource, const coap_message_t *request){
+
+	observer_record *record=find_record(resource, request->token, request->token_len);
+
+	return (record!=NULL) ? &record->cursor : NULL;
+}
+
+
+/**
+ * Finds the smallest cursor among the observers still registered to the resource: everything before it has been
+ * received by all of them. The cursors are compared as sequence numbers (they can wrap around).
+ * @param resource The resource
+ * @param cursor Filled with the smallest cursor
+ * @return false if the resource has no observer with a record
+ */
+bool conditional_observe_min_cursor(const coap_resource_t *resource, uint32_t *cursor){
+
+	bool found=false;
+
+	for (int i=0; i<CONDITIONAL_OBSERVE_MAX_OBSERVERS; i++){
+		if (records[i].resource!=resource || find_observer(resource, records[i].token, records[i].token_len)==NULL){
+			continue;
+		}
+		if (!found || (int32_t)(records[i].cursor-*cursor)<0){
+			*cursor=records[i].cursor;
+		}
+		found=true;
+	}
+	return found;
+}
+
+
+/**
+ * Sends a notification to a single observer, as coap_notify_observers() does for all of them.
+ * @return false if no transaction is available
+ */
+static bool notify_observer(coap_resource_t *resource, coap_observer_t *obs, const observer_record *record){
+
+	coap_message_t notification[1];
+	coap_message_t request[1];
+	coap_transaction_t *transaction=coap_new_transaction(coap_get_mid(), &obs->endpoint);
+
+	if (transaction==NULL){
+		return false;
+	}
+
+	coap_init_message(notification, COAP_TYPE_NON, CONTENT_2_05, 0);
+	// A confirmable notification from time to time tells if the observer is still there
+	if (COAP_OBSERVE_REFRESH_INTERVAL!=0 && (obs->obs_counter%COAP_OBSERVE_REFRESH_INTERVAL)==0){
+		notification->type=COAP_TYPE_CON;
+	}
+	notification->mid=transaction->mid;
+	obs->last_mid=transaction->mid;
+
+	// The "fake" request of the observer for the GET handler
+	coap_init_message(request, COAP_TYPE_CON, COAP_GET, 0);
+	coap_set_header_uri_path(request, obs->url);
+	coap_set_token(request, obs->token, obs->token_len);
+	if (record!=NULL && record->has_accept){
+		coap_set_header_accept(request, record->accept);
+	}
+
+	resource->get_handler(request, notification, transaction->message+COAP_MAX_HEADER_SIZE, REST_MAX_CHUNK_SIZE, NULL);
+
+	if (notification->code<BAD_REQUEST_4_00){
+		coap_set_header_observe(notification, (obs->obs_counter)++);
+		// Keep the observe option within 3 bytes
+		obs->obs_counter&=0xffffff;
+	}
+	coap_set_token(notification, obs->token, obs->token_len);
+
+	transaction->message_len=coap_serialize_message(notification, transaction->message);
+	coap_send_transaction(transaction);
+	return true;
+}
+
+
+/**
+ * Evaluates the condition of every observer of the resource for a new sample and notifies those whose condition
+ * fires. To be called once per sample.
+ * @param resource The resource
+ * @param value The sample
+ * @param forced true to notify the observers following the default rule of the resource even if their condition
+ *        does not fire, because the data waiting to be sent are about to be lost: only those at the smallest cursor
+ *        (the ones still waiting for the oldest data) are forced
+ * @return The number of observers notified
+ */
+int conditional_observe_notify(coap_resource_t *resource, float value, bool forced){
+
+	uint32_t now=(uint32_t)clock_seconds();
+	uint32_t oldest=0;
+	int nr_notified=0;
+
+	if (forced){
+		conditional_observe_min_cursor(resource, &oldest);
+	}
+
+	for (coap_observer_t *obs=(coap_observer_t *)list_head(coap_get_observers()); obs!=NULL; obs=obs->next){
+		if (strcmp(obs->url,resource->url)!=0){
+			continue;
+		}
+
+		observer_record *record=find_record(resource, obs->token, obs->token_len);
+		observe_condition previous={0};
+
+		if (record!=NULL){
+			previous=record->condition;
+			if (!observe_condition_fires(&record->condition, value, now, forced && record->uses_defaults && record->cursor==oldest)){
+				continue;
+			}
+		}
+
+		if (notify_observer(resource, obs, record)){
+			nr_notified++;
+		}
+		else if (record!=NULL){
+			// Not sent: the condition is evaluated again at the next sample
+			record->condition=previous;
+		}
+	}
+	return nr_notified;
+}
+
+
+/**
+ * Notifies every observer of the resource whatever its condition, e.g. when the representation has to be published
+ * at once. Unlike coap_notify_observers(), each notification is built with the Accept option of its observer.
+ * @param resource The resource
+ * @param value The value sent, from which the conditions start again
+ * @return The number of observers notified
+ */
+int conditional_observe_notify_all(coap_resource_t *resource, float value){
+
+	uint32_t now=(uint32_t)clock_seconds();
+	int nr_notified=0;
+
+	for (coap_observer_t *obs=(coap_observer_t *)list_head(coap_get_observers()); obs!=NULL; obs=obs->next){
+		if (strcmp(obs->url,resource->url)!=0){
+			continue;
+		}
+
+		observer_record *record=find_record(resource, obs->token, obs->token_len);
+
+		if (notify_observer(resource, obs, record)){
+			nr_notified++;
+			if (record!=NULL){
+				observe_condition_start(&record->condition, value, now);
+			}
+		}
+	}
+	return nr_notified;
+}
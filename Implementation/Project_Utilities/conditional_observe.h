@@ -0,0 +1,17 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "coap-engine.h"
+#include "observe_condition.h"
+
+// Observers whose attributes are kept (those beyond are notified at every sample)
+#ifndef CONDITIONAL_OBSERVE_MAX_OBSERVERS
+#define CONDITIONAL_OBSERVE_MAX_OBSERVERS COAP_MAX_OBSERVERS
+#endif
+
+
+bool conditional_observe_register(coap_resource_t *resource, coap_message_t *request, const observe_condition *defaults, float value);
+int conditional_observe_notify(coap_resource_t *resource, float value, bool forced);
+int conditional_observe_notify_all(coap_resource_t *resource, float value);
+uint32_t *conditional_observe_cursor(const coap_resource_t *resource, const coap_message_t *request);
+bool conditional_observe_min_cursor(const coap_resource_t *resource, uint32_t *cursor);
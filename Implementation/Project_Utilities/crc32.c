@@ -0,0 +1,26 @@
+#include "crc32.h"
+
+/*
+ * CRC-32 shared by the checks of the data kept on flash or sent over the air (model blobs, energy records) and by
+ * the ETags of the CoAP resources.
+ */
+
+
+/**
+ * CRC-32 (IEEE 802.3, the one of zlib and Java's java.util.zip.CRC32), bitwise to avoid a 1KB table in flash.
+ * @param crc The CRC of the previous data, 0 for the first call
+ * @param data The data
+ * @param length The length of the data
+ * @return The CRC updated with the data
+ */
+uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t length){
+
+	crc=~crc;
+	for (size_t i=0; i<length; i++){
+		crc^=data[i];
+		for (int b=0; b<8; b++){
+			crc=(crc>>1)^(0xEDB88320u&(-(crc&1)));
+		}
+	}
+	return ~crc;
+}
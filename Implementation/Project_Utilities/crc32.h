@@ -0,0 +1,5 @@
+#include <stddef.h>
+#include <stdint.h>
+
+
+uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t length);
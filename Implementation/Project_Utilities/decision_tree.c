@@ -0,0 +1,68 @@
+#include <stddef.h>
+
+#include "decision_tree.h"
+
+/*
+ * Inference of a decision tree exported as a flat array of nodes: one comparison per level, no floating point
+ * arithmetic, so it costs a tiny fraction of a forward pass of the neural network.
+ */
+
+
+/**
+ * Walks the tree from the root to a leaf.
+ * @param tree The decision tree
+ * @param features The input vector (n_features)
+ * @param n_features Number of features, must match the ones used to train the tree
+ * @param confidence If not NULL, filled with the confidence (0-1) of the leaf reached
+ * @return The predicted class, -1 if the input does not match the tree
+ */
+int decision_tree_predict(const decision_tree *tree, const float *features, int n_features, float *confidence){
+
+	uint16_t index=0;
+
+	if (n_features!=tree->n_features){
+		return -1;
+	}
+
+	while (tree->nodes[index].feature!=DECISION_TREE_LEAF){
+		const decision_tree_node *node=&tree->nodes[index];
+
+		if (features[node->feature]<=node->value){
+			index++;
+		}
+		else {
+			index=node->right_child;
+		}
+	}
+
+	if (confidence!=NULL){
+		*confidence=tree->nodes[index].value;
+	}
+	return tree->nodes[index].leaf_class;
+}
+
+
+/**
+ * Walks the tree and writes its answer as a probability vector, in the layout of the neural networks: the predicted
+ * class gets the confidence of the leaf, the others 0 (the tree does not say how the rest is shared among them).
+ * @param tree The decision tree
+ * @param features The input vector (n_features)
+ * @param n_features Number of features, must match the ones used to train the tree
+ * @param outputs Filled with the probability of each class
+ * @param n_outputs Number of classes of outputs
+ * @return The predicted class, -1 if the input does not match the tree (outputs all 0)
+ */
+int decision_tree_predict_proba(const decision_tree *tree, const float *features, int n_features, float *outputs, int n_outputs){
+
+	float confidence=0;
+	int predicted_class=decision_tree_predict(tree, features, n_features, &confidence);
+
+	for (int i=0; i<n_outputs; i++){
+		outputs[i]=0;
+	}
+	if (predicted_class<0 || predicted_class>=n_outputs){
+		return -1;
+	}
+	outputs[predicted_class]=confidence;
+	return predicted_class;
+}
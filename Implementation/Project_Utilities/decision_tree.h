@@ -0,0 +1,23 @@
+#include <stdint.h>
+
+#define DECISION_TREE_LEAF -1
+
+// Node of a binary decision tree stored as a flat array in depth-first order: the left child of an internal node
+// is always the next node of the array, so only the index of the right child is stored.
+typedef struct {
+	int8_t feature;       // Index of the feature compared at this node, DECISION_TREE_LEAF for the leaves
+	uint8_t leaf_class;   // Class predicted by the leaf
+	uint16_t right_child; // Node visited when features[feature] > value
+	float value;          // Split threshold for internal nodes, confidence of the prediction (0-1) for the leaves
+} decision_tree_node;
+
+typedef struct {
+	int16_t n_features;
+	int16_t n_classes;
+	uint16_t n_nodes;
+	const decision_tree_node *nodes;
+} decision_tree;
+
+
+int decision_tree_predict(const decision_tree *tree, const float *features, int n_features, float *confidence);
+int decision_tree_predict_proba(const decision_tree *tree, const float *features, int n_features, float *outputs, int n_outputs);
@@ -0,0 +1,160 @@
+#ifdef DIAGNOSTICS
+
+#include <stdio.h>
+#include <string.h>
+
+#include "contiki.h"
+#include "sys/energest.h"
+#include "sys/ctimer.h"
+
+#include "diagnostics.h"
+
+/*
+ * Where the time of the node goes. Energest (ENERGEST_CONF_ON) already tracks the time spent with the CPU active, in
+ * low-power mode and with the radio transmitting or listening: every DIAGNOSTICS_PERIOD seconds a snapshot of its
+ * totals is taken, so that the amounts of the last period can be given along with those since boot. On top of that
+ * the phases of the application bracketed by DIAGNOSTICS_BEGIN()/DIAGNOSTICS_END() are timed with the rtimer: two
+ * reads of the timer and a few additions per execution, cheap enough to leave on in production.
+ */
+
+// Energest types reported, in order
+#define NR_ENERGEST_TYPES 4
+
+static const uint8_t energest_types[NR_ENERGEST_TYPES] = {ENERGEST_TYPE_CPU, ENERGEST_TYPE_LPM, ENERGEST_TYPE_TRANSMIT, ENERGEST_TYPE_LISTEN};
+static const char *energest_names[NR_ENERGEST_TYPES] = {"cpu", "lpm", "tx", "rx"};
+static const char *phase_names[DIAGNOSTICS_NR_PHASES] = {"inference", "encoding", "parsing", "actuator"};
+
+static diagnostics_counter counters[DIAGNOSTICS_NR_PHASES];
+static rtimer_clock_t phase_start[DIAGNOSTICS_NR_PHASES];
+
+// Energest totals at the last snapshot and their increase over the last period (energest ticks)
+static uint64_t energest_snapshot[NR_ENERGEST_TYPES];
+static uint64_t energest_last_period[NR_ENERGEST_TYPES];
+
+static struct ctimer ctimer_snapshot;
+
+
+static void take_snapshot(void *ptr){
+
+	energest_flush();
+	for (int i=0; i<NR_ENERGEST_TYPES; i++){
+		uint64_t total=energest_type_time(energest_types[i]);
+
+		energest_last_period[i]=total-energest_snapshot[i];
+		energest_snapshot[i]=total;
+	}
+
+	for (int i=0; i<DIAGNOSTICS_NR_PHASES; i++){
+		counters[i].last_ticks=counters[i].period_ticks;
+		counters[i].period_ticks=0;
+	}
+
+	ctimer_reset(&ctimer_snapshot);
+}
+
+
+/**
+ * Clears the counters and starts the periodic snapshots. To be called by the main process.
+ */
+void diagnostics_init(void){
+
+	memset(counters,0,sizeof(counters));
+	memset(energest_snapshot,0,sizeof(energest_snapshot));
+	memset(energest_last_period,0,sizeof(energest_last_period));
+	ctimer_set(&ctimer_snapshot, DIAGNOSTICS_PERIOD*CLOCK_SECOND, take_snapshot, NULL);
+}
+
+
+/**
+ * Marks the start of an execution of a phase (the same phase is never nested).
+ * @param phase The phase
+ */
+void diagnostics_begin(diagnostics_phase phase){
+	phase_start[phase]=RTIMER_NOW();
+}
+
+
+/**
+ * Accounts for the execution of a phase started by diagnostics_begin().
+ * @param phase The phase
+ */
+void diagnostics_end(diagnostics_phase phase){
+
+	uint32_t elapsed=(uint32_t)(rtimer_clock_t)(RTIMER_NOW()-phase_start[phase]);
+	diagnostics_counter *counter=&counters[phase];
+
+	counter->count++;
+	counter->ticks+=elapsed;
+	counter->period_ticks+=elapsed;
+	if (elapsed>counter->max_ticks){
+		counter->max_ticks=elapsed;
+	}
+}
+
+
+// The libc of the nodes cannot print 64-bit integers: the value is split in two halves of 9 digits.
+static int append_uint64(char *buffer, int buffer_size, int length, uint64_t value){
+
+	if (value>=1000000000ULL){
+		return snprintf(buffer+length, buffer_size-length, "%lu%09lu",
+				(unsigned long)(value/1000000000ULL), (unsigned long)(value%1000000000ULL));
+	}
+	return snprintf(buffer+length, buffer_size-length, "%lu", (unsigned long)value);
+}
+
+
+#define APPEND(...) do { \
+		if (length<buffer_size) { \
+			length+=snprintf(buffer+length, buffer_size-length, __VA_ARGS__); \
+		} \
+	} while (0)
+
+#define APPEND_UINT64(value) do { \
+		if (length<buffer_size) { \
+			length+=append_uint64(buffer, buffer_size, length, value); \
+		} \
+	} while (0)
+
+
+/**
+ * Writes the counters as JSON: "cpu", "lpm", "tx" and "rx" are [since boot, last period] in ms; each phase executed
+ * at least once is [executions, total, max, time in the last period] with the times in us.
+ * @param buffer The destination
+ * @param buffer_size The size of the destination
+ * @return The length written, -1 if it does not fit
+ */
+int diagnostics_write(char *buffer, int buffer_size){
+
+	int length=0;
+
+	energest_flush();
+	APPEND("{\"period\":%u", (unsigned int)DIAGNOSTICS_PERIOD);
+
+	for (int i=0; i<NR_ENERGEST_TYPES; i++){
+		APPEND(",\"%s\":[", energest_names[i]);
+		APPEND_UINT64(energest_type_time(energest_types[i])*1000/ENERGEST_SECOND);
+		APPEND(",");
+		APPEND_UINT64(energest_last_period[i]*1000/ENERGEST_SECOND);
+		APPEND("]");
+	}
+
+	for (int i=0; i<DIAGNOSTICS_NR_PHASES; i++){
+		const diagnostics_counter *counter=&counters[i];
+
+		if (counter->count==0){
+			continue;
+		}
+		APPEND(",\"%s\":[%lu,", phase_names[i], (unsigned long)counter->count);
+		APPEND_UINT64(counter->ticks*1000000/RTIMER_SECOND);
+		APPEND(",%lu,%lu]", (unsigned long)((uint64_t)counter->max_ticks*1000000/RTIMER_SECOND),
+				(unsigned long)((uint64_t)counter->last_ticks*1000000/RTIMER_SECOND));
+	}
+	APPEND("}");
+
+	if (length>=buffer_size){
+		return -1;
+	}
+	return length;
+}
+
+#endif
@@ -0,0 +1,41 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+// Phases of the node whose execution time is measured
+typedef enum {
+	DIAGNOSTICS_INFERENCE,    // Fault classification
+	DIAGNOSTICS_ENCODING,     // SenML payloads of the observable resources
+	DIAGNOSTICS_PARSING,      // JSON of the messages received
+	DIAGNOSTICS_ACTUATOR,     // LEDs
+	DIAGNOSTICS_NR_PHASES
+} diagnostics_phase;
+
+// Seconds between two snapshots: the resource gives the totals since boot and the amounts of the last period
+#ifndef DIAGNOSTICS_PERIOD
+#define DIAGNOSTICS_PERIOD 60
+#endif
+
+// The instrumentation is built only with DIAGNOSTICS defined (make DIAGNOSTICS=on, the default): otherwise the
+// macros expand to nothing and neither the counters nor the resource are in the firmware.
+#ifdef DIAGNOSTICS
+#define DIAGNOSTICS_BEGIN(phase) diagnostics_begin(phase)
+#define DIAGNOSTICS_END(phase) diagnostics_end(phase)
+#else
+#define DIAGNOSTICS_BEGIN(phase) do {} while (0)
+#define DIAGNOSTICS_END(phase) do {} while (0)
+#endif
+
+// Executions of a phase, times in rtimer ticks
+typedef struct {
+	uint32_t count;
+	uint64_t ticks;
+	uint32_t max_ticks;
+	uint32_t period_ticks;    // Time in the period in progress
+	uint32_t last_ticks;      // Time in the last period completed
+} diagnostics_counter;
+
+
+void diagnostics_init(void);
+void diagnostics_begin(diagnostics_phase phase);
+void diagnostics_end(diagnostics_phase phase);
+int diagnostics_write(char *buffer, int buffer_size);
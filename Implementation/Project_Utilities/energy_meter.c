@@ -0,0 +1,136 @@
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "energy_meter.h"
+#include "crc32.h"
+
+/*
+ * Active energy integrated at every sample: the power measured is held until the next sample (as a meter that
+ * samples does) and the energy of the interval goes to the import or the export bucket of the tariff in force.
+ * The power is rounded to the milliwatt and the interval is counted in clock ticks, so each interval adds an exact
+ * integer (mW*ticks) to a 64-bit counter: there is no rounding that accumulates with the number of samples, the
+ * conversion to Wh happens only when the counters are read. At 10 kW and 128 ticks per second a counter overflows
+ * after more than 400 years.
+ */
+
+#define MILLIWATT_SECONDS_PER_WH 3600000ULL
+
+static const uint8_t tariff_schedule[24] = ENERGY_METER_TARIFF_SCHEDULE;
+
+
+/**
+ * Initializes a meter with all the counters at zero.
+ * @param meter The meter
+ * @param ticks_per_second Resolution of the clock that gives the times of the samples (CLOCK_SECOND)
+ */
+void energy_meter_init(energy_meter *meter, uint32_t ticks_per_second){
+	memset(meter,0,sizeof(*meter));
+	meter->ticks_per_second=ticks_per_second;
+}
+
+
+/**
+ * Accounts for a sample: the energy since the previous sample, at the power measured then, is added to the bucket
+ * of the tariff; the new power is held until the next sample.
+ * @param meter The meter
+ * @param power The active power (W): positive if imported from the grid, negative if exported
+ * @param now Time of the sample (clock ticks, wrapping around is allowed)
+ * @param tariff The tariff in force
+ */
+void energy_meter_add_sample(energy_meter *meter, float power, uint32_t now, int tariff){
+
+	if (meter->started && tariff>=0 && tariff<ENERGY_METER_NR_TARIFFS){
+		uint32_t elapsed=now-meter->last_time;
+
+		if (meter->last_power>0){
+			meter->counters.imported[tariff]+=(uint64_t)meter->last_power*elapsed;
+		}
+		else {
+			meter->counters.exported[tariff]+=(uint64_t)(-(int64_t)meter->last_power)*elapsed;
+		}
+	}
+
+	meter->last_power=(int32_t)lroundf(power*1000);
+	meter->last_time=now;
+	meter->started=true;
+}
+
+
+/**
+ * @param meter The meter
+ * @param counter One of the counters of the meter
+ * @return The energy of the counter, in whole Wh (the fraction stays in the counter)
+ */
+uint32_t energy_meter_get_wh(const energy_meter *meter, const uint64_t *counter){
+	return (uint32_t)(*counter/(MILLIWATT_SECONDS_PER_WH*meter->ticks_per_second));
+}
+
+
+/**
+ * @param seconds_of_day Local time (seconds since midnight)
+ * @return The tariff in force
+ */
+int energy_meter_tariff_of(uint32_t seconds_of_day){
+	return tariff_schedule[(seconds_of_day/3600)%24];
+}
+
+
+/**
+ * Prepares the counters to be saved.
+ * @param meter The meter
+ * @param sequence Number of the save, to recognize the newest copy
+ * @param record Filled with the record
+ */
+void energy_meter_to_record(const energy_meter *meter, uint32_t sequence, energy_meter_record *record){
+
+	memset(record,0,sizeof(*record));
+	record->magic=ENERGY_METER_RECORD_MAGIC;
+	record->version=ENERGY_METER_RECORD_VERSION;
+	record->sequence=sequence;
+	record->ticks_per_second=meter->ticks_per_second;
+	record->counters=meter->counters;
+	record->crc=crc32_update(0, (const uint8_t *)record, offsetof(energy_meter_record, crc));
+}
+
+
+/**
+ * Restores the counters saved in a record, if it is valid. The power held is not restored: the integration
+ * restarts from the next sample.
+ * @param meter The meter, initialized
+ * @param record The record read from flash
+ * @return false if the record is corrupted or comes from a clock with another resolution (nothing is changed)
+ */
+bool energy_meter_from_record(energy_meter *meter, const energy_meter_record *record){
+
+	if (record->magic!=ENERGY_METER_RECORD_MAGIC || record->version!=ENERGY_METER_RECORD_VERSION ||
+		record->ticks_per_second!=meter->ticks_per_second ||
+		record->crc!=crc32_update(0, (const uint8_t *)record, offsetof(energy_meter_record, crc))){
+		return false;
+	}
+
+	meter->counters=record->counters;
+	meter->started=false;
+	return true;
+}
+
+
+/**
+ * Restores the newest valid copy among the records read from the save slots: a record torn by a reset during its
+ * write, or saved with another clock resolution, is skipped and the previous copy is used.
+ * @param meter The meter, initialized
+ * @param records The records of the slots, NULL for a slot that could not be read
+ * @param nr_records The number of slots
+ * @return The sequence number of the copy restored, 0 if none is valid (the counters are left at zero)
+ */
+uint32_t energy_meter_restore_newest(energy_meter *meter, const energy_meter_record *const *records, int nr_records){
+
+	uint32_t sequence=0;
+
+	for (int i=0; i<nr_records; i++){
+		if (records[i]!=NULL && records[i]->sequence>sequence && energy_meter_from_record(meter, records[i])){
+			sequence=records[i]->sequence;
+		}
+	}
+	return sequence;
+}
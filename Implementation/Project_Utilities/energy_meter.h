@@ -0,0 +1,46 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+// Tariff windows: tariff (0..ENERGY_METER_NR_TARIFFS-1) of each hour of the day. The default is the Italian
+// F1 (8-19), F2 (7-8 and 19-23), F3 (23-7) split, without the weekend.
+#define ENERGY_METER_NR_TARIFFS 3
+#ifndef ENERGY_METER_TARIFF_SCHEDULE
+#define ENERGY_METER_TARIFF_SCHEDULE {2,2,2,2,2,2,2,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2}
+#endif
+
+#define ENERGY_METER_RECORD_MAGIC 0x4752454E // "NERG"
+#define ENERGY_METER_RECORD_VERSION 1
+
+// Energy of each tariff bucket, in milliwatt per clock tick: sums of integers, exact whatever the number of samples.
+typedef struct {
+	uint64_t imported[ENERGY_METER_NR_TARIFFS];
+	uint64_t exported[ENERGY_METER_NR_TARIFFS];
+} energy_meter_counters;
+
+typedef struct {
+	energy_meter_counters counters;
+	uint32_t ticks_per_second;
+	int32_t last_power;      // mW, held until the next sample
+	uint32_t last_time;      // Clock ticks of the last sample
+	bool started;
+} energy_meter;
+
+// Counters as saved on flash, with a sequence number to find the newest copy and a CRC-32 to detect torn writes.
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t reserved;
+	uint32_t sequence;
+	uint32_t ticks_per_second;
+	energy_meter_counters counters;
+	uint32_t crc;
+} energy_meter_record;
+
+
+void energy_meter_init(energy_meter *meter, uint32_t ticks_per_second);
+void energy_meter_add_sample(energy_meter *meter, float power, uint32_t now, int tariff);
+uint32_t energy_meter_get_wh(const energy_meter *meter, const uint64_t *counter);
+int energy_meter_tariff_of(uint32_t seconds_of_day);
+void energy_meter_to_record(const energy_meter *meter, uint32_t sequence, energy_meter_record *record);
+bool energy_meter_from_record(energy_meter *meter, const energy_meter_record *record);
+uint32_t energy_meter_restore_newest(energy_meter *meter, const energy_meter_record *const *records, int nr_records);
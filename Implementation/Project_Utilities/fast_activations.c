@@ -0,0 +1,283 @@
+#include <math.h>
+#include <stdint.h>
+
+#include "fast_activations.h"
+
+/*
+ * Cheap replacements of tanhf and expf for the hidden layers and the softmax of the fault detection network.
+ * On a Cortex-M without FPU every float operation is a library call, so the libm functions (range reduction plus
+ * high degree polynomials, with full IEEE handling) cost several times a table look-up or a short polynomial.
+ */
+
+#define TABLE_STEP 16.0f      // Samples per unit of the tables
+#define TANH_TABLE_LIMIT 6.0f // Outside [-6,6] tanh is saturated (error < 1.3e-5)
+#define EXP_TABLE_LIMIT 16.0f // Below -16 exp is approximated with 0 (error < 1.2e-7)
+#define TANH_TABLE_LAST 192   // Index of tanh(6)
+#define EXP_TABLE_LAST 256    // Index of exp(-16)
+
+#define POLY_TANH_LIMIT 7.90531110763549805f // Beyond this value the rational approximation rounds to +-1 in float
+#define POLY_TANH_SMALL 0.0004f                // Below this value tanh(x)=x in float
+
+#define POLY_EXP_MIN -87.3f // exp underflows below the smallest normal float
+#define POLY_EXP_MAX 88.7f  // exp overflows
+#define LOG2E 1.44269504088896341f
+#define LN2_HI 0.693359375f  // ln(2) split in two parts (Cody-Waite) to keep the reduced argument exact
+#define LN2_LO -2.12194440e-4f
+
+// tanh(-6+i/16)
+static const float tanh_table[TANH_TABLE_LAST+1] = {
+	-0.999987712f, -0.999986075f, -0.999984221f, -0.999982121f, -0.99997974f, -0.999977042f, -0.999973986f, -0.999970522f,
+	-0.999966597f, -0.99996215f, -0.99995711f, -0.9999514f, -0.999944929f, -0.999937596f, -0.999929287f, -0.999919873f,
+	-0.999909204f, -0.999897116f, -0.999883417f, -0.999867896f, -0.999850308f, -0.999830378f, -0.999807795f, -0.999782206f,
+	-0.999753211f, -0.999720356f, -0.999683128f, -0.999640944f, -0.999593146f, -0.999538987f, -0.999477619f, -0.999408086f,
+	-0.9993293f, -0.999240031f, -0.999138886f, -0.999024286f, -0.998894443f, -0.998747332f, -0.998580659f, -0.998391828f,
+	-0.998177898f, -0.997935538f, -0.997660979f, -0.997349955f, -0.996997635f, -0.996598555f, -0.996146531f, -0.995634567f,
+	-0.995054754f, -0.994398146f, -0.993654634f, -0.992812795f, -0.991859725f, -0.990780856f, -0.989559749f, -0.988177862f,
+	-0.986614298f, -0.984845517f, -0.982845029f, -0.980583047f, -0.978026115f, -0.975136698f, -0.971872746f, -0.968187217f,
+	-0.96402758f, -0.959335293f, -0.95404526f, -0.948085286f, -0.941375538f, -0.933828043f, -0.925346225f, -0.915824544f,
+	-0.905148254f, -0.89319334f, -0.8798267f, -0.864906618f, -0.84828364f, -0.82980191f, -0.80930107f, -0.786618812f,
+	-0.761594156f, -0.73407152f, -0.703905604f, -0.670967074f, -0.635148952f, -0.596373555f, -0.554599722f, -0.509829974f,
+	-0.462117157f, -0.411570056f, -0.358357398f, -0.302709729f, -0.244918662f, -0.1853332f, -0.124353002f, -0.0624187467f,
+	0.0f, 0.0624187467f, 0.124353002f, 0.1853332f, 0.244918662f, 0.302709729f, 0.358357398f, 0.411570056f,
+	0.462117157f, 0.509829974f, 0.554599722f, 0.596373555f, 0.635148952f, 0.670967074f, 0.703905604f, 0.73407152f,
+	0.761594156f, 0.786618812f, 0.80930107f, 0.82980191f, 0.84828364f, 0.864906618f, 0.8798267f, 0.89319334f,
+	0.905148254f, 0.915824544f, 0.925346225f, 0.933828043f, 0.941375538f, 0.948085286f, 0.95404526f, 0.959335293f,
+	0.96402758f, 0.968187217f, 0.971872746f, 0.975136698f, 0.978026115f, 0.980583047f, 0.982845029f, 0.984845517f,
+	0.986614298f, 0.988177862f, 0.989559749f, 0.990780856f, 0.991859725f, 0.992812795f, 0.993654634f, 0.994398146f,
+	0.995054754f, 0.995634567f, 0.996146531f, 0.996598555f, 0.996997635f, 0.997349955f, 0.997660979f, 0.997935538f,
+	0.998177898f, 0.998391828f, 0.998580659f, 0.998747332f, 0.998894443f, 0.999024286f, 0.999138886f, 0.999240031f,
+	0.9993293f, 0.999408086f, 0.999477619f, 0.999538987f, 0.999593146f, 0.999640944f, 0.999683128f, 0.999720356f,
+	0.999753211f, 0.999782206f, 0.999807795f, 0.999830378f, 0.999850308f, 0.999867896f, 0.999883417f, 0.999897116f,
+	0.999909204f, 0.999919873f, 0.999929287f, 0.999937596f, 0.999944929f, 0.9999514f, 0.99995711f, 0.99996215f,
+	0.999966597f, 0.999970522f, 0.999973986f, 0.999977042f, 0.99997974f, 0.999982121f, 0.999984221f, 0.999986075f,
+	0.999987712f
+};
+
+// exp(-i/16)
+static const float exp_table[EXP_TABLE_LAST+1] = {
+	1.0f, 0.939413063f, 0.882496903f, 0.829029118f, 0.778800783f, 0.731615629f, 0.687289279f, 0.645648526f,
+	0.60653066f, 0.569782825f, 0.535261429f, 0.502831578f, 0.472366553f, 0.44374731f, 0.41686202f, 0.391605627f,
+	0.367879441f, 0.345590753f, 0.324652467f, 0.304982769f, 0.286504797f, 0.269146349f, 0.252839596f, 0.237520819f,
+	0.22313016f, 0.209611387f, 0.196911675f, 0.1849814f, 0.173773943f, 0.163245512f, 0.153354967f, 0.144063659f,
+	0.135335283f, 0.127135733f, 0.119432968f, 0.112196891f, 0.105399225f, 0.0990134084f, 0.0930144892f, 0.0873790262f,
+	0.0820849986f, 0.07711172f, 0.072439757f, 0.068050854f, 0.0639278612f, 0.0600546679f, 0.0564161395f, 0.0529980584f,
+	0.0497870684f, 0.0467706224f, 0.0439369336f, 0.0412749294f, 0.0387742078f, 0.0364249973f, 0.0342181183f, 0.0321449473f,
+	0.0301973834f, 0.0283678164f, 0.0266490973f, 0.0250345101f, 0.0235177459f, 0.0220928777f, 0.0207543379f, 0.0194968961f,
+	0.0183156389f, 0.0172059504f, 0.0161634946f, 0.015184198f, 0.0142642339f, 0.0134000077f, 0.0125881422f, 0.0118254653f,
+	0.0111089965f, 0.0104359365f, 0.00980365504f, 0.0092096816f, 0.0086516952f, 0.00812751549f, 0.00763509422f, 0.00717250725f,
+	0.006737947f, 0.00632971543f, 0.00594621736f, 0.00558595426f, 0.0052475184f, 0.00492958733f, 0.00463091873f, 0.00435034555f,
+	0.00408677144f, 0.00383916647f, 0.00360656314f, 0.00338805252f, 0.0031827808f, 0.00298994586f, 0.00280879419f, 0.00263861796f,
+	0.00247875218f, 0.00232857217f, 0.00218749112f, 0.00205495773f, 0.00193045414f, 0.00181349383f, 0.0017036198f, 0.00160040269f,
+	0.00150343919f, 0.00141235042f, 0.00132678043f, 0.00124639487f, 0.00117087962f, 0.00109993961f, 0.00103329764f, 0.0009706933f,
+	0.000911881966f, 0.00085663383f, 0.00080473301f, 0.000755976702f, 0.000710174389f, 0.000667147098f, 0.000626726698f, 0.000588755247f,
+	0.00055308437f, 0.000519574682f, 0.000488095244f, 0.000458523048f, 0.000430742541f, 0.000404645169f, 0.000380128958f, 0.000357098109f,
+	0.000335462628f, 0.000315137975f, 0.00029604473f, 0.000278108287f, 0.000261258557f, 0.000245429702f, 0.000230559868f, 0.000216590951f,
+	0.000203468369f, 0.000191140844f, 0.000179560205f, 0.000168681203f, 0.000158461325f, 0.000148860639f, 0.000139841629f, 0.000131369053f,
+	0.000123409804f, 0.000115932782f, 0.00010890877f, 0.000102310321f, 9.61116521e-05f, 9.02885414e-05f, 8.48182352e-05f, 7.96793582e-05f,
+	7.48518299e-05f, 7.03167868e-05f, 6.6056508e-05f, 6.20543465e-05f, 5.82946637e-05f, 5.47627686e-05f, 5.14448602e-05f, 4.83279737e-05f,
+	4.53999298e-05f, 4.26492871e-05f, 4.00652974e-05f, 3.76378637e-05f, 3.53575009e-05f, 3.32152982e-05f, 3.1202885e-05f, 2.93123978e-05f,
+	2.75364493e-05f, 2.58681002e-05f, 2.43008313e-05f, 2.28285183e-05f, 2.14454083e-05f, 2.01460967e-05f, 1.89255064e-05f, 1.77788679e-05f,
+	1.67017008e-05f, 1.56897959e-05f, 1.47391992e-05f, 1.38461963e-05f, 1.30072977e-05f, 1.22192253e-05f, 1.14788999e-05f, 1.07834285e-05f,
+	1.01300936e-05f, 9.51634225e-06f, 8.93977622e-06f, 8.39814256e-06f, 7.88932483e-06f, 7.4113348e-06f, 6.96230472e-06f, 6.54048e-06f,
+	6.14421235e-06f, 5.77195335e-06f, 5.42224837e-06f, 5.09373095e-06f, 4.78511739e-06f, 4.49520179e-06f, 4.22285128e-06f, 3.96700165e-06f,
+	3.72665317e-06f, 3.50086667e-06f, 3.28875988e-06f, 3.08950399e-06f, 2.90232041e-06f, 2.7264777e-06f, 2.56128877e-06f, 2.40610813e-06f,
+	2.26032941e-06f, 2.12338297e-06f, 1.9947337e-06f, 1.8738789e-06f, 1.76034631e-06f, 1.65369232e-06f, 1.55350017e-06f, 1.45937835e-06f,
+	1.37095909e-06f, 1.28789687e-06f, 1.20986715e-06f, 1.136565e-06f, 1.06770401e-06f, 1.00301509e-06f, 9.42245482e-07f, 8.85157714e-07f,
+	8.31528719e-07f, 7.81148941e-07f, 7.33821519e-07f, 6.89361521e-07f, 6.47595218e-07f, 6.08359407e-07f, 5.71500774e-07f, 5.36875292e-07f,
+	5.04347663e-07f, 4.73790782e-07f, 4.4508525e-07f, 4.18118898e-07f, 3.92786355e-07f, 3.68988632e-07f, 3.46632741e-07f, 3.25631325e-07f,
+	3.05902321e-07f, 2.87368636e-07f, 2.6995785e-07f, 2.53601931e-07f, 2.38236967e-07f, 2.23802919e-07f, 2.10243385e-07f, 1.97505382e-07f,
+	1.85539136e-07f, 1.74297888e-07f, 1.63737713e-07f, 1.53817347e-07f, 1.44498025e-07f, 1.35743332e-07f, 1.27519059e-07f, 1.1979307e-07f,
+	1.12535175e-07f
+};
+
+
+/**
+ * tanh through the table with linear interpolation.
+ * @param x The input value
+ * @return An approximation of tanh(x) (max absolute error 3.8e-4)
+ */
+float fast_tanhf_table(float x){
+
+	float position, frac;
+	int index;
+
+	if (x<=-TANH_TABLE_LIMIT){
+		return tanh_table[0];
+	}
+	if (x>=TANH_TABLE_LIMIT){
+		return -tanh_table[0];
+	}
+	position=(x+TANH_TABLE_LIMIT)*TABLE_STEP;
+	index=(int)position;
+	// Just below the limit x+6 can round up to 12: the position is then the last sample
+	if (index>=TANH_TABLE_LAST){
+		return tanh_table[TANH_TABLE_LAST];
+	}
+	frac=position-index;
+	return tanh_table[index]+(tanh_table[index+1]-tanh_table[index])*frac;
+}
+
+
+/**
+ * tanh through the rational approximation x*P(x^2)/Q(x^2) of degree 13/6 used by Eigen for float.
+ * @param x The input value
+ * @return An approximation of tanh(x) (max absolute error 3.3e-7)
+ */
+float fast_tanhf_poly(float x){
+
+	float x2, p, q;
+
+	if (x>POLY_TANH_LIMIT){
+		x=POLY_TANH_LIMIT;
+	}
+	if (x<-POLY_TANH_LIMIT){
+		x=-POLY_TANH_LIMIT;
+	}
+	if (fabsf(x)<POLY_TANH_SMALL){
+		return x;
+	}
+
+	x2=x*x;
+	p=-2.76076847742355e-16f;
+	p=p*x2+2.00018790482477e-13f;
+	p=p*x2-8.60467152213735e-11f;
+	p=p*x2+5.12229709037114e-08f;
+	p=p*x2+1.48572235717979e-05f;
+	p=p*x2+6.37261928875436e-04f;
+	p=p*x2+4.89352455891786e-03f;
+	p=p*x;
+
+	q=1.19825839466702e-06f;
+	q=q*x2+1.18534705686654e-04f;
+	q=q*x2+2.26843463243900e-03f;
+	q=q*x2+4.89352518554385e-03f;
+
+	return p/q;
+}
+
+
+/**
+ * exp through the table with linear interpolation, meant for the softmax where all the arguments are <=0.
+ * @param x The input value, positive values are clamped to 0
+ * @return An approximation of exp(x) (max relative error 4.9e-4)
+ */
+float fast_expf_table(float x){
+
+	float position, frac;
+	int index;
+
+	if (x>=0){
+		return exp_table[0];
+	}
+	if (x<=-EXP_TABLE_LIMIT){
+		return 0;
+	}
+	position=-x*TABLE_STEP;
+	// Exact (power of two scaling): the position stays below the last sample
+	index=(int)position;
+	frac=position-index;
+	return exp_table[index]+(exp_table[index+1]-exp_table[index])*frac;
+}
+
+
+/**
+ * exp as 2^n*exp(r), with n=round(x/ln2) and |r|<=ln2/2 evaluated by a polynomial of degree 6.
+ * The power of two is written directly in the exponent bits of the float.
+ * @param x The input value
+ * @return An approximation of exp(x) (max relative error 2.5e-7)
+ */
+float fast_expf_poly(float x){
+
+	float n, r, p;
+	union {
+		float f;
+		uint32_t i;
+	} power;
+
+	if (x<POLY_EXP_MIN){
+		return 0;
+	}
+	if (x>POLY_EXP_MAX){
+		return HUGE_VALF;
+	}
+
+	n=floorf(x*LOG2E+0.5f);
+	r=x-n*LN2_HI-n*LN2_LO;
+
+	p=1.0f/720;
+	p=p*r+1.0f/120;
+	p=p*r+1.0f/24;
+	p=p*r+1.0f/6;
+	p=p*r+0.5f;
+	p=p*r+1.0f;
+	p=p*r+1.0f;
+
+	power.i=(uint32_t)((int32_t)n+127)<<23;
+	return p*power.f;
+}
+
+
+/**
+ * Applies tanh in place to a vector.
+ * @param backend The implementation of tanh
+ * @param values The vector
+ * @param n The length of the vector
+ */
+void fast_activations_tanh(fast_activations_backend backend, float *values, int n){
+
+	switch (backend){
+		case FAST_ACTIVATIONS_TABLE:
+			for (int i=0; i<n; i++){
+				values[i]=fast_tanhf_table(values[i]);
+			}
+			break;
+
+		case FAST_ACTIVATIONS_POLY:
+			for (int i=0; i<n; i++){
+				values[i]=fast_tanhf_poly(values[i]);
+			}
+			break;
+
+		default:
+			for (int i=0; i<n; i++){
+				values[i]=tanhf(values[i]);
+			}
+	}
+}
+
+
+/**
+ * Applies the softmax in place to a vector (the maximum is subtracted first, so exp only sees arguments <=0).
+ * @param backend The implementation of exp
+ * @param values The vector
+ * @param n The length of the vector
+ */
+void fast_activations_softmax(fast_activations_backend backend, float *values, int n){
+
+	float max=values[0];
+	float sum=0;
+
+	for (int i=1; i<n; i++){
+		if (values[i]>max){
+			max=values[i];
+		}
+	}
+
+	for (int i=0; i<n; i++){
+		switch (backend){
+			case FAST_ACTIVATIONS_TABLE:
+				values[i]=fast_expf_table(values[i]-max);
+				break;
+			case FAST_ACTIVATIONS_POLY:
+				values[i]=fast_expf_poly(values[i]-max);
+				break;
+			default:
+				values[i]=expf(values[i]-max);
+		}
+		sum+=values[i];
+	}
+
+	for (int i=0; i<n; i++){
+		values[i]/=sum;
+	}
+}
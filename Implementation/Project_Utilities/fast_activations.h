@@ -0,0 +1,18 @@
+// Activation functions of the float networks: libm (reference), look-up tables or polynomial/rational
+// approximations. Max errors, measured by Project_HostTools/activation_benchmark on a dense sweep:
+//   table: tanh 3.8e-4 absolute, exp 4.9e-4 relative on [-16,0] (linear interpolation with a step of 1/16)
+//   poly : tanh 3.3e-7 absolute, exp 2.5e-7 relative
+typedef enum {
+	FAST_ACTIVATIONS_LIBM,
+	FAST_ACTIVATIONS_TABLE,
+	FAST_ACTIVATIONS_POLY
+} fast_activations_backend;
+
+
+float fast_tanhf_table(float x);
+float fast_tanhf_poly(float x);
+float fast_expf_table(float x);
+float fast_expf_poly(float x);
+
+void fast_activations_tanh(fast_activations_backend backend, float *values, int n);
+void fast_activations_softmax(fast_activations_backend backend, float *values, int n);
@@ -0,0 +1,95 @@
+#include <math.h>
+#include <string.h>
+
+#include "inference_cache.h"
+
+/*
+ * Change-driven inference: the classifier is evaluated again only when at least one feature moved outside its
+ * tolerance band around the features of the last fresh inference (the band is not re-centred on hits, so a slow
+ * drift is detected as well), or when max_skips results have been reused in a row.
+ */
+
+
+/**
+ * Initializes an empty cache.
+ * @param cache The cache to initialize
+ * @param n_features Number of features of the classifier
+ * @param n_outputs Number of outputs (class probabilities) of the classifier
+ * @param tolerances Maximum absolute variation of each feature (n_features values)
+ * @param max_skips Maximum number of consecutive hits, 0 disables the cache
+ * @return 0 on success, -1 if the sizes exceed the ones supported
+ */
+int inference_cache_init(inference_cache *cache, int n_features, int n_outputs, const float *tolerances, uint16_t max_skips){
+
+	if (n_features<=0 || n_features>INFERENCE_CACHE_MAX_FEATURES || n_outputs<=0 || n_outputs>INFERENCE_CACHE_MAX_OUTPUTS){
+		return -1;
+	}
+
+	memset(cache,0,sizeof(*cache));
+	cache->n_features=n_features;
+	cache->n_outputs=n_outputs;
+	memcpy(cache->tolerances,tolerances,n_features*sizeof(float));
+	cache->max_skips=max_skips;
+	return 0;
+}
+
+
+/**
+ * Checks if the result of the last inference can be reused for the given features and updates the statistics.
+ * @param cache The cache
+ * @param features The current features (n_features)
+ * @param outputs Filled with the cached outputs on a hit
+ * @param predicted_class Filled with the cached class on a hit
+ * @return true on a hit, false if a fresh inference is required (its result must be passed to inference_cache_store)
+ */
+bool inference_cache_lookup(inference_cache *cache, const float *features, float *outputs, int *predicted_class){
+
+	if (!cache->valid){
+		cache->misses++;
+		return false;
+	}
+
+	for (int i=0; i<cache->n_features; i++){
+		if (!(fabsf(features[i]-cache->features[i])<=cache->tolerances[i])){
+			cache->misses++;
+			return false;
+		}
+	}
+
+	if (cache->skips>=cache->max_skips){
+		cache->misses++;
+		cache->forced_misses++;
+		return false;
+	}
+
+	cache->skips++;
+	cache->hits++;
+	memcpy(outputs,cache->outputs,cache->n_outputs*sizeof(float));
+	*predicted_class=cache->predicted_class;
+	return true;
+}
+
+
+/**
+ * Saves the result of a fresh inference as the new reference of the tolerance bands.
+ * @param cache The cache
+ * @param features The features given to the classifier (n_features)
+ * @param outputs The outputs of the classifier (n_outputs)
+ * @param predicted_class The class predicted
+ */
+void inference_cache_store(inference_cache *cache, const float *features, const float *outputs, int predicted_class){
+	memcpy(cache->features,features,cache->n_features*sizeof(float));
+	memcpy(cache->outputs,outputs,cache->n_outputs*sizeof(float));
+	cache->predicted_class=predicted_class;
+	cache->skips=0;
+	cache->valid=true;
+}
+
+
+/**
+ * Forces a fresh inference at the next lookup, e.g. after the tolerances have been changed.
+ * @param cache The cache
+ */
+void inference_cache_invalidate(inference_cache *cache){
+	cache->valid=false;
+}
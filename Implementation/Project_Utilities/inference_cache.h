@@ -0,0 +1,28 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#define INFERENCE_CACHE_MAX_FEATURES 8
+#define INFERENCE_CACHE_MAX_OUTPUTS 8
+
+// Result of the last full inference, reused while the input stays inside a tolerance band around the cached features.
+typedef struct {
+	int16_t n_features;
+	int16_t n_outputs;
+	float tolerances[INFERENCE_CACHE_MAX_FEATURES]; // Maximum absolute variation of each feature to reuse the result
+	uint16_t max_skips;                            // Inferences skipped in a row before forcing a fresh one
+	bool valid;
+	uint16_t skips;
+	float features[INFERENCE_CACHE_MAX_FEATURES];
+	float outputs[INFERENCE_CACHE_MAX_OUTPUTS];
+	int predicted_class;
+	// Statistics
+	unsigned long hits;
+	unsigned long misses;        // All the fresh inferences, forced ones included
+	unsigned long forced_misses; // Fresh inferences caused only by max_skips
+} inference_cache;
+
+
+int inference_cache_init(inference_cache *cache, int n_features, int n_outputs, const float *tolerances, uint16_t max_skips);
+bool inference_cache_lookup(inference_cache *cache, const float *features, float *outputs, int *predicted_class);
+void inference_cache_store(inference_cache *cache, const float *features, const float *outputs, int predicted_class);
+void inference_cache_invalidate(inference_cache *cache);
@@ -0,0 +1,160 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cJSON.h"
+#include "json_pool.h"
+
+/*
+ * Static memory for cJSON, installed with cJSON_InitHooks: the nodes and the strings are served by fixed-size blocks
+ * of two classes, so the memory used by JSON can never grow beyond the pool nor fragment the heap, whatever the
+ * uptime. cJSON only works with short-lived objects here (the messages built before a request), thus the pool can
+ * be reset once the request is completed: what is still allocated at that point is counted as a leak and reclaimed.
+ */
+
+// Blocks of 8 bytes words, to keep the alignment of the doubles inside the cJSON nodes
+static uint64_t small_blocks[JSON_POOL_NR_SMALL_BLOCKS][(JSON_POOL_SMALL_BLOCK_SIZE+7)/8];
+static uint64_t large_blocks[JSON_POOL_NR_LARGE_BLOCKS][(JSON_POOL_LARGE_BLOCK_SIZE+7)/8];
+
+static bool small_used[JSON_POOL_NR_SMALL_BLOCKS];
+static bool large_used[JSON_POOL_NR_LARGE_BLOCKS];
+
+static json_pool_stats stats;
+
+
+/**
+ * Installs the pool as the allocator of cJSON. To be called once, before any other cJSON function.
+ */
+void json_pool_init(void){
+
+	cJSON_Hooks hooks = {json_pool_malloc, json_pool_free};
+
+	memset(small_used,0,sizeof(small_used));
+	memset(large_used,0,sizeof(large_used));
+	memset(&stats,0,sizeof(stats));
+	cJSON_InitHooks(&hooks);
+}
+
+
+// Takes the first free block of a class
+static void *take_block(bool *used, int nr_blocks, void *blocks, size_t block_size, uint16_t *in_use, uint16_t *high_water_mark){
+
+	for (int i=0; i<nr_blocks; i++){
+		if (!used[i]){
+			used[i]=true;
+			(*in_use)++;
+			if (*in_use>*high_water_mark){
+				*high_water_mark=*in_use;
+			}
+			return (uint8_t *)blocks+i*block_size;
+		}
+	}
+	return NULL;
+}
+
+
+/**
+ * Allocates a block large enough for size bytes: a small one if possible, otherwise a large one.
+ * @return The block, NULL if the request cannot be served
+ */
+void *json_pool_malloc(size_t size){
+
+	void *block=NULL;
+
+	if (size<=JSON_POOL_SMALL_BLOCK_SIZE){
+		block=take_block(small_used,JSON_POOL_NR_SMALL_BLOCKS,small_blocks,sizeof(small_blocks[0]),&stats.small_in_use,&stats.small_high_water_mark);
+	}
+	if (block==NULL && size<=JSON_POOL_LARGE_BLOCK_SIZE){
+		block=take_block(large_used,JSON_POOL_NR_LARGE_BLOCKS,large_blocks,sizeof(large_blocks[0]),&stats.large_in_use,&stats.large_high_water_mark);
+	}
+
+	if (block==NULL){
+		stats.failures++;
+		printf("JSON pool: cannot allocate %u bytes\n",(unsigned int)size);
+	}
+	else {
+		stats.allocations++;
+	}
+	return block;
+}
+
+
+// Releases the block of a class if the pointer belongs to it, returns false otherwise
+static bool release_block(void *block, bool *used, int nr_blocks, void *blocks, size_t block_size, uint16_t *in_use){
+
+	uint8_t *start=(uint8_t *)blocks;
+	uint8_t *pointer=(uint8_t *)block;
+
+	if (pointer<start || pointer>=start+nr_blocks*block_size){
+		return false;
+	}
+
+	int index=(pointer-start)/block_size;
+	if (pointer!=start+index*block_size || !used[index]){
+		stats.invalid_frees++;
+		return true;
+	}
+	used[index]=false;
+	(*in_use)--;
+	return true;
+}
+
+
+/**
+ * Gives a block back to the pool. NULL is ignored as by free().
+ */
+void json_pool_free(void *block){
+
+	if (block==NULL){
+		return;
+	}
+	if (!release_block(block,small_used,JSON_POOL_NR_SMALL_BLOCKS,small_blocks,sizeof(small_blocks[0]),&stats.small_in_use) &&
+	    !release_block(block,large_used,JSON_POOL_NR_LARGE_BLOCKS,large_blocks,sizeof(large_blocks[0]),&stats.large_in_use)){
+		stats.invalid_frees++;
+	}
+}
+
+
+/**
+ * Reclaims all the blocks, to be called when no JSON object or string is in use anymore (e.g. at the end of a request).
+ * The blocks still allocated are counted as leaks.
+ * @return The number of blocks leaked by the request, 0 if everything had been freed
+ */
+unsigned int json_pool_reset(void){
+
+	unsigned int leaked=stats.small_in_use+stats.large_in_use;
+
+	stats.leaks+=leaked;
+	memset(small_used,0,sizeof(small_used));
+	memset(large_used,0,sizeof(large_used));
+	stats.small_in_use=0;
+	stats.large_in_use=0;
+	return leaked;
+}
+
+
+const json_pool_stats *json_pool_get_stats(void){
+	return &stats;
+}
+
+
+/**
+ * Writes the counters of the pool as a JSON object.
+ * @param buffer The destination
+ * @param buffer_size The size of the destination
+ * @return The length written, -1 if it does not fit
+ */
+int json_pool_write_stats(char *buffer, int buffer_size){
+
+	int length=snprintf(buffer, buffer_size,
+			"{\"small_in_use\":%u,\"small_max\":%u,\"small_blocks\":%u,\"large_in_use\":%u,\"large_max\":%u,\"large_blocks\":%u,"
+			"\"allocations\":%lu,\"failures\":%lu,\"leaks\":%lu,\"invalid_frees\":%lu}",
+			stats.small_in_use, stats.small_high_water_mark, (unsigned int)JSON_POOL_NR_SMALL_BLOCKS,
+			stats.large_in_use, stats.large_high_water_mark, (unsigned int)JSON_POOL_NR_LARGE_BLOCKS,
+			stats.allocations, stats.failures, stats.leaks, stats.invalid_frees);
+
+	if (length<0 || length>=buffer_size){
+		return -1;
+	}
+	return length;
+}
@@ -0,0 +1,36 @@
+#include <stddef.h>
+#include <stdint.h>
+
+// Sizes of the pool, fixed at build time (they can be overridden in project-conf.h).
+// The small blocks hold the cJSON nodes and the short strings, the large ones the buffers of cJSON_Print.
+#ifndef JSON_POOL_SMALL_BLOCK_SIZE
+#define JSON_POOL_SMALL_BLOCK_SIZE 64
+#endif
+#ifndef JSON_POOL_NR_SMALL_BLOCKS
+#define JSON_POOL_NR_SMALL_BLOCKS 16
+#endif
+#ifndef JSON_POOL_LARGE_BLOCK_SIZE
+#define JSON_POOL_LARGE_BLOCK_SIZE 256
+#endif
+#ifndef JSON_POOL_NR_LARGE_BLOCKS
+#define JSON_POOL_NR_LARGE_BLOCKS 4
+#endif
+
+typedef struct {
+	uint16_t small_in_use;
+	uint16_t large_in_use;
+	uint16_t small_high_water_mark;
+	uint16_t large_high_water_mark;
+	unsigned long allocations;
+	unsigned long failures;      // Requests not served: pool exhausted or size larger than a large block
+	unsigned long leaks;         // Blocks still allocated when the pool was reset
+	unsigned long invalid_frees; // Pointers not belonging to the pool, or blocks already free
+} json_pool_stats;
+
+
+void json_pool_init(void);
+void *json_pool_malloc(size_t size);
+void json_pool_free(void *block);
+unsigned int json_pool_reset(void);
+const json_pool_stats *json_pool_get_stats(void);
+int json_pool_write_stats(char *buffer, int buffer_size);
@@ -0,0 +1,388 @@
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "json_tokenizer.h"
+
+/*
+ * Single pass scanner for the small fixed-schema JSON objects exchanged by the sensors. It works in place on the
+ * CoAP payload, bounded by its explicit length (the payload is not NUL-terminated), and never allocates: looking up
+ * a key walks the members of the top-level object skipping the values of the other ones.
+ * Keys are compared byte by byte (case-sensitive, escape sequences not decoded).
+ */
+
+typedef struct {
+	const char *position;
+	const char *end;
+} json_scanner;
+
+
+static void skip_whitespaces(json_scanner *scanner){
+	while (scanner->position<scanner->end &&
+	       (*scanner->position==' ' || *scanner->position=='\t' || *scanner->position=='\n' || *scanner->position=='\r')){
+		scanner->position++;
+	}
+}
+
+
+static bool is_digit(char c){
+	return c>='0' && c<='9';
+}
+
+
+static bool is_hex_digit(char c){
+	return is_digit(c) || (c>='a' && c<='f') || (c>='A' && c<='F');
+}
+
+
+// Consumes the literal if it is the next token
+static bool scan_literal(json_scanner *scanner, const char *literal){
+
+	size_t length=strlen(literal);
+
+	if ((size_t)(scanner->end-scanner->position)<length || memcmp(scanner->position,literal,length)!=0){
+		return false;
+	}
+	scanner->position+=length;
+	return true;
+}
+
+
+/**
+ * Scans a string, the scanner being on the opening quote.
+ * @return true if the string is well formed; start and length delimit its content, quotes excluded
+ */
+static bool scan_string(json_scanner *scanner, const char **start, uint16_t *length){
+
+	scanner->position++;
+	*start=scanner->position;
+
+	while (scanner->position<scanner->end){
+		unsigned char c=(unsigned char)*scanner->position;
+
+		if (c=='"'){
+			*length=scanner->position-*start;
+			scanner->position++;
+			return true;
+		}
+		if (c<0x20){
+			return false;
+		}
+		if (c=='\\'){
+			scanner->position++;
+			if (scanner->position>=scanner->end){
+				return false;
+			}
+			if (*scanner->position=='u'){
+				if (scanner->end-scanner->position<5){
+					return false;
+				}
+				for (int i=1; i<=4; i++){
+					if (!is_hex_digit(scanner->position[i])){
+						return false;
+					}
+				}
+				scanner->position+=4;
+			}
+			else if (*scanner->position=='\0' || strchr("\"\\/bfnrt",*scanner->position)==NULL){
+				return false;
+			}
+		}
+		scanner->position++;
+	}
+	return false;
+}
+
+
+// Scans a number following the JSON grammar (no leading zeros, no leading '+', no hexadecimals)
+static bool scan_number(json_scanner *scanner){
+
+	const char *start=scanner->position;
+
+	if (scanner->position<scanner->end && *scanner->position=='-'){
+		scanner->position++;
+	}
+	if (scanner->position>=scanner->end || !is_digit(*scanner->position)){
+		return false;
+	}
+	if (*scanner->position=='0'){
+		scanner->position++;
+	}
+	else {
+		while (scanner->position<scanner->end && is_digit(*scanner->position)){
+			scanner->position++;
+		}
+	}
+
+	if (scanner->position<scanner->end && *scanner->position=='.'){
+		scanner->position++;
+		if (scanner->position>=scanner->end || !is_digit(*scanner->position)){
+			return false;
+		}
+		while (scanner->position<scanner->end && is_digit(*scanner->position)){
+			scanner->position++;
+		}
+	}
+
+	if (scanner->position<scanner->end && (*scanner->position=='e' || *scanner->position=='E')){
+		scanner->position++;
+		if (scanner->position<scanner->end && (*scanner->position=='+' || *scanner->position=='-')){
+			scanner->position++;
+		}
+		if (scanner->position>=scanner->end || !is_digit(*scanner->position)){
+			return false;
+		}
+		while (scanner->position<scanner->end && is_digit(*scanner->position)){
+			scanner->position++;
+		}
+	}
+	return scanner->position>start;
+}
+
+
+/**
+ * Scans any value, the scanner being on its first character (whitespaces already skipped).
+ * @param depth Nesting level of the value, bounded to keep the recursion (and the stack) small
+ * @param token Where to describe the value
+ * @return true if the value is well formed
+ */
+static bool scan_value(json_scanner *scanner, int depth, json_token *token){
+
+	const char *start=scanner->position;
+
+	if (scanner->position>=scanner->end){
+		return false;
+	}
+
+	switch (*scanner->position){
+		case '"':
+			token->type=JSON_TOKEN_STRING;
+			return scan_string(scanner,&token->start,&token->length);
+
+		case '{':
+		case '[': {
+			char closing=(*scanner->position=='{')?'}':']';
+			json_token inner;
+
+			if (depth>=JSON_TOKENIZER_MAX_DEPTH){
+				return false;
+			}
+			token->type=(closing=='}')?JSON_TOKEN_OBJECT:JSON_TOKEN_ARRAY;
+			scanner->position++;
+			skip_whitespaces(scanner);
+
+			if (scanner->position<scanner->end && *scanner->position==closing){
+				scanner->position++;
+				break;
+			}
+			while (true){
+				if (closing=='}'){
+					if (scanner->position>=scanner->end || *scanner->position!='"' ||
+					    !scan_string(scanner,&inner.start,&inner.length)){
+						return false;
+					}
+					skip_whitespaces(scanner);
+					if (scanner->position>=scanner->end || *scanner->position!=':'){
+						return false;
+					}
+					scanner->position++;
+					skip_whitespaces(scanner);
+				}
+				if (!scan_value(scanner,depth+1,&inner)){
+					return false;
+				}
+				skip_whitespaces(scanner);
+				if (scanner->position>=scanner->end){
+					return false;
+				}
+				if (*scanner->position==closing){
+					scanner->position++;
+					break;
+				}
+				if (*scanner->position!=','){
+					return false;
+				}
+				scanner->position++;
+				skip_whitespaces(scanner);
+			}
+			break;
+		}
+
+		case 't':
+		case 'f':
+			token->type=JSON_TOKEN_BOOL;
+			if (!scan_literal(scanner,"true") && !scan_literal(scanner,"false")){
+				return false;
+			}
+			break;
+
+		case 'n':
+			token->type=JSON_TOKEN_NULL;
+			if (!scan_literal(scanner,"null")){
+				return false;
+			}
+			break;
+
+		default:
+			token->type=JSON_TOKEN_NUMBER;
+			if (!scan_number(scanner)){
+				return false;
+			}
+	}
+
+	token->start=start;
+	token->length=scanner->position-start;
+	return true;
+}
+
+
+/**
+ * Checks that the payload is a single, well formed JSON object (surrounding whitespaces allowed).
+ * @param json The payload, not necessarily NUL-terminated
+ * @param length Length of the payload
+ * @return true if the payload is a valid object
+ */
+bool json_tokenizer_is_object(const char *json, uint16_t length){
+
+	json_scanner scanner={json, json+length};
+	json_token token;
+
+	if (json==NULL){
+		return false;
+	}
+	skip_whitespaces(&scanner);
+	if (!scan_value(&scanner,0,&token) || token.type!=JSON_TOKEN_OBJECT){
+		return false;
+	}
+	skip_whitespaces(&scanner);
+	return scanner.position==scanner.end;
+}
+
+
+/**
+ * Looks for a member of the top-level object. The scan stops at the first member with the given key, thus a
+ * malformed payload may still provide the members preceding the error: json_tokenizer_is_object() validates it all.
+ * @param json The payload, not necessarily NUL-terminated
+ * @param length Length of the payload
+ * @param key The key of the member
+ * @param token Where to describe the value of the member
+ * @return true if the member has been found
+ */
+bool json_tokenizer_find(const char *json, uint16_t length, const char *key, json_token *token){
+
+	json_scanner scanner={json, json+length};
+	size_t key_length=strlen(key);
+
+	if (json==NULL){
+		return false;
+	}
+	skip_whitespaces(&scanner);
+	if (scanner.position>=scanner.end || *scanner.position!='{'){
+		return false;
+	}
+	scanner.position++;
+	skip_whitespaces(&scanner);
+
+	while (scanner.position<scanner.end && *scanner.position=='"'){
+		const char *member_key;
+		uint16_t member_key_length;
+
+		if (!scan_string(&scanner,&member_key,&member_key_length)){
+			return false;
+		}
+		skip_whitespaces(&scanner);
+		if (scanner.position>=scanner.end || *scanner.position!=':'){
+			return false;
+		}
+		scanner.position++;
+		skip_whitespaces(&scanner);
+
+		if (!scan_value(&scanner,1,token)){
+			return false;
+		}
+		if (member_key_length==key_length && memcmp(member_key,key,key_length)==0){
+			return true;
+		}
+
+		skip_whitespaces(&scanner);
+		if (scanner.position>=scanner.end || *scanner.position!=','){
+			return false;
+		}
+		scanner.position++;
+		skip_whitespaces(&scanner);
+	}
+	return false;
+}
+
+
+/**
+ * @return true if the member exists and is a boolean, stored in value
+ */
+bool json_tokenizer_get_bool(const char *json, uint16_t length, const char *key, bool *value){
+
+	json_token token;
+
+	if (!json_tokenizer_find(json,length,key,&token) || token.type!=JSON_TOKEN_BOOL){
+		return false;
+	}
+	*value=(token.start[0]=='t');
+	return true;
+}
+
+
+/**
+ * @return true if the member exists and is a number, stored in value
+ */
+bool json_tokenizer_get_number(const char *json, uint16_t length, const char *key, double *value){
+
+	json_token token;
+	char digits[32];
+
+	if (!json_tokenizer_find(json,length,key,&token) || token.type!=JSON_TOKEN_NUMBER || token.length>=sizeof(digits)){
+		return false;
+	}
+	// strtod needs a terminated string: the number is copied out of the payload
+	memcpy(digits,token.start,token.length);
+	digits[token.length]='\0';
+	*value=strtod(digits,NULL);
+	return true;
+}
+
+
+/**
+ * @return true if the member exists and is a number, stored in value truncated and saturated as cJSON does for valueint
+ */
+bool json_tokenizer_get_int(const char *json, uint16_t length, const char *key, int *value){
+
+	double number;
+
+	if (!json_tokenizer_get_number(json,length,key,&number)){
+		return false;
+	}
+	if (number>=INT_MAX){
+		*value=INT_MAX;
+	}
+	else if (number<=(double)INT_MIN){
+		*value=INT_MIN;
+	}
+	else {
+		*value=(int)number;
+	}
+	return true;
+}
+
+
+/**
+ * @return true if the member exists and is a string; value points to its content inside the payload (not terminated, escapes not decoded)
+ */
+bool json_tokenizer_get_string(const char *json, uint16_t length, const char *key, const char **value, uint16_t *value_length){
+
+	json_token token;
+
+	if (!json_tokenizer_find(json,length,key,&token) || token.type!=JSON_TOKEN_STRING){
+		return false;
+	}
+	*value=token.start;
+	*value_length=token.length;
+	return true;
+}
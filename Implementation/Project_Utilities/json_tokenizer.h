@@ -0,0 +1,29 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#define JSON_TOKENIZER_MAX_DEPTH 8
+
+typedef enum {
+	JSON_TOKEN_NULL,
+	JSON_TOKEN_BOOL,
+	JSON_TOKEN_NUMBER,
+	JSON_TOKEN_STRING,
+	JSON_TOKEN_OBJECT,
+	JSON_TOKEN_ARRAY
+} json_token_type;
+
+// Value of a member of the top-level object, as a slice of the payload: nothing is copied nor decoded.
+// For the strings the slice excludes the quotes and the escape sequences are left as they are.
+typedef struct {
+	json_token_type type;
+	const char *start;
+	uint16_t length;
+} json_token;
+
+
+bool json_tokenizer_is_object(const char *json, uint16_t length);
+bool json_tokenizer_find(const char *json, uint16_t length, const char *key, json_token *token);
+bool json_tokenizer_get_bool(const char *json, uint16_t length, const char *key, bool *value);
+bool json_tokenizer_get_number(const char *json, uint16_t length, const char *key, double *value);
+bool json_tokenizer_get_int(const char *json, uint16_t length, const char *key, int *value);
+bool json_tokenizer_get_string(const char *json, uint16_t length, const char *key, const char **value, uint16_t *value_length);
@@ -1,48 +1,208 @@
 #include "math.h"
+#include <stddef.h>
 #include "random.h"
+#include "os/net/linkaddr.h"
+
+#include "math_utilities.h"
+
+/*
+ * The measurements of the sensors are simulated with a xoshiro128** generator instead of random_rand(): one 32-bit
+ * draw gives a whole value (no second call for the sign, no float division) and the sequence depends only on the
+ * seed, so a simulation run can be repeated bit for bit. random_value_generation() and
+ * random_value_generation_gradual_variation() keep their signature and use the generator selected with
+ * math_utilities_use_prng() (one per sensor; the virtual fleet switches it for every node).
+ */
+
+#define UNIFORM_SCALE (1.0f/16777216.0f) // 2^-24: the 24 bits of a float mantissa
+
+
+static math_prng default_prng = {{0x9E3779B9, 0x243F6A88, 0xB7E15162, 0x6A09E667}};
+static math_prng *current_prng = &default_prng;
+
+
+static uint32_t rotate_left(uint32_t x, int k){
+	return (x<<k)|(x>>(32-k));
+}
+
+
+/**
+ * Seeds a generator: the four words of the state are spread from the seed (splitmix32), so that close seeds give
+ * unrelated sequences.
+ * @param prng The generator
+ * @param seed The seed, any value
+ */
+void math_prng_seed(math_prng *prng, uint32_t seed){
+
+	for (int i=0; i<4; i++){
+		uint32_t z=(seed+=0x9E3779B9);
+
+		z=(z^(z>>16))*0x85EBCA6B;
+		z=(z^(z>>13))*0xC2B2AE35;
+		prng->s[i]=z^(z>>16);
+	}
+	// The all-zero state would stay zero forever
+	if ((prng->s[0]|prng->s[1]|prng->s[2]|prng->s[3])==0){
+		prng->s[0]=1;
+	}
+}
+
+
+/**
+ * @param prng The generator
+ * @return The next 32-bit number of the sequence
+ */
+uint32_t math_prng_next(math_prng *prng){
+
+	uint32_t *s=prng->s;
+	const uint32_t result=rotate_left(s[1]*5, 7)*9;
+	const uint32_t t=s[1]<<9;
+
+	s[2]^=s[0];
+	s[3]^=s[1];
+	s[1]^=s[2];
+	s[0]^=s[3];
+	s[2]^=t;
+	s[3]=rotate_left(s[3], 11);
+	return result;
+}
+
+
+/**
+ * @param prng The generator
+ * @return A number uniformly distributed in [0, 1)
+ */
+float math_prng_uniform(math_prng *prng){
+	return (float)(math_prng_next(prng)>>8)*UNIFORM_SCALE;
+}
+
+
+/**
+ * Fills an array with numbers uniformly distributed in [0, 1), for the code drawing many numbers at a time.
+ * @param prng The generator
+ * @param values The array to be filled
+ * @param count The number of values
+ */
+void math_prng_fill_uniform(math_prng *prng, float *values, int count){
+
+	uint32_t s0=prng->s[0], s1=prng->s[1], s2=prng->s[2], s3=prng->s[3];
+
+	// The state stays in registers for the whole batch
+	for (int i=0; i<count; i++){
+		const uint32_t result=rotate_left(s1*5, 7)*9;
+		const uint32_t t=s1<<9;
+
+		s2^=s0;
+		s3^=s1;
+		s1^=s2;
+		s0^=s3;
+		s2^=t;
+		s3=rotate_left(s3, 11);
+		values[i]=(float)(result>>8)*UNIFORM_SCALE;
+	}
+	prng->s[0]=s0;
+	prng->s[1]=s1;
+	prng->s[2]=s2;
+	prng->s[3]=s3;
+}
+
 
 /**
  * Given an interval it generates a random number between min and max value.
+ * @param prng The generator
  * @param min The minimun range in the interval.
  * @param max The maximum range in the interval.
  * @return A random number between min-max.
 */
-float random_value_generation (float min, float max){	
-	return min+(max-min)* ((float) random_rand() / RANDOM_RAND_MAX);
+float math_prng_value(math_prng *prng, float min, float max){
+	return min+(max-min)*math_prng_uniform(prng);
 }
 
+
 /**
- * Given an interval, a maximum possibile variation and a number it generates a random number in the given interval that has a maxium variation respect to the original number. 
+ * Given an interval, a maximum possibile variation and a number it generates a random number in the given interval that has a maxium variation respect to the original number.
+ * A single draw gives both the direction (top bit) and the size (low 24 bits) of the variation.
+ * @param prng The generator
  * @param min The minimun range in the interval.
  * @param max The maximum range in the interval.
  * @param max_var The maxium variation tollerated for the old_value passed.
  * @param original_number The maximum range in the interval.
  * @return A random number obtained by the original number plus/minus a max random variation respecting the range (min-max)
 */
-float random_value_generation_gradual_variation(float min, float max,float max_var,float original_number){
-	
-	int choice=random_rand() % 2;
-	float variation=max_var*((float) random_rand() / RANDOM_RAND_MAX);
-	float newValue=0;
-	
-	// Safty check
-	/*if (original_number>max){
-		original_number=max;
-	}
-	
-	if (original_number<min){
-		original_number=min;
-	}*/
-	
-	choice=(choice==0)?1:-1;
-	newValue=original_number+(choice)*variation;
+float math_prng_gradual_variation(math_prng *prng, float min, float max, float max_var, float original_number){
+
+	uint32_t draw=math_prng_next(prng);
+	float variation=max_var*((float)(draw&0xFFFFFF)*UNIFORM_SCALE);
+	float newValue;
+
+	newValue=(draw>>31) ? original_number-variation : original_number+variation;
 	newValue=(newValue>max)?original_number-variation:newValue;
 	newValue=(newValue<min)?original_number+variation:newValue;
-	
+
 	return newValue;
 }
 
 
+/**
+ * Seeds the generator in use.
+ * @param seed The seed
+ */
+void math_utilities_seed(uint32_t seed){
+	math_prng_seed(current_prng, seed);
+}
+
+
+/**
+ * Seeds the generator in use at the boot of a sensor. With SIMULATION_SEED (make SIMULATION_SEED=n) every run repeats
+ * the same measurements, and the node address is mixed in so that the sensors do not all repeat the same ones.
+ * Otherwise the seed comes from random_rand(), whose sequence already differs for every mote.
+ */
+void math_utilities_seed_node(void){
+
+#ifdef SIMULATION_SEED
+	uint32_t seed=SIMULATION_SEED;
+
+	for (int i=0; i<LINKADDR_SIZE; i++){
+		seed=seed*31+linkaddr_node_addr.u8[i];
+	}
+#else
+	uint32_t seed=((uint32_t)random_rand()<<16)^random_rand();
+#endif
+	math_utilities_seed(seed);
+}
+
+
+/**
+ * Selects the generator used by random_value_generation() and random_value_generation_gradual_variation().
+ * @param prng The generator, NULL for the default one
+ */
+void math_utilities_use_prng(math_prng *prng){
+	current_prng=(prng!=NULL) ? prng : &default_prng;
+}
+
+
+/**
+ * Given an interval it generates a random number between min and max value.
+ * @param min The minimun range in the interval.
+ * @param max The maximum range in the interval.
+ * @return A random number between min-max.
+*/
+float random_value_generation (float min, float max){
+	return math_prng_value(current_prng, min, max);
+}
+
+/**
+ * Given an interval, a maximum possibile variation and a number it generates a random number in the given interval that has a maxium variation respect to the original number. 
+ * @param min The minimun range in the interval.
+ * @param max The maximum range in the interval.
+ * @param max_var The maxium variation tollerated for the old_value passed.
+ * @param original_number The maximum range in the interval.
+ * @return A random number obtained by the original number plus/minus a max random variation respecting the range (min-max)
+*/
+float random_value_generation_gradual_variation(float min, float max,float max_var,float original_number){
+	return math_prng_gradual_variation(current_prng, min, max, max_var, original_number);
+}
+
+
 /**
  * Given an array of number returns the index corresponding to the maximum value.
  * @param arr The array of numbers to find an index
@@ -1,5 +1,26 @@
+#ifndef MATH_UTILITIES_H
+#define MATH_UTILITIES_H
+
+#include <stdint.h>
+
+// Generator of the simulated measurements (xoshiro128**): the sequence depends only on the seed, not on the mote
+typedef struct {
+	uint32_t s[4];
+} math_prng;
+
+void math_prng_seed(math_prng *prng, uint32_t seed);
+uint32_t math_prng_next(math_prng *prng);
+float math_prng_uniform(math_prng *prng);
+void math_prng_fill_uniform(math_prng *prng, float *values, int count);
+float math_prng_value(math_prng *prng, float min, float max);
+float math_prng_gradual_variation(math_prng *prng, float min, float max, float max_var, float original_number);
+
+void math_utilities_seed(uint32_t seed);
+void math_utilities_seed_node(void);
+void math_utilities_use_prng(math_prng *prng);
+
 float random_value_generation(float min, float max);
 float random_value_generation_gradual_variation(float min, float max,float max_var,float old_value);
 int find_max_index(float *arr, int n);
 
-
+#endif
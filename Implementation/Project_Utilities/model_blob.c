@@ -0,0 +1,273 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "crc32.h"
+#include "model_blob.h"
+
+/*
+ * Streaming parser of the model blobs: the blob is read in small pieces through a callback (CFS on the sensor, a
+ * file on the host), so it never needs to be in RAM as a whole. The same code verifies the blob (no memory
+ * written, only the checksum and the consistency of the layers) and loads it into a caller-provided arena where
+ * the quantized_net, its layers, weights and scratch buffers are laid out.
+ */
+
+#define CHUNK_SIZE 64 // Bytes read at a time while skipping weights during the verification
+
+// State of a parse: where the bytes come from, the running checksum and the arena being filled (NULL to verify)
+typedef struct {
+	model_blob_read_fn read;
+	void *ctx;
+	uint32_t remaining;
+	uint32_t crc;
+	uint8_t *arena;
+	size_t arena_size;
+	size_t used;
+} blob_parser;
+
+
+static uint16_t read_le16(const uint8_t *bytes){
+	return (uint16_t)(bytes[0]|(bytes[1]<<8));
+}
+
+
+static uint32_t read_le32(const uint8_t *bytes){
+	return (uint32_t)bytes[0]|((uint32_t)bytes[1]<<8)|((uint32_t)bytes[2]<<16)|((uint32_t)bytes[3]<<24);
+}
+
+
+/**
+ * Decodes the header of a blob.
+ * @param bytes The first MODEL_BLOB_HEADER_SIZE bytes of the blob
+ * @param header Filled with the fields of the header
+ * @return MODEL_BLOB_OK or MODEL_BLOB_ERR_FORMAT
+ */
+int model_blob_parse_header(const uint8_t *bytes, model_blob_header *header){
+
+	if (read_le32(bytes)!=MODEL_BLOB_MAGIC || read_le16(bytes+4)!=MODEL_BLOB_FORMAT_VERSION){
+		return MODEL_BLOB_ERR_FORMAT;
+	}
+	header->model_version=read_le32(bytes+8);
+	header->body_length=read_le32(bytes+12);
+	header->body_crc=read_le32(bytes+16);
+	return MODEL_BLOB_OK;
+}
+
+
+/**
+ * Reads exactly length bytes of the body, updating the checksum.
+ * @return MODEL_BLOB_OK or MODEL_BLOB_ERR_READ
+ */
+static int parser_read(blob_parser *parser, void *buffer, uint32_t length){
+
+	if (length>parser->remaining || parser->read(parser->ctx,buffer,length)!=(int)length){
+		return MODEL_BLOB_ERR_READ;
+	}
+	parser->remaining-=length;
+	parser->crc=crc32_update(parser->crc,buffer,length);
+	return MODEL_BLOB_OK;
+}
+
+
+/**
+ * Reserves an aligned area of the arena. While verifying (no arena) only the required size is accounted.
+ * @return The area, NULL while verifying or if the arena is full (parser->used then exceeds parser->arena_size)
+ */
+static void *parser_alloc(blob_parser *parser, size_t size, size_t alignment){
+
+	size_t start=(parser->used+alignment-1)&~(alignment-1);
+
+	parser->used=start+size;
+	if (parser->arena==NULL || parser->used>parser->arena_size){
+		return NULL;
+	}
+	return parser->arena+start;
+}
+
+
+/**
+ * Reads an array of the body into the arena, or only through the checksum while verifying.
+ * @return MODEL_BLOB_OK, MODEL_BLOB_ERR_READ or MODEL_BLOB_ERR_SIZE
+ */
+static int parser_read_array(blob_parser *parser, void **destination, uint32_t length, size_t alignment){
+
+	uint8_t chunk[CHUNK_SIZE];
+	uint8_t *area=parser_alloc(parser,length,alignment);
+	int ret;
+
+	*destination=area;
+	if (area!=NULL){
+		return parser_read(parser,area,length);
+	}
+	if (parser->arena!=NULL){
+		return MODEL_BLOB_ERR_SIZE;
+	}
+
+	while (length>0){
+		uint32_t piece=(length<CHUNK_SIZE)?length:CHUNK_SIZE;
+
+		if ((ret=parser_read(parser,chunk,piece))!=MODEL_BLOB_OK){
+			return ret;
+		}
+		length-=piece;
+	}
+	return MODEL_BLOB_OK;
+}
+
+
+/**
+ * Parses the whole blob: header, layers and checksum.
+ * @param parser The parser, with or without an arena
+ * @param net Filled with the loaded network (only with an arena)
+ * @param header Filled with the header of the blob
+ * @return One of the MODEL_BLOB_* codes
+ */
+static int parse_blob(blob_parser *parser, const quantized_net **net, model_blob_header *header){
+
+	uint8_t bytes[MODEL_BLOB_HEADER_SIZE];
+	quantized_net *parsed;
+	quantized_net_layer *layers;
+	void *array;
+	int8_t *buf1, *buf2;
+	int32_t *logits;
+	uint16_t n_features, n_layers;
+	int16_t n_inputs, buf_length=0;
+	int ret;
+
+	if (parser->read(parser->ctx,bytes,MODEL_BLOB_HEADER_SIZE)!=MODEL_BLOB_HEADER_SIZE){
+		return MODEL_BLOB_ERR_READ;
+	}
+	if ((ret=model_blob_parse_header(bytes,header))!=MODEL_BLOB_OK){
+		return ret;
+	}
+	parser->remaining=header->body_length;
+	parser->crc=0;
+
+	if ((ret=parser_read(parser,bytes,4))!=MODEL_BLOB_OK){
+		return ret;
+	}
+	n_features=read_le16(bytes);
+	n_layers=read_le16(bytes+2);
+	if (n_features==0 || n_features>QUANTIZED_NET_MAX_FEATURES || n_layers<2 || n_layers>MODEL_BLOB_MAX_LAYERS){
+		return MODEL_BLOB_ERR_FORMAT;
+	}
+
+	parsed=parser_alloc(parser,sizeof(quantized_net),sizeof(void *));
+	layers=parser_alloc(parser,n_layers*sizeof(quantized_net_layer),sizeof(void *));
+	if ((ret=parser_read_array(parser,&array,n_features*sizeof(float),sizeof(float)))!=MODEL_BLOB_OK){
+		return ret;
+	}
+	if (parsed!=NULL){
+		parsed->n_features=n_features;
+		parsed->input_scales=array;
+		parsed->n_layers=n_layers;
+		parsed->layers=layers;
+	}
+
+	n_inputs=n_features;
+	for (int l=0; l<n_layers; l++){
+		quantized_net_layer layer;
+		uint8_t weight_bytes;
+		bool last=(l==n_layers-1);
+
+		if ((ret=parser_read(parser,bytes,12))!=MODEL_BLOB_OK){
+			return ret;
+		}
+		memset(&layer,0,sizeof(layer));
+		layer.n_outputs=(int16_t)read_le16(bytes);
+		layer.n_inputs=(int16_t)read_le16(bytes+2);
+		layer.activation=(quantized_net_activation)bytes[4];
+		weight_bytes=bytes[5];
+		layer.shift=(int8_t)bytes[6];
+		layer.multiplier=(int32_t)read_le32(bytes+8);
+
+		// The kernels of quantized_net expect a 16-bit input layer, 8-bit hidden layers and a softmax at the end
+		if (layer.n_inputs!=n_inputs || layer.n_outputs<=0 || layer.shift<1 || layer.shift>62
+			|| weight_bytes!=((l==0)?2:1)
+			|| layer.activation!=(last?QUANTIZED_NET_ACTIVATION_SOFTMAX:QUANTIZED_NET_ACTIVATION_TANH)
+			|| (last && layer.n_outputs>QUANTIZED_NET_MAX_CLASSES)){
+			return MODEL_BLOB_ERR_FORMAT;
+		}
+
+		if ((ret=parser_read_array(parser,&array,(uint32_t)layer.n_outputs*layer.n_inputs*weight_bytes,weight_bytes))!=MODEL_BLOB_OK){
+			return ret;
+		}
+		if (l==0){
+			layer.wide_weights=array;
+		}
+		else {
+			layer.weights=array;
+		}
+		if ((ret=parser_read_array(parser,&array,layer.n_outputs*sizeof(int32_t),sizeof(int32_t)))!=MODEL_BLOB_OK){
+			return ret;
+		}
+		layer.biases=array;
+
+		if (layers!=NULL){
+			layers[l]=layer;
+		}
+		if (!last && layer.n_outputs>buf_length){
+			buf_length=layer.n_outputs;
+		}
+		n_inputs=layer.n_outputs;
+	}
+
+	if (parser->remaining!=0){
+		return MODEL_BLOB_ERR_FORMAT;
+	}
+	if (parser->crc!=header->body_crc){
+		return MODEL_BLOB_ERR_CRC;
+	}
+
+	// Scratch buffers of the inference
+	buf1=parser_alloc(parser,buf_length,1);
+	buf2=parser_alloc(parser,buf_length,1);
+	logits=parser_alloc(parser,n_inputs*sizeof(int32_t),sizeof(int32_t));
+	if (parser->arena!=NULL){
+		if (parser->used>parser->arena_size){
+			return MODEL_BLOB_ERR_SIZE;
+		}
+		parsed->buf1=buf1;
+		parsed->buf2=buf2;
+		parsed->logits=logits;
+		parsed->buf_length=buf_length;
+		*net=parsed;
+	}
+	return MODEL_BLOB_OK;
+}
+
+
+/**
+ * Checks a blob without loading it: header, consistency of the layers and checksum.
+ * @param read The function reading the blob from the beginning
+ * @param ctx The context of the read function
+ * @param header Filled with the header of the blob
+ * @param arena_size Filled with the size of the arena required by model_blob_load()
+ * @return One of the MODEL_BLOB_* codes
+ */
+int model_blob_verify(model_blob_read_fn read, void *ctx, model_blob_header *header, size_t *arena_size){
+
+	blob_parser parser={read, ctx, 0, 0, NULL, 0, 0};
+	int ret=parse_blob(&parser,NULL,header);
+
+	*arena_size=parser.used;
+	return ret;
+}
+
+
+/**
+ * Loads a blob into an arena. The arena is overwritten even when the load fails, so a network previously loaded
+ * in the same arena must not be used anymore unless MODEL_BLOB_OK is returned: verify the blob first.
+ * @param read The function reading the blob from the beginning
+ * @param ctx The context of the read function
+ * @param arena The memory where the network is built, aligned as a pointer
+ * @param arena_size The size of the arena
+ * @param net Filled with the network, valid as long as the arena is not modified
+ * @param header Filled with the header of the blob
+ * @return One of the MODEL_BLOB_* codes
+ */
+int model_blob_load(model_blob_read_fn read, void *ctx, void *arena, size_t arena_size, const quantized_net **net, model_blob_header *header){
+
+	blob_parser parser={read, ctx, 0, 0, arena, arena_size, 0};
+
+	return parse_blob(&parser,net,header);
+}
@@ -0,0 +1,44 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "quantized_net.h"
+
+/*
+ * Binary format of an int8 fault detection model (quantized_net) sent over the air. All fields are little-endian.
+ *
+ * Header (MODEL_BLOB_HEADER_SIZE bytes):
+ *   uint32 magic (MODEL_BLOB_MAGIC), uint16 format version, uint16 reserved (0),
+ *   uint32 model version, uint32 body length, uint32 CRC-32 of the body
+ * Body:
+ *   uint16 n_features, uint16 n_layers, float32 input_scales[n_features]
+ *   for each layer:
+ *     int16 n_outputs, int16 n_inputs, uint8 activation, uint8 bytes per weight (2 for the input layer, 1 otherwise),
+ *     int8 shift, uint8 reserved (0), int32 multiplier,
+ *     weights[n_outputs*n_inputs] (row-major per output neuron), int32 biases[n_outputs]
+ */
+
+#define MODEL_BLOB_MAGIC 0x4D465453 // "STFM"
+#define MODEL_BLOB_FORMAT_VERSION 1
+#define MODEL_BLOB_HEADER_SIZE 20
+#define MODEL_BLOB_MAX_LAYERS 8
+
+// Return codes
+#define MODEL_BLOB_OK 0
+#define MODEL_BLOB_ERR_READ -1   // The blob is shorter than declared
+#define MODEL_BLOB_ERR_FORMAT -2 // Wrong magic/version or inconsistent layers
+#define MODEL_BLOB_ERR_CRC -3    // The body does not match its checksum
+#define MODEL_BLOB_ERR_SIZE -4   // The model does not fit in the memory given to the loader
+
+// Reads up to length bytes of the blob in buffer, returns the number of bytes read (like cfs_read/fread).
+typedef int (*model_blob_read_fn)(void *ctx, void *buffer, int length);
+
+typedef struct {
+	uint32_t model_version;
+	uint32_t body_length;
+	uint32_t body_crc;
+} model_blob_header;
+
+
+int model_blob_parse_header(const uint8_t *bytes, model_blob_header *header);
+int model_blob_verify(model_blob_read_fn read, void *ctx, model_blob_header *header, size_t *arena_size);
+int model_blob_load(model_blob_read_fn read, void *ctx, void *arena, size_t arena_size, const quantized_net **net, model_blob_header *header);
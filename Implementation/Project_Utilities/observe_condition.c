@@ -0,0 +1,186 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "observe_condition.h"
+
+/*
+ * Conditional notifications of an observer (CoRE dynlink, conditional attributes), evaluated at each sample:
+ * - pmin: no notification before pmin seconds from the previous one, whatever happens;
+ * - pmax: a notification at least every pmax seconds, even if nothing changed;
+ * - st: a change of at least st from the last value notified;
+ * - gt/lt: the value is on the other side of the threshold with respect to the last value notified.
+ * Without st, gt and lt every sample is a change. All the comparisons are made with the last value notified to the
+ * observer, so that slow drifts are reported too.
+ */
+
+#define OBSERVE_CONDITION_MAX_NUMBER_LEN 16
+
+
+/**
+ * Reads the value of an attribute, a slice of the query that is not terminated.
+ */
+static bool parse_number(const char *value, int length, double *number){
+
+	char digits[OBSERVE_CONDITION_MAX_NUMBER_LEN];
+	char *end;
+
+	if (length<=0 || length>=OBSERVE_CONDITION_MAX_NUMBER_LEN){
+		return false;
+	}
+	memcpy(digits,value,length);
+	digits[length]='\0';
+	*number=strtod(digits,&end);
+	return end==digits+length;
+}
+
+
+/**
+ * Reads the attributes from the query of the observe registration (e.g. "pmin=10&pmax=60&st=500"). The other
+ * parameters of the query are ignored.
+ * @param condition Filled with the attributes found, the others are absent
+ * @param query The query, not terminated (NULL if there is none)
+ * @param length Length of the query
+ * @return The number of attributes found, -1 if one of them is not valid
+ */
+int observe_condition_parse(observe_condition *condition, const char *query, int length){
+
+	int nr_attributes=0;
+	memset(condition,0,sizeof(*condition));
+
+	while (length>0){
+		const char *separator=memchr(query,'&',length);
+		int parameter_length=separator!=NULL ? separator-query : length;
+		const char *equal=memchr(query,'=',parameter_length);
+
+		if (equal!=NULL){
+			int key_length=equal-query;
+			const char *value=equal+1;
+			int value_length=parameter_length-key_length-1;
+			uint8_t attribute=0;
+			double number;
+
+			if (key_length==4 && strncmp(query,"pmin",4)==0){
+				attribute=OBSERVE_CONDITION_PMIN;
+			}
+			else if (key_length==4 && strncmp(query,"pmax",4)==0){
+				attribute=OBSERVE_CONDITION_PMAX;
+			}
+			else if (key_length==2 && strncmp(query,"st",2)==0){
+				attribute=OBSERVE_CONDITION_STEP;
+			}
+			else if (key_length==2 && strncmp(query,"gt",2)==0){
+				attribute=OBSERVE_CONDITION_GT;
+			}
+			else if (key_length==2 && strncmp(query,"lt",2)==0){
+				attribute=OBSERVE_CONDITION_LT;
+			}
+
+			if (attribute!=0){
+				if (!parse_number(value,value_length,&number)){
+					return -1;
+				}
+				switch (attribute){
+				case OBSERVE_CONDITION_PMIN:
+				case OBSERVE_CONDITION_PMAX:
+					if (number<0 || number>UINT32_MAX){
+						return -1;
+					}
+					if (attribute==OBSERVE_CONDITION_PMIN){
+						condition->pmin=(uint32_t)number;
+					}
+					else {
+						condition->pmax=(uint32_t)number;
+					}
+					break;
+				case OBSERVE_CONDITION_STEP:
+					if (number<=0){
+						return -1;
+					}
+					condition->step=(float)number;
+					break;
+				case OBSERVE_CONDITION_GT:
+					condition->greater_than=(float)number;
+					break;
+				default:
+					condition->less_than=(float)number;
+					break;
+				}
+				condition->attributes|=attribute;
+				nr_attributes++;
+			}
+		}
+
+		if (separator==NULL){
+			break;
+		}
+		length-=parameter_length+1;
+		query=separator+1;
+	}
+
+	// The dynlink draft requires pmax to be greater than pmin
+	if ((condition->attributes&OBSERVE_CONDITION_PMIN) && (condition->attributes&OBSERVE_CONDITION_PMAX) &&
+		condition->pmax<=condition->pmin){
+		return -1;
+	}
+	return nr_attributes;
+}
+
+
+/**
+ * Sets the value and the time of the registration, that is the first notification.
+ * @param condition The condition
+ * @param value The value sent in the answer to the registration
+ * @param now The current time (seconds)
+ */
+void observe_condition_start(observe_condition *condition, float value, uint32_t now){
+	condition->last_value=value;
+	condition->last_time=now;
+}
+
+
+/**
+ * Evaluates the condition for a new sample. When it fires the value is taken as the last one notified.
+ * @param condition The condition
+ * @param value The sample
+ * @param now The current time (seconds)
+ * @param forced true if the observer must be notified as soon as pmin allows it
+ * @return true if the observer has to be notified
+ */
+bool observe_condition_fires(observe_condition *condition, float value, uint32_t now, bool forced){
+
+	uint32_t elapsed=now-condition->last_time;
+	bool fires;
+
+	if ((condition->attributes&OBSERVE_CONDITION_PMIN) && elapsed<condition->pmin){
+		return false;
+	}
+
+	if (!(condition->attributes&(OBSERVE_CONDITION_STEP|OBSERVE_CONDITION_GT|OBSERVE_CONDITION_LT))){
+		fires=true;
+	}
+	else {
+		fires=forced;
+		if ((condition->attributes&OBSERVE_CONDITION_STEP) && (value-condition->last_value>=condition->step ||
+			condition->last_value-value>=condition->step)){
+			fires=true;
+		}
+		if ((condition->attributes&OBSERVE_CONDITION_GT) &&
+			((value>condition->greater_than)!=(condition->last_value>condition->greater_than))){
+			fires=true;
+		}
+		if ((condition->attributes&OBSERVE_CONDITION_LT) &&
+			((value<condition->less_than)!=(condition->last_value<condition->less_than))){
+			fires=true;
+		}
+	}
+
+	if ((condition->attributes&OBSERVE_CONDITION_PMAX) && elapsed>=condition->pmax){
+		fires=true;
+	}
+
+	if (fires){
+		condition->last_value=value;
+		condition->last_time=now;
+	}
+	return fires;
+}
@@ -0,0 +1,26 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+// Attributes given by an observer in the query of its registration
+#define OBSERVE_CONDITION_PMIN 0x01
+#define OBSERVE_CONDITION_PMAX 0x02
+#define OBSERVE_CONDITION_STEP 0x04
+#define OBSERVE_CONDITION_GT   0x08
+#define OBSERVE_CONDITION_LT   0x10
+
+// Conditional attributes of an observer (pmin/pmax/st/gt/lt), with the last value and time notified to it.
+typedef struct {
+	uint8_t attributes;     // OBSERVE_CONDITION_* flags of the attributes present
+	uint32_t pmin;          // Seconds
+	uint32_t pmax;          // Seconds
+	float step;
+	float greater_than;
+	float less_than;
+	float last_value;
+	uint32_t last_time;     // Seconds
+} observe_condition;
+
+
+int observe_condition_parse(observe_condition *condition, const char *query, int length);
+void observe_condition_start(observe_condition *condition, float value, uint32_t now);
+bool observe_condition_fires(observe_condition *condition, float value, uint32_t now, bool forced);
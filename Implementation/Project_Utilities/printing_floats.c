@@ -126,6 +126,36 @@ void print_smart_transformer_sensing_measurement(float Ia,float Ib,float Ic, flo
 
 
 
+/**
+ * This function standardize how the statistics of the sliding window of the smart transformer should be logged.
+ * @param nr_samples is the number of samples currently in the window
+ * @param zero_sequence is the mean of Ia+Ib+Ic over the window (close to zero for a balanced transformer)
+ * @param std_Ia is the standard deviation of the current on phase A over the window
+ * @param std_Ib is the standard deviation of the current on phase B over the window
+ * @param std_Ic is the standard deviation of the current on phase C over the window
+*/
+void print_smart_transformer_window_statistics(int nr_samples, float zero_sequence, float std_Ia, float std_Ib, float std_Ic){
+
+	#ifdef COOJA
+            LOG_DBG("Window: %d samples -- Ia+Ib+Ic: %.2fMA -- Std Ia: %.2fMA -- Std Ib: %.2fMA -- Std Ic: %.2fMA\n", nr_samples,zero_sequence,std_Ia,std_Ib,std_Ic);
+        #else
+
+	    char string_zero_sequence[10];
+	    char string_std_Ia[10];
+	    char string_std_Ib[10];
+	    char string_std_Ic[10];
+
+	    floatToString(zero_sequence,string_zero_sequence,2);
+	    floatToString(std_Ia,string_std_Ia,2);
+	    floatToString(std_Ib,string_std_Ib,2);
+	    floatToString(std_Ic,string_std_Ic,2);
+
+	    LOG_DBG("Window: %d samples -- Ia+Ib+Ic: %sMA -- Std Ia: %sMA -- Std Ib: %sMA -- Std Ic: %sMA\n", nr_samples,string_zero_sequence,string_std_Ia,string_std_Ib,string_std_Ic);
+        #endif
+}
+
+
+
 
 /**
  * Standard way to print the probabilities for ML task. It's know a-priori that the number of classes are 5.
@@ -0,0 +1,266 @@
+#include "quantized_net.h"
+
+/*
+ * Int8 inference kernels for the fully connected networks exported by emlearn.
+ * Weights are int8 with one scale per layer, the products are accumulated in int32 and the
+ * activations (tanh and softmax) are evaluated in fixed-point through small look-up tables,
+ * so that no floating point operation is required apart from the quantization of the inputs.
+ * The input layer is the only exception: currents (hundreds of A) and voltages (tenths of V) share
+ * the same neurons, so measurements and weights of that layer are kept on 16 bits (384 MAC in int64).
+ */
+
+// Domain of the tanh table: [-4,4] in Q12 with a step of 1/16 (outside the domain tanh is saturated).
+#define TANH_TABLE_MIN (-(4 << QUANTIZED_NET_PREACT_FRAC_BITS))
+#define TANH_TABLE_MAX (4 << QUANTIZED_NET_PREACT_FRAC_BITS)
+
+// Domain of the exp table: [-8,0] in Q12 with a step of 1/16 (below -8 the contribution is negligible).
+#define EXP_TABLE_MIN (-(8 << QUANTIZED_NET_PREACT_FRAC_BITS))
+
+#define TABLE_STEP_BITS 8 // 1/16 in Q12
+
+// tanh(-4+i/16) in Q15. Max error after linear interpolation ~4e-4.
+static const int16_t tanh_table[129] = {
+	-32745, -32742, -32739, -32735, -32731, -32726, -32720, -32714, -32707, -32699, -32690, -32680,
+	-32669, -32656, -32641, -32624, -32605, -32583, -32559, -32531, -32500, -32465, -32425, -32380,
+	-32328, -32270, -32205, -32131, -32047, -31952, -31845, -31725, -31588, -31435, -31261, -31066,
+	-30846, -30599, -30321, -30009, -29659, -29267, -28829, -28340, -27796, -27190, -26518, -25775,
+	-24955, -24053, -23065, -21986, -20812, -19541, -18173, -16706, -15142, -13486, -11742, -9919,
+	-8025, -6073, -4075, -2045, 0, 2045, 4075, 6073, 8025, 9919, 11742, 13486,
+	15142, 16706, 18173, 19541, 20812, 21986, 23065, 24053, 24955, 25775, 26518, 27190,
+	27796, 28340, 28829, 29267, 29659, 30009, 30321, 30599, 30846, 31066, 31261, 31435,
+	31588, 31725, 31845, 31952, 32047, 32131, 32205, 32270, 32328, 32380, 32425, 32465,
+	32500, 32531, 32559, 32583, 32605, 32624, 32641, 32656, 32669, 32680, 32690, 32699,
+	32707, 32714, 32720, 32726, 32731, 32735, 32739, 32742, 32745
+};
+
+// exp(-i/16) in Q15. Max relative error after linear interpolation ~2e-3.
+static const uint16_t exp_table[129] = {
+	32768, 30783, 28918, 27166, 25520, 23974, 22521, 21157, 19875, 18671, 17539, 16477,
+	15479, 14541, 13660, 12832, 12055, 11324, 10638, 9994, 9388, 8819, 8285, 7783,
+	7312, 6869, 6452, 6061, 5694, 5349, 5025, 4721, 4435, 4166, 3914, 3676,
+	3454, 3244, 3048, 2863, 2690, 2527, 2374, 2230, 2095, 1968, 1849, 1737,
+	1631, 1533, 1440, 1352, 1271, 1194, 1121, 1053, 990, 930, 873, 820,
+	771, 724, 680, 639, 600, 564, 530, 498, 467, 439, 412, 387,
+	364, 342, 321, 302, 283, 266, 250, 235, 221, 207, 195, 183,
+	172, 162, 152, 143, 134, 126, 118, 111, 104, 98, 92, 86,
+	81, 76, 72, 67, 63, 59, 56, 52, 49, 46, 43, 41,
+	38, 36, 34, 32, 30, 28, 26, 25, 23, 22, 21, 19,
+	18, 17, 16, 15, 14, 13, 12, 12, 11
+};
+
+
+/**
+ * Fixed-point hyperbolic tangent.
+ * @param x The input value in Q12.
+ * @return tanh(x) in Q7, ready to be used as input of the next int8 layer.
+ */
+static int8_t tanh_q12_to_q7(int32_t x){
+
+	int32_t index, frac, y;
+
+	if (x<=TANH_TABLE_MIN){
+		return -127;
+	}
+	if (x>=TANH_TABLE_MAX){
+		return 127;
+	}
+	x-=TANH_TABLE_MIN;
+	index=x>>TABLE_STEP_BITS;
+	frac=x&((1<<TABLE_STEP_BITS)-1);
+
+	y=tanh_table[index]+(((tanh_table[index+1]-tanh_table[index])*frac)>>TABLE_STEP_BITS);
+
+	// From Q15 to Q7 with rounding
+	y=(y+128)>>8;
+	return (int8_t)((y>127)?127:((y<-127)?-127:y));
+}
+
+
+/**
+ * Fixed-point exponential restricted to non-positive arguments.
+ * @param x The input value in Q12 (x<=0).
+ * @return exp(x) in Q15.
+ */
+static uint32_t exp_q12_to_q15(int32_t x){
+
+	int32_t index, frac;
+
+	if (x<=EXP_TABLE_MIN){
+		return 0;
+	}
+	x=-x;
+	index=x>>TABLE_STEP_BITS;
+	frac=x&((1<<TABLE_STEP_BITS)-1);
+
+	return exp_table[index]-(((exp_table[index]-exp_table[index+1])*frac)>>TABLE_STEP_BITS);
+}
+
+
+/**
+ * Re-quantizes an accumulator into the Q12 pre-activation of a neuron.
+ * @param layer The layer containing the neuron
+ * @param acc The accumulator (bias included)
+ * @return The pre-activation value in Q12, saturated on 32 bits
+ */
+static int32_t requantize(const quantized_net_layer *layer, int64_t acc){
+
+	int64_t scaled=(acc*layer->multiplier+((int64_t)1<<(layer->shift-1)))>>layer->shift;
+
+	if (scaled>INT32_MAX){
+		return INT32_MAX;
+	}
+	if (scaled<INT32_MIN){
+		return INT32_MIN;
+	}
+	return (int32_t)scaled;
+}
+
+
+/**
+ * Computes the output of a single neuron of a hidden/output layer before its activation function.
+ * @param layer The layer containing the neuron
+ * @param o The index of the neuron (output) inside the layer
+ * @param in The int8 input vector of the layer
+ * @return The pre-activation value in Q12
+ */
+static int32_t neuron_forward(const quantized_net_layer *layer, int o, const int8_t *in){
+
+	const int8_t *w=layer->weights+o*layer->n_inputs;
+	int32_t acc=layer->biases[o];
+
+	for (int i=0; i<layer->n_inputs; i++){
+		acc+=(int32_t)w[i]*in[i];
+	}
+	return requantize(layer,acc);
+}
+
+
+/**
+ * Computes the output of a single neuron of the input layer before its activation function.
+ * @param layer The input layer
+ * @param o The index of the neuron (output) inside the layer
+ * @param in The int16 quantized measurements
+ * @return The pre-activation value in Q12
+ */
+static int32_t input_neuron_forward(const quantized_net_layer *layer, int o, const int16_t *in){
+
+	const int16_t *w=layer->wide_weights+o*layer->n_inputs;
+	int64_t acc=layer->biases[o];
+
+	for (int i=0; i<layer->n_inputs; i++){
+		acc+=(int32_t)w[i]*in[i];
+	}
+	return requantize(layer,acc);
+}
+
+
+/**
+ * Fixed-point softmax over the pre-activations of the last layer.
+ * @param logits The pre-activations in Q12
+ * @param n The number of classes
+ * @param outputs The probabilities in Q15 (their sum is 32768 apart from rounding)
+ */
+static void softmax_q12_to_q15(const int32_t *logits, int n, uint16_t *outputs){
+
+	int32_t max=logits[0];
+	uint32_t sum=0;
+	uint32_t e;
+
+	for (int i=1; i<n; i++){
+		if (logits[i]>max){
+			max=logits[i];
+		}
+	}
+	for (int i=0; i<n; i++){
+		e=exp_q12_to_q15(logits[i]-max);
+		outputs[i]=(uint16_t)e;
+		sum+=e;
+	}
+	// The maximum contributes exp(0)=1, so sum can never be 0.
+	for (int i=0; i<n; i++){
+		outputs[i]=(uint16_t)((((uint32_t)outputs[i]<<15)+(sum>>1))/sum);
+	}
+}
+
+
+/**
+ * Executes the inference of the int8 quantized network returning the probabilities in fixed-point.
+ * @param net The quantized network
+ * @param features The raw (float) input vector
+ * @param n_features The length of the input vector
+ * @param outputs The vector of probabilities in Q15 to be populated
+ * @param n_outputs The length of the output vector
+ * @return 0 on success, -1 if the sizes do not match the ones of the network
+ */
+int quantized_net_predict_proba_q15(const quantized_net *net, const float *features, int n_features, uint16_t *outputs, int n_outputs){
+
+	const quantized_net_layer *first=&net->layers[0];
+	const quantized_net_layer *last=&net->layers[net->n_layers-1];
+	int16_t measurements[QUANTIZED_NET_MAX_FEATURES];
+	int8_t *in=net->buf1;
+	int8_t *out=net->buf2;
+	int8_t *tmp;
+	float scaled;
+
+	if (n_features!=net->n_features || n_features>QUANTIZED_NET_MAX_FEATURES || n_outputs!=last->n_outputs
+		|| net->n_layers<2 || first->activation!=QUANTIZED_NET_ACTIVATION_TANH || last->activation!=QUANTIZED_NET_ACTIVATION_SOFTMAX){
+		return -1;
+	}
+
+	// Quantization of the raw measurements: the only floating point operations of the inference.
+	for (int i=0; i<n_features; i++){
+		scaled=features[i]*net->input_scales[i];
+		scaled=(scaled>32767)?32767:((scaled<-32767)?-32767:scaled);
+		measurements[i]=(int16_t)((scaled<0)?scaled-0.5f:scaled+0.5f);
+	}
+
+	for (int o=0; o<first->n_outputs; o++){
+		in[o]=tanh_q12_to_q7(input_neuron_forward(first,o,measurements));
+	}
+
+	for (int l=1; l<net->n_layers; l++){
+		const quantized_net_layer *layer=&net->layers[l];
+
+		if (layer->activation==QUANTIZED_NET_ACTIVATION_SOFTMAX){
+			for (int o=0; o<layer->n_outputs; o++){
+				net->logits[o]=neuron_forward(layer,o,in);
+			}
+			softmax_q12_to_q15(net->logits,layer->n_outputs,outputs);
+			break;
+		}
+
+		for (int o=0; o<layer->n_outputs; o++){
+			out[o]=tanh_q12_to_q7(neuron_forward(layer,o,in));
+		}
+		tmp=in;
+		in=out;
+		out=tmp;
+	}
+	return 0;
+}
+
+
+/**
+ * Same as quantized_net_predict_proba_q15() but with the interface of eml_net_predict_proba(), so it can be used as drop-in replacement.
+ * @param net The quantized network
+ * @param features The raw (float) input vector
+ * @param n_features The length of the input vector
+ * @param outputs The vector of probabilities to be populated
+ * @param n_outputs The length of the output vector
+ * @return 0 on success, -1 if the sizes do not match the ones of the network
+ */
+int quantized_net_predict_proba(const quantized_net *net, const float *features, int n_features, float *outputs, int n_outputs){
+
+	uint16_t outputs_q15[QUANTIZED_NET_MAX_CLASSES];
+
+	if (n_outputs>QUANTIZED_NET_MAX_CLASSES){
+		return -1;
+	}
+	if (quantized_net_predict_proba_q15(net,features,n_features,outputs_q15,n_outputs)!=0){
+		return -1;
+	}
+	for (int i=0; i<n_outputs; i++){
+		outputs[i]=(float)outputs_q15[i]/QUANTIZED_NET_PROBA_ONE;
+	}
+	return 0;
+}
@@ -0,0 +1,43 @@
+#ifndef QUANTIZED_NET_H
+#define QUANTIZED_NET_H
+
+#include <stdint.h>
+
+// Fixed-point formats used by the int8 inference kernels
+#define QUANTIZED_NET_PREACT_FRAC_BITS 12 // Pre-activations (layer outputs before tanh/softmax) are Q12 in int32
+#define QUANTIZED_NET_PROBA_ONE 32768     // Probabilities returned by the softmax are Q15 in uint16
+#define QUANTIZED_NET_MAX_CLASSES 8
+#define QUANTIZED_NET_MAX_FEATURES 8
+
+typedef enum {
+	QUANTIZED_NET_ACTIVATION_TANH,
+	QUANTIZED_NET_ACTIVATION_SOFTMAX
+} quantized_net_activation;
+
+typedef struct {
+	int16_t n_outputs;
+	int16_t n_inputs;
+	const int8_t *weights;      // Row-major per output neuron: weights[o*n_inputs+i]
+	const int16_t *wide_weights; // Used instead of weights by the input layer, that works on int16 measurements
+	const int32_t *biases;      // Already expressed in the scale of the int32 accumulator
+	int32_t multiplier;         // Re-quantization of the accumulator into Q12: (acc*multiplier)>>shift
+	int8_t shift;
+	quantized_net_activation activation;
+} quantized_net_layer;
+
+typedef struct {
+	int16_t n_features;
+	const float *input_scales;  // Per-feature factor mapping the raw measurement into int16
+	int16_t n_layers;
+	const quantized_net_layer *layers;
+	int8_t *buf1;
+	int8_t *buf2;
+	int32_t *logits;            // Q12 pre-activations of the last (softmax) layer
+	int16_t buf_length;
+} quantized_net;
+
+
+int quantized_net_predict_proba_q15(const quantized_net *net, const float *features, int n_features, uint16_t *outputs, int n_outputs);
+int quantized_net_predict_proba(const quantized_net *net, const float *features, int n_features, float *outputs, int n_outputs);
+
+#endif
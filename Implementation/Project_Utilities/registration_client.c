@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "contiki.h"
+#include "coap-engine.h"
+#include "coap-callback-api.h"
+#include "lib/random.h"
+#include "os/net/linkaddr.h"
+#include "sys/ctimer.h"
+#include "sys/log.h"
+
+#include "backoff.h"
+#include "json_pool.h"
+#include "global_constants.h"
+#include "registration_client.h"
+
+/*
+ * Registration of the node on the server, without blocking the process that starts it: the request is sent with the
+ * callback API of CoAP and the retries are scheduled with a ctimer, so the sensing keeps running (degraded mode)
+ * while the server is unreachable. The retries follow an exponential backoff with jitter (backoff.c): after
+ * REGISTRATION_RETRY_BUDGET failures the client stays quiet for REGISTRATION_SUSPEND_TIME and then starts a new
+ * burst of attempts. A node runs a single registration, hence the state is kept here and not in a structure.
+ *
+ * The payload is copied out of the cJSON pool before sending: the request can stay in flight across other
+ * requests of the process, that reset the pool when they complete.
+ */
+
+static registration_state state=REGISTRATION_IDLE;
+static backoff policy;
+static unsigned int attempts=0;
+
+static registration_payload_builder payload_builder;
+static registration_response_handler response_handler;
+static registration_done_callback done_callback;
+
+static coap_endpoint_t server_ep;
+static coap_message_t request[1];
+static coap_callback_request_state_t request_state;
+static char payload[REGISTRATION_MAX_PAYLOAD_LEN];
+static bool response_accepted;
+
+static struct ctimer retry_timer;
+
+static void send_registration(void *ptr);
+
+
+/**
+ * Random number for the jitter, mixed with the link-layer address so that nodes with the same seed do not retry
+ * in lockstep.
+ */
+static uint16_t jitter_random(void){
+	return random_rand() ^ (uint16_t)((linkaddr_node_addr.u8[LINKADDR_SIZE-2]<<8) | linkaddr_node_addr.u8[LINKADDR_SIZE-1]);
+}
+
+
+/**
+ * Schedules the next attempt after a failure, or suspends the client once the retry budget is spent.
+ */
+static void schedule_retry(void){
+
+	uint32_t delay;
+
+	if (backoff_next_delay(&policy, jitter_random(), &delay)){
+		state=REGISTRATION_BACKOFF;
+		LOG_DBG("Registration: next attempt in %lu ms\n", (unsigned long)(delay*1000/CLOCK_SECOND));
+	}
+	else {
+		state=REGISTRATION_SUSPENDED;
+		backoff_reset(&policy);
+		delay=REGISTRATION_SUSPEND_TIME;
+		LOG_DBG("Registration: retry budget spent, suspended for %lu s\n", (unsigned long)(delay/CLOCK_SECOND));
+	}
+	ctimer_set(&retry_timer, (clock_time_t)delay, send_registration, NULL);
+}
+
+
+/**
+ * Callback of the CoAP request: the answer is handed to the device, the outcome is decided when the exchange is over.
+ */
+static void registration_callback(coap_callback_request_state_t *callback_state){
+
+	switch (callback_state->state.status) {
+	case COAP_REQUEST_STATUS_RESPONSE:
+		response_accepted=response_handler(callback_state->state.response);
+		return;
+	case COAP_REQUEST_STATUS_MORE:
+		return;
+	case COAP_REQUEST_STATUS_FINISHED:
+		break;
+	default:
+		// Timeout or block error
+		response_handler(NULL);
+		response_accepted=false;
+		break;
+	}
+
+	if (!response_accepted){
+		schedule_retry();
+		return;
+	}
+
+	state=REGISTRATION_DONE;
+	backoff_reset(&policy);
+	LOG_DBG("Registration completed after %u attempts\n", attempts);
+	if (done_callback!=NULL){
+		done_callback();
+	}
+}
+
+
+/**
+ * Sends one registration request. A message that cannot be built counts as a failed attempt.
+ */
+static void send_registration(void *ptr){
+
+	attempts++;
+	LOG_DBG("Try to register the device, attempt: %u \n", attempts);
+
+	char *json_payload=NULL;
+	payload_builder(&json_payload);
+	if (json_payload==NULL){
+		json_pool_reset();
+		schedule_retry();
+		return;
+	}
+	int length=snprintf(payload, sizeof(payload), "%s", json_payload);
+	json_pool_free(json_payload);
+
+	// The message is built: nothing of it must be left in the pool
+	unsigned int leaked=json_pool_reset();
+	if (leaked>0){
+		LOG_WARN("Registration: %u JSON blocks not freed by the payload builder\n", leaked);
+	}
+	if (length>=(int)sizeof(payload)){
+		printf("Registration message too long!\n");
+		schedule_retry();
+		return;
+	}
+
+	coap_endpoint_parse(SERVER_REG_EP, strlen(SERVER_REG_EP), &server_ep);
+	coap_init_message(request, COAP_TYPE_CON, COAP_POST, 0);
+	coap_set_header_uri_path(request, SERVICE_REG_URL);
+	coap_set_header_accept(request, APPLICATION_JSON);
+	coap_set_payload(request, (uint8_t *)payload, length);
+
+	state=REGISTRATION_PENDING;
+	response_accepted=false;
+	if (!coap_send_request(&request_state, &server_ep, request, registration_callback)){
+		// No transaction available
+		schedule_retry();
+	}
+}
+
+
+/**
+ * Starts the registration and returns immediately: the first request is sent at once, the outcome is notified
+ * through on_registered. Does nothing if the registration is already started.
+ * @param build_payload Builds the registration message
+ * @param handle_response Handles the answer of the server and tells if the registration is accepted
+ * @param on_registered Called when the registration completes (it can be NULL)
+ */
+void registration_client_start(registration_payload_builder build_payload, registration_response_handler handle_response,
+	registration_done_callback on_registered){
+
+	if (state!=REGISTRATION_IDLE){
+		return;
+	}
+
+	payload_builder=build_payload;
+	response_handler=handle_response;
+	done_callback=on_registered;
+	backoff_init(&policy, REGISTRATION_BASE_DELAY, REGISTRATION_MAX_DELAY, REGISTRATION_RETRY_BUDGET);
+	attempts=0;
+
+	// Executed in the context of the calling process, that owns the retry timer
+	send_registration(NULL);
+}
+
+
+/**
+ * @return The current state of the registration
+ */
+registration_state registration_client_get_state(void){
+	return state;
+}
+
+
+/**
+ * @return true once the server has accepted the registration
+ */
+bool registration_client_is_registered(void){
+	return state==REGISTRATION_DONE;
+}
+
+
+/**
+ * @return The registration requests sent so far
+ */
+unsigned int registration_client_get_attempts(void){
+	return attempts;
+}
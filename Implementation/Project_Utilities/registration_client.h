@@ -0,0 +1,42 @@
+#include <stdbool.h>
+
+#include "coap-engine.h"
+
+// Retry policy of the registration (it can be overridden in project-conf.h)
+#ifndef REGISTRATION_BASE_DELAY
+#define REGISTRATION_BASE_DELAY (2*CLOCK_SECOND)
+#endif
+#ifndef REGISTRATION_MAX_DELAY
+#define REGISTRATION_MAX_DELAY (64*CLOCK_SECOND)
+#endif
+#ifndef REGISTRATION_RETRY_BUDGET
+#define REGISTRATION_RETRY_BUDGET 8
+#endif
+// Pause once the budget is spent, before starting over with a new burst of attempts
+#ifndef REGISTRATION_SUSPEND_TIME
+#define REGISTRATION_SUSPEND_TIME (600*CLOCK_SECOND)
+#endif
+
+#define REGISTRATION_MAX_PAYLOAD_LEN 128
+
+typedef enum {
+	REGISTRATION_IDLE,       // Not started
+	REGISTRATION_PENDING,    // Request sent, waiting for the answer
+	REGISTRATION_BACKOFF,    // Waiting before the next attempt
+	REGISTRATION_SUSPENDED,  // Retry budget spent, waiting REGISTRATION_SUSPEND_TIME
+	REGISTRATION_DONE
+} registration_state;
+
+// Builds the registration message with cJSON (create_msg_registration of the device)
+typedef void (*registration_payload_builder)(char **json_payload);
+// Handles the answer of the server (NULL on timeout): true if the device is registered
+typedef bool (*registration_response_handler)(coap_message_t *response);
+// Called once, when the registration completes
+typedef void (*registration_done_callback)(void);
+
+
+void registration_client_start(registration_payload_builder build_payload, registration_response_handler handle_response,
+	registration_done_callback on_registered);
+registration_state registration_client_get_state(void);
+bool registration_client_is_registered(void);
+unsigned int registration_client_get_attempts(void);
@@ -0,0 +1,33 @@
+#ifdef DIAGNOSTICS
+
+#include "contiki.h"
+#include "coap-engine.h"
+
+#include "diagnostics.h"
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+/* Where the time of the node goes: CPU, low-power mode, radio transmitting and listening (energest, in ms since boot and in the last period) and the time spent in inference, SenML encoding, JSON parsing and actuation (executions, total, max and last period, in us). Built only with DIAGNOSTICS defined. */
+RESOURCE(res_diagnostics,
+         "title=\"diagnostics\"; GET; rt=\"Diagnostics\"; ct=\"application/json\";",
+         res_get_handler,
+         NULL,
+         NULL,
+         NULL);
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	int length=diagnostics_write((char *)buffer, preferred_size);
+
+	if (length<0) {
+		coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+		return;
+	}
+
+	coap_set_header_content_format(response, APPLICATION_JSON);
+	coap_set_payload(response, buffer, length);
+}
+
+#endif
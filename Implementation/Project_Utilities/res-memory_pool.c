@@ -0,0 +1,29 @@
+#include "contiki.h"
+#include "coap-engine.h"
+
+#include "json_pool.h"
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+/* Counters of the static pool that serves all the memory of cJSON: blocks in use and high-water mark of each class, allocations, failures (pool exhausted), leaks (blocks reclaimed by a reset) and invalid frees. */
+RESOURCE(res_memory_pool,
+         "title=\"memory_pool\"; GET; rt=\"Memory_pool\"; ct=\"application/json\";",
+         res_get_handler,
+         NULL,
+         NULL,
+         NULL);
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	int length=json_pool_write_stats((char *)buffer, preferred_size);
+
+	if (length<0) {
+		coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+		return;
+	}
+
+	coap_set_header_content_format(response, APPLICATION_JSON);
+	coap_set_payload(response, buffer, length);
+}
@@ -0,0 +1,60 @@
+#include "contiki.h"
+#include "coap-engine.h"
+
+#include "adaptive_period.h"
+#include "json_tokenizer.h"
+
+
+// Adaptive sensing period, updated by the sensing
+adaptive_period sensing_period;
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset);
+
+/* Sensing period of the node: GET returns the effective period, its limits and the samples taken with the total of their periods (seconds / samples is the mean period); PUT {"min_period":s,"max_period":s} changes the limits, in seconds. */
+RESOURCE(res_sensing_period,
+         "title=\"sensing_period\"; GET|PUT; rt=\"Sensing_period\"; ct=\"application/json\";",
+         res_get_handler,
+         NULL,
+         res_put_handler,
+         NULL);
+
+
+static void res_get_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	int length=adaptive_period_write(&sensing_period, (char *)buffer, preferred_size);
+
+	if (length<0) {
+		coap_set_status_code(response, INTERNAL_SERVER_ERROR_5_00);
+		return;
+	}
+
+	coap_set_header_content_format(response, APPLICATION_JSON);
+	coap_set_payload(response, buffer, length);
+}
+
+
+static void res_put_handler(coap_message_t *request, coap_message_t *response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset){
+
+	const uint8_t *payload = NULL;
+	int payload_length = coap_get_payload(request, &payload);
+
+	if (!json_tokenizer_is_object((const char *)payload, payload_length)) {
+		coap_set_status_code(response, BAD_REQUEST_4_00);
+		return;
+	}
+
+	// A limit not in the message is left unchanged
+	int min_period=sensing_period.min_period;
+	int max_period=sensing_period.max_period;
+	bool found_min=json_tokenizer_get_int((const char *)payload, payload_length, "min_period", &min_period);
+	bool found_max=json_tokenizer_get_int((const char *)payload, payload_length, "max_period", &max_period);
+
+	if ((!found_min && !found_max) || min_period<=0 || max_period>UINT16_MAX ||
+		adaptive_period_set_limits(&sensing_period, min_period, max_period)<0) {
+		coap_set_status_code(response, BAD_REQUEST_4_00);
+		return;
+	}
+	coap_set_status_code(response, CHANGED_2_04);
+}
@@ -0,0 +1,169 @@
+#include <string.h>
+
+#include "sample_batch.h"
+
+/*
+ * The samples are sent as a single SenML pack: the base time is the time of the oldest sample and each record carries
+ * its offset from it. Without a wall clock on the node, the times are relative to the moment the pack is built
+ * (RFC 8428, section 4.5.3): the base time is negative (the age of the oldest sample) and base time plus offset
+ * gives how many seconds ago each reading was taken.
+ * Every sample gets a sequence number, so that several readers (the observers of a resource) can each remember the
+ * first sample they have not received yet: a sample is discarded once all of them have gone past it, or when the
+ * batch overflows.
+ */
+
+
+/**
+ * Initializes an empty batch.
+ * @param batch The batch to initialize
+ * @param size Number of samples after which the batch is full
+ * @return 0 on success, -1 if the size exceeds the one supported
+ */
+int sample_batch_init(sample_batch *batch, int size){
+
+	if (size<=0 || size>SAMPLE_BATCH_MAX_SIZE){
+		return -1;
+	}
+
+	batch->size=size;
+	batch->nr_samples=0;
+	batch->first_sequence=0;
+	return 0;
+}
+
+
+/**
+ * Discards all the samples, typically after they have been sent.
+ * @param batch The batch
+ */
+void sample_batch_clear(sample_batch *batch){
+	batch->first_sequence+=batch->nr_samples;
+	batch->nr_samples=0;
+}
+
+
+/**
+ * Appends a sample. When the batch is already full the oldest sample is dropped, so that the batch always holds
+ * the last readings even if a notification could not be sent.
+ * @param batch The batch
+ * @param time Time of the reading, in seconds
+ * @param value The reading
+ * @return true if the batch is full after the insertion
+ */
+bool sample_batch_add(sample_batch *batch, uint32_t time, float value){
+
+	if (batch->nr_samples==batch->size){
+		for (int i=1; i<batch->size; i++){
+			batch->times[i-1]=batch->times[i];
+			batch->values[i-1]=batch->values[i];
+		}
+		batch->nr_samples--;
+		batch->first_sequence++;
+	}
+
+	batch->times[batch->nr_samples]=time;
+	batch->values[batch->nr_samples]=value;
+	batch->nr_samples++;
+
+	return sample_batch_is_full(batch);
+}
+
+
+bool sample_batch_is_full(const sample_batch *batch){
+	return batch->nr_samples==batch->size;
+}
+
+
+/**
+ * @param batch The batch
+ * @param now The current time, in seconds
+ * @return The seconds passed since the oldest sample was taken, 0 if the batch is empty
+ */
+uint32_t sample_batch_age(const sample_batch *batch, uint32_t now){
+	return (batch->nr_samples>0)?now-batch->times[0]:0;
+}
+
+
+/**
+ * @param batch The batch
+ * @return The sequence number the next sample will get: a reader that has received all the samples is at this point
+ */
+uint32_t sample_batch_end(const sample_batch *batch){
+	return batch->first_sequence+batch->nr_samples;
+}
+
+
+// Index in the batch of the sample with the sequence number, clamped to the samples held
+static int sequence_index(const sample_batch *batch, uint32_t sequence){
+
+	int32_t index=(int32_t)(sequence-batch->first_sequence);
+
+	if (index<0){
+		return 0;
+	}
+	return (index>batch->nr_samples)?batch->nr_samples:index;
+}
+
+
+/**
+ * Discards the samples before a sequence number, typically once every reader has received them.
+ * @param batch The batch
+ * @param sequence The first sample to keep
+ * @return The number of samples discarded
+ */
+int sample_batch_discard_before(sample_batch *batch, uint32_t sequence){
+
+	int discarded=sequence_index(batch,sequence);
+
+	memmove(batch->times,batch->times+discarded,(batch->nr_samples-discarded)*sizeof(batch->times[0]));
+	memmove(batch->values,batch->values+discarded,(batch->nr_samples-discarded)*sizeof(batch->values[0]));
+	batch->nr_samples-=discarded;
+	batch->first_sequence+=discarded;
+	return discarded;
+}
+
+
+/**
+ * Describes the samples as a SenML pack, one record per sample with the base time and the time offsets set.
+ * The other fields of the payload (base unit, version) are left to the caller.
+ * @param batch The batch
+ * @param now The current time, in seconds, the times of the pack are relative to
+ * @param name Name of the records
+ * @param measurements Records to fill, at least batch->nr_samples
+ * @param payload The pack, pointing to measurements
+ * @return The number of records
+ */
+int sample_batch_to_senml(const sample_batch *batch, uint32_t now, char *name, senml_measurement *measurements, senml_payload *payload){
+	return sample_batch_to_senml_since(batch, batch->first_sequence, now, name, measurements, payload);
+}
+
+
+/**
+ * As sample_batch_to_senml(), for the samples from a sequence number on: those a reader has not received yet.
+ * @param batch The batch
+ * @param since Sequence number of the first sample of the pack (the oldest one held if it has been discarded)
+ * @param now The current time, in seconds, the times of the pack are relative to
+ * @param name Name of the records
+ * @param measurements Records to fill, at least batch->nr_samples
+ * @param payload The pack, pointing to measurements
+ * @return The number of records, 0 if the reader has received all the samples
+ */
+int sample_batch_to_senml_since(const sample_batch *batch, uint32_t since, uint32_t now, char *name, senml_measurement *measurements, senml_payload *payload){
+
+	int first=sequence_index(batch,since);
+	int nr_records=batch->nr_samples-first;
+
+	for (int i=0; i<nr_records; i++){
+		measurements[i].name=name;
+		measurements[i].unit=NULL;
+		measurements[i].type=SENML_TYPE_V;
+		measurements[i].value.float_value=batch->values[first+i];
+		measurements[i].time=(int)(batch->times[first+i]-batch->times[first]);
+	}
+
+	payload->base_time=(nr_records>0)?-(int)(now-batch->times[first]):0;
+	payload->nr_measurments=nr_records;
+	payload->measurements=measurements;
+
+	return nr_records;
+}
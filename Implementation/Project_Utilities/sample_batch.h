@@ -0,0 +1,26 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "senml-json.h"
+
+#define SAMPLE_BATCH_MAX_SIZE 16
+
+// Readings of a single quantity collected between two notifications, each with the time (in seconds) it was taken.
+typedef struct {
+	int16_t size;        // Samples that fill the batch
+	int16_t nr_samples;  // Samples currently in the batch
+	uint32_t first_sequence; // Sequence number of the oldest sample: the samples are numbered from 0 as they are added
+	uint32_t times[SAMPLE_BATCH_MAX_SIZE];
+	float values[SAMPLE_BATCH_MAX_SIZE];
+} sample_batch;
+
+
+int sample_batch_init(sample_batch *batch, int size);
+void sample_batch_clear(sample_batch *batch);
+bool sample_batch_add(sample_batch *batch, uint32_t time, float value);
+bool sample_batch_is_full(const sample_batch *batch);
+uint32_t sample_batch_age(const sample_batch *batch, uint32_t now);
+uint32_t sample_batch_end(const sample_batch *batch);
+int sample_batch_discard_before(sample_batch *batch, uint32_t sequence);
+int sample_batch_to_senml(const sample_batch *batch, uint32_t now, char *name, senml_measurement *measurements, senml_payload *payload);
+int sample_batch_to_senml_since(const sample_batch *batch, uint32_t since, uint32_t now, char *name, senml_measurement *measurements, senml_payload *payload);
@@ -96,13 +96,19 @@ void create_senml_payload(senml_payload *payload,char **json_string_payload){
 	// Print the resulting JSON
 	//*json_string_payload = cJSON_Print(root); // Well-formatted way, waste of space		
 	char *json_payload=cJSON_PrintUnformatted(root);
+	if (json_payload == NULL) {
+		// Also the case of the memory pool exhausted
+		printf("JSON printing failed!\n");
+		cJSON_Delete(root);
+		return;
+	}
 	
 	// Make sure to allocate memory for the json_string_payload
 	if (*json_string_payload == NULL) {
-		*json_string_payload = (char *)malloc(strlen(json_payload) + 1);
+		*json_string_payload = (char *)cJSON_malloc(strlen(json_payload) + 1);
 		if (*json_string_payload == NULL) {
 			printf("Memory allocation failed!\n");
-			free(json_payload);
+			cJSON_free(json_payload);
 			cJSON_Delete(root); // Clean up the JSON object
 			return;
 		}
@@ -112,13 +118,456 @@ void create_senml_payload(senml_payload *payload,char **json_string_payload){
 	strcpy(*json_string_payload, json_payload);
 
 	// Free the temporary JSON string
-	free(json_payload);
+	cJSON_free(json_payload);
 	
 	// Clean up the root object to avoid memory leaks
 	cJSON_Delete(root);
 }
 
 
+// Output position of the SenML writers: once the buffer is full only the overflow is recorded.
+typedef struct {
+	char *buffer;
+	int size;
+	int length;
+	bool overflow;
+} senml_writer;
+
+
+static void write_char(senml_writer *writer, char c){
+	if (writer->length>=writer->size){
+		writer->overflow=true;
+		return;
+	}
+	writer->buffer[writer->length++]=c;
+}
+
+
+static void write_raw(senml_writer *writer, const char *str){
+	while (*str!='\0' && !writer->overflow){
+		write_char(writer,*str++);
+	}
+}
+
+
+/**
+ * Writes a JSON string escaping the same characters as cJSON (quotes, backslash and control characters).
+ */
+static void write_string(senml_writer *writer, const char *str){
+
+	static const char hex[] = "0123456789abcdef";
+
+	write_char(writer,'\"');
+	for (; *str!='\0' && !writer->overflow; str++){
+		unsigned char c=(unsigned char)*str;
+
+		switch (c){
+			case '\"':  write_raw(writer,"\\\""); break;
+			case '\\': write_raw(writer,"\\\\"); break;
+			case '\b':  write_raw(writer,"\\b"); break;
+			case '\f':  write_raw(writer,"\\f"); break;
+			case '\n':  write_raw(writer,"\\n"); break;
+			case '\r':  write_raw(writer,"\\r"); break;
+			case '\t':  write_raw(writer,"\\t"); break;
+			default:
+				if (c<32){
+					write_raw(writer,"\\u00");
+					write_char(writer,hex[c>>4]);
+					write_char(writer,hex[c&0xF]);
+				}
+				else {
+					write_char(writer,(char)c);
+				}
+		}
+	}
+	write_char(writer,'\"');
+}
+
+
+/**
+ * Writes an integer in decimal, as cJSON prints the numbers without a fractional part.
+ */
+static void write_int(senml_writer *writer, int value){
+
+	char digits[12];
+	int n=0;
+	unsigned int magnitude=(value<0)?0u-(unsigned int)value:(unsigned int)value;
+
+	do {
+		digits[n++]='0'+magnitude%10;
+		magnitude/=10;
+	} while (magnitude>0);
+
+	if (value<0){
+		write_char(writer,'-');
+	}
+	while (n>0){
+		write_char(writer,digits[--n]);
+	}
+}
+
+
+static void write_key(senml_writer *writer, const char *key, bool first){
+	if (!first){
+		write_char(writer,',');
+	}
+	write_char(writer,'"');
+	write_raw(writer,key);
+	write_raw(writer,"\":");
+}
+
+
+/**
+ * Writes the JSON representation of a payload. When slots is not NULL the numeric values are left out
+ * and their positions are recorded instead, to build a template.
+ */
+static void write_senml_json(senml_writer *writer, senml_payload *payload, senml_template *slots){
+
+	create_base_name_attribute(payload->base_name);
+
+	write_char(writer,'{');
+	write_key(writer,"bn",true);
+	write_string(writer,payload->base_name);
+
+	if (payload->base_time!=0){
+		write_key(writer,"bt",false);
+		write_int(writer,payload->base_time);
+	}
+	if (payload->base_unit!=NULL){
+		write_key(writer,"bu",false);
+		write_string(writer,payload->base_unit);
+	}
+	write_key(writer,"ver",false);
+	write_int(writer,1);
+
+	write_key(writer,"e",false);
+	write_char(writer,'[');
+	for (int i=0; i<payload->nr_measurments && !writer->overflow; i++){
+		senml_measurement *measurement=&payload->measurements[i];
+		bool first=true;
+
+		if (i>0){
+			write_char(writer,',');
+		}
+		write_char(writer,'{');
+
+		if (measurement->name!=NULL){
+			write_key(writer,"n",first);
+			write_string(writer,measurement->name);
+			first=false;
+		}
+		if (measurement->unit!=NULL){
+			write_key(writer,"u",first);
+			write_string(writer,measurement->unit);
+			first=false;
+		}
+
+		switch (measurement->type){
+			case (SENML_TYPE_V):
+				// Adopted trick to avoid to send in float format.
+				write_key(writer,"v",first);
+				if (slots==NULL){
+					write_int(writer,(int)(measurement->value.float_value*100));
+				}
+				else if (slots->nr_slots<SENML_TEMPLATE_MAX_SLOTS){
+					slots->slot_offsets[slots->nr_slots++]=writer->length;
+				}
+				else {
+					writer->overflow=true;
+				}
+				first=false;
+				break;
+
+			case (SENML_TYPE_BV):
+				write_key(writer,"bv",first);
+				write_raw(writer,measurement->value.boolean_value?"true":"false");
+				first=false;
+				break;
+
+			case (SENML_TYPE_SV):
+				// cJSON does not add a NULL string
+				if (measurement->value.string_value!=NULL){
+					write_key(writer,"sv",first);
+					write_string(writer,measurement->value.string_value);
+					first=false;
+				}
+				break;
+
+			default:
+				printf("Wrong type inserted. Do nothing");
+		}
+
+		if (measurement->time!=0){
+			write_key(writer,"t",first);
+			write_int(writer,measurement->time);
+		}
+		write_char(writer,'}');
+	}
+	write_char(writer,']');
+	write_char(writer,'}');
+}
+
+
+/**
+ * This function serializes a SenML payload directly into a buffer, producing exactly the same bytes as create_senml_payload()
+ * without any heap allocation (no cJSON tree, no intermediate strings). It is meant to write into the buffer of a CoAP response.
+ * @param payload is the populated datastructure to serialize
+ * @param buffer is the destination, NUL-terminated when the payload fits
+ * @param buffer_size is the size of the destination (terminator included)
+ * @return The length of the payload (terminator excluded), SENML_BUFFER_OVERFLOW if it does not fit
+ */
+int write_senml_payload(senml_payload *payload, char *buffer, int buffer_size){
+
+	// Room is kept for the terminator
+	senml_writer writer={buffer, buffer_size-1, 0, buffer_size<1};
+
+	write_senml_json(&writer,payload,NULL);
+
+	if (writer.overflow){
+		return SENML_BUFFER_OVERFLOW;
+	}
+	buffer[writer.length]='\0';
+	return writer.length;
+}
+
+
+/**
+ * This function pre-renders the JSON of a payload whose structure never changes (names, units, times), leaving out the
+ * numeric values. Later the payload can be produced by write_senml_template() providing only the values.
+ * @param template is the template to build
+ * @param payload is the datastructure providing the fixed part; the values of the SENML_TYPE_V measurements become the slots, in order
+ * @return 0 on success, SENML_BUFFER_OVERFLOW if the skeleton or the number of slots exceed the template capacity
+ */
+int create_senml_template(senml_template *template, senml_payload *payload){
+
+	senml_writer writer={template->skeleton, SENML_TEMPLATE_MAX_LEN, 0, false};
+
+	template->nr_slots=0;
+	write_senml_json(&writer,payload,template);
+	template->length=writer.length;
+
+	if (writer.overflow){
+		template->nr_slots=0;
+		template->length=0;
+		return SENML_BUFFER_OVERFLOW;
+	}
+	return 0;
+}
+
+
+/**
+ * This function produces a payload from a template, copying the fixed parts and formatting only the values in between:
+ * the output is the same that write_senml_payload() gives for the payload the template was created from.
+ * @param template is the template built by create_senml_template()
+ * @param values are the values of the slots, multiplied by 100 and truncated as in write_senml_payload()
+ * @param buffer is the destination, NUL-terminated when the payload fits
+ * @param buffer_size is the size of the destination (terminator included)
+ * @return The length of the payload (terminator excluded), SENML_BUFFER_OVERFLOW if it does not fit
+ */
+int write_senml_template(const senml_template *template, const float *values, char *buffer, int buffer_size){
+
+	senml_writer writer={buffer, buffer_size-1, 0, buffer_size<1};
+	int start=0;
+
+	for (int i=0; i<=template->nr_slots && !writer.overflow; i++){
+		int end=(i<template->nr_slots)?template->slot_offsets[i]:template->length;
+
+		if (writer.length+end-start>writer.size){
+			writer.overflow=true;
+			break;
+		}
+		memcpy(buffer+writer.length,template->skeleton+start,end-start);
+		writer.length+=end-start;
+		start=end;
+
+		if (i<template->nr_slots){
+			write_int(&writer,(int)(values[i]*100));
+		}
+	}
+
+	if (writer.overflow){
+		return SENML_BUFFER_OVERFLOW;
+	}
+	buffer[writer.length]='\0';
+	return writer.length;
+}
+
+
+// RFC 8428 labels of the SenML-CBOR representation
+#define SENML_CBOR_BN -2
+#define SENML_CBOR_BT -3
+#define SENML_CBOR_BU -4
+#define SENML_CBOR_N 0
+#define SENML_CBOR_U 1
+#define SENML_CBOR_V 2
+#define SENML_CBOR_VS 3
+#define SENML_CBOR_VB 4
+#define SENML_CBOR_T 6
+
+// CBOR major types
+#define CBOR_UNSIGNED 0
+#define CBOR_NEGATIVE 1
+#define CBOR_TEXT 3
+#define CBOR_ARRAY 4
+#define CBOR_MAP 5
+#define CBOR_FALSE 0xF4
+#define CBOR_TRUE 0xF5
+
+
+/**
+ * Writes the initial byte of a CBOR data item followed by the argument in the shortest encoding.
+ */
+static void write_cbor_head(senml_writer *writer, uint8_t major, uint32_t argument){
+
+	major<<=5;
+
+	if (argument<24){
+		write_char(writer,(char)(major|argument));
+	}
+	else if (argument<=0xFF){
+		write_char(writer,(char)(major|24));
+		write_char(writer,(char)argument);
+	}
+	else if (argument<=0xFFFF){
+		write_char(writer,(char)(major|25));
+		write_char(writer,(char)(argument>>8));
+		write_char(writer,(char)argument);
+	}
+	else {
+		write_char(writer,(char)(major|26));
+		write_char(writer,(char)(argument>>24));
+		write_char(writer,(char)(argument>>16));
+		write_char(writer,(char)(argument>>8));
+		write_char(writer,(char)argument);
+	}
+}
+
+
+static void write_cbor_int(senml_writer *writer, int32_t value){
+	if (value<0){
+		write_cbor_head(writer,CBOR_NEGATIVE,(uint32_t)(-1-value));
+	}
+	else {
+		write_cbor_head(writer,CBOR_UNSIGNED,(uint32_t)value);
+	}
+}
+
+
+static void write_cbor_string(senml_writer *writer, const char *str){
+
+	size_t length=strlen(str);
+
+	write_cbor_head(writer,CBOR_TEXT,length);
+	for (size_t i=0; i<length && !writer->overflow; i++){
+		write_char(writer,str[i]);
+	}
+}
+
+
+/**
+ * Returns the number of labels of a SenML-CBOR record, so that the map can be written with a definite length.
+ */
+static int count_cbor_labels(senml_payload *payload, senml_measurement *measurement, bool first){
+
+	int labels=0;
+
+	if (first){
+		labels+=1+(payload->base_time!=0)+(payload->base_unit!=NULL);
+	}
+	if (measurement==NULL){
+		return labels;
+	}
+	labels+=(measurement->name!=NULL)+(measurement->unit!=NULL)+(measurement->time!=0);
+	if (measurement->type==SENML_TYPE_V || measurement->type==SENML_TYPE_BV ||
+	    (measurement->type==SENML_TYPE_SV && measurement->value.string_value!=NULL)){
+		labels++;
+	}
+	return labels;
+}
+
+
+/**
+ * This function serializes a SenML payload directly into a buffer using the CBOR representation of RFC 8428 (content-format 112).
+ * The payload is an array of records: the base fields travel in the first one, which also carries the first measurement.
+ * As in the JSON representation, the numeric values are sent as integers multiplied by 100.
+ * @param payload is the populated datastructure to serialize
+ * @param buffer is the destination
+ * @param buffer_size is the size of the destination
+ * @return The length of the payload, SENML_BUFFER_OVERFLOW if it does not fit
+ */
+int write_senml_cbor_payload(senml_payload *payload, uint8_t *buffer, int buffer_size){
+
+	senml_writer writer={(char *)buffer, buffer_size, 0, buffer_size<0};
+	int nr_records=(payload->nr_measurments>0)?payload->nr_measurments:1;
+
+	create_base_name_attribute(payload->base_name);
+
+	write_cbor_head(&writer,CBOR_ARRAY,nr_records);
+	for (int i=0; i<nr_records && !writer.overflow; i++){
+		senml_measurement *measurement=(payload->nr_measurments>0)?&payload->measurements[i]:NULL;
+
+		write_cbor_head(&writer,CBOR_MAP,count_cbor_labels(payload,measurement,i==0));
+
+		if (i==0){
+			write_cbor_int(&writer,SENML_CBOR_BN);
+			write_cbor_string(&writer,payload->base_name);
+			if (payload->base_time!=0){
+				write_cbor_int(&writer,SENML_CBOR_BT);
+				write_cbor_int(&writer,payload->base_time);
+			}
+			if (payload->base_unit!=NULL){
+				write_cbor_int(&writer,SENML_CBOR_BU);
+				write_cbor_string(&writer,payload->base_unit);
+			}
+		}
+		if (measurement==NULL){
+			break;
+		}
+
+		if (measurement->name!=NULL){
+			write_cbor_int(&writer,SENML_CBOR_N);
+			write_cbor_string(&writer,measurement->name);
+		}
+		if (measurement->unit!=NULL){
+			write_cbor_int(&writer,SENML_CBOR_U);
+			write_cbor_string(&writer,measurement->unit);
+		}
+
+		switch (measurement->type){
+			case (SENML_TYPE_V):
+				write_cbor_int(&writer,SENML_CBOR_V);
+				write_cbor_int(&writer,(int32_t)(measurement->value.float_value*100));
+				break;
+
+			case (SENML_TYPE_BV):
+				write_cbor_int(&writer,SENML_CBOR_VB);
+				write_char(&writer,(char)(measurement->value.boolean_value?CBOR_TRUE:CBOR_FALSE));
+				break;
+
+			case (SENML_TYPE_SV):
+				if (measurement->value.string_value!=NULL){
+					write_cbor_int(&writer,SENML_CBOR_VS);
+					write_cbor_string(&writer,measurement->value.string_value);
+				}
+				break;
+
+			default:
+				printf("Wrong type inserted. Do nothing");
+		}
+
+		if (measurement->time!=0){
+			write_cbor_int(&writer,SENML_CBOR_T);
+			write_cbor_int(&writer,measurement->time);
+		}
+	}
+
+	if (writer.overflow){
+		return SENML_BUFFER_OVERFLOW;
+	}
+	return writer.length;
+}
+
+
 /**
  * This function takes as input the JSON(string) of a message and populates the obj. payload to be used for next purposes.
  * @param json_string_payload the string to be interpret as incoming message
@@ -1,10 +1,20 @@
+#ifndef SENML_JSON_H
+#define SENML_JSON_H
+
 #include <stdbool.h> 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include "os/net/linkaddr.h"
 
 #define BASE_NAME_MAX_LEN 30
 
+// Returned by write_senml_payload() when the payload does not fit in the buffer
+#define SENML_BUFFER_OVERFLOW -1
+
+// CoAP content-format of application/senml+cbor (RFC 8428)
+#define SENML_CBOR_CONTENT_FORMAT 112
+
 typedef enum {
 	SENML_TYPE_V,
 	SENML_TYPE_BV,
@@ -38,10 +48,27 @@ typedef struct {
 	senml_measurement *measurements;
 } senml_payload;
 
+#define SENML_TEMPLATE_MAX_LEN 320
+#define SENML_TEMPLATE_MAX_SLOTS 8
+
+// JSON of a payload with a fixed structure, rendered once: only the numeric values (slots) are written at each request.
+typedef struct {
+	char skeleton[SENML_TEMPLATE_MAX_LEN];
+	int length;
+	int nr_slots;
+	int slot_offsets[SENML_TEMPLATE_MAX_SLOTS];
+} senml_template;
+
 
 
 
 void create_base_name_attribute(char *base_name);
 
 void create_senml_payload(senml_payload *payload,char **json_string_payload);
+int write_senml_payload(senml_payload *payload, char *buffer, int buffer_size);
+int create_senml_template(senml_template *template, senml_payload *payload);
+int write_senml_template(const senml_template *template, const float *values, char *buffer, int buffer_size);
+int write_senml_cbor_payload(senml_payload *payload, uint8_t *buffer, int buffer_size);
 //void parse_senml_payload(char *json_string_payload, senml_payload **payload);
+
+#endif
@@ -0,0 +1,121 @@
+#include <math.h>
+#include <string.h>
+
+#include "sliding_window.h"
+
+/*
+ * Running statistics over the last samples: the mean and the sum of squared distances are updated with Welford's
+ * method when the window is filling, and with its sliding version (the oldest sample replaced by the new one)
+ * when it is full, which is numerically stable also with large offsets such as the currents of a fault.
+ */
+
+
+/**
+ * Initializes an empty window.
+ * @param window The window to initialize
+ * @param n_channels Number of values in each sample
+ * @param size Number of samples kept by the window
+ * @return 0 on success, -1 if the sizes exceed the ones supported
+ */
+int sliding_window_init(sliding_window *window, int n_channels, int size){
+
+	if (n_channels<=0 || n_channels>SLIDING_WINDOW_MAX_CHANNELS || size<=0 || size>SLIDING_WINDOW_MAX_SIZE){
+		return -1;
+	}
+
+	window->n_channels=n_channels;
+	window->size=size;
+	sliding_window_reset(window);
+	return 0;
+}
+
+
+/**
+ * Discards all the samples in the window.
+ * @param window The window
+ */
+void sliding_window_reset(sliding_window *window){
+	window->count=0;
+	window->head=0;
+	memset(window->mean,0,sizeof(window->mean));
+	memset(window->m2,0,sizeof(window->m2));
+}
+
+
+/**
+ * Adds a sample to the window, replacing the oldest one if the window is full.
+ * @param window The window
+ * @param sample The new sample (n_channels values)
+ */
+void sliding_window_push(sliding_window *window, const float *sample){
+
+	float *slot=window->samples[window->head];
+
+	for (int c=0; c<window->n_channels; c++){
+		float old_mean=window->mean[c];
+
+		if (window->count<window->size){
+			window->mean[c]+=(sample[c]-old_mean)/(window->count+1);
+			window->m2[c]+=(sample[c]-old_mean)*(sample[c]-window->mean[c]);
+		}
+		else {
+			float oldest=slot[c];
+
+			window->mean[c]+=(sample[c]-oldest)/window->size;
+			window->m2[c]+=(sample[c]-oldest)*(sample[c]-window->mean[c]+oldest-old_mean);
+			// Rounding errors must not make the variance negative
+			if (window->m2[c]<0){
+				window->m2[c]=0;
+			}
+		}
+		slot[c]=sample[c];
+	}
+
+	if (window->count<window->size){
+		window->count++;
+	}
+	window->head=(window->head+1)%window->size;
+}
+
+
+/**
+ * Checks if a sample is a step change with respect to the samples in the window, i.e. if at least one channel is
+ * farther than its maximum step from the mean of the window. An empty window never detects a step.
+ * @param window The window
+ * @param sample The new sample (n_channels values)
+ * @param max_steps Maximum absolute distance from the mean of each channel
+ * @return true if the sample is a step change
+ */
+bool sliding_window_is_step(const sliding_window *window, const float *sample, const float *max_steps){
+
+	if (window->count==0){
+		return false;
+	}
+
+	for (int c=0; c<window->n_channels; c++){
+		if (fabsf(sample[c]-window->mean[c])>max_steps[c]){
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/**
+ * @param window The window
+ * @param channel Index of the channel
+ * @return The mean of the channel over the samples in the window (0 if empty)
+ */
+float sliding_window_mean(const sliding_window *window, int channel){
+	return window->mean[channel];
+}
+
+
+/**
+ * @param window The window
+ * @param channel Index of the channel
+ * @return The (population) variance of the channel over the samples in the window (0 if empty)
+ */
+float sliding_window_variance(const sliding_window *window, int channel){
+	return (window->count>0)?window->m2[channel]/window->count:0;
+}
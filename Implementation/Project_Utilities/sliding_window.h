@@ -0,0 +1,25 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SLIDING_WINDOW_MAX_SIZE 16
+#define SLIDING_WINDOW_MAX_CHANNELS 8
+
+// Ring buffer of the last samples of several channels, with the running mean and variance of each channel.
+// All the memory is inside the struct: pushing a sample costs O(n_channels) whatever the size of the window.
+typedef struct {
+	int16_t n_channels;
+	int16_t size;   // Samples kept when the window is full
+	int16_t count;  // Samples currently in the window
+	int16_t head;   // Slot that will be overwritten by the next sample (the oldest one when the window is full)
+	float samples[SLIDING_WINDOW_MAX_SIZE][SLIDING_WINDOW_MAX_CHANNELS];
+	float mean[SLIDING_WINDOW_MAX_CHANNELS];
+	float m2[SLIDING_WINDOW_MAX_CHANNELS]; // Sum of the squared distances from the mean
+} sliding_window;
+
+
+int sliding_window_init(sliding_window *window, int n_channels, int size);
+void sliding_window_reset(sliding_window *window);
+void sliding_window_push(sliding_window *window, const float *sample);
+bool sliding_window_is_step(const sliding_window *window, const float *sample, const float *max_steps);
+float sliding_window_mean(const sliding_window *window, int channel);
+float sliding_window_variance(const sliding_window *window, int channel);
@@ -1,4 +1,5 @@
 #include "math.h"
+#include <string.h>
 #include "math_utilities.h"
 #include "smart_power_meter_utilities.h"
 
@@ -78,17 +79,12 @@ void generate_correct_smart_power_meter_values(float *voltage, float *current_co
  * @param current_produced is the numeric value of the current produced by the building
  * @param power_factor is the numeric value of the loads attacched to the building 
  * @param instant_power is the numeric value of the overall power produced/consumed by the building
- * @param nr_seconds_passed_last_send is the numer of seconds passed since last sending power resource update message
- * @param last_instant_power_send is the numeric value of the last sending power resource update message
- * @param MAX_POWER_ALLOWED is the maximum power allowed to a building 
 */
-void reset_sensor_values(float *current_consumed,float *current_produced,float *power_factor,float *instant_power,int *nr_seconds_passed_last_send,float *last_instant_power_send,float MAX_POWER_ALLOWED){
+void reset_sensor_values(float *current_consumed,float *current_produced,float *power_factor,float *instant_power){
 	*current_consumed=0;
 	*current_produced=0;
 	*power_factor=0;
 	*instant_power=0;
-	*nr_seconds_passed_last_send=0;
-	*last_instant_power_send=-MAX_POWER_ALLOWED;
 }
 
 
@@ -110,14 +106,20 @@ void create_msg_registration(char **json_string_payload){
 	cJSON_AddNumberToObject(root, "type", 1);
 	
 	char *json_payload=cJSON_PrintUnformatted(root);
+	if (json_payload == NULL) {
+		// Also the case of the memory pool exhausted
+		printf("JSON printing failed!\n");
+		cJSON_Delete(root);
+		return;
+	}
 	printf("%s\n",json_payload);
 	
 	// Make sure to allocate memory for the json_string_payload
 	if (*json_string_payload == NULL) {
-		*json_string_payload = (char *)malloc(strlen(json_payload) + 1);
+		*json_string_payload = (char *)cJSON_malloc(strlen(json_payload) + 1);
 		if (*json_string_payload == NULL) {
 			printf("Memory allocation failed!\n");
-			free(json_payload);
+			cJSON_free(json_payload);
 			cJSON_Delete(root); // Clean up the JSON object
 			return;
 		}
@@ -127,7 +129,7 @@ void create_msg_registration(char **json_string_payload){
 	strcpy(*json_string_payload, json_payload);
 
 	// Free the temporary JSON string
-	free(json_payload);
+	cJSON_free(json_payload);
 	
 	// Clean up the root object to avoid memory leaks
 	cJSON_Delete(root);
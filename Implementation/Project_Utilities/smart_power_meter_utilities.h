@@ -1,3 +1,8 @@
+// Readings sent together in a power_obs notification: a full pack must fit in REST_MAX_CHUNK_SIZE.
+#ifndef POWER_BATCH_SIZE
+#define POWER_BATCH_SIZE 5
+#endif
+
 // Define the ranges of voltage provided
 #define MIN_VOLTAGE_PROVIDED 225
 #define MAX_VOLTAGE_PROVIDED 230
@@ -26,7 +31,7 @@ float compute_max_ampere_consumable(float max_power, float min_voltage, float mi
 
 void generate_correct_smart_power_meter_values(float *voltage, float *current_consumed, float *current_produced, float *power_factor,float *instant_power, int nr_loads_attacched,float MAX_AMPERE_CONSUMABLE);
 
-void reset_sensor_values(float *current_consumed,float *current_produced,float *power_factor,float *instant_power,int *nr_seconds_passed_last_send,float *last_instant_power_send,float MAX_POWER_ALLOWED);
+void reset_sensor_values(float *current_consumed,float *current_produced,float *power_factor,float *instant_power);
 
 void create_msg_registration(char **json_string_payload);
 
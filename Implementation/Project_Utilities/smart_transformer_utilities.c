@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "math_utilities.h"
 #include "smart_transformer_utilities.h"
 
@@ -302,14 +303,20 @@ void create_msg_house_change_state(char **json_string_payload,bool state){
 	cJSON_AddBoolToObject(root, "status", state);
 
 	char *json_payload=cJSON_PrintUnformatted(root);
+	if (json_payload == NULL) {
+		// Also the case of the memory pool exhausted
+		printf("JSON printing failed!\n");
+		cJSON_Delete(root);
+		return;
+	}
 	printf("%s\n",json_payload);
 	// Make sure to allocate memory for the json_string_payload
 	
 	if (*json_string_payload == NULL) {
-		*json_string_payload = (char *)malloc(strlen(json_payload) + 1);
+		*json_string_payload = (char *)cJSON_malloc(strlen(json_payload) + 1);
 		if (*json_string_payload == NULL) {
 			printf("Memory allocation failed!\n");
-			free(json_payload);
+			cJSON_free(json_payload);
 			cJSON_Delete(root); // Clean up the JSON object
 			return;
 		}
@@ -320,7 +327,7 @@ void create_msg_house_change_state(char **json_string_payload,bool state){
 	strcpy(*json_string_payload, json_payload);
 
 	// Free the temporary JSON string
-	free(json_payload);
+	cJSON_free(json_payload);
 	
 	// Clean up the root object to avoid memory leaks
 	cJSON_Delete(root);
@@ -343,14 +350,20 @@ void create_msg_registration_st(char **json_string_payload){
 	cJSON_AddNumberToObject(root, "type", 2);
 	
 	char *json_payload=cJSON_PrintUnformatted(root);
+	if (json_payload == NULL) {
+		// Also the case of the memory pool exhausted
+		printf("JSON printing failed!\n");
+		cJSON_Delete(root);
+		return;
+	}
 	printf("%s\n",json_payload);
 	
 	// Make sure to allocate memory for the json_string_payload
 	if (*json_string_payload == NULL) {
-		*json_string_payload = (char *)malloc(strlen(json_payload) + 1);
+		*json_string_payload = (char *)cJSON_malloc(strlen(json_payload) + 1);
 		if (*json_string_payload == NULL) {
 			printf("Memory allocation failed!\n");
-			free(json_payload);
+			cJSON_free(json_payload);
 			cJSON_Delete(root); // Clean up the JSON object
 			return;
 		}
@@ -360,7 +373,7 @@ void create_msg_registration_st(char **json_string_payload){
 	strcpy(*json_string_payload, json_payload);
 
 	// Free the temporary JSON string
-	free(json_payload);
+	cJSON_free(json_payload);
 	
 	// Clean up the root object to avoid memory leaks
 	cJSON_Delete(root);
@@ -9,6 +9,21 @@
 #define FAULT_TYPE_4 4 // 4 Fault symmetric 
 
 
+// Thresholds of the fault classifier of the smart transformer, shared with the host checks (utilities_test)
+
+// Minimum confidence of the decision tree leaf to skip the neural network (a value above 1 always runs the network).
+#ifndef CASCADE_CONFIDENCE_THRESHOLD
+#define CASCADE_CONFIDENCE_THRESHOLD 0.7
+#endif
+
+// The sensing period falls to the floor on a fault, a change of class, a step of the measurements or a confidence of
+// the classifier below ADAPTIVE_LOW_CONFIDENCE. It grows when the confidence is at least ADAPTIVE_HIGH_CONFIDENCE and
+// the standard deviation of each measurement over the full window is within ADAPTIVE_MAX_VOLATILITY of its mean.
+#define ADAPTIVE_LOW_CONFIDENCE 0.6
+#define ADAPTIVE_HIGH_CONFIDENCE 0.9
+#define ADAPTIVE_MAX_VOLATILITY 0.05
+
+
 // Safety range Ia
 #define RANGE_MIN_IA -15.00
 #define RANGE_MAX_IA 24.00
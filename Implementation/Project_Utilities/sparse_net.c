@@ -0,0 +1,83 @@
+#include <math.h>
+
+#include "sparse_net.h"
+
+/*
+ * Inference kernel for pruned networks: every layer is a sparse matrix in CSR format, so the number of
+ * multiply-accumulate operations is the number of weights that survived the pruning instead of n_inputs*n_outputs.
+ */
+
+
+/**
+ * Forward pass of one sparse layer followed by its activation function.
+ * @param layer The layer in CSR format
+ * @param in The input vector (n_inputs)
+ * @param out The output vector (n_outputs)
+ */
+static void sparse_layer_forward(const sparse_net_layer *layer, const float *in, float *out){
+
+	float max, sum;
+
+	for (int o=0; o<layer->n_outputs; o++){
+		float acc=layer->biases[o];
+
+		for (uint16_t k=layer->row_ptr[o]; k<layer->row_ptr[o+1]; k++){
+			acc+=layer->values[k]*in[layer->col_index[k]];
+		}
+		out[o]=acc;
+	}
+
+	switch (layer->activation){
+		case SPARSE_NET_ACTIVATION_TANH:
+			for (int o=0; o<layer->n_outputs; o++){
+				out[o]=tanhf(out[o]);
+			}
+			break;
+
+		case SPARSE_NET_ACTIVATION_SOFTMAX:
+			max=out[0];
+			sum=0;
+			for (int o=1; o<layer->n_outputs; o++){
+				max=(out[o]>max)?out[o]:max;
+			}
+			for (int o=0; o<layer->n_outputs; o++){
+				out[o]=expf(out[o]-max);
+				sum+=out[o];
+			}
+			for (int o=0; o<layer->n_outputs; o++){
+				out[o]/=sum;
+			}
+			break;
+	}
+}
+
+
+/**
+ * Executes the inference of a pruned network, with the same interface of eml_net_predict_proba().
+ * @param net The sparse network
+ * @param features The input vector
+ * @param n_features The length of the input vector
+ * @param outputs The vector of probabilities to be populated
+ * @param n_outputs The length of the output vector
+ * @return 0 on success, -1 if the sizes do not match the ones of the network
+ */
+int sparse_net_predict_proba(const sparse_net *net, const float *features, int n_features, float *outputs, int n_outputs){
+
+	const float *in=features;
+	float *out=net->buf1;
+
+	if (n_features!=net->layers[0].n_inputs || n_outputs!=net->layers[net->n_layers-1].n_outputs){
+		return -1;
+	}
+
+	for (int l=0; l<net->n_layers; l++){
+		// The last layer writes directly into the caller's vector.
+		if (l==net->n_layers-1){
+			out=outputs;
+		}
+		sparse_layer_forward(&net->layers[l],in,out);
+		in=out;
+		out=(out==net->buf1)?net->buf2:net->buf1;
+	}
+	return 0;
+}
@@ -0,0 +1,28 @@
+#include <stdint.h>
+
+typedef enum {
+	SPARSE_NET_ACTIVATION_TANH,
+	SPARSE_NET_ACTIVATION_SOFTMAX
+} sparse_net_activation;
+
+// Fully connected layer stored in CSR (Compressed Sparse Row) format, one row per output neuron.
+typedef struct {
+	int16_t n_outputs;
+	int16_t n_inputs;
+	const uint16_t *row_ptr;    // n_outputs+1 offsets inside col_index/values
+	const uint16_t *col_index;  // Index of the input multiplied by each non-zero weight
+	const float *values;        // Non-zero weights
+	const float *biases;
+	sparse_net_activation activation;
+} sparse_net_layer;
+
+typedef struct {
+	int16_t n_layers;
+	const sparse_net_layer *layers;
+	float *buf1;
+	float *buf2;
+	int16_t buf_length;
+} sparse_net;
+
+
+int sparse_net_predict_proba(const sparse_net *net, const float *features, int n_features, float *outputs, int n_outputs);